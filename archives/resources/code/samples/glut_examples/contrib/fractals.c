@@ -17,6 +17,10 @@
  * Fog would make the island look much better, but I couldn't get it to work
  * correctly.  Would line up on -z axis not from eye.
  *
+ * The mountains are built in terrain.c, as vertex arrays that keep every
+ * level made so far; the tree and island lists are only rebuilt when the
+ * level or the random numbers change.
+ *
  * Philip Winston - 3/4/95
  * pwinston@hmc.edu
  * http://www.cs.hmc.edu/people/pwinston
@@ -34,6 +38,7 @@
 #include <time.h>  /* for random seed */
 
 #include "fracviewer.h"
+#include "terrain.h"
 
 #ifdef WIN32
 #define drand48() (((float) rand())/((float) RAND_MAX))
@@ -44,8 +49,6 @@ typedef enum { NOTALLOWED, MOUNTAIN, TREE, ISLAND, BIGMTN, STEM, LEAF,
                MOUNTAIN_MAT, WATER_MAT, LEAF_MAT, TREE_MAT, STEMANDLEAVES,
                AXES } DisplayLists;
 
-#define MAXLEVEL 8
-
 int Rebuild = 1,        /* Rebuild display list in next display? */
     Fract   = TREE,     /* What fractal are we building */
     Level   = 4;        /* levels of recursion for fractals */     
@@ -94,40 +97,17 @@ void triagnormal(float v1[3], float v2[3], float v3[3], float norm[3])
   ncrossprod(vec2, vec1, norm);
 }
 
-float xzlength(float v1[3], float v2[3])
-{
-  return sqrt((v1[0] - v2[0])*(v1[0] - v2[0]) +
-              (v1[2] - v2[2])*(v1[2] - v2[2]));
-}
-
-float xzslope(float v1[3], float v2[3])
-{
-  return ((v1[0] != v2[0]) ? ((v1[2] - v2[2]) / (v1[0] - v2[0]))
-	                   : FLT_MAX);
-}
-
 
 /***************************************************************/
 /************************ MOUNTAIN STUFF ***********************/
 /***************************************************************/
 
-GLfloat DispFactor[MAXLEVEL];  /* Array of what to multiply random number
-				  by for a given level to get midpoint
-				  displacement  */
-GLfloat DispBias[MAXLEVEL];  /* Array of what to add to random number
-				before multiplying it by DispFactor */
-
 #define NUMRANDS 191
 float RandTable[NUMRANDS];  /* hash table of random numbers so we can
 			       raise the same midpoints by the same amount */ 
 
-         /* The following are for permitting an edge of a moutain to be   */
-         /* pegged so it won't be displaced up or down.  This makes it    */
-         /* easier to setup scenes and makes a single moutain look better */
-
-GLfloat Verts[3][3],    /* Vertices of outside edges of mountain */
-        Slopes[3];      /* Slopes between these outside edges */
-int     Pegged[3];      /* Is this edge pegged or not */           
+Terrain *Mountain;      /* every level of it built so far, in terrain.c */
+int MountainLevel = -1; /* level in the MOUNTAIN list, -1 if none yet */
 
  /*
   * Comes up with a new table of random numbers [0,1)
@@ -141,109 +121,56 @@ void InitRandTable(unsigned int seed)
     RandTable[i] = drand48() - 0.5;
 }
 
-  /* calculate midpoint and displace it if required */
-void Midpoint(GLfloat mid[3], GLfloat v1[3], GLfloat v2[3],
-	      int edge, int level)
-{
-  unsigned hash;
-
-  mid[0] = (v1[0] + v2[0]) / 2;
-  mid[1] = (v1[1] + v2[1]) / 2;
-  mid[2] = (v1[2] + v2[2]) / 2;
-  if (!Pegged[edge] || (fabs(xzslope(Verts[edge], mid) 
-                        - Slopes[edge]) > 0.00001)) {
-    srand48((int)((v1[0]+v2[0])*23344));
-    hash = drand48() * 7334334;
-    srand48((int)((v2[2]+v1[2])*43433));
-    hash = (unsigned)(drand48() * 634344 + hash) % NUMRANDS;
-    mid[1] += ((RandTable[hash] + DispBias[level]) * DispFactor[level]);
-  }
-}
-
-  /*
-   * Recursive moutain drawing routine -- from lecture with addition of 
-   * allowing an edge to be pegged.  This function requires the above
-   * globals to be set, as well as the Level global for fractal level 
-   */
-void FMR(GLfloat v1[3], GLfloat v2[3], GLfloat v3[3], int level)
-{
-  if (level == Level) {
-    GLfloat norm[3];
-
-    triagnormal(v1, v2, v3, norm);
-    glNormal3fv(norm);
-    glVertex3fv(v1);
-    glVertex3fv(v2);
-    glVertex3fv(v3);
-
-  } else {
-    GLfloat m1[3], m2[3], m3[3];
-
-    Midpoint(m1, v1, v2, 0, level);
-    Midpoint(m2, v2, v3, 1, level);
-    Midpoint(m3, v3, v1, 2, level);
-
-    FMR(v1, m1, m3, level + 1);
-    FMR(m1, v2, m2, level + 1);
-    FMR(m3, m2, v3, level + 1);
-    FMR(m1, m2, m3, level + 1);
-  }
-}
-
  /*
-  * sets up lookup tables and calls recursive mountain function
+  * draws a level of the mountain from its vertex arrays, subdividing
+  * the deepest level built so far until it's there
   */
-void FractalMountain(GLfloat v1[3], GLfloat v2[3], GLfloat v3[3],
-                     int pegged[3])
+void FractalMountain(Terrain *t, int level)
 {
-  GLfloat lengths[MAXLEVEL];
-  GLfloat fraction[8] = { 0.3, 0.3, 0.4, 0.2, 0.3, 0.2, 0.4, 0.4  };
-  GLfloat bias[8]     = { 0.1, 0.1, 0.1, 0.1, 0.1, 0.1, 0.1, 0.1  };
-  int i;
-  float avglen = (xzlength(v1, v2) + 
-                  xzlength(v2, v3) +
-		  xzlength(v3, v1) / 3);
-
-  for (i = 0; i < 3; i++) {
-    Verts[0][i] = v1[i];      /* set mountain vertex globals */
-    Verts[1][i] = v2[i];
-    Verts[2][i] = v3[i];
-    Pegged[i] = pegged[i];
-  }
-
-  Slopes[0] = xzslope(Verts[0], Verts[1]);   /* set edge slope globals */
-  Slopes[1] = xzslope(Verts[1], Verts[2]);
-  Slopes[2] = xzslope(Verts[2], Verts[0]);
+  GLfloat *xyz, *normal;
+  GLuint *index;
+  int ntris;
 
-  lengths[0] = avglen;          
-  for (i = 1; i < Level; i++) {   
-    lengths[i] = lengths[i-1]/2;     /* compute edge length for each level */
+  if (TerrainBuild(t, level)) {
+    fprintf(stderr, "Not enough memory for level %d\n", level);
+    level = TerrainLevels(t);
   }
-
-  for (i = 0; i < Level; i++) {     /* DispFactor and DispBias arrays */      
-    DispFactor[i] = (lengths[i] * ((i <= 7) ? fraction[i] : fraction[7]));
-    DispBias[i]   = ((i <= 7) ? bias[i] : bias[7]);
-  } 
-
-  glBegin(GL_TRIANGLES);
-    FMR(v1, v2, v3, 0);    /* issues no GL but vertex calls */
-  glEnd();
+  if (TerrainVertices(t, level, &xyz, &normal) < 0)
+    return;
+  ntris = TerrainTriangles(t, level, &index);
+
+  glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+  glEnableClientState(GL_VERTEX_ARRAY);
+  glEnableClientState(GL_NORMAL_ARRAY);
+  glVertexPointer(3, GL_FLOAT, 0, xyz);
+  glNormalPointer(GL_FLOAT, 0, normal);
+  glDrawElements(GL_TRIANGLES, ntris * 3, GL_UNSIGNED_INT, index);
+  glPopClientAttrib();
 }
 
  /*
-  * draw a mountain and build the display list
+  * draw a mountain and build the display list, unless it's already there
   */
 void CreateMountain(void)
 {
   GLfloat v1[3] = { 0, 0, -1 }, v2[3] = { -1, 0, 1 }, v3[3] = { 1, 0, 1 };
   int pegged[3] = { 1, 1, 1 };
 
+  if (MountainLevel == Level)
+    return;
+  if (!Mountain)
+    Mountain = TerrainNew(v1, v2, v3, pegged, RandTable, NUMRANDS);
+
   glNewList(MOUNTAIN, GL_COMPILE);
   glPushAttrib(GL_LIGHTING_BIT);
     glCallList(MOUNTAIN_MAT);
-    FractalMountain(v1, v2, v3, pegged);
+    if (Mountain)
+      FractalMountain(Mountain, Level);
+    else
+      fprintf(stderr, "Not enough memory for a mountain\n");
   glPopAttrib();
   glEndList();
+  MountainLevel = Level;
 }
 
   /*
@@ -252,6 +179,10 @@ void CreateMountain(void)
 void NewMountain(void)
 {
   InitRandTable(time(NULL));
+  if (Mountain)
+    TerrainDelete(Mountain);
+  Mountain = NULL;
+  MountainLevel = -1;
 }
 
 /***************************************************************/
@@ -260,6 +191,7 @@ void NewMountain(void)
 
 long TreeSeed;   /* for srand48 - remember so we can build "same tree"
                      at a different level */
+int TreeLevel = -1;  /* level in the TREE list, -1 if none yet */
 
  /*
   * recursive tree drawing thing, fleshed out from class notes pseudocode 
@@ -360,10 +292,12 @@ void CreateTreeLists(void)
 }
 
  /*
-  * draw and build display list for tree
+  * draw and build display list for tree, unless it's already there
   */
 void CreateTree(void)
 {
+  if (TreeLevel == Level)
+    return;
   srand48(TreeSeed);
 
   glNewList(TREE, GL_COMPILE);
@@ -375,6 +309,7 @@ void CreateTree(void)
     glPopAttrib();
     glPopMatrix();
   glEndList();  
+  TreeLevel = Level;
 }
 
  /*
@@ -383,15 +318,20 @@ void CreateTree(void)
 void NewTree(void)
 {
   TreeSeed = time(NULL);
+  TreeLevel = -1;
 }
 
 /***************************************************************/
 /*********************** FRACTAL PLANET ************************/
 /***************************************************************/
 
+int IslandBuilt = 0;   /* it only calls MOUNTAIN, so one list does */
+
 void CreateIsland(void)
 {
   CreateMountain();
+  if (IslandBuilt)
+    return;
   glNewList(ISLAND, GL_COMPILE);
   glPushAttrib(GL_LIGHTING_BIT);
   glMatrixMode(GL_MODELVIEW);
@@ -438,6 +378,7 @@ void CreateIsland(void)
   glPopMatrix();
   glPopAttrib();
   glEndList();  
+  IslandBuilt = 1;
 }
 
 
@@ -663,7 +604,9 @@ void MenuInit(void)
   glutAddMenuEntry("2", 2);  glutAddMenuEntry("3", 3);
   glutAddMenuEntry("4", 4);  glutAddMenuEntry("5", 5);
   glutAddMenuEntry("6", 6);  glutAddMenuEntry("7", 7);
-  glutAddMenuEntry("8", 8);
+  glutAddMenuEntry("8", 8);  glutAddMenuEntry("9", 9);
+  glutAddMenuEntry("10", 10);  glutAddMenuEntry("11", 11);
+  glutAddMenuEntry("12", 12);
 
   submenu2 = glutCreateMenu(choosefract);
   glutAddMenuEntry("Moutain", MOUNTAIN);
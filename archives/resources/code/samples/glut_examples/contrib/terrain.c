@@ -0,0 +1,426 @@
+/*
+ * terrain.c
+ *
+ * Fractal mountains as indexed meshes, see terrain.h.
+ *
+ * The deepest level built keeps, besides its triangles' vertex indices,
+ * a table of its edges (two vertex indices each, and which side of the
+ * mountain the edge is on, if any) and each triangle's three edges, each
+ * with a bit for whether the edge runs the other way from the triangle.
+ * Subdividing it, edge e's midpoint becomes vertex nverts + e and its
+ * halves edges 2e and 2e+1; triangle t's four
+ * children become triangles 4t to 4t+3, in FMR()'s order, and the three
+ * edges inside it edges 2*nedges + 3t to 2*nedges + 3t + 2.  So where
+ * everything goes follows from the index of what it came from: the
+ * midpoints can be made by ranges of edges and the children by ranges
+ * of triangles, on as many threads as there are, with nothing to look
+ * up or lock.
+ *
+ * The random hash is the one FMR()'s Midpoint() used, but works out
+ * what srand48() followed by drand48() gives without touching their
+ * state, which isn't safe to share between threads.  Whether a midpoint
+ * is on a pegged edge comes from the side its edge is on, where
+ * Midpoint() worked it out from the slopes; that came out the same to
+ * level 8 but let rounding lift points near the corners of deeper ones.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "terrain.h"
+#include "pool.h"
+
+#define TR_MAXLEVEL 14        /* 4^14 triangles is already gigabytes */
+#define TR_THREAD_MIN 4096    /* fewest edges or triangles worth a thread */
+
+typedef void (*TRwork)(Terrain *t, int begin, int end);
+
+struct _Terrain {
+  float verts[3][3];          /* corners of the mountain */
+  int pegged[3];
+  float dispFactor[TR_MAXLEVEL], dispBias[TR_MAXLEVEL];
+  float *rands;
+  int nrands;
+
+  int levels;                 /* deepest level built */
+  int nverts;                 /* vertices of the deepest level */
+  float *xyz;
+  int ntris[TR_MAXLEVEL + 1];
+  unsigned *tri[TR_MAXLEVEL + 1];
+
+  int nedges;                 /* the deepest level's edges */
+  unsigned *edge;             /* 2 vertices per edge */
+  signed char *side;          /* side of the mountain it's on, or -1 */
+  unsigned *triEdge;          /* 3 per triangle, 2 * edge + backwards */
+
+  float *normal;
+  int normalSize;             /* vertices there's room for */
+  int normalLevel;            /* level the normals are for, -1 if none */
+
+  unsigned *newEdge, *newTriEdge;  /* the level being made */
+  signed char *newSide;
+  int threads;
+  pool_t *pool;
+};
+
+/***************************************************************/
+/*************************** MIDPOINTS *************************/
+/***************************************************************/
+
+static float XZLength(float v1[3], float v2[3])
+{
+  return sqrt((v1[0] - v2[0])*(v1[0] - v2[0]) +
+              (v1[2] - v2[2])*(v1[2] - v2[2]));
+}
+
+  /*
+   * What drand48() returns first after srand48(seed): one step of
+   * x = 0x5DEECE66D * x + 0xB mod 2^48 from x = seed << 16 | 0x330E, in
+   * 16 bit pieces so 32 bit longs will do.
+   */
+static double Rand48(long seed)
+{
+  unsigned long x0 = 0x330E,
+                x1 = (unsigned long) seed & 0xffff,
+                x2 = ((unsigned long) seed >> 16) & 0xffff;
+  unsigned long p, carry, r0, r1, r2;
+
+  p = 0xE66D * x0 + 0xB;
+  r0 = p & 0xffff;
+  carry = p >> 16;
+  p = ((0xE66D * x1) & 0xffff) + ((0xDEEC * x0) & 0xffff) + carry;
+  r1 = p & 0xffff;
+  carry = ((0xE66D * x1) >> 16) + ((0xDEEC * x0) >> 16) + (p >> 16);
+  r2 = (0xE66D * x2 + 0xDEEC * x1 + 0x5 * x0 + carry) & 0xffff;
+  return ((r2 * 65536.0 + r1) * 65536.0 + r0) / 281474976710656.0;
+}
+
+  /*
+   * calculate midpoint and displace it unless it's on a pegged side --
+   * Midpoint() from FMR()
+   */
+static void Midpoint(Terrain *t, float mid[3], float v1[3], float v2[3],
+                     int side, int level)
+{
+  unsigned hash;
+
+  mid[0] = (v1[0] + v2[0]) / 2;
+  mid[1] = (v1[1] + v2[1]) / 2;
+  mid[2] = (v1[2] + v2[2]) / 2;
+  if (side < 0 || !t->pegged[side]) {
+    hash = Rand48((int)((v1[0]+v2[0])*23344)) * 7334334;
+    hash = (unsigned)(Rand48((int)((v2[2]+v1[2])*43433)) * 634344 + hash)
+           % t->nrands;
+    mid[1] += ((t->rands[hash] + t->dispBias[level]) * t->dispFactor[level]);
+  }
+}
+
+/***************************************************************/
+/************************* SUBDIVIDING *************************/
+/***************************************************************/
+
+  /* midpoints and halves of edges begin to end of the deepest level */
+static void SplitEdges(Terrain *t, int begin, int end)
+{
+  unsigned a, b, mid;
+  int e;
+
+  for (e = begin; e < end; e++) {
+    a = t->edge[2*e];
+    b = t->edge[2*e + 1];
+    mid = t->nverts + e;
+    Midpoint(t, &t->xyz[3*mid], &t->xyz[3*a], &t->xyz[3*b], t->side[e],
+             t->levels);
+    t->newEdge[4*e] = a;
+    t->newEdge[4*e + 1] = mid;
+    t->newEdge[4*e + 2] = mid;
+    t->newEdge[4*e + 3] = b;
+    t->newSide[2*e] = t->newSide[2*e + 1] = t->side[e];
+  }
+}
+
+  /*
+   * A triangle's edge te split: the half from its first vertex to the
+   * midpoint, then the one on from there.  Edge e from a to b becomes
+   * 2e from a to the midpoint and 2e + 1 from there to b, and the halves
+   * run backwards for the child triangles whenever te did.
+   */
+#define FIRST(te)  (2*(te) + ((te) & 1))
+#define SECOND(te) (2*((te) ^ 1) + ((te) & 1))
+
+  /* children of triangles begin to end of the deepest level */
+static void SplitTriangles(Terrain *t, int begin, int end)
+{
+  unsigned *tri = t->tri[t->levels], *child = t->tri[t->levels + 1];
+  unsigned *te, *c, *ce, *ie, v1, v2, v3, m1, m2, m3, i;
+  int n;
+
+  for (n = begin; n < end; n++) {
+    v1 = tri[3*n];  v2 = tri[3*n + 1];  v3 = tri[3*n + 2];
+    te = &t->triEdge[3*n];
+    m1 = t->nverts + (te[0] >> 1);
+    m2 = t->nverts + (te[1] >> 1);
+    m3 = t->nverts + (te[2] >> 1);
+
+    /* m1 m2, m2 m3 and m3 m1 are new */
+    i = 2*t->nedges + 3*n;
+    ie = &t->newEdge[2*i];
+    ie[0] = m1;  ie[1] = m2;
+    ie[2] = m2;  ie[3] = m3;
+    ie[4] = m3;  ie[5] = m1;
+    t->newSide[i] = t->newSide[i + 1] = t->newSide[i + 2] = -1;
+
+    /* FMR(v1, m1, m3), FMR(m1, v2, m2), FMR(m3, m2, v3), FMR(m1, m2, m3) */
+    c = &child[12*n];
+    c[0] = v1;  c[1]  = m1;  c[2]  = m3;
+    c[3] = m1;  c[4]  = v2;  c[5]  = m2;
+    c[6] = m3;  c[7]  = m2;  c[8]  = v3;
+    c[9] = m1;  c[10] = m2;  c[11] = m3;
+
+    ce = &t->newTriEdge[12*n];
+    ce[0] = FIRST(te[0]);   ce[1]  = 2*(i + 2) + 1;  ce[2]  = SECOND(te[2]);
+    ce[3] = SECOND(te[0]);  ce[4]  = FIRST(te[1]);   ce[5]  = 2*i + 1;
+    ce[6] = 2*(i + 1) + 1;  ce[7]  = SECOND(te[1]);  ce[8]  = FIRST(te[2]);
+    ce[9] = 2*i;            ce[10] = 2*(i + 1);      ce[11] = 2*(i + 2);
+  }
+}
+
+/***************************************************************/
+/*************************** THREADS ***************************/
+/***************************************************************/
+
+  /* a job for the worker pool in sig99/adv99/util */
+typedef struct {
+  Terrain *t;
+  TRwork work;
+} TRjob;
+
+static void RunRange(void *arg, int begin, int end)
+{
+  TRjob *job = (TRjob *) arg;
+
+  job->work(job->t, begin, end);
+}
+
+  /* work(t, begin, end) over 0 to n, split between threads if worth it */
+static void Run(Terrain *t, TRwork work, int n)
+{
+  TRjob job;
+  int ranges;
+
+  ranges = n / TR_THREAD_MIN;
+  if (ranges > t->threads)
+    ranges = t->threads;
+  if (ranges > 1 && !t->pool)
+    t->pool = pool_new(t->threads);
+  if (ranges > pool_threads(t->pool))
+    ranges = pool_threads(t->pool);
+  if (ranges < 1)
+    ranges = 1;
+  job.t = t;
+  job.work = work;
+  pool_run(t->pool, RunRange, &job, ranges, (n + ranges - 1) / ranges, n);
+}
+
+  /* make the level below the deepest one; 0 if all went well */
+static int Subdivide(Terrain *t)
+{
+  int nt = t->ntris[t->levels], ne = 2*t->nedges + 3*nt;
+  float *xyz;
+
+  xyz = (float *) realloc(t->xyz,
+                          (size_t) (t->nverts + t->nedges) * 3 * sizeof(float));
+  if (!xyz)
+    return -1;
+  t->xyz = xyz;
+  t->tri[t->levels + 1] = (unsigned *) malloc((size_t) nt * 12 * sizeof(unsigned));
+  t->newTriEdge = (unsigned *) malloc((size_t) nt * 12 * sizeof(unsigned));
+  t->newEdge = (unsigned *) malloc((size_t) ne * 2 * sizeof(unsigned));
+  t->newSide = (signed char *) malloc(ne);
+  if (!t->tri[t->levels + 1] || !t->newTriEdge || !t->newEdge ||
+      !t->newSide) {
+    free(t->tri[t->levels + 1]);
+    free(t->newTriEdge);
+    free(t->newEdge);
+    free(t->newSide);
+    t->tri[t->levels + 1] = NULL;
+    return -1;
+  }
+
+  Run(t, SplitEdges, t->nedges);
+  Run(t, SplitTriangles, nt);
+
+  free(t->edge);
+  free(t->side);
+  free(t->triEdge);
+  t->edge = t->newEdge;
+  t->side = t->newSide;
+  t->triEdge = t->newTriEdge;
+  t->nverts += t->nedges;
+  t->nedges = ne;
+  t->levels++;
+  t->ntris[t->levels] = 4*nt;
+  return 0;
+}
+
+/***************************************************************/
+/***************************** API *****************************/
+/***************************************************************/
+
+Terrain *TerrainNew(float v1[3], float v2[3], float v3[3],
+                    int pegged[3], float *rands, int nrands)
+{
+  float fraction[8] = { 0.3, 0.3, 0.4, 0.2, 0.3, 0.2, 0.4, 0.4  };
+  float bias[8]     = { 0.1, 0.1, 0.1, 0.1, 0.1, 0.1, 0.1, 0.1  };
+  float lengths[TR_MAXLEVEL];
+  float avglen = (XZLength(v1, v2) +     /* as FractalMountain() had it */
+                  XZLength(v2, v3) +
+		  XZLength(v3, v1) / 3);
+  Terrain *t;
+  int i;
+
+  t = (Terrain *) calloc(1, sizeof(Terrain));
+  if (!t)
+    return NULL;
+  t->rands = (float *) malloc(nrands * sizeof(float));
+  t->xyz = (float *) malloc(9 * sizeof(float));
+  t->tri[0] = (unsigned *) malloc(3 * sizeof(unsigned));
+  t->edge = (unsigned *) malloc(6 * sizeof(unsigned));
+  t->side = (signed char *) malloc(3);
+  t->triEdge = (unsigned *) malloc(3 * sizeof(unsigned));
+  if (!t->rands || !t->xyz || !t->tri[0] || !t->edge || !t->side ||
+      !t->triEdge) {
+    TerrainDelete(t);
+    return NULL;
+  }
+  memcpy(t->rands, rands, nrands * sizeof(float));
+  t->nrands = nrands;
+
+  for (i = 0; i < 3; i++) {
+    t->verts[0][i] = v1[i];
+    t->verts[1][i] = v2[i];
+    t->verts[2][i] = v3[i];
+    t->pegged[i] = pegged[i];
+  }
+
+  lengths[0] = avglen;
+  for (i = 1; i < TR_MAXLEVEL; i++)
+    lengths[i] = lengths[i-1]/2;
+  for (i = 0; i < TR_MAXLEVEL; i++) {
+    t->dispFactor[i] = (lengths[i] * ((i <= 7) ? fraction[i] : fraction[7]));
+    t->dispBias[i]   = ((i <= 7) ? bias[i] : bias[7]);
+  }
+
+    /* level 0 is the triangle itself */
+  memcpy(t->xyz, t->verts, 9 * sizeof(float));
+  t->nverts = 3;
+  for (i = 0; i < 3; i++) {
+    t->tri[0][i] = i;
+    t->triEdge[i] = 2*i;
+    t->side[i] = i;
+    t->edge[2*i] = i;
+    t->edge[2*i + 1] = (i + 1) % 3;
+  }
+  t->ntris[0] = 1;
+  t->nedges = 3;
+  t->normalLevel = -1;
+
+  t->threads = pool_cpus();
+  return t;
+}
+
+void TerrainDelete(Terrain *t)
+{
+  int i;
+
+  pool_delete(t->pool);
+  for (i = 0; i <= TR_MAXLEVEL; i++)
+    free(t->tri[i]);
+  free(t->rands);
+  free(t->xyz);
+  free(t->edge);
+  free(t->side);
+  free(t->triEdge);
+  free(t->normal);
+  free(t);
+}
+
+int TerrainBuild(Terrain *t, int level)
+{
+  if (level > TR_MAXLEVEL)
+    return -1;
+  while (t->levels < level)
+    if (Subdivide(t))
+      return -1;
+  return 0;
+}
+
+int TerrainLevels(Terrain *t)
+{
+  return t->levels;
+}
+
+int TerrainVertices(Terrain *t, int level, float **xyz, float **normal)
+{
+  int nverts, i, j, k;
+  unsigned *tri;
+  float *v[3], *n, e1[3], e2[3], c[3], d;
+
+  if (level < 0 || level > t->levels)
+    return -1;
+  nverts = (((1 << level) + 1) * ((1 << level) + 2)) / 2;
+
+  if (t->normalLevel != level) {
+    if (nverts > t->normalSize) {     /* kept, so going back up is quick */
+      free(t->normal);
+      t->normalSize = 0;
+      t->normalLevel = -1;
+      t->normal = (float *) malloc((size_t) nverts * 3 * sizeof(float));
+      if (!t->normal)
+        return -1;
+      t->normalSize = nverts;
+    }
+    memset(t->normal, 0, (size_t) nverts * 3 * sizeof(float));
+    tri = t->tri[level];
+    for (i = 0; i < t->ntris[level]; i++) {
+      for (j = 0; j < 3; j++)
+        v[j] = &t->xyz[3*tri[3*i + j]];
+      for (k = 0; k < 3; k++) {
+        e1[k] = v[1][k] - v[0][k];
+        e2[k] = v[2][k] - v[0][k];
+      }
+      c[0] = e1[1]*e2[2] - e1[2]*e2[1];   /* twice the area, as triagnormal() */
+      c[1] = e1[2]*e2[0] - e1[0]*e2[2];
+      c[2] = e1[0]*e2[1] - e1[1]*e2[0];
+      for (j = 0; j < 3; j++)
+        for (k = 0; k < 3; k++)
+          t->normal[3*tri[3*i + j] + k] += c[k];
+    }
+    for (i = 0; i < nverts; i++) {
+      n = &t->normal[3*i];
+      d = sqrt(n[0]*n[0] + n[1]*n[1] + n[2]*n[2]);
+      if (d > 0) {
+        n[0] /= d;  n[1] /= d;  n[2] /= d;
+      }
+    }
+    t->normalLevel = level;
+  }
+  *xyz = t->xyz;
+  *normal = t->normal;
+  return nverts;
+}
+
+int TerrainTriangles(Terrain *t, int level, unsigned **index)
+{
+  if (level < 0 || level > t->levels)
+    return -1;
+  *index = t->tri[level];
+  return t->ntris[level];
+}
+
+void TerrainThreads(Terrain *t, int threads)
+{
+  t->threads = threads < 1 ? 1 : threads;
+  pool_delete(t->pool);
+  t->pool = NULL;
+}
@@ -0,0 +1,56 @@
+/*
+ * terrain.h
+ *
+ * Fractal mountains as indexed triangle meshes, for fractals.c.  Same
+ * midpoint displacement as the recursive FMR() it replaces -- same random
+ * table hashing, same pegged edges -- but built a level at a time into
+ * arrays of shared vertices and triangle indices ready for glDrawElements.
+ *
+ * Every level built is kept, and the vertices of a level are the first
+ * ones of the next, so going deeper only subdivides the deepest level
+ * built so far and going back up costs nothing.  Each edge's midpoint is
+ * made once, for both triangles on it.  Within a level, the midpoints and
+ * the new triangles can be split between threads.
+ *
+ * No GL in here, so terrainbench can use it too.
+ */
+
+#ifndef TERRAIN_H
+#define TERRAIN_H
+
+typedef struct _Terrain Terrain;
+
+  /* A mountain on the triangle v1 v2 v3 (y up), with midpoints raised by
+     numbers from rands[nrands], each in [-0.5, 0.5).  Edges of the
+     triangle with pegged[] set (v1 v2, v2 v3, v3 v1) stay flat.  The
+     table is copied.  NULL if out of memory. */
+extern Terrain *TerrainNew(float v1[3], float v2[3], float v3[3],
+                           int pegged[3], float *rands, int nrands);
+
+extern void TerrainDelete(Terrain *t);
+
+  /* Subdivide until level is built, starting from the deepest level
+     already built; 0 if all went well, -1 if out of memory (the levels
+     built before are still there). */
+extern int TerrainBuild(Terrain *t, int level);
+
+  /* Deepest level built */
+extern int TerrainLevels(Terrain *t);
+
+  /* For a level already built: its vertex count, and in *xyz and
+     *normal, 3 floats per vertex; the normals are area weighted
+     averages of the triangles around each vertex, made on the first
+     call for the level.  -1 if the level isn't built or out of memory.
+     The arrays move when a deeper level is built. */
+extern int TerrainVertices(Terrain *t, int level, float **xyz,
+                           float **normal);
+
+  /* For a level already built: its triangle count, and in *index, 3
+     vertex indices per triangle, in the order FMR() drew them. */
+extern int TerrainTriangles(Terrain *t, int level, unsigned **index);
+
+  /* Most threads TerrainBuild() may use (the number of processors
+     unless set) */
+extern void TerrainThreads(Terrain *t, int threads);
+
+#endif
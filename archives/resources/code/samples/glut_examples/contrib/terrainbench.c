@@ -0,0 +1,291 @@
+/*
+ * terrainbench.c
+ *
+ * Time terrain.c without drawing anything, on the mountain fractals.c
+ * draws.  For each level it checks the triangles against the recursive
+ * FMR() fractals.c used before, then times, for at least a quarter of a
+ * second each: building the level from scratch the new way and the old
+ * way, building it from the level above, and working out its normals.
+ * Levels past the old way's 8 are only built the new way, each from the
+ * one above.
+ *
+ * Usage: terrainbench [deepest level [threads]]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <float.h>
+
+#include "terrain.h"
+
+#ifdef WIN32
+#define drand48() (((float) rand())/((float) RAND_MAX))
+#define srand48(x) (srand((x)))
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+typedef int timer;
+#define getTime(a)	(a = GetTickCount())
+#define timeDiff(a, b)	((b - a) * 1000)
+#else
+#include <sys/time.h>
+typedef struct timeval timer;
+#define getTime(a)	gettimeofday(&a, NULL)
+#define timeDiff(a, b)	(((b.tv_sec - a.tv_sec) * 1000000) + b.tv_usec - a.tv_usec)
+#endif
+
+#define MAXLEVEL 8
+#define NUMRANDS 191
+
+float RandTable[NUMRANDS];
+
+float V1[3] = { 0, 0, -1 }, V2[3] = { -1, 0, 1 }, V3[3] = { 1, 0, 1 };
+int Peg[3] = { 1, 1, 1 };
+
+/***************************************************************/
+/********************** THE OLD WAY ****************************/
+/***************************************************************/
+
+  /* fractals.c's mountain, storing triangles instead of drawing them */
+
+typedef float GLfloat;
+
+GLfloat DispFactor[MAXLEVEL];
+GLfloat DispBias[MAXLEVEL];
+GLfloat Verts[3][3], Slopes[3];
+int     Pegged[3];
+int     Level;
+float   *Out;      /* 9 floats per triangle */
+int     NumOut;
+
+float xzlength(float v1[3], float v2[3])
+{
+  return sqrt((v1[0] - v2[0])*(v1[0] - v2[0]) +
+              (v1[2] - v2[2])*(v1[2] - v2[2]));
+}
+
+float xzslope(float v1[3], float v2[3])
+{
+  return ((v1[0] != v2[0]) ? ((v1[2] - v2[2]) / (v1[0] - v2[0]))
+	                   : FLT_MAX);
+}
+
+void Midpoint(GLfloat mid[3], GLfloat v1[3], GLfloat v2[3],
+	      int edge, int level)
+{
+  unsigned hash;
+
+  mid[0] = (v1[0] + v2[0]) / 2;
+  mid[1] = (v1[1] + v2[1]) / 2;
+  mid[2] = (v1[2] + v2[2]) / 2;
+  if (!Pegged[edge] || (fabs(xzslope(Verts[edge], mid)
+                        - Slopes[edge]) > 0.00001)) {
+    srand48((int)((v1[0]+v2[0])*23344));
+    hash = drand48() * 7334334;
+    srand48((int)((v2[2]+v1[2])*43433));
+    hash = (unsigned)(drand48() * 634344 + hash) % NUMRANDS;
+    mid[1] += ((RandTable[hash] + DispBias[level]) * DispFactor[level]);
+  }
+}
+
+void FMR(GLfloat v1[3], GLfloat v2[3], GLfloat v3[3], int level)
+{
+  if (level == Level) {
+    int i;
+
+    for (i = 0; i < 3; i++) {
+      Out[9*NumOut + i] = v1[i];
+      Out[9*NumOut + 3 + i] = v2[i];
+      Out[9*NumOut + 6 + i] = v3[i];
+    }
+    NumOut++;
+
+  } else {
+    GLfloat m1[3], m2[3], m3[3];
+
+    Midpoint(m1, v1, v2, 0, level);
+    Midpoint(m2, v2, v3, 1, level);
+    Midpoint(m3, v3, v1, 2, level);
+
+    FMR(v1, m1, m3, level + 1);
+    FMR(m1, v2, m2, level + 1);
+    FMR(m3, m2, v3, level + 1);
+    FMR(m1, m2, m3, level + 1);
+  }
+}
+
+void FractalMountain(GLfloat v1[3], GLfloat v2[3], GLfloat v3[3],
+                     int pegged[3])
+{
+  GLfloat lengths[MAXLEVEL];
+  GLfloat fraction[8] = { 0.3, 0.3, 0.4, 0.2, 0.3, 0.2, 0.4, 0.4  };
+  GLfloat bias[8]     = { 0.1, 0.1, 0.1, 0.1, 0.1, 0.1, 0.1, 0.1  };
+  int i;
+  float avglen = (xzlength(v1, v2) +
+                  xzlength(v2, v3) +
+		  xzlength(v3, v1) / 3);
+
+  for (i = 0; i < 3; i++) {
+    Verts[0][i] = v1[i];
+    Verts[1][i] = v2[i];
+    Verts[2][i] = v3[i];
+    Pegged[i] = pegged[i];
+  }
+
+  Slopes[0] = xzslope(Verts[0], Verts[1]);
+  Slopes[1] = xzslope(Verts[1], Verts[2]);
+  Slopes[2] = xzslope(Verts[2], Verts[0]);
+
+  lengths[0] = avglen;
+  for (i = 1; i < Level; i++) {
+    lengths[i] = lengths[i-1]/2;
+  }
+
+  for (i = 0; i < Level; i++) {
+    DispFactor[i] = (lengths[i] * ((i <= 7) ? fraction[i] : fraction[7]));
+    DispBias[i]   = ((i <= 7) ? bias[i] : bias[7]);
+  }
+
+  NumOut = 0;
+  FMR(v1, v2, v3, 0);
+}
+
+/***************************************************************/
+/************************** BENCHES ****************************/
+/***************************************************************/
+
+  /* furthest apart the old and new triangles' corners are */
+float MaxDiff(Terrain *t, int level)
+{
+  float *xyz, *normal, d, max = 0;
+  unsigned *tri;
+  int n, i, k;
+
+  TerrainVertices(t, level, &xyz, &normal);
+  if (TerrainTriangles(t, level, &tri) != NumOut)
+    return FLT_MAX;
+  for (n = 0; n < NumOut; n++)
+    for (i = 0; i < 3; i++)
+      for (k = 0; k < 3; k++) {
+        d = fabs(xyz[3*tri[3*n + i] + k] - Out[9*n + 3*i + k]);
+        if (d > max)
+          max = d;
+      }
+  return max;
+}
+
+Terrain *NewMountain(int threads)
+{
+  Terrain *t = TerrainNew(V1, V2, V3, Peg, RandTable, NUMRANDS);
+
+  if (!t) {
+    fprintf(stderr, "terrainbench: out of memory\n");
+    exit(1);
+  }
+  if (threads > 0)
+    TerrainThreads(t, threads);
+  return t;
+}
+
+void Bench(int level, int threads)
+{
+  Terrain *t;
+  float diff = 0, *xyz, *normal;
+  long n, usec, ustep;
+  double tnew, told = 0, tstep, tnorm;
+  timer t0, t1, s0, s1;
+
+  if (level <= MAXLEVEL) {
+    Level = level;
+    FractalMountain(V1, V2, V3, Peg);
+    t = NewMountain(threads);
+    TerrainBuild(t, level);
+    diff = MaxDiff(t, level);
+    TerrainDelete(t);
+
+    n = 0;
+    getTime(t0);
+    do {
+      FractalMountain(V1, V2, V3, Peg);
+      n++;
+      getTime(t1);
+      usec = timeDiff(t0, t1);
+    } while (usec < 250000);
+    told = (double)usec / n;
+  }
+
+  n = 0;
+  getTime(t0);
+  do {
+    t = NewMountain(threads);
+    if (TerrainBuild(t, level)) {
+      printf("%5d out of memory\n", level);
+      TerrainDelete(t);
+      return;
+    }
+    TerrainDelete(t);
+    n++;
+    getTime(t1);
+    usec = timeDiff(t0, t1);
+  } while (usec < 250000);
+  tnew = (double)usec / n;
+
+    /* just the last level, from the one above */
+  n = 0;
+  ustep = 0;
+  getTime(t0);
+  do {
+    t = NewMountain(threads);
+    TerrainBuild(t, level - 1);
+    getTime(s0);
+    TerrainBuild(t, level);
+    getTime(s1);
+    ustep += timeDiff(s0, s1);
+    n++;
+    getTime(t1);
+    usec = timeDiff(t0, t1);
+    if (usec < 250000)
+      TerrainDelete(t);
+  } while (usec < 250000);
+  tstep = (double)ustep / n;
+
+    /* level 0 in between so the normals are made every time */
+  n = 0;
+  getTime(t0);
+  do {
+    TerrainVertices(t, level, &xyz, &normal);
+    TerrainVertices(t, 0, &xyz, &normal);
+    n++;
+    getTime(t1);
+    usec = timeDiff(t0, t1);
+  } while (usec < 250000);
+  tnorm = (double)usec / n;
+  TerrainDelete(t);
+
+  if (level <= MAXLEVEL)
+    printf("%5d %9d %10.3f %10.3f %10.3f %10.3f %8.1f %9.2g\n",
+           level, 1 << (2*level), told / 1000, tnew / 1000,
+           tstep / 1000, tnorm / 1000, told / tnew, diff);
+  else
+    printf("%5d %9d %10s %10.3f %10.3f %10.3f\n", level, 1 << (2*level),
+           "", tnew / 1000, tstep / 1000, tnorm / 1000);
+}
+
+int main(int argc, char **argv)
+{
+  int i, levels = argc > 1 ? atoi(argv[1]) : 11,
+      threads = argc > 2 ? atoi(argv[2]) : 0;
+
+  srand48(1);
+  for (i = 0; i < NUMRANDS; i++)
+    RandTable[i] = drand48() - 0.5;
+  Out = (float *) malloc((size_t) 9 * sizeof(float) << (2*MAXLEVEL));
+
+  printf("%5s %9s %10s %10s %10s %10s %8s %9s\n", "level", "triangles",
+         "old ms", "new ms", "step ms", "normal ms", "speedup", "max diff");
+  for (i = 0; i <= levels; i++)
+    Bench(i, threads);
+  return 0;
+}
@@ -43,23 +43,96 @@
 #include <math.h>
 #include <GL/glut.h>
 #include "atlantis.h"
+#include "frustcull.h"
 
-fishRec sharks[NUM_SHARKS];
-fishRec momWhale;
-fishRec babyWhale;
+int numSharks = NUM_SHARKS;
+fishRec *sharks;
+int numWhales = NUM_WHALES;
+fishRec *whales;
 fishRec dolph;
 
 GLboolean moving;
 
+/* everything that swims, for frustum culling */
+#define SHARK_RADIUS 7000.0
+#define WHALE_RADIUS 11000.0
+
+int numFish;
+FCtree *fishTree;
+float *fishBoxes;
+int *fishVisible;
+
+fishRec *
+Fish(int i)
+{
+    if (i < numSharks)
+        return &sharks[i];
+    if (i == numSharks)
+        return &dolph;
+    return &whales[i - numSharks - 1];
+}
+
+/* Returns the number of fish that may be in view, listed in fishVisible. */
+int
+CullFishs(void)
+{
+    float projection[16], modelview[16], planes[6][4];
+    float *box, r;
+    fishRec *fish;
+    int i;
+
+    for (i = 0; i < numFish; i++) {
+        fish = Fish(i);
+        r = i < numSharks ? SHARK_RADIUS : WHALE_RADIUS;
+        box = &fishBoxes[i * 6];
+        /* same placement as FishTransform */
+        box[FC_MINX] = fish->y - r;
+        box[FC_MINY] = fish->z - r;
+        box[FC_MINZ] = -fish->x - r;
+        box[FC_MAXX] = fish->y + r;
+        box[FC_MAXY] = fish->z + r;
+        box[FC_MAXZ] = -fish->x + r;
+    }
+
+    if (!fishTree) {
+        fishTree = fcNew();
+        if (!fishTree || !fcBuild(fishTree, numFish, fishBoxes)) {
+            fprintf(stderr, "atlantis: out of memory\n");
+            exit(1);
+        }
+    } else {
+        fcRefit(fishTree, fishBoxes);
+    }
+
+    glGetFloatv(GL_PROJECTION_MATRIX, projection);
+    glGetFloatv(GL_MODELVIEW_MATRIX, modelview);
+    fcExtractPlanes(planes, projection, modelview);
+    return fcCull(fishTree, planes, fishVisible);
+}
+
 void
 InitFishs(void)
 {
-    int i;
+    int i, j, pairs, spread;
 
-    for (i = 0; i < NUM_SHARKS; i++) {
-        sharks[i].x = 70000.0 + rand() % 6000;
-        sharks[i].y = rand() % 6000;
-        sharks[i].z = rand() % 6000;
+    numFish = numSharks + 1 + numWhales;
+    sharks = (fishRec *) calloc(numSharks + 1, sizeof(fishRec));
+    whales = (fishRec *) calloc(numWhales + 1, sizeof(fishRec));
+    fishBoxes = (float *) malloc(numFish * 6 * sizeof(float));
+    fishVisible = (int *) malloc(numFish * sizeof(int));
+    if (!sharks || !whales || !fishBoxes || !fishVisible) {
+        fprintf(stderr, "atlantis: out of memory\n");
+        exit(1);
+    }
+
+    /* a bigger school spreads out so that it keeps the same density */
+    spread = 6000.0 * pow(numSharks / (double) NUM_SHARKS, 1.0 / 3.0);
+    if (spread < 6000)
+        spread = 6000;
+    for (i = 0; i < numSharks; i++) {
+        sharks[i].x = 70000.0 + rand() % spread;
+        sharks[i].y = rand() % spread;
+        sharks[i].z = rand() % spread;
         sharks[i].psi = rand() % 360 - 180.0;
         sharks[i].v = 1.0;
     }
@@ -71,19 +144,28 @@ InitFishs(void)
     dolph.theta = 0.0;
     dolph.v = 3.0;
 
-    momWhale.x = 70000.0;
-    momWhale.y = 0.0;
-    momWhale.z = 0.0;
-    momWhale.psi = 90.0;
-    momWhale.theta = 0.0;
-    momWhale.v = 3.0;
-
-    babyWhale.x = 60000.0;
-    babyWhale.y = -2000.0;
-    babyWhale.z = -2000.0;
-    babyWhale.psi = 90.0;
-    babyWhale.theta = 0.0;
-    babyWhale.v = 3.0;
+    /* mothers and calves; more pairs are spaced out around the circle
+       the whales swim, ahead of the first pair */
+    pairs = (numWhales + 1) / 2;
+    for (i = 0; i < numWhales; i++) {
+        if (i % 2 == 0) {
+            whales[i].x = 70000.0;
+            whales[i].y = 0.0;
+            whales[i].z = 0.0;
+        } else {
+            whales[i].x = 60000.0;
+            whales[i].y = -2000.0;
+            whales[i].z = -2000.0;
+        }
+        whales[i].psi = 90.0;
+        whales[i].theta = 0.0;
+        whales[i].v = 3.0;
+        if (i >= 2) {
+            whales[i].z += (i / 2 % 5 - 2) * 6000.0;
+            for (j = 0; j < i / 2 * 720 / pairs; j++)
+                WhalePilot(&whales[i]);
+        }
+    }
 }
 
 void
@@ -147,17 +229,14 @@ Animate(void)
 {
     int i;
 
-    for (i = 0; i < NUM_SHARKS; i++) {
-        SharkPilot(&sharks[i]);
-        SharkMiss(i);
-    }
+    SharkSchool();
     WhalePilot(&dolph);
     dolph.phi++;
     glutPostRedisplay();
-    WhalePilot(&momWhale);
-    momWhale.phi++;
-    WhalePilot(&babyWhale);
-    babyWhale.phi++;
+    for (i = 0; i < numWhales; i++) {
+        WhalePilot(&whales[i]);
+        whales[i].phi++;
+    }
 }
 
 /* ARGSUSED1 */
@@ -178,33 +257,29 @@ Key(unsigned char key, int x, int y)
 void
 Display(void)
 {
-    int i;
+    int i, n, visible;
+    fishRec *fish;
 
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-    for (i = 0; i < NUM_SHARKS; i++) {
+    visible = CullFishs();
+    for (i = 0; i < visible; i++) {
+        n = fishVisible[i];
+        fish = Fish(n);
         glPushMatrix();
-        FishTransform(&sharks[i]);
-        DrawShark(&sharks[i]);
+        FishTransform(fish);
+        if (n < numSharks) {
+            DrawShark(fish);
+        } else if (fish == &dolph) {
+            DrawDolphin(fish);
+        } else {
+            if ((fish - whales) % 2)
+                glScalef(0.45, 0.45, 0.3);
+            DrawWhale(fish);
+        }
         glPopMatrix();
     }
 
-    glPushMatrix();
-    FishTransform(&dolph);
-    DrawDolphin(&dolph);
-    glPopMatrix();
-
-    glPushMatrix();
-    FishTransform(&momWhale);
-    DrawWhale(&momWhale);
-    glPopMatrix();
-
-    glPushMatrix();
-    FishTransform(&babyWhale);
-    glScalef(0.45, 0.45, 0.3);
-    DrawWhale(&babyWhale);
-    glPopMatrix();
-
     glutSwapBuffers();
 }
 
@@ -241,8 +316,24 @@ menuSelect(int value)
 int
 main(int argc, char **argv)
 {
+    int i;
+
     glutInitWindowSize(500, 250);
     glutInit(&argc, argv);
+    for (i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-sharks") && i + 1 < argc) {
+            numSharks = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "-whales") && i + 1 < argc) {
+            numWhales = atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "usage: atlantis [-sharks n] [-whales n]\n");
+            exit(1);
+        }
+    }
+    if (numSharks < 0)
+        numSharks = 0;
+    if (numWhales < 0)
+        numWhales = 0;
     glutInitDisplayMode(GLUT_RGB | GLUT_DOUBLE | GLUT_DEPTH);
     glutCreateWindow("GLUT Atlantis Demo");
     Init();
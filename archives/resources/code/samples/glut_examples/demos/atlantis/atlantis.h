@@ -37,7 +37,8 @@
 #define RAD 57.295
 #define RRAD 0.01745
 
-#define NUM_SHARKS 4
+#define NUM_SHARKS 4         /* default, see -sharks */
+#define NUM_WHALES 2         /* default, see -whales */
 #define SHARKSIZE 6000
 #define SHARKSPEED 100.0
 
@@ -51,15 +52,15 @@ typedef struct _fishRec {
     int spurt, attack;
 } fishRec;
 
-extern fishRec sharks[NUM_SHARKS];
-extern fishRec momWhale;
-extern fishRec babyWhale;
+extern int numSharks;
+extern fishRec *sharks;
+extern int numWhales;        /* whales[0] is the mother, odd ones calves */
+extern fishRec *whales;
 extern fishRec dolph;
 
 extern void FishTransform(fishRec *);
 extern void WhalePilot(fishRec *);
-extern void SharkPilot(fishRec *);
-extern void SharkMiss(int);
+extern void SharkSchool(void);
 extern void DrawWhale(fishRec *);
 extern void DrawShark(fishRec *);
 extern void DrawDolphin(fishRec *);
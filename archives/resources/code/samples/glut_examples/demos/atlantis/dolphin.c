@@ -34,9 +34,13 @@
  *
  * OpenGL(TM) is a trademark of Silicon Graphics, Inc.
  */
-#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <GL/glut.h>
+#include <math.h>
 #include "atlantis.h"
+#include "skin.h"
 /* *INDENT-OFF* */
 static float N001[3] = {-0.005937 ,-0.101998 ,-0.994767};
 static float N002[3] = {0.936780 ,-0.200803 ,0.286569};
@@ -336,1440 +340,1440 @@ static float P134[3] = {442.08, -143.84, 9475.96};
 void
 Dolphin001(void)
 {
-    glNormal3fv(N071);
-    glBegin(GL_POLYGON);
-    glVertex3fv(P001);
-    glVertex3fv(P068);
-    glVertex3fv(P010);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P068);
-    glVertex3fv(P076);
-    glVertex3fv(P010);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P068);
-    glVertex3fv(P070);
-    glVertex3fv(P076);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P076);
-    glVertex3fv(P070);
-    glVertex3fv(P074);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P070);
-    glVertex3fv(P072);
-    glVertex3fv(P074);
-    glEnd();
-    glNormal3fv(N119);
-    glBegin(GL_POLYGON);
-    glVertex3fv(P072);
-    glVertex3fv(P070);
-    glVertex3fv(P074);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P074);
-    glVertex3fv(P070);
-    glVertex3fv(P076);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P070);
-    glVertex3fv(P068);
-    glVertex3fv(P076);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P076);
-    glVertex3fv(P068);
-    glVertex3fv(P010);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P068);
-    glVertex3fv(P001);
-    glVertex3fv(P010);
-    glEnd();
+    skinNormal(N071);
+    skinPolygon();
+    skinVertex(P001);
+    skinVertex(P068);
+    skinVertex(P010);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P068);
+    skinVertex(P076);
+    skinVertex(P010);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P068);
+    skinVertex(P070);
+    skinVertex(P076);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P076);
+    skinVertex(P070);
+    skinVertex(P074);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P070);
+    skinVertex(P072);
+    skinVertex(P074);
+    skinEnd();
+    skinNormal(N119);
+    skinPolygon();
+    skinVertex(P072);
+    skinVertex(P070);
+    skinVertex(P074);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P074);
+    skinVertex(P070);
+    skinVertex(P076);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P070);
+    skinVertex(P068);
+    skinVertex(P076);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P076);
+    skinVertex(P068);
+    skinVertex(P010);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P068);
+    skinVertex(P001);
+    skinVertex(P010);
+    skinEnd();
 }
 
 void
 Dolphin002(void)
 {
-    glNormal3fv(N071);
-    glBegin(GL_POLYGON);
-    glVertex3fv(P011);
-    glVertex3fv(P001);
-    glVertex3fv(P009);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P075);
-    glVertex3fv(P011);
-    glVertex3fv(P009);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P069);
-    glVertex3fv(P011);
-    glVertex3fv(P075);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P069);
-    glVertex3fv(P075);
-    glVertex3fv(P073);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P071);
-    glVertex3fv(P069);
-    glVertex3fv(P073);
-    glEnd();
-    glNormal3fv(N119);
-    glBegin(GL_POLYGON);
-    glVertex3fv(P001);
-    glVertex3fv(P011);
-    glVertex3fv(P009);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P009);
-    glVertex3fv(P011);
-    glVertex3fv(P075);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P011);
-    glVertex3fv(P069);
-    glVertex3fv(P075);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P069);
-    glVertex3fv(P073);
-    glVertex3fv(P075);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P069);
-    glVertex3fv(P071);
-    glVertex3fv(P073);
-    glEnd();
+    skinNormal(N071);
+    skinPolygon();
+    skinVertex(P011);
+    skinVertex(P001);
+    skinVertex(P009);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P075);
+    skinVertex(P011);
+    skinVertex(P009);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P069);
+    skinVertex(P011);
+    skinVertex(P075);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P069);
+    skinVertex(P075);
+    skinVertex(P073);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P071);
+    skinVertex(P069);
+    skinVertex(P073);
+    skinEnd();
+    skinNormal(N119);
+    skinPolygon();
+    skinVertex(P001);
+    skinVertex(P011);
+    skinVertex(P009);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P009);
+    skinVertex(P011);
+    skinVertex(P075);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P011);
+    skinVertex(P069);
+    skinVertex(P075);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P069);
+    skinVertex(P073);
+    skinVertex(P075);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P069);
+    skinVertex(P071);
+    skinVertex(P073);
+    skinEnd();
 }
 
 void
 Dolphin003(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N018);
-    glVertex3fv(P018);
-    glNormal3fv(N001);
-    glVertex3fv(P001);
-    glNormal3fv(N019);
-    glVertex3fv(P019);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N019);
-    glVertex3fv(P019);
-    glNormal3fv(N001);
-    glVertex3fv(P001);
-    glNormal3fv(N012);
-    glVertex3fv(P012);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N017);
-    glVertex3fv(P017);
-    glNormal3fv(N001);
-    glVertex3fv(P001);
-    glNormal3fv(N018);
-    glVertex3fv(P018);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N001);
-    glVertex3fv(P001);
-    glNormal3fv(N017);
-    glVertex3fv(P017);
-    glNormal3fv(N016);
-    glVertex3fv(P016);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N001);
-    glVertex3fv(P001);
-    glNormal3fv(N013);
-    glVertex3fv(P013);
-    glNormal3fv(N012);
-    glVertex3fv(P012);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N001);
-    glVertex3fv(P001);
-    glNormal3fv(N016);
-    glVertex3fv(P016);
-    glNormal3fv(N015);
-    glVertex3fv(P015);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N001);
-    glVertex3fv(P001);
-    glNormal3fv(N014);
-    glVertex3fv(P014);
-    glNormal3fv(N013);
-    glVertex3fv(P013);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N001);
-    glVertex3fv(P001);
-    glNormal3fv(N015);
-    glVertex3fv(P015);
-    glNormal3fv(N014);
-    glVertex3fv(P014);
-    glEnd();
+    skinPolygon();
+    skinNormal(N018);
+    skinVertex(P018);
+    skinNormal(N001);
+    skinVertex(P001);
+    skinNormal(N019);
+    skinVertex(P019);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N019);
+    skinVertex(P019);
+    skinNormal(N001);
+    skinVertex(P001);
+    skinNormal(N012);
+    skinVertex(P012);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N017);
+    skinVertex(P017);
+    skinNormal(N001);
+    skinVertex(P001);
+    skinNormal(N018);
+    skinVertex(P018);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N001);
+    skinVertex(P001);
+    skinNormal(N017);
+    skinVertex(P017);
+    skinNormal(N016);
+    skinVertex(P016);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N001);
+    skinVertex(P001);
+    skinNormal(N013);
+    skinVertex(P013);
+    skinNormal(N012);
+    skinVertex(P012);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N001);
+    skinVertex(P001);
+    skinNormal(N016);
+    skinVertex(P016);
+    skinNormal(N015);
+    skinVertex(P015);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N001);
+    skinVertex(P001);
+    skinNormal(N014);
+    skinVertex(P014);
+    skinNormal(N013);
+    skinVertex(P013);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N001);
+    skinVertex(P001);
+    skinNormal(N015);
+    skinVertex(P015);
+    skinNormal(N014);
+    skinVertex(P014);
+    skinEnd();
 }
 
 void
 Dolphin004(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N014);
-    glVertex3fv(P014);
-    glNormal3fv(N015);
-    glVertex3fv(P015);
-    glNormal3fv(N023);
-    glVertex3fv(P023);
-    glNormal3fv(N022);
-    glVertex3fv(P022);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N015);
-    glVertex3fv(P015);
-    glNormal3fv(N016);
-    glVertex3fv(P016);
-    glNormal3fv(N024);
-    glVertex3fv(P024);
-    glNormal3fv(N023);
-    glVertex3fv(P023);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N016);
-    glVertex3fv(P016);
-    glNormal3fv(N017);
-    glVertex3fv(P017);
-    glNormal3fv(N025);
-    glVertex3fv(P025);
-    glNormal3fv(N024);
-    glVertex3fv(P024);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N017);
-    glVertex3fv(P017);
-    glNormal3fv(N018);
-    glVertex3fv(P018);
-    glNormal3fv(N026);
-    glVertex3fv(P026);
-    glNormal3fv(N025);
-    glVertex3fv(P025);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N013);
-    glVertex3fv(P013);
-    glNormal3fv(N014);
-    glVertex3fv(P014);
-    glNormal3fv(N022);
-    glVertex3fv(P022);
-    glNormal3fv(N021);
-    glVertex3fv(P021);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N012);
-    glVertex3fv(P012);
-    glNormal3fv(N013);
-    glVertex3fv(P013);
-    glNormal3fv(N021);
-    glVertex3fv(P021);
-    glNormal3fv(N020);
-    glVertex3fv(P020);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N018);
-    glVertex3fv(P018);
-    glNormal3fv(N019);
-    glVertex3fv(P019);
-    glNormal3fv(N027);
-    glVertex3fv(P027);
-    glNormal3fv(N026);
-    glVertex3fv(P026);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N019);
-    glVertex3fv(P019);
-    glNormal3fv(N012);
-    glVertex3fv(P012);
-    glNormal3fv(N020);
-    glVertex3fv(P020);
-    glNormal3fv(N027);
-    glVertex3fv(P027);
-    glEnd();
+    skinPolygon();
+    skinNormal(N014);
+    skinVertex(P014);
+    skinNormal(N015);
+    skinVertex(P015);
+    skinNormal(N023);
+    skinVertex(P023);
+    skinNormal(N022);
+    skinVertex(P022);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N015);
+    skinVertex(P015);
+    skinNormal(N016);
+    skinVertex(P016);
+    skinNormal(N024);
+    skinVertex(P024);
+    skinNormal(N023);
+    skinVertex(P023);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N016);
+    skinVertex(P016);
+    skinNormal(N017);
+    skinVertex(P017);
+    skinNormal(N025);
+    skinVertex(P025);
+    skinNormal(N024);
+    skinVertex(P024);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N017);
+    skinVertex(P017);
+    skinNormal(N018);
+    skinVertex(P018);
+    skinNormal(N026);
+    skinVertex(P026);
+    skinNormal(N025);
+    skinVertex(P025);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N013);
+    skinVertex(P013);
+    skinNormal(N014);
+    skinVertex(P014);
+    skinNormal(N022);
+    skinVertex(P022);
+    skinNormal(N021);
+    skinVertex(P021);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N012);
+    skinVertex(P012);
+    skinNormal(N013);
+    skinVertex(P013);
+    skinNormal(N021);
+    skinVertex(P021);
+    skinNormal(N020);
+    skinVertex(P020);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N018);
+    skinVertex(P018);
+    skinNormal(N019);
+    skinVertex(P019);
+    skinNormal(N027);
+    skinVertex(P027);
+    skinNormal(N026);
+    skinVertex(P026);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N019);
+    skinVertex(P019);
+    skinNormal(N012);
+    skinVertex(P012);
+    skinNormal(N020);
+    skinVertex(P020);
+    skinNormal(N027);
+    skinVertex(P027);
+    skinEnd();
 }
 
 void
 Dolphin005(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N022);
-    glVertex3fv(P022);
-    glNormal3fv(N023);
-    glVertex3fv(P023);
-    glNormal3fv(N031);
-    glVertex3fv(P031);
-    glNormal3fv(N030);
-    glVertex3fv(P030);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N021);
-    glVertex3fv(P021);
-    glNormal3fv(N022);
-    glVertex3fv(P022);
-    glNormal3fv(N030);
-    glVertex3fv(P030);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N021);
-    glVertex3fv(P021);
-    glNormal3fv(N030);
-    glVertex3fv(P030);
-    glNormal3fv(N029);
-    glVertex3fv(P029);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N023);
-    glVertex3fv(P023);
-    glNormal3fv(N024);
-    glVertex3fv(P024);
-    glNormal3fv(N031);
-    glVertex3fv(P031);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N024);
-    glVertex3fv(P024);
-    glNormal3fv(N032);
-    glVertex3fv(P032);
-    glNormal3fv(N031);
-    glVertex3fv(P031);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N024);
-    glVertex3fv(P024);
-    glNormal3fv(N025);
-    glVertex3fv(P025);
-    glNormal3fv(N032);
-    glVertex3fv(P032);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N025);
-    glVertex3fv(P025);
-    glNormal3fv(N033);
-    glVertex3fv(P033);
-    glNormal3fv(N032);
-    glVertex3fv(P032);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N020);
-    glVertex3fv(P020);
-    glNormal3fv(N021);
-    glVertex3fv(P021);
-    glNormal3fv(N029);
-    glVertex3fv(P029);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N020);
-    glVertex3fv(P020);
-    glNormal3fv(N029);
-    glVertex3fv(P029);
-    glNormal3fv(N028);
-    glVertex3fv(P028);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N027);
-    glVertex3fv(P027);
-    glNormal3fv(N020);
-    glVertex3fv(P020);
-    glNormal3fv(N028);
-    glVertex3fv(P028);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N027);
-    glVertex3fv(P027);
-    glNormal3fv(N028);
-    glVertex3fv(P028);
-    glNormal3fv(N035);
-    glVertex3fv(P035);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N025);
-    glVertex3fv(P025);
-    glNormal3fv(N026);
-    glVertex3fv(P026);
-    glNormal3fv(N033);
-    glVertex3fv(P033);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N033);
-    glVertex3fv(P033);
-    glNormal3fv(N026);
-    glVertex3fv(P026);
-    glNormal3fv(N034);
-    glVertex3fv(P034);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N026);
-    glVertex3fv(P026);
-    glNormal3fv(N027);
-    glVertex3fv(P027);
-    glNormal3fv(N035);
-    glVertex3fv(P035);
-    glNormal3fv(N034);
-    glVertex3fv(P034);
-    glEnd();
+    skinPolygon();
+    skinNormal(N022);
+    skinVertex(P022);
+    skinNormal(N023);
+    skinVertex(P023);
+    skinNormal(N031);
+    skinVertex(P031);
+    skinNormal(N030);
+    skinVertex(P030);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N021);
+    skinVertex(P021);
+    skinNormal(N022);
+    skinVertex(P022);
+    skinNormal(N030);
+    skinVertex(P030);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N021);
+    skinVertex(P021);
+    skinNormal(N030);
+    skinVertex(P030);
+    skinNormal(N029);
+    skinVertex(P029);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N023);
+    skinVertex(P023);
+    skinNormal(N024);
+    skinVertex(P024);
+    skinNormal(N031);
+    skinVertex(P031);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N024);
+    skinVertex(P024);
+    skinNormal(N032);
+    skinVertex(P032);
+    skinNormal(N031);
+    skinVertex(P031);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N024);
+    skinVertex(P024);
+    skinNormal(N025);
+    skinVertex(P025);
+    skinNormal(N032);
+    skinVertex(P032);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N025);
+    skinVertex(P025);
+    skinNormal(N033);
+    skinVertex(P033);
+    skinNormal(N032);
+    skinVertex(P032);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N020);
+    skinVertex(P020);
+    skinNormal(N021);
+    skinVertex(P021);
+    skinNormal(N029);
+    skinVertex(P029);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N020);
+    skinVertex(P020);
+    skinNormal(N029);
+    skinVertex(P029);
+    skinNormal(N028);
+    skinVertex(P028);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N027);
+    skinVertex(P027);
+    skinNormal(N020);
+    skinVertex(P020);
+    skinNormal(N028);
+    skinVertex(P028);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N027);
+    skinVertex(P027);
+    skinNormal(N028);
+    skinVertex(P028);
+    skinNormal(N035);
+    skinVertex(P035);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N025);
+    skinVertex(P025);
+    skinNormal(N026);
+    skinVertex(P026);
+    skinNormal(N033);
+    skinVertex(P033);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N033);
+    skinVertex(P033);
+    skinNormal(N026);
+    skinVertex(P026);
+    skinNormal(N034);
+    skinVertex(P034);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N026);
+    skinVertex(P026);
+    skinNormal(N027);
+    skinVertex(P027);
+    skinNormal(N035);
+    skinVertex(P035);
+    skinNormal(N034);
+    skinVertex(P034);
+    skinEnd();
 }
 
 void
 Dolphin006(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N092);
-    glVertex3fv(P092);
-    glNormal3fv(N093);
-    glVertex3fv(P093);
-    glNormal3fv(N094);
-    glVertex3fv(P094);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N093);
-    glVertex3fv(P093);
-    glNormal3fv(N092);
-    glVertex3fv(P092);
-    glNormal3fv(N094);
-    glVertex3fv(P094);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N092);
-    glVertex3fv(P092);
-    glNormal3fv(N091);
-    glVertex3fv(P091);
-    glNormal3fv(N095);
-    glVertex3fv(P095);
-    glNormal3fv(N094);
-    glVertex3fv(P094);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N091);
-    glVertex3fv(P091);
-    glNormal3fv(N092);
-    glVertex3fv(P092);
-    glNormal3fv(N094);
-    glVertex3fv(P094);
-    glNormal3fv(N095);
-    glVertex3fv(P095);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N122);
-    glVertex3fv(P122);
-    glNormal3fv(N095);
-    glVertex3fv(P095);
-    glNormal3fv(N091);
-    glVertex3fv(P091);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N122);
-    glVertex3fv(P122);
-    glNormal3fv(N091);
-    glVertex3fv(P091);
-    glNormal3fv(N095);
-    glVertex3fv(P095);
-    glEnd();
+    skinPolygon();
+    skinNormal(N092);
+    skinVertex(P092);
+    skinNormal(N093);
+    skinVertex(P093);
+    skinNormal(N094);
+    skinVertex(P094);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N093);
+    skinVertex(P093);
+    skinNormal(N092);
+    skinVertex(P092);
+    skinNormal(N094);
+    skinVertex(P094);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N092);
+    skinVertex(P092);
+    skinNormal(N091);
+    skinVertex(P091);
+    skinNormal(N095);
+    skinVertex(P095);
+    skinNormal(N094);
+    skinVertex(P094);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N091);
+    skinVertex(P091);
+    skinNormal(N092);
+    skinVertex(P092);
+    skinNormal(N094);
+    skinVertex(P094);
+    skinNormal(N095);
+    skinVertex(P095);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N122);
+    skinVertex(P122);
+    skinNormal(N095);
+    skinVertex(P095);
+    skinNormal(N091);
+    skinVertex(P091);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N122);
+    skinVertex(P122);
+    skinNormal(N091);
+    skinVertex(P091);
+    skinNormal(N095);
+    skinVertex(P095);
+    skinEnd();
 }
 
 void
 Dolphin007(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N030);
-    glVertex3fv(P030);
-    glNormal3fv(N031);
-    glVertex3fv(P031);
-    glNormal3fv(N039);
-    glVertex3fv(P039);
-    glNormal3fv(N038);
-    glVertex3fv(P038);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N029);
-    glVertex3fv(P029);
-    glNormal3fv(N030);
-    glVertex3fv(P030);
-    glNormal3fv(N038);
-    glVertex3fv(P038);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N029);
-    glVertex3fv(P029);
-    glNormal3fv(N038);
-    glVertex3fv(P038);
-    glNormal3fv(N037);
-    glVertex3fv(P037);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N028);
-    glVertex3fv(P028);
-    glNormal3fv(N029);
-    glVertex3fv(P029);
-    glNormal3fv(N037);
-    glVertex3fv(P037);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N028);
-    glVertex3fv(P028);
-    glNormal3fv(N037);
-    glVertex3fv(P037);
-    glNormal3fv(N036);
-    glVertex3fv(P036);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N035);
-    glVertex3fv(P035);
-    glNormal3fv(N028);
-    glVertex3fv(P028);
-    glNormal3fv(N036);
-    glVertex3fv(P036);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N035);
-    glVertex3fv(P035);
-    glNormal3fv(N036);
-    glVertex3fv(P036);
-    glNormal3fv(N043);
-    glVertex3fv(P043);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N034);
-    glVertex3fv(P034);
-    glNormal3fv(N035);
-    glVertex3fv(P035);
-    glNormal3fv(N043);
-    glVertex3fv(P043);
-    glNormal3fv(N042);
-    glVertex3fv(P042);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N033);
-    glVertex3fv(P033);
-    glNormal3fv(N034);
-    glVertex3fv(P034);
-    glNormal3fv(N042);
-    glVertex3fv(P042);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N033);
-    glVertex3fv(P033);
-    glNormal3fv(N042);
-    glVertex3fv(P042);
-    glNormal3fv(N041);
-    glVertex3fv(P041);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N031);
-    glVertex3fv(P031);
-    glNormal3fv(N032);
-    glVertex3fv(P032);
-    glNormal3fv(N039);
-    glVertex3fv(P039);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N039);
-    glVertex3fv(P039);
-    glNormal3fv(N032);
-    glVertex3fv(P032);
-    glNormal3fv(N040);
-    glVertex3fv(P040);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N032);
-    glVertex3fv(P032);
-    glNormal3fv(N033);
-    glVertex3fv(P033);
-    glNormal3fv(N040);
-    glVertex3fv(P040);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N040);
-    glVertex3fv(P040);
-    glNormal3fv(N033);
-    glVertex3fv(P033);
-    glNormal3fv(N041);
-    glVertex3fv(P041);
-    glEnd();
+    skinPolygon();
+    skinNormal(N030);
+    skinVertex(P030);
+    skinNormal(N031);
+    skinVertex(P031);
+    skinNormal(N039);
+    skinVertex(P039);
+    skinNormal(N038);
+    skinVertex(P038);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N029);
+    skinVertex(P029);
+    skinNormal(N030);
+    skinVertex(P030);
+    skinNormal(N038);
+    skinVertex(P038);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N029);
+    skinVertex(P029);
+    skinNormal(N038);
+    skinVertex(P038);
+    skinNormal(N037);
+    skinVertex(P037);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N028);
+    skinVertex(P028);
+    skinNormal(N029);
+    skinVertex(P029);
+    skinNormal(N037);
+    skinVertex(P037);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N028);
+    skinVertex(P028);
+    skinNormal(N037);
+    skinVertex(P037);
+    skinNormal(N036);
+    skinVertex(P036);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N035);
+    skinVertex(P035);
+    skinNormal(N028);
+    skinVertex(P028);
+    skinNormal(N036);
+    skinVertex(P036);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N035);
+    skinVertex(P035);
+    skinNormal(N036);
+    skinVertex(P036);
+    skinNormal(N043);
+    skinVertex(P043);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N034);
+    skinVertex(P034);
+    skinNormal(N035);
+    skinVertex(P035);
+    skinNormal(N043);
+    skinVertex(P043);
+    skinNormal(N042);
+    skinVertex(P042);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N033);
+    skinVertex(P033);
+    skinNormal(N034);
+    skinVertex(P034);
+    skinNormal(N042);
+    skinVertex(P042);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N033);
+    skinVertex(P033);
+    skinNormal(N042);
+    skinVertex(P042);
+    skinNormal(N041);
+    skinVertex(P041);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N031);
+    skinVertex(P031);
+    skinNormal(N032);
+    skinVertex(P032);
+    skinNormal(N039);
+    skinVertex(P039);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N039);
+    skinVertex(P039);
+    skinNormal(N032);
+    skinVertex(P032);
+    skinNormal(N040);
+    skinVertex(P040);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N032);
+    skinVertex(P032);
+    skinNormal(N033);
+    skinVertex(P033);
+    skinNormal(N040);
+    skinVertex(P040);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N040);
+    skinVertex(P040);
+    skinNormal(N033);
+    skinVertex(P033);
+    skinNormal(N041);
+    skinVertex(P041);
+    skinEnd();
 }
 
 void
 Dolphin008(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N042);
-    glVertex3fv(P042);
-    glNormal3fv(N043);
-    glVertex3fv(P043);
-    glNormal3fv(N051);
-    glVertex3fv(P051);
-    glNormal3fv(N050);
-    glVertex3fv(P050);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N043);
-    glVertex3fv(P043);
-    glNormal3fv(N036);
-    glVertex3fv(P036);
-    glNormal3fv(N051);
-    glVertex3fv(P051);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N051);
-    glVertex3fv(P051);
-    glNormal3fv(N036);
-    glVertex3fv(P036);
-    glNormal3fv(N044);
-    glVertex3fv(P044);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N041);
-    glVertex3fv(P041);
-    glNormal3fv(N042);
-    glVertex3fv(P042);
-    glNormal3fv(N050);
-    glVertex3fv(P050);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N041);
-    glVertex3fv(P041);
-    glNormal3fv(N050);
-    glVertex3fv(P050);
-    glNormal3fv(N049);
-    glVertex3fv(P049);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N036);
-    glVertex3fv(P036);
-    glNormal3fv(N037);
-    glVertex3fv(P037);
-    glNormal3fv(N044);
-    glVertex3fv(P044);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N044);
-    glVertex3fv(P044);
-    glNormal3fv(N037);
-    glVertex3fv(P037);
-    glNormal3fv(N045);
-    glVertex3fv(P045);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N040);
-    glVertex3fv(P040);
-    glNormal3fv(N041);
-    glVertex3fv(P041);
-    glNormal3fv(N049);
-    glVertex3fv(P049);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N040);
-    glVertex3fv(P040);
-    glNormal3fv(N049);
-    glVertex3fv(P049);
-    glNormal3fv(N048);
-    glVertex3fv(P048);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N039);
-    glVertex3fv(P039);
-    glNormal3fv(N040);
-    glVertex3fv(P040);
-    glNormal3fv(N048);
-    glVertex3fv(P048);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N039);
-    glVertex3fv(P039);
-    glNormal3fv(N048);
-    glVertex3fv(P048);
-    glNormal3fv(N047);
-    glVertex3fv(P047);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N037);
-    glVertex3fv(P037);
-    glNormal3fv(N038);
-    glVertex3fv(P038);
-    glNormal3fv(N045);
-    glVertex3fv(P045);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N038);
-    glVertex3fv(P038);
-    glNormal3fv(N046);
-    glVertex3fv(P046);
-    glNormal3fv(N045);
-    glVertex3fv(P045);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N038);
-    glVertex3fv(P038);
-    glNormal3fv(N039);
-    glVertex3fv(P039);
-    glNormal3fv(N047);
-    glVertex3fv(P047);
-    glNormal3fv(N046);
-    glVertex3fv(P046);
-    glEnd();
+    skinPolygon();
+    skinNormal(N042);
+    skinVertex(P042);
+    skinNormal(N043);
+    skinVertex(P043);
+    skinNormal(N051);
+    skinVertex(P051);
+    skinNormal(N050);
+    skinVertex(P050);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N043);
+    skinVertex(P043);
+    skinNormal(N036);
+    skinVertex(P036);
+    skinNormal(N051);
+    skinVertex(P051);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N051);
+    skinVertex(P051);
+    skinNormal(N036);
+    skinVertex(P036);
+    skinNormal(N044);
+    skinVertex(P044);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N041);
+    skinVertex(P041);
+    skinNormal(N042);
+    skinVertex(P042);
+    skinNormal(N050);
+    skinVertex(P050);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N041);
+    skinVertex(P041);
+    skinNormal(N050);
+    skinVertex(P050);
+    skinNormal(N049);
+    skinVertex(P049);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N036);
+    skinVertex(P036);
+    skinNormal(N037);
+    skinVertex(P037);
+    skinNormal(N044);
+    skinVertex(P044);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N044);
+    skinVertex(P044);
+    skinNormal(N037);
+    skinVertex(P037);
+    skinNormal(N045);
+    skinVertex(P045);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N040);
+    skinVertex(P040);
+    skinNormal(N041);
+    skinVertex(P041);
+    skinNormal(N049);
+    skinVertex(P049);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N040);
+    skinVertex(P040);
+    skinNormal(N049);
+    skinVertex(P049);
+    skinNormal(N048);
+    skinVertex(P048);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N039);
+    skinVertex(P039);
+    skinNormal(N040);
+    skinVertex(P040);
+    skinNormal(N048);
+    skinVertex(P048);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N039);
+    skinVertex(P039);
+    skinNormal(N048);
+    skinVertex(P048);
+    skinNormal(N047);
+    skinVertex(P047);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N037);
+    skinVertex(P037);
+    skinNormal(N038);
+    skinVertex(P038);
+    skinNormal(N045);
+    skinVertex(P045);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N038);
+    skinVertex(P038);
+    skinNormal(N046);
+    skinVertex(P046);
+    skinNormal(N045);
+    skinVertex(P045);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N038);
+    skinVertex(P038);
+    skinNormal(N039);
+    skinVertex(P039);
+    skinNormal(N047);
+    skinVertex(P047);
+    skinNormal(N046);
+    skinVertex(P046);
+    skinEnd();
 }
 
 void
 Dolphin009(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N050);
-    glVertex3fv(P050);
-    glNormal3fv(N051);
-    glVertex3fv(P051);
-    glNormal3fv(N059);
-    glVertex3fv(P059);
-    glNormal3fv(N058);
-    glVertex3fv(P058);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N051);
-    glVertex3fv(P051);
-    glNormal3fv(N044);
-    glVertex3fv(P044);
-    glNormal3fv(N059);
-    glVertex3fv(P059);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N059);
-    glVertex3fv(P059);
-    glNormal3fv(N044);
-    glVertex3fv(P044);
-    glNormal3fv(N052);
-    glVertex3fv(P052);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N044);
-    glVertex3fv(P044);
-    glNormal3fv(N045);
-    glVertex3fv(P045);
-    glNormal3fv(N053);
-    glVertex3fv(P053);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N044);
-    glVertex3fv(P044);
-    glNormal3fv(N053);
-    glVertex3fv(P053);
-    glNormal3fv(N052);
-    glVertex3fv(P052);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N049);
-    glVertex3fv(P049);
-    glNormal3fv(N050);
-    glVertex3fv(P050);
-    glNormal3fv(N058);
-    glVertex3fv(P058);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N049);
-    glVertex3fv(P049);
-    glNormal3fv(N058);
-    glVertex3fv(P058);
-    glNormal3fv(N057);
-    glVertex3fv(P057);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N048);
-    glVertex3fv(P048);
-    glNormal3fv(N049);
-    glVertex3fv(P049);
-    glNormal3fv(N057);
-    glVertex3fv(P057);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N048);
-    glVertex3fv(P048);
-    glNormal3fv(N057);
-    glVertex3fv(P057);
-    glNormal3fv(N056);
-    glVertex3fv(P056);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N047);
-    glVertex3fv(P047);
-    glNormal3fv(N048);
-    glVertex3fv(P048);
-    glNormal3fv(N056);
-    glVertex3fv(P056);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N047);
-    glVertex3fv(P047);
-    glNormal3fv(N056);
-    glVertex3fv(P056);
-    glNormal3fv(N055);
-    glVertex3fv(P055);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N045);
-    glVertex3fv(P045);
-    glNormal3fv(N046);
-    glVertex3fv(P046);
-    glNormal3fv(N053);
-    glVertex3fv(P053);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N046);
-    glVertex3fv(P046);
-    glNormal3fv(N054);
-    glVertex3fv(P054);
-    glNormal3fv(N053);
-    glVertex3fv(P053);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N046);
-    glVertex3fv(P046);
-    glNormal3fv(N047);
-    glVertex3fv(P047);
-    glNormal3fv(N055);
-    glVertex3fv(P055);
-    glNormal3fv(N054);
-    glVertex3fv(P054);
-    glEnd();
+    skinPolygon();
+    skinNormal(N050);
+    skinVertex(P050);
+    skinNormal(N051);
+    skinVertex(P051);
+    skinNormal(N059);
+    skinVertex(P059);
+    skinNormal(N058);
+    skinVertex(P058);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N051);
+    skinVertex(P051);
+    skinNormal(N044);
+    skinVertex(P044);
+    skinNormal(N059);
+    skinVertex(P059);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N059);
+    skinVertex(P059);
+    skinNormal(N044);
+    skinVertex(P044);
+    skinNormal(N052);
+    skinVertex(P052);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N044);
+    skinVertex(P044);
+    skinNormal(N045);
+    skinVertex(P045);
+    skinNormal(N053);
+    skinVertex(P053);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N044);
+    skinVertex(P044);
+    skinNormal(N053);
+    skinVertex(P053);
+    skinNormal(N052);
+    skinVertex(P052);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N049);
+    skinVertex(P049);
+    skinNormal(N050);
+    skinVertex(P050);
+    skinNormal(N058);
+    skinVertex(P058);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N049);
+    skinVertex(P049);
+    skinNormal(N058);
+    skinVertex(P058);
+    skinNormal(N057);
+    skinVertex(P057);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N048);
+    skinVertex(P048);
+    skinNormal(N049);
+    skinVertex(P049);
+    skinNormal(N057);
+    skinVertex(P057);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N048);
+    skinVertex(P048);
+    skinNormal(N057);
+    skinVertex(P057);
+    skinNormal(N056);
+    skinVertex(P056);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N047);
+    skinVertex(P047);
+    skinNormal(N048);
+    skinVertex(P048);
+    skinNormal(N056);
+    skinVertex(P056);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N047);
+    skinVertex(P047);
+    skinNormal(N056);
+    skinVertex(P056);
+    skinNormal(N055);
+    skinVertex(P055);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N045);
+    skinVertex(P045);
+    skinNormal(N046);
+    skinVertex(P046);
+    skinNormal(N053);
+    skinVertex(P053);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N046);
+    skinVertex(P046);
+    skinNormal(N054);
+    skinVertex(P054);
+    skinNormal(N053);
+    skinVertex(P053);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N046);
+    skinVertex(P046);
+    skinNormal(N047);
+    skinVertex(P047);
+    skinNormal(N055);
+    skinVertex(P055);
+    skinNormal(N054);
+    skinVertex(P054);
+    skinEnd();
 }
 
 void
 Dolphin010(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N080);
-    glVertex3fv(P080);
-    glNormal3fv(N081);
-    glVertex3fv(P081);
-    glNormal3fv(N085);
-    glVertex3fv(P085);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N081);
-    glVertex3fv(P081);
-    glNormal3fv(N083);
-    glVertex3fv(P083);
-    glNormal3fv(N085);
-    glVertex3fv(P085);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N085);
-    glVertex3fv(P085);
-    glNormal3fv(N083);
-    glVertex3fv(P083);
-    glNormal3fv(N077);
-    glVertex3fv(P077);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N083);
-    glVertex3fv(P083);
-    glNormal3fv(N087);
-    glVertex3fv(P087);
-    glNormal3fv(N077);
-    glVertex3fv(P077);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N077);
-    glVertex3fv(P077);
-    glNormal3fv(N087);
-    glVertex3fv(P087);
-    glNormal3fv(N090);
-    glVertex3fv(P090);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N081);
-    glVertex3fv(P081);
-    glNormal3fv(N080);
-    glVertex3fv(P080);
-    glNormal3fv(N085);
-    glVertex3fv(P085);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N083);
-    glVertex3fv(P083);
-    glNormal3fv(N081);
-    glVertex3fv(P081);
-    glNormal3fv(N085);
-    glVertex3fv(P085);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N083);
-    glVertex3fv(P083);
-    glNormal3fv(N085);
-    glVertex3fv(P085);
-    glNormal3fv(N077);
-    glVertex3fv(P077);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N087);
-    glVertex3fv(P087);
-    glNormal3fv(N083);
-    glVertex3fv(P083);
-    glNormal3fv(N077);
-    glVertex3fv(P077);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N087);
-    glVertex3fv(P087);
-    glNormal3fv(N077);
-    glVertex3fv(P077);
-    glNormal3fv(N090);
-    glVertex3fv(P090);
-    glEnd();
+    skinPolygon();
+    skinNormal(N080);
+    skinVertex(P080);
+    skinNormal(N081);
+    skinVertex(P081);
+    skinNormal(N085);
+    skinVertex(P085);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N081);
+    skinVertex(P081);
+    skinNormal(N083);
+    skinVertex(P083);
+    skinNormal(N085);
+    skinVertex(P085);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N085);
+    skinVertex(P085);
+    skinNormal(N083);
+    skinVertex(P083);
+    skinNormal(N077);
+    skinVertex(P077);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N083);
+    skinVertex(P083);
+    skinNormal(N087);
+    skinVertex(P087);
+    skinNormal(N077);
+    skinVertex(P077);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N077);
+    skinVertex(P077);
+    skinNormal(N087);
+    skinVertex(P087);
+    skinNormal(N090);
+    skinVertex(P090);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N081);
+    skinVertex(P081);
+    skinNormal(N080);
+    skinVertex(P080);
+    skinNormal(N085);
+    skinVertex(P085);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N083);
+    skinVertex(P083);
+    skinNormal(N081);
+    skinVertex(P081);
+    skinNormal(N085);
+    skinVertex(P085);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N083);
+    skinVertex(P083);
+    skinNormal(N085);
+    skinVertex(P085);
+    skinNormal(N077);
+    skinVertex(P077);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N087);
+    skinVertex(P087);
+    skinNormal(N083);
+    skinVertex(P083);
+    skinNormal(N077);
+    skinVertex(P077);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N087);
+    skinVertex(P087);
+    skinNormal(N077);
+    skinVertex(P077);
+    skinNormal(N090);
+    skinVertex(P090);
+    skinEnd();
 }
 
 void
 Dolphin011(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N082);
-    glVertex3fv(P082);
-    glNormal3fv(N084);
-    glVertex3fv(P084);
-    glNormal3fv(N079);
-    glVertex3fv(P079);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N084);
-    glVertex3fv(P084);
-    glNormal3fv(N086);
-    glVertex3fv(P086);
-    glNormal3fv(N079);
-    glVertex3fv(P079);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N079);
-    glVertex3fv(P079);
-    glNormal3fv(N086);
-    glVertex3fv(P086);
-    glNormal3fv(N078);
-    glVertex3fv(P078);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N086);
-    glVertex3fv(P086);
-    glNormal3fv(N088);
-    glVertex3fv(P088);
-    glNormal3fv(N078);
-    glVertex3fv(P078);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N078);
-    glVertex3fv(P078);
-    glNormal3fv(N088);
-    glVertex3fv(P088);
-    glNormal3fv(N089);
-    glVertex3fv(P089);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N088);
-    glVertex3fv(P088);
-    glNormal3fv(N086);
-    glVertex3fv(P086);
-    glNormal3fv(N089);
-    glVertex3fv(P089);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N089);
-    glVertex3fv(P089);
-    glNormal3fv(N086);
-    glVertex3fv(P086);
-    glNormal3fv(N078);
-    glVertex3fv(P078);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N086);
-    glVertex3fv(P086);
-    glNormal3fv(N084);
-    glVertex3fv(P084);
-    glNormal3fv(N078);
-    glVertex3fv(P078);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N078);
-    glVertex3fv(P078);
-    glNormal3fv(N084);
-    glVertex3fv(P084);
-    glNormal3fv(N079);
-    glVertex3fv(P079);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N084);
-    glVertex3fv(P084);
-    glNormal3fv(N082);
-    glVertex3fv(P082);
-    glNormal3fv(N079);
-    glVertex3fv(P079);
-    glEnd();
+    skinPolygon();
+    skinNormal(N082);
+    skinVertex(P082);
+    skinNormal(N084);
+    skinVertex(P084);
+    skinNormal(N079);
+    skinVertex(P079);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N084);
+    skinVertex(P084);
+    skinNormal(N086);
+    skinVertex(P086);
+    skinNormal(N079);
+    skinVertex(P079);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N079);
+    skinVertex(P079);
+    skinNormal(N086);
+    skinVertex(P086);
+    skinNormal(N078);
+    skinVertex(P078);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N086);
+    skinVertex(P086);
+    skinNormal(N088);
+    skinVertex(P088);
+    skinNormal(N078);
+    skinVertex(P078);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N078);
+    skinVertex(P078);
+    skinNormal(N088);
+    skinVertex(P088);
+    skinNormal(N089);
+    skinVertex(P089);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N088);
+    skinVertex(P088);
+    skinNormal(N086);
+    skinVertex(P086);
+    skinNormal(N089);
+    skinVertex(P089);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N089);
+    skinVertex(P089);
+    skinNormal(N086);
+    skinVertex(P086);
+    skinNormal(N078);
+    skinVertex(P078);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N086);
+    skinVertex(P086);
+    skinNormal(N084);
+    skinVertex(P084);
+    skinNormal(N078);
+    skinVertex(P078);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N078);
+    skinVertex(P078);
+    skinNormal(N084);
+    skinVertex(P084);
+    skinNormal(N079);
+    skinVertex(P079);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N084);
+    skinVertex(P084);
+    skinNormal(N082);
+    skinVertex(P082);
+    skinNormal(N079);
+    skinVertex(P079);
+    skinEnd();
 }
 
 void
 Dolphin012(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N058);
-    glVertex3fv(P058);
-    glNormal3fv(N059);
-    glVertex3fv(P059);
-    glNormal3fv(N067);
-    glVertex3fv(P067);
-    glNormal3fv(N066);
-    glVertex3fv(P066);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N059);
-    glVertex3fv(P059);
-    glNormal3fv(N052);
-    glVertex3fv(P052);
-    glNormal3fv(N060);
-    glVertex3fv(P060);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N059);
-    glVertex3fv(P059);
-    glNormal3fv(N060);
-    glVertex3fv(P060);
-    glNormal3fv(N067);
-    glVertex3fv(P067);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N058);
-    glVertex3fv(P058);
-    glNormal3fv(N066);
-    glVertex3fv(P066);
-    glNormal3fv(N065);
-    glVertex3fv(P065);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N058);
-    glVertex3fv(P058);
-    glNormal3fv(N065);
-    glVertex3fv(P065);
-    glNormal3fv(N057);
-    glVertex3fv(P057);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N056);
-    glVertex3fv(P056);
-    glNormal3fv(N057);
-    glVertex3fv(P057);
-    glNormal3fv(N065);
-    glVertex3fv(P065);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N056);
-    glVertex3fv(P056);
-    glNormal3fv(N065);
-    glVertex3fv(P065);
-    glNormal3fv(N006);
-    glVertex3fv(P006);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N056);
-    glVertex3fv(P056);
-    glNormal3fv(N006);
-    glVertex3fv(P006);
-    glNormal3fv(N063);
-    glVertex3fv(P063);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N056);
-    glVertex3fv(P056);
-    glNormal3fv(N063);
-    glVertex3fv(P063);
-    glNormal3fv(N055);
-    glVertex3fv(P055);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N054);
-    glVertex3fv(P054);
-    glNormal3fv(N062);
-    glVertex3fv(P062);
-    glNormal3fv(N005);
-    glVertex3fv(P005);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N054);
-    glVertex3fv(P054);
-    glNormal3fv(N005);
-    glVertex3fv(P005);
-    glNormal3fv(N053);
-    glVertex3fv(P053);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N052);
-    glVertex3fv(P052);
-    glNormal3fv(N053);
-    glVertex3fv(P053);
-    glNormal3fv(N005);
-    glVertex3fv(P005);
-    glNormal3fv(N060);
-    glVertex3fv(P060);
-    glEnd();
+    skinPolygon();
+    skinNormal(N058);
+    skinVertex(P058);
+    skinNormal(N059);
+    skinVertex(P059);
+    skinNormal(N067);
+    skinVertex(P067);
+    skinNormal(N066);
+    skinVertex(P066);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N059);
+    skinVertex(P059);
+    skinNormal(N052);
+    skinVertex(P052);
+    skinNormal(N060);
+    skinVertex(P060);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N059);
+    skinVertex(P059);
+    skinNormal(N060);
+    skinVertex(P060);
+    skinNormal(N067);
+    skinVertex(P067);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N058);
+    skinVertex(P058);
+    skinNormal(N066);
+    skinVertex(P066);
+    skinNormal(N065);
+    skinVertex(P065);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N058);
+    skinVertex(P058);
+    skinNormal(N065);
+    skinVertex(P065);
+    skinNormal(N057);
+    skinVertex(P057);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N056);
+    skinVertex(P056);
+    skinNormal(N057);
+    skinVertex(P057);
+    skinNormal(N065);
+    skinVertex(P065);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N056);
+    skinVertex(P056);
+    skinNormal(N065);
+    skinVertex(P065);
+    skinNormal(N006);
+    skinVertex(P006);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N056);
+    skinVertex(P056);
+    skinNormal(N006);
+    skinVertex(P006);
+    skinNormal(N063);
+    skinVertex(P063);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N056);
+    skinVertex(P056);
+    skinNormal(N063);
+    skinVertex(P063);
+    skinNormal(N055);
+    skinVertex(P055);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N054);
+    skinVertex(P054);
+    skinNormal(N062);
+    skinVertex(P062);
+    skinNormal(N005);
+    skinVertex(P005);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N054);
+    skinVertex(P054);
+    skinNormal(N005);
+    skinVertex(P005);
+    skinNormal(N053);
+    skinVertex(P053);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N052);
+    skinVertex(P052);
+    skinNormal(N053);
+    skinVertex(P053);
+    skinNormal(N005);
+    skinVertex(P005);
+    skinNormal(N060);
+    skinVertex(P060);
+    skinEnd();
 }
 
 void
 Dolphin013(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N116);
-    glVertex3fv(P116);
-    glNormal3fv(N117);
-    glVertex3fv(P117);
-    glNormal3fv(N112);
-    glVertex3fv(P112);
-    glNormal3fv(N113);
-    glVertex3fv(P113);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N114);
-    glVertex3fv(P114);
-    glNormal3fv(N113);
-    glVertex3fv(P113);
-    glNormal3fv(N112);
-    glVertex3fv(P112);
-    glNormal3fv(N115);
-    glVertex3fv(P115);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N114);
-    glVertex3fv(P114);
-    glNormal3fv(N116);
-    glVertex3fv(P116);
-    glNormal3fv(N113);
-    glVertex3fv(P113);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N114);
-    glVertex3fv(P114);
-    glNormal3fv(N007);
-    glVertex3fv(P007);
-    glNormal3fv(N116);
-    glVertex3fv(P116);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N007);
-    glVertex3fv(P007);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glNormal3fv(N116);
-    glVertex3fv(P116);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P002);
-    glVertex3fv(P007);
-    glVertex3fv(P008);
-    glVertex3fv(P099);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P007);
-    glVertex3fv(P114);
-    glVertex3fv(P115);
-    glVertex3fv(P008);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N117);
-    glVertex3fv(P117);
-    glNormal3fv(N099);
-    glVertex3fv(P099);
-    glNormal3fv(N008);
-    glVertex3fv(P008);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N117);
-    glVertex3fv(P117);
-    glNormal3fv(N008);
-    glVertex3fv(P008);
-    glNormal3fv(N112);
-    glVertex3fv(P112);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N112);
-    glVertex3fv(P112);
-    glNormal3fv(N008);
-    glVertex3fv(P008);
-    glNormal3fv(N115);
-    glVertex3fv(P115);
-    glEnd();
+    skinPolygon();
+    skinNormal(N116);
+    skinVertex(P116);
+    skinNormal(N117);
+    skinVertex(P117);
+    skinNormal(N112);
+    skinVertex(P112);
+    skinNormal(N113);
+    skinVertex(P113);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N114);
+    skinVertex(P114);
+    skinNormal(N113);
+    skinVertex(P113);
+    skinNormal(N112);
+    skinVertex(P112);
+    skinNormal(N115);
+    skinVertex(P115);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N114);
+    skinVertex(P114);
+    skinNormal(N116);
+    skinVertex(P116);
+    skinNormal(N113);
+    skinVertex(P113);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N114);
+    skinVertex(P114);
+    skinNormal(N007);
+    skinVertex(P007);
+    skinNormal(N116);
+    skinVertex(P116);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N007);
+    skinVertex(P007);
+    skinNormal(N002);
+    skinVertex(P002);
+    skinNormal(N116);
+    skinVertex(P116);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P002);
+    skinVertex(P007);
+    skinVertex(P008);
+    skinVertex(P099);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P007);
+    skinVertex(P114);
+    skinVertex(P115);
+    skinVertex(P008);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N117);
+    skinVertex(P117);
+    skinNormal(N099);
+    skinVertex(P099);
+    skinNormal(N008);
+    skinVertex(P008);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N117);
+    skinVertex(P117);
+    skinNormal(N008);
+    skinVertex(P008);
+    skinNormal(N112);
+    skinVertex(P112);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N112);
+    skinVertex(P112);
+    skinNormal(N008);
+    skinVertex(P008);
+    skinNormal(N115);
+    skinVertex(P115);
+    skinEnd();
 }
 
 void
 Dolphin014(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N111);
-    glVertex3fv(P111);
-    glNormal3fv(N110);
-    glVertex3fv(P110);
-    glNormal3fv(N102);
-    glVertex3fv(P102);
-    glNormal3fv(N121);
-    glVertex3fv(P121);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N111);
-    glVertex3fv(P111);
-    glNormal3fv(N097);
-    glVertex3fv(P097);
-    glNormal3fv(N110);
-    glVertex3fv(P110);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N097);
-    glVertex3fv(P097);
-    glNormal3fv(N119);
-    glVertex3fv(P119);
-    glNormal3fv(N110);
-    glVertex3fv(P110);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N097);
-    glVertex3fv(P097);
-    glNormal3fv(N099);
-    glVertex3fv(P099);
-    glNormal3fv(N119);
-    glVertex3fv(P119);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N099);
-    glVertex3fv(P099);
-    glNormal3fv(N065);
-    glVertex3fv(P065);
-    glNormal3fv(N119);
-    glVertex3fv(P119);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N065);
-    glVertex3fv(P065);
-    glNormal3fv(N066);
-    glVertex3fv(P066);
-    glNormal3fv(N119);
-    glVertex3fv(P119);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P098);
-    glVertex3fv(P097);
-    glVertex3fv(P111);
-    glVertex3fv(P121);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P002);
-    glVertex3fv(P099);
-    glVertex3fv(P097);
-    glVertex3fv(P098);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N110);
-    glVertex3fv(P110);
-    glNormal3fv(N119);
-    glVertex3fv(P119);
-    glNormal3fv(N118);
-    glVertex3fv(P118);
-    glNormal3fv(N102);
-    glVertex3fv(P102);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N119);
-    glVertex3fv(P119);
-    glNormal3fv(N066);
-    glVertex3fv(P066);
-    glNormal3fv(N067);
-    glVertex3fv(P067);
-    glNormal3fv(N118);
-    glVertex3fv(P118);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N067);
-    glVertex3fv(P067);
-    glNormal3fv(N060);
-    glVertex3fv(P060);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N067);
-    glVertex3fv(P067);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glNormal3fv(N118);
-    glVertex3fv(P118);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N118);
-    glVertex3fv(P118);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glNormal3fv(N098);
-    glVertex3fv(P098);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N118);
-    glVertex3fv(P118);
-    glNormal3fv(N098);
-    glVertex3fv(P098);
-    glNormal3fv(N102);
-    glVertex3fv(P102);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N102);
-    glVertex3fv(P102);
-    glNormal3fv(N098);
-    glVertex3fv(P098);
-    glNormal3fv(N121);
-    glVertex3fv(P121);
-    glEnd();
+    skinPolygon();
+    skinNormal(N111);
+    skinVertex(P111);
+    skinNormal(N110);
+    skinVertex(P110);
+    skinNormal(N102);
+    skinVertex(P102);
+    skinNormal(N121);
+    skinVertex(P121);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N111);
+    skinVertex(P111);
+    skinNormal(N097);
+    skinVertex(P097);
+    skinNormal(N110);
+    skinVertex(P110);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N097);
+    skinVertex(P097);
+    skinNormal(N119);
+    skinVertex(P119);
+    skinNormal(N110);
+    skinVertex(P110);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N097);
+    skinVertex(P097);
+    skinNormal(N099);
+    skinVertex(P099);
+    skinNormal(N119);
+    skinVertex(P119);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N099);
+    skinVertex(P099);
+    skinNormal(N065);
+    skinVertex(P065);
+    skinNormal(N119);
+    skinVertex(P119);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N065);
+    skinVertex(P065);
+    skinNormal(N066);
+    skinVertex(P066);
+    skinNormal(N119);
+    skinVertex(P119);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P098);
+    skinVertex(P097);
+    skinVertex(P111);
+    skinVertex(P121);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P002);
+    skinVertex(P099);
+    skinVertex(P097);
+    skinVertex(P098);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N110);
+    skinVertex(P110);
+    skinNormal(N119);
+    skinVertex(P119);
+    skinNormal(N118);
+    skinVertex(P118);
+    skinNormal(N102);
+    skinVertex(P102);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N119);
+    skinVertex(P119);
+    skinNormal(N066);
+    skinVertex(P066);
+    skinNormal(N067);
+    skinVertex(P067);
+    skinNormal(N118);
+    skinVertex(P118);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N067);
+    skinVertex(P067);
+    skinNormal(N060);
+    skinVertex(P060);
+    skinNormal(N002);
+    skinVertex(P002);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N067);
+    skinVertex(P067);
+    skinNormal(N002);
+    skinVertex(P002);
+    skinNormal(N118);
+    skinVertex(P118);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N118);
+    skinVertex(P118);
+    skinNormal(N002);
+    skinVertex(P002);
+    skinNormal(N098);
+    skinVertex(P098);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N118);
+    skinVertex(P118);
+    skinNormal(N098);
+    skinVertex(P098);
+    skinNormal(N102);
+    skinVertex(P102);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N102);
+    skinVertex(P102);
+    skinNormal(N098);
+    skinVertex(P098);
+    skinNormal(N121);
+    skinVertex(P121);
+    skinEnd();
 }
 
 void
 Dolphin015(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N055);
-    glVertex3fv(P055);
-    glNormal3fv(N003);
-    glVertex3fv(P003);
-    glNormal3fv(N054);
-    glVertex3fv(P054);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N003);
-    glVertex3fv(P003);
-    glNormal3fv(N055);
-    glVertex3fv(P055);
-    glNormal3fv(N063);
-    glVertex3fv(P063);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N003);
-    glVertex3fv(P003);
-    glNormal3fv(N063);
-    glVertex3fv(P063);
-    glNormal3fv(N100);
-    glVertex3fv(P100);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N003);
-    glVertex3fv(P003);
-    glNormal3fv(N100);
-    glVertex3fv(P100);
-    glNormal3fv(N054);
-    glVertex3fv(P054);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N054);
-    glVertex3fv(P054);
-    glNormal3fv(N100);
-    glVertex3fv(P100);
-    glNormal3fv(N062);
-    glVertex3fv(P062);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N100);
-    glVertex3fv(P100);
-    glNormal3fv(N064);
-    glVertex3fv(P064);
-    glNormal3fv(N120);
-    glVertex3fv(P120);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N100);
-    glVertex3fv(P100);
-    glNormal3fv(N063);
-    glVertex3fv(P063);
-    glNormal3fv(N064);
-    glVertex3fv(P064);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N063);
-    glVertex3fv(P063);
-    glNormal3fv(N006);
-    glVertex3fv(P006);
-    glNormal3fv(N064);
-    glVertex3fv(P064);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N064);
-    glVertex3fv(P064);
-    glNormal3fv(N006);
-    glVertex3fv(P006);
-    glNormal3fv(N099);
-    glVertex3fv(P099);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N064);
-    glVertex3fv(P064);
-    glNormal3fv(N099);
-    glVertex3fv(P099);
-    glNormal3fv(N117);
-    glVertex3fv(P117);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N120);
-    glVertex3fv(P120);
-    glNormal3fv(N064);
-    glVertex3fv(P064);
-    glNormal3fv(N117);
-    glVertex3fv(P117);
-    glNormal3fv(N116);
-    glVertex3fv(P116);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N006);
-    glVertex3fv(P006);
-    glNormal3fv(N065);
-    glVertex3fv(P065);
-    glNormal3fv(N099);
-    glVertex3fv(P099);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N062);
-    glVertex3fv(P062);
-    glNormal3fv(N100);
-    glVertex3fv(P100);
-    glNormal3fv(N120);
-    glVertex3fv(P120);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N005);
-    glVertex3fv(P005);
-    glNormal3fv(N062);
-    glVertex3fv(P062);
-    glNormal3fv(N120);
-    glVertex3fv(P120);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N005);
-    glVertex3fv(P005);
-    glNormal3fv(N120);
-    glVertex3fv(P120);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glNormal3fv(N120);
-    glVertex3fv(P120);
-    glNormal3fv(N116);
-    glVertex3fv(P116);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N060);
-    glVertex3fv(P060);
-    glNormal3fv(N005);
-    glVertex3fv(P005);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glEnd();
+    skinPolygon();
+    skinNormal(N055);
+    skinVertex(P055);
+    skinNormal(N003);
+    skinVertex(P003);
+    skinNormal(N054);
+    skinVertex(P054);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N003);
+    skinVertex(P003);
+    skinNormal(N055);
+    skinVertex(P055);
+    skinNormal(N063);
+    skinVertex(P063);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N003);
+    skinVertex(P003);
+    skinNormal(N063);
+    skinVertex(P063);
+    skinNormal(N100);
+    skinVertex(P100);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N003);
+    skinVertex(P003);
+    skinNormal(N100);
+    skinVertex(P100);
+    skinNormal(N054);
+    skinVertex(P054);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N054);
+    skinVertex(P054);
+    skinNormal(N100);
+    skinVertex(P100);
+    skinNormal(N062);
+    skinVertex(P062);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N100);
+    skinVertex(P100);
+    skinNormal(N064);
+    skinVertex(P064);
+    skinNormal(N120);
+    skinVertex(P120);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N100);
+    skinVertex(P100);
+    skinNormal(N063);
+    skinVertex(P063);
+    skinNormal(N064);
+    skinVertex(P064);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N063);
+    skinVertex(P063);
+    skinNormal(N006);
+    skinVertex(P006);
+    skinNormal(N064);
+    skinVertex(P064);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N064);
+    skinVertex(P064);
+    skinNormal(N006);
+    skinVertex(P006);
+    skinNormal(N099);
+    skinVertex(P099);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N064);
+    skinVertex(P064);
+    skinNormal(N099);
+    skinVertex(P099);
+    skinNormal(N117);
+    skinVertex(P117);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N120);
+    skinVertex(P120);
+    skinNormal(N064);
+    skinVertex(P064);
+    skinNormal(N117);
+    skinVertex(P117);
+    skinNormal(N116);
+    skinVertex(P116);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N006);
+    skinVertex(P006);
+    skinNormal(N065);
+    skinVertex(P065);
+    skinNormal(N099);
+    skinVertex(P099);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N062);
+    skinVertex(P062);
+    skinNormal(N100);
+    skinVertex(P100);
+    skinNormal(N120);
+    skinVertex(P120);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N005);
+    skinVertex(P005);
+    skinNormal(N062);
+    skinVertex(P062);
+    skinNormal(N120);
+    skinVertex(P120);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N005);
+    skinVertex(P005);
+    skinNormal(N120);
+    skinVertex(P120);
+    skinNormal(N002);
+    skinVertex(P002);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N002);
+    skinVertex(P002);
+    skinNormal(N120);
+    skinVertex(P120);
+    skinNormal(N116);
+    skinVertex(P116);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N060);
+    skinVertex(P060);
+    skinNormal(N005);
+    skinVertex(P005);
+    skinNormal(N002);
+    skinVertex(P002);
+    skinEnd();
 }
 
 void
@@ -1777,35 +1781,114 @@ Dolphin016(void)
 {
 
     glDisable(GL_DEPTH_TEST);
-    glBegin(GL_POLYGON);
-    glVertex3fv(P123);
-    glVertex3fv(P124);
-    glVertex3fv(P125);
-    glVertex3fv(P126);
-    glVertex3fv(P127);
-    glVertex3fv(P128);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P129);
-    glVertex3fv(P130);
-    glVertex3fv(P131);
-    glVertex3fv(P132);
-    glVertex3fv(P133);
-    glVertex3fv(P134);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P103);
-    glVertex3fv(P105);
-    glVertex3fv(P108);
-    glEnd();
+    skinPolygon();
+    skinVertex(P123);
+    skinVertex(P124);
+    skinVertex(P125);
+    skinVertex(P126);
+    skinVertex(P127);
+    skinVertex(P128);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P129);
+    skinVertex(P130);
+    skinVertex(P131);
+    skinVertex(P132);
+    skinVertex(P133);
+    skinVertex(P134);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P103);
+    skinVertex(P105);
+    skinVertex(P108);
+    skinEnd();
     glEnable(GL_DEPTH_TEST);
 }
 
+void
+DolphinModel(void)
+{
+    Dolphin014();
+    Dolphin010();
+    Dolphin009();
+    Dolphin012();
+    Dolphin013();
+    Dolphin006();
+    Dolphin002();
+    Dolphin001();
+    Dolphin003();
+    Dolphin015();
+    Dolphin004();
+    Dolphin005();
+    Dolphin007();
+    Dolphin008();
+    Dolphin011();
+    Dolphin016();
+}
+
+enum {
+    DOLPHIN_SEG0, DOLPHIN_SEG1, DOLPHIN_SEG2, DOLPHIN_SEG3,
+    DOLPHIN_SEG4, DOLPHIN_SEG5, DOLPHIN_SEG6, DOLPHIN_SEG7, DOLPHIN_CHOMP,
+    DOLPHIN_BONES
+};
+
+/* *INDENT-OFF* */
+#define BIND(n, bone, w) {P##n, iP##n, bone, w}
+static skinBind dolphinBinds[] = {
+    BIND(012, DOLPHIN_SEG5, 1.0), BIND(013, DOLPHIN_SEG5, 1.0),
+    BIND(014, DOLPHIN_SEG5, 1.0), BIND(015, DOLPHIN_SEG5, 1.0),
+    BIND(016, DOLPHIN_SEG5, 1.0), BIND(017, DOLPHIN_SEG5, 1.0),
+    BIND(018, DOLPHIN_SEG5, 1.0), BIND(019, DOLPHIN_SEG5, 1.0),
+    BIND(020, DOLPHIN_SEG4, 1.0), BIND(021, DOLPHIN_SEG4, 1.0),
+    BIND(022, DOLPHIN_SEG4, 1.0), BIND(023, DOLPHIN_SEG4, 1.0),
+    BIND(024, DOLPHIN_SEG4, 1.0), BIND(025, DOLPHIN_SEG4, 1.0),
+    BIND(026, DOLPHIN_SEG4, 1.0), BIND(027, DOLPHIN_SEG4, 1.0),
+    BIND(028, DOLPHIN_SEG2, 1.0), BIND(029, DOLPHIN_SEG2, 1.0),
+    BIND(030, DOLPHIN_SEG2, 1.0), BIND(031, DOLPHIN_SEG2, 1.0),
+    BIND(032, DOLPHIN_SEG2, 1.0), BIND(033, DOLPHIN_SEG2, 1.0),
+    BIND(034, DOLPHIN_SEG2, 1.0), BIND(035, DOLPHIN_SEG2, 1.0),
+    BIND(036, DOLPHIN_SEG1, 1.0), BIND(037, DOLPHIN_SEG1, 1.0),
+    BIND(038, DOLPHIN_SEG1, 1.0), BIND(039, DOLPHIN_SEG1, 1.0),
+    BIND(040, DOLPHIN_SEG1, 1.0), BIND(041, DOLPHIN_SEG1, 1.0),
+    BIND(042, DOLPHIN_SEG1, 1.0), BIND(043, DOLPHIN_SEG1, 1.0),
+    BIND(044, DOLPHIN_SEG0, 1.0), BIND(045, DOLPHIN_SEG0, 1.0),
+    BIND(046, DOLPHIN_SEG0, 1.0), BIND(047, DOLPHIN_SEG0, 1.0),
+    BIND(048, DOLPHIN_SEG0, 1.0), BIND(049, DOLPHIN_SEG0, 1.0),
+    BIND(050, DOLPHIN_SEG0, 1.0), BIND(051, DOLPHIN_SEG0, 1.0),
+    BIND(009, DOLPHIN_SEG6, 1.0), BIND(010, DOLPHIN_SEG6, 1.0),
+    BIND(075, DOLPHIN_SEG6, 1.0), BIND(076, DOLPHIN_SEG6, 1.0),
+    BIND(001, DOLPHIN_SEG7, 1.0), BIND(011, DOLPHIN_SEG7, 1.0),
+    BIND(068, DOLPHIN_SEG7, 1.0), BIND(069, DOLPHIN_SEG7, 1.0),
+    BIND(070, DOLPHIN_SEG7, 1.0), BIND(071, DOLPHIN_SEG7, 1.0),
+    BIND(072, DOLPHIN_SEG7, 1.0), BIND(073, DOLPHIN_SEG7, 1.0),
+    BIND(074, DOLPHIN_SEG7, 1.0),
+    BIND(091, DOLPHIN_SEG3, 1.0), BIND(092, DOLPHIN_SEG3, 1.0),
+    BIND(093, DOLPHIN_SEG3, 1.0), BIND(094, DOLPHIN_SEG3, 1.0),
+    BIND(095, DOLPHIN_SEG3, 1.0),
+    BIND(122, DOLPHIN_SEG3, 1.5),
+    BIND(097, DOLPHIN_CHOMP, 1.0), BIND(098, DOLPHIN_CHOMP, 1.0),
+    BIND(102, DOLPHIN_CHOMP, 1.0), BIND(110, DOLPHIN_CHOMP, 1.0),
+    BIND(111, DOLPHIN_CHOMP, 1.0), BIND(118, DOLPHIN_CHOMP, 1.0),
+    BIND(119, DOLPHIN_CHOMP, 1.0), BIND(121, DOLPHIN_CHOMP, 1.0),
+};
+/* *INDENT-ON* */
+
 void
 DrawDolphin(fishRec * fish)
 {
     float seg0, seg1, seg2, seg3, seg4, seg5, seg6, seg7;
     float pitch, thrash, chomp;
+    static skinMesh *mesh;
+    float bones[DOLPHIN_BONES][3];
+
+    if (!mesh) {
+        mesh = skinCapture(DolphinModel, dolphinBinds,
+            sizeof(dolphinBinds) / sizeof(dolphinBinds[0]), DOLPHIN_BONES);
+        if (!mesh) {
+            fprintf(stderr, "atlantis: out of memory\n");
+            exit(1);
+        }
+    }
 
     fish->htail = (int) (fish->htail - (int) (10.0 * fish->v)) % 360;
 
@@ -1827,81 +1910,16 @@ DrawDolphin(fishRec * fish)
     }
     chomp = 100.0;
 
-    P012[1] = iP012[1] + seg5;
-    P013[1] = iP013[1] + seg5;
-    P014[1] = iP014[1] + seg5;
-    P015[1] = iP015[1] + seg5;
-    P016[1] = iP016[1] + seg5;
-    P017[1] = iP017[1] + seg5;
-    P018[1] = iP018[1] + seg5;
-    P019[1] = iP019[1] + seg5;
-
-    P020[1] = iP020[1] + seg4;
-    P021[1] = iP021[1] + seg4;
-    P022[1] = iP022[1] + seg4;
-    P023[1] = iP023[1] + seg4;
-    P024[1] = iP024[1] + seg4;
-    P025[1] = iP025[1] + seg4;
-    P026[1] = iP026[1] + seg4;
-    P027[1] = iP027[1] + seg4;
-
-    P028[1] = iP028[1] + seg2;
-    P029[1] = iP029[1] + seg2;
-    P030[1] = iP030[1] + seg2;
-    P031[1] = iP031[1] + seg2;
-    P032[1] = iP032[1] + seg2;
-    P033[1] = iP033[1] + seg2;
-    P034[1] = iP034[1] + seg2;
-    P035[1] = iP035[1] + seg2;
-
-    P036[1] = iP036[1] + seg1;
-    P037[1] = iP037[1] + seg1;
-    P038[1] = iP038[1] + seg1;
-    P039[1] = iP039[1] + seg1;
-    P040[1] = iP040[1] + seg1;
-    P041[1] = iP041[1] + seg1;
-    P042[1] = iP042[1] + seg1;
-    P043[1] = iP043[1] + seg1;
-
-    P044[1] = iP044[1] + seg0;
-    P045[1] = iP045[1] + seg0;
-    P046[1] = iP046[1] + seg0;
-    P047[1] = iP047[1] + seg0;
-    P048[1] = iP048[1] + seg0;
-    P049[1] = iP049[1] + seg0;
-    P050[1] = iP050[1] + seg0;
-    P051[1] = iP051[1] + seg0;
-
-    P009[1] = iP009[1] + seg6;
-    P010[1] = iP010[1] + seg6;
-    P075[1] = iP075[1] + seg6;
-    P076[1] = iP076[1] + seg6;
-
-    P001[1] = iP001[1] + seg7;
-    P011[1] = iP011[1] + seg7;
-    P068[1] = iP068[1] + seg7;
-    P069[1] = iP069[1] + seg7;
-    P070[1] = iP070[1] + seg7;
-    P071[1] = iP071[1] + seg7;
-    P072[1] = iP072[1] + seg7;
-    P073[1] = iP073[1] + seg7;
-    P074[1] = iP074[1] + seg7;
-
-    P091[1] = iP091[1] + seg3;
-    P092[1] = iP092[1] + seg3;
-    P093[1] = iP093[1] + seg3;
-    P094[1] = iP094[1] + seg3;
-    P095[1] = iP095[1] + seg3;
-    P122[1] = iP122[1] + seg3 * 1.5;
-
-    P097[1] = iP097[1] + chomp;
-    P098[1] = iP098[1] + chomp;
-    P102[1] = iP102[1] + chomp;
-    P110[1] = iP110[1] + chomp;
-    P111[1] = iP111[1] + chomp;
-    P121[1] = iP121[1] + chomp;
-    P118[1] = iP118[1] + chomp;
-    P119[1] = iP119[1] + chomp;
+    memset(bones, 0, sizeof(bones));
+    bones[DOLPHIN_SEG0][1] = seg0;
+    bones[DOLPHIN_SEG1][1] = seg1;
+    bones[DOLPHIN_SEG2][1] = seg2;
+    bones[DOLPHIN_SEG3][1] = seg3;
+    bones[DOLPHIN_SEG4][1] = seg4;
+    bones[DOLPHIN_SEG5][1] = seg5;
+    bones[DOLPHIN_SEG6][1] = seg6;
+    bones[DOLPHIN_SEG7][1] = seg7;
+    bones[DOLPHIN_CHOMP][1] = chomp;
 
     glPushMatrix();
 
@@ -1912,22 +1930,7 @@ DrawDolphin(fishRec * fish)
     glRotatef(180.0, 0.0, 1.0, 0.0);
 
     glEnable(GL_CULL_FACE);
-    Dolphin014();
-    Dolphin010();
-    Dolphin009();
-    Dolphin012();
-    Dolphin013();
-    Dolphin006();
-    Dolphin002();
-    Dolphin001();
-    Dolphin003();
-    Dolphin015();
-    Dolphin004();
-    Dolphin005();
-    Dolphin007();
-    Dolphin008();
-    Dolphin011();
-    Dolphin016();
+    skinDraw(mesh, bones);
     glDisable(GL_CULL_FACE);
 
     glPopMatrix();
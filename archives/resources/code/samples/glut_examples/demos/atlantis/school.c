@@ -0,0 +1,534 @@
+/*
+ *  school.c
+ *
+ *  Flocking, see school.h.
+ *
+ *  The creatures are kept as separate arrays of x, y, z, heading and
+ *  speed.  Every step they are counting-sorted by grid cell hash, so the
+ *  creatures in a cell sit next to each other in a second set of arrays;
+ *  each creature then looks through the 27 cells around it four
+ *  neighbors at a time (SSE when available, otherwise plain loops), and
+ *  writes its next state to a third set of arrays.  The sort is done on
+ *  the calling thread; the steering, which is nearly all of the time, is
+ *  split between threads by ranges of creatures, on the worker pool in
+ *  sig99/adv99/util.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "school.h"
+#include "pool.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define SC_SSE
+#include <xmmintrin.h>
+#endif
+
+
+#define SC_SEPARATE  0.5		/* rule weights */
+#define SC_ALIGN     0.05
+#define SC_COHERE    0.02
+#define SC_SEEK      0.01
+#define SC_WANDER    0.01
+#define SC_MAX_TURN  0.03		/* most change of heading per step */
+#define SC_ATTACK    0.985		/* cos 10 degrees: pointed at the target */
+#define SC_THREAD_MIN  2048		/* fewest creatures worth a thread */
+
+
+/* one set of creature arrays */
+typedef struct {
+  float *x, *y, *z;			/* position */
+  float *hx, *hy, *hz;			/* unit heading */
+  float *v;				/* speed, in multiples of the cruise */
+  unsigned char *spurt;			/* speeding up */
+} SCstate;
+
+struct _School {
+  int n;
+  float size, speed, radius;
+  unsigned seed, step;
+  float target[3];
+
+  SCstate now, next;
+  SCstate sorted;			/* now, in cell order */
+
+  int tableSize;			/* power of two */
+  unsigned *key;			/* cell hash of each creature */
+  int *cellStart;			/* tableSize + 1 ranges into sorted */
+  int *order;				/* creature in each sorted slot */
+
+  int threads;
+  pool_t *pool;
+};
+
+
+static int
+stateNew(SCstate *s, int n)
+{
+  s->x = (float *) malloc(7 * n * sizeof(float));
+  s->spurt = (unsigned char *) calloc(n, 1);
+  if (!s->x || !s->spurt) {
+    free(s->x);
+    free(s->spurt);
+    return 0;
+  }
+  memset(s->x, 0, 7 * n * sizeof(float));
+  s->y = s->x + n;
+  s->z = s->y + n;
+  s->hx = s->z + n;
+  s->hy = s->hx + n;
+  s->hz = s->hy + n;
+  s->v = s->hz + n;
+  return 1;
+}
+
+
+static void
+stateDelete(SCstate *s)
+{
+  free(s->x);
+  free(s->spurt);
+}
+
+
+School *
+schoolNew(int n, float size, float speed, unsigned seed)
+{
+  School *s;
+  int i;
+
+  if (n < 1)
+    return NULL;
+  s = (School *) calloc(1, sizeof(School));
+  if (!s)
+    return NULL;
+  s->n = n;
+  s->size = size;
+  s->speed = speed;
+  s->radius = 2.0 * size;
+  s->seed = seed;
+  for (s->tableSize = 1; s->tableSize < 2 * n; s->tableSize *= 2);
+  s->key = (unsigned *) malloc(n * sizeof(unsigned));
+  s->cellStart = (int *) malloc((s->tableSize + 1) * sizeof(int));
+  s->order = (int *) malloc(n * sizeof(int));
+  if (!s->key || !s->cellStart || !s->order ||
+      !stateNew(&s->now, n) || !stateNew(&s->next, n) ||
+      !stateNew(&s->sorted, n)) {
+    schoolDelete(s);
+    return NULL;
+  }
+  for (i = 0; i < n; i++)
+    s->now.hx[i] = 1.0;
+  s->threads = pool_cpus();
+  return s;
+}
+
+
+int
+schoolCount(const School *s)
+{
+  return s->n;
+}
+
+
+void
+schoolSet(School *s, int i, const float pos[3], const float vel[3])
+{
+  float l = sqrt(vel[0] * vel[0] + vel[1] * vel[1] + vel[2] * vel[2]);
+
+  s->now.x[i] = pos[0];
+  s->now.y[i] = pos[1];
+  s->now.z[i] = pos[2];
+  if (l > 0.0) {
+    s->now.hx[i] = vel[0] / l;
+    s->now.hy[i] = vel[1] / l;
+    s->now.hz[i] = vel[2] / l;
+  }
+  s->now.v[i] = l / s->speed;
+  s->now.spurt[i] = 0;
+}
+
+
+void
+schoolGet(const School *s, int i, float pos[3], float vel[3])
+{
+  float l = s->now.v[i] * s->speed;
+
+  pos[0] = s->now.x[i];
+  pos[1] = s->now.y[i];
+  pos[2] = s->now.z[i];
+  vel[0] = s->now.hx[i] * l;
+  vel[1] = s->now.hy[i] * l;
+  vel[2] = s->now.hz[i] * l;
+}
+
+
+void
+schoolTarget(School *s, float x, float y, float z)
+{
+  s->target[0] = x;
+  s->target[1] = y;
+  s->target[2] = z;
+}
+
+
+/* a well mixed 32 bit hash, for random numbers that don't depend on
+   the order creatures are updated in */
+static unsigned
+mix(unsigned a, unsigned b, unsigned c)
+{
+  a ^= b * 0x9e3779b9u;
+  a ^= c * 0x85ebca6bu;
+  a ^= a >> 16;
+  a *= 0x7feb352du;
+  a ^= a >> 15;
+  a *= 0x846ca68bu;
+  a ^= a >> 16;
+  return a;
+}
+
+
+/* -1 to 1 */
+static float
+noise(unsigned h)
+{
+  return (h >> 8) * (2.0 / 16777216.0) - 1.0;
+}
+
+
+static unsigned
+cellHash(int cx, int cy, int cz, int tableSize)
+{
+  return ((unsigned) cx * 73856093u ^ (unsigned) cy * 19349663u ^
+	  (unsigned) cz * 83492791u) & (tableSize - 1);
+}
+
+
+/* sort the creatures by cell into s->sorted */
+static void
+sortCells(School *s)
+{
+  SCstate *a = &s->now, *b = &s->sorted;
+  float inv = 1.0 / s->radius;
+  int *start = s->cellStart;
+  int i, j, k;
+
+  memset(start, 0, (s->tableSize + 1) * sizeof(int));
+  for (i = 0; i < s->n; i++) {
+    s->key[i] = cellHash((int) floor(a->x[i] * inv),
+			 (int) floor(a->y[i] * inv),
+			 (int) floor(a->z[i] * inv), s->tableSize);
+    start[s->key[i] + 1]++;
+  }
+  for (k = 0; k < s->tableSize; k++)
+    start[k + 1] += start[k];
+
+  /* scatter, leaving start[k] at the end of cell k, then shift back */
+  for (i = 0; i < s->n; i++) {
+    j = start[s->key[i]]++;
+    s->order[j] = i;
+    b->x[j] = a->x[i];
+    b->y[j] = a->y[i];
+    b->z[j] = a->z[i];
+    b->hx[j] = a->hx[i];
+    b->hy[j] = a->hy[i];
+    b->hz[j] = a->hz[i];
+  }
+  for (k = s->tableSize; k > 0; k--)
+    start[k] = start[k - 1];
+  start[0] = 0;
+}
+
+
+/* neighbor sums for one creature */
+typedef struct {
+  float count;
+  float h[3];				/* heading */
+  float p[3];				/* position */
+  float sep[3];				/* push away */
+} SCsums;
+
+
+/* sums over the creatures in the given hash buckets */
+static void
+gather(const School *s, const unsigned *cells, int numCells,
+       const float p[3], SCsums *m)
+{
+  const SCstate *b = &s->sorted;
+  float r2 = s->radius * s->radius, size2 = s->size * s->size;
+  float invSize = 1.0 / s->size;
+  int c, j, last;
+#ifdef SC_SSE
+  __m128 px = _mm_set1_ps(p[0]), py = _mm_set1_ps(p[1]),
+    pz = _mm_set1_ps(p[2]);
+  __m128 vr2 = _mm_set1_ps(r2), vs2 = _mm_set1_ps(size2),
+    vis = _mm_set1_ps(invSize), zero = _mm_setzero_ps(),
+    one = _mm_set1_ps(1.0), half = _mm_set1_ps(0.5), three = _mm_set1_ps(3.0),
+    lane = _mm_setr_ps(0.0, 1.0, 2.0, 3.0);
+  __m128 cnt = zero, shx = zero, shy = zero, shz = zero,
+    spx = zero, spy = zero, spz = zero,
+    ssx = zero, ssy = zero, ssz = zero;
+  __m128 qx, qy, qz, ex, ey, ez, e2, near, close, inv, end;
+  float t[4];
+
+  /* Buckets rarely hold a multiple of four, so the last group is read
+     whole and masked: the sorted arrays are cut from one block ending
+     with v, which isn't read here, so reading up to three past the end
+     of x, y, z, hx, hy or hz stays inside it. */
+  for (c = 0; c < numCells; c++) {
+    j = s->cellStart[cells[c]];
+    last = s->cellStart[cells[c] + 1];
+    end = _mm_set1_ps((float) last);
+    for (; j < last; j += 4) {
+      qx = _mm_loadu_ps(b->x + j);
+      qy = _mm_loadu_ps(b->y + j);
+      qz = _mm_loadu_ps(b->z + j);
+      ex = _mm_sub_ps(px, qx);
+      ey = _mm_sub_ps(py, qy);
+      ez = _mm_sub_ps(pz, qz);
+      e2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ex, ex), _mm_mul_ps(ey, ey)),
+		      _mm_mul_ps(ez, ez));
+      near = _mm_and_ps(_mm_cmplt_ps(e2, vr2), _mm_cmpgt_ps(e2, zero));
+      near = _mm_and_ps(near, _mm_cmplt_ps(_mm_add_ps(_mm_set1_ps((float) j),
+						      lane), end));
+      close = _mm_and_ps(near, _mm_cmplt_ps(e2, vs2));
+
+      cnt = _mm_add_ps(cnt, _mm_and_ps(near, one));
+      shx = _mm_add_ps(shx, _mm_and_ps(near, _mm_loadu_ps(b->hx + j)));
+      shy = _mm_add_ps(shy, _mm_and_ps(near, _mm_loadu_ps(b->hy + j)));
+      shz = _mm_add_ps(shz, _mm_and_ps(near, _mm_loadu_ps(b->hz + j)));
+      spx = _mm_add_ps(spx, _mm_and_ps(near, qx));
+      spy = _mm_add_ps(spy, _mm_and_ps(near, qy));
+      spz = _mm_add_ps(spz, _mm_and_ps(near, qz));
+
+      /* (p - q) (1/d - 1/size): a unit push, fading to 0 at size */
+      inv = _mm_rsqrt_ps(e2);
+      inv = _mm_mul_ps(_mm_mul_ps(half, inv),
+		       _mm_sub_ps(three, _mm_mul_ps(e2, _mm_mul_ps(inv, inv))));
+      inv = _mm_and_ps(close, _mm_sub_ps(inv, vis));
+      ssx = _mm_add_ps(ssx, _mm_mul_ps(ex, inv));
+      ssy = _mm_add_ps(ssy, _mm_mul_ps(ey, inv));
+      ssz = _mm_add_ps(ssz, _mm_mul_ps(ez, inv));
+    }
+  }
+
+#define SC_SUM(v) \
+  (_mm_storeu_ps(t, v), (t[0] + t[1]) + (t[2] + t[3]))
+  m->count = SC_SUM(cnt);
+  m->h[0] = SC_SUM(shx);
+  m->h[1] = SC_SUM(shy);
+  m->h[2] = SC_SUM(shz);
+  m->p[0] = SC_SUM(spx);
+  m->p[1] = SC_SUM(spy);
+  m->p[2] = SC_SUM(spz);
+  m->sep[0] = SC_SUM(ssx);
+  m->sep[1] = SC_SUM(ssy);
+  m->sep[2] = SC_SUM(ssz);
+#undef SC_SUM
+#else
+  float dx, dy, dz, d2, w;
+
+  memset(m, 0, sizeof(SCsums));
+  for (c = 0; c < numCells; c++) {
+    last = s->cellStart[cells[c] + 1];
+    for (j = s->cellStart[cells[c]]; j < last; j++) {
+      dx = p[0] - b->x[j];
+      dy = p[1] - b->y[j];
+      dz = p[2] - b->z[j];
+      d2 = dx * dx + dy * dy + dz * dz;
+      if (d2 >= r2 || d2 <= 0.0)
+	continue;
+      m->count += 1.0;
+      m->h[0] += b->hx[j];
+      m->h[1] += b->hy[j];
+      m->h[2] += b->hz[j];
+      m->p[0] += b->x[j];
+      m->p[1] += b->y[j];
+      m->p[2] += b->z[j];
+      if (d2 < size2) {
+	w = 1.0 / sqrt(d2) - invSize;
+	m->sep[0] += dx * w;
+	m->sep[1] += dy * w;
+	m->sep[2] += dz * w;
+      }
+    }
+  }
+#endif
+}
+
+
+/* the next state of the creatures in sorted slots [begin, end) */
+static void
+steer(School *s, int begin, int end)
+{
+  SCstate *a = &s->now, *b = &s->sorted, *n = &s->next;
+  float inv = 1.0 / s->radius;
+  float p[3], h[3], f[3], t[3], l, v, c;
+  unsigned cells[27], key, r;
+  int numCells, cx, cy, cz, i, o, j, k, dx, dy, dz;
+  SCsums m;
+
+  /* in cell order, so that neighboring creatures share the cells read */
+  for (o = begin; o < end; o++) {
+    i = s->order[o];
+    p[0] = b->x[o];
+    p[1] = b->y[o];
+    p[2] = b->z[o];
+    h[0] = b->hx[o];
+    h[1] = b->hy[o];
+    h[2] = b->hz[o];
+
+    /* the cells around, each hash bucket once */
+    cx = (int) floor(p[0] * inv);
+    cy = (int) floor(p[1] * inv);
+    cz = (int) floor(p[2] * inv);
+    numCells = 0;
+    for (dz = -1; dz <= 1; dz++)
+      for (dy = -1; dy <= 1; dy++)
+	for (dx = -1; dx <= 1; dx++) {
+	  key = cellHash(cx + dx, cy + dy, cz + dz, s->tableSize);
+	  for (k = 0; k < numCells; k++)
+	    if (cells[k] == key)
+	      break;
+	  if (k == numCells)
+	    cells[numCells++] = key;
+	}
+
+    gather(s, cells, numCells, p, &m);
+
+    f[0] = f[1] = f[2] = 0.0;
+    for (j = 0; j < 3; j++)
+      f[j] += SC_SEPARATE * m.sep[j];
+    if (m.count > 0.0) {
+      for (j = 0; j < 3; j++) {
+	f[j] += SC_ALIGN * (m.h[j] / m.count - h[j]);
+	f[j] += SC_COHERE * (m.p[j] / m.count - p[j]) * inv;
+      }
+    }
+    t[0] = s->target[0] - p[0];
+    t[1] = s->target[1] - p[1];
+    t[2] = s->target[2] - p[2];
+    l = sqrt(t[0] * t[0] + t[1] * t[1] + t[2] * t[2]);
+    if (l > 0.0) {
+      t[0] /= l;
+      t[1] /= l;
+      t[2] /= l;
+    }
+    r = mix(s->seed, i, s->step);
+    for (j = 0; j < 3; j++) {
+      f[j] += SC_SEEK * t[j];
+      f[j] += SC_WANDER * noise(mix(r, j, 0));
+    }
+
+    l = sqrt(f[0] * f[0] + f[1] * f[1] + f[2] * f[2]);
+    if (l > SC_MAX_TURN) {
+      l = SC_MAX_TURN / l;
+      f[0] *= l;
+      f[1] *= l;
+      f[2] *= l;
+    }
+    h[0] += f[0];
+    h[1] += f[1];
+    h[2] += f[2];
+    l = sqrt(h[0] * h[0] + h[1] * h[1] + h[2] * h[2]);
+    if (l > 0.0) {
+      h[0] /= l;
+      h[1] /= l;
+      h[2] /= l;
+    }
+
+    /* speed, as SharkPilot() did it */
+    v = a->v[i];
+    c = a->spurt[i];
+    if (h[0] * t[0] + h[1] * t[1] + h[2] * t[2] > SC_ATTACK) {
+      if (v < 1.1)
+	c = 1;
+      if (c)
+	v += 0.2;
+      if (v > 5.0)
+	c = 0;
+      if (v > 1.0 && !c)
+	v -= 0.2;
+    } else {
+      if ((r & 0xffff) % 400 == 0 && !c)
+	c = 1;
+      if (c)
+	v += 0.05;
+      if (v > 3.0)
+	c = 0;
+      if (v > 1.0 && !c)
+	v -= 0.05;
+    }
+
+    l = v * s->speed;
+    n->x[i] = p[0] + h[0] * l;
+    n->y[i] = p[1] + h[1] * l;
+    n->z[i] = p[2] + h[2] * l;
+    n->hx[i] = h[0];
+    n->hy[i] = h[1];
+    n->hz[i] = h[2];
+    n->v[i] = v;
+    n->spurt[i] = c != 0;
+  }
+}
+
+
+/* steer() as a pool job */
+static void
+steerRange(void *arg, int begin, int end)
+{
+  steer((School *) arg, begin, end);
+}
+
+
+void
+schoolStep(School *s)
+{
+  SCstate t;
+  int ranges;
+
+  sortCells(s);
+
+  ranges = s->n / SC_THREAD_MIN;
+  if (ranges > s->threads)
+    ranges = s->threads;
+  if (ranges > 1 && !s->pool)
+    s->pool = pool_new(s->threads);
+  if (ranges > pool_threads(s->pool))
+    ranges = pool_threads(s->pool);
+  if (ranges < 1)
+    ranges = 1;
+  pool_run(s->pool, steerRange, s, ranges, (s->n + ranges - 1) / ranges,
+	   s->n);
+
+  t = s->now;
+  s->now = s->next;
+  s->next = t;
+  s->step++;
+}
+
+
+void
+schoolThreads(School *s, int threads)
+{
+  s->threads = threads < 1 ? 1 : threads;
+  pool_delete(s->pool);
+  s->pool = NULL;
+}
+
+
+void
+schoolDelete(School *s)
+{
+  if (!s)
+    return;
+  pool_delete(s->pool);
+  stateDelete(&s->now);
+  stateDelete(&s->next);
+  stateDelete(&s->sorted);
+  free(s->key);
+  free(s->cellStart);
+  free(s->order);
+  free(s);
+}
@@ -0,0 +1,52 @@
+/*
+ *  school.h
+ *
+ *  Flocking for the Atlantis sharks, sized for anything from the four in
+ *  the demo to hundreds of thousands.
+ *
+ *  Each creature steers by the usual three rules over the neighbors
+ *  within a radius (separation, alignment and cohesion), keeps clear of
+ *  anything closer than its size the way SharkMiss() did, and heads for
+ *  a target, speeding up to attack when it's pointed at it the way
+ *  SharkPilot() did.  Neighbors are found through a uniform grid hashed
+ *  into a table, rebuilt every step.
+ *
+ *  A step only reads the previous step's state, so the result doesn't
+ *  depend on how many threads do it, and the small random wander is a
+ *  hash of the creature and the step number rather than rand(): the same
+ *  seed gives the same school on any number of threads.
+ */
+
+#ifndef SCHOOL_H
+#define SCHOOL_H
+
+
+typedef struct _School School;
+
+
+/* n creatures of the given size (also the neighbor radius divided by
+   two) and cruising speed (distance per step), all at the origin and at
+   rest.  Returns NULL if out of memory. */
+extern School *schoolNew(int n, float size, float speed, unsigned seed);
+
+extern void schoolDelete(School *s);
+
+extern int schoolCount(const School *s);
+
+extern void schoolSet(School *s, int i, const float pos[3],
+		      const float vel[3]);
+
+extern void schoolGet(const School *s, int i, float pos[3], float vel[3]);
+
+/* Where the school heads; the origin unless set. */
+extern void schoolTarget(School *s, float x, float y, float z);
+
+/* Advance every creature one step. */
+extern void schoolStep(School *s);
+
+/* Most threads schoolStep() may use (the number of processors unless
+   set). */
+extern void schoolThreads(School *s, int threads);
+
+
+#endif /* SCHOOL_H */
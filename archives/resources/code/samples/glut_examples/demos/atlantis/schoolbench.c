@@ -0,0 +1,143 @@
+/*
+ *  schoolbench.c
+ *
+ *  Time the shark school without drawing anything.  Schools of 1000 up
+ *  to the given number of creatures are scattered through a cube sized
+ *  for about 20 neighbors each and stepped on one thread and on as many
+ *  as there are processors, each for at least the given number of steps
+ *  and a quarter of a second.  Creature updates per second are printed,
+ *  and the two runs are checked to have come out the same.
+ *
+ *  usage: schoolbench [max creatures [steps]]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "atlantis.h"
+#include "school.h"
+
+#ifdef _WIN32
+#include <windows.h>
+typedef int timer;
+#define getTime(a)	(a = GetTickCount())
+#define timeDiff(a, b)	((b - a) * 1000)
+#else
+#include <sys/time.h>
+#include <unistd.h>
+typedef struct timeval timer;
+#define getTime(a)	gettimeofday(&a, NULL)
+#define timeDiff(a, b)	(((b.tv_sec - a.tv_sec) * 1000000) + b.tv_usec - a.tv_usec)
+#endif
+
+static int steps = 20;
+
+/* A school of n scattered with the same seed every time. */
+static School *
+NewSchool(int n)
+{
+    School *s;
+    float side, pos[3], vel[3], l;
+    int i, j;
+
+    s = schoolNew(n, SHARKSIZE, SHARKSPEED, 1);
+    if (!s) {
+        fprintf(stderr, "schoolbench: Can't allocate %d creatures.\n", n);
+        exit(-1);
+    }
+    /* 4/3 pi r^3 per 20 creatures, r the neighbor radius */
+    side = 2.0 * SHARKSIZE * pow(n * 4.19 / 20.0, 1.0 / 3.0);
+    srand(1);
+    for (i = 0; i < n; i++) {
+        do {
+            l = 0.0;
+            for (j = 0; j < 3; j++) {
+                vel[j] = 2.0 * rand() / RAND_MAX - 1.0;
+                l += vel[j] * vel[j];
+            }
+        } while (l > 1.0 || l < 0.01);
+        l = SHARKSPEED / sqrt(l);
+        for (j = 0; j < 3; j++) {
+            pos[j] = side * rand() / RAND_MAX;
+            vel[j] *= l;
+        }
+        schoolSet(s, i, pos, vel);
+    }
+    schoolTarget(s, side / 2.0, side / 2.0, side / 2.0);
+    return s;
+}
+
+/* Creature updates per second of a school of n on the given threads. */
+static double
+Run(int n, int threads)
+{
+    School *s;
+    timer t0, t1;
+    long usec;
+    int k = 0;
+
+    s = NewSchool(n);
+    schoolThreads(s, threads);
+    schoolStep(s);              /* one untimed step */
+    getTime(t0);
+    do {
+        schoolStep(s);
+        getTime(t1);
+        usec = timeDiff(t0, t1);
+    } while (++k < steps || usec < 250000);
+    schoolDelete(s);
+    return (double) n * k / (usec > 0 ? usec : 1) * 1000000.0;
+}
+
+/* A checksum of where a school of n is after the given number of steps
+   on the given threads. */
+static unsigned
+Sum(int n, int threads)
+{
+    School *s;
+    float pos[3], vel[3];
+    unsigned u[6], sum = 2166136261u;
+    int i, k;
+
+    s = NewSchool(n);
+    schoolThreads(s, threads);
+    for (k = 0; k < steps; k++)
+        schoolStep(s);
+    for (i = 0; i < n; i++) {
+        schoolGet(s, i, pos, vel);
+        memcpy(u, pos, sizeof(pos));
+        memcpy(u + 3, vel, sizeof(vel));
+        for (k = 0; k < 6; k++)
+            sum = (sum ^ u[k]) * 16777619u;
+    }
+    schoolDelete(s);
+    return sum;
+}
+
+int
+main(int argc, char **argv)
+{
+    int max = 100000, n, threads = 1;
+    double one, all;
+
+    if (argc > 1)
+        max = atoi(argv[1]);
+    if (argc > 2)
+        steps = atoi(argv[2]);
+#ifndef _WIN32
+    threads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+    if (threads < 1)
+        threads = 1;
+#endif
+
+    printf("creature updates per second, %d processors\n", threads);
+    printf("%10s %12s %12s %6s\n", "creatures", "1 thread", "threaded", "same");
+    for (n = 1000; n <= max; n *= 10) {
+        one = Run(n, 1);
+        all = Run(n, threads);
+        printf("%10d %12.0f %12.0f %6s\n", n, one, all,
+               Sum(n, 1) == Sum(n, threads > 1 ? threads : 4) ? "yes" : "NO");
+    }
+    return 0;
+}
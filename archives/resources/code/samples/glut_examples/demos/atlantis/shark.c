@@ -34,9 +34,13 @@
  *
  * OpenGL(TM) is a trademark of Silicon Graphics, Inc.
  */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <GL/glut.h>
 #include <math.h>
 #include "atlantis.h"
+#include "skin.h"
 /* *INDENT-OFF* */
 static float N002[3] = {0.000077 ,-0.020611 ,0.999788};
 static float N003[3] = {0.961425 ,0.258729 ,-0.093390};
@@ -217,950 +221,891 @@ static float iP070[3] = {0.00, 1266.91, 6629.60};
 void
 Fish001(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N005);
-    glVertex3fv(P005);
-    glNormal3fv(N059);
-    glVertex3fv(P059);
-    glNormal3fv(N060);
-    glVertex3fv(P060);
-    glNormal3fv(N006);
-    glVertex3fv(P006);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N015);
-    glVertex3fv(P015);
-    glNormal3fv(N005);
-    glVertex3fv(P005);
-    glNormal3fv(N006);
-    glVertex3fv(P006);
-    glNormal3fv(N016);
-    glVertex3fv(P016);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N006);
-    glVertex3fv(P006);
-    glNormal3fv(N060);
-    glVertex3fv(P060);
-    glNormal3fv(N008);
-    glVertex3fv(P008);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N016);
-    glVertex3fv(P016);
-    glNormal3fv(N006);
-    glVertex3fv(P006);
-    glNormal3fv(N008);
-    glVertex3fv(P008);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N016);
-    glVertex3fv(P016);
-    glNormal3fv(N008);
-    glVertex3fv(P008);
-    glNormal3fv(N017);
-    glVertex3fv(P017);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N017);
-    glVertex3fv(P017);
-    glNormal3fv(N008);
-    glVertex3fv(P008);
-    glNormal3fv(N018);
-    glVertex3fv(P018);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N008);
-    glVertex3fv(P008);
-    glNormal3fv(N009);
-    glVertex3fv(P009);
-    glNormal3fv(N018);
-    glVertex3fv(P018);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N008);
-    glVertex3fv(P008);
-    glNormal3fv(N060);
-    glVertex3fv(P060);
-    glNormal3fv(N009);
-    glVertex3fv(P009);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N007);
-    glVertex3fv(P007);
-    glNormal3fv(N010);
-    glVertex3fv(P010);
-    glNormal3fv(N009);
-    glVertex3fv(P009);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N009);
-    glVertex3fv(P009);
-    glNormal3fv(N019);
-    glVertex3fv(P019);
-    glNormal3fv(N018);
-    glVertex3fv(P018);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N009);
-    glVertex3fv(P009);
-    glNormal3fv(N010);
-    glVertex3fv(P010);
-    glNormal3fv(N019);
-    glVertex3fv(P019);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N010);
-    glVertex3fv(P010);
-    glNormal3fv(N020);
-    glVertex3fv(P020);
-    glNormal3fv(N019);
-    glVertex3fv(P019);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N010);
-    glVertex3fv(P010);
-    glNormal3fv(N011);
-    glVertex3fv(P011);
-    glNormal3fv(N021);
-    glVertex3fv(P021);
-    glNormal3fv(N020);
-    glVertex3fv(P020);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N004);
-    glVertex3fv(P004);
-    glNormal3fv(N011);
-    glVertex3fv(P011);
-    glNormal3fv(N010);
-    glVertex3fv(P010);
-    glNormal3fv(N007);
-    glVertex3fv(P007);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N004);
-    glVertex3fv(P004);
-    glNormal3fv(N012);
-    glVertex3fv(P012);
-    glNormal3fv(N011);
-    glVertex3fv(P011);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N012);
-    glVertex3fv(P012);
-    glNormal3fv(N022);
-    glVertex3fv(P022);
-    glNormal3fv(N011);
-    glVertex3fv(P011);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N011);
-    glVertex3fv(P011);
-    glNormal3fv(N022);
-    glVertex3fv(P022);
-    glNormal3fv(N021);
-    glVertex3fv(P021);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N059);
-    glVertex3fv(P059);
-    glNormal3fv(N005);
-    glVertex3fv(P005);
-    glNormal3fv(N015);
-    glVertex3fv(P015);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N015);
-    glVertex3fv(P015);
-    glNormal3fv(N014);
-    glVertex3fv(P014);
-    glNormal3fv(N003);
-    glVertex3fv(P003);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N015);
-    glVertex3fv(P015);
-    glNormal3fv(N003);
-    glVertex3fv(P003);
-    glNormal3fv(N059);
-    glVertex3fv(P059);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N014);
-    glVertex3fv(P014);
-    glNormal3fv(N013);
-    glVertex3fv(P013);
-    glNormal3fv(N003);
-    glVertex3fv(P003);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N003);
-    glVertex3fv(P003);
-    glNormal3fv(N012);
-    glVertex3fv(P012);
-    glNormal3fv(N059);
-    glVertex3fv(P059);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N013);
-    glVertex3fv(P013);
-    glNormal3fv(N012);
-    glVertex3fv(P012);
-    glNormal3fv(N003);
-    glVertex3fv(P003);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N013);
-    glVertex3fv(P013);
-    glNormal3fv(N022);
-    glVertex3fv(P022);
-    glNormal3fv(N012);
-    glVertex3fv(P012);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P071);
-    glVertex3fv(P072);
-    glVertex3fv(P073);
-    glVertex3fv(P074);
-    glVertex3fv(P075);
-    glVertex3fv(P076);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P077);
-    glVertex3fv(P078);
-    glVertex3fv(P079);
-    glVertex3fv(P080);
-    glVertex3fv(P081);
-    glVertex3fv(P082);
-    glEnd();
+    skinPolygon();
+    skinNormal(N005);
+    skinVertex(P005);
+    skinNormal(N059);
+    skinVertex(P059);
+    skinNormal(N060);
+    skinVertex(P060);
+    skinNormal(N006);
+    skinVertex(P006);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N015);
+    skinVertex(P015);
+    skinNormal(N005);
+    skinVertex(P005);
+    skinNormal(N006);
+    skinVertex(P006);
+    skinNormal(N016);
+    skinVertex(P016);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N006);
+    skinVertex(P006);
+    skinNormal(N060);
+    skinVertex(P060);
+    skinNormal(N008);
+    skinVertex(P008);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N016);
+    skinVertex(P016);
+    skinNormal(N006);
+    skinVertex(P006);
+    skinNormal(N008);
+    skinVertex(P008);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N016);
+    skinVertex(P016);
+    skinNormal(N008);
+    skinVertex(P008);
+    skinNormal(N017);
+    skinVertex(P017);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N017);
+    skinVertex(P017);
+    skinNormal(N008);
+    skinVertex(P008);
+    skinNormal(N018);
+    skinVertex(P018);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N008);
+    skinVertex(P008);
+    skinNormal(N009);
+    skinVertex(P009);
+    skinNormal(N018);
+    skinVertex(P018);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N008);
+    skinVertex(P008);
+    skinNormal(N060);
+    skinVertex(P060);
+    skinNormal(N009);
+    skinVertex(P009);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N007);
+    skinVertex(P007);
+    skinNormal(N010);
+    skinVertex(P010);
+    skinNormal(N009);
+    skinVertex(P009);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N009);
+    skinVertex(P009);
+    skinNormal(N019);
+    skinVertex(P019);
+    skinNormal(N018);
+    skinVertex(P018);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N009);
+    skinVertex(P009);
+    skinNormal(N010);
+    skinVertex(P010);
+    skinNormal(N019);
+    skinVertex(P019);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N010);
+    skinVertex(P010);
+    skinNormal(N020);
+    skinVertex(P020);
+    skinNormal(N019);
+    skinVertex(P019);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N010);
+    skinVertex(P010);
+    skinNormal(N011);
+    skinVertex(P011);
+    skinNormal(N021);
+    skinVertex(P021);
+    skinNormal(N020);
+    skinVertex(P020);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N004);
+    skinVertex(P004);
+    skinNormal(N011);
+    skinVertex(P011);
+    skinNormal(N010);
+    skinVertex(P010);
+    skinNormal(N007);
+    skinVertex(P007);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N004);
+    skinVertex(P004);
+    skinNormal(N012);
+    skinVertex(P012);
+    skinNormal(N011);
+    skinVertex(P011);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N012);
+    skinVertex(P012);
+    skinNormal(N022);
+    skinVertex(P022);
+    skinNormal(N011);
+    skinVertex(P011);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N011);
+    skinVertex(P011);
+    skinNormal(N022);
+    skinVertex(P022);
+    skinNormal(N021);
+    skinVertex(P021);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N059);
+    skinVertex(P059);
+    skinNormal(N005);
+    skinVertex(P005);
+    skinNormal(N015);
+    skinVertex(P015);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N015);
+    skinVertex(P015);
+    skinNormal(N014);
+    skinVertex(P014);
+    skinNormal(N003);
+    skinVertex(P003);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N015);
+    skinVertex(P015);
+    skinNormal(N003);
+    skinVertex(P003);
+    skinNormal(N059);
+    skinVertex(P059);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N014);
+    skinVertex(P014);
+    skinNormal(N013);
+    skinVertex(P013);
+    skinNormal(N003);
+    skinVertex(P003);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N003);
+    skinVertex(P003);
+    skinNormal(N012);
+    skinVertex(P012);
+    skinNormal(N059);
+    skinVertex(P059);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N013);
+    skinVertex(P013);
+    skinNormal(N012);
+    skinVertex(P012);
+    skinNormal(N003);
+    skinVertex(P003);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N013);
+    skinVertex(P013);
+    skinNormal(N022);
+    skinVertex(P022);
+    skinNormal(N012);
+    skinVertex(P012);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P071);
+    skinVertex(P072);
+    skinVertex(P073);
+    skinVertex(P074);
+    skinVertex(P075);
+    skinVertex(P076);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P077);
+    skinVertex(P078);
+    skinVertex(P079);
+    skinVertex(P080);
+    skinVertex(P081);
+    skinVertex(P082);
+    skinEnd();
 }
 
 void
 Fish002(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N013);
-    glVertex3fv(P013);
-    glNormal3fv(N014);
-    glVertex3fv(P014);
-    glNormal3fv(N024);
-    glVertex3fv(P024);
-    glNormal3fv(N023);
-    glVertex3fv(P023);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N014);
-    glVertex3fv(P014);
-    glNormal3fv(N015);
-    glVertex3fv(P015);
-    glNormal3fv(N025);
-    glVertex3fv(P025);
-    glNormal3fv(N024);
-    glVertex3fv(P024);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N016);
-    glVertex3fv(P016);
-    glNormal3fv(N017);
-    glVertex3fv(P017);
-    glNormal3fv(N027);
-    glVertex3fv(P027);
-    glNormal3fv(N026);
-    glVertex3fv(P026);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N017);
-    glVertex3fv(P017);
-    glNormal3fv(N018);
-    glVertex3fv(P018);
-    glNormal3fv(N028);
-    glVertex3fv(P028);
-    glNormal3fv(N027);
-    glVertex3fv(P027);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N020);
-    glVertex3fv(P020);
-    glNormal3fv(N021);
-    glVertex3fv(P021);
-    glNormal3fv(N031);
-    glVertex3fv(P031);
-    glNormal3fv(N030);
-    glVertex3fv(P030);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N013);
-    glVertex3fv(P013);
-    glNormal3fv(N023);
-    glVertex3fv(P023);
-    glNormal3fv(N022);
-    glVertex3fv(P022);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N022);
-    glVertex3fv(P022);
-    glNormal3fv(N023);
-    glVertex3fv(P023);
-    glNormal3fv(N032);
-    glVertex3fv(P032);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N022);
-    glVertex3fv(P022);
-    glNormal3fv(N032);
-    glVertex3fv(P032);
-    glNormal3fv(N031);
-    glVertex3fv(P031);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N022);
-    glVertex3fv(P022);
-    glNormal3fv(N031);
-    glVertex3fv(P031);
-    glNormal3fv(N021);
-    glVertex3fv(P021);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N018);
-    glVertex3fv(P018);
-    glNormal3fv(N019);
-    glVertex3fv(P019);
-    glNormal3fv(N029);
-    glVertex3fv(P029);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N018);
-    glVertex3fv(P018);
-    glNormal3fv(N029);
-    glVertex3fv(P029);
-    glNormal3fv(N028);
-    glVertex3fv(P028);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N019);
-    glVertex3fv(P019);
-    glNormal3fv(N020);
-    glVertex3fv(P020);
-    glNormal3fv(N030);
-    glVertex3fv(P030);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N019);
-    glVertex3fv(P019);
-    glNormal3fv(N030);
-    glVertex3fv(P030);
-    glNormal3fv(N029);
-    glVertex3fv(P029);
-    glEnd();
+    skinPolygon();
+    skinNormal(N013);
+    skinVertex(P013);
+    skinNormal(N014);
+    skinVertex(P014);
+    skinNormal(N024);
+    skinVertex(P024);
+    skinNormal(N023);
+    skinVertex(P023);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N014);
+    skinVertex(P014);
+    skinNormal(N015);
+    skinVertex(P015);
+    skinNormal(N025);
+    skinVertex(P025);
+    skinNormal(N024);
+    skinVertex(P024);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N016);
+    skinVertex(P016);
+    skinNormal(N017);
+    skinVertex(P017);
+    skinNormal(N027);
+    skinVertex(P027);
+    skinNormal(N026);
+    skinVertex(P026);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N017);
+    skinVertex(P017);
+    skinNormal(N018);
+    skinVertex(P018);
+    skinNormal(N028);
+    skinVertex(P028);
+    skinNormal(N027);
+    skinVertex(P027);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N020);
+    skinVertex(P020);
+    skinNormal(N021);
+    skinVertex(P021);
+    skinNormal(N031);
+    skinVertex(P031);
+    skinNormal(N030);
+    skinVertex(P030);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N013);
+    skinVertex(P013);
+    skinNormal(N023);
+    skinVertex(P023);
+    skinNormal(N022);
+    skinVertex(P022);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N022);
+    skinVertex(P022);
+    skinNormal(N023);
+    skinVertex(P023);
+    skinNormal(N032);
+    skinVertex(P032);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N022);
+    skinVertex(P022);
+    skinNormal(N032);
+    skinVertex(P032);
+    skinNormal(N031);
+    skinVertex(P031);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N022);
+    skinVertex(P022);
+    skinNormal(N031);
+    skinVertex(P031);
+    skinNormal(N021);
+    skinVertex(P021);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N018);
+    skinVertex(P018);
+    skinNormal(N019);
+    skinVertex(P019);
+    skinNormal(N029);
+    skinVertex(P029);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N018);
+    skinVertex(P018);
+    skinNormal(N029);
+    skinVertex(P029);
+    skinNormal(N028);
+    skinVertex(P028);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N019);
+    skinVertex(P019);
+    skinNormal(N020);
+    skinVertex(P020);
+    skinNormal(N030);
+    skinVertex(P030);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N019);
+    skinVertex(P019);
+    skinNormal(N030);
+    skinVertex(P030);
+    skinNormal(N029);
+    skinVertex(P029);
+    skinEnd();
 }
 
 void
 Fish003(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N032);
-    glVertex3fv(P032);
-    glNormal3fv(N023);
-    glVertex3fv(P023);
-    glNormal3fv(N033);
-    glVertex3fv(P033);
-    glNormal3fv(N042);
-    glVertex3fv(P042);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N031);
-    glVertex3fv(P031);
-    glNormal3fv(N032);
-    glVertex3fv(P032);
-    glNormal3fv(N042);
-    glVertex3fv(P042);
-    glNormal3fv(N041);
-    glVertex3fv(P041);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N023);
-    glVertex3fv(P023);
-    glNormal3fv(N024);
-    glVertex3fv(P024);
-    glNormal3fv(N034);
-    glVertex3fv(P034);
-    glNormal3fv(N033);
-    glVertex3fv(P033);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N024);
-    glVertex3fv(P024);
-    glNormal3fv(N025);
-    glVertex3fv(P025);
-    glNormal3fv(N035);
-    glVertex3fv(P035);
-    glNormal3fv(N034);
-    glVertex3fv(P034);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N030);
-    glVertex3fv(P030);
-    glNormal3fv(N031);
-    glVertex3fv(P031);
-    glNormal3fv(N041);
-    glVertex3fv(P041);
-    glNormal3fv(N040);
-    glVertex3fv(P040);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N025);
-    glVertex3fv(P025);
-    glNormal3fv(N026);
-    glVertex3fv(P026);
-    glNormal3fv(N036);
-    glVertex3fv(P036);
-    glNormal3fv(N035);
-    glVertex3fv(P035);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N026);
-    glVertex3fv(P026);
-    glNormal3fv(N027);
-    glVertex3fv(P027);
-    glNormal3fv(N037);
-    glVertex3fv(P037);
-    glNormal3fv(N036);
-    glVertex3fv(P036);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N027);
-    glVertex3fv(P027);
-    glNormal3fv(N028);
-    glVertex3fv(P028);
-    glNormal3fv(N038);
-    glVertex3fv(P038);
-    glNormal3fv(N037);
-    glVertex3fv(P037);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N028);
-    glVertex3fv(P028);
-    glNormal3fv(N029);
-    glVertex3fv(P029);
-    glNormal3fv(N039);
-    glVertex3fv(P039);
-    glNormal3fv(N038);
-    glVertex3fv(P038);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N029);
-    glVertex3fv(P029);
-    glNormal3fv(N030);
-    glVertex3fv(P030);
-    glNormal3fv(N040);
-    glVertex3fv(P040);
-    glNormal3fv(N039);
-    glVertex3fv(P039);
-    glEnd();
+    skinPolygon();
+    skinNormal(N032);
+    skinVertex(P032);
+    skinNormal(N023);
+    skinVertex(P023);
+    skinNormal(N033);
+    skinVertex(P033);
+    skinNormal(N042);
+    skinVertex(P042);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N031);
+    skinVertex(P031);
+    skinNormal(N032);
+    skinVertex(P032);
+    skinNormal(N042);
+    skinVertex(P042);
+    skinNormal(N041);
+    skinVertex(P041);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N023);
+    skinVertex(P023);
+    skinNormal(N024);
+    skinVertex(P024);
+    skinNormal(N034);
+    skinVertex(P034);
+    skinNormal(N033);
+    skinVertex(P033);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N024);
+    skinVertex(P024);
+    skinNormal(N025);
+    skinVertex(P025);
+    skinNormal(N035);
+    skinVertex(P035);
+    skinNormal(N034);
+    skinVertex(P034);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N030);
+    skinVertex(P030);
+    skinNormal(N031);
+    skinVertex(P031);
+    skinNormal(N041);
+    skinVertex(P041);
+    skinNormal(N040);
+    skinVertex(P040);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N025);
+    skinVertex(P025);
+    skinNormal(N026);
+    skinVertex(P026);
+    skinNormal(N036);
+    skinVertex(P036);
+    skinNormal(N035);
+    skinVertex(P035);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N026);
+    skinVertex(P026);
+    skinNormal(N027);
+    skinVertex(P027);
+    skinNormal(N037);
+    skinVertex(P037);
+    skinNormal(N036);
+    skinVertex(P036);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N027);
+    skinVertex(P027);
+    skinNormal(N028);
+    skinVertex(P028);
+    skinNormal(N038);
+    skinVertex(P038);
+    skinNormal(N037);
+    skinVertex(P037);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N028);
+    skinVertex(P028);
+    skinNormal(N029);
+    skinVertex(P029);
+    skinNormal(N039);
+    skinVertex(P039);
+    skinNormal(N038);
+    skinVertex(P038);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N029);
+    skinVertex(P029);
+    skinNormal(N030);
+    skinVertex(P030);
+    skinNormal(N040);
+    skinVertex(P040);
+    skinNormal(N039);
+    skinVertex(P039);
+    skinEnd();
 }
 
 void
 Fish004(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N040);
-    glVertex3fv(P040);
-    glNormal3fv(N041);
-    glVertex3fv(P041);
-    glNormal3fv(N051);
-    glVertex3fv(P051);
-    glNormal3fv(N050);
-    glVertex3fv(P050);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N041);
-    glVertex3fv(P041);
-    glNormal3fv(N042);
-    glVertex3fv(P042);
-    glNormal3fv(N052);
-    glVertex3fv(P052);
-    glNormal3fv(N051);
-    glVertex3fv(P051);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N042);
-    glVertex3fv(P042);
-    glNormal3fv(N033);
-    glVertex3fv(P033);
-    glNormal3fv(N043);
-    glVertex3fv(P043);
-    glNormal3fv(N052);
-    glVertex3fv(P052);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N033);
-    glVertex3fv(P033);
-    glNormal3fv(N034);
-    glVertex3fv(P034);
-    glNormal3fv(N044);
-    glVertex3fv(P044);
-    glNormal3fv(N043);
-    glVertex3fv(P043);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N034);
-    glVertex3fv(P034);
-    glNormal3fv(N035);
-    glVertex3fv(P035);
-    glNormal3fv(N045);
-    glVertex3fv(P045);
-    glNormal3fv(N044);
-    glVertex3fv(P044);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N035);
-    glVertex3fv(P035);
-    glNormal3fv(N036);
-    glVertex3fv(P036);
-    glNormal3fv(N046);
-    glVertex3fv(P046);
-    glNormal3fv(N045);
-    glVertex3fv(P045);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N036);
-    glVertex3fv(P036);
-    glNormal3fv(N037);
-    glVertex3fv(P037);
-    glNormal3fv(N047);
-    glVertex3fv(P047);
-    glNormal3fv(N046);
-    glVertex3fv(P046);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N037);
-    glVertex3fv(P037);
-    glNormal3fv(N038);
-    glVertex3fv(P038);
-    glNormal3fv(N048);
-    glVertex3fv(P048);
-    glNormal3fv(N047);
-    glVertex3fv(P047);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N038);
-    glVertex3fv(P038);
-    glNormal3fv(N039);
-    glVertex3fv(P039);
-    glNormal3fv(N049);
-    glVertex3fv(P049);
-    glNormal3fv(N048);
-    glVertex3fv(P048);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N039);
-    glVertex3fv(P039);
-    glNormal3fv(N040);
-    glVertex3fv(P040);
-    glNormal3fv(N050);
-    glVertex3fv(P050);
-    glNormal3fv(N049);
-    glVertex3fv(P049);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N070);
-    glVertex3fv(P070);
-    glNormal3fv(N061);
-    glVertex3fv(P061);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N061);
-    glVertex3fv(P061);
-    glNormal3fv(N046);
-    glVertex3fv(P046);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N045);
-    glVertex3fv(P045);
-    glNormal3fv(N046);
-    glVertex3fv(P046);
-    glNormal3fv(N061);
-    glVertex3fv(P061);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glNormal3fv(N061);
-    glVertex3fv(P061);
-    glNormal3fv(N070);
-    glVertex3fv(P070);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glNormal3fv(N045);
-    glVertex3fv(P045);
-    glNormal3fv(N061);
-    glVertex3fv(P061);
-    glEnd();
+    skinPolygon();
+    skinNormal(N040);
+    skinVertex(P040);
+    skinNormal(N041);
+    skinVertex(P041);
+    skinNormal(N051);
+    skinVertex(P051);
+    skinNormal(N050);
+    skinVertex(P050);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N041);
+    skinVertex(P041);
+    skinNormal(N042);
+    skinVertex(P042);
+    skinNormal(N052);
+    skinVertex(P052);
+    skinNormal(N051);
+    skinVertex(P051);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N042);
+    skinVertex(P042);
+    skinNormal(N033);
+    skinVertex(P033);
+    skinNormal(N043);
+    skinVertex(P043);
+    skinNormal(N052);
+    skinVertex(P052);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N033);
+    skinVertex(P033);
+    skinNormal(N034);
+    skinVertex(P034);
+    skinNormal(N044);
+    skinVertex(P044);
+    skinNormal(N043);
+    skinVertex(P043);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N034);
+    skinVertex(P034);
+    skinNormal(N035);
+    skinVertex(P035);
+    skinNormal(N045);
+    skinVertex(P045);
+    skinNormal(N044);
+    skinVertex(P044);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N035);
+    skinVertex(P035);
+    skinNormal(N036);
+    skinVertex(P036);
+    skinNormal(N046);
+    skinVertex(P046);
+    skinNormal(N045);
+    skinVertex(P045);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N036);
+    skinVertex(P036);
+    skinNormal(N037);
+    skinVertex(P037);
+    skinNormal(N047);
+    skinVertex(P047);
+    skinNormal(N046);
+    skinVertex(P046);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N037);
+    skinVertex(P037);
+    skinNormal(N038);
+    skinVertex(P038);
+    skinNormal(N048);
+    skinVertex(P048);
+    skinNormal(N047);
+    skinVertex(P047);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N038);
+    skinVertex(P038);
+    skinNormal(N039);
+    skinVertex(P039);
+    skinNormal(N049);
+    skinVertex(P049);
+    skinNormal(N048);
+    skinVertex(P048);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N039);
+    skinVertex(P039);
+    skinNormal(N040);
+    skinVertex(P040);
+    skinNormal(N050);
+    skinVertex(P050);
+    skinNormal(N049);
+    skinVertex(P049);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N070);
+    skinVertex(P070);
+    skinNormal(N061);
+    skinVertex(P061);
+    skinNormal(N002);
+    skinVertex(P002);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N061);
+    skinVertex(P061);
+    skinNormal(N046);
+    skinVertex(P046);
+    skinNormal(N002);
+    skinVertex(P002);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N045);
+    skinVertex(P045);
+    skinNormal(N046);
+    skinVertex(P046);
+    skinNormal(N061);
+    skinVertex(P061);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N002);
+    skinVertex(P002);
+    skinNormal(N061);
+    skinVertex(P061);
+    skinNormal(N070);
+    skinVertex(P070);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N002);
+    skinVertex(P002);
+    skinNormal(N045);
+    skinVertex(P045);
+    skinNormal(N061);
+    skinVertex(P061);
+    skinEnd();
 }
 
 void
 Fish005(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glNormal3fv(N044);
-    glVertex3fv(P044);
-    glNormal3fv(N045);
-    glVertex3fv(P045);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glNormal3fv(N043);
-    glVertex3fv(P043);
-    glNormal3fv(N044);
-    glVertex3fv(P044);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glNormal3fv(N052);
-    glVertex3fv(P052);
-    glNormal3fv(N043);
-    glVertex3fv(P043);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glNormal3fv(N051);
-    glVertex3fv(P051);
-    glNormal3fv(N052);
-    glVertex3fv(P052);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glNormal3fv(N046);
-    glVertex3fv(P046);
-    glNormal3fv(N047);
-    glVertex3fv(P047);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glNormal3fv(N047);
-    glVertex3fv(P047);
-    glNormal3fv(N048);
-    glVertex3fv(P048);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glNormal3fv(N048);
-    glVertex3fv(P048);
-    glNormal3fv(N049);
-    glVertex3fv(P049);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glNormal3fv(N049);
-    glVertex3fv(P049);
-    glNormal3fv(N050);
-    glVertex3fv(P050);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N050);
-    glVertex3fv(P050);
-    glNormal3fv(N051);
-    glVertex3fv(P051);
-    glNormal3fv(N069);
-    glVertex3fv(P069);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N051);
-    glVertex3fv(P051);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glNormal3fv(N069);
-    glVertex3fv(P069);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N050);
-    glVertex3fv(P050);
-    glNormal3fv(N069);
-    glVertex3fv(P069);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glEnd();
+    skinPolygon();
+    skinNormal(N002);
+    skinVertex(P002);
+    skinNormal(N044);
+    skinVertex(P044);
+    skinNormal(N045);
+    skinVertex(P045);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N002);
+    skinVertex(P002);
+    skinNormal(N043);
+    skinVertex(P043);
+    skinNormal(N044);
+    skinVertex(P044);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N002);
+    skinVertex(P002);
+    skinNormal(N052);
+    skinVertex(P052);
+    skinNormal(N043);
+    skinVertex(P043);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N002);
+    skinVertex(P002);
+    skinNormal(N051);
+    skinVertex(P051);
+    skinNormal(N052);
+    skinVertex(P052);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N002);
+    skinVertex(P002);
+    skinNormal(N046);
+    skinVertex(P046);
+    skinNormal(N047);
+    skinVertex(P047);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N002);
+    skinVertex(P002);
+    skinNormal(N047);
+    skinVertex(P047);
+    skinNormal(N048);
+    skinVertex(P048);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N002);
+    skinVertex(P002);
+    skinNormal(N048);
+    skinVertex(P048);
+    skinNormal(N049);
+    skinVertex(P049);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N002);
+    skinVertex(P002);
+    skinNormal(N049);
+    skinVertex(P049);
+    skinNormal(N050);
+    skinVertex(P050);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N050);
+    skinVertex(P050);
+    skinNormal(N051);
+    skinVertex(P051);
+    skinNormal(N069);
+    skinVertex(P069);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N051);
+    skinVertex(P051);
+    skinNormal(N002);
+    skinVertex(P002);
+    skinNormal(N069);
+    skinVertex(P069);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N050);
+    skinVertex(P050);
+    skinNormal(N069);
+    skinVertex(P069);
+    skinNormal(N002);
+    skinVertex(P002);
+    skinEnd();
 }
 
 void
 Fish006(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N066);
-    glVertex3fv(P066);
-    glNormal3fv(N016);
-    glVertex3fv(P016);
-    glNormal3fv(N026);
-    glVertex3fv(P026);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N015);
-    glVertex3fv(P015);
-    glNormal3fv(N066);
-    glVertex3fv(P066);
-    glNormal3fv(N025);
-    glVertex3fv(P025);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N025);
-    glVertex3fv(P025);
-    glNormal3fv(N066);
-    glVertex3fv(P066);
-    glNormal3fv(N026);
-    glVertex3fv(P026);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N066);
-    glVertex3fv(P066);
-    glNormal3fv(N058);
-    glVertex3fv(P058);
-    glNormal3fv(N016);
-    glVertex3fv(P016);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N015);
-    glVertex3fv(P015);
-    glNormal3fv(N058);
-    glVertex3fv(P058);
-    glNormal3fv(N066);
-    glVertex3fv(P066);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N058);
-    glVertex3fv(P058);
-    glNormal3fv(N015);
-    glVertex3fv(P015);
-    glNormal3fv(N016);
-    glVertex3fv(P016);
-    glEnd();
+    skinPolygon();
+    skinNormal(N066);
+    skinVertex(P066);
+    skinNormal(N016);
+    skinVertex(P016);
+    skinNormal(N026);
+    skinVertex(P026);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N015);
+    skinVertex(P015);
+    skinNormal(N066);
+    skinVertex(P066);
+    skinNormal(N025);
+    skinVertex(P025);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N025);
+    skinVertex(P025);
+    skinNormal(N066);
+    skinVertex(P066);
+    skinNormal(N026);
+    skinVertex(P026);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N066);
+    skinVertex(P066);
+    skinNormal(N058);
+    skinVertex(P058);
+    skinNormal(N016);
+    skinVertex(P016);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N015);
+    skinVertex(P015);
+    skinNormal(N058);
+    skinVertex(P058);
+    skinNormal(N066);
+    skinVertex(P066);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N058);
+    skinVertex(P058);
+    skinNormal(N015);
+    skinVertex(P015);
+    skinNormal(N016);
+    skinVertex(P016);
+    skinEnd();
 }
 
 void
 Fish007(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N062);
-    glVertex3fv(P062);
-    glNormal3fv(N022);
-    glVertex3fv(P022);
-    glNormal3fv(N032);
-    glVertex3fv(P032);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N062);
-    glVertex3fv(P062);
-    glNormal3fv(N032);
-    glVertex3fv(P032);
-    glNormal3fv(N064);
-    glVertex3fv(P064);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N022);
-    glVertex3fv(P022);
-    glNormal3fv(N062);
-    glVertex3fv(P062);
-    glNormal3fv(N032);
-    glVertex3fv(P032);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N062);
-    glVertex3fv(P062);
-    glNormal3fv(N064);
-    glVertex3fv(P064);
-    glNormal3fv(N032);
-    glVertex3fv(P032);
-    glEnd();
+    skinPolygon();
+    skinNormal(N062);
+    skinVertex(P062);
+    skinNormal(N022);
+    skinVertex(P022);
+    skinNormal(N032);
+    skinVertex(P032);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N062);
+    skinVertex(P062);
+    skinNormal(N032);
+    skinVertex(P032);
+    skinNormal(N064);
+    skinVertex(P064);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N022);
+    skinVertex(P022);
+    skinNormal(N062);
+    skinVertex(P062);
+    skinNormal(N032);
+    skinVertex(P032);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N062);
+    skinVertex(P062);
+    skinNormal(N064);
+    skinVertex(P064);
+    skinNormal(N032);
+    skinVertex(P032);
+    skinEnd();
 }
 
 void
 Fish008(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N063);
-    glVertex3fv(P063);
-    glNormal3fv(N019);
-    glVertex3fv(P019);
-    glNormal3fv(N029);
-    glVertex3fv(P029);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N019);
-    glVertex3fv(P019);
-    glNormal3fv(N063);
-    glVertex3fv(P063);
-    glNormal3fv(N029);
-    glVertex3fv(P029);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N063);
-    glVertex3fv(P063);
-    glNormal3fv(N029);
-    glVertex3fv(P029);
-    glNormal3fv(N065);
-    glVertex3fv(P065);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N063);
-    glVertex3fv(P063);
-    glNormal3fv(N065);
-    glVertex3fv(P065);
-    glNormal3fv(N029);
-    glVertex3fv(P029);
-    glEnd();
+    skinPolygon();
+    skinNormal(N063);
+    skinVertex(P063);
+    skinNormal(N019);
+    skinVertex(P019);
+    skinNormal(N029);
+    skinVertex(P029);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N019);
+    skinVertex(P019);
+    skinNormal(N063);
+    skinVertex(P063);
+    skinNormal(N029);
+    skinVertex(P029);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N063);
+    skinVertex(P063);
+    skinNormal(N029);
+    skinVertex(P029);
+    skinNormal(N065);
+    skinVertex(P065);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N063);
+    skinVertex(P063);
+    skinNormal(N065);
+    skinVertex(P065);
+    skinNormal(N029);
+    skinVertex(P029);
+    skinEnd();
 }
 
 void
 Fish009(void)
 {
-    glBegin(GL_POLYGON);
-    glVertex3fv(P059);
-    glVertex3fv(P012);
-    glVertex3fv(P009);
-    glVertex3fv(P060);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P012);
-    glVertex3fv(P004);
-    glVertex3fv(P007);
-    glVertex3fv(P009);
-    glEnd();
+    skinPolygon();
+    skinVertex(P059);
+    skinVertex(P012);
+    skinVertex(P009);
+    skinVertex(P060);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P012);
+    skinVertex(P004);
+    skinVertex(P007);
+    skinVertex(P009);
+    skinEnd();
 }
 
 void
-Fish_1(void)
+SharkModel(void)
 {
-    Fish004();
-    Fish005();
-    Fish003();
-    Fish007();
-    Fish006();
-    Fish002();
-    Fish008();
-    Fish009();
     Fish001();
-}
-
-void
-Fish_2(void)
-{
-    Fish005();
-    Fish004();
-    Fish003();
-    Fish008();
-    Fish006();
     Fish002();
-    Fish007();
-    Fish009();
-    Fish001();
-}
-
-void
-Fish_3(void)
-{
-    Fish005();
-    Fish004();
-    Fish007();
     Fish003();
-    Fish002();
-    Fish008();
-    Fish009();
-    Fish001();
-    Fish006();
-}
-
-void
-Fish_4(void)
-{
-    Fish005();
     Fish004();
-    Fish008();
-    Fish003();
-    Fish002();
-    Fish007();
-    Fish009();
-    Fish001();
-    Fish006();
-}
-
-void
-Fish_5(void)
-{
-    Fish009();
+    Fish005();
     Fish006();
     Fish007();
-    Fish001();
-    Fish002();
-    Fish003();
     Fish008();
-    Fish004();
-    Fish005();
-}
-
-void
-Fish_6(void)
-{
     Fish009();
-    Fish006();
-    Fish008();
-    Fish001();
-    Fish002();
-    Fish007();
-    Fish003();
-    Fish004();
-    Fish005();
 }
 
-void
-Fish_7(void)
-{
-    Fish009();
-    Fish001();
-    Fish007();
-    Fish005();
-    Fish002();
-    Fish008();
-    Fish003();
-    Fish004();
-    Fish006();
-}
+enum {
+    SHARK_JAW, SHARK_TAIL1, SHARK_TAIL2, SHARK_TAIL3, SHARK_TAIL4,
+    SHARK_BONES
+};
 
-void
-Fish_8(void)
-{
-    Fish009();
-    Fish008();
-    Fish001();
-    Fish002();
-    Fish007();
-    Fish003();
-    Fish005();
-    Fish004();
-    Fish006();
-}
+/* *INDENT-OFF* */
+#define BIND(n, bone, w) {P##n, iP##n, bone, w}
+static skinBind sharkBinds[] = {
+    BIND(004, SHARK_JAW, 1.0), BIND(007, SHARK_JAW, 1.0),
+    BIND(010, SHARK_JAW, 1.0), BIND(011, SHARK_JAW, 1.0),
+    BIND(023, SHARK_TAIL1, 1.0), BIND(024, SHARK_TAIL1, 1.0),
+    BIND(025, SHARK_TAIL1, 1.0), BIND(026, SHARK_TAIL1, 1.0),
+    BIND(027, SHARK_TAIL1, 1.0), BIND(028, SHARK_TAIL1, 1.0),
+    BIND(029, SHARK_TAIL1, 1.0), BIND(030, SHARK_TAIL1, 1.0),
+    BIND(031, SHARK_TAIL1, 1.0), BIND(032, SHARK_TAIL1, 1.0),
+    BIND(033, SHARK_TAIL2, 1.0), BIND(034, SHARK_TAIL2, 1.0),
+    BIND(035, SHARK_TAIL2, 1.0), BIND(036, SHARK_TAIL2, 1.0),
+    BIND(037, SHARK_TAIL2, 1.0), BIND(038, SHARK_TAIL2, 1.0),
+    BIND(039, SHARK_TAIL2, 1.0), BIND(040, SHARK_TAIL2, 1.0),
+    BIND(041, SHARK_TAIL2, 1.0), BIND(042, SHARK_TAIL2, 1.0),
+    BIND(043, SHARK_TAIL3, 1.0), BIND(044, SHARK_TAIL3, 1.0),
+    BIND(045, SHARK_TAIL3, 1.0), BIND(046, SHARK_TAIL3, 1.0),
+    BIND(047, SHARK_TAIL3, 1.0), BIND(048, SHARK_TAIL3, 1.0),
+    BIND(049, SHARK_TAIL3, 1.0), BIND(050, SHARK_TAIL3, 1.0),
+    BIND(051, SHARK_TAIL3, 1.0), BIND(052, SHARK_TAIL3, 1.0),
+    BIND(002, SHARK_TAIL4, 1.0), BIND(061, SHARK_TAIL4, 1.0),
+    BIND(069, SHARK_TAIL4, 1.0), BIND(070, SHARK_TAIL4, 1.0),
+};
+/* *INDENT-ON* */
 
 void
 DrawShark(fishRec * fish)
 {
-    float mat[4][4];
-    int n;
+    static skinMesh *mesh;
+    float bones[SHARK_BONES][3];
     float seg1, seg2, seg3, seg4, segup;
     float thrash, chomp;
 
+    if (!mesh) {
+        mesh = skinCapture(SharkModel, sharkBinds,
+            sizeof(sharkBinds) / sizeof(sharkBinds[0]), SHARK_BONES);
+        if (!mesh) {
+            fprintf(stderr, "atlantis: out of memory\n");
+            exit(1);
+        }
+    }
+
     fish->htail = (int) (fish->htail - (int) (5.0 * fish->v)) % 360;
 
     thrash = 50.0 * fish->v;
@@ -1174,45 +1119,6 @@ DrawShark(fishRec * fish)
     if (fish->v > 2.0) {
         chomp = -(fish->v - 2.0) * 200.0;
     }
-    P004[1] = iP004[1] + chomp;
-    P007[1] = iP007[1] + chomp;
-    P010[1] = iP010[1] + chomp;
-    P011[1] = iP011[1] + chomp;
-
-    P023[0] = iP023[0] + seg1;
-    P024[0] = iP024[0] + seg1;
-    P025[0] = iP025[0] + seg1;
-    P026[0] = iP026[0] + seg1;
-    P027[0] = iP027[0] + seg1;
-    P028[0] = iP028[0] + seg1;
-    P029[0] = iP029[0] + seg1;
-    P030[0] = iP030[0] + seg1;
-    P031[0] = iP031[0] + seg1;
-    P032[0] = iP032[0] + seg1;
-    P033[0] = iP033[0] + seg2;
-    P034[0] = iP034[0] + seg2;
-    P035[0] = iP035[0] + seg2;
-    P036[0] = iP036[0] + seg2;
-    P037[0] = iP037[0] + seg2;
-    P038[0] = iP038[0] + seg2;
-    P039[0] = iP039[0] + seg2;
-    P040[0] = iP040[0] + seg2;
-    P041[0] = iP041[0] + seg2;
-    P042[0] = iP042[0] + seg2;
-    P043[0] = iP043[0] + seg3;
-    P044[0] = iP044[0] + seg3;
-    P045[0] = iP045[0] + seg3;
-    P046[0] = iP046[0] + seg3;
-    P047[0] = iP047[0] + seg3;
-    P048[0] = iP048[0] + seg3;
-    P049[0] = iP049[0] + seg3;
-    P050[0] = iP050[0] + seg3;
-    P051[0] = iP051[0] + seg3;
-    P052[0] = iP052[0] + seg3;
-    P002[0] = iP002[0] + seg4;
-    P061[0] = iP061[0] + seg4;
-    P069[0] = iP069[0] + seg4;
-    P070[0] = iP070[0] + seg4;
 
     fish->vtail += ((fish->dtheta - fish->vtail) * 0.1);
 
@@ -1223,85 +1129,24 @@ DrawShark(fishRec * fish)
     }
     segup = thrash * fish->vtail;
 
-    P023[1] = iP023[1] + segup;
-    P024[1] = iP024[1] + segup;
-    P025[1] = iP025[1] + segup;
-    P026[1] = iP026[1] + segup;
-    P027[1] = iP027[1] + segup;
-    P028[1] = iP028[1] + segup;
-    P029[1] = iP029[1] + segup;
-    P030[1] = iP030[1] + segup;
-    P031[1] = iP031[1] + segup;
-    P032[1] = iP032[1] + segup;
-    P033[1] = iP033[1] + segup * 5.0;
-    P034[1] = iP034[1] + segup * 5.0;
-    P035[1] = iP035[1] + segup * 5.0;
-    P036[1] = iP036[1] + segup * 5.0;
-    P037[1] = iP037[1] + segup * 5.0;
-    P038[1] = iP038[1] + segup * 5.0;
-    P039[1] = iP039[1] + segup * 5.0;
-    P040[1] = iP040[1] + segup * 5.0;
-    P041[1] = iP041[1] + segup * 5.0;
-    P042[1] = iP042[1] + segup * 5.0;
-    P043[1] = iP043[1] + segup * 12.0;
-    P044[1] = iP044[1] + segup * 12.0;
-    P045[1] = iP045[1] + segup * 12.0;
-    P046[1] = iP046[1] + segup * 12.0;
-    P047[1] = iP047[1] + segup * 12.0;
-    P048[1] = iP048[1] + segup * 12.0;
-    P049[1] = iP049[1] + segup * 12.0;
-    P050[1] = iP050[1] + segup * 12.0;
-    P051[1] = iP051[1] + segup * 12.0;
-    P052[1] = iP052[1] + segup * 12.0;
-    P002[1] = iP002[1] + segup * 17.0;
-    P061[1] = iP061[1] + segup * 17.0;
-    P069[1] = iP069[1] + segup * 17.0;
-    P070[1] = iP070[1] + segup * 17.0;
+    memset(bones, 0, sizeof(bones));
+    bones[SHARK_JAW][1] = chomp;
+    bones[SHARK_TAIL1][0] = seg1;
+    bones[SHARK_TAIL1][1] = segup;
+    bones[SHARK_TAIL2][0] = seg2;
+    bones[SHARK_TAIL2][1] = segup * 5.0;
+    bones[SHARK_TAIL3][0] = seg3;
+    bones[SHARK_TAIL3][1] = segup * 12.0;
+    bones[SHARK_TAIL4][0] = seg4;
+    bones[SHARK_TAIL4][1] = segup * 17.0;
 
     glPushMatrix();
 
     glTranslatef(0.0, 0.0, -3000.0);
-
-    glGetFloatv(GL_MODELVIEW_MATRIX, &mat[0][0]);
-    n = 0;
-    if (mat[0][2] >= 0.0) {
-        n += 1;
-    }
-    if (mat[1][2] >= 0.0) {
-        n += 2;
-    }
-    if (mat[2][2] >= 0.0) {
-        n += 4;
-    }
     glScalef(2.0, 1.0, 1.0);
 
     glEnable(GL_CULL_FACE);
-    switch (n) {
-    case 0:
-        Fish_1();
-        break;
-    case 1:
-        Fish_2();
-        break;
-    case 2:
-        Fish_3();
-        break;
-    case 3:
-        Fish_4();
-        break;
-    case 4:
-        Fish_5();
-        break;
-    case 5:
-        Fish_6();
-        break;
-    case 6:
-        Fish_7();
-        break;
-    case 7:
-        Fish_8();
-        break;
-    }
+    skinDraw(mesh, bones);
     glDisable(GL_CULL_FACE);
 
     glPopMatrix();
@@ -0,0 +1,383 @@
+/*
+ *  skin.c
+ *
+ *  Skinned vertex-array meshes, see skin.h.
+ *
+ *  After capture the vertices are sorted so that the ones following the
+ *  same bone with the same weight are contiguous.  Bending a mesh is
+ *  then one translation per run of vertices: the positions are plain
+ *  xyz triples, so with SSE three registers holding the translation at
+ *  the three phases (x y z x, y z x y, z x y z) cover four vertices per
+ *  three adds.  Vertices that follow no bone are written once, when the
+ *  mesh is made.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <GL/glut.h>
+#include "skin.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define SKIN_SSE
+#include <xmmintrin.h>
+#endif
+
+
+/* vertices that follow one bone with one weight */
+typedef struct {
+  int first, count;
+  int bone;				/* numBones for no bone */
+  float weight;
+} SKrun;
+
+struct _skinMesh {
+  int numVertices;
+  float *rest;				/* unbent positions, xyz */
+  float *normal;			/* xyz */
+  float *position;			/* bent positions, xyz */
+
+  int numTriangles;
+  GLushort *index;
+
+  int numBones;
+  int numRuns;
+  SKrun *run;
+};
+
+
+/* model being captured */
+typedef struct {
+  float *p, *n;				/* arrays passed for the vertex */
+} SKkey;
+
+static SKkey *recKey;
+static int recNumKeys, recMaxKeys;
+static int *recHash;			/* keys by hash of p and n, -1 empty */
+static int recHashSize;
+static int *recIndex;
+static int recNumIndices, recMaxIndices;
+static float *recNormal;		/* current normal */
+static int recFirst, recPrev, recCount;	/* polygon being fanned */
+static int recFailed;
+
+static float defaultNormal[3] = {0.0, 0.0, 1.0};
+
+
+static void *
+grow(void *a, int *max, int size)
+{
+  void *b;
+
+  *max = *max ? *max * 2 : 256;
+  b = realloc(a, *max * size);
+  if (!b) {
+    free(a);
+    recFailed = 1;
+  }
+  return b;
+}
+
+
+/* Hash of a key; the arrays are at least 4-byte aligned */
+static unsigned int
+hashKey(const float *p, const float *n)
+{
+  unsigned long a = (unsigned long) p >> 2, b = (unsigned long) n >> 2;
+
+  return (unsigned int) (a * 2654435761UL ^ b * 40503UL);
+}
+
+
+/* Double the hash table and put the keys back in */
+static int
+rehash(void)
+{
+  int size = recHashSize ? recHashSize * 2 : 1024;
+  int i, k;
+
+  free(recHash);
+  recHash = (int *) malloc(size * sizeof(int));
+  if (!recHash) {
+    recFailed = 1;
+    return 0;
+  }
+  recHashSize = size;
+  for (i = 0; i < size; i++)
+    recHash[i] = -1;
+  for (k = 0; k < recNumKeys; k++) {
+    i = hashKey(recKey[k].p, recKey[k].n) & (size - 1);
+    while (recHash[i] >= 0)
+      i = (i + 1) & (size - 1);
+    recHash[i] = k;
+  }
+  return 1;
+}
+
+
+/* Free the tables of a capture */
+static void
+recFree(void)
+{
+  free(recKey);
+  free(recHash);
+  free(recIndex);
+  recKey = NULL;
+  recHash = NULL;
+  recIndex = NULL;
+  recMaxKeys = recHashSize = recMaxIndices = 0;
+}
+
+
+void
+skinPolygon(void)
+{
+  recCount = 0;
+}
+
+
+void
+skinNormal(float *n)
+{
+  recNormal = n;
+}
+
+
+void
+skinVertex(float *p)
+{
+  int h, k;
+
+  if (recFailed)
+    return;
+
+  /* kept at most half full */
+  if ((recNumKeys + 1) * 2 > recHashSize && !rehash())
+    return;
+  h = hashKey(p, recNormal) & (recHashSize - 1);
+  while ((k = recHash[h]) >= 0 &&
+	 (recKey[k].p != p || recKey[k].n != recNormal))
+    h = (h + 1) & (recHashSize - 1);
+  if (k < 0) {
+    if (recNumKeys == recMaxKeys) {
+      recKey = (SKkey *) grow(recKey, &recMaxKeys, sizeof(SKkey));
+      if (!recKey)
+	return;
+    }
+    k = recNumKeys++;
+    recKey[k].p = p;
+    recKey[k].n = recNormal;
+    recHash[h] = k;
+  }
+
+  /* a fan of triangles keeps the polygon's winding */
+  if (recCount == 0) {
+    recFirst = k;
+  } else if (recCount >= 2) {
+    if (recNumIndices + 3 > recMaxIndices) {
+      recIndex = (int *) grow(recIndex, &recMaxIndices, sizeof(int));
+      if (!recIndex)
+	return;
+    }
+    recIndex[recNumIndices++] = recFirst;
+    recIndex[recNumIndices++] = recPrev;
+    recIndex[recNumIndices++] = k;
+  }
+  recPrev = k;
+  recCount++;
+}
+
+
+void
+skinEnd(void)
+{
+  recCount = 0;
+}
+
+
+/* for sorting the vertices into runs */
+typedef struct {
+  int bone;
+  float weight;
+  int key;
+} SKsort;
+
+static int
+compareSort(const void *a, const void *b)
+{
+  const SKsort *s = (const SKsort *) a, *t = (const SKsort *) b;
+
+  if (s->bone != t->bone)
+    return s->bone - t->bone;
+  if (s->weight != t->weight)
+    return s->weight < t->weight ? -1 : 1;
+  return s->key - t->key;
+}
+
+
+skinMesh *
+skinCapture(void (*draw)(void), const skinBind *binds, int numBinds,
+	    int numBones)
+{
+  skinMesh *m;
+  SKsort *sort = NULL;
+  int *slot = NULL;
+  const float *p, *n;
+  int i, j, k;
+
+  recNumKeys = recNumIndices = 0;
+  recNormal = defaultNormal;
+  recCount = 0;
+  recFailed = 0;
+  draw();
+
+  m = (skinMesh *) calloc(1, sizeof(skinMesh));
+  if (recFailed || !m || recNumKeys > 65536)
+    goto fail;
+  m->numVertices = recNumKeys;
+  m->numTriangles = recNumIndices / 3;
+  m->numBones = numBones;
+  m->rest = (float *) malloc(recNumKeys * 3 * sizeof(float));
+  m->normal = (float *) malloc(recNumKeys * 3 * sizeof(float));
+  m->position = (float *) malloc(recNumKeys * 3 * sizeof(float));
+  m->index = (GLushort *) malloc((recNumIndices + 1) * sizeof(GLushort));
+  m->run = (SKrun *) malloc(recNumKeys * sizeof(SKrun));
+  sort = (SKsort *) malloc(recNumKeys * sizeof(SKsort));
+  slot = (int *) malloc(recNumKeys * sizeof(int));
+  if (!m->rest || !m->normal || !m->position || !m->index || !m->run ||
+      !sort || !slot)
+    goto fail;
+
+  for (k = 0; k < recNumKeys; k++) {
+    sort[k].bone = numBones;
+    sort[k].weight = 0.0;
+    sort[k].key = k;
+    for (j = 0; j < numBinds; j++)
+      if (binds[j].p == recKey[k].p) {
+	sort[k].bone = binds[j].bone;
+	sort[k].weight = binds[j].weight;
+	break;
+      }
+  }
+  qsort(sort, recNumKeys, sizeof(SKsort), compareSort);
+
+  for (i = 0; i < recNumKeys; i++) {
+    k = sort[i].key;
+    slot[k] = i;
+    p = recKey[k].p;
+    for (j = 0; j < numBinds; j++)
+      if (binds[j].p == p) {
+	p = binds[j].rest;
+	break;
+      }
+    n = recKey[k].n;
+    memcpy(&m->rest[i * 3], p, 3 * sizeof(float));
+    memcpy(&m->position[i * 3], p, 3 * sizeof(float));
+    memcpy(&m->normal[i * 3], n, 3 * sizeof(float));
+
+    if (i == 0 || sort[i].bone != sort[i - 1].bone ||
+	sort[i].weight != sort[i - 1].weight) {
+      m->run[m->numRuns].first = i;
+      m->run[m->numRuns].count = 0;
+      m->run[m->numRuns].bone = sort[i].bone;
+      m->run[m->numRuns].weight = sort[i].weight;
+      m->numRuns++;
+    }
+    m->run[m->numRuns - 1].count++;
+  }
+
+  for (i = 0; i < recNumIndices; i++)
+    m->index[i] = (GLushort) slot[recIndex[i]];
+
+  free(sort);
+  free(slot);
+  recFree();
+  return m;
+
+fail:
+  free(sort);
+  free(slot);
+  recFree();
+  skinDelete(m);
+  return NULL;
+}
+
+
+void
+skinDelete(skinMesh *m)
+{
+  if (!m)
+    return;
+  free(m->rest);
+  free(m->normal);
+  free(m->position);
+  free(m->index);
+  free(m->run);
+  free(m);
+}
+
+
+/* out = rest + t for n floats of xyz triples */
+static void
+translate(float *out, const float *rest, int n, const float t[3])
+{
+  int i = 0;
+#ifdef SKIN_SSE
+  __m128 a = _mm_setr_ps(t[0], t[1], t[2], t[0]);
+  __m128 b = _mm_setr_ps(t[1], t[2], t[0], t[1]);
+  __m128 c = _mm_setr_ps(t[2], t[0], t[1], t[2]);
+
+  for (; i + 12 <= n; i += 12) {
+    _mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(rest + i), a));
+    _mm_storeu_ps(out + i + 4, _mm_add_ps(_mm_loadu_ps(rest + i + 4), b));
+    _mm_storeu_ps(out + i + 8, _mm_add_ps(_mm_loadu_ps(rest + i + 8), c));
+  }
+#endif
+  for (; i < n; i += 3) {
+    out[i] = rest[i] + t[0];
+    out[i + 1] = rest[i + 1] + t[1];
+    out[i + 2] = rest[i + 2] + t[2];
+  }
+}
+
+
+void
+skinDraw(skinMesh *m, const float bones[][3])
+{
+  SKrun *r;
+  float t[3];
+  int i;
+
+  for (i = 0; i < m->numRuns; i++) {
+    r = &m->run[i];
+    if (r->bone >= m->numBones)
+      continue;
+    t[0] = r->weight * bones[r->bone][0];
+    t[1] = r->weight * bones[r->bone][1];
+    t[2] = r->weight * bones[r->bone][2];
+    translate(&m->position[r->first * 3], &m->rest[r->first * 3],
+	      r->count * 3, t);
+  }
+
+  glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+  glEnableClientState(GL_VERTEX_ARRAY);
+  glEnableClientState(GL_NORMAL_ARRAY);
+  glVertexPointer(3, GL_FLOAT, 0, m->position);
+  glNormalPointer(GL_FLOAT, 0, m->normal);
+  glDrawElements(GL_TRIANGLES, m->numTriangles * 3, GL_UNSIGNED_SHORT,
+		 m->index);
+  glPopClientAttrib();
+}
+
+
+int
+skinVertices(const skinMesh *m)
+{
+  return m->numVertices;
+}
+
+
+int
+skinTriangles(const skinMesh *m)
+{
+  return m->numTriangles;
+}
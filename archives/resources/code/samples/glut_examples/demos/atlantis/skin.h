@@ -0,0 +1,56 @@
+/*
+ *  skin.h
+ *
+ *  Skinned vertex-array meshes for the Atlantis creatures.
+ *
+ *  A model is still written as a list of polygons (the Fish00N(),
+ *  Whale00N() and Dolphin00N() functions), but instead of drawing them
+ *  every frame it is run once through skinCapture(), which records the
+ *  polygons into one indexed triangle list.  Vertices are shared between
+ *  polygons when they use the same position and normal arrays.
+ *
+ *  Bending is done with bones: each bone is a translation given per
+ *  instance, and each vertex follows at most one bone scaled by a weight.
+ *  Vertices that aren't bound to a bone stay put.  The mesh is shared by
+ *  every instance; skinDraw() bends it for one instance and draws it.
+ */
+
+#ifndef SKIN_H
+#define SKIN_H
+
+
+typedef struct _skinMesh skinMesh;
+
+/* A model vertex array and the bone it follows. */
+typedef struct {
+  float *p;				/* array passed to skinVertex() */
+  float *rest;				/* its unbent position */
+  int bone;
+  float weight;
+} skinBind;
+
+
+/* Run draw() to record a model.  The nbones bones move the vertices
+   listed in binds.  Returns NULL if out of memory. */
+extern skinMesh *skinCapture(void (*draw)(void),
+			     const skinBind *binds, int numBinds,
+			     int numBones);
+
+extern void skinDelete(skinMesh *m);
+
+/* What draw() calls in place of glBegin(GL_POLYGON), glNormal3fv(),
+   glVertex3fv() and glEnd(). */
+extern void skinPolygon(void);
+extern void skinNormal(float *n);
+extern void skinVertex(float *p);
+extern void skinEnd(void);
+
+/* Bend the mesh by bones[numBones][3] and draw it with vertex arrays.
+   No other GL state is changed. */
+extern void skinDraw(skinMesh *m, const float bones[][3]);
+
+extern int skinVertices(const skinMesh *m);
+extern int skinTriangles(const skinMesh *m);
+
+
+#endif /* SKIN_H */
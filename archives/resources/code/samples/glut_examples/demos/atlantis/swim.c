@@ -35,9 +35,9 @@
  * OpenGL(TM) is a trademark of Silicon Graphics, Inc.
  */
 #include <math.h>
-#include <stdlib.h>  /* For rand(). */
 #include <GL/glut.h>
 #include "atlantis.h"
+#include "school.h"
 
 void
 FishTransform(fishRec * fish)
@@ -62,127 +62,50 @@ WhalePilot(fishRec * fish)
     fish->z += WHALESPEED * fish->v * sin(fish->theta / RAD);
 }
 
+/* The sharks flock (see school.h): they head for the same spot the old
+   SharkPilot() chased and keep clear of each other as SharkMiss() did.
+   The school is made from the sharks the first time. */
 void
-SharkPilot(fishRec * fish)
+SharkSchool(void)
 {
-    static int sign = 1;
-    float X, Y, Z, tpsi, ttheta, thetal;
-
-    fish->xt = 60000.0;
-    fish->yt = 0.0;
-    fish->zt = 0.0;
-
-    X = fish->xt - fish->x;
-    Y = fish->yt - fish->y;
-    Z = fish->zt - fish->z;
-
-    thetal = fish->theta;
-
-    ttheta = RAD * atan(Z / (sqrt(X * X + Y * Y)));
-
-    if (ttheta > fish->theta + 0.25) {
-        fish->theta += 0.5;
-    } else if (ttheta < fish->theta - 0.25) {
-        fish->theta -= 0.5;
-    }
-    if (fish->theta > 90.0) {
-        fish->theta = 90.0;
-    }
-    if (fish->theta < -90.0) {
-        fish->theta = -90.0;
-    }
-    fish->dtheta = fish->theta - thetal;
-
-    tpsi = RAD * atan2(Y, X);
-
-    fish->attack = 0;
-
-    if (fabs(tpsi - fish->psi) < 10.0) {
-        fish->attack = 1;
-    } else if (fabs(tpsi - fish->psi) < 45.0) {
-        if (fish->psi > tpsi) {
-            fish->psi -= 0.5;
-            if (fish->psi < -180.0) {
-                fish->psi += 360.0;
-            }
-        } else if (fish->psi < tpsi) {
-            fish->psi += 0.5;
-            if (fish->psi > 180.0) {
-                fish->psi -= 360.0;
-            }
-        }
-    } else {
-        if (rand() % 100 > 98) {
-            sign = 1 - sign;
-        }
-        fish->psi += sign;
-        if (fish->psi > 180.0) {
-            fish->psi -= 360.0;
-        }
-        if (fish->psi < -180.0) {
-            fish->psi += 360.0;
+    static School *school;
+    float pos[3], vel[3], h, thetal;
+    fishRec *fish;
+    int i;
+
+    if (!school) {
+        school = schoolNew(numSharks, SHARKSIZE, SHARKSPEED, 1);
+        if (!school)
+            return;
+        schoolTarget(school, 60000.0, 0.0, 0.0);
+        for (i = 0; i < numSharks; i++) {
+            fish = &sharks[i];
+            pos[0] = fish->x;
+            pos[1] = fish->y;
+            pos[2] = fish->z;
+            vel[0] = SHARKSPEED * fish->v * cos(fish->psi / RAD) * cos(fish->theta / RAD);
+            vel[1] = SHARKSPEED * fish->v * sin(fish->psi / RAD) * cos(fish->theta / RAD);
+            vel[2] = SHARKSPEED * fish->v * sin(fish->theta / RAD);
+            schoolSet(school, i, pos, vel);
         }
     }
 
-    if (fish->attack) {
-        if (fish->v < 1.1) {
-            fish->spurt = 1;
-        }
-        if (fish->spurt) {
-            fish->v += 0.2;
-        }
-        if (fish->v > 5.0) {
-            fish->spurt = 0;
-        }
-        if ((fish->v > 1.0) && (!fish->spurt)) {
-            fish->v -= 0.2;
-        }
-    } else {
-        if (!(rand() % 400) && (!fish->spurt)) {
-            fish->spurt = 1;
-        }
-        if (fish->spurt) {
-            fish->v += 0.05;
-        }
-        if (fish->v > 3.0) {
-            fish->spurt = 0;
-        }
-        if ((fish->v > 1.0) && (!fish->spurt)) {
-            fish->v -= 0.05;
-        }
-    }
-
-    fish->x += SHARKSPEED * fish->v * cos(fish->psi / RAD) * cos(fish->theta / RAD);
-    fish->y += SHARKSPEED * fish->v * sin(fish->psi / RAD) * cos(fish->theta / RAD);
-    fish->z += SHARKSPEED * fish->v * sin(fish->theta / RAD);
-}
-
-void
-SharkMiss(int i)
-{
-    int j;
-    float avoid, thetal;
-    float X, Y, Z, R;
-
-    for (j = 0; j < NUM_SHARKS; j++) {
-        if (j != i) {
-            X = sharks[j].x - sharks[i].x;
-            Y = sharks[j].y - sharks[i].y;
-            Z = sharks[j].z - sharks[i].z;
-
-            R = sqrt(X * X + Y * Y + Z * Z);
-
-            avoid = 1.0;
-            thetal = sharks[i].theta;
-
-            if (R < SHARKSIZE) {
-                if (Z > 0.0) {
-                    sharks[i].theta -= avoid;
-                } else {
-                    sharks[i].theta += avoid;
-                }
-            }
-            sharks[i].dtheta += (sharks[i].theta - thetal);
-        }
+    schoolStep(school);
+
+    for (i = 0; i < numSharks; i++) {
+        fish = &sharks[i];
+        schoolGet(school, i, pos, vel);
+        fish->x = pos[0];
+        fish->y = pos[1];
+        fish->z = pos[2];
+        fish->xt = 60000.0;
+        fish->yt = 0.0;
+        fish->zt = 0.0;
+        h = sqrt(vel[0] * vel[0] + vel[1] * vel[1]);
+        thetal = fish->theta;
+        fish->psi = RAD * atan2(vel[1], vel[0]);
+        fish->theta = RAD * atan2(vel[2], h);
+        fish->dtheta = fish->theta - thetal;
+        fish->v = sqrt(h * h + vel[2] * vel[2]) / SHARKSPEED;
     }
 }
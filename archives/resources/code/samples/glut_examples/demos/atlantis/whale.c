@@ -34,9 +34,13 @@
  *
  * OpenGL(TM) is a trademark of Silicon Graphics, Inc.
  */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <GL/glut.h>
 #include <math.h>
 #include "atlantis.h"
+#include "skin.h"
 /* *INDENT-OFF* */
 static float N001[3] = {0.019249 ,0.011340 ,-0.999750};
 static float N002[3] = {-0.132579 ,0.954547 ,0.266952};
@@ -318,1360 +322,1437 @@ void
 Whale001(void)
 {
 
-    glBegin(GL_POLYGON);
-    glNormal3fv(N001);
-    glVertex3fv(P001);
-    glNormal3fv(N068);
-    glVertex3fv(P068);
-    glNormal3fv(N010);
-    glVertex3fv(P010);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N068);
-    glVertex3fv(P068);
-    glNormal3fv(N076);
-    glVertex3fv(P076);
-    glNormal3fv(N010);
-    glVertex3fv(P010);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N068);
-    glVertex3fv(P068);
-    glNormal3fv(N070);
-    glVertex3fv(P070);
-    glNormal3fv(N076);
-    glVertex3fv(P076);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N076);
-    glVertex3fv(P076);
-    glNormal3fv(N070);
-    glVertex3fv(P070);
-    glNormal3fv(N074);
-    glVertex3fv(P074);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N070);
-    glVertex3fv(P070);
-    glNormal3fv(N072);
-    glVertex3fv(P072);
-    glNormal3fv(N074);
-    glVertex3fv(P074);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N072);
-    glVertex3fv(P072);
-    glNormal3fv(N070);
-    glVertex3fv(P070);
-    glNormal3fv(N074);
-    glVertex3fv(P074);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N074);
-    glVertex3fv(P074);
-    glNormal3fv(N070);
-    glVertex3fv(P070);
-    glNormal3fv(N076);
-    glVertex3fv(P076);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N070);
-    glVertex3fv(P070);
-    glNormal3fv(N068);
-    glVertex3fv(P068);
-    glNormal3fv(N076);
-    glVertex3fv(P076);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N076);
-    glVertex3fv(P076);
-    glNormal3fv(N068);
-    glVertex3fv(P068);
-    glNormal3fv(N010);
-    glVertex3fv(P010);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N068);
-    glVertex3fv(P068);
-    glNormal3fv(N001);
-    glVertex3fv(P001);
-    glNormal3fv(N010);
-    glVertex3fv(P010);
-    glEnd();
+    skinPolygon();
+    skinNormal(N001);
+    skinVertex(P001);
+    skinNormal(N068);
+    skinVertex(P068);
+    skinNormal(N010);
+    skinVertex(P010);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N068);
+    skinVertex(P068);
+    skinNormal(N076);
+    skinVertex(P076);
+    skinNormal(N010);
+    skinVertex(P010);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N068);
+    skinVertex(P068);
+    skinNormal(N070);
+    skinVertex(P070);
+    skinNormal(N076);
+    skinVertex(P076);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N076);
+    skinVertex(P076);
+    skinNormal(N070);
+    skinVertex(P070);
+    skinNormal(N074);
+    skinVertex(P074);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N070);
+    skinVertex(P070);
+    skinNormal(N072);
+    skinVertex(P072);
+    skinNormal(N074);
+    skinVertex(P074);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N072);
+    skinVertex(P072);
+    skinNormal(N070);
+    skinVertex(P070);
+    skinNormal(N074);
+    skinVertex(P074);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N074);
+    skinVertex(P074);
+    skinNormal(N070);
+    skinVertex(P070);
+    skinNormal(N076);
+    skinVertex(P076);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N070);
+    skinVertex(P070);
+    skinNormal(N068);
+    skinVertex(P068);
+    skinNormal(N076);
+    skinVertex(P076);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N076);
+    skinVertex(P076);
+    skinNormal(N068);
+    skinVertex(P068);
+    skinNormal(N010);
+    skinVertex(P010);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N068);
+    skinVertex(P068);
+    skinNormal(N001);
+    skinVertex(P001);
+    skinNormal(N010);
+    skinVertex(P010);
+    skinEnd();
 }
 
 void
 Whale002(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N011);
-    glVertex3fv(P011);
-    glNormal3fv(N001);
-    glVertex3fv(P001);
-    glNormal3fv(N009);
-    glVertex3fv(P009);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N075);
-    glVertex3fv(P075);
-    glNormal3fv(N011);
-    glVertex3fv(P011);
-    glNormal3fv(N009);
-    glVertex3fv(P009);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N069);
-    glVertex3fv(P069);
-    glNormal3fv(N011);
-    glVertex3fv(P011);
-    glNormal3fv(N075);
-    glVertex3fv(P075);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N069);
-    glVertex3fv(P069);
-    glNormal3fv(N075);
-    glVertex3fv(P075);
-    glNormal3fv(N073);
-    glVertex3fv(P073);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N071);
-    glVertex3fv(P071);
-    glNormal3fv(N069);
-    glVertex3fv(P069);
-    glNormal3fv(N073);
-    glVertex3fv(P073);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N001);
-    glVertex3fv(P001);
-    glNormal3fv(N011);
-    glVertex3fv(P011);
-    glNormal3fv(N009);
-    glVertex3fv(P009);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N009);
-    glVertex3fv(P009);
-    glNormal3fv(N011);
-    glVertex3fv(P011);
-    glNormal3fv(N075);
-    glVertex3fv(P075);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N011);
-    glVertex3fv(P011);
-    glNormal3fv(N069);
-    glVertex3fv(P069);
-    glNormal3fv(N075);
-    glVertex3fv(P075);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N069);
-    glVertex3fv(P069);
-    glNormal3fv(N073);
-    glVertex3fv(P073);
-    glNormal3fv(N075);
-    glVertex3fv(P075);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N069);
-    glVertex3fv(P069);
-    glNormal3fv(N071);
-    glVertex3fv(P071);
-    glNormal3fv(N073);
-    glVertex3fv(P073);
-    glEnd();
+    skinPolygon();
+    skinNormal(N011);
+    skinVertex(P011);
+    skinNormal(N001);
+    skinVertex(P001);
+    skinNormal(N009);
+    skinVertex(P009);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N075);
+    skinVertex(P075);
+    skinNormal(N011);
+    skinVertex(P011);
+    skinNormal(N009);
+    skinVertex(P009);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N069);
+    skinVertex(P069);
+    skinNormal(N011);
+    skinVertex(P011);
+    skinNormal(N075);
+    skinVertex(P075);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N069);
+    skinVertex(P069);
+    skinNormal(N075);
+    skinVertex(P075);
+    skinNormal(N073);
+    skinVertex(P073);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N071);
+    skinVertex(P071);
+    skinNormal(N069);
+    skinVertex(P069);
+    skinNormal(N073);
+    skinVertex(P073);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N001);
+    skinVertex(P001);
+    skinNormal(N011);
+    skinVertex(P011);
+    skinNormal(N009);
+    skinVertex(P009);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N009);
+    skinVertex(P009);
+    skinNormal(N011);
+    skinVertex(P011);
+    skinNormal(N075);
+    skinVertex(P075);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N011);
+    skinVertex(P011);
+    skinNormal(N069);
+    skinVertex(P069);
+    skinNormal(N075);
+    skinVertex(P075);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N069);
+    skinVertex(P069);
+    skinNormal(N073);
+    skinVertex(P073);
+    skinNormal(N075);
+    skinVertex(P075);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N069);
+    skinVertex(P069);
+    skinNormal(N071);
+    skinVertex(P071);
+    skinNormal(N073);
+    skinVertex(P073);
+    skinEnd();
 }
 
 void
 Whale003(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N018);
-    glVertex3fv(P018);
-    glNormal3fv(N001);
-    glVertex3fv(P001);
-    glNormal3fv(N019);
-    glVertex3fv(P019);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N019);
-    glVertex3fv(P019);
-    glNormal3fv(N001);
-    glVertex3fv(P001);
-    glNormal3fv(N012);
-    glVertex3fv(P012);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N017);
-    glVertex3fv(P017);
-    glNormal3fv(N001);
-    glVertex3fv(P001);
-    glNormal3fv(N018);
-    glVertex3fv(P018);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N001);
-    glVertex3fv(P001);
-    glNormal3fv(N017);
-    glVertex3fv(P017);
-    glNormal3fv(N016);
-    glVertex3fv(P016);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N001);
-    glVertex3fv(P001);
-    glNormal3fv(N013);
-    glVertex3fv(P013);
-    glNormal3fv(N012);
-    glVertex3fv(P012);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N001);
-    glVertex3fv(P001);
-    glNormal3fv(N016);
-    glVertex3fv(P016);
-    glNormal3fv(N015);
-    glVertex3fv(P015);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N001);
-    glVertex3fv(P001);
-    glNormal3fv(N014);
-    glVertex3fv(P014);
-    glNormal3fv(N013);
-    glVertex3fv(P013);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N001);
-    glVertex3fv(P001);
-    glNormal3fv(N015);
-    glVertex3fv(P015);
-    glNormal3fv(N014);
-    glVertex3fv(P014);
-    glEnd();
+    skinPolygon();
+    skinNormal(N018);
+    skinVertex(P018);
+    skinNormal(N001);
+    skinVertex(P001);
+    skinNormal(N019);
+    skinVertex(P019);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N019);
+    skinVertex(P019);
+    skinNormal(N001);
+    skinVertex(P001);
+    skinNormal(N012);
+    skinVertex(P012);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N017);
+    skinVertex(P017);
+    skinNormal(N001);
+    skinVertex(P001);
+    skinNormal(N018);
+    skinVertex(P018);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N001);
+    skinVertex(P001);
+    skinNormal(N017);
+    skinVertex(P017);
+    skinNormal(N016);
+    skinVertex(P016);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N001);
+    skinVertex(P001);
+    skinNormal(N013);
+    skinVertex(P013);
+    skinNormal(N012);
+    skinVertex(P012);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N001);
+    skinVertex(P001);
+    skinNormal(N016);
+    skinVertex(P016);
+    skinNormal(N015);
+    skinVertex(P015);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N001);
+    skinVertex(P001);
+    skinNormal(N014);
+    skinVertex(P014);
+    skinNormal(N013);
+    skinVertex(P013);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N001);
+    skinVertex(P001);
+    skinNormal(N015);
+    skinVertex(P015);
+    skinNormal(N014);
+    skinVertex(P014);
+    skinEnd();
 }
 
 void
 Whale004(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N014);
-    glVertex3fv(P014);
-    glNormal3fv(N015);
-    glVertex3fv(P015);
-    glNormal3fv(N023);
-    glVertex3fv(P023);
-    glNormal3fv(N022);
-    glVertex3fv(P022);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N015);
-    glVertex3fv(P015);
-    glNormal3fv(N016);
-    glVertex3fv(P016);
-    glNormal3fv(N024);
-    glVertex3fv(P024);
-    glNormal3fv(N023);
-    glVertex3fv(P023);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N016);
-    glVertex3fv(P016);
-    glNormal3fv(N017);
-    glVertex3fv(P017);
-    glNormal3fv(N025);
-    glVertex3fv(P025);
-    glNormal3fv(N024);
-    glVertex3fv(P024);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N017);
-    glVertex3fv(P017);
-    glNormal3fv(N018);
-    glVertex3fv(P018);
-    glNormal3fv(N026);
-    glVertex3fv(P026);
-    glNormal3fv(N025);
-    glVertex3fv(P025);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N013);
-    glVertex3fv(P013);
-    glNormal3fv(N014);
-    glVertex3fv(P014);
-    glNormal3fv(N022);
-    glVertex3fv(P022);
-    glNormal3fv(N021);
-    glVertex3fv(P021);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N012);
-    glVertex3fv(P012);
-    glNormal3fv(N013);
-    glVertex3fv(P013);
-    glNormal3fv(N021);
-    glVertex3fv(P021);
-    glNormal3fv(N020);
-    glVertex3fv(P020);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N018);
-    glVertex3fv(P018);
-    glNormal3fv(N019);
-    glVertex3fv(P019);
-    glNormal3fv(N027);
-    glVertex3fv(P027);
-    glNormal3fv(N026);
-    glVertex3fv(P026);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N019);
-    glVertex3fv(P019);
-    glNormal3fv(N012);
-    glVertex3fv(P012);
-    glNormal3fv(N020);
-    glVertex3fv(P020);
-    glNormal3fv(N027);
-    glVertex3fv(P027);
-    glEnd();
+    skinPolygon();
+    skinNormal(N014);
+    skinVertex(P014);
+    skinNormal(N015);
+    skinVertex(P015);
+    skinNormal(N023);
+    skinVertex(P023);
+    skinNormal(N022);
+    skinVertex(P022);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N015);
+    skinVertex(P015);
+    skinNormal(N016);
+    skinVertex(P016);
+    skinNormal(N024);
+    skinVertex(P024);
+    skinNormal(N023);
+    skinVertex(P023);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N016);
+    skinVertex(P016);
+    skinNormal(N017);
+    skinVertex(P017);
+    skinNormal(N025);
+    skinVertex(P025);
+    skinNormal(N024);
+    skinVertex(P024);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N017);
+    skinVertex(P017);
+    skinNormal(N018);
+    skinVertex(P018);
+    skinNormal(N026);
+    skinVertex(P026);
+    skinNormal(N025);
+    skinVertex(P025);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N013);
+    skinVertex(P013);
+    skinNormal(N014);
+    skinVertex(P014);
+    skinNormal(N022);
+    skinVertex(P022);
+    skinNormal(N021);
+    skinVertex(P021);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N012);
+    skinVertex(P012);
+    skinNormal(N013);
+    skinVertex(P013);
+    skinNormal(N021);
+    skinVertex(P021);
+    skinNormal(N020);
+    skinVertex(P020);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N018);
+    skinVertex(P018);
+    skinNormal(N019);
+    skinVertex(P019);
+    skinNormal(N027);
+    skinVertex(P027);
+    skinNormal(N026);
+    skinVertex(P026);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N019);
+    skinVertex(P019);
+    skinNormal(N012);
+    skinVertex(P012);
+    skinNormal(N020);
+    skinVertex(P020);
+    skinNormal(N027);
+    skinVertex(P027);
+    skinEnd();
 }
 
 void
 Whale005(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N022);
-    glVertex3fv(P022);
-    glNormal3fv(N023);
-    glVertex3fv(P023);
-    glNormal3fv(N031);
-    glVertex3fv(P031);
-    glNormal3fv(N030);
-    glVertex3fv(P030);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N021);
-    glVertex3fv(P021);
-    glNormal3fv(N022);
-    glVertex3fv(P022);
-    glNormal3fv(N030);
-    glVertex3fv(P030);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N021);
-    glVertex3fv(P021);
-    glNormal3fv(N030);
-    glVertex3fv(P030);
-    glNormal3fv(N029);
-    glVertex3fv(P029);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N023);
-    glVertex3fv(P023);
-    glNormal3fv(N024);
-    glVertex3fv(P024);
-    glNormal3fv(N031);
-    glVertex3fv(P031);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N024);
-    glVertex3fv(P024);
-    glNormal3fv(N032);
-    glVertex3fv(P032);
-    glNormal3fv(N031);
-    glVertex3fv(P031);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N024);
-    glVertex3fv(P024);
-    glNormal3fv(N025);
-    glVertex3fv(P025);
-    glNormal3fv(N032);
-    glVertex3fv(P032);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N025);
-    glVertex3fv(P025);
-    glNormal3fv(N033);
-    glVertex3fv(P033);
-    glNormal3fv(N032);
-    glVertex3fv(P032);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N020);
-    glVertex3fv(P020);
-    glNormal3fv(N021);
-    glVertex3fv(P021);
-    glNormal3fv(N029);
-    glVertex3fv(P029);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N020);
-    glVertex3fv(P020);
-    glNormal3fv(N029);
-    glVertex3fv(P029);
-    glNormal3fv(N028);
-    glVertex3fv(P028);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N027);
-    glVertex3fv(P027);
-    glNormal3fv(N020);
-    glVertex3fv(P020);
-    glNormal3fv(N028);
-    glVertex3fv(P028);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N027);
-    glVertex3fv(P027);
-    glNormal3fv(N028);
-    glVertex3fv(P028);
-    glNormal3fv(N035);
-    glVertex3fv(P035);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N025);
-    glVertex3fv(P025);
-    glNormal3fv(N026);
-    glVertex3fv(P026);
-    glNormal3fv(N033);
-    glVertex3fv(P033);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N033);
-    glVertex3fv(P033);
-    glNormal3fv(N026);
-    glVertex3fv(P026);
-    glNormal3fv(N034);
-    glVertex3fv(P034);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N026);
-    glVertex3fv(P026);
-    glNormal3fv(N027);
-    glVertex3fv(P027);
-    glNormal3fv(N035);
-    glVertex3fv(P035);
-    glNormal3fv(N034);
-    glVertex3fv(P034);
-    glEnd();
+    skinPolygon();
+    skinNormal(N022);
+    skinVertex(P022);
+    skinNormal(N023);
+    skinVertex(P023);
+    skinNormal(N031);
+    skinVertex(P031);
+    skinNormal(N030);
+    skinVertex(P030);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N021);
+    skinVertex(P021);
+    skinNormal(N022);
+    skinVertex(P022);
+    skinNormal(N030);
+    skinVertex(P030);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N021);
+    skinVertex(P021);
+    skinNormal(N030);
+    skinVertex(P030);
+    skinNormal(N029);
+    skinVertex(P029);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N023);
+    skinVertex(P023);
+    skinNormal(N024);
+    skinVertex(P024);
+    skinNormal(N031);
+    skinVertex(P031);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N024);
+    skinVertex(P024);
+    skinNormal(N032);
+    skinVertex(P032);
+    skinNormal(N031);
+    skinVertex(P031);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N024);
+    skinVertex(P024);
+    skinNormal(N025);
+    skinVertex(P025);
+    skinNormal(N032);
+    skinVertex(P032);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N025);
+    skinVertex(P025);
+    skinNormal(N033);
+    skinVertex(P033);
+    skinNormal(N032);
+    skinVertex(P032);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N020);
+    skinVertex(P020);
+    skinNormal(N021);
+    skinVertex(P021);
+    skinNormal(N029);
+    skinVertex(P029);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N020);
+    skinVertex(P020);
+    skinNormal(N029);
+    skinVertex(P029);
+    skinNormal(N028);
+    skinVertex(P028);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N027);
+    skinVertex(P027);
+    skinNormal(N020);
+    skinVertex(P020);
+    skinNormal(N028);
+    skinVertex(P028);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N027);
+    skinVertex(P027);
+    skinNormal(N028);
+    skinVertex(P028);
+    skinNormal(N035);
+    skinVertex(P035);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N025);
+    skinVertex(P025);
+    skinNormal(N026);
+    skinVertex(P026);
+    skinNormal(N033);
+    skinVertex(P033);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N033);
+    skinVertex(P033);
+    skinNormal(N026);
+    skinVertex(P026);
+    skinNormal(N034);
+    skinVertex(P034);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N026);
+    skinVertex(P026);
+    skinNormal(N027);
+    skinVertex(P027);
+    skinNormal(N035);
+    skinVertex(P035);
+    skinNormal(N034);
+    skinVertex(P034);
+    skinEnd();
 }
 
 void
 Whale006(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N092);
-    glVertex3fv(P092);
-    glNormal3fv(N093);
-    glVertex3fv(P093);
-    glNormal3fv(N094);
-    glVertex3fv(P094);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N093);
-    glVertex3fv(P093);
-    glNormal3fv(N092);
-    glVertex3fv(P092);
-    glNormal3fv(N094);
-    glVertex3fv(P094);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N092);
-    glVertex3fv(P092);
-    glNormal3fv(N091);
-    glVertex3fv(P091);
-    glNormal3fv(N095);
-    glVertex3fv(P095);
-    glNormal3fv(N094);
-    glVertex3fv(P094);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N091);
-    glVertex3fv(P091);
-    glNormal3fv(N092);
-    glVertex3fv(P092);
-    glNormal3fv(N094);
-    glVertex3fv(P094);
-    glNormal3fv(N095);
-    glVertex3fv(P095);
-    glEnd();
+    skinPolygon();
+    skinNormal(N092);
+    skinVertex(P092);
+    skinNormal(N093);
+    skinVertex(P093);
+    skinNormal(N094);
+    skinVertex(P094);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N093);
+    skinVertex(P093);
+    skinNormal(N092);
+    skinVertex(P092);
+    skinNormal(N094);
+    skinVertex(P094);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N092);
+    skinVertex(P092);
+    skinNormal(N091);
+    skinVertex(P091);
+    skinNormal(N095);
+    skinVertex(P095);
+    skinNormal(N094);
+    skinVertex(P094);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N091);
+    skinVertex(P091);
+    skinNormal(N092);
+    skinVertex(P092);
+    skinNormal(N094);
+    skinVertex(P094);
+    skinNormal(N095);
+    skinVertex(P095);
+    skinEnd();
 }
 
 void
 Whale007(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N030);
-    glVertex3fv(P030);
-    glNormal3fv(N031);
-    glVertex3fv(P031);
-    glNormal3fv(N039);
-    glVertex3fv(P039);
-    glNormal3fv(N038);
-    glVertex3fv(P038);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N029);
-    glVertex3fv(P029);
-    glNormal3fv(N030);
-    glVertex3fv(P030);
-    glNormal3fv(N038);
-    glVertex3fv(P038);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N029);
-    glVertex3fv(P029);
-    glNormal3fv(N038);
-    glVertex3fv(P038);
-    glNormal3fv(N037);
-    glVertex3fv(P037);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N028);
-    glVertex3fv(P028);
-    glNormal3fv(N029);
-    glVertex3fv(P029);
-    glNormal3fv(N037);
-    glVertex3fv(P037);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N028);
-    glVertex3fv(P028);
-    glNormal3fv(N037);
-    glVertex3fv(P037);
-    glNormal3fv(N036);
-    glVertex3fv(P036);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N035);
-    glVertex3fv(P035);
-    glNormal3fv(N028);
-    glVertex3fv(P028);
-    glNormal3fv(N036);
-    glVertex3fv(P036);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N035);
-    glVertex3fv(P035);
-    glNormal3fv(N036);
-    glVertex3fv(P036);
-    glNormal3fv(N043);
-    glVertex3fv(P043);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N034);
-    glVertex3fv(P034);
-    glNormal3fv(N035);
-    glVertex3fv(P035);
-    glNormal3fv(N043);
-    glVertex3fv(P043);
-    glNormal3fv(N042);
-    glVertex3fv(P042);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N033);
-    glVertex3fv(P033);
-    glNormal3fv(N034);
-    glVertex3fv(P034);
-    glNormal3fv(N042);
-    glVertex3fv(P042);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N033);
-    glVertex3fv(P033);
-    glNormal3fv(N042);
-    glVertex3fv(P042);
-    glNormal3fv(N041);
-    glVertex3fv(P041);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N031);
-    glVertex3fv(P031);
-    glNormal3fv(N032);
-    glVertex3fv(P032);
-    glNormal3fv(N039);
-    glVertex3fv(P039);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N039);
-    glVertex3fv(P039);
-    glNormal3fv(N032);
-    glVertex3fv(P032);
-    glNormal3fv(N040);
-    glVertex3fv(P040);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N032);
-    glVertex3fv(P032);
-    glNormal3fv(N033);
-    glVertex3fv(P033);
-    glNormal3fv(N040);
-    glVertex3fv(P040);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N040);
-    glVertex3fv(P040);
-    glNormal3fv(N033);
-    glVertex3fv(P033);
-    glNormal3fv(N041);
-    glVertex3fv(P041);
-    glEnd();
+    skinPolygon();
+    skinNormal(N030);
+    skinVertex(P030);
+    skinNormal(N031);
+    skinVertex(P031);
+    skinNormal(N039);
+    skinVertex(P039);
+    skinNormal(N038);
+    skinVertex(P038);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N029);
+    skinVertex(P029);
+    skinNormal(N030);
+    skinVertex(P030);
+    skinNormal(N038);
+    skinVertex(P038);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N029);
+    skinVertex(P029);
+    skinNormal(N038);
+    skinVertex(P038);
+    skinNormal(N037);
+    skinVertex(P037);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N028);
+    skinVertex(P028);
+    skinNormal(N029);
+    skinVertex(P029);
+    skinNormal(N037);
+    skinVertex(P037);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N028);
+    skinVertex(P028);
+    skinNormal(N037);
+    skinVertex(P037);
+    skinNormal(N036);
+    skinVertex(P036);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N035);
+    skinVertex(P035);
+    skinNormal(N028);
+    skinVertex(P028);
+    skinNormal(N036);
+    skinVertex(P036);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N035);
+    skinVertex(P035);
+    skinNormal(N036);
+    skinVertex(P036);
+    skinNormal(N043);
+    skinVertex(P043);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N034);
+    skinVertex(P034);
+    skinNormal(N035);
+    skinVertex(P035);
+    skinNormal(N043);
+    skinVertex(P043);
+    skinNormal(N042);
+    skinVertex(P042);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N033);
+    skinVertex(P033);
+    skinNormal(N034);
+    skinVertex(P034);
+    skinNormal(N042);
+    skinVertex(P042);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N033);
+    skinVertex(P033);
+    skinNormal(N042);
+    skinVertex(P042);
+    skinNormal(N041);
+    skinVertex(P041);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N031);
+    skinVertex(P031);
+    skinNormal(N032);
+    skinVertex(P032);
+    skinNormal(N039);
+    skinVertex(P039);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N039);
+    skinVertex(P039);
+    skinNormal(N032);
+    skinVertex(P032);
+    skinNormal(N040);
+    skinVertex(P040);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N032);
+    skinVertex(P032);
+    skinNormal(N033);
+    skinVertex(P033);
+    skinNormal(N040);
+    skinVertex(P040);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N040);
+    skinVertex(P040);
+    skinNormal(N033);
+    skinVertex(P033);
+    skinNormal(N041);
+    skinVertex(P041);
+    skinEnd();
 }
 
 void
 Whale008(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N042);
-    glVertex3fv(P042);
-    glNormal3fv(N043);
-    glVertex3fv(P043);
-    glNormal3fv(N051);
-    glVertex3fv(P051);
-    glNormal3fv(N050);
-    glVertex3fv(P050);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N043);
-    glVertex3fv(P043);
-    glNormal3fv(N036);
-    glVertex3fv(P036);
-    glNormal3fv(N051);
-    glVertex3fv(P051);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N051);
-    glVertex3fv(P051);
-    glNormal3fv(N036);
-    glVertex3fv(P036);
-    glNormal3fv(N044);
-    glVertex3fv(P044);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N041);
-    glVertex3fv(P041);
-    glNormal3fv(N042);
-    glVertex3fv(P042);
-    glNormal3fv(N050);
-    glVertex3fv(P050);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N041);
-    glVertex3fv(P041);
-    glNormal3fv(N050);
-    glVertex3fv(P050);
-    glNormal3fv(N049);
-    glVertex3fv(P049);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N036);
-    glVertex3fv(P036);
-    glNormal3fv(N037);
-    glVertex3fv(P037);
-    glNormal3fv(N044);
-    glVertex3fv(P044);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N044);
-    glVertex3fv(P044);
-    glNormal3fv(N037);
-    glVertex3fv(P037);
-    glNormal3fv(N045);
-    glVertex3fv(P045);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N040);
-    glVertex3fv(P040);
-    glNormal3fv(N041);
-    glVertex3fv(P041);
-    glNormal3fv(N049);
-    glVertex3fv(P049);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N040);
-    glVertex3fv(P040);
-    glNormal3fv(N049);
-    glVertex3fv(P049);
-    glNormal3fv(N048);
-    glVertex3fv(P048);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N039);
-    glVertex3fv(P039);
-    glNormal3fv(N040);
-    glVertex3fv(P040);
-    glNormal3fv(N048);
-    glVertex3fv(P048);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N039);
-    glVertex3fv(P039);
-    glNormal3fv(N048);
-    glVertex3fv(P048);
-    glNormal3fv(N047);
-    glVertex3fv(P047);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N037);
-    glVertex3fv(P037);
-    glNormal3fv(N038);
-    glVertex3fv(P038);
-    glNormal3fv(N045);
-    glVertex3fv(P045);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N038);
-    glVertex3fv(P038);
-    glNormal3fv(N046);
-    glVertex3fv(P046);
-    glNormal3fv(N045);
-    glVertex3fv(P045);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N038);
-    glVertex3fv(P038);
-    glNormal3fv(N039);
-    glVertex3fv(P039);
-    glNormal3fv(N047);
-    glVertex3fv(P047);
-    glNormal3fv(N046);
-    glVertex3fv(P046);
-    glEnd();
+    skinPolygon();
+    skinNormal(N042);
+    skinVertex(P042);
+    skinNormal(N043);
+    skinVertex(P043);
+    skinNormal(N051);
+    skinVertex(P051);
+    skinNormal(N050);
+    skinVertex(P050);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N043);
+    skinVertex(P043);
+    skinNormal(N036);
+    skinVertex(P036);
+    skinNormal(N051);
+    skinVertex(P051);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N051);
+    skinVertex(P051);
+    skinNormal(N036);
+    skinVertex(P036);
+    skinNormal(N044);
+    skinVertex(P044);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N041);
+    skinVertex(P041);
+    skinNormal(N042);
+    skinVertex(P042);
+    skinNormal(N050);
+    skinVertex(P050);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N041);
+    skinVertex(P041);
+    skinNormal(N050);
+    skinVertex(P050);
+    skinNormal(N049);
+    skinVertex(P049);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N036);
+    skinVertex(P036);
+    skinNormal(N037);
+    skinVertex(P037);
+    skinNormal(N044);
+    skinVertex(P044);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N044);
+    skinVertex(P044);
+    skinNormal(N037);
+    skinVertex(P037);
+    skinNormal(N045);
+    skinVertex(P045);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N040);
+    skinVertex(P040);
+    skinNormal(N041);
+    skinVertex(P041);
+    skinNormal(N049);
+    skinVertex(P049);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N040);
+    skinVertex(P040);
+    skinNormal(N049);
+    skinVertex(P049);
+    skinNormal(N048);
+    skinVertex(P048);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N039);
+    skinVertex(P039);
+    skinNormal(N040);
+    skinVertex(P040);
+    skinNormal(N048);
+    skinVertex(P048);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N039);
+    skinVertex(P039);
+    skinNormal(N048);
+    skinVertex(P048);
+    skinNormal(N047);
+    skinVertex(P047);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N037);
+    skinVertex(P037);
+    skinNormal(N038);
+    skinVertex(P038);
+    skinNormal(N045);
+    skinVertex(P045);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N038);
+    skinVertex(P038);
+    skinNormal(N046);
+    skinVertex(P046);
+    skinNormal(N045);
+    skinVertex(P045);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N038);
+    skinVertex(P038);
+    skinNormal(N039);
+    skinVertex(P039);
+    skinNormal(N047);
+    skinVertex(P047);
+    skinNormal(N046);
+    skinVertex(P046);
+    skinEnd();
 }
 
 void
 Whale009(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N050);
-    glVertex3fv(P050);
-    glNormal3fv(N051);
-    glVertex3fv(P051);
-    glNormal3fv(N059);
-    glVertex3fv(P059);
-    glNormal3fv(N058);
-    glVertex3fv(P058);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N051);
-    glVertex3fv(P051);
-    glNormal3fv(N044);
-    glVertex3fv(P044);
-    glNormal3fv(N059);
-    glVertex3fv(P059);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N059);
-    glVertex3fv(P059);
-    glNormal3fv(N044);
-    glVertex3fv(P044);
-    glNormal3fv(N052);
-    glVertex3fv(P052);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N044);
-    glVertex3fv(P044);
-    glNormal3fv(N045);
-    glVertex3fv(P045);
-    glNormal3fv(N053);
-    glVertex3fv(P053);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N044);
-    glVertex3fv(P044);
-    glNormal3fv(N053);
-    glVertex3fv(P053);
-    glNormal3fv(N052);
-    glVertex3fv(P052);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N049);
-    glVertex3fv(P049);
-    glNormal3fv(N050);
-    glVertex3fv(P050);
-    glNormal3fv(N058);
-    glVertex3fv(P058);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N049);
-    glVertex3fv(P049);
-    glNormal3fv(N058);
-    glVertex3fv(P058);
-    glNormal3fv(N057);
-    glVertex3fv(P057);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N048);
-    glVertex3fv(P048);
-    glNormal3fv(N049);
-    glVertex3fv(P049);
-    glNormal3fv(N057);
-    glVertex3fv(P057);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N048);
-    glVertex3fv(P048);
-    glNormal3fv(N057);
-    glVertex3fv(P057);
-    glNormal3fv(N056);
-    glVertex3fv(P056);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N047);
-    glVertex3fv(P047);
-    glNormal3fv(N048);
-    glVertex3fv(P048);
-    glNormal3fv(N056);
-    glVertex3fv(P056);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N047);
-    glVertex3fv(P047);
-    glNormal3fv(N056);
-    glVertex3fv(P056);
-    glNormal3fv(N055);
-    glVertex3fv(P055);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N045);
-    glVertex3fv(P045);
-    glNormal3fv(N046);
-    glVertex3fv(P046);
-    glNormal3fv(N053);
-    glVertex3fv(P053);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N046);
-    glVertex3fv(P046);
-    glNormal3fv(N054);
-    glVertex3fv(P054);
-    glNormal3fv(N053);
-    glVertex3fv(P053);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N046);
-    glVertex3fv(P046);
-    glNormal3fv(N047);
-    glVertex3fv(P047);
-    glNormal3fv(N055);
-    glVertex3fv(P055);
-    glNormal3fv(N054);
-    glVertex3fv(P054);
-    glEnd();
+    skinPolygon();
+    skinNormal(N050);
+    skinVertex(P050);
+    skinNormal(N051);
+    skinVertex(P051);
+    skinNormal(N059);
+    skinVertex(P059);
+    skinNormal(N058);
+    skinVertex(P058);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N051);
+    skinVertex(P051);
+    skinNormal(N044);
+    skinVertex(P044);
+    skinNormal(N059);
+    skinVertex(P059);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N059);
+    skinVertex(P059);
+    skinNormal(N044);
+    skinVertex(P044);
+    skinNormal(N052);
+    skinVertex(P052);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N044);
+    skinVertex(P044);
+    skinNormal(N045);
+    skinVertex(P045);
+    skinNormal(N053);
+    skinVertex(P053);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N044);
+    skinVertex(P044);
+    skinNormal(N053);
+    skinVertex(P053);
+    skinNormal(N052);
+    skinVertex(P052);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N049);
+    skinVertex(P049);
+    skinNormal(N050);
+    skinVertex(P050);
+    skinNormal(N058);
+    skinVertex(P058);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N049);
+    skinVertex(P049);
+    skinNormal(N058);
+    skinVertex(P058);
+    skinNormal(N057);
+    skinVertex(P057);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N048);
+    skinVertex(P048);
+    skinNormal(N049);
+    skinVertex(P049);
+    skinNormal(N057);
+    skinVertex(P057);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N048);
+    skinVertex(P048);
+    skinNormal(N057);
+    skinVertex(P057);
+    skinNormal(N056);
+    skinVertex(P056);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N047);
+    skinVertex(P047);
+    skinNormal(N048);
+    skinVertex(P048);
+    skinNormal(N056);
+    skinVertex(P056);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N047);
+    skinVertex(P047);
+    skinNormal(N056);
+    skinVertex(P056);
+    skinNormal(N055);
+    skinVertex(P055);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N045);
+    skinVertex(P045);
+    skinNormal(N046);
+    skinVertex(P046);
+    skinNormal(N053);
+    skinVertex(P053);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N046);
+    skinVertex(P046);
+    skinNormal(N054);
+    skinVertex(P054);
+    skinNormal(N053);
+    skinVertex(P053);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N046);
+    skinVertex(P046);
+    skinNormal(N047);
+    skinVertex(P047);
+    skinNormal(N055);
+    skinVertex(P055);
+    skinNormal(N054);
+    skinVertex(P054);
+    skinEnd();
 }
 
 void
 Whale010(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N080);
-    glVertex3fv(P080);
-    glNormal3fv(N081);
-    glVertex3fv(P081);
-    glNormal3fv(N085);
-    glVertex3fv(P085);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N081);
-    glVertex3fv(P081);
-    glNormal3fv(N083);
-    glVertex3fv(P083);
-    glNormal3fv(N085);
-    glVertex3fv(P085);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N085);
-    glVertex3fv(P085);
-    glNormal3fv(N083);
-    glVertex3fv(P083);
-    glNormal3fv(N077);
-    glVertex3fv(P077);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N083);
-    glVertex3fv(P083);
-    glNormal3fv(N087);
-    glVertex3fv(P087);
-    glNormal3fv(N077);
-    glVertex3fv(P077);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N077);
-    glVertex3fv(P077);
-    glNormal3fv(N087);
-    glVertex3fv(P087);
-    glNormal3fv(N090);
-    glVertex3fv(P090);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N081);
-    glVertex3fv(P081);
-    glNormal3fv(N080);
-    glVertex3fv(P080);
-    glNormal3fv(N085);
-    glVertex3fv(P085);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N083);
-    glVertex3fv(P083);
-    glNormal3fv(N081);
-    glVertex3fv(P081);
-    glNormal3fv(N085);
-    glVertex3fv(P085);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N083);
-    glVertex3fv(P083);
-    glNormal3fv(N085);
-    glVertex3fv(P085);
-    glNormal3fv(N077);
-    glVertex3fv(P077);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N087);
-    glVertex3fv(P087);
-    glNormal3fv(N083);
-    glVertex3fv(P083);
-    glNormal3fv(N077);
-    glVertex3fv(P077);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N087);
-    glVertex3fv(P087);
-    glNormal3fv(N077);
-    glVertex3fv(P077);
-    glNormal3fv(N090);
-    glVertex3fv(P090);
-    glEnd();
+    skinPolygon();
+    skinNormal(N080);
+    skinVertex(P080);
+    skinNormal(N081);
+    skinVertex(P081);
+    skinNormal(N085);
+    skinVertex(P085);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N081);
+    skinVertex(P081);
+    skinNormal(N083);
+    skinVertex(P083);
+    skinNormal(N085);
+    skinVertex(P085);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N085);
+    skinVertex(P085);
+    skinNormal(N083);
+    skinVertex(P083);
+    skinNormal(N077);
+    skinVertex(P077);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N083);
+    skinVertex(P083);
+    skinNormal(N087);
+    skinVertex(P087);
+    skinNormal(N077);
+    skinVertex(P077);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N077);
+    skinVertex(P077);
+    skinNormal(N087);
+    skinVertex(P087);
+    skinNormal(N090);
+    skinVertex(P090);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N081);
+    skinVertex(P081);
+    skinNormal(N080);
+    skinVertex(P080);
+    skinNormal(N085);
+    skinVertex(P085);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N083);
+    skinVertex(P083);
+    skinNormal(N081);
+    skinVertex(P081);
+    skinNormal(N085);
+    skinVertex(P085);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N083);
+    skinVertex(P083);
+    skinNormal(N085);
+    skinVertex(P085);
+    skinNormal(N077);
+    skinVertex(P077);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N087);
+    skinVertex(P087);
+    skinNormal(N083);
+    skinVertex(P083);
+    skinNormal(N077);
+    skinVertex(P077);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N087);
+    skinVertex(P087);
+    skinNormal(N077);
+    skinVertex(P077);
+    skinNormal(N090);
+    skinVertex(P090);
+    skinEnd();
 }
 
 void
 Whale011(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N082);
-    glVertex3fv(P082);
-    glNormal3fv(N084);
-    glVertex3fv(P084);
-    glNormal3fv(N079);
-    glVertex3fv(P079);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N084);
-    glVertex3fv(P084);
-    glNormal3fv(N086);
-    glVertex3fv(P086);
-    glNormal3fv(N079);
-    glVertex3fv(P079);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N079);
-    glVertex3fv(P079);
-    glNormal3fv(N086);
-    glVertex3fv(P086);
-    glNormal3fv(N078);
-    glVertex3fv(P078);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N086);
-    glVertex3fv(P086);
-    glNormal3fv(N088);
-    glVertex3fv(P088);
-    glNormal3fv(N078);
-    glVertex3fv(P078);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N078);
-    glVertex3fv(P078);
-    glNormal3fv(N088);
-    glVertex3fv(P088);
-    glNormal3fv(N089);
-    glVertex3fv(P089);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N088);
-    glVertex3fv(P088);
-    glNormal3fv(N086);
-    glVertex3fv(P086);
-    glNormal3fv(N089);
-    glVertex3fv(P089);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N089);
-    glVertex3fv(P089);
-    glNormal3fv(N086);
-    glVertex3fv(P086);
-    glNormal3fv(N078);
-    glVertex3fv(P078);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N086);
-    glVertex3fv(P086);
-    glNormal3fv(N084);
-    glVertex3fv(P084);
-    glNormal3fv(N078);
-    glVertex3fv(P078);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N078);
-    glVertex3fv(P078);
-    glNormal3fv(N084);
-    glVertex3fv(P084);
-    glNormal3fv(N079);
-    glVertex3fv(P079);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N084);
-    glVertex3fv(P084);
-    glNormal3fv(N082);
-    glVertex3fv(P082);
-    glNormal3fv(N079);
-    glVertex3fv(P079);
-    glEnd();
+    skinPolygon();
+    skinNormal(N082);
+    skinVertex(P082);
+    skinNormal(N084);
+    skinVertex(P084);
+    skinNormal(N079);
+    skinVertex(P079);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N084);
+    skinVertex(P084);
+    skinNormal(N086);
+    skinVertex(P086);
+    skinNormal(N079);
+    skinVertex(P079);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N079);
+    skinVertex(P079);
+    skinNormal(N086);
+    skinVertex(P086);
+    skinNormal(N078);
+    skinVertex(P078);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N086);
+    skinVertex(P086);
+    skinNormal(N088);
+    skinVertex(P088);
+    skinNormal(N078);
+    skinVertex(P078);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N078);
+    skinVertex(P078);
+    skinNormal(N088);
+    skinVertex(P088);
+    skinNormal(N089);
+    skinVertex(P089);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N088);
+    skinVertex(P088);
+    skinNormal(N086);
+    skinVertex(P086);
+    skinNormal(N089);
+    skinVertex(P089);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N089);
+    skinVertex(P089);
+    skinNormal(N086);
+    skinVertex(P086);
+    skinNormal(N078);
+    skinVertex(P078);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N086);
+    skinVertex(P086);
+    skinNormal(N084);
+    skinVertex(P084);
+    skinNormal(N078);
+    skinVertex(P078);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N078);
+    skinVertex(P078);
+    skinNormal(N084);
+    skinVertex(P084);
+    skinNormal(N079);
+    skinVertex(P079);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N084);
+    skinVertex(P084);
+    skinNormal(N082);
+    skinVertex(P082);
+    skinNormal(N079);
+    skinVertex(P079);
+    skinEnd();
 }
 
 void
 Whale012(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N058);
-    glVertex3fv(P058);
-    glNormal3fv(N059);
-    glVertex3fv(P059);
-    glNormal3fv(N067);
-    glVertex3fv(P067);
-    glNormal3fv(N066);
-    glVertex3fv(P066);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N059);
-    glVertex3fv(P059);
-    glNormal3fv(N052);
-    glVertex3fv(P052);
-    glNormal3fv(N060);
-    glVertex3fv(P060);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N059);
-    glVertex3fv(P059);
-    glNormal3fv(N060);
-    glVertex3fv(P060);
-    glNormal3fv(N067);
-    glVertex3fv(P067);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N058);
-    glVertex3fv(P058);
-    glNormal3fv(N066);
-    glVertex3fv(P066);
-    glNormal3fv(N065);
-    glVertex3fv(P065);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N058);
-    glVertex3fv(P058);
-    glNormal3fv(N065);
-    glVertex3fv(P065);
-    glNormal3fv(N057);
-    glVertex3fv(P057);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N056);
-    glVertex3fv(P056);
-    glNormal3fv(N057);
-    glVertex3fv(P057);
-    glNormal3fv(N065);
-    glVertex3fv(P065);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N056);
-    glVertex3fv(P056);
-    glNormal3fv(N065);
-    glVertex3fv(P065);
-    glNormal3fv(N006);
-    glVertex3fv(P006);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N056);
-    glVertex3fv(P056);
-    glNormal3fv(N006);
-    glVertex3fv(P006);
-    glNormal3fv(N063);
-    glVertex3fv(P063);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N056);
-    glVertex3fv(P056);
-    glNormal3fv(N063);
-    glVertex3fv(P063);
-    glNormal3fv(N055);
-    glVertex3fv(P055);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N054);
-    glVertex3fv(P054);
-    glNormal3fv(N062);
-    glVertex3fv(P062);
-    glNormal3fv(N005);
-    glVertex3fv(P005);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N054);
-    glVertex3fv(P054);
-    glNormal3fv(N005);
-    glVertex3fv(P005);
-    glNormal3fv(N053);
-    glVertex3fv(P053);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N053);
-    glVertex3fv(P053);
-    glNormal3fv(N005);
-    glVertex3fv(P005);
-    glNormal3fv(N060);
-    glVertex3fv(P060);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N053);
-    glVertex3fv(P053);
-    glNormal3fv(N060);
-    glVertex3fv(P060);
-    glNormal3fv(N052);
-    glVertex3fv(P052);
-    glEnd();
+    skinPolygon();
+    skinNormal(N058);
+    skinVertex(P058);
+    skinNormal(N059);
+    skinVertex(P059);
+    skinNormal(N067);
+    skinVertex(P067);
+    skinNormal(N066);
+    skinVertex(P066);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N059);
+    skinVertex(P059);
+    skinNormal(N052);
+    skinVertex(P052);
+    skinNormal(N060);
+    skinVertex(P060);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N059);
+    skinVertex(P059);
+    skinNormal(N060);
+    skinVertex(P060);
+    skinNormal(N067);
+    skinVertex(P067);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N058);
+    skinVertex(P058);
+    skinNormal(N066);
+    skinVertex(P066);
+    skinNormal(N065);
+    skinVertex(P065);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N058);
+    skinVertex(P058);
+    skinNormal(N065);
+    skinVertex(P065);
+    skinNormal(N057);
+    skinVertex(P057);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N056);
+    skinVertex(P056);
+    skinNormal(N057);
+    skinVertex(P057);
+    skinNormal(N065);
+    skinVertex(P065);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N056);
+    skinVertex(P056);
+    skinNormal(N065);
+    skinVertex(P065);
+    skinNormal(N006);
+    skinVertex(P006);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N056);
+    skinVertex(P056);
+    skinNormal(N006);
+    skinVertex(P006);
+    skinNormal(N063);
+    skinVertex(P063);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N056);
+    skinVertex(P056);
+    skinNormal(N063);
+    skinVertex(P063);
+    skinNormal(N055);
+    skinVertex(P055);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N054);
+    skinVertex(P054);
+    skinNormal(N062);
+    skinVertex(P062);
+    skinNormal(N005);
+    skinVertex(P005);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N054);
+    skinVertex(P054);
+    skinNormal(N005);
+    skinVertex(P005);
+    skinNormal(N053);
+    skinVertex(P053);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N053);
+    skinVertex(P053);
+    skinNormal(N005);
+    skinVertex(P005);
+    skinNormal(N060);
+    skinVertex(P060);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N053);
+    skinVertex(P053);
+    skinNormal(N060);
+    skinVertex(P060);
+    skinNormal(N052);
+    skinVertex(P052);
+    skinEnd();
 }
 
 void
 Whale013(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N066);
-    glVertex3fv(P066);
-    glNormal3fv(N067);
-    glVertex3fv(P067);
-    glNormal3fv(N096);
-    glVertex3fv(P096);
-    glNormal3fv(N097);
-    glVertex3fv(P097);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N097);
-    glVertex3fv(P097);
-    glNormal3fv(N096);
-    glVertex3fv(P096);
-    glNormal3fv(N098);
-    glVertex3fv(P098);
-    glNormal3fv(N099);
-    glVertex3fv(P099);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N065);
-    glVertex3fv(P065);
-    glNormal3fv(N066);
-    glVertex3fv(P066);
-    glNormal3fv(N097);
-    glVertex3fv(P097);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N067);
-    glVertex3fv(P067);
-    glNormal3fv(N060);
-    glVertex3fv(P060);
-    glNormal3fv(N096);
-    glVertex3fv(P096);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N060);
-    glVertex3fv(P060);
-    glNormal3fv(N005);
-    glVertex3fv(P005);
-    glNormal3fv(N096);
-    glVertex3fv(P096);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N096);
-    glVertex3fv(P096);
-    glNormal3fv(N005);
-    glVertex3fv(P005);
-    glNormal3fv(N098);
-    glVertex3fv(P098);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N006);
-    glVertex3fv(P006);
-    glNormal3fv(N065);
-    glVertex3fv(P065);
-    glNormal3fv(N097);
-    glVertex3fv(P097);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N006);
-    glVertex3fv(P006);
-    glNormal3fv(N097);
-    glVertex3fv(P097);
-    glNormal3fv(N099);
-    glVertex3fv(P099);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P005);
-    glVertex3fv(P006);
-    glVertex3fv(P099);
-    glVertex3fv(P098);
-    glEnd();
+    skinPolygon();
+    skinNormal(N066);
+    skinVertex(P066);
+    skinNormal(N067);
+    skinVertex(P067);
+    skinNormal(N096);
+    skinVertex(P096);
+    skinNormal(N097);
+    skinVertex(P097);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N097);
+    skinVertex(P097);
+    skinNormal(N096);
+    skinVertex(P096);
+    skinNormal(N098);
+    skinVertex(P098);
+    skinNormal(N099);
+    skinVertex(P099);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N065);
+    skinVertex(P065);
+    skinNormal(N066);
+    skinVertex(P066);
+    skinNormal(N097);
+    skinVertex(P097);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N067);
+    skinVertex(P067);
+    skinNormal(N060);
+    skinVertex(P060);
+    skinNormal(N096);
+    skinVertex(P096);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N060);
+    skinVertex(P060);
+    skinNormal(N005);
+    skinVertex(P005);
+    skinNormal(N096);
+    skinVertex(P096);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N096);
+    skinVertex(P096);
+    skinNormal(N005);
+    skinVertex(P005);
+    skinNormal(N098);
+    skinVertex(P098);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N006);
+    skinVertex(P006);
+    skinNormal(N065);
+    skinVertex(P065);
+    skinNormal(N097);
+    skinVertex(P097);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N006);
+    skinVertex(P006);
+    skinNormal(N097);
+    skinVertex(P097);
+    skinNormal(N099);
+    skinVertex(P099);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P005);
+    skinVertex(P006);
+    skinVertex(P099);
+    skinVertex(P098);
+    skinEnd();
 }
 
 void
 Whale014(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N062);
-    glVertex3fv(P062);
-    glNormal3fv(N004);
-    glVertex3fv(P004);
-    glNormal3fv(N005);
-    glVertex3fv(P005);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P006);
-    glVertex3fv(P005);
-    glVertex3fv(P004);
-    glVertex3fv(P008);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N063);
-    glVertex3fv(P063);
-    glNormal3fv(N006);
-    glVertex3fv(P006);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glNormal3fv(N006);
-    glVertex3fv(P006);
-    glNormal3fv(N008);
-    glVertex3fv(P008);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glNormal3fv(N008);
-    glVertex3fv(P008);
-    glNormal3fv(N004);
-    glVertex3fv(P004);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N062);
-    glVertex3fv(P062);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glNormal3fv(N004);
-    glVertex3fv(P004);
-    glEnd();
+    skinPolygon();
+    skinNormal(N062);
+    skinVertex(P062);
+    skinNormal(N004);
+    skinVertex(P004);
+    skinNormal(N005);
+    skinVertex(P005);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P006);
+    skinVertex(P005);
+    skinVertex(P004);
+    skinVertex(P008);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N063);
+    skinVertex(P063);
+    skinNormal(N006);
+    skinVertex(P006);
+    skinNormal(N002);
+    skinVertex(P002);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N002);
+    skinVertex(P002);
+    skinNormal(N006);
+    skinVertex(P006);
+    skinNormal(N008);
+    skinVertex(P008);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N002);
+    skinVertex(P002);
+    skinNormal(N008);
+    skinVertex(P008);
+    skinNormal(N004);
+    skinVertex(P004);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N062);
+    skinVertex(P062);
+    skinNormal(N002);
+    skinVertex(P002);
+    skinNormal(N004);
+    skinVertex(P004);
+    skinEnd();
 }
 
 void
 Whale015(void)
 {
-    glBegin(GL_POLYGON);
-    glNormal3fv(N055);
-    glVertex3fv(P055);
-    glNormal3fv(N003);
-    glVertex3fv(P003);
-    glNormal3fv(N054);
-    glVertex3fv(P054);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N003);
-    glVertex3fv(P003);
-    glNormal3fv(N055);
-    glVertex3fv(P055);
-    glNormal3fv(N063);
-    glVertex3fv(P063);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N003);
-    glVertex3fv(P003);
-    glNormal3fv(N063);
-    glVertex3fv(P063);
-    glNormal3fv(N100);
-    glVertex3fv(P100);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N003);
-    glVertex3fv(P003);
-    glNormal3fv(N100);
-    glVertex3fv(P100);
-    glNormal3fv(N054);
-    glVertex3fv(P054);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N054);
-    glVertex3fv(P054);
-    glNormal3fv(N100);
-    glVertex3fv(P100);
-    glNormal3fv(N062);
-    glVertex3fv(P062);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N100);
-    glVertex3fv(P100);
-    glNormal3fv(N063);
-    glVertex3fv(P063);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glNormal3fv(N100);
-    glVertex3fv(P100);
-    glNormal3fv(N002);
-    glVertex3fv(P002);
-    glNormal3fv(N062);
-    glVertex3fv(P062);
-    glEnd();
+    skinPolygon();
+    skinNormal(N055);
+    skinVertex(P055);
+    skinNormal(N003);
+    skinVertex(P003);
+    skinNormal(N054);
+    skinVertex(P054);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N003);
+    skinVertex(P003);
+    skinNormal(N055);
+    skinVertex(P055);
+    skinNormal(N063);
+    skinVertex(P063);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N003);
+    skinVertex(P003);
+    skinNormal(N063);
+    skinVertex(P063);
+    skinNormal(N100);
+    skinVertex(P100);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N003);
+    skinVertex(P003);
+    skinNormal(N100);
+    skinVertex(P100);
+    skinNormal(N054);
+    skinVertex(P054);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N054);
+    skinVertex(P054);
+    skinNormal(N100);
+    skinVertex(P100);
+    skinNormal(N062);
+    skinVertex(P062);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N100);
+    skinVertex(P100);
+    skinNormal(N063);
+    skinVertex(P063);
+    skinNormal(N002);
+    skinVertex(P002);
+    skinEnd();
+    skinPolygon();
+    skinNormal(N100);
+    skinVertex(P100);
+    skinNormal(N002);
+    skinVertex(P002);
+    skinNormal(N062);
+    skinVertex(P062);
+    skinEnd();
 }
 
 void
 Whale016(void)
 {
-    glBegin(GL_POLYGON);
-    glVertex3fv(P104);
-    glVertex3fv(P105);
-    glVertex3fv(P106);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P107);
-    glVertex3fv(P108);
-    glVertex3fv(P109);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P110);
-    glVertex3fv(P111);
-    glVertex3fv(P112);
-    glVertex3fv(P113);
-    glVertex3fv(P114);
-    glVertex3fv(P115);
-    glEnd();
-    glBegin(GL_POLYGON);
-    glVertex3fv(P116);
-    glVertex3fv(P117);
-    glVertex3fv(P118);
-    glVertex3fv(P119);
-    glVertex3fv(P120);
-    glVertex3fv(P121);
-    glEnd();
+    skinPolygon();
+    skinVertex(P104);
+    skinVertex(P105);
+    skinVertex(P106);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P107);
+    skinVertex(P108);
+    skinVertex(P109);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P110);
+    skinVertex(P111);
+    skinVertex(P112);
+    skinVertex(P113);
+    skinVertex(P114);
+    skinVertex(P115);
+    skinEnd();
+    skinPolygon();
+    skinVertex(P116);
+    skinVertex(P117);
+    skinVertex(P118);
+    skinVertex(P119);
+    skinVertex(P120);
+    skinVertex(P121);
+    skinEnd();
 }
 
+void
+WhaleModel(void)
+{
+    Whale001();
+    Whale002();
+    Whale003();
+    Whale004();
+    Whale005();
+    Whale006();
+    Whale007();
+    Whale008();
+    Whale009();
+    Whale010();
+    Whale011();
+    Whale012();
+    Whale013();
+    Whale014();
+    Whale015();
+    Whale016();
+}
+
+enum {
+    WHALE_SEG0, WHALE_SEG1, WHALE_SEG2, WHALE_SEG3,
+    WHALE_SEG4, WHALE_SEG5, WHALE_SEG6, WHALE_SEG7, WHALE_CHOMP,
+    WHALE_BONES
+};
+
+/* *INDENT-OFF* */
+#define BIND(n, bone, w) {P##n, iP##n, bone, w}
+static skinBind whaleBinds[] = {
+    BIND(012, WHALE_SEG5, 1.0), BIND(013, WHALE_SEG5, 1.0),
+    BIND(014, WHALE_SEG5, 1.0), BIND(015, WHALE_SEG5, 1.0),
+    BIND(016, WHALE_SEG5, 1.0), BIND(017, WHALE_SEG5, 1.0),
+    BIND(018, WHALE_SEG5, 1.0), BIND(019, WHALE_SEG5, 1.0),
+    BIND(020, WHALE_SEG4, 1.0), BIND(021, WHALE_SEG4, 1.0),
+    BIND(022, WHALE_SEG4, 1.0), BIND(023, WHALE_SEG4, 1.0),
+    BIND(024, WHALE_SEG4, 1.0), BIND(025, WHALE_SEG4, 1.0),
+    BIND(026, WHALE_SEG4, 1.0), BIND(027, WHALE_SEG4, 1.0),
+    BIND(028, WHALE_SEG2, 1.0), BIND(029, WHALE_SEG2, 1.0),
+    BIND(030, WHALE_SEG2, 1.0), BIND(031, WHALE_SEG2, 1.0),
+    BIND(032, WHALE_SEG2, 1.0), BIND(033, WHALE_SEG2, 1.0),
+    BIND(034, WHALE_SEG2, 1.0), BIND(035, WHALE_SEG2, 1.0),
+    BIND(036, WHALE_SEG1, 1.0), BIND(037, WHALE_SEG1, 1.0),
+    BIND(038, WHALE_SEG1, 1.0), BIND(039, WHALE_SEG1, 1.0),
+    BIND(040, WHALE_SEG1, 1.0), BIND(041, WHALE_SEG1, 1.0),
+    BIND(042, WHALE_SEG1, 1.0), BIND(043, WHALE_SEG1, 1.0),
+    BIND(044, WHALE_SEG0, 1.0), BIND(045, WHALE_SEG0, 1.0),
+    BIND(046, WHALE_SEG0, 1.0), BIND(047, WHALE_SEG0, 1.0),
+    BIND(048, WHALE_SEG0, 1.0), BIND(049, WHALE_SEG0, 1.0),
+    BIND(050, WHALE_SEG0, 1.0), BIND(051, WHALE_SEG0, 1.0),
+    BIND(009, WHALE_SEG6, 1.0), BIND(010, WHALE_SEG6, 1.0),
+    BIND(075, WHALE_SEG6, 1.0), BIND(076, WHALE_SEG6, 1.0),
+    BIND(001, WHALE_SEG7, 1.0), BIND(011, WHALE_SEG7, 1.0),
+    BIND(068, WHALE_SEG7, 1.0), BIND(069, WHALE_SEG7, 1.0),
+    BIND(070, WHALE_SEG7, 1.0), BIND(071, WHALE_SEG7, 1.0),
+    BIND(072, WHALE_SEG7, 1.0), BIND(073, WHALE_SEG7, 1.0),
+    BIND(074, WHALE_SEG7, 1.0),
+    BIND(091, WHALE_SEG3, 1.1),
+    BIND(092, WHALE_SEG3, 1.0), BIND(093, WHALE_SEG3, 1.0),
+    BIND(094, WHALE_SEG3, 1.0),
+    BIND(095, WHALE_SEG3, 0.9),
+    BIND(096, WHALE_CHOMP, 1.0), BIND(097, WHALE_CHOMP, 1.0),
+    BIND(098, WHALE_CHOMP, 1.0), BIND(099, WHALE_CHOMP, 1.0),
+};
+/* *INDENT-ON* */
+
 void
 DrawWhale(fishRec * fish)
 {
     float seg0, seg1, seg2, seg3, seg4, seg5, seg6, seg7;
     float pitch, thrash, chomp;
+    static skinMesh *mesh;
+    float bones[WHALE_BONES][3];
+
+    if (!mesh) {
+        mesh = skinCapture(WhaleModel, whaleBinds,
+            sizeof(whaleBinds) / sizeof(whaleBinds[0]), WHALE_BONES);
+        if (!mesh) {
+            fprintf(stderr, "atlantis: out of memory\n");
+            exit(1);
+        }
+    }
 
     fish->htail = (int) (fish->htail - (int) (5.0 * fish->v)) % 360;
 
@@ -1692,76 +1773,17 @@ DrawWhale(fishRec * fish)
     if (fish->v > 2.0) {
         chomp = -(fish->v - 2.0) * 200.0;
     }
-    P012[1] = iP012[1] + seg5;
-    P013[1] = iP013[1] + seg5;
-    P014[1] = iP014[1] + seg5;
-    P015[1] = iP015[1] + seg5;
-    P016[1] = iP016[1] + seg5;
-    P017[1] = iP017[1] + seg5;
-    P018[1] = iP018[1] + seg5;
-    P019[1] = iP019[1] + seg5;
-
-    P020[1] = iP020[1] + seg4;
-    P021[1] = iP021[1] + seg4;
-    P022[1] = iP022[1] + seg4;
-    P023[1] = iP023[1] + seg4;
-    P024[1] = iP024[1] + seg4;
-    P025[1] = iP025[1] + seg4;
-    P026[1] = iP026[1] + seg4;
-    P027[1] = iP027[1] + seg4;
-
-    P028[1] = iP028[1] + seg2;
-    P029[1] = iP029[1] + seg2;
-    P030[1] = iP030[1] + seg2;
-    P031[1] = iP031[1] + seg2;
-    P032[1] = iP032[1] + seg2;
-    P033[1] = iP033[1] + seg2;
-    P034[1] = iP034[1] + seg2;
-    P035[1] = iP035[1] + seg2;
-
-    P036[1] = iP036[1] + seg1;
-    P037[1] = iP037[1] + seg1;
-    P038[1] = iP038[1] + seg1;
-    P039[1] = iP039[1] + seg1;
-    P040[1] = iP040[1] + seg1;
-    P041[1] = iP041[1] + seg1;
-    P042[1] = iP042[1] + seg1;
-    P043[1] = iP043[1] + seg1;
-
-    P044[1] = iP044[1] + seg0;
-    P045[1] = iP045[1] + seg0;
-    P046[1] = iP046[1] + seg0;
-    P047[1] = iP047[1] + seg0;
-    P048[1] = iP048[1] + seg0;
-    P049[1] = iP049[1] + seg0;
-    P050[1] = iP050[1] + seg0;
-    P051[1] = iP051[1] + seg0;
-
-    P009[1] = iP009[1] + seg6;
-    P010[1] = iP010[1] + seg6;
-    P075[1] = iP075[1] + seg6;
-    P076[1] = iP076[1] + seg6;
 
-    P001[1] = iP001[1] + seg7;
-    P011[1] = iP011[1] + seg7;
-    P068[1] = iP068[1] + seg7;
-    P069[1] = iP069[1] + seg7;
-    P070[1] = iP070[1] + seg7;
-    P071[1] = iP071[1] + seg7;
-    P072[1] = iP072[1] + seg7;
-    P073[1] = iP073[1] + seg7;
-    P074[1] = iP074[1] + seg7;
-
-    P091[1] = iP091[1] + seg3 * 1.1;
-    P092[1] = iP092[1] + seg3;
-    P093[1] = iP093[1] + seg3;
-    P094[1] = iP094[1] + seg3;
-    P095[1] = iP095[1] + seg3 * 0.9;
-
-    P099[1] = iP099[1] + chomp;
-    P098[1] = iP098[1] + chomp;
-    P097[1] = iP097[1] + chomp;
-    P096[1] = iP096[1] + chomp;
+    memset(bones, 0, sizeof(bones));
+    bones[WHALE_SEG0][1] = seg0;
+    bones[WHALE_SEG1][1] = seg1;
+    bones[WHALE_SEG2][1] = seg2;
+    bones[WHALE_SEG3][1] = seg3;
+    bones[WHALE_SEG4][1] = seg4;
+    bones[WHALE_SEG5][1] = seg5;
+    bones[WHALE_SEG6][1] = seg6;
+    bones[WHALE_SEG7][1] = seg7;
+    bones[WHALE_CHOMP][1] = chomp;
 
     glPushMatrix();
 
@@ -1775,22 +1797,7 @@ DrawWhale(fishRec * fish)
 
     glEnable(GL_CULL_FACE);
 
-    Whale001();
-    Whale002();
-    Whale003();
-    Whale004();
-    Whale005();
-    Whale006();
-    Whale007();
-    Whale008();
-    Whale009();
-    Whale010();
-    Whale011();
-    Whale012();
-    Whale013();
-    Whale014();
-    Whale015();
-    Whale016();
+    skinDraw(mesh, bones);
 
     glDisable(GL_CULL_FACE);
 
@@ -0,0 +1,304 @@
+/*
+ * gridbench.c - part of the chess demo in the glut distribution.
+ *
+ * Time gridpath.c without drawing anything.  First the chess board
+ * with its pieces set up, planned by gridpath and by the flood fill
+ * pathplan.c used to do, then square grids from 10x10 to 4096x4096
+ * with a fifth of their cells blocked at random.  Each plans routes
+ * between random open cells for at least a quarter of a second and
+ * prints the microseconds per route and the cells looked at.  On grids
+ * up to 256x256 every route is checked: each step goes to an open
+ * neighbour, and the cost is that of a cheapest route worked out
+ * another way.
+ *
+ * usage: gridbench [largest side]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "chess.h"
+#include "gridpath.h"
+
+#ifdef _WIN32
+#include <windows.h>
+typedef int timer;
+#define getTime(a)	(a = GetTickCount())
+#define timeDiff(a, b)	((b - a) * 1000)
+#else
+#include <sys/time.h>
+typedef struct timeval timer;
+#define getTime(a)	gettimeofday(&a, NULL)
+#define timeDiff(a, b)	(((b.tv_sec - a.tv_sec) * 1000000) + b.tv_usec - a.tv_usec)
+#endif
+
+#define CHECK_MAX 256	/* largest side checked */
+#define BATCH 64	/* routes planned per gridpath_batch() */
+
+int board[10][10];
+
+/* The flood fill pathplan.c did before gridpath.c, for comparison. */
+
+int path[10][10];
+int hops[10][10];
+int steps;
+int cur_hops;
+
+void init_board(void)
+{
+    int i,j;
+    for (i=0;i<10;i++)
+    {
+	for(j=0;j<10;j++)
+	{
+	    hops[i][j] = 0;
+	    path[i][j] = (board[i][j]?-1:0);
+	}
+    }
+}
+
+void test_exit(int i, int j, int dir)
+{
+    if (i<0 || i>9 || j<0 || j>9)
+	return;
+    if (path[i][j])
+	return;
+    steps ++;
+    path[i][j] = dir;
+    hops[i][j] = cur_hops + 1;
+}
+
+int flood_path(int x1, int y1, int x2, int y2)
+{
+    int i,j;
+    init_board();
+    path[x2][y2] = 9;
+    hops[x2][y2] = 1;
+    path[x1][y1] = 0;
+    cur_hops = 1;
+    for (;;)
+    {
+	steps = 0;
+	for (i=0;i<10;i++)
+	    for (j=0;j<10;j++)
+	    {
+		if (hops[i][j] != cur_hops)
+		    continue;
+		test_exit(i, j-1, SOUTH);
+		test_exit(i, j+1, NORTH);
+		test_exit(i-1, j, EAST);
+		test_exit(i+1, j, WEST);
+	    }
+	for (i=0;i<10;i++)
+	    for (j=0;j<10;j++)
+	    {
+		if (hops[i][j] != cur_hops)
+		    continue;
+		test_exit(i-1, j-1, SOUTHEAST);
+		test_exit(i+1, j-1, SOUTHWEST);
+		test_exit(i-1, j+1, NORTHEAST);
+		test_exit(i+1, j+1, NORTHWEST);
+	    }
+	cur_hops++;
+	if (path[x1][y1])
+	    return 1;
+	if (steps == 0)
+	    return 0;
+    }
+}
+
+/* The cost of a cheapest route from every cell to end, by relaxing
+ * every cell against its neighbours until nothing changes. */
+static void relax(int side, unsigned char *blocked, int end, int *cost)
+{
+    int n = side * side, changed, pass, i, k, x, y, c, dx, dy;
+
+    for (i = 0; i < n; i++)
+	cost[i] = -1;
+    cost[end] = 0;
+    for (pass = 0, changed = 1; changed; pass++)
+    {
+	changed = 0;
+	for (k = 0; k < n; k++)
+	{
+	    i = pass & 1 ? n - 1 - k : k;
+	    if (blocked[i] || i == end)
+		continue;
+	    x = i % side;
+	    y = i / side;
+	    for (dy = -1; dy <= 1; dy++)
+		for (dx = -1; dx <= 1; dx++)
+		{
+		    if ((!dx && !dy) || x + dx < 0 || x + dx >= side ||
+			y + dy < 0 || y + dy >= side)
+			continue;
+		    c = cost[i + dy * side + dx];
+		    if (c < 0)
+			continue;
+		    c += dx && dy ? GRIDPATH_DIAGONAL : GRIDPATH_STRAIGHT;
+		    if (cost[i] < 0 || c < cost[i])
+		    {
+			cost[i] = c;
+			changed = 1;
+		    }
+		}
+	}
+    }
+}
+
+/* Whether a route found with cost cost from start to end is right. */
+static int check(int side, unsigned char *blocked, int *route, int n,
+		 int start, int end, int cost, int *best)
+{
+    int i, dx, dy, c = 0;
+
+    relax(side, blocked, end, best);
+    if (cost != best[start])
+	return 0;
+    if (cost < 0)
+	return n == 0;
+    if (n < 1 || route[0] != start || route[n - 1] != end)
+	return 0;
+    for (i = 1; i < n; i++)
+    {
+	dx = route[i] % side - route[i - 1] % side;
+	dy = route[i] / side - route[i - 1] / side;
+	if (dx < -1 || dx > 1 || dy < -1 || dy > 1 || (!dx && !dy) ||
+	    blocked[route[i]])
+	    return 0;
+	c += dx && dy ? GRIDPATH_DIAGONAL : GRIDPATH_STRAIGHT;
+    }
+    return c == cost;
+}
+
+static void chess_board(void)
+{
+    int i;
+
+    for (i=1;i<=8;i++)
+    {
+	board[i][1] = board[i][2] = board[i][7] = board[i][8] = 1;
+    }
+}
+
+static void bench_chess(void)
+{
+    Gridpath *p = gridpath_new(10, 10);
+    int ends[4 * BATCH], first[BATCH + 1], cells[100 * BATCH];
+    int i, j, k, n;
+    long usec;
+    double ta, tf;
+    timer t0, t1;
+
+    chess_board();
+    for (i=0;i<10;i++)
+	for (j=0;j<10;j++)
+	    gridpath_block(p, i, j, board[i][j]);
+    /* every piece to a random open square */
+    srand(1);
+    for (k = 0; k < BATCH; k++)
+    {
+	ends[4 * k] = 1 + rand() % 8;
+	ends[4 * k + 1] = rand() % 2 ? 1 + rand() % 2 : 7 + rand() % 2;
+	do {
+	    ends[4 * k + 2] = rand() % 10;
+	    ends[4 * k + 3] = rand() % 10;
+	} while (board[ends[4 * k + 2]][ends[4 * k + 3]]);
+    }
+
+    n = 0;
+    getTime(t0);
+    do {
+	gridpath_batch(p, BATCH, ends, NULL, first, cells, 100 * BATCH);
+	n += BATCH;
+	getTime(t1);
+	usec = timeDiff(t0, t1);
+    } while (usec < 250000);
+    ta = (double) usec / n;
+
+    n = 0;
+    getTime(t0);
+    do {
+	for (k = 0; k < BATCH; k++)
+	{
+	    board[ends[4 * k]][ends[4 * k + 1]] = 0;
+	    flood_path(ends[4 * k], ends[4 * k + 1],
+		       ends[4 * k + 2], ends[4 * k + 3]);
+	    board[ends[4 * k]][ends[4 * k + 1]] = 1;
+	}
+	n += BATCH;
+	getTime(t1);
+	usec = timeDiff(t0, t1);
+    } while (usec < 250000);
+    tf = (double) usec / n;
+
+    printf("chess board: %.2f us per route, %.2f us with the old flood fill\n\n",
+	   ta, tf);
+    gridpath_free(p);
+}
+
+static void bench_grid(int side)
+{
+    Gridpath *p;
+    unsigned char *blocked;
+    int *route, *best = NULL, maxroute = 4 * side * side;
+    int i, n = side * side, start, end, cost, length;
+    int queries = 0, found = 0, bad = 0;
+    long usec = 0, visited = 0;
+    timer t0, t1;
+
+    p = gridpath_new(side, side);
+    blocked = (unsigned char *) malloc(n);
+    route = (int *) malloc(maxroute * sizeof(int));
+    if (side <= CHECK_MAX)
+	best = (int *) malloc(n * sizeof(int));
+    if (!p || !blocked || !route || (side <= CHECK_MAX && !best))
+    {
+	fprintf(stderr, "gridbench: Can't allocate a %dx%d grid.\n", side, side);
+	exit(1);
+    }
+    srand(side);
+    for (i = 0; i < n; i++)
+    {
+	blocked[i] = rand() % 5 == 0;
+	gridpath_block(p, i % side, i / side, blocked[i]);
+    }
+
+    while (queries < 4 || usec < 250000)
+    {
+	do {
+	    start = (int) ((double) rand() / RAND_MAX * (n - 1));
+	    end = (int) ((double) rand() / RAND_MAX * (n - 1));
+	} while (blocked[start] || blocked[end]);
+	getTime(t0);
+	cost = gridpath_find(p, start % side, start / side, end % side, end / side);
+	length = gridpath_route(p, route, maxroute);
+	getTime(t1);
+	usec += timeDiff(t0, t1);
+	visited += gridpath_visited(p);
+	queries++;
+	found += cost >= 0;
+	if (best && queries <= 20 &&
+	    !check(side, blocked, route, length, start, end, cost, best))
+	    bad++;
+    }
+    printf("%4dx%-4d %8d %7d %12.1f %12.0f %10.2f %8s\n", side, side,
+	   queries, found, (double) usec / queries, (double) visited / queries,
+	   usec ? visited / (double) usec : 0.0,
+	   !best ? "-" : bad ? "WRONG" : "ok");
+    gridpath_free(p);
+    free(blocked);
+    free(route);
+    free(best);
+}
+
+int main(int argc, char **argv)
+{
+    int side, largest = argc > 1 ? atoi(argv[1]) : 4096;
+
+    bench_chess();
+    printf("%9s %8s %7s %12s %12s %10s %8s\n", "grid", "routes", "found",
+	   "us/route", "cells/route", "cells/us", "checked");
+    for (side = 10; side <= largest; side = side < 16 ? 16 : side * 2)
+	bench_grid(side);
+    return 0;
+}
@@ -0,0 +1,259 @@
+/*
+ * gridpath.c - part of the chess demo in the glut distribution.
+ *
+ * A* search, see gridpath.h.  The estimate of the cost still to go is
+ * the octile distance, what it would cost with nothing in the way,
+ * so the first route to reach the end is a cheapest one.  Cells waiting
+ * to be looked at are kept in a binary heap by cost so far plus
+ * estimate, the deepest first among equals; a cell that gets cheaper
+ * is pushed again rather than moved, and the old entry is skipped when
+ * it comes up.
+ *
+ * Every cell carries the number of the search that last touched it:
+ * a cell with an older number hasn't been reached yet, so a new search
+ * only has to count up instead of clearing the grid.  Searches count by
+ * two, the odd number marking cells that are finished.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "gridpath.h"
+
+struct node
+{
+    int f, g, cell;
+};
+
+struct gridpath
+{
+    int w, h;
+    unsigned char *blocked;
+    unsigned char *from;	/* the step that reached each cell */
+    unsigned *stamp;		/* the search that last reached it */
+    int *g;			/* cost from the start */
+    unsigned search;
+    struct node *heap;
+    int heapn, heapmax;
+    int start, end;		/* of the last search, end -1 if no route */
+    int endx, endy;
+    long visited;
+};
+
+static int dx[8] = { 0, 0, -1, 1, -1, 1, -1, 1 };
+static int dy[8] = { -1, 1, 0, 0, -1, -1, 1, 1 };
+
+Gridpath *gridpath_new(int w, int h)
+{
+    Gridpath *p;
+    long n = (long) w * h;
+
+    p = (Gridpath *) calloc(1, sizeof(Gridpath));
+    if (!p)
+	return NULL;
+    p->w = w;
+    p->h = h;
+    p->blocked = (unsigned char *) calloc(n, 1);
+    p->from = (unsigned char *) malloc(n);
+    p->stamp = (unsigned *) calloc(n, sizeof(unsigned));
+    p->g = (int *) malloc(n * sizeof(int));
+    p->heapmax = 1024;
+    p->heap = (struct node *) malloc(p->heapmax * sizeof(struct node));
+    p->end = -1;
+    if (!p->blocked || !p->from || !p->stamp || !p->g || !p->heap)
+    {
+	gridpath_free(p);
+	return NULL;
+    }
+    return p;
+}
+
+void gridpath_free(Gridpath *p)
+{
+    if (!p)
+	return;
+    free(p->blocked);
+    free(p->from);
+    free(p->stamp);
+    free(p->g);
+    free(p->heap);
+    free(p);
+}
+
+void gridpath_block(Gridpath *p, int x, int y, int blocked)
+{
+    p->blocked[y * p->w + x] = blocked != 0;
+}
+
+static int estimate(Gridpath *p, int x, int y)
+{
+    x = abs(x - p->endx);
+    y = abs(y - p->endy);
+    if (x < y)
+	return GRIDPATH_STRAIGHT * y + (GRIDPATH_DIAGONAL - GRIDPATH_STRAIGHT) * x;
+    return GRIDPATH_STRAIGHT * x + (GRIDPATH_DIAGONAL - GRIDPATH_STRAIGHT) * y;
+}
+
+/* a comes out of the heap before b */
+#define BEFORE(a, b) ((a).f < (b).f || ((a).f == (b).f && (a).g > (b).g))
+
+static int push(Gridpath *p, int f, int g, int cell)
+{
+    struct node *heap = p->heap, n;
+    int i, up;
+
+    if (p->heapn == p->heapmax)
+    {
+	heap = (struct node *) realloc(heap, 2 * p->heapmax * sizeof(struct node));
+	if (!heap)
+	    return 0;
+	p->heap = heap;
+	p->heapmax *= 2;
+    }
+    n.f = f;
+    n.g = g;
+    n.cell = cell;
+    for (i = p->heapn++; i > 0; i = up)
+    {
+	up = (i - 1) / 2;
+	if (!BEFORE(n, heap[up]))
+	    break;
+	heap[i] = heap[up];
+    }
+    heap[i] = n;
+    return 1;
+}
+
+static struct node pop(Gridpath *p)
+{
+    struct node *heap = p->heap, top = heap[0], last;
+    int i, down, n = --p->heapn;
+
+    last = heap[n];
+    for (i = 0; (down = 2 * i + 1) < n; i = down)
+    {
+	if (down + 1 < n && BEFORE(heap[down + 1], heap[down]))
+	    down++;
+	if (!BEFORE(heap[down], last))
+	    break;
+	heap[i] = heap[down];
+    }
+    heap[i] = last;
+    return top;
+}
+
+int gridpath_find(Gridpath *p, int x1, int y1, int x2, int y2)
+{
+    struct node n;
+    unsigned open, done;
+    int d, x, y, next, g;
+
+    p->start = y1 * p->w + x1;
+    p->end = y2 * p->w + x2;
+    p->endx = x2;
+    p->endy = y2;
+    p->visited = 0;
+    p->heapn = 0;
+    if (x1 < 0 || x1 >= p->w || y1 < 0 || y1 >= p->h ||
+	x2 < 0 || x2 >= p->w || y2 < 0 || y2 >= p->h || p->blocked[p->end])
+    {
+	p->end = -1;
+	return -1;
+    }
+
+    p->search += 2;
+    if (p->search < 2)
+    {
+	/* counted all the way round, start again */
+	memset(p->stamp, 0, (size_t) p->w * p->h * sizeof(unsigned));
+	p->search = 2;
+    }
+    open = p->search;
+    done = open + 1;
+
+    p->stamp[p->start] = open;
+    p->g[p->start] = 0;
+    push(p, estimate(p, x1, y1), 0, p->start);
+    while (p->heapn > 0)
+    {
+	n = pop(p);
+	if (p->stamp[n.cell] == done || n.g != p->g[n.cell])
+	    continue;
+	p->stamp[n.cell] = done;
+	p->visited++;
+	if (n.cell == p->end)
+	    return n.g;
+
+	x = n.cell % p->w;
+	y = n.cell / p->w;
+	for (d = 0; d < 8; d++)
+	{
+	    if (x + dx[d] < 0 || x + dx[d] >= p->w ||
+		y + dy[d] < 0 || y + dy[d] >= p->h)
+		continue;
+	    next = n.cell + dy[d] * p->w + dx[d];
+	    if (p->blocked[next] || p->stamp[next] == done)
+		continue;
+	    g = n.g + (d < 4 ? GRIDPATH_STRAIGHT : GRIDPATH_DIAGONAL);
+	    if (p->stamp[next] == open && g >= p->g[next])
+		continue;
+	    p->stamp[next] = open;
+	    p->g[next] = g;
+	    p->from[next] = d;
+	    if (!push(p, g + estimate(p, x + dx[d], y + dy[d]), g, next))
+	    {
+		p->end = -1;
+		return -1;
+	    }
+	}
+    }
+    p->end = -1;
+    return -1;
+}
+
+int gridpath_route(Gridpath *p, int *cells, int max)
+{
+    int n, i, cell;
+
+    if (p->end < 0)
+	return 0;
+    n = 1;
+    for (cell = p->end; cell != p->start; n++)
+	cell -= dy[p->from[cell]] * p->w + dx[p->from[cell]];
+    cell = p->end;
+    for (i = n - 1; i >= 0; i--)
+    {
+	if (i < max)
+	    cells[i] = cell;
+	if (i > 0)
+	    cell -= dy[p->from[cell]] * p->w + dx[p->from[cell]];
+    }
+    return n;
+}
+
+long gridpath_visited(Gridpath *p)
+{
+    return p->visited;
+}
+
+int gridpath_batch(Gridpath *p, int n, const int *ends, int *costs,
+		   int *first, int *cells, int max)
+{
+    int i, cost, length, total = 0;
+
+    for (i = 0; i < n; i++)
+    {
+	first[i] = total;
+	cost = gridpath_find(p, ends[4 * i], ends[4 * i + 1],
+			     ends[4 * i + 2], ends[4 * i + 3]);
+	if (costs)
+	    costs[i] = cost;
+	if (cost < 0)
+	    continue;
+	length = gridpath_route(p, cells + total, max - total);
+	if (total + length > max)
+	    return -1;
+	total += length;
+    }
+    first[n] = total;
+    return total;
+}
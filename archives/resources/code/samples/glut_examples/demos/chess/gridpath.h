@@ -0,0 +1,49 @@
+/*
+ * gridpath.h - part of the chess demo in the glut distribution.
+ *
+ * Shortest routes across a grid of any size, some of whose cells are
+ * blocked, moving to any of the eight neighbouring cells.  A step
+ * along a row or column costs GRIDPATH_STRAIGHT and a diagonal step
+ * GRIDPATH_DIAGONAL.  A diagonal step may pass between two blocked
+ * cells, the way the chess pieces always have.
+ *
+ * One planner answers any number of queries; nothing is cleared
+ * between them, so a query only costs the cells it looks at.
+ */
+
+#ifndef GRIDPATH_H
+#define GRIDPATH_H
+
+#define GRIDPATH_STRAIGHT	10
+#define GRIDPATH_DIAGONAL	14
+
+typedef struct gridpath Gridpath;
+
+/* A w by h grid with nothing blocked; NULL if out of memory. */
+extern Gridpath *gridpath_new(int w, int h);
+extern void gridpath_free(Gridpath *p);
+
+extern void gridpath_block(Gridpath *p, int x, int y, int blocked);
+
+/* Find a cheapest route from (x1, y1) to (x2, y2), which must not be
+ * blocked (the start may be).  Returns its cost, or -1 if there is no
+ * route or no memory. */
+extern int gridpath_find(Gridpath *p, int x1, int y1, int x2, int y2);
+
+/* The cells of the route gridpath_find() last found, as x + y * w from
+ * the start to the end, at most max of them.  Returns the number of
+ * cells in the route, 0 if there was none. */
+extern int gridpath_route(Gridpath *p, int *cells, int max);
+
+/* Cells looked at by the last gridpath_find(). */
+extern long gridpath_visited(Gridpath *p);
+
+/* Find n routes, query i from (ends[4*i], ends[4*i+1]) to
+ * (ends[4*i+2], ends[4*i+3]).  Its cost goes in costs[i] (unless costs
+ * is NULL) and its cells in cells[first[i]] up to cells[first[i+1]],
+ * none if there is no route.  Returns the number of cells, or -1 if
+ * that would be more than max. */
+extern int gridpath_batch(Gridpath *p, int n, const int *ends, int *costs,
+			  int *first, int *cells, int max);
+
+#endif /* GRIDPATH_H */
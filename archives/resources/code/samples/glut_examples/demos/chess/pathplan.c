@@ -8,78 +8,39 @@
  */
 
 #include "chess.h"
+#include "gridpath.h"
 
 extern int board[10][10];
 
 int path[10][10];
-int hops[10][10];
 
-int steps;
-int cur_hops;
+static Gridpath *planner;
 
-void init_board(void)
+/* direction of the step to (x + dx, y + dy), by [dy + 1][dx + 1] */
+static int step[3][3] =
 {
-    int i,j;
-    for (i=0;i<10;i++)
-    {
-	for(j=0;j<10;j++)
-	{
-	    hops[i][j] = 0;
-	    path[i][j] = (board[i][j]?-1:0);
-	}
-    }
-}
-
-void test_exit(int i, int j, int dir)
-{
-    if (i<0 || i>9 || j<0 || j>9)
-	return;
-    if (path[i][j])
-	return;
-    steps ++;
-    path[i][j] = dir;
-    hops[i][j] = cur_hops + 1;
-}
+    { NORTHWEST, NORTH, NORTHEAST },
+    { WEST, 0, EAST },
+    { SOUTHWEST, SOUTH, SOUTHEAST }
+};
 
 int solve_path(int x1, int y1, int x2, int y2)
 {
-    int i,j;
-    init_board();
-    path[x2][y2] = 9;
-    hops[x2][y2] = 1;
+    int route[100], n, i, j;
+
     path[x1][y1] = 0;
-    cur_hops = 1;
-    for (;;)
-    {
-	steps = 0;
-	for (i=0;i<10;i++)
-	{
-	    for (j=0;j<10;j++)
-	    {
-		if (hops[i][j] != cur_hops)
-		    continue;
-		test_exit(i, j-1, SOUTH);
-		test_exit(i, j+1, NORTH);
-		test_exit(i-1, j, EAST);
-		test_exit(i+1, j, WEST);
-	    }
-	}
-	for (i=0;i<10;i++)
-	{
-	    for (j=0;j<10;j++)
-	    {
-		if (hops[i][j] != cur_hops)
-		    continue;
-		test_exit(i-1, j-1, SOUTHEAST);
-		test_exit(i+1, j-1, SOUTHWEST);
-		test_exit(i-1, j+1, NORTHEAST);
-		test_exit(i+1, j+1, NORTHWEST);
-	    }
-	}
-	cur_hops++;
-	if (path[x1][y1])
-	    return 1;
-	if (steps == 0)
-	    return 0;
-    }
+    if (!planner)
+	planner = gridpath_new(10, 10);
+    if (!planner)
+	return 0;
+    for (i=0;i<10;i++)
+	for (j=0;j<10;j++)
+	    gridpath_block(planner, i, j, board[i][j]);
+    if (gridpath_find(planner, x1, y1, x2, y2) < 0)
+	return 0;
+    n = gridpath_route(planner, route, 100);
+    for (i=0;i<n-1;i++)
+	path[route[i]%10][route[i]/10] =
+	    step[route[i+1]/10 - route[i]/10 + 1][route[i+1]%10 - route[i]%10 + 1];
+    return 1;
 }
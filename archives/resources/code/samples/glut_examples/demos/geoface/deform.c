@@ -0,0 +1,439 @@
+/* ==========================================================================
+                               DEFORM_C
+=============================================================================
+
+    FUNCTION NAMES
+
+    make_deform 	-- work out every muscle's influence, once.
+    deform_muscle 	-- set the contraction of one muscle.
+    deform_expression 	-- set the muscles to a blend of expressions.
+    deform_reset 	-- relax all the muscles.
+    deform_free 	-- free the influences.
+
+    C SPECIFICATIONS
+
+    DEFORM *make_deform ( HEAD *face )
+    void deform_muscle 	( HEAD *face, int m, float val )
+    void deform_expression ( HEAD *face, float *weight )
+    void deform_reset 	( HEAD *face )
+    void deform_free 	( HEAD *face )
+
+    DESCRIPTION
+
+	activate_muscle() in muscle.c tests every vertex of every polygon
+	against the muscle each time it is pulled, and each polygon has
+	its own copies of its vertices, so a vertex is tested and moved
+	once for each polygon it belongs to.  Here the copies are welded
+	into one vertex apiece, and the neutral vertices are put in a
+	grid so that a muscle only tests the ones in the cells its
+	sphere of influence overlaps.  For those inside its cone the move
+	activate_muscle() would give them from neutral at a contraction
+	of 1.0 is kept, so setting a muscle's contraction is a sum over
+	just those vertices, weighted by how much the contraction
+	changed.  Only the muscles whose contraction changes cost
+	anything, and only the vertices that moved are copied back into
+	the polygons.
+
+	The moves are worked out from the neutral face, so contractions
+	add up: pulling a muscle twice by 0.1 is the same as pulling it
+	once by 0.2, and the same as from neutral, which
+	activate_muscle() only is for small pulls.
+
+    HISTORY
+	Added the influences, to replace act_muscles() for the keys and
+	the expressions.
+
+============================================================================ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "memory.h"
+#include "head.h"
+
+#define DTOR(deg) ((deg)*0.017453292)	/* degrees to radians   */
+
+typedef struct GRID {
+
+  float lo[3]         ;    /* corner of the grid                         */
+  float size          ;    /* side of a cell                             */
+  int   n[3]          ;    /* cells along each axis                      */
+  int  *start         ;    /* each cell's vertices, start[c]..start[c+1] */
+  int  *vert          ;
+
+} GRID ;
+
+static float *sort_xyz ;   /* for compare_xyz */
+
+/* ======================================================================== */
+/* compare_xyz ( a, b )							    */
+/* ======================================================================== */
+/*
+** Order polygon vertices by position, for qsort.
+*/
+
+static int compare_xyz ( const void *a, const void *b )
+{
+  float *p = sort_xyz + 3 * *(int *)a, *q = sort_xyz + 3 * *(int *)b ;
+  int k ;
+
+  for (k=0; k<3; k++) {
+    if ( p[k] < q[k] ) return -1 ;
+    if ( p[k] > q[k] ) return  1 ;
+  }
+  return 0 ;
+}
+
+/* ======================================================================== */
+/* weld ( face, d )							    */
+/* ======================================================================== */
+/*
+** Find the distinct vertices among the polygons' copies.
+*/
+
+static void weld ( HEAD *face, DEFORM *d )
+{
+  int ncopies = face->npolygons * 3, *order, i, k, n ;
+  float *xyz ;
+
+  xyz   = _new_array ( float, ncopies * 3 ) ;
+  order = _new_array ( int, ncopies ) ;
+  for (i=0; i<ncopies; i++) {
+    for (k=0; k<3; k++)
+      xyz[i*3+k] = face->polygon[i/3]->vertex[i%3]->nxyz[k] ;
+    order[i] = i ;
+  }
+  sort_xyz = xyz ;
+  qsort ( order, ncopies, sizeof(int), compare_xyz ) ;
+
+  d->rest  = _new_array ( float, ncopies * 3 ) ;
+  d->first = _new_array ( int, ncopies + 1 ) ;
+  d->copy  = _new_array ( VERTEX *, ncopies ) ;
+
+  for (i=0, n=0; i<ncopies; i++) {
+    if ( i == 0 || compare_xyz ( &order[i-1], &order[i] ) ) {
+      for (k=0; k<3; k++)
+	d->rest[n*3+k] = xyz[order[i]*3+k] ;
+      d->first[n++] = i ;
+    }
+    d->copy[i] = face->polygon[order[i]/3]->vertex[order[i]%3] ;
+  }
+  d->first[n] = ncopies ;
+  d->nverts   = n ;
+
+  _delete ( xyz ) ;
+  _delete ( order ) ;
+}
+
+/* ======================================================================== */
+/* make_grid ( d, g )							    */
+/* ======================================================================== */
+/*
+** Bucket the neutral vertices into cubes, about two to a cube.
+*/
+
+static void make_grid ( DEFORM *d, GRID *g )
+{
+  float hi[3], volume ;
+  int i, k, c, ncells, *cell ;
+
+  for (k=0; k<3; k++)
+    g->lo[k] = hi[k] = d->rest[k] ;
+  for (i=1; i<d->nverts; i++)
+    for (k=0; k<3; k++) {
+      if ( d->rest[i*3+k] < g->lo[k] ) g->lo[k] = d->rest[i*3+k] ;
+      if ( d->rest[i*3+k] > hi[k] )    hi[k]    = d->rest[i*3+k] ;
+    }
+
+  volume = 1.0 ;
+  for (k=0; k<3; k++)
+    volume *= hi[k] - g->lo[k] + 1e-3 ;
+  g->size = pow ( 2.0 * volume / d->nverts, 1.0/3.0 ) ;
+
+  ncells = 1 ;
+  for (k=0; k<3; k++) {
+    g->n[k] = (int) ((hi[k] - g->lo[k]) / g->size) + 1 ;
+    ncells *= g->n[k] ;
+  }
+
+  /* count the vertices in each cell, then lay them out by cell */
+  cell     = _new_array ( int, d->nverts ) ;
+  g->start = _new_array ( int, ncells + 1 ) ;
+  g->vert  = _new_array ( int, d->nverts ) ;
+  for (c=0; c<=ncells; c++)
+    g->start[c] = 0 ;
+  for (i=0; i<d->nverts; i++) {
+    c = 0 ;
+    for (k=2; k>=0; k--)
+      c = c * g->n[k] + (int) ((d->rest[i*3+k] - g->lo[k]) / g->size) ;
+    cell[i] = c ;
+    g->start[c+1]++ ;
+  }
+  for (c=0; c<ncells; c++)
+    g->start[c+1] += g->start[c] ;
+  for (i=0; i<d->nverts; i++)
+    g->vert[g->start[cell[i]]++] = i ;
+  for (c=ncells; c>0; c--)
+    g->start[c] = g->start[c-1] ;
+  g->start[0] = 0 ;
+
+  _delete ( cell ) ;
+}
+
+/* ======================================================================== */
+/* make_influence ( d, g, m, inf )					    */
+/* ======================================================================== */
+/*
+** The vertices muscle m moves and how far, the way activate_muscle()
+** would move them from neutral by a contraction of 1.0.
+*/
+
+static void make_influence ( DEFORM *d, GRID *g, MUSCLE *m, INFLUENCE *inf )
+{
+  float *vt = m->head, *vh = m->tail ;
+  float va[3], vb[3], valen, vblen, thet, cosa, cosv, newv ;
+  int lo[3], hi[3], x, y, z, c, k, i, v, max ;
+
+  thet = cos ( DTOR(m->zone) ) ;
+  for (k=0; k<3; k++)
+    va[k] = vt[k] - vh[k] ;
+  valen = sqrt ( va[0]*va[0] + va[1]*va[1] + va[2]*va[2] ) ;
+
+  /* the cells the sphere of radius fe about the tail overlaps */
+  max = 0 ;
+  for (k=0; k<3; k++) {
+    lo[k] = (int) floor ( (vh[k] - m->fe - g->lo[k]) / g->size ) ;
+    hi[k] = (int) floor ( (vh[k] + m->fe - g->lo[k]) / g->size ) ;
+    if ( lo[k] < 0 )        lo[k] = 0 ;
+    if ( hi[k] >= g->n[k] ) hi[k] = g->n[k] - 1 ;
+  }
+  for (z=lo[2]; z<=hi[2]; z++)
+    for (y=lo[1]; y<=hi[1]; y++)
+      for (x=lo[0]; x<=hi[0]; x++) {
+	c = (z * g->n[1] + y) * g->n[0] + x ;
+	max += g->start[c+1] - g->start[c] ;
+      }
+
+  inf->nverts = 0 ;
+  inf->vert   = _new_array ( int, max + 1 ) ;
+  inf->disp   = _new_array ( float, 3 * max + 1 ) ;
+  if ( valen <= 0.0 )
+    return ;
+
+  for (z=lo[2]; z<=hi[2]; z++)
+    for (y=lo[1]; y<=hi[1]; y++)
+      for (x=lo[0]; x<=hi[0]; x++) {
+	c = (z * g->n[1] + y) * g->n[0] + x ;
+	for (i=g->start[c]; i<g->start[c+1]; i++) {
+	  v = g->vert[i] ;
+	  for (k=0; k<3; k++)
+	    vb[k] = d->rest[v*3+k] - vh[k] ;
+	  vblen = sqrt ( vb[0]*vb[0] + vb[1]*vb[1] + vb[2]*vb[2] ) ;
+	  if ( vblen <= 0.0 || vblen > m->fe )
+	    continue ;
+
+	  cosa = (va[0]*vb[0] + va[1]*vb[1] + va[2]*vb[2]) / (valen*vblen) ;
+	  if ( cosa < thet )
+	    continue ;
+
+	  cosv = 1.0 - (cosa/thet) ;
+	  if ( vblen >= m->fs )
+	    newv = cos ( DTOR((vblen - m->fs) / (m->fe - m->fs) * 90.0) ) ;
+	  else
+	    newv = 1.0 ;
+
+	  inf->vert[inf->nverts] = v ;
+	  for (k=0; k<3; k++)
+	    inf->disp[inf->nverts*3+k] = (vb[k] * cosv) * newv ;
+	  inf->nverts++ ;
+	}
+      }
+}
+
+/* ======================================================================== */
+/* make_deform ( face )							    */
+/* ======================================================================== */
+/*
+** Weld the vertices and work out every muscle's influence on them.
+** The face must have its muscles read in; it is left neutral.
+*/
+
+DEFORM *make_deform ( HEAD *face )
+{
+  DEFORM *d ;
+  GRID g ;
+  int i ;
+
+  d = _new ( DEFORM ) ;
+  weld ( face, d ) ;
+
+  d->xyz     = _new_array ( float, d->nverts * 3 ) ;
+  d->moved   = _new_array ( int, d->nverts ) ;
+  d->ismoved = _new_array ( char, d->nverts ) ;
+  for (i=0; i<d->nverts*3; i++)
+    d->xyz[i] = d->rest[i] ;
+  for (i=0; i<d->nverts; i++)
+    d->ismoved[i] = 0 ;
+  d->nmoved = 0 ;
+
+  make_grid ( d, &g ) ;
+  d->influence = _new_array ( INFLUENCE, face->nmuscles + 1 ) ;
+  for (i=0; i<face->nmuscles; i++)
+    make_influence ( d, &g, face->muscle[i], &d->influence[i] ) ;
+  _delete ( g.start ) ;
+  _delete ( g.vert ) ;
+
+  face->deform = d ;
+  deform_reset ( face ) ;
+  return ( d ) ;
+}
+
+/* ======================================================================== */
+/* contract ( d, inf, dif )						    */
+/* ======================================================================== */
+/*
+** Add dif times a muscle's moves to its vertices.
+*/
+
+static void contract ( DEFORM *d, INFLUENCE *inf, float dif )
+{
+  float *disp = inf->disp, *p ;
+  int i, v ;
+
+  for (i=0; i<inf->nverts; i++, disp+=3) {
+    v = inf->vert[i] ;
+    p = d->xyz + v*3 ;
+    p[0] += dif * disp[0] ;
+    p[1] += dif * disp[1] ;
+    p[2] += dif * disp[2] ;
+    if ( !d->ismoved[v] ) {
+      d->ismoved[v] = 1 ;
+      d->moved[d->nmoved++] = v ;
+    }
+  }
+}
+
+/* ======================================================================== */
+/* update ( d )								    */
+/* ======================================================================== */
+/*
+** Copy the vertices that moved into the polygons.
+*/
+
+static void update ( DEFORM *d )
+{
+  int i, c, v ;
+  float *p ;
+
+  for (i=0; i<d->nmoved; i++) {
+    v = d->moved[i] ;
+    p = d->xyz + v*3 ;
+    for (c=d->first[v]; c<d->first[v+1]; c++) {
+      d->copy[c]->xyz[0] = p[0] ;
+      d->copy[c]->xyz[1] = p[1] ;
+      d->copy[c]->xyz[2] = p[2] ;
+    }
+    d->ismoved[v] = 0 ;
+  }
+  d->nmoved = 0 ;
+}
+
+/* ======================================================================== */
+/* deform_muscle ( face, m, val )					    */
+/* ======================================================================== */
+/*
+** Set the contraction of muscle m to val.
+*/
+
+void deform_muscle ( HEAD *face, int m, float val )
+{
+  DEFORM *d = face->deform ;
+
+  if ( val != face->muscle[m]->mstat ) {
+    contract ( d, &d->influence[m], val - face->muscle[m]->mstat ) ;
+    face->muscle[m]->mstat = val ;
+    update ( d ) ;
+  }
+}
+
+/* ======================================================================== */
+/* deform_expression ( face, weight )					    */
+/* ======================================================================== */
+/*
+** Set every muscle to the sum of the expressions' contractions of it,
+** each expression e times weight[e].  Only the muscles whose
+** contraction changes are touched, so going from one blend to one
+** near it is cheap.
+*/
+
+void deform_expression ( HEAD *face, float *weight )
+{
+  DEFORM *d = face->deform ;
+  int m, e ;
+  float val ;
+
+  for (m=0; m<face->nmuscles; m++) {
+    val = 0.0 ;
+    for (e=0; e<face->nexpressions; e++)
+      if ( weight[e] != 0.0 )
+	val += weight[e] * face->expression[e]->m[m] ;
+    if ( val != face->muscle[m]->mstat ) {
+      contract ( d, &d->influence[m], val - face->muscle[m]->mstat ) ;
+      face->muscle[m]->mstat = val ;
+    }
+  }
+  update ( d ) ;
+}
+
+/* ======================================================================== */
+/* deform_reset ( face )						    */
+/* ======================================================================== */
+/*
+** Relax all the muscles, back to the neutral face.
+*/
+
+void deform_reset ( HEAD *face )
+{
+  DEFORM *d = face->deform ;
+  int i ;
+
+  for (i=0; i<face->nmuscles; i++)
+    face->muscle[i]->mstat = 0.0 ;
+  for (i=0; i<d->nverts*3; i++)
+    d->xyz[i] = d->rest[i] ;
+  for (i=0; i<d->nmoved; i++)
+    d->ismoved[d->moved[i]] = 0 ;
+  for (i=0; i<d->nverts; i++)
+    d->moved[i] = i ;
+  d->nmoved = d->nverts ;
+  update ( d ) ;
+}
+
+/* ======================================================================== */
+/* deform_free ( face )							    */
+/* ======================================================================== */
+/*
+** Free what make_deform() made, leaving the face as it is.
+*/
+
+void deform_free ( HEAD *face )
+{
+  DEFORM *d = face->deform ;
+  int i ;
+
+  if ( d == NULL )
+    return ;
+  for (i=0; i<face->nmuscles; i++) {
+    _delete ( d->influence[i].vert ) ;
+    _delete ( d->influence[i].disp ) ;
+  }
+  _delete ( d->influence ) ;
+  _delete ( d->rest ) ;
+  _delete ( d->xyz ) ;
+  _delete ( d->first ) ;
+  _delete ( d->copy ) ;
+  _delete ( d->moved ) ;
+  _delete ( d->ismoved ) ;
+  _delete ( d ) ;
+  face->deform = NULL ;
+}
@@ -0,0 +1,309 @@
+/* ==========================================================================
+                               FACEBENCH_C
+=============================================================================
+
+    FUNCTION NAMES
+
+    subdivide 		-- split every polygon of the face into four.
+    old_expression 	-- make an expression with activate_muscle().
+    max_move 		-- the furthest any vertex is from where it was.
+    save_xyz 		-- keep where the vertices are.
+    bench 		-- time one mesh.
+    main 		-- the face at each density.
+
+    C SPECIFICATIONS
+
+    void subdivide 	( HEAD *face )
+    void old_expression ( HEAD *face, float *val )
+    float max_move 	( HEAD *face, float *xyz )
+    void save_xyz 	( HEAD *face, float *xyz )
+    void bench 		( HEAD *face )
+    int main 		( int argc, char **argv )
+
+    DESCRIPTION
+
+	Times deform.c against activate_muscle(), with no window, on the
+	face and on denser copies of it, each polygon split into four
+	again and again.  For each it prints how long working out the
+	muscles' influences takes, how many whole expressions a second
+	each way can make, how many times a second one muscle can be set
+	and one blend of two expressions moved a step, and how far
+	deform.c puts the vertices from where activate_muscle() does: for
+	one muscle pulled from neutral, which should agree, and for a
+	whole expression, where activate_muscle() pulls each muscle from
+	where the ones before left the face.
+
+	usage: facebench [times to subdivide]
+
+============================================================================ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "memory.h"
+#include "head.h"
+
+#ifdef _WIN32
+#include <windows.h>
+typedef int timer;
+#define getTime(a)	(a = GetTickCount())
+#define timeDiff(a, b)	((b - a) * 1000)
+#else
+#include <sys/time.h>
+typedef struct timeval timer;
+#define getTime(a)	gettimeofday(&a, NULL)
+#define timeDiff(a, b)	(((b.tv_sec - a.tv_sec) * 1000000) + b.tv_usec - a.tv_usec)
+#endif
+
+int verbose = 0;
+
+void add_polygon_to_face ( POLYGON *p, HEAD *face );
+
+/* ========================================================================= */
+/* subdivide                                                                 */
+/* ========================================================================= */
+/*
+** Split every polygon into four at the middles of its sides.
+*/
+
+void subdivide ( HEAD *face )
+{
+  POLYGON **old = face->polygon, *p ;
+  float mid[3][3], *corner[3] ;
+  int nold = face->npolygons, i, j, k, n ;
+  static int quarter[4][3] = { {0,3,5}, {3,1,4}, {5,4,2}, {3,4,5} } ;
+
+  face->npolygons = 0 ;
+  for (i=0; i<nold; i++) {
+    for (j=0; j<3; j++)
+      for (k=0; k<3; k++)
+	mid[j][k] = (old[i]->vertex[j]->nxyz[k] +
+		     old[i]->vertex[(j+1)%3]->nxyz[k]) / 2.0 ;
+
+    for (n=0; n<4; n++) {
+      p = _new ( POLYGON ) ;
+      for (j=0; j<3; j++) {
+	k = quarter[n][j] ;
+	corner[j] = k < 3 ? old[i]->vertex[k]->nxyz : mid[k-3] ;
+      }
+      for (j=0; j<3; j++) {
+	p->vertex[j] = _new ( VERTEX ) ;
+	p->vertex[j]->np = 0 ;
+	for (k=0; k<3; k++)
+	  p->vertex[j]->nxyz[k] = p->vertex[j]->xyz[k] = corner[j][k] ;
+      }
+      add_polygon_to_face ( p, face ) ;
+    }
+    for (j=0; j<3; j++)
+      _delete ( old[i]->vertex[j] ) ;
+    _delete ( old[i] ) ;
+  }
+  _delete ( old ) ;
+}
+
+/* ========================================================================= */
+/* old_expression                                                            */
+/* ========================================================================= */
+/*
+** From neutral, pull every muscle m by val[m] with activate_muscle().
+*/
+
+void old_expression ( HEAD *face, float *val )
+{
+  int m ;
+
+  face_reset ( face ) ;
+  for (m=0; m<face->nmuscles; m++)
+    activate_muscle ( face,
+		     face->muscle[m]->head,
+		     face->muscle[m]->tail,
+		     face->muscle[m]->fs,
+		     face->muscle[m]->fe,
+		     face->muscle[m]->zone,
+		     val[m] ) ;
+}
+
+/* ========================================================================= */
+/* max_move                                                                  */
+/* ========================================================================= */
+/*
+** How far the polygons' vertices are, at most, from those in xyz.
+*/
+
+float max_move ( HEAD *face, float *xyz )
+{
+  float d, max = 0.0 ;
+  int i, j, k ;
+
+  for (i=0; i<face->npolygons; i++)
+    for (j=0; j<3; j++)
+      for (k=0; k<3; k++) {
+	d = fabs ( face->polygon[i]->vertex[j]->xyz[k] - xyz[(i*3+j)*3+k] ) ;
+	if ( d > max )
+	  max = d ;
+      }
+  return ( max ) ;
+}
+
+/* ========================================================================= */
+/* save_xyz                                                                  */
+/* ========================================================================= */
+/*
+** Keep where the polygons' vertices are, for max_move.
+*/
+
+void save_xyz ( HEAD *face, float *xyz )
+{
+  int i, j, k ;
+
+  for (i=0; i<face->npolygons; i++)
+    for (j=0; j<3; j++)
+      for (k=0; k<3; k++)
+	xyz[(i*3+j)*3+k] = face->polygon[i]->vertex[j]->xyz[k] ;
+}
+
+/* ========================================================================= */
+/* bench                                                                     */
+/* ========================================================================= */
+/*
+** Time one density of mesh.
+*/
+
+void bench ( HEAD *face )
+{
+  float *xyz, val[20], weight[2], one, all, moved ;
+  double tmake, told, tnew, tone, tblend ;
+  long n, usec ;
+  int i, m ;
+  timer t0, t1 ;
+
+  xyz = _new_array ( float, face->npolygons * 9 ) ;
+
+  getTime ( t0 ) ;
+  make_deform ( face ) ;
+  getTime ( t1 ) ;
+  tmake = timeDiff ( t0, t1 ) / 1000.0 ;
+
+  /* two expressions apart in every muscle, and alike in all but two */
+  for (i=0; i<2; i++)
+    for (m=0; m<face->nmuscles; m++)
+      face->expression[i]->m[m] = (float) rand() / RAND_MAX ;
+  face->expression[2]->m[0] = 0.0 ;
+  for (m=1; m<face->nmuscles; m++)
+    face->expression[2]->m[m] = face->expression[0]->m[m] ;
+  face->expression[2]->m[face->nmuscles-1] += 0.5 ;
+
+  /* one muscle at a time from neutral, then a whole expression */
+  one = 0.0 ;
+  for (m=0; m<face->nmuscles; m++) {
+    for (i=0; i<face->nmuscles; i++)
+      val[i] = (i == m) ? 1.0 : 0.0 ;
+    old_expression ( face, val ) ;
+    save_xyz ( face, xyz ) ;
+    deform_reset ( face ) ;
+    deform_muscle ( face, m, 1.0 ) ;
+    if ( max_move ( face, xyz ) > one )
+      one = max_move ( face, xyz ) ;
+  }
+  for (m=0; m<face->nmuscles; m++)
+    val[m] = face->expression[0]->m[m] ;
+  face_reset ( face ) ;
+  save_xyz ( face, xyz ) ;
+  old_expression ( face, val ) ;
+  moved = max_move ( face, xyz ) ;
+  save_xyz ( face, xyz ) ;
+  deform_reset ( face ) ;
+  weight[0] = 1.0 ;
+  weight[1] = 0.0 ;
+  deform_expression ( face, weight ) ;
+  all = max_move ( face, xyz ) ;
+
+  n = 0 ;
+  getTime ( t0 ) ;
+  do {
+    for (m=0; m<face->nmuscles; m++)
+      val[m] = face->expression[n & 1]->m[m] ;
+    old_expression ( face, val ) ;
+    n++ ;
+    getTime ( t1 ) ;
+    usec = timeDiff ( t0, t1 ) ;
+  } while ( usec < 250000 ) ;
+  told = (double) usec / n ;
+
+  n = 0 ;
+  getTime ( t0 ) ;
+  do {
+    weight[n & 1] = 1.0 ;
+    weight[!(n & 1)] = 0.0 ;
+    deform_expression ( face, weight ) ;
+    n++ ;
+    getTime ( t1 ) ;
+    usec = timeDiff ( t0, t1 ) ;
+  } while ( usec < 250000 ) ;
+  tnew = (double) usec / n ;
+
+  n = 0 ;
+  getTime ( t0 ) ;
+  do {
+    deform_muscle ( face, n % face->nmuscles,
+		   (n / face->nmuscles) & 1 ? 0.5 : 1.0 ) ;
+    n++ ;
+    getTime ( t1 ) ;
+    usec = timeDiff ( t0, t1 ) ;
+  } while ( usec < 250000 ) ;
+  tone = (double) usec / n ;
+
+  /* along the blend of the two that are nearly alike, a step at a time */
+  face->nexpressions = 3 ;
+  n = 0 ;
+  getTime ( t0 ) ;
+  do {
+    float w[3] ;
+    w[0] = 1.0 - (n % 100) / 100.0 ;
+    w[1] = 0.0 ;
+    w[2] = (n % 100) / 100.0 ;
+    deform_expression ( face, w ) ;
+    n++ ;
+    getTime ( t1 ) ;
+    usec = timeDiff ( t0, t1 ) ;
+  } while ( usec < 250000 ) ;
+  tblend = (double) usec / n ;
+  face->nexpressions = 2 ;
+
+  printf ( "%7d %7d %8.1f %9.0f %9.0f %9.0f %9.0f %9.2g %9.2g %7.3f\n",
+	  face->npolygons, face->deform->nverts, tmake,
+	  1e6 / told, 1e6 / tnew, 1e6 / tone, 1e6 / tblend,
+	  one, all, moved ) ;
+
+  deform_free ( face ) ;
+  _delete ( xyz ) ;
+}
+
+/* ========================================================================= */
+/* main                                                                      */
+/* ========================================================================= */
+
+int main ( int argc, char **argv )
+{
+  HEAD *face ;
+  int i, levels = argc > 1 ? atoi ( argv[1] ) : 4 ;
+
+  face = create_face ( "index.dat", "faceline.dat" ) ;
+  read_muscles ( "muscle.dat", face ) ;
+  face->nexpressions = 2 ;
+  face->expression = _new_array ( EXPRESSION *, 3 ) ;
+  for (i=0; i<3; i++)
+    face->expression[i] = _new ( EXPRESSION ) ;
+  srand ( 1 ) ;
+
+  printf ( "%7s %7s %8s %9s %9s %9s %9s %9s %9s %7s\n", "polys", "verts",
+	  "make ms", "old/s", "expr/s", "muscle/s", "blend/s",
+	  "one diff", "expr diff", "moved" ) ;
+  for (i=0; ; i++) {
+    bench ( face ) ;
+    if ( i == levels )
+      break ;
+    subdivide ( face ) ;
+  }
+  return ( 0 ) ;
+}
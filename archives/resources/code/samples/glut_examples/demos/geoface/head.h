@@ -46,6 +46,30 @@ typedef struct  POLYGON {
 } POLYGON ;
 
 
+typedef struct  INFLUENCE {
+
+  int      nverts      ;     /* number of vertices the muscle moves       */
+  int     *vert        ;     /* their indices into DEFORM's vertices      */
+  float   *disp        ;     /* x,y,z of each one's move at contraction 1 */
+
+} INFLUENCE ;
+
+
+typedef struct  DEFORM {
+
+  int        nverts     ;    /* number of distinct vertices in the face   */
+  float     *rest       ;    /* x,y,z of each, neutral                    */
+  float     *xyz        ;    /* x,y,z of each, as the muscles have it     */
+  int       *first      ;    /* each one's copies, first[v]..first[v+1]-1 */
+  VERTEX   **copy       ;    /* the polygon vertices that are copies      */
+  INFLUENCE *influence  ;    /* one per muscle                            */
+  int        nmoved     ;    /* vertices moved since the polygons were    */
+  int       *moved      ;    /*   last brought up to date                 */
+  char      *ismoved    ;
+
+} DEFORM ;
+
+
 typedef struct  HEAD {
 
   int       npindices      ;  /* number of polygon indices                 */
@@ -71,6 +95,8 @@ typedef struct  HEAD {
   int	    nexpressions   ;  /* number of expressions in the		   */
   EXPRESSION  **expression ;  /* point to an expression vector	           */
 
+  DEFORM   *deform         ;  /* the muscles' influences, see deform.c     */
+
 } HEAD ;
 
 /* main.c								*/
@@ -93,6 +119,13 @@ void paint_muscles ( HEAD *face );
 /* muscle.c */
 void activate_muscle (HEAD *face, float *vt, float *vh, float fstart,  float fin,  float ang,  float val);
 
+/* deform.c */
+DEFORM *make_deform ( HEAD *face );
+void deform_muscle ( HEAD *face, int m, float val );
+void deform_expression ( HEAD *face, float *weight );
+void deform_reset ( HEAD *face );
+void deform_free ( HEAD *face );
+
 /* fileio.c */
 void read_polygon_indices ( char *FileName, HEAD *face );
 void read_polygon_line ( char    *FileName , HEAD    *face );
@@ -158,6 +158,7 @@ faceinit ( void )
   read_muscles               ("muscle.dat", face ) ;
   read_expression_vectors    ("expression-vectors.dat", face ) ;
   data_struct                ( face ) ;	
+  make_deform                ( face ) ;
 }
 
 void
@@ -305,29 +306,13 @@ static void Key ( unsigned char key, int x, int y )
 	printf ("increment muscle: %s\n", face->muscle[m]->name ) ;
 
 	/* set the muscle activation */
-	face->muscle[m]->mstat += 0.1 ;
-	
-	activate_muscle ( face, 
-			 face->muscle[m]->head, 
-			 face->muscle[m]->tail, 
-			 face->muscle[m]->fs,
-			 face->muscle[m]->fe,
-			 face->muscle[m]->zone,
-			 0.1 ) ;
+	deform_muscle ( face, m, face->muscle[m]->mstat + 0.1 ) ;
 	glutPostRedisplay();
 	break;
 
       case 'A' :
 	printf ("decrement muscle: %s\n", face->muscle[m]->name ) ;
-	face->muscle[m]->mstat -= 0.1 ;
-
-	activate_muscle ( face, 
-			 face->muscle[m]->head, 
-			 face->muscle[m]->tail, 
-			 face->muscle[m]->fs,
-			 face->muscle[m]->fe,
-			 face->muscle[m]->zone,
-			 -0.1 ) ;
+	deform_muscle ( face, m, face->muscle[m]->mstat - 0.1 ) ;
 	glutPostRedisplay();
 	break;
 
@@ -340,7 +325,7 @@ static void Key ( unsigned char key, int x, int y )
 	break;
 
       case 'c' :
-	face_reset ( face ) ;
+	deform_reset ( face ) ;
 	glutPostRedisplay();
 	break;
 	
@@ -353,7 +338,6 @@ static void Key ( unsigned char key, int x, int y )
 
       case 'e' :
 	if (face->expression) {
-	face_reset  ( face ) ;
 	expressions ( face, e ) ;
 
 	e++ ;
@@ -389,27 +373,11 @@ special(int key, int x, int y)
     glutSetWindowTitle(title);
     break;
   case GLUT_KEY_UP:
-	face->muscle[m]->mstat += 0.1 ;
-
-	activate_muscle ( face, 
-			 face->muscle[m]->head, 
-			 face->muscle[m]->tail, 
-			 face->muscle[m]->fs,
-			 face->muscle[m]->fe,
-			 face->muscle[m]->zone,
-			 0.1 ) ;
+	deform_muscle ( face, m, face->muscle[m]->mstat + 0.1 ) ;
 	glutPostRedisplay();
     break;
   case GLUT_KEY_DOWN:
-	face->muscle[m]->mstat -= 0.1 ;
-
-	activate_muscle ( face, 
-			 face->muscle[m]->head, 
-			 face->muscle[m]->tail, 
-			 face->muscle[m]->fs,
-			 face->muscle[m]->fe,
-			 face->muscle[m]->zone,
-			 -0.1 ) ;
+	deform_muscle ( face, m, face->muscle[m]->mstat - 0.1 ) ;
 	glutPostRedisplay();
     break;
   }
@@ -458,32 +426,18 @@ main_menu_select(int value)
 
   switch(value) {
   case 1:
-    face_reset ( face ) ;
+    deform_reset ( face ) ;
     glutPostRedisplay();
     break;
   case 2:
     print_mesg();
     break;
   case 3:
-    face->muscle[m]->mstat += 0.25 ;
-    activate_muscle ( face, 
-      face->muscle[m]->head, 
-      face->muscle[m]->tail, 
-      face->muscle[m]->fs,
-      face->muscle[m]->fe,
-      face->muscle[m]->zone,
-      +0.25 ) ;
+    deform_muscle ( face, m, face->muscle[m]->mstat + 0.25 ) ;
     glutPostRedisplay();
     break;
   case 4:
-    face->muscle[m]->mstat -= 0.25 ;
-    activate_muscle ( face, 
-      face->muscle[m]->head, 
-      face->muscle[m]->tail, 
-      face->muscle[m]->fs,
-      face->muscle[m]->fe,
-      face->muscle[m]->zone,
-      -0.25 ) ;
+    deform_muscle ( face, m, face->muscle[m]->mstat - 0.25 ) ;
     glutPostRedisplay();
     break;
   case 5:
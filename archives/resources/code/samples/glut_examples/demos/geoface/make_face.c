@@ -94,23 +94,16 @@ void face_reset ( HEAD *face )
 void
 expressions ( HEAD *face, int e )
 {
-    int m;
+    float *weight;
+    int i;
 
     fprintf( stderr, "Expression: %s\n", face->expression[e]->name );
 
-    for (m=0; m<face->nmuscles; m++) {
-	float m_val = face->expression[e]->m[m],
-              m_diff = m_val - face->muscle[m]->mstat;
-
-	face->muscle[m]->mstat = m_val;
-        activate_muscle ( face,
-                         face->muscle[m]->head,
-                         face->muscle[m]->tail,
-                         face->muscle[m]->fs,
-                         face->muscle[m]->fe,
-                         face->muscle[m]->zone,
-                         m_diff ) ;
-    }
+    weight = _new_array ( float, face->nexpressions ) ;
+    for (i=0; i<face->nexpressions; i++)
+	weight[i] = (i == e) ? 1.0 : 0.0 ;
+    deform_expression ( face, weight ) ;
+    _delete ( weight ) ;
 
 }
 
@@ -131,6 +124,10 @@ HEAD *create_face ( char *f1, char *f2 )
   h->npolygons		= 0 ;
   h->npindices		= 0 ;
   h->npolylinenodes	= 0 ;
+  h->nmuscles		= 0 ;
+  h->nexpressions	= 0 ;
+  h->expression		= NULL ;
+  h->deform		= NULL ;
 
   read_polygon_indices ( f1, h ) ;
   read_polygon_line    ( f2, h ) ;
@@ -0,0 +1,249 @@
+
+/* Copyright (c) Mark J. Kilgard, 1997.  */
+
+/* This program is freely distributable without licensing fees
+   and is provided without guarantee or warrantee expressed or
+   implied. This program is -not- in the public domain. */
+
+/* caustbench - time loading underwater's caustic textures.
+
+   The 32 caustic images are loaded as underwater used to, reading
+   each caust%02d.bw and building its mipmaps with gluBuild2DMipmaps,
+   and from the caustics.cau atlas made by mkcaust.  Given an atlas
+   on the command line (say one made with "mkcaust -synth 512 256"),
+   that is also loaded whole and streamed, with the time to upload
+   each frame as it is shown when streaming.  For each the start up
+   time (best of a few runs, so with the files in the file cache) and
+   the texture memory OpenGL reports are printed. */
+
+/* X compile line: cc -o caustbench caustbench.c caustics.c texload.c -lglut -lGLU -lGL -lXmu -lXext -lX11 -lm -lpthread */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <GL/glut.h>
+
+#include "texload.h"
+#include "caustics.h"
+
+#ifdef _WIN32
+#include <windows.h>
+typedef int timer;
+#define getTime(a)	(a = GetTickCount())
+#define timeDiff(a, b)	((b - a) * 1000)
+#else
+#include <sys/time.h>
+typedef struct timeval timer;
+#define getTime(a)	gettimeofday(&a, NULL)
+#define timeDiff(a, b)	(((b.tv_sec - a.tv_sec) * 1000000) + b.tv_usec - a.tv_usec)
+#endif
+
+#define NUM_PATTERNS 32
+#define STREAM_TEXTURES 4  /* As in underwater.c. */
+#define RUNS 5
+
+static int numTextures;
+static GLuint textures[1024];
+
+/* Texture memory of the textures loaded, from each level's size. */
+static long
+textureBytes(void)
+{
+  GLint width, height, bits, level;
+  long bytes = 0;
+  int i;
+
+  for (i = 0; i < numTextures; i++) {
+    glBindTexture(GL_TEXTURE_2D, textures[i]);
+    for (level = 0; ; level++) {
+      glGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_WIDTH, &width);
+      if (width == 0)
+        break;
+      glGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_HEIGHT, &height);
+      glGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_LUMINANCE_SIZE, &bits);
+      bytes += (long) width * height * bits / 8;
+    }
+  }
+  return bytes;
+}
+
+static void
+freeTextures(void)
+{
+  glDeleteTextures(numTextures, textures);
+  numTextures = 0;
+}
+
+static GLuint
+newTexture(void)
+{
+  glGenTextures(1, &textures[numTextures]);
+  glBindTexture(GL_TEXTURE_2D, textures[numTextures]);
+  return textures[numTextures++];
+}
+
+/* The old way: read and filter each image file. */
+static void
+loadFiles(void)
+{
+  char filename[80];
+  GLubyte *imageData;
+  int width, height, i;
+
+  for (i = 0; i < NUM_PATTERNS; i++) {
+    sprintf(filename, "caust%02d.bw", i);
+    imageData = read_alpha_texture(filename, &width, &height);
+    if (imageData == NULL) {
+      fprintf(stderr, "%s: could not load image file\n", filename);
+      exit(1);
+    }
+    newTexture();
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    gluBuild2DMipmaps(GL_TEXTURE_2D, GL_LUMINANCE, width, height,
+      GL_LUMINANCE, GL_UNSIGNED_BYTE, imageData);
+    free(imageData);
+  }
+}
+
+static char *atlasFile;
+static CausticAtlas *atlas;
+
+static CausticAtlas *
+openAtlas(char *name)
+{
+  CausticAtlas *a = causticOpen(name);
+
+  if (a == NULL) {
+    fprintf(stderr, "%s: could not load caustic atlas\n", name);
+    exit(1);
+  }
+  return a;
+}
+
+/* Every frame of the atlas a texture, as underwater does. */
+static void
+loadAtlas(void)
+{
+  CausticAtlas *a = openAtlas(atlasFile);
+  int i;
+
+  for (i = 0; i < causticFrames(a) && i < 1024; i++) {
+    newTexture();
+    causticTexImage(a, i, 1);
+  }
+  causticClose(a);
+}
+
+/* Streaming: the first frame only, the rest as they are shown. */
+static void
+streamAtlas(void)
+{
+  int i;
+
+  atlas = openAtlas(atlasFile);
+  for (i = 0; i < STREAM_TEXTURES; i++) {
+    newTexture();
+    causticPrefetch(atlas, i);
+  }
+  glBindTexture(GL_TEXTURE_2D, textures[0]);
+  causticTexImage(atlas, 0, 1);
+}
+
+/* Best start up time in milliseconds, and the texture memory. */
+static double
+run(char *name, void (*load)(void), long *bytes)
+{
+  timer t0, t1;
+  double ms, best = 0.0;
+  int i;
+
+  for (i = 0; i < RUNS; i++) {
+    getTime(t0);
+    load();
+    glFinish();
+    getTime(t1);
+    ms = timeDiff(t0, t1) / 1000.0;
+    if (i == 0 || ms < best)
+      best = ms;
+    *bytes = textureBytes();
+    if (atlas != NULL && i < RUNS - 1) {
+      causticClose(atlas);
+      atlas = NULL;
+    }
+    if (atlas == NULL)
+      freeTextures();
+  }
+  printf("%-28s %10.2f %10ld\n", name, best, *bytes / 1024);
+  return best;
+}
+
+/* Milliseconds to upload each frame of a streamed atlas as it is
+   shown, going through the whole sequence. */
+static double
+streamFrames(void)
+{
+  timer t0, t1;
+  int frames = causticFrames(atlas), i;
+
+  getTime(t0);
+  for (i = 1; i <= frames; i++) {
+    glBindTexture(GL_TEXTURE_2D, textures[i % STREAM_TEXTURES]);
+    causticTexImage(atlas, i % frames, 1);
+    causticPrefetch(atlas, (i + STREAM_TEXTURES) % frames);
+    glFinish();
+  }
+  getTime(t1);
+  return timeDiff(t0, t1) / 1000.0 / frames;
+}
+
+static void
+bench(char *big)
+{
+  long bytes;
+  int width, height;
+  CausticAtlas *a;
+
+  printf("%s\n", (char *) glGetString(GL_RENDERER));
+  printf("%-28s %10s %10s\n", "caustics", "ms", "KB");
+  run("32 .bw files", loadFiles, &bytes);
+  atlasFile = "caustics.cau";
+  run("caustics.cau", loadAtlas, &bytes);
+  if (big == NULL)
+    return;
+
+  atlasFile = big;
+  a = openAtlas(big);
+  causticSize(a, &width, &height);
+  printf("%s: %d %dx%d frames\n", big, causticFrames(a), width, height);
+  causticClose(a);
+  run("  whole", loadAtlas, &bytes);
+  run("  streamed", streamAtlas, &bytes);
+  printf("%-28s %10.2f\n", "  streamed, each frame", streamFrames());
+  causticClose(atlas);
+  atlas = NULL;
+  freeTextures();
+}
+
+static char *bigAtlas;
+
+static void
+display(void)
+{
+  bench(bigAtlas);
+  exit(0);
+}
+
+int
+main(int argc, char **argv)
+{
+  glutInit(&argc, argv);
+  if (argc > 1)
+    bigAtlas = argv[1];
+  glutInitWindowSize(64, 64);
+  glutInitDisplayMode(GLUT_RGB | GLUT_SINGLE);
+  glutCreateWindow("caustbench");
+  glutDisplayFunc(display);
+  glutMainLoop();
+  return 0;             /* ANSI C requires main to return int. */
+}
@@ -0,0 +1,598 @@
+
+/* Copyright (c) Mark J. Kilgard, 1997.  */
+
+/* This program is freely distributable without licensing fees
+   and is provided without guarantee or warrantee expressed or
+   implied. This program is -not- in the public domain. */
+
+/* caustics.c - caustic texture atlases: reading, writing, prefetching,
+   and a procedural caustic generator. */
+
+/* Atlas layout, all numbers 32 bit big endian like SGI image files:
+
+     0  "CAUSTICS"
+     8  width, height, frames, levels
+    24  bytes per frame
+    28  zero
+    32  frame 0 level 0, level 1, ... level levels-1, frame 1 ...
+
+   Each level is half the size of the one before it (down to 1) and
+   rows are packed with no padding. */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "caustics.h"
+
+/* Some <math.h> files do not define M_PI... */
+#ifndef M_PI
+#define M_PI 3.14159265
+#endif
+
+/* Win32 builds prefetch nothing. */
+#if defined(_WIN32) && !defined(CAUSTIC_NO_THREADS)
+#define CAUSTIC_NO_THREADS
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#endif
+
+#ifndef CAUSTIC_NO_THREADS
+#include <pthread.h>
+#endif
+
+#define HEADER_SIZE 32
+#define MAGIC "CAUSTICS"
+#define MAX_PREFETCH 16  /* Prefetch requests waiting at most. */
+#define PAGE 4096
+
+struct _CausticAtlas {
+  int width, height, frames, levels;
+  long frameBytes;
+  GLubyte *data;        /* Frame 0 level 0. */
+  GLubyte *base;        /* Start of the file in memory. */
+  long size;
+#ifdef _WIN32
+  HANDLE file, mapping;
+#endif
+  int mapped;           /* Otherwise base was malloc'ed. */
+#ifndef CAUSTIC_NO_THREADS
+  pthread_t thread;
+  pthread_mutex_t lock;
+  pthread_cond_t wake;
+  int queue[MAX_PREFETCH];
+  int head, count;
+  int quit;
+  int started;
+#endif
+};
+
+static unsigned long
+getUint(GLubyte *p)
+{
+  return ((unsigned long) p[0] << 24) | ((unsigned long) p[1] << 16) |
+    ((unsigned long) p[2] << 8) | p[3];
+}
+
+static void
+putUint(GLubyte *p, unsigned long v)
+{
+  p[0] = (GLubyte) (v >> 24);
+  p[1] = (GLubyte) (v >> 16);
+  p[2] = (GLubyte) (v >> 8);
+  p[3] = (GLubyte) v;
+}
+
+static int
+numLevels(int width, int height)
+{
+  int levels = 1;
+
+  while (width > 1 || height > 1) {
+    width = width > 1 ? width / 2 : 1;
+    height = height > 1 ? height / 2 : 1;
+    levels++;
+  }
+  return levels;
+}
+
+static long
+mipmapBytes(int width, int height)
+{
+  long bytes = (long) width * height;
+
+  while (width > 1 || height > 1) {
+    width = width > 1 ? width / 2 : 1;
+    height = height > 1 ? height / 2 : 1;
+    bytes += (long) width * height;
+  }
+  return bytes;
+}
+
+static int
+powerOfTwo(int n)
+{
+  return n > 0 && (n & (n - 1)) == 0;
+}
+
+/* Map the whole file, or failing that read it in one fread. */
+static int
+mapFile(CausticAtlas *atlas, char *name)
+{
+#ifdef _WIN32
+  atlas->file = CreateFile(name, GENERIC_READ, FILE_SHARE_READ, NULL,
+    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (atlas->file != INVALID_HANDLE_VALUE) {
+    atlas->size = (long) GetFileSize(atlas->file, NULL);
+    atlas->mapping = CreateFileMapping(atlas->file, NULL, PAGE_READONLY,
+      0, 0, NULL);
+    if (atlas->mapping != NULL) {
+      atlas->base = MapViewOfFile(atlas->mapping, FILE_MAP_READ, 0, 0, 0);
+      if (atlas->base != NULL) {
+        atlas->mapped = 1;
+        return 1;
+      }
+      CloseHandle(atlas->mapping);
+    }
+    CloseHandle(atlas->file);
+  }
+#else
+  struct stat st;
+  void *p;
+  int fd;
+
+  fd = open(name, O_RDONLY);
+  if (fd >= 0) {
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+      p = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+      if (p != MAP_FAILED) {
+        close(fd);
+        atlas->base = (GLubyte *) p;
+        atlas->size = (long) st.st_size;
+        atlas->mapped = 1;
+        return 1;
+      }
+    }
+    close(fd);
+  }
+#endif
+  {
+    FILE *file = fopen(name, "rb");
+
+    if (file == NULL)
+      return 0;
+    fseek(file, 0, SEEK_END);
+    atlas->size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    atlas->base = (GLubyte *) malloc(atlas->size > 0 ? atlas->size : 1);
+    if (atlas->base == NULL ||
+      fread(atlas->base, 1, atlas->size, file) != (size_t) atlas->size) {
+      free(atlas->base);
+      fclose(file);
+      return 0;
+    }
+    fclose(file);
+    atlas->mapped = 0;
+    return 1;
+  }
+}
+
+static void
+unmapFile(CausticAtlas *atlas)
+{
+  if (!atlas->mapped) {
+    free(atlas->base);
+    return;
+  }
+#ifdef _WIN32
+  UnmapViewOfFile(atlas->base);
+  CloseHandle(atlas->mapping);
+  CloseHandle(atlas->file);
+#else
+  munmap(atlas->base, (size_t) atlas->size);
+#endif
+}
+
+#ifndef CAUSTIC_NO_THREADS
+/* Touch every page of a frame so that its first glTexImage2D does
+   not wait on the disk. */
+static void
+touchFrame(CausticAtlas *atlas, int frame)
+{
+  volatile GLubyte *p, *end;
+
+  p = atlas->data + frame * atlas->frameBytes;
+  end = p + atlas->frameBytes;
+#if defined(MADV_WILLNEED)
+  {
+    long off = (long) ((GLubyte *) p - atlas->base) & ~(long) (PAGE - 1);
+
+    madvise((void *) (atlas->base + off),
+      (size_t) ((GLubyte *) end - (atlas->base + off)), MADV_WILLNEED);
+  }
+#endif
+  for (; p < end; p += PAGE)
+    (void) *p;
+  (void) end[-1];
+}
+
+static void *
+prefetcher(void *arg)
+{
+  CausticAtlas *atlas = (CausticAtlas *) arg;
+  int frame;
+
+  pthread_mutex_lock(&atlas->lock);
+  for (;;) {
+    while (atlas->count == 0 && !atlas->quit)
+      pthread_cond_wait(&atlas->wake, &atlas->lock);
+    if (atlas->quit)
+      break;
+    frame = atlas->queue[atlas->head];
+    atlas->head = (atlas->head + 1) % MAX_PREFETCH;
+    atlas->count--;
+    pthread_mutex_unlock(&atlas->lock);
+    touchFrame(atlas, frame);
+    pthread_mutex_lock(&atlas->lock);
+  }
+  pthread_mutex_unlock(&atlas->lock);
+  return NULL;
+}
+#endif
+
+CausticAtlas *
+causticOpen(char *name)
+{
+  CausticAtlas *atlas;
+  GLubyte *h;
+
+  atlas = (CausticAtlas *) calloc(1, sizeof(CausticAtlas));
+  if (atlas == NULL)
+    return NULL;
+  if (!mapFile(atlas, name)) {
+    free(atlas);
+    return NULL;
+  }
+  h = atlas->base;
+  if (atlas->size < HEADER_SIZE || memcmp(h, MAGIC, 8) != 0)
+    goto bad;
+  atlas->width = (int) getUint(h + 8);
+  atlas->height = (int) getUint(h + 12);
+  atlas->frames = (int) getUint(h + 16);
+  atlas->levels = (int) getUint(h + 20);
+  atlas->frameBytes = (long) getUint(h + 24);
+  if (!powerOfTwo(atlas->width) || !powerOfTwo(atlas->height) ||
+    atlas->frames < 1 ||
+    atlas->levels != numLevels(atlas->width, atlas->height) ||
+    atlas->frameBytes != mipmapBytes(atlas->width, atlas->height) ||
+    (atlas->size - HEADER_SIZE) / atlas->frameBytes < atlas->frames)
+    goto bad;
+  atlas->data = h + HEADER_SIZE;
+
+#ifndef CAUSTIC_NO_THREADS
+  if (atlas->mapped) {
+    pthread_mutex_init(&atlas->lock, NULL);
+    pthread_cond_init(&atlas->wake, NULL);
+    if (pthread_create(&atlas->thread, NULL, prefetcher, atlas) == 0)
+      atlas->started = 1;
+  }
+#endif
+  return atlas;
+
+bad:
+  unmapFile(atlas);
+  free(atlas);
+  return NULL;
+}
+
+void
+causticClose(CausticAtlas *atlas)
+{
+#ifndef CAUSTIC_NO_THREADS
+  if (atlas->started) {
+    pthread_mutex_lock(&atlas->lock);
+    atlas->quit = 1;
+    pthread_cond_signal(&atlas->wake);
+    pthread_mutex_unlock(&atlas->lock);
+    pthread_join(atlas->thread, NULL);
+  }
+  if (atlas->mapped) {
+    pthread_mutex_destroy(&atlas->lock);
+    pthread_cond_destroy(&atlas->wake);
+  }
+#endif
+  unmapFile(atlas);
+  free(atlas);
+}
+
+int
+causticFrames(CausticAtlas *atlas)
+{
+  return atlas->frames;
+}
+
+void
+causticSize(CausticAtlas *atlas, int *width, int *height)
+{
+  *width = atlas->width;
+  *height = atlas->height;
+}
+
+long
+causticFrameBytes(CausticAtlas *atlas)
+{
+  return atlas->frameBytes;
+}
+
+GLubyte *
+causticImage(CausticAtlas *atlas, int frame, int level,
+  int *width, int *height)
+{
+  GLubyte *p = atlas->data + frame * atlas->frameBytes;
+  int w = atlas->width, h = atlas->height;
+
+  while (level-- > 0) {
+    p += (long) w * h;
+    w = w > 1 ? w / 2 : 1;
+    h = h > 1 ? h / 2 : 1;
+  }
+  *width = w;
+  *height = h;
+  return p;
+}
+
+void
+causticTexImage(CausticAtlas *atlas, int frame, int mipmap)
+{
+  GLint alignment;
+  GLubyte *image;
+  int level, levels, width, height;
+
+  /* The small levels have rows shorter than 4 bytes. */
+  glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  if (mipmap) {
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    levels = atlas->levels;
+  } else {
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    levels = 1;
+  }
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  for (level = 0; level < levels; level++) {
+    image = causticImage(atlas, frame, level, &width, &height);
+    glTexImage2D(GL_TEXTURE_2D, level, GL_LUMINANCE, width, height, 0,
+      GL_LUMINANCE, GL_UNSIGNED_BYTE, image);
+  }
+  glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+}
+
+/* ARGSUSED1 */
+void
+causticPrefetch(CausticAtlas *atlas, int frame)
+{
+#ifndef CAUSTIC_NO_THREADS
+  if (!atlas->started || frame < 0 || frame >= atlas->frames)
+    return;
+  pthread_mutex_lock(&atlas->lock);
+  /* When the thread falls behind, drop the request; the frame is
+     read when it is drawn either way. */
+  if (atlas->count < MAX_PREFETCH) {
+    atlas->queue[(atlas->head + atlas->count) % MAX_PREFETCH] = frame;
+    atlas->count++;
+    pthread_cond_signal(&atlas->wake);
+  }
+  pthread_mutex_unlock(&atlas->lock);
+#endif
+}
+
+FILE *
+causticCreate(char *name, int width, int height, int frames)
+{
+  GLubyte h[HEADER_SIZE];
+  FILE *file;
+
+  if (!powerOfTwo(width) || !powerOfTwo(height) || frames < 1)
+    return NULL;
+  file = fopen(name, "wb");
+  if (file == NULL)
+    return NULL;
+  memset(h, 0, sizeof(h));
+  memcpy(h, MAGIC, 8);
+  putUint(h + 8, width);
+  putUint(h + 12, height);
+  putUint(h + 16, frames);
+  putUint(h + 20, numLevels(width, height));
+  putUint(h + 24, mipmapBytes(width, height));
+  if (fwrite(h, 1, HEADER_SIZE, file) != HEADER_SIZE) {
+    fclose(file);
+    return NULL;
+  }
+  return file;
+}
+
+/* Box filter an image down to half its size (or to 1). */
+static void
+halve(GLubyte *src, int width, int height, GLubyte *dst)
+{
+  int x, y, x0, x1, y0, y1, w, h;
+
+  w = width > 1 ? width / 2 : 1;
+  h = height > 1 ? height / 2 : 1;
+  for (y = 0; y < h; y++) {
+    y0 = (2 * y) * width;
+    y1 = height > 1 ? y0 + width : y0;
+    for (x = 0; x < w; x++) {
+      x0 = 2 * x;
+      x1 = width > 1 ? x0 + 1 : x0;
+      dst[y * w + x] = (GLubyte) ((src[y0 + x0] + src[y0 + x1] +
+        src[y1 + x0] + src[y1 + x1] + 2) >> 2);
+    }
+  }
+}
+
+int
+causticAppend(FILE *file, GLubyte *image, int width, int height)
+{
+  GLubyte *mipmaps, *p;
+  long bytes;
+  int ok;
+
+  bytes = mipmapBytes(width, height);
+  mipmaps = (GLubyte *) malloc(bytes);
+  if (mipmaps == NULL)
+    return 0;
+  memcpy(mipmaps, image, (size_t) width * height);
+  for (p = mipmaps; width > 1 || height > 1; ) {
+    halve(p, width, height, p + (long) width * height);
+    p += (long) width * height;
+    width = width > 1 ? width / 2 : 1;
+    height = height > 1 ? height / 2 : 1;
+  }
+  ok = fwrite(mipmaps, 1, bytes, file) == (size_t) bytes;
+  free(mipmaps);
+  return ok;
+}
+
+/* The procedural caustics.  The water surface is a sum of NUM_WAVES
+   sine waves whose wave vectors are whole numbers of waves across the
+   tile, so the pattern tiles, and whose phases turn a whole number of
+   times over the sequence, so it loops.  Light falling straight down is
+   bent by the slope of the surface, by about DEPTH times the slope by
+   the time it reaches the floor.  Each texel sends SAMPLES x SAMPLES
+   rays and the floor counts where they land; where the rays bunch up
+   the floor is bright. */
+
+#define NUM_WAVES 12
+#define SAMPLES 3
+#define DEPTH 0.12      /* Fraction of the tile a unit slope moves light. */
+#define AMBIENT 0.20    /* Brightness where no light lands, */
+#define GAIN 0.45       /* and added for each ray per ray on average. */
+
+typedef struct {
+  int kx, ky;           /* Waves across the tile. */
+  int cycles;           /* Turns over the whole sequence. */
+  float amplitude, phase;
+} Wave;
+
+static unsigned int
+nextRandom(unsigned int *state)
+{
+  *state = *state * 1103515245u + 12345u;
+  return (*state >> 16) & 0x7fff;
+}
+
+static void
+makeWaves(Wave *waves, unsigned int seed)
+{
+  unsigned int state = seed;
+  int i, k2;
+
+  for (i = 0; i < NUM_WAVES; i++) {
+    do {
+      waves[i].kx = (int) (nextRandom(&state) % 9) - 4;
+      waves[i].ky = (int) (nextRandom(&state) % 9) - 4;
+      k2 = waves[i].kx * waves[i].kx + waves[i].ky * waves[i].ky;
+    } while (k2 == 0);
+    /* Longer waves travel faster, like deep water waves. */
+    waves[i].cycles = 1 + (int) (4.0 / sqrt(sqrt((double) k2)));
+    if (nextRandom(&state) & 1)
+      waves[i].cycles = -waves[i].cycles;
+    /* Slope of each wave falling off with frequency. */
+    waves[i].amplitude = (float) (1.0 / (2.0 * M_PI * k2 * sqrt((double) NUM_WAVES)));
+    waves[i].phase = (float) (2.0 * M_PI * nextRandom(&state) / 32768.0);
+  }
+}
+
+void
+causticSynthesize(GLubyte *image, int width, int height,
+  int frame, int frames, unsigned int seed)
+{
+  Wave waves[NUM_WAVES];
+  float *light, *cx, *sx, *cy, *sy;
+  float gx, gy, px, py, fx, fy, a, b, scale, v;
+  int nx = width * SAMPLES, ny = height * SAMPLES;
+  int i, x, y, x0, y0, x1, y1;
+  double t;
+
+  makeWaves(waves, seed);
+  light = (float *) calloc((size_t) width * height, sizeof(float));
+  cx = (float *) malloc(NUM_WAVES * nx * sizeof(float));
+  sx = (float *) malloc(NUM_WAVES * nx * sizeof(float));
+  cy = (float *) malloc(NUM_WAVES * ny * sizeof(float));
+  sy = (float *) malloc(NUM_WAVES * ny * sizeof(float));
+  if (light == NULL || cx == NULL || sx == NULL || cy == NULL || sy == NULL) {
+    memset(image, (int) (255 * (AMBIENT + GAIN)), (size_t) width * height);
+    goto done;
+  }
+
+  /* cos and sin of each wave's phase along the rows and the columns;
+     the surface slope at a ray is then a few multiplies a wave. */
+  t = frames > 0 ? (double) frame / frames : 0.0;
+  for (i = 0; i < NUM_WAVES; i++) {
+    for (x = 0; x < nx; x++) {
+      a = (float) (2.0 * M_PI * waves[i].kx * (x + 0.5) / nx);
+      cx[i * nx + x] = (float) cos(a);
+      sx[i * nx + x] = (float) sin(a);
+    }
+    for (y = 0; y < ny; y++) {
+      b = (float) (2.0 * M_PI * (waves[i].ky * (y + 0.5) / ny -
+        waves[i].cycles * t) + waves[i].phase);
+      cy[i * ny + y] = (float) cos(b);
+      sy[i * ny + y] = (float) sin(b);
+    }
+  }
+
+  for (y = 0; y < ny; y++) {
+    for (x = 0; x < nx; x++) {
+      gx = gy = 0.0;
+      for (i = 0; i < NUM_WAVES; i++) {
+        /* d/dx of amplitude * sin(2 pi k.p + phase) */
+        v = waves[i].amplitude * 2.0 * M_PI *
+          (cx[i * nx + x] * cy[i * ny + y] - sx[i * nx + x] * sy[i * ny + y]);
+        gx += v * waves[i].kx;
+        gy += v * waves[i].ky;
+      }
+      /* Where the ray lands, in texels, spread over the four nearest. */
+      px = ((x + 0.5) / SAMPLES) - DEPTH * width * gx - 0.5;
+      py = ((y + 0.5) / SAMPLES) - DEPTH * height * gy - 0.5;
+      fx = (float) floor(px);
+      fy = (float) floor(py);
+      a = px - fx;
+      b = py - fy;
+      x0 = (int) fx % width;
+      y0 = (int) fy % height;
+      if (x0 < 0)
+        x0 += width;
+      if (y0 < 0)
+        y0 += height;
+      x1 = x0 + 1 < width ? x0 + 1 : 0;
+      y1 = y0 + 1 < height ? y0 + 1 : 0;
+      light[y0 * width + x0] += (1 - a) * (1 - b);
+      light[y0 * width + x1] += a * (1 - b);
+      light[y1 * width + x0] += (1 - a) * b;
+      light[y1 * width + x1] += a * b;
+    }
+  }
+
+  scale = GAIN / (SAMPLES * SAMPLES);
+  for (i = 0; i < width * height; i++) {
+    v = 255 * (AMBIENT + scale * light[i]);
+    image[i] = (GLubyte) (v < 255 ? v + 0.5 : 255);
+  }
+
+done:
+  free(light);
+  free(cx);
+  free(sx);
+  free(cy);
+  free(sy);
+}
@@ -0,0 +1,47 @@
+
+/* Copyright (c) Mark J. Kilgard, 1997.  */
+
+/* This program is freely distributable without licensing fees
+   and is provided without guarantee or warrantee expressed or
+   implied. This program is -not- in the public domain. */
+
+/* A caustic atlas is a whole sequence of caustic luminance textures
+   in one file, each frame followed by its mipmaps (built offline with
+   a box filter, as gluBuild2DMipmaps would).  It is mapped into memory
+   in one go, so that loading it is a single mmap (MapViewOfFile on
+   Win32) instead of a read and decode per frame, and nothing is
+   copied until a frame is handed to OpenGL.  A sequence too large to
+   keep as textures can be uploaded a few frames at a time; a
+   background thread then pages in the frames asked for with
+   causticPrefetch before they are drawn.  See mkcaust.c for building
+   atlases. */
+
+#include <stdio.h>
+#include <GL/glut.h>
+
+typedef struct _CausticAtlas CausticAtlas;
+
+/* Reading. */
+extern CausticAtlas *causticOpen(char *name);
+extern void causticClose(CausticAtlas *atlas);
+extern int causticFrames(CausticAtlas *atlas);
+extern void causticSize(CausticAtlas *atlas, int *width, int *height);
+/* Texture bytes of a frame, all of its mipmap levels included. */
+extern long causticFrameBytes(CausticAtlas *atlas);
+extern GLubyte *causticImage(CausticAtlas *atlas, int frame, int level,
+  int *width, int *height);
+/* Load a frame (and its mipmaps) into the current texture. */
+extern void causticTexImage(CausticAtlas *atlas, int frame, int mipmap);
+/* Page a frame in on the background thread, if there is one. */
+extern void causticPrefetch(CausticAtlas *atlas, int frame);
+
+/* Writing: causticCreate then causticAppend each frame in turn.
+   Sizes must be powers of two. */
+extern FILE *causticCreate(char *name, int width, int height, int frames);
+extern int causticAppend(FILE *file, GLubyte *image, int width, int height);
+
+/* One frame of a looping procedural sequence of any size: light
+   refracted by a tiling, rippling water surface and gathered on the
+   floor below.  The same seed gives the same waves. */
+extern void causticSynthesize(GLubyte *image, int width, int height,
+  int frame, int frames, unsigned int seed);
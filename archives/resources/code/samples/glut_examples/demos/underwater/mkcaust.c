@@ -0,0 +1,143 @@
+
+/* Copyright (c) Mark J. Kilgard, 1997.  */
+
+/* This program is freely distributable without licensing fees
+   and is provided without guarantee or warrantee expressed or
+   implied. This program is -not- in the public domain. */
+
+/* mkcaust - build a caustic atlas for underwater, either from SGI .bw
+   images (by default the caust00.bw to caust31.bw frames that
+   underwater loads one by one) or from the procedural caustic
+   generator at any power of two size and number of frames. */
+
+/* X compile line: cc -o mkcaust mkcaust.c caustics.c texload.c -lglut -lGLU -lGL -lXmu -lXext -lX11 -lm -lpthread */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#ifndef PATH_MAX
+#define PATH_MAX 1024
+#endif
+
+#include "texload.h"
+#include "caustics.h"
+
+#define NUM_PATTERNS 32
+
+static void
+usage(void)
+{
+  fprintf(stderr, "usage: mkcaust [-o atlas] [image.bw ...]\n");
+  fprintf(stderr, "       mkcaust [-o atlas] -synth size frames [seed]\n");
+  fprintf(stderr, "       Without images packs caust00.bw to caust31.bw.\n");
+  fprintf(stderr, "       -synth generates size x size procedural caustics.\n");
+  fprintf(stderr, "       The atlas is caustics.cau unless given with -o.\n");
+  exit(1);
+}
+
+int
+main(int argc, char **argv)
+{
+  char *output = "caustics.cau";
+  char filename[PATH_MAX];
+  char **names = NULL;
+  int numNames = 0, synth = 0, size = 0, frames = NUM_PATTERNS;
+  unsigned int seed = 1;
+  int i, width, height, w, h;
+  GLubyte *image;
+  FILE *file;
+
+  for (i = 1; i < argc; i++) {
+    if (!strcmp("-o", argv[i]) && i + 1 < argc) {
+      output = argv[++i];
+    } else if (!strcmp("-synth", argv[i]) && i + 2 < argc) {
+      synth = 1;
+      size = atoi(argv[++i]);
+      frames = atoi(argv[++i]);
+      if (i + 1 < argc && argv[i + 1][0] != '-')
+        seed = (unsigned int) atoi(argv[++i]);
+    } else if (argv[i][0] == '-') {
+      usage();
+    } else {
+      if (names == NULL)
+        names = (char **) malloc(argc * sizeof(char *));
+      names[numNames++] = argv[i];
+    }
+  }
+  if (synth && numNames > 0)
+    usage();
+
+  if (synth) {
+    width = height = size;
+    image = (GLubyte *) malloc((size_t) width * height);
+    file = causticCreate(output, width, height, frames);
+    if (image == NULL || file == NULL) {
+      fprintf(stderr, "mkcaust: could not make %d %dx%d frames in %s\n",
+        frames, width, height, output);
+      exit(1);
+    }
+    printf("synthesizing %s:", output);
+    for (i = 0; i < frames; i++) {
+      printf(" %d", i);
+      fflush(stdout);
+      causticSynthesize(image, width, height, i, frames, seed);
+      if (!causticAppend(file, image, width, height)) {
+        fprintf(stderr, "\n%s: write failed\n", output);
+        exit(1);
+      }
+    }
+    free(image);
+  } else {
+    if (numNames > 0)
+      frames = numNames;
+    file = NULL;
+    width = height = 0;
+    printf("packing %s:", output);
+    for (i = 0; i < frames; i++) {
+      if (numNames == 0) {
+        sprintf(filename, "caust%02d.bw", i);
+      } else {
+        if (strlen(names[i]) >= sizeof(filename)) {
+          fprintf(stderr, "\n%s: path too long\n", names[i]);
+          exit(1);
+        }
+        strncpy(filename, names[i], sizeof(filename) - 1);
+        filename[sizeof(filename) - 1] = '\0';
+      }
+      printf(" %d", i);
+      fflush(stdout);
+      image = read_alpha_texture(filename, &w, &h);
+      if (image == NULL) {
+        fprintf(stderr, "\n%s: could not load image file\n", filename);
+        exit(1);
+      }
+      if (file == NULL) {
+        width = w;
+        height = h;
+        file = causticCreate(output, width, height, frames);
+        if (file == NULL) {
+          fprintf(stderr, "\nmkcaust: could not make %d %dx%d frames in %s\n",
+            frames, width, height, output);
+          exit(1);
+        }
+      } else if (w != width || h != height) {
+        fprintf(stderr, "\n%s: not %dx%d like the first image\n",
+          filename, width, height);
+        exit(1);
+      }
+      if (!causticAppend(file, image, width, height)) {
+        fprintf(stderr, "\n%s: write failed\n", output);
+        exit(1);
+      }
+      free(image);
+    }
+  }
+  if (fclose(file) != 0) {
+    fprintf(stderr, "\n%s: write failed\n", output);
+    exit(1);
+  }
+  printf(".\n");
+  return 0;
+}
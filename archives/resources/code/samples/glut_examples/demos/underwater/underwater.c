@@ -5,7 +5,7 @@
    provided without guarantee or warrantee expressed or implied. This
    program is -not- in the public domain. */
 
-/* X compile line: cc -o underwater underwater.c texload.c dino.c -lglut -lGLU -lGL -lXmu -lXext -lX11 -lm */
+/* X compile line: cc -o underwater underwater.c texload.c dino.c caustics.c -lglut -lGLU -lGL -lXmu -lXext -lX11 -lm -lpthread */
 
 /* This code compiles and works with any of 1) OpenGL 1.0 with no
    texture extensions, 2) OpenGL 1.0 with texture extensions, or 3)
@@ -19,6 +19,7 @@
 
 #include "texload.h"
 #include "dino.h"
+#include "caustics.h"
 
 #if 0  /* For debugging different OpenGL versions. */
 #undef GL_VERSION_1_1
@@ -50,6 +51,12 @@
 
 #define NUM_PATTERNS 32
 #define FLOOR_FILE "floor.rgb"
+#define CAUSTIC_FILE "caustics.cau"  /* Atlas made by mkcaust. */
+
+/* Caustic sequences needing more texture memory than STREAM_LIMIT
+   are kept in STREAM_TEXTURES textures, uploaded as they are shown. */
+#define STREAM_LIMIT (8*1024*1024)
+#define STREAM_TEXTURES 4
 
 enum {
   PASS_NORMAL, PASS_CAUSTIC
@@ -81,6 +88,9 @@ static int showCaustics = 1, causticMotion = 1;
 static int useMipmaps = 1;
 static int currentCaustic = 0;
 static int causticIncrement = 1;
+static int numPatterns = NUM_PATTERNS;
+static CausticAtlas *atlas = NULL;  /* Only kept when streaming. */
+static int streamFrame[STREAM_TEXTURES];
 
 static float lightAngle = 0.0, lightHeight = 20;
 static GLfloat angle = -150;   /* in degrees */
@@ -195,6 +205,39 @@ drawObject(int pass)
   }
 }
 
+/* Make a caustic pattern the current texture. */
+static void
+bindCaustic(int frame)
+{
+  int slot;
+
+  if (atlas == NULL) {
+    if (HaveTexObj) {
+      glBindTexture(GL_TEXTURE_2D, frame+101);
+    } else {
+      glCallList(frame+101);
+    }
+    return;
+  }
+
+  /* Streaming: upload the frame into the least recently used of a few
+     textures, rather than into the one just drawn with, so that the
+     upload need not wait for the previous frame to finish rendering.
+     Without texture objects, just respecify the texture. */
+  if (HaveTexObj) {
+    slot = (frame / causticIncrement) % STREAM_TEXTURES;
+    glBindTexture(GL_TEXTURE_2D, slot+101);
+    if (streamFrame[slot] == frame)
+      return;
+    streamFrame[slot] = frame;
+  }
+  causticTexImage(atlas, frame, useMipmaps);
+
+  /* Have the frames to come paged in while this one is shown. */
+  causticPrefetch(atlas,
+    (frame + STREAM_TEXTURES * causticIncrement) % numPatterns);
+}
+
 void
 drawScene(int pass)
 {
@@ -229,11 +272,7 @@ drawScene(int pass)
     glEnable(GL_TEXTURE_GEN_S);
     glEnable(GL_TEXTURE_GEN_T);
 
-    if (HaveTexObj) {
-      glBindTexture(GL_TEXTURE_2D, currentCaustic+1);
-    } else {
-      glCallList(currentCaustic+101);
-    }
+    bindCaustic(currentCaustic);
   }
 
   drawFloor(pass);
@@ -319,7 +358,7 @@ void
 idle(void)
 {
   /* Advance the caustic pattern. */
-  currentCaustic = (currentCaustic + causticIncrement) % NUM_PATTERNS;
+  currentCaustic = (currentCaustic + causticIncrement) % numPatterns;
   glutPostRedisplay();
 }
 
@@ -455,12 +494,105 @@ menuSelect(int value)
   glutPostRedisplay();
 }
 
+/* Load the caustic ripple textures one image file at a time. */
+static void
+loadCausticFiles(void)
+{
+  int width, height;
+  int i;
+  GLubyte *imageData;
+
+  printf("loading caustics:");
+  for (i=0; i<NUM_PATTERNS; i += causticIncrement) {
+    char filename[80];
+
+    sprintf(filename, "caust%02d.bw", i);
+    printf(" %d", i);
+    fflush(stdout);
+    imageData = read_alpha_texture(filename, &width, &height);
+    if (imageData == NULL) {
+      fprintf(stderr, "\n%s: could not load image file\n", filename);
+      exit(1);
+    }
+    if (HaveTexObj)
+      glBindTexture(GL_TEXTURE_2D, i+101);
+    else
+      glNewList(i+101, GL_COMPILE);
+    if (useMipmaps) {
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+      gluBuild2DMipmaps(GL_TEXTURE_2D, GL_LUMINANCE, width, height,
+        GL_LUMINANCE, GL_UNSIGNED_BYTE, imageData);
+    } else {
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+      glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE, height, width, 0,
+        GL_LUMINANCE, GL_UNSIGNED_BYTE, imageData);
+    }
+    free(imageData);
+    if (!HaveTexObj)
+      glEndList();
+  }
+  printf(".\n");
+}
+
+/* Load the caustic ripple textures from an atlas made by mkcaust.
+   The atlas has the mipmaps already built and is loaded with a single
+   mmap, so this is much quicker than decoding and filtering each
+   image file. */
+static int
+loadCausticAtlas(char *filename)
+{
+  CausticAtlas *a;
+  int width, height, frames, i;
+  long bytes;
+
+  a = causticOpen(filename);
+  if (a == NULL)
+    return 0;
+  causticSize(a, &width, &height);
+  frames = (causticFrames(a) + causticIncrement - 1) / causticIncrement;
+  /* Frames 0, causticIncrement, 2*causticIncrement, ... are the ones
+     loaded, so the animation wraps after the last of them even when
+     the atlas length is not a multiple of causticIncrement. */
+  numPatterns = frames * causticIncrement;
+  bytes = useMipmaps ? causticFrameBytes(a) : (long) width * height;
+  printf("loading caustics: %d %dx%d frames from %s", frames,
+    width, height, filename);
+
+  if (bytes * frames > STREAM_LIMIT) {
+    atlas = a;
+    for (i = 0; i < STREAM_TEXTURES; i++) {
+      streamFrame[i] = -1;
+      causticPrefetch(atlas, (i * causticIncrement) % numPatterns);
+    }
+    printf(", streaming %ld KB of texture.\n",
+      bytes * (frames < STREAM_TEXTURES ? frames : STREAM_TEXTURES) / 1024);
+    return 1;
+  }
+
+  for (i=0; i<numPatterns; i += causticIncrement) {
+    if (HaveTexObj)
+      glBindTexture(GL_TEXTURE_2D, i+101);
+    else
+      glNewList(i+101, GL_COMPILE);
+    causticTexImage(a, i, useMipmaps);
+    if (!HaveTexObj)
+      glEndList();
+  }
+  /* OpenGL has its own copy now. */
+  causticClose(a);
+  printf(", %ld KB of texture.\n", bytes * frames / 1024);
+  return 1;
+}
+
 int
 main(int argc, char **argv)
 {
   int width, height;
   int i;
   GLubyte *imageData;
+  char *causticFile = NULL;
 
   glutInit(&argc, argv);
   for (i=1; i<argc; i++) {
@@ -476,10 +608,16 @@ main(int argc, char **argv)
       /* Don't use linear mipmap linear texture filtering; instead
 	 use linear filtering. */
       useMipmaps = 0;
+    } else if (!strcmp("-caustics", argv[i]) && i+1 < argc) {
+      /* Load the caustic textures from another atlas, such as
+	 a sequence made by "mkcaust -synth". */
+      causticFile = argv[++i];
     } else {
-      fprintf(stderr, "usage: caustics [-lesstex]\n");
+      fprintf(stderr, "usage: caustics [-lesstex] [-caustics atlas]\n");
       fprintf(stderr, "       -lesstex uses half the caustic textures.\n");
       fprintf(stderr, "       -evenlesstex uses one fourth of the caustic textures.\n");
+      fprintf(stderr, "       -nomipmap uses linear filtering.\n");
+      fprintf(stderr, "       -caustics loads the caustic textures from an atlas.\n");
       exit(1);
     }
   }
@@ -505,39 +643,16 @@ main(int argc, char **argv)
     glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_REPLACE);
 #endif
 
-  /* Load the caustic ripple textures. */
-  printf("loading caustics:");
-  for (i=0; i<NUM_PATTERNS; i += causticIncrement) {
-    char filename[80];
-
-    sprintf(filename, "caust%02d.bw", i);
-    printf(" %d", i);
-    fflush(stdout);
-    imageData = read_alpha_texture(filename, &width, &height);
-    if (imageData == NULL) {
-      fprintf(stderr, "\n%s: could not load image file\n", filename);
+  /* Load the caustic ripple textures, from the atlas if there is
+     one, else from the image files. */
+  if (causticFile != NULL) {
+    if (!loadCausticAtlas(causticFile)) {
+      fprintf(stderr, "%s: could not load caustic atlas\n", causticFile);
       exit(1);
     }
-    if (HaveTexObj)
-      glBindTexture(GL_TEXTURE_2D, i+1);
-    else
-      glNewList(i+101, GL_COMPILE);
-    if (useMipmaps) {
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-      gluBuild2DMipmaps(GL_TEXTURE_2D, GL_LUMINANCE, width, height,
-        GL_LUMINANCE, GL_UNSIGNED_BYTE, imageData);
-    } else {
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-      glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE, height, width, 0,
-        GL_LUMINANCE, GL_UNSIGNED_BYTE, imageData);
-    }
-    free(imageData);
-    if (!HaveTexObj)
-      glEndList();
+  } else if (!loadCausticAtlas(CAUSTIC_FILE)) {
+    loadCausticFiles();
   }
-  printf(".\n");
 
   /* Load an RGB file for the floor texture. */
   printf("loading RGB textures: floor");
@@ -0,0 +1,440 @@
+/*
+ * curves.c
+ *
+ * Sampling the rotation curves, and the .cset files and cache, see
+ * curves.h.
+ *
+ * Each Bezier segment is turned into a cubic in t once, and then
+ * stepped along by forward differences: three adds per sample instead
+ * of a matrix times a vector.  Segments don't depend on each other, so
+ * they are done four at a time, the segments of all the joints dealt
+ * out one to each lane, with SSE where there is SSE.  Every OVERSAMPLE
+ * steps the differences are worked out again from the cubic so the
+ * float sums can't drift.  A sample goes in the cycle at the index its
+ * x falls on, the first sample to get there winning, as before.
+ *
+ * The cache is one binary file holding, for each curve set, the size
+ * and time of its .cset file when it was stored, its control points
+ * and its sampled cycle, so loading an unchanged set is a read.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include "curves.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define CURVES_SSE
+#include <xmmintrin.h>
+#endif
+
+#define LANES 4
+#define STEPS (CYCLE_SIZE*OVERSAMPLE)   /* steps along a segment */
+
+#define CACHE_MAGIC   0x57435331     /* "WCS1", and the byte order */
+#define CACHE_VERSION 1
+
+typedef struct Segment {
+  float *cycle;     /* where it goes */
+  int last;         /* cycle[last] is done */
+  int end;          /* and the segment goes up to cycle[end] */
+} tSegment;
+
+typedef struct Group {
+  int n;
+  tSegment seg[LANES];
+  float ax[LANES], bx[LANES], cx[LANES], dx[LANES];  /* a t^3 + b t^2 ... */
+  float ay[LANES], by[LANES], cy[LANES], dy[LANES];
+} tGroup;
+
+
+/***************************************************************/
+/************************** SAMPLING ***************************/
+/***************************************************************/
+
+#ifdef CURVES_SSE
+
+typedef __m128 V4;
+#define V4Load(p)    _mm_loadu_ps(p)
+#define V4Store(p,v) _mm_storeu_ps(p, v)
+#define V4Splat(f)   _mm_set1_ps(f)
+#define V4Add(a,b)   _mm_add_ps(a, b)
+#define V4Mul(a,b)   _mm_mul_ps(a, b)
+
+#else
+
+typedef struct { float f[LANES]; } V4;
+
+static V4 V4Load(float *p)
+{
+  V4 v;
+  int i;
+
+  for (i = 0; i < LANES; i++)
+    v.f[i] = p[i];
+  return v;
+}
+
+static void V4Store(float *p, V4 v)
+{
+  int i;
+
+  for (i = 0; i < LANES; i++)
+    p[i] = v.f[i];
+}
+
+static V4 V4Splat(float f)
+{
+  V4 v;
+  int i;
+
+  for (i = 0; i < LANES; i++)
+    v.f[i] = f;
+  return v;
+}
+
+static V4 V4Add(V4 a, V4 b)
+{
+  int i;
+
+  for (i = 0; i < LANES; i++)
+    a.f[i] += b.f[i];
+  return a;
+}
+
+static V4 V4Mul(V4 a, V4 b)
+{
+  int i;
+
+  for (i = 0; i < LANES; i++)
+    a.f[i] *= b.f[i];
+  return a;
+}
+
+#endif
+
+  /* The cubic at t and its first three forward differences, step h */
+static void Differences(V4 a, V4 b, V4 c, V4 d, float t, float h,
+                        V4 *p, V4 *d1, V4 *d2, V4 *d3)
+{
+  V4 vt = V4Splat(t);
+
+  *p = V4Add(V4Mul(V4Add(V4Mul(V4Add(V4Mul(a, vt), b), vt), c), vt), d);
+  *d1 = V4Add(V4Add(V4Mul(a, V4Splat(3*t*t*h + 3*t*h*h + h*h*h)),
+                    V4Mul(b, V4Splat(2*t*h + h*h))),
+              V4Mul(c, V4Splat(h)));
+  *d2 = V4Add(V4Mul(a, V4Splat(6*t*h*h + 6*h*h*h)),
+              V4Mul(b, V4Splat(2*h*h)));
+  *d3 = V4Mul(a, V4Splat(6*h*h*h));
+}
+
+static void SampleGroup(tGroup *g)
+{
+  V4 ax = V4Load(g->ax), bx = V4Load(g->bx), cx = V4Load(g->cx),
+     dx = V4Load(g->dx), ay = V4Load(g->ay), by = V4Load(g->by),
+     cy = V4Load(g->cy), dy = V4Load(g->dy);
+  V4 px, dx1, dx2, dx3, py, dy1, dy2, dy3;
+  float x[LANES], y[LANES], h = 1.0/STEPS;
+  int step, i, lane, index;
+  tSegment *s;
+
+  for (step = 0; step <= STEPS; step += OVERSAMPLE) {
+    Differences(ax, bx, cx, dx, step*h, h, &px, &dx1, &dx2, &dx3);
+    Differences(ay, by, cy, dy, step*h, h, &py, &dy1, &dy2, &dy3);
+    for (i = 0; i < OVERSAMPLE && step + i <= STEPS; i++) {
+      V4Store(x, px);
+      V4Store(y, py);
+      for (lane = 0; lane < g->n; lane++) {
+        s = &g->seg[lane];
+        index = (int)(x[lane]*(CYCLE_SIZE-1));
+        if (index > s->end)
+          index = s->end;
+        while (s->last < index)
+          s->cycle[++s->last] = y[lane];
+      }
+      px = V4Add(px, dx1);  dx1 = V4Add(dx1, dx2);  dx2 = V4Add(dx2, dx3);
+      py = V4Add(py, dy1);  dy1 = V4Add(dy1, dy2);  dy2 = V4Add(dy2, dy3);
+    }
+  }
+
+  /* sums a little short of the segment's end point leave a gap */
+  for (lane = 0; lane < g->n; lane++) {
+    s = &g->seg[lane];
+    while (s->last < s->end)
+      s->cycle[++s->last] = g->ay[lane] + g->by[lane] + g->cy[lane] +
+                            g->dy[lane];
+  }
+  g->n = 0;
+}
+
+  /* Deal out segment seg of curve, then sample the group if it's full */
+static void AddSegment(tGroup *g, tControlPts *curve, int seg, float *cycle)
+{
+  float *x = curve->xcoords + 3*seg, *y = curve->angles + 3*seg;
+  int lane = g->n++;
+
+  g->ax[lane] = -x[0] + 3*x[1] - 3*x[2] + x[3];
+  g->bx[lane] = 3*x[0] - 6*x[1] + 3*x[2];
+  g->cx[lane] = -3*x[0] + 3*x[1];
+  g->dx[lane] = x[0];
+  g->ay[lane] = -y[0] + 3*y[1] - 3*y[2] + y[3];
+  g->by[lane] = 3*y[0] - 6*y[1] + 3*y[2];
+  g->cy[lane] = -3*y[0] + 3*y[1];
+  g->dy[lane] = y[0];
+
+  g->seg[lane].cycle = cycle;
+  g->seg[lane].last = seg == 0 ? -1 : (int)(x[0]*(CYCLE_SIZE-1));
+  if (seg == (curve->numpoints-1)/3 - 1)
+    g->seg[lane].end = CYCLE_SIZE-1;
+  else
+    g->seg[lane].end = (int)(x[3]*(CYCLE_SIZE-1));
+  if (g->seg[lane].end > CYCLE_SIZE-1)
+    g->seg[lane].end = CYCLE_SIZE-1;
+
+  if (g->n == LANES)
+    SampleGroup(g);
+}
+
+void EvalCurves(tControlPts *curves, int numjoints, float cycle[][CYCLE_SIZE])
+{
+  tGroup g;
+  int joint, seg;
+
+  g.n = 0;
+  for (joint = 0; joint < numjoints; joint++)
+    for (seg = 0; seg < (curves[joint].numpoints-1)/3; seg++)
+      AddSegment(&g, &curves[joint], seg, cycle[joint]);
+  if (g.n)
+    SampleGroup(&g);
+}
+
+void EvalCurvePoint(tControlPts *curve, int point, float *cycle,
+                    int *first, int *last)
+{
+  tGroup g;
+  int numsegs = (curve->numpoints-1)/3, from, to;
+
+  to = point/3;             /* the segment it starts or is in */
+  from = (point % 3 || point == 0) ? to : to-1;   /* or ends */
+  if (to >= numsegs)
+    to = numsegs-1;
+
+  g.n = 0;
+  AddSegment(&g, curve, from, cycle);
+  if (to != from)
+    AddSegment(&g, curve, to, cycle);
+  *first = g.seg[0].last + 1;
+  *last = g.seg[g.n-1].end;
+  SampleGroup(&g);
+}
+
+/***************************************************************/
+/************************** CSET FILES *************************/
+/***************************************************************/
+
+int ReadCSet(char *filename, tControlPts *curves, int *mirrorlegs)
+{
+  FILE *infile = fopen(filename, "r");
+  int numjoints, numpoints, joint, point, mirror;
+  float value;
+
+  if (infile == NULL)
+    return -1;
+
+  if (fscanf(infile, " %d", &numjoints) != 1 || numjoints != NUM_JOINTS)
+    goto abort;
+
+  if (fscanf(infile, " %d", &mirror) != 1 || (mirror != 0 && mirror != 1))
+    goto abort;
+
+  for (joint = 0; joint < NUM_JOINTS; joint++) {
+    if (fscanf(infile, " %d", &numpoints) != 1 || numpoints < 4 ||
+                                                   numpoints > MAX_CPOINTS)
+      goto abort;
+    curves[joint].numpoints = numpoints;
+    for (point = 0; point < numpoints; point++) {
+      if (fscanf(infile, " %f", &value) != 1)
+	goto abort;
+      curves[joint].xcoords[point] = value;
+    }
+    for (point = 0; point < numpoints; point++) {
+      if (fscanf(infile, " %f", &value) != 1)
+	goto abort;
+      curves[joint].angles[point] = value;
+    }
+  }
+
+  *mirrorlegs = mirror;
+  fclose(infile);
+  return 0;
+
+  abort:
+    fclose(infile);
+    return -1;
+}
+
+/***************************************************************/
+/**************************** CACHE ****************************/
+/***************************************************************/
+
+  /* A cache entry, written field by field:
+       unsigned char namelen, then the name
+       long size, mtime           of the .cset file
+       unsigned char mirrorlegs
+       for each joint: unsigned char numpoints, then that many
+                       xcoords and that many angles
+       float cycle[NUM_JOINTS][CYCLE_SIZE]    the first leg's */
+
+typedef struct Cache {
+  unsigned char *data;
+  long length, pos;
+} tCache;
+
+static int Take(tCache *c, void *dest, long n)
+{
+  if (c->pos + n > c->length)
+    return 0;
+  if (dest)
+    memcpy(dest, c->data + c->pos, n);
+  c->pos += n;
+  return 1;
+}
+
+  /* Read the whole cache file, checking its header; 0 if it isn't there */
+static int ReadCache(tCache *c)
+{
+  FILE *f = fopen(CSET_CACHE, "rb");
+  long header[2];
+
+  c->data = NULL;
+  c->length = c->pos = 0;
+  if (f == NULL)
+    return 0;
+  fseek(f, 0, SEEK_END);
+  c->length = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  if (c->length > 0)
+    c->data = malloc(c->length);
+  if (c->data == NULL || fread(c->data, 1, c->length, f) != (size_t)c->length ||
+      !Take(c, header, sizeof(header)) ||
+      header[0] != CACHE_MAGIC || header[1] != CACHE_VERSION) {
+    free(c->data);
+    c->data = NULL;
+    c->length = c->pos = 0;
+  }
+  fclose(f);
+  return c->data != NULL;
+}
+
+  /* Step over the entry at c->pos, noting its name; 0 if it's cut short */
+static int NextEntry(tCache *c, char *name)
+{
+  unsigned char len, numpoints;
+  int joint;
+
+  if (!Take(c, &len, 1) || len > MAX_CSETNAMELEN || !Take(c, name, len))
+    return 0;
+  name[len] = 0;
+  if (!Take(c, NULL, 2*sizeof(long) + 1))
+    return 0;
+  for (joint = 0; joint < NUM_JOINTS; joint++)
+    if (!Take(c, &numpoints, 1) || numpoints < 4 || numpoints > MAX_CPOINTS ||
+        !Take(c, NULL, 2*numpoints*sizeof(float)))
+      return 0;
+  return Take(c, NULL, NUM_JOINTS*CYCLE_SIZE*sizeof(float));
+}
+
+static int CSetFileStat(char *csetname, long *size, long *mtime)
+{
+  char filename[MAX_CSETNAMELEN + CSET_EXTLEN + 1];
+  struct stat st;
+
+  (void)strcpy(filename, csetname);
+  (void)strcat(filename, CSET_EXT);
+  if (stat(filename, &st) != 0)
+    return 0;
+  *size = (long)st.st_size;
+  *mtime = (long)st.st_mtime;
+  return 1;
+}
+
+int CacheLoad(char *csetname, tControlPts *curves, int *mirrorlegs,
+              float cycle[][CYCLE_SIZE])
+{
+  tCache c;
+  char name[MAX_CSETNAMELEN + 1];
+  long size, mtime, stamp[2];
+  unsigned char mirror = 0, numpoints = 0;
+  int joint, start, found = 0;
+
+  if (!CSetFileStat(csetname, &size, &mtime) || !ReadCache(&c))
+    return -1;
+
+  for (start = c.pos; !found && NextEntry(&c, name); start = c.pos) {
+    if (strcmp(name, csetname))
+      continue;
+    c.pos = start + 1 + strlen(name);
+    Take(&c, stamp, sizeof(stamp));
+    if (stamp[0] != size || stamp[1] != mtime)
+      break;
+    Take(&c, &mirror, 1);
+    *mirrorlegs = mirror;
+    for (joint = 0; joint < NUM_JOINTS; joint++) {
+      Take(&c, &numpoints, 1);
+      curves[joint].numpoints = numpoints;
+      Take(&c, curves[joint].xcoords, numpoints*sizeof(float));
+      Take(&c, curves[joint].angles, numpoints*sizeof(float));
+    }
+    Take(&c, cycle, NUM_JOINTS*CYCLE_SIZE*sizeof(float));
+    found = 1;
+  }
+  free(c.data);
+  return found ? 0 : -1;
+}
+
+void CacheStore(char *csetname, tControlPts *curves, int mirrorlegs,
+                float cycle[][CYCLE_SIZE])
+{
+  tCache c;
+  FILE *f;
+  char name[MAX_CSETNAMELEN + 1];
+  long header[2], stamp[2];
+  unsigned char len, mirror, numpoints;
+  int joint, start;
+
+  if (strlen(csetname) > MAX_CSETNAMELEN ||
+      !CSetFileStat(csetname, &stamp[0], &stamp[1]))
+    return;
+  ReadCache(&c);
+  if ((f = fopen(CSET_CACHE, "wb")) == NULL) {
+    free(c.data);
+    return;
+  }
+
+  /* the other sets' entries, as they were */
+  header[0] = CACHE_MAGIC;
+  header[1] = CACHE_VERSION;
+  fwrite(header, sizeof(header), 1, f);
+  for (start = c.pos; NextEntry(&c, name); start = c.pos)
+    if (strcmp(name, csetname))
+      fwrite(c.data + start, 1, c.pos - start, f);
+  free(c.data);
+
+  len = strlen(csetname);
+  fwrite(&len, 1, 1, f);
+  fwrite(csetname, 1, len, f);
+  fwrite(stamp, sizeof(stamp), 1, f);
+  mirror = mirrorlegs;
+  fwrite(&mirror, 1, 1, f);
+  for (joint = 0; joint < NUM_JOINTS; joint++) {
+    numpoints = curves[joint].numpoints;
+    fwrite(&numpoints, 1, 1, f);
+    fwrite(curves[joint].xcoords, sizeof(float), numpoints, f);
+    fwrite(curves[joint].angles, sizeof(float), numpoints, f);
+  }
+  fwrite(cycle, sizeof(float), NUM_JOINTS*CYCLE_SIZE, f);
+  fclose(f);
+}
@@ -0,0 +1,55 @@
+/*
+ * curves.h
+ *
+ * The rotation curves: a joint's angle over one walk cycle as a chain
+ * of cubic Bezier segments, sampled into CYCLE_SIZE angles, plus the
+ * .cset files they live in and a binary cache of them.  No GL in here,
+ * so walkbench can use it too.
+ */
+
+#ifndef CURVES_H
+#define CURVES_H
+
+#define CYCLE_SIZE 100
+#define OVERSAMPLE 10    /* samples of a segment per cycle step */
+
+#define NUM_JOINTS 5
+#define MAX_CPOINTS 34   /* 2 end point ones and 10 in the middle */
+
+#define MAX_CSETNAMELEN 25
+
+#define CSET_EXT ".cset"
+#define CSET_EXTLEN 5
+#define CSET_CACHE "csets.cache"
+
+typedef struct ControlPts {
+  int numpoints;
+  float xcoords[MAX_CPOINTS];
+  float angles[MAX_CPOINTS];
+} tControlPts;
+
+  /* Sample numjoints curves into cycle[joint], all their segments
+     together. */
+extern void EvalCurves(tControlPts *curves, int numjoints,
+                       float cycle[][CYCLE_SIZE]);
+
+  /* Resample only the segments control point 'point' of curve belongs
+     to, after it moved; *first and *last get the part of cycle that
+     changed. */
+extern void EvalCurvePoint(tControlPts *curve, int point, float *cycle,
+                           int *first, int *last);
+
+  /* Read a .cset file, 0 if all went well, -1 if not */
+extern int ReadCSet(char *filename, tControlPts *curves, int *mirrorlegs);
+
+  /* Look the named curve set up in the cache, with its sampled cycle,
+     if its .cset file hasn't changed since it was stored; 0 if found,
+     -1 if not. */
+extern int CacheLoad(char *csetname, tControlPts *curves, int *mirrorlegs,
+                     float cycle[][CYCLE_SIZE]);
+
+  /* Store a curve set just read from or written to its .cset file */
+extern void CacheStore(char *csetname, tControlPts *curves, int mirrorlegs,
+                       float cycle[][CYCLE_SIZE]);
+
+#endif
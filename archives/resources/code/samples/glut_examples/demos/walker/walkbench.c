@@ -0,0 +1,284 @@
+/*
+ * walkbench.c
+ *
+ * Time curves.c without drawing anything, on every .cset file in the
+ * current directory.  For each set it checks the sampled cycles against
+ * the matrix code walker.c used before, and that moving any one control
+ * point and resampling just its segments gives what resampling the
+ * whole set does.  Then it times, for at least a quarter of a second
+ * each: sampling all the joints the new way and the old way, resampling
+ * after a control point moves, reading the .cset file and sampling it
+ * against loading it from the cache, and posing a crowd of guys from
+ * the one set of cycles.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#ifdef WIN32
+#include "win32_dirent.h"
+#else
+#include <dirent.h>
+#endif
+
+#include "curves.h"
+
+#ifdef _WIN32
+#include <windows.h>
+typedef int timer;
+#define getTime(a)	(a = GetTickCount())
+#define timeDiff(a, b)	((b - a) * 1000)
+#else
+#include <sys/time.h>
+typedef struct timeval timer;
+#define getTime(a)	gettimeofday(&a, NULL)
+#define timeDiff(a, b)	(((b.tv_sec - a.tv_sec) * 1000000) + b.tv_usec - a.tv_usec)
+#endif
+
+#define CYCLE_STEP 1.0/CYCLE_SIZE
+#define CROWD 10000      /* guys posed from the one set of cycles */
+
+float Crowd[CROWD][2][NUM_JOINTS];
+
+/***************************************************************/
+/********************** THE OLD WAY ****************************/
+/***************************************************************/
+
+void MultMV(float m[3][4], float v[4], float dest[3])
+{
+  int i, j;
+
+  for (i = 0; i < 3; i++) {
+    dest[i] = 0;
+    for (j = 0; j < 4; j++)
+      dest[i] += m[i][j] * v[j];
+  }
+}
+
+void MultM(float m1[3][4], float m2[4][4], float dest[3][4])
+{
+  int i, j, k;
+
+  for (i = 0; i < 3; i++)
+    for (j = 0; j < 4; j++) {
+      dest[i][j] = 0;
+      for (k = 0; k < 4; k++)
+	  dest[i][j] += (m1[i][k] * m2[k][j]);
+    }
+}
+
+  /* walker.c's ComputeCurve, less copying to the other leg */
+void OldCurve(tControlPts *curve, float *cycle)
+{
+  float prod[3][4], tm[4], pos[3];
+  float t = 0, tinc = (float)CYCLE_STEP/OVERSAMPLE;
+  int ctlpoint, i;
+  float BBasis[4][4] = {{-1, 3, -3, 1}, {3, -6, 3, 0},
+                        {-3, 3,  0, 0}, {1,  0, 0, 0}};
+  int lastindex, newindex;
+
+  float pointset[3][4];
+  for (i = 0; i < 4; i++)   /* z's are always zero, only 2-d */
+    pointset[2][i] = 0;
+
+  lastindex = -1;
+  for(ctlpoint = 0; ctlpoint < curve->numpoints; ctlpoint += 3) {
+    t = 0;
+    for (i = 0; i < 4; i++)
+      pointset[0][i] = curve->xcoords[ctlpoint + i];
+    for (i = 0; i < 4; i++)
+      pointset[1][i] = curve->angles[ctlpoint + i];
+
+    MultM(pointset, BBasis, prod);
+
+    while (t <= 1) {
+      tm[0] = t*t*t;
+      tm[1] = t*t;
+      tm[2] = t;
+      tm[3] = 1;
+      MultMV(prod, tm, pos);
+      newindex = (int)(pos[0]*(CYCLE_SIZE-1));
+      if ((int)(newindex > lastindex))  {  /* go at least one */
+	cycle[newindex] = pos[1];
+	lastindex++;
+      }
+      t += tinc;
+    }
+  }
+}
+
+/***************************************************************/
+/************************** BENCHES ****************************/
+/***************************************************************/
+
+float MaxDiff(float *a, float *b, int n)
+{
+  float d, max = 0;
+  int i;
+
+  for (i = 0; i < n; i++) {
+    d = fabs(a[i] - b[i]);
+    if (d > max)
+      max = d;
+  }
+  return max;
+}
+
+  /* Moving each control point a little, then putting it back */
+int CheckPoints(tControlPts *curves, float cycle[][CYCLE_SIZE])
+{
+  float whole[NUM_JOINTS][CYCLE_SIZE], angle;
+  int joint, point, first, last, bad = 0;
+
+  for (joint = 0; joint < NUM_JOINTS; joint++)
+    for (point = 0; point < curves[joint].numpoints; point++) {
+      angle = curves[joint].angles[point];
+      curves[joint].angles[point] = angle + 7;
+      EvalCurvePoint(&curves[joint], point, cycle[joint], &first, &last);
+      EvalCurves(curves, NUM_JOINTS, whole);
+      bad += memcmp(whole, cycle, sizeof(whole)) != 0;
+      curves[joint].angles[point] = angle;
+      EvalCurvePoint(&curves[joint], point, cycle[joint], &first, &last);
+    }
+  return bad;
+}
+
+void Bench(char *csetname)
+{
+  char filename[MAX_CSETNAMELEN + CSET_EXTLEN + 1];
+  tControlPts curves[NUM_JOINTS];
+  float cycle[NUM_JOINTS][CYCLE_SIZE], old[NUM_JOINTS][CYCLE_SIZE];
+  float diff = 0, d;
+  int mirror, joint, first, last, bad, segments = 0;
+  long n, usec;
+  double tnew, told, tpoint, tread, tcache, tcrowd;
+  timer t0, t1;
+
+  (void)strcpy(filename, csetname);
+  (void)strcat(filename, CSET_EXT);
+  memset(curves, 0, sizeof(curves));  /* OldCurve reads past the end */
+  if (ReadCSet(filename, curves, &mirror)) {
+    printf("%-16s can't read it\n", csetname);
+    return;
+  }
+  memset(old, 0, sizeof(old));
+  for (joint = 0; joint < NUM_JOINTS; joint++) {
+    OldCurve(&curves[joint], old[joint]);
+    segments += (curves[joint].numpoints - 1)/3;
+  }
+  EvalCurves(curves, NUM_JOINTS, cycle);
+  for (joint = 0; joint < NUM_JOINTS; joint++) {
+    d = MaxDiff(cycle[joint], old[joint], CYCLE_SIZE);
+    if (d > diff)
+      diff = d;
+  }
+  bad = CheckPoints(curves, cycle);
+  CacheStore(csetname, curves, mirror, cycle);
+
+  n = 0;
+  getTime(t0);
+  do {
+    EvalCurves(curves, NUM_JOINTS, cycle);
+    n++;
+    getTime(t1);
+    usec = timeDiff(t0, t1);
+  } while (usec < 250000);
+  tnew = (double)usec / n;
+
+  n = 0;
+  getTime(t0);
+  do {
+    for (joint = 0; joint < NUM_JOINTS; joint++)
+      OldCurve(&curves[joint], old[joint]);
+    n++;
+    getTime(t1);
+    usec = timeDiff(t0, t1);
+  } while (usec < 250000);
+  told = (double)usec / n;
+
+  n = 0;
+  getTime(t0);
+  do {
+    joint = n % NUM_JOINTS;
+    EvalCurvePoint(&curves[joint], (n / NUM_JOINTS) % curves[joint].numpoints,
+                   cycle[joint], &first, &last);
+    n++;
+    getTime(t1);
+    usec = timeDiff(t0, t1);
+  } while (usec < 250000);
+  tpoint = (double)usec / n;
+
+  n = 0;
+  getTime(t0);
+  do {
+    ReadCSet(filename, curves, &mirror);
+    EvalCurves(curves, NUM_JOINTS, cycle);
+    n++;
+    getTime(t1);
+    usec = timeDiff(t0, t1);
+  } while (usec < 250000);
+  tread = (double)usec / n;
+
+  n = 0;
+  getTime(t0);
+  do {
+    if (CacheLoad(csetname, curves, &mirror, cycle)) {
+      printf("%-16s not in the cache\n", csetname);
+      return;
+    }
+    n++;
+    getTime(t1);
+    usec = timeDiff(t0, t1);
+  } while (usec < 250000);
+  tcache = (double)usec / n;
+
+  n = 0;
+  getTime(t0);
+  do {
+    int guy, step;
+    for (guy = 0; guy < CROWD; guy++) {
+      step = (n + guy*37) % CYCLE_SIZE;
+      for (joint = 0; joint < NUM_JOINTS; joint++) {
+        Crowd[guy][0][joint] = cycle[joint][step];
+        Crowd[guy][1][joint] = cycle[joint][(step+CYCLE_SIZE/2)%CYCLE_SIZE];
+      }
+    }
+    n++;
+    getTime(t1);
+    usec = timeDiff(t0, t1);
+  } while (usec < 250000);
+  tcrowd = (double)usec / n;
+
+  printf("%-16s %4d %8.3f %6s %9.0f %9.0f %6.2f %6.1f %6.1f %6.2f\n",
+         csetname, segments, diff, bad ? "WRONG" : "ok",
+         NUM_JOINTS * 1e6 / tnew, NUM_JOINTS * 1e6 / told, tpoint, tread,
+         tcache, 1000.0 * tcrowd / CROWD);
+}
+
+int main(void)
+{
+  DIR *dirp = opendir(".");
+  struct dirent *direntp;
+  char csetname[MAX_CSETNAMELEN + 1];
+  int len;
+
+  if (dirp == NULL) {
+    fprintf(stderr, "walkbench: can't read the current directory\n");
+    return 1;
+  }
+  printf("%-16s %4s %8s %6s %9s %9s %6s %6s %6s %6s\n", "", "segs",
+         "max diff", "points", "joints/s", "old", "us/pt", "us rd",
+         "us cch", "ns/guy");
+  while ((direntp = readdir(dirp)) != NULL) {
+    len = strlen(direntp->d_name) - CSET_EXTLEN;
+    if (len > 0 && len <= MAX_CSETNAMELEN &&
+        !strcmp(direntp->d_name + len, CSET_EXT)) {
+      memcpy(csetname, direntp->d_name, len);
+      csetname[len] = 0;
+      Bench(csetname);
+    }
+  }
+  closedir(dirp);
+  return 0;
+}
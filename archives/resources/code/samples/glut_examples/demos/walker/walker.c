@@ -20,18 +20,7 @@
 #define MAX(x,y) ((x) > (y) ? (x) : (y))
 #define MIN(x,y) ((x) < (y) ? (x) : (y))
 
-#define CYCLE_SIZE 100
-#define CYCLE_STEP 1.0/CYCLE_SIZE
-#define OVERSAMPLE 10
-
-#define MAX_CPOINTS 34   /* 2 end point ones and 10 in the middle */
-
-#define MAX_CSETNAMELEN 25
-
-#define NUM_JOINTS 5
-
-#define CSET_EXT ".cset"
-#define CSET_EXTLEN 5
+#define CROWD_SIZE 5     /* guys along each side of the crowd */
 
 #include "walkviewer.h"
 
@@ -78,17 +67,12 @@ int Step = CYCLE_SIZE/2;  /* Position in cycle, start in middle */
 float fStep = CYCLE_SIZE/2;   /* floating point for non-integer steping */
 float IncStep = 1.0;
 
-typedef struct ControlPts {
-  int numpoints;
-  float xcoords[MAX_CPOINTS];
-  float angles[MAX_CPOINTS];
-} tControlPts;
-
 tControlPts RotCurve[NUM_JOINTS];   /* series of cntrl points for ea joint */
 
 int Walking         = 0,     /* Guy is walking? */
     ViewPerspective = 1,     /* Perspective or orthographic views */
-    DrawAxes        = 0;     /* Draw axes for alignment */
+    DrawAxes        = 0,     /* Draw axes for alignment */
+    DrawCrowd       = 0;     /* Draw a crowd of guys instead of one */
 
 int CurveWWidth,             /* Dimensions of curve window */
     CurveWHeight;  
@@ -110,6 +94,7 @@ void CurveHandleMenu(int value);
 void StopWalking(void);
 void CurveHandleEditMenu(int curve);
 void ComputeCSetAndMakeLists(void);
+void MakeCSetLists(void);
 int MakeLoadAndSaveMenus(void);
 void CurveMenuInit(void);
 void SetWindowTitles(char *csetname);
@@ -118,77 +103,41 @@ void SetWindowTitles(char *csetname);
 /**************************** BEZIER ***************************/
 /***************************************************************/
 
-  /* Matrix times a vector  dest = m*v */
-void MultMV(float m[3][4], float v[4], float dest[3])
+  /* Copy Walk_cycle[0][joint][first..last] to the other leg */
+void CopyToOtherLeg(int joint, int first, int last)
 {
-  int i, j;
+  int i;
 
-  for (i = 0; i < 3; i++) {
-    dest[i] = 0;
-    for (j = 0; j < 4; j++)
-      dest[i] += m[i][j] * v[j];
+  for (i = first; i <= last; i++) {
+    if (MirrorLegs)
+      Walk_cycle[1][joint][i] =
+        Walk_cycle[0][joint][i];
+    else
+      Walk_cycle[1][joint][(i+(CYCLE_SIZE/2))%CYCLE_SIZE] =
+        Walk_cycle[0][joint][i];
   }
 }
 
-  /* Matrix multiplication, dest = m1*m2 */
-void MultM(float m1[3][4], float m2[4][4], float dest[3][4])
+void ComputeCurve(int joint)
 {
-  int i, j, k;
-
-  for (i = 0; i < 3; i++)
-    for (j = 0; j < 4; j++) {
-      dest[i][j] = 0;
-      for (k = 0; k < 4; k++)
-	  dest[i][j] += (m1[i][k] * m2[k][j]);
-    }
+  EvalCurves(&RotCurve[joint], 1, &Walk_cycle[0][joint]);
+  CopyToOtherLeg(joint, 0, CYCLE_SIZE-1);
 }
 
-void ComputeCurve(int joint)
+  /* Just the segments next to a control point that moved */
+void ComputeCurvePoint(int joint, int point)
 {
-  float prod[3][4], tm[4], pos[3];
-  float t = 0, tinc = (float)CYCLE_STEP/OVERSAMPLE;
-  int ctlpoint, i;
-  float BBasis[4][4] = {{-1, 3, -3, 1}, {3, -6, 3, 0},
-                        {-3, 3,  0, 0}, {1,  0, 0, 0}};
-  int lastindex, newindex;
-
-  float pointset[3][4];
-  for (i = 0; i < 4; i++)   /* z's are always zero, only 2-d */
-    pointset[2][i] = 0; 
-
-  lastindex = -1;
-  for(ctlpoint = 0; ctlpoint < RotCurve[joint].numpoints; ctlpoint += 3) {
-    t = 0;
-    for (i = 0; i < 4; i++)
-      pointset[0][i] = RotCurve[joint].xcoords[ctlpoint + i];
-    for (i = 0; i < 4; i++)
-      pointset[1][i] = RotCurve[joint].angles[ctlpoint + i];
-
-    MultM(pointset, BBasis, prod);
-
-    while (t <= 1) {
-      tm[0] = t*t*t;
-      tm[1] = t*t;
-      tm[2] = t;
-      tm[3] = 1;
-      MultMV(prod, tm, pos);
-      newindex = (int)(pos[0]*(CYCLE_SIZE-1));
-      if ((int)(newindex > lastindex))  {  /* go at least one */
-	Walk_cycle[0][joint][newindex] = pos[1];
-	lastindex++;
-      } 
-      t += tinc;
-    }
-  }
+  int first, last;
 
-  for (i = 0; i < CYCLE_SIZE; i++) {      /* copy to other leg, out-o-phase */
-    if (MirrorLegs)
-      Walk_cycle[1][joint][i] =
-        Walk_cycle[0][joint][i];
-    else
-      Walk_cycle[1][joint][i] =
-        Walk_cycle[0][joint][(i+(CYCLE_SIZE/2))%CYCLE_SIZE];
-  }
+  EvalCurvePoint(&RotCurve[joint], point, Walk_cycle[0][joint],
+                 &first, &last);
+  CopyToOtherLeg(joint, first, last);
+}
+
+  /* All the joints' first legs together, see MakeCSetLists */
+void ComputeCSet(void)
+{
+  EvalCurves(RotCurve, NUM_JOINTS, Walk_cycle[0]);
 }
 
 /***************************************************************/
@@ -214,47 +163,12 @@ void FlatCSet(void)
 
 int ReadCSetFromFile(char *filename)
 {
-  FILE *infile = fopen(filename, "r");
-  int numjoints, numpoints, joint, point, mirrorlegs;
-  float value;
+  if (ReadCSet(filename, RotCurve, &MirrorLegs) == 0)
+    return 0;
 
-  if (infile == NULL)
-    goto abort;
-  
-  if (!fscanf(infile, " %d", &numjoints) || numjoints != NUM_JOINTS)
-    goto abort;
-
-  if (!fscanf(infile, " %d", &mirrorlegs) || (mirrorlegs != 0 &&
-                                              mirrorlegs != 1))
-    goto abort;
-
-  MirrorLegs = mirrorlegs;
-
-  for (joint = 0; joint < NUM_JOINTS; joint++) {
-    if (!fscanf(infile, " %d", &numpoints) || numpoints < 4 || 
-                                              numpoints > MAX_CPOINTS)
-      goto abort;
-    RotCurve[joint].numpoints = numpoints;
-    for (point = 0; point < numpoints; point++) {
-      if (!fscanf(infile, " %f", &value))
-	goto abort;
-      RotCurve[joint].xcoords[point] = value;
-    }
-    for (point = 0; point < numpoints; point++) {
-      if (!fscanf(infile, " %f", &value))
-	goto abort;
-      RotCurve[joint].angles[point] = value;
-    }
-  }
-
-  fclose(infile);
-  return 0;
-
-  abort:
-    fclose(infile);
-    fprintf(stderr, "Something went wrong while reading file %s\n", filename);
-    FlatCSet();
-    return -1;
+  fprintf(stderr, "Something went wrong while reading file %s\n", filename);
+  FlatCSet();
+  return -1;
 }
 
 void WriteCSetToFile(char *filename)
@@ -299,13 +213,17 @@ void HandleLoadMenu(int cset)
   } else {
     (void)strcpy(filename, CSetNames[cset]);
     (void)strcat(filename, CSET_EXT);
-    if (ReadCSetFromFile(filename) == 0) {
-      glutSetMenu(SaveMenu);
-      glutChangeToMenuEntry(1, CSetNames[cset], cset);
-      ComputeCSetAndMakeLists();
-      SetWindowTitles(CSetNames[cset]);
-      RedisplayBoth();
+    if (CacheLoad(CSetNames[cset], RotCurve, &MirrorLegs, Walk_cycle[0])) {
+      if (ReadCSetFromFile(filename))
+        return;
+      ComputeCSet();
+      CacheStore(CSetNames[cset], RotCurve, MirrorLegs, Walk_cycle[0]);
     }
+    glutSetMenu(SaveMenu);
+    glutChangeToMenuEntry(1, CSetNames[cset], cset);
+    MakeCSetLists();
+    SetWindowTitles(CSetNames[cset]);
+    RedisplayBoth();
   }
 }
 
@@ -317,6 +235,7 @@ void HandleSaveMenu(int cset)
   (void)strcat(filename, CSET_EXT);
   WriteCSetToFile(filename);
   ComputeCSetAndMakeLists();
+  CacheStore(CSetNames[cset], RotCurve, MirrorLegs, Walk_cycle[0]);
   RedisplayBoth();
 }
 
@@ -422,16 +341,23 @@ void MakeJointLists(int joint)
 }
 
 
-void ComputeCSetAndMakeLists(void)
+  /* Both legs' lists from the first leg's cycles */
+void MakeCSetLists(void)
 {
   int joint;
 
   for(joint = 0; joint < NUM_JOINTS; joint++) {
-    ComputeCurve(joint);
+    CopyToOtherLeg(joint, 0, CYCLE_SIZE-1);
     MakeJointLists(joint);
   }
 }
 
+void ComputeCSetAndMakeLists(void)
+{
+  ComputeCSet();
+  MakeCSetLists();
+}
+
 void MakeLists(void)
 {
   HorizontalList = glGenLists(1);
@@ -692,7 +618,7 @@ void CurveEditHandleButton(int button, int state, int x, int y)
       fx = CurveEditConstrain(fx);
       RotCurve[EditingCurve].xcoords[CurvePickedPoint] = fx;
       RotCurve[EditingCurve].angles[CurvePickedPoint] = fy;        
-      ComputeCurve(EditingCurve);
+      ComputeCurvePoint(EditingCurve, CurvePickedPoint);
       MakeJointLists(EditingCurve);
       glutIdleFunc(NULL);
       RedisplayBoth();
@@ -736,7 +662,7 @@ void CurveCPointDrag(void)
     fx = CurveEditConstrain(fx);
     RotCurve[EditingCurve].xcoords[CurvePickedPoint] = fx;
     RotCurve[EditingCurve].angles[CurvePickedPoint] = fy;        
-    ComputeCurve(EditingCurve);
+    ComputeCurvePoint(EditingCurve, CurvePickedPoint);
     MakeJointLists(EditingCurve);
     RedisplayBoth();
   }
@@ -887,6 +813,33 @@ void CurveVisible(int v)
 /*********************** GUY WINDOW ****************************/
 /***************************************************************/
 
+void DrawTheGuy(void)
+{
+  switch(GuyModel) {
+    case WIRECUBE:   DrawTheGuy_WC();  break;
+    case SOLIDCUBE:  DrawTheGuy_SC();  break;
+    case CYLINDER1:  DrawTheGuy_SL();  break;
+    case CYLINDER2:  DrawTheGuy_SL2(); break;
+  }
+}
+
+  /* A crowd all walking the one set of cycles, each guy somewhere
+     else in it */
+void DrawTheCrowd(void)
+{
+  int i, j, step = Step;
+
+  for (i = 0; i < CROWD_SIZE; i++)
+    for (j = 0; j < CROWD_SIZE; j++) {
+      Step = (step + i*37 + j*61) % CYCLE_SIZE;
+      glPushMatrix();
+      glTranslatef((i - CROWD_SIZE/2) * 1.5, 0, (j - CROWD_SIZE/2) * 1.5);
+      DrawTheGuy();
+      glPopMatrix();
+    }
+  Step = step;
+}
+
 void GuyDisplay(void)
 {
   glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
@@ -899,12 +852,10 @@ void GuyDisplay(void)
   if (DrawAxes)
     glCallList(AxesList);
 
-  switch(GuyModel) {
-    case WIRECUBE:   DrawTheGuy_WC();  break;
-    case SOLIDCUBE:  DrawTheGuy_SC();  break;
-    case CYLINDER1:  DrawTheGuy_SL();  break;
-    case CYLINDER2:  DrawTheGuy_SL2(); break;
-  }
+  if (DrawCrowd)
+    DrawTheCrowd();
+  else
+    DrawTheGuy();
 
   glutSwapBuffers();
   glFlush();
@@ -966,7 +917,7 @@ void GuyHandleKeys(unsigned char key, int x, int y)
 }
 
 typedef enum { GMENU_QUIT, GMENU_CURVE, GMENU_HORIZ,
-               GMENU_AXES, GMENU_PERSP } GuyMenuChoices;
+               GMENU_AXES, GMENU_PERSP, GMENU_CROWD } GuyMenuChoices;
 
 
 void GuyModelHandleMenu(int model)
@@ -994,6 +945,10 @@ void GuyHandleMenu(int value)
       GuyReshape(glutGet(GLUT_WINDOW_WIDTH), glutGet(GLUT_WINDOW_HEIGHT));
       glutPostRedisplay();
       break;
+    case GMENU_CROWD:
+      DrawCrowd = !DrawCrowd;
+      glutPostRedisplay();
+      break;
   }
 }
 
@@ -1012,6 +967,7 @@ void GuyMenuInit(void)
   glutAddSubMenu("Model", sub2);
   glutAddMenuEntry("Toggle Axes",    GMENU_AXES);
   glutAddMenuEntry("Toggle Perspective View", GMENU_PERSP);
+  glutAddMenuEntry("Toggle Crowd",   GMENU_CROWD);
   glutAddMenuEntry("Quit",           GMENU_QUIT);
   glutAttachMenu(GLUT_RIGHT_BUTTON);
 }
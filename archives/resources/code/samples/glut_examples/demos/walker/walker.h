@@ -1,7 +1,8 @@
-#define CYCLE_SIZE 100
+#include "curves.h"
+
 #define CYCLE_STEP 1.0/CYCLE_SIZE
 
-extern GLfloat Walk_cycle[2][5][CYCLE_SIZE];
+extern GLfloat Walk_cycle[2][NUM_JOINTS][CYCLE_SIZE];
 
 extern int Step;
 
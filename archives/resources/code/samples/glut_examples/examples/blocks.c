@@ -0,0 +1,395 @@
+/*
+ *  blocks.c
+ *
+ *  Sliding block solver, see blocks.h.
+ *
+ *  A board is packed into 64 bits as the shape covering each of its 20
+ *  cells.  That is all it takes to find the pieces: scanning row by row,
+ *  a cell whose shape isn't yet accounted for has to be the top left of
+ *  a piece of that shape.  It also makes boards that only differ by
+ *  swapping two pieces of the same shape the same board, which is what
+ *  the old hash of convert[] codes did.  A move is then two masks: clear
+ *  the piece's cells, and fill them in again one cell over, if those
+ *  cells are empty.
+ *
+ *  The search goes one level (one move further from the start) at a
+ *  time.  Every board found is kept in one array with the index of the
+ *  board it was reached from, so a level is a run of the array.  Big
+ *  levels are split among threads; each makes the moves from its share
+ *  and keeps the boards not seen before in a list of its own, reading
+ *  the set of boards seen but not changing it.  Then the calling thread
+ *  adds the lists to the array and to the set, in order, so the result
+ *  doesn't depend on the number of threads.  The threads are the worker
+ *  pool in sig99/adv99/util.  The set is an open addressing hash table
+ *  of keys.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "blocks.h"
+#include "pool.h"
+
+#define CELLS (BLOCKS_WIDTH * BLOCKS_HEIGHT)
+#define SHAPES (BLOCKS_BIG + 1)
+#define NONE ((BlocksKey) -1)   /* an empty slot in the set */
+#define THREAD_MIN 4096         /* fewest boards in a level worth a thread */
+
+typedef struct {
+  BlocksKey key;
+  long from;                    /* index of the board moved from */
+} Board;
+
+typedef struct {
+  Board *board;
+  long n, size;
+  int failed;                   /* out of memory */
+} List;
+
+typedef struct {
+  List all;                     /* every board found, level by level */
+  BlocksKey *seen;              /* the same boards, hashed */
+  int bits;                     /* log2 of the size of seen */
+  long count;
+  List *lists;                  /* one per thread */
+} Search;
+
+static int shapeWidth[SHAPES] =
+{0, 1, 1, 2, 2};
+static int shapeHeight[SHAPES] =
+{0, 1, 2, 1, 2};
+
+/* For a piece of each shape with its top left at each cell: all the
+   bits of the cells it covers, its shape in those cells (0 if it
+   doesn't fit on the board), and the cells it covers a bit each. */
+static BlocksKey mask[SHAPES][CELLS];
+static BlocksKey fill[SHAPES][CELLS];
+static long covers[SHAPES][CELLS];
+static int tables;
+
+static int maxThreads;          /* 0 until set or first needed */
+
+static void
+makeTables(void)
+{
+  int c, p, x, y, i, j, q;
+
+  if (tables)
+    return;
+  for (c = 1; c < SHAPES; c++) {
+    for (p = 0; p < CELLS; p++) {
+      x = p % BLOCKS_WIDTH;
+      y = p / BLOCKS_WIDTH;
+      if (x + shapeWidth[c] > BLOCKS_WIDTH ||
+        y + shapeHeight[c] > BLOCKS_HEIGHT)
+        continue;
+      for (j = 0; j < shapeHeight[c]; j++) {
+        for (i = 0; i < shapeWidth[c]; i++) {
+          q = p + j * BLOCKS_WIDTH + i;
+          mask[c][p] |= (BlocksKey) 7 << (3 * q);
+          fill[c][p] |= (BlocksKey) c << (3 * q);
+          covers[c][p] |= 1L << q;
+        }
+      }
+    }
+  }
+  tables = 1;
+}
+
+BlocksKey
+blocksKey(char shapes[BLOCKS_HEIGHT][BLOCKS_WIDTH])
+{
+  BlocksKey key = 0;
+  int x, y, c;
+
+  for (y = 0; y < BLOCKS_HEIGHT; y++) {
+    for (x = 0; x < BLOCKS_WIDTH; x++) {
+      c = shapes[y][x];
+      if (c < 0 || c > BLOCKS_BIG)
+        c = BLOCKS_EMPTY;
+      key |= (BlocksKey) c << (3 * (y * BLOCKS_WIDTH + x));
+    }
+  }
+  return key;
+}
+
+int
+blocksShape(BlocksKey key, int x, int y)
+{
+  return (int) (key >> (3 * (y * BLOCKS_WIDTH + x))) & 7;
+}
+
+int
+blocksSolved(BlocksKey key)
+{
+  int p = (BLOCKS_HEIGHT - 2) * BLOCKS_WIDTH + (BLOCKS_WIDTH - 2) / 2;
+
+  makeTables();
+  return (key & mask[BLOCKS_BIG][p]) == fill[BLOCKS_BIG][p];
+}
+
+static void
+add(List *l, BlocksKey key, long from)
+{
+  Board *b;
+
+  if (l->n == l->size) {
+    b = (Board *) realloc(l->board, 2 * (l->size + 256) * sizeof(Board));
+    if (b == NULL) {
+      l->failed = 1;
+      return;
+    }
+    l->board = b;
+    l->size = 2 * (l->size + 256);
+  }
+  l->board[l->n].key = key;
+  l->board[l->n].from = from;
+  l->n++;
+}
+
+static unsigned long
+hash(BlocksKey key, int bits)
+{
+  /* Fibonacci hashing: the top bits of the key times 2^64 / phi */
+  return (unsigned long)
+    ((key * ((BlocksKey) 0x9e3779b9 << 32 | 0x7f4a7c15)) >> (64 - bits));
+}
+
+static int
+seen(Search *s, BlocksKey key)
+{
+  unsigned long h = hash(key, s->bits), m = (1UL << s->bits) - 1;
+
+  while (s->seen[h] != NONE) {
+    if (s->seen[h] == key)
+      return 1;
+    h = (h + 1) & m;
+  }
+  return 0;
+}
+
+/* Returns 1 if key is new, 0 if already seen, -1 if out of memory. */
+static int
+insert(Search *s, BlocksKey key)
+{
+  BlocksKey *old = s->seen;
+  unsigned long h, m, i, size = 1UL << s->bits;
+
+  if (old == NULL || 2 * (s->count + 1) > (long) size) {
+    if (old != NULL)
+      s->bits++;
+    m = (1UL << s->bits) - 1;
+    s->seen = (BlocksKey *) malloc((m + 1) * sizeof(BlocksKey));
+    if (s->seen == NULL) {
+      s->seen = old;
+      return -1;
+    }
+    for (i = 0; i <= m; i++)
+      s->seen[i] = NONE;
+    for (i = 0; old != NULL && i < size; i++) {
+      if (old[i] != NONE) {
+        for (h = hash(old[i], s->bits); s->seen[h] != NONE; h = (h + 1) & m);
+        s->seen[h] = old[i];
+      }
+    }
+    free(old);
+  }
+
+  m = (1UL << s->bits) - 1;
+  for (h = hash(key, s->bits); s->seen[h] != NONE; h = (h + 1) & m) {
+    if (s->seen[h] == key)
+      return 0;
+  }
+  s->seen[h] = key;
+  s->count++;
+  return 1;
+}
+
+/* Make every move from boards [begin, end), keeping the boards not yet
+   seen in out. */
+static void
+expand(Search *s, long begin, long end, List *out)
+{
+  unsigned char shape[CELLS], at[CELLS];
+  BlocksKey key, cleared;
+  long i, covered;
+  int n, k, c, p, x, y;
+
+#define TRY(q) \
+  if (!(cleared & mask[c][q]) && !seen(s, cleared | fill[c][q])) \
+    add(out, cleared | fill[c][q], i)
+
+  for (i = begin; i < end; i++) {
+    key = s->all.board[i].key;
+
+    /* find the pieces */
+    covered = 0;
+    n = 0;
+    for (p = 0; p < CELLS; p++) {
+      if (covered & (1L << p))
+        continue;
+      c = (int) (key >> (3 * p)) & 7;
+      if (c == BLOCKS_EMPTY)
+        continue;
+      shape[n] = c;
+      at[n++] = p;
+      covered |= covers[c][p];
+    }
+
+    /* and slide each one a cell each way */
+    for (k = 0; k < n; k++) {
+      c = shape[k];
+      p = at[k];
+      x = p % BLOCKS_WIDTH;
+      y = p / BLOCKS_WIDTH;
+      cleared = key & ~mask[c][p];
+      if (x > 0)
+        TRY(p - 1);
+      if (x + shapeWidth[c] < BLOCKS_WIDTH)
+        TRY(p + 1);
+      if (y > 0)
+        TRY(p - BLOCKS_WIDTH);
+      if (y + shapeHeight[c] < BLOCKS_HEIGHT)
+        TRY(p + BLOCKS_WIDTH);
+    }
+  }
+#undef TRY
+}
+
+/* A level split into shares, one list each, as a pool job. */
+
+typedef struct {
+  Search *search;
+  long begin;                   /* the level's first board */
+  int share;                    /* boards per list */
+} Level;
+
+static pool_t *pool;
+
+static void
+expandShare(void *arg, int begin, int end)
+{
+  Level *l = (Level *) arg;
+
+  expand(l->search, l->begin + begin, l->begin + end,
+    &l->search->lists[begin / l->share]);
+}
+
+static int
+threads(void)
+{
+  if (maxThreads == 0)
+    maxThreads = pool_cpus();
+  return maxThreads;
+}
+
+/* Expand the level [begin, end) into the first lists; returns how
+   many lists were used. */
+static int
+level(Search *s, long begin, long end)
+{
+  int lists = (end - begin) / THREAD_MIN, i;
+  Level l;
+
+  for (i = 0; i < maxThreads; i++)
+    s->lists[i].n = 0;
+  if (lists > maxThreads)
+    lists = maxThreads;
+  if (lists > 1 && pool == NULL)
+    pool = pool_new(maxThreads);
+  if (lists > pool_threads(pool))
+    lists = pool_threads(pool);
+  if (lists < 1)
+    lists = 1;
+
+  l.search = s;
+  l.begin = begin;
+  l.share = (end - begin + lists - 1) / lists;
+  pool_run(pool, expandShare, &l, lists, l.share, end - begin);
+  return lists;
+}
+
+int
+blocksSolve(BlocksKey start, BlocksSolution *solution)
+{
+  Search s;
+  Board *b;
+  long begin, end, goal = -1, i, k;
+  int lists, t, ok = 0;
+
+  makeTables();
+  memset(&s, 0, sizeof(s));
+  s.bits = 12;
+  solution->path = NULL;
+  solution->moves = -1;
+  solution->states = 0;
+
+  s.lists = (List *) calloc(threads(), sizeof(List));
+  if (s.lists == NULL || insert(&s, start) < 0)
+    goto done;
+  add(&s.all, start, -1);
+  if (s.all.failed)
+    goto done;
+  if (blocksSolved(start))
+    goal = 0;
+
+  for (begin = 0; goal < 0 && begin < s.all.n; begin = end) {
+    end = s.all.n;
+    lists = level(&s, begin, end);
+    for (t = 0; t < lists && goal < 0; t++) {
+      if (s.lists[t].failed)
+        goto done;
+      for (i = 0, b = s.lists[t].board; i < s.lists[t].n; i++, b++) {
+        /* the same board can come from more than one */
+        k = insert(&s, b->key);
+        if (k < 0)
+          goto done;
+        if (k == 0)
+          continue;
+        add(&s.all, b->key, b->from);
+        if (s.all.failed)
+          goto done;
+        if (blocksSolved(b->key)) {
+          goal = s.all.n - 1;
+          break;
+        }
+      }
+    }
+  }
+  solution->states = s.all.n;
+
+  if (goal >= 0) {
+    for (k = 0, i = goal; s.all.board[i].from >= 0; i = s.all.board[i].from)
+      k++;
+    solution->path = (BlocksKey *) malloc((k + 1) * sizeof(BlocksKey));
+    if (solution->path == NULL)
+      goto done;
+    solution->moves = k;
+    for (i = goal; k >= 0; i = s.all.board[i].from)
+      solution->path[k--] = s.all.board[i].key;
+  }
+  ok = 1;
+
+done:
+  for (t = 0; s.lists != NULL && t < maxThreads; t++)
+    free(s.lists[t].board);
+  free(s.lists);
+  free(s.all.board);
+  free(s.seen);
+  return ok;
+}
+
+void
+blocksFree(BlocksSolution *solution)
+{
+  free(solution->path);
+  solution->path = NULL;
+  solution->moves = -1;
+}
+
+void
+blocksThreads(int n)
+{
+  maxThreads = n < 0 ? 0 : n;
+  pool_delete(pool);
+  pool = NULL;
+}
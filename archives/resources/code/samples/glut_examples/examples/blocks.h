@@ -0,0 +1,49 @@
+/*
+ *  blocks.h
+ *
+ *  Breadth-first solver for glpuzzle's sliding block puzzle: any
+ *  layout of 1x1, 1x2, 2x1 and 2x2 pieces in the 4x5 tray, solved
+ *  when a 2x2 piece sits at the bottom middle, ready to slide out.
+ */
+
+#ifndef __blocks_h__
+#define __blocks_h__
+
+#define BLOCKS_WIDTH 4
+#define BLOCKS_HEIGHT 5
+
+/* What covers a cell.  Pieces of the same shape are interchangeable,
+   so a board is just the shape in each cell. */
+#define BLOCKS_EMPTY 0
+#define BLOCKS_SMALL 1          /* 1 x 1 */
+#define BLOCKS_TALL 2           /* 1 wide, 2 high */
+#define BLOCKS_WIDE 3           /* 2 wide, 1 high */
+#define BLOCKS_BIG 4            /* 2 x 2, to go to the bottom middle */
+
+/* A board packed three bits a cell, row by row from the top left. */
+#ifdef _WIN32
+typedef unsigned __int64 BlocksKey;
+#else
+typedef unsigned long long BlocksKey;
+#endif
+
+typedef struct {
+  BlocksKey *path;              /* moves + 1 boards, the start first */
+  int moves;                    /* -1 if it can't be solved */
+  long states;                  /* boards visited */
+} BlocksSolution;
+
+extern BlocksKey blocksKey(char shapes[BLOCKS_HEIGHT][BLOCKS_WIDTH]);
+extern int blocksShape(BlocksKey key, int x, int y);
+extern int blocksSolved(BlocksKey key);
+
+/* Find a shortest solution from start, moving one piece one cell at a
+   time.  Returns 0 if out of memory. */
+extern int blocksSolve(BlocksKey start, BlocksSolution *solution);
+extern void blocksFree(BlocksSolution *solution);
+
+/* The most threads blocksSolve may use; 0 for the number of
+   processors, which is what it uses unless set. */
+extern void blocksThreads(int threads);
+
+#endif /* __blocks_h__ */
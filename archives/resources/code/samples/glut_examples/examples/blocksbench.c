@@ -0,0 +1,122 @@
+/*
+ *  blocksbench.c
+ *
+ *  Time blocks.c, glpuzzle's solver, on a few layouts without any
+ *  drawing.  For each one prints the moves in the solution, the boards
+ *  visited, and the milliseconds and boards per second to solve it on
+ *  one thread and on as many as there are processors, and whether both
+ *  found the same solution.
+ *
+ *  usage: blocksbench
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "blocks.h"
+
+#ifdef _WIN32
+#include <windows.h>
+typedef int timer;
+#define getTime(a)	(a = GetTickCount())
+#define timeDiff(a, b)	((b - a) * 1000)
+#else
+#include <sys/time.h>
+typedef struct timeval timer;
+#define getTime(a)	gettimeofday(&a, NULL)
+#define timeDiff(a, b)	(((b.tv_sec - a.tv_sec) * 1000000) + b.tv_usec - a.tv_usec)
+#endif
+
+#define S BLOCKS_SMALL
+#define T BLOCKS_TALL
+#define W BLOCKS_WIDE
+#define B BLOCKS_BIG
+
+static struct {
+  char *name;
+  char shapes[BLOCKS_HEIGHT][BLOCKS_WIDTH];
+} layouts[] = {
+  {"glpuzzle", {
+    {T, B, B, T},
+    {T, B, B, T},
+    {T, W, W, T},
+    {T, S, S, T},
+    {S, 0, 0, S}}},
+  {"wide", {
+    {T, B, B, T},
+    {T, B, B, T},
+    {W, W, W, W},
+    {S, W, W, S},
+    {S, 0, 0, S}}},
+  {"small", {
+    {S, B, B, S},
+    {S, B, B, S},
+    {T, S, S, T},
+    {T, S, S, T},
+    {S, 0, 0, S}}},
+  {"few", {
+    {B, B, 0, 0},
+    {B, B, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, W, W},
+    {0, 0, 0, 0}}},
+  {"wall", {
+    {S, B, B, S},
+    {S, B, B, S},
+    {W, W, W, W},
+    {W, W, W, W},
+    {S, 0, 0, S}}},
+};
+
+#define LAYOUTS (sizeof(layouts) / sizeof(layouts[0]))
+
+/* milliseconds per solve */
+double
+run(BlocksKey start, BlocksSolution *solution)
+{
+  timer t0, t1;
+  long usec;
+  int n = 0;
+
+  getTime(t0);
+  do {
+    if (n)
+      blocksFree(solution);
+    if (!blocksSolve(start, solution)) {
+      fprintf(stderr, "blocksbench: out of memory\n");
+      exit(1);
+    }
+    getTime(t1);
+    usec = timeDiff(t0, t1);
+  } while (++n < 4 || usec < 250000);
+  return usec / 1000.0 / n;
+}
+
+int
+main(void)
+{
+  BlocksSolution one, all;
+  double t1, tn;
+  int i, same;
+
+  printf("%-10s %6s %8s %9s %12s %9s %12s %5s\n", "layout", "moves",
+    "boards", "ms 1", "boards/s 1", "ms n", "boards/s n", "same");
+  for (i = 0; i < (int) LAYOUTS; i++) {
+    BlocksKey start = blocksKey(layouts[i].shapes);
+
+    blocksThreads(1);
+    t1 = run(start, &one);
+    blocksThreads(0);
+    tn = run(start, &all);
+    same = one.moves == all.moves && one.states == all.states &&
+      (one.moves < 0 ||
+      !memcmp(one.path, all.path, (one.moves + 1) * sizeof(BlocksKey)));
+    printf("%-10s %6d %8ld %9.3f %12.0f %9.3f %12.0f %5s\n",
+      layouts[i].name, one.moves, one.states,
+      t1, one.states / t1 * 1000, tn, all.states / tn * 1000,
+      same ? "yes" : "NO");
+    blocksFree(&one);
+    blocksFree(&all);
+  }
+  return 0;
+}
@@ -7,6 +7,7 @@
 #include <math.h>
 #include <GL/glut.h>
 #include "trackball.h"
+#include "blocks.h"
 
 #define WIDTH 4
 #define HEIGHT 5
@@ -17,23 +18,12 @@
 
 typedef char Config[HEIGHT][WIDTH];
 
-struct puzzle {
-  struct puzzle *backptr;
-  struct puzzle *solnptr;
-  Config pieces;
-  struct puzzle *next;
-  unsigned hashvalue;
-};
-
-#define HASHSIZE 10691
-
-struct puzzlelist {
-  struct puzzle *puzzle;
-  struct puzzlelist *next;
-};
-
+/* the shape of each piece, as blocks.c knows them */
 static char convert[PIECES + 1] =
-{0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 4};
+{BLOCKS_EMPTY,
+  BLOCKS_SMALL, BLOCKS_SMALL, BLOCKS_SMALL, BLOCKS_SMALL,
+  BLOCKS_TALL, BLOCKS_TALL, BLOCKS_TALL, BLOCKS_TALL,
+  BLOCKS_WIDE, BLOCKS_BIG};
 
 static unsigned char colors[PIECES + 1][3] =
 {
@@ -52,10 +42,9 @@ static unsigned char colors[PIECES + 1][3] =
 
 void changeState(void);
 
-static struct puzzle *hashtable[HASHSIZE];
-static struct puzzle *startPuzzle;
-static struct puzzlelist *puzzles;
-static struct puzzlelist *lastentry;
+/* the boards from here to the solution, see solvePuzzle */
+static Config *solnpath;
+static int solnmoves, solnat;
 
 int curX, curY, visible;
 
@@ -102,19 +91,18 @@ static GLint viewport[4];
 #define srandom srand
 #define random() (rand() >> 2)
 
-unsigned
-hash(Config config)
+BlocksKey
+configKey(Config config)
 {
-  int i, j, value;
+  char shapes[HEIGHT][WIDTH];
+  int i, j;
 
-  value = 0;
   for (i = 0; i < HEIGHT; i++) {
     for (j = 0; j < WIDTH; j++) {
-      value = value + convert[config[i][j]];
-      value *= 6;
+      shapes[i][j] = convert[config[i][j]];
     }
   }
-  return (value);
+  return blocksKey(shapes);
 }
 
 int
@@ -445,78 +433,6 @@ redraw(void)
     glFinish();
 }
 
-void
-solidifyChain(struct puzzle *puzzle)
-{
-  int i;
-  char buf[256];
-
-  i = 0;
-  while (puzzle->backptr) {
-    i++;
-    puzzle->backptr->solnptr = puzzle;
-    puzzle = puzzle->backptr;
-  }
-  sprintf(buf, "%d moves to complete!", i);
-  glutSetWindowTitle(buf);
-}
-
-int
-addConfig(Config config, struct puzzle *back)
-{
-  unsigned hashvalue;
-  struct puzzle *newpiece;
-  struct puzzlelist *newlistentry;
-
-  hashvalue = hash(config);
-
-  newpiece = hashtable[hashvalue % HASHSIZE];
-  while (newpiece != NULL) {
-    if (newpiece->hashvalue == hashvalue) {
-      int i, j;
-
-      for (i = 0; i < WIDTH; i++) {
-        for (j = 0; j < HEIGHT; j++) {
-          if (convert[config[j][i]] !=
-            convert[newpiece->pieces[j][i]])
-            goto nomatch;
-        }
-      }
-      return 0;
-    }
-  nomatch:
-    newpiece = newpiece->next;
-  }
-
-  newpiece = (struct puzzle *) malloc(sizeof(struct puzzle));
-  newpiece->next = hashtable[hashvalue % HASHSIZE];
-  newpiece->hashvalue = hashvalue;
-  memcpy(newpiece->pieces, config, HEIGHT * WIDTH);
-  newpiece->backptr = back;
-  newpiece->solnptr = NULL;
-  hashtable[hashvalue % HASHSIZE] = newpiece;
-
-  newlistentry = (struct puzzlelist *) malloc(sizeof(struct puzzlelist));
-  newlistentry->puzzle = newpiece;
-  newlistentry->next = NULL;
-
-  if (lastentry) {
-    lastentry->next = newlistentry;
-  } else {
-    puzzles = newlistentry;
-  }
-  lastentry = newlistentry;
-
-  if (back == NULL) {
-    startPuzzle = newpiece;
-  }
-  if (solution(config)) {
-    solidifyChain(newpiece);
-    return 1;
-  }
-  return 0;
-}
-
 /* Checks if a space can move */
 int
 canmove0(Config pieces, int x, int y, int dir, Config newpieces)
@@ -582,23 +498,21 @@ canmove(Config pieces, int x, int y, int dir, Config newpieces)
   return canmove0(pieces, x + xadd, y + yadd, (dir + 2) % 4, newpieces);
 }
 
+/* Find the move from config to the board next, with the pieces
+   that made it. */
 int
-generateNewConfigs(struct puzzle *puzzle)
+findMove(Config config, BlocksKey next, Config newpieces)
 {
   int i, j, k;
-  Config pieces;
-  Config newpieces;
 
-  memcpy(pieces, puzzle->pieces, HEIGHT * WIDTH);
-  for (i = 0; i < WIDTH; i++) {
-    for (j = 0; j < HEIGHT; j++) {
-      if (pieces[j][i] == 0) {
-        for (k = 0; k < 4; k++) {
-          if (canmove0(pieces, i, j, k, newpieces)) {
-            if (addConfig(newpieces, puzzle))
-              return 1;
-          }
-        }
+  for (i = 0; i < HEIGHT; i++) {
+    for (j = 0; j < WIDTH; j++) {
+      if (config[i][j] == 0)
+        continue;
+      for (k = 0; k < 4; k++) {
+        if (canmove(config, j, i, k, newpieces) &&
+          configKey(newpieces) == next)
+          return 1;
       }
     }
   }
@@ -608,64 +522,47 @@ generateNewConfigs(struct puzzle *puzzle)
 void
 freeSolutions(void)
 {
-  struct puzzlelist *nextpuz;
-  struct puzzle *puzzle, *next;
-  int i;
-
-  while (puzzles) {
-    nextpuz = puzzles->next;
-    free((char *) puzzles);
-    puzzles = nextpuz;
-  }
-  lastentry = NULL;
-  for (i = 0; i < HASHSIZE; i++) {
-    puzzle = hashtable[i];
-    hashtable[i] = NULL;
-    while (puzzle) {
-      next = puzzle->next;
-      free((char *) puzzle);
-      puzzle = next;
-    }
-  }
-  startPuzzle = NULL;
+  free((char *) solnpath);
+  solnpath = NULL;
+  solnmoves = solnat = 0;
 }
 
 int
 continueSolving(void)
 {
-  struct puzzle *nextpuz;
+  char (*nextpuz)[WIDTH];
   int i, j;
   int movedPiece;
   int movedir;
   int fromx, fromy;
   int tox, toy;
 
-  if (startPuzzle == NULL)
+  if (solnpath == NULL)
     return 0;
-  if (startPuzzle->solnptr == NULL) {
+  if (solnat == solnmoves) {
     freeSolutions();
     return 0;
   }
-  nextpuz = startPuzzle->solnptr;
+  nextpuz = solnpath[solnat + 1];
   movedPiece = 0;
   movedir = 0;
   for (i = 0; i < HEIGHT; i++) {
     for (j = 0; j < WIDTH; j++) {
-      if (startPuzzle->pieces[i][j] != nextpuz->pieces[i][j]) {
-        if (startPuzzle->pieces[i][j]) {
-          movedPiece = startPuzzle->pieces[i][j];
+      if (solnpath[solnat][i][j] != nextpuz[i][j]) {
+        if (solnpath[solnat][i][j]) {
+          movedPiece = solnpath[solnat][i][j];
           fromx = j;
           fromy = i;
-          if (i < HEIGHT - 1 && nextpuz->pieces[i + 1][j] == movedPiece) {
+          if (i < HEIGHT - 1 && nextpuz[i + 1][j] == movedPiece) {
             movedir = 3;
           } else {
             movedir = 2;
           }
           goto found_piece;
         } else {
-          movedPiece = nextpuz->pieces[i][j];
+          movedPiece = nextpuz[i][j];
           if (i < HEIGHT - 1 &&
-            startPuzzle->pieces[i + 1][j] == movedPiece) {
+            solnpath[solnat][i + 1][j] == movedPiece) {
             fromx = j;
             fromy = i + 1;
             movedir = 1;
@@ -697,10 +594,10 @@ found_piece:
 
   if (move_x > tox - MOVE_SPEED / 2 && move_x < tox + MOVE_SPEED / 2 &&
     move_y > toy - MOVE_SPEED / 2 && move_y < toy + MOVE_SPEED / 2) {
-    startPuzzle = nextpuz;
+    solnat++;
     movingPiece = 0;
   }
-  memcpy(thePuzzle, startPuzzle->pieces, HEIGHT * WIDTH);
+  memcpy(thePuzzle, solnpath[solnat], HEIGHT * WIDTH);
   changeState();
   return 1;
 }
@@ -708,7 +605,7 @@ found_piece:
 int
 solvePuzzle(void)
 {
-  struct puzzlelist *nextpuz;
+  BlocksSolution soln;
   char buf[256];
   int i;
 
@@ -716,23 +613,33 @@ solvePuzzle(void)
     glutSetWindowTitle("Puzzle already solved!");
     return 0;
   }
-  addConfig(thePuzzle, NULL);
-  i = 0;
-
-  while (puzzles) {
-    i++;
-    if (generateNewConfigs(puzzles->puzzle))
-      break;
-    nextpuz = puzzles->next;
-    free((char *) puzzles);
-    puzzles = nextpuz;
+  if (!blocksSolve(configKey(thePuzzle), &soln)) {
+    glutSetWindowTitle("Out of memory!");
+    return 0;
   }
-  if (puzzles == NULL) {
-    freeSolutions();
-    sprintf(buf, "I can't solve it! (%d positions examined)", i);
+  if (soln.moves < 0) {
+    sprintf(buf, "I can't solve it! (%ld positions examined)", soln.states);
     glutSetWindowTitle(buf);
     return 1;
   }
+
+  /* put names back on the pieces */
+  solnpath = (Config *) malloc((soln.moves + 1) * sizeof(Config));
+  if (solnpath == NULL) {
+    blocksFree(&soln);
+    glutSetWindowTitle("Out of memory!");
+    return 0;
+  }
+  memcpy(solnpath[0], thePuzzle, HEIGHT * WIDTH);
+  for (i = 1; i <= soln.moves; i++) {
+    findMove(solnpath[i - 1], soln.path[i], solnpath[i]);
+  }
+  solnmoves = soln.moves;
+  solnat = 0;
+  blocksFree(&soln);
+
+  sprintf(buf, "%d moves to complete!", solnmoves);
+  glutSetWindowTitle(buf);
   return 1;
 }
 
@@ -1413,7 +1320,7 @@ main(int argc, char **argv)
 
   printf("\n");
   printf("r   Reset puzzle\n");
-  printf("s   Solve puzzle (may take a few seconds to compute)\n");
+  printf("s   Solve puzzle\n");
   printf("d   Destroy a piece - makes the puzzle easier\n");
   printf("b   Toggles the depth buffer on and off\n");
   printf("\n");
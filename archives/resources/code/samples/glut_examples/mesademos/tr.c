@@ -15,6 +15,49 @@
 
 #include "tr.h"
 
+/* Win32 builds write strips from the rendering thread */
+#if defined(WIN32) && !defined(TR_NO_THREADS)
+#define TR_NO_THREADS
+#endif
+
+#ifndef TR_NO_THREADS
+#include <pthread.h>
+#endif
+
+
+/* StripSeq values for strips that are not waiting to be written */
+#define TR_STRIP_FREE -1
+#define TR_STRIP_BUSY -2
+
+
+struct _TRstream {
+   FILE *File;
+   GLint ImageWidth, ImageHeight;
+   GLint TileHeight, Rows;
+
+   int NumContexts, Attached;
+
+   /* pool of tile-high RGB strips */
+   int NumStrips;
+   GLubyte **Strip;
+   GLint *StripSeq;
+   GLint *StripHeight;
+   long StripBytes;
+
+   /* sequence number (0 = top row) of the next strip to write */
+   GLint NextSeq;
+
+   /* file offset of the first pixel, for writing rows out of order */
+   long DataStart;
+
+#ifndef TR_NO_THREADS
+   pthread_t Writer;
+   pthread_mutex_t Lock;
+   pthread_cond_t Changed;
+   int Done;
+#endif
+};
+
 
 
 struct _TRctx {
@@ -37,6 +80,11 @@ struct _TRctx {
    GLint CurrentRow, CurrentColumn;
 
    GLint ViewportSave[4];
+
+   /* streaming mode, see trStreamAttach() */
+   TRstream *Stream;
+   int StreamIndex;
+   int StripIndex;
 };
 
 
@@ -64,6 +112,7 @@ void trSetup(TRcontext *tr,
    tr->ImageWidth = imageWidth;
    tr->ImageHeight = imageHeight;
    tr->Image = image;
+   tr->Stream = NULL;
    tr->TileWidth = tileWidth;
    tr->TileHeight = tileHeight;
 
@@ -76,6 +125,24 @@ void trSetup(TRcontext *tr,
 }
 
 
+/* Number of tiles this context renders before trEndTile() returns 0.
+ * A stream context has none if there are more contexts than rows.
+ */
+static int numTiles(const TRcontext *tr)
+{
+   int rows;
+
+   if (!tr->Stream)
+      return tr->Rows * tr->Columns;
+
+   if (tr->StreamIndex >= tr->Rows)
+      return 0;
+   rows = (tr->Rows - tr->StreamIndex + tr->Stream->NumContexts - 1)
+        / tr->Stream->NumContexts;
+   return rows * tr->Columns;
+}
+
+
 void trOrtho(TRcontext *tr,
 	     GLdouble left, GLdouble right,
 	     GLdouble bottom, GLdouble top,
@@ -133,7 +200,7 @@ void trBeginTile(TRcontext *tr)
    int tileWidth, tileHeight;
    GLdouble left, right, bottom, top;
 
-   if (!tr)
+   if (!tr || tr->CurrentTile >= numTiles(tr))
       return;
 
    if (tr->CurrentTile==0) {
@@ -145,6 +212,12 @@ void trBeginTile(TRcontext *tr)
    tr->CurrentRow = tr->CurrentTile / tr->Columns;
    tr->CurrentColumn = tr->CurrentTile % tr->Columns;
 
+   if (tr->Stream) {
+      /* streams are written top row first, interleaved between contexts */
+      tr->CurrentRow = tr->Rows - 1 - tr->StreamIndex
+                     - tr->CurrentRow * tr->Stream->NumContexts;
+   }
+
    /* actual size of this tile */
    if (tr->CurrentRow < tr->Rows-1)
       tileHeight = tr->TileHeight;
@@ -185,18 +258,197 @@ void trBeginTile(TRcontext *tr)
 }
 
 
+static void lockStream(TRstream *s)
+{
+#ifndef TR_NO_THREADS
+   pthread_mutex_lock(&s->Lock);
+#else
+   (void) s;
+#endif
+}
+
+
+static void unlockStream(TRstream *s)
+{
+#ifndef TR_NO_THREADS
+   pthread_mutex_unlock(&s->Lock);
+#else
+   (void) s;
+#endif
+}
+
+
+/* Write one strip to the file.  Strips are stored bottom row first, as
+ * read back by OpenGL, while PPM scanlines go top to bottom.
+ */
+static void writeStrip(TRstream *s, int i)
+{
+   long rowBytes = (long) s->ImageWidth * 3;
+   GLint r;
+
+   for (r = s->StripHeight[i] - 1; r >= 0; r--)
+      fwrite(s->Strip[i] + r * rowBytes, 1, rowBytes, s->File);
+}
+
+
+#ifndef TR_NO_THREADS
+
+/* Index of the strip holding row sequence number seq, or -1 */
+static int findStrip(const TRstream *s, GLint seq)
+{
+   int i;
+   for (i = 0; i < s->NumStrips; i++) {
+      if (s->StripSeq[i] == seq)
+         return i;
+   }
+   return -1;
+}
+
+
+static void *writerThread(void *arg)
+{
+   TRstream *s = (TRstream *) arg;
+   int i;
+
+   pthread_mutex_lock(&s->Lock);
+   for (;;) {
+      i = findStrip(s, s->NextSeq);
+      if (i >= 0) {
+         /* encode outside the lock so rendering can carry on */
+         pthread_mutex_unlock(&s->Lock);
+         writeStrip(s, i);
+         pthread_mutex_lock(&s->Lock);
+         s->StripSeq[i] = TR_STRIP_FREE;
+         s->NextSeq++;
+         pthread_cond_broadcast(&s->Changed);
+      }
+      else if (s->Done)
+         break;
+      else
+         pthread_cond_wait(&s->Changed, &s->Lock);
+   }
+   pthread_mutex_unlock(&s->Lock);
+   return NULL;
+}
+
+
+/* Get a strip for row sequence number seq.  Only rows less than
+ * NumStrips ahead of the writer get one, so however far one context
+ * runs ahead, the row the writer is waiting for always finds a free
+ * strip.
+ */
+static int acquireStrip(TRstream *s, GLint seq)
+{
+   int i;
+
+   pthread_mutex_lock(&s->Lock);
+   while (seq >= s->NextSeq + s->NumStrips
+          || (i = findStrip(s, TR_STRIP_FREE)) < 0)
+      pthread_cond_wait(&s->Changed, &s->Lock);
+   s->StripSeq[i] = TR_STRIP_BUSY;
+   pthread_mutex_unlock(&s->Lock);
+   return i;
+}
+
+
+/* Hand a finished row to the writer */
+static void submitStrip(TRstream *s, int i, GLint seq, GLint height)
+{
+   pthread_mutex_lock(&s->Lock);
+   s->StripHeight[i] = height;
+   s->StripSeq[i] = seq;
+   pthread_cond_broadcast(&s->Changed);
+   pthread_mutex_unlock(&s->Lock);
+}
+
+#else
+
+/* Without threads there is one strip, written as soon as it's full */
+static int acquireStrip(TRstream *s, GLint seq)
+{
+   (void) s;
+   (void) seq;
+   return 0;
+}
+
+
+/* Write a finished row in its place.  Rows from several contexts may
+ * come out of order, in which case the file must be seekable.
+ */
+static void submitStrip(TRstream *s, int i, GLint seq, GLint height)
+{
+   long line;
+
+   if (seq != s->NextSeq) {
+      /* the top strip is the short one */
+      line = seq ? s->ImageHeight - (long) (s->Rows - seq) * s->TileHeight : 0;
+      fseek(s->File, s->DataStart + line * s->ImageWidth * 3, SEEK_SET);
+   }
+   s->StripHeight[i] = height;
+   writeStrip(s, i);
+   s->NextSeq = seq + 1;
+}
+
+#endif
+
+
+static int streamEndTile(TRcontext *tr)
+{
+   TRstream *s = tr->Stream;
+   GLint prevRowLength, prevSkipRows, prevSkipPixels, prevAlignment;
+
+   if (tr->CurrentColumn == 0)
+      tr->StripIndex = acquireStrip(s, tr->Rows - 1 - tr->CurrentRow);
+
+   glGetIntegerv(GL_PACK_ROW_LENGTH, &prevRowLength);
+   glGetIntegerv(GL_PACK_SKIP_ROWS, &prevSkipRows);
+   glGetIntegerv(GL_PACK_SKIP_PIXELS, &prevSkipPixels);
+   glGetIntegerv(GL_PACK_ALIGNMENT, &prevAlignment);
+
+   glPixelStorei(GL_PACK_ROW_LENGTH, tr->ImageWidth);
+   glPixelStorei(GL_PACK_SKIP_ROWS, 0);
+   glPixelStorei(GL_PACK_SKIP_PIXELS, tr->TileWidth * tr->CurrentColumn);
+   glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+   /* read the tile into its place in the current strip */
+   glReadPixels(0, 0, tr->CurrentTileWidth, tr->CurrentTileHeight,
+		GL_RGB, GL_UNSIGNED_BYTE, s->Strip[tr->StripIndex]);
+
+   glPixelStorei(GL_PACK_ROW_LENGTH, prevRowLength);
+   glPixelStorei(GL_PACK_SKIP_ROWS, prevSkipRows);
+   glPixelStorei(GL_PACK_SKIP_PIXELS, prevSkipPixels);
+   glPixelStorei(GL_PACK_ALIGNMENT, prevAlignment);
+
+   if (tr->CurrentColumn == tr->Columns - 1)
+      submitStrip(s, tr->StripIndex, tr->Rows - 1 - tr->CurrentRow,
+                  tr->CurrentTileHeight);
+
+   tr->CurrentTile++;
+   if (tr->CurrentTile >= numTiles(tr)) {
+      glViewport(tr->ViewportSave[0], tr->ViewportSave[1],
+		 tr->ViewportSave[2], tr->ViewportSave[3]);
+      return 0;
+   }
+   else
+      return 1;
+}
+
+
 
 int trEndTile(TRcontext *tr)
 {
    GLint prevRowLength, prevSkipRows, prevSkipPixels, prevAlignment;
    GLint x, y;
 
-   if (!tr)
+   if (!tr || tr->CurrentTile >= numTiles(tr))
       return 0;
 
    /* be sure OpenGL rendering is finished */
    glFlush();
 
+   if (tr->Stream)
+      return streamEndTile(tr);
+
    /* save current glPixelStore values */
    glGetIntegerv(GL_PACK_ROW_LENGTH, &prevRowLength);
    glGetIntegerv(GL_PACK_SKIP_ROWS, &prevSkipRows);
@@ -224,7 +476,7 @@ int trEndTile(TRcontext *tr)
 
    /* increment tile counter, return 1 if more tiles left to render */
    tr->CurrentTile++;
-   if (tr->CurrentTile >= tr->Rows * tr->Columns) {
+   if (tr->CurrentTile >= numTiles(tr)) {
       /* restore user's viewport */
       glViewport(tr->ViewportSave[0], tr->ViewportSave[1],
 		 tr->ViewportSave[2], tr->ViewportSave[3]);
@@ -234,3 +486,139 @@ int trEndTile(TRcontext *tr)
       return 1;
 }
 
+
+
+
+TRstream *trStreamNew(FILE *file,
+		      GLint imageWidth, GLint imageHeight,
+		      GLint tileHeight, int numContexts)
+{
+   TRstream *s;
+   int i;
+
+   if (!file || numContexts < 1)
+      return NULL;
+
+   s = (TRstream *) calloc(1, sizeof(TRstream));
+   if (!s)
+      return NULL;
+
+   s->File = file;
+   s->ImageWidth = imageWidth;
+   s->ImageHeight = imageHeight;
+   s->TileHeight = tileHeight;
+   s->Rows = (imageHeight + tileHeight - 1) / tileHeight;
+   s->NumContexts = numContexts;
+
+#ifndef TR_NO_THREADS
+   /* one strip being filled and one being written per context */
+   s->NumStrips = 2 * numContexts;
+   if (s->NumStrips > s->Rows)
+      s->NumStrips = s->Rows;
+#else
+   s->NumStrips = 1;
+#endif
+   s->Strip = (GLubyte **) calloc(s->NumStrips, sizeof(GLubyte *));
+   s->StripSeq = (GLint *) calloc(s->NumStrips, sizeof(GLint));
+   s->StripHeight = (GLint *) calloc(s->NumStrips, sizeof(GLint));
+   s->StripBytes = (long) imageWidth * tileHeight * 3;
+   for (i = 0; s->Strip && i < s->NumStrips; i++) {
+      s->Strip[i] = (GLubyte *) malloc(s->StripBytes);
+      if (!s->Strip[i])
+         break;
+      s->StripSeq[i] = TR_STRIP_FREE;
+   }
+   if (!s->Strip || !s->StripSeq || !s->StripHeight || i < s->NumStrips) {
+      while (s->Strip && --i >= 0)
+         free(s->Strip[i]);
+      free(s->Strip);
+      free(s->StripSeq);
+      free(s->StripHeight);
+      free(s);
+      return NULL;
+   }
+
+   fprintf(file, "P6\n%d %d\n255\n", (int) imageWidth, (int) imageHeight);
+   s->DataStart = ftell(file);
+
+#ifndef TR_NO_THREADS
+   pthread_mutex_init(&s->Lock, NULL);
+   pthread_cond_init(&s->Changed, NULL);
+   pthread_create(&s->Writer, NULL, writerThread, s);
+#endif
+
+   return s;
+}
+
+
+/* Waits for all submitted rows to be written.  The file is flushed but
+ * left open for the caller to close.
+ */
+void trStreamDelete(TRstream *s)
+{
+   int i;
+
+   if (!s)
+      return;
+
+#ifndef TR_NO_THREADS
+   pthread_mutex_lock(&s->Lock);
+   s->Done = 1;
+   pthread_cond_broadcast(&s->Changed);
+   pthread_mutex_unlock(&s->Lock);
+   pthread_join(s->Writer, NULL);
+   pthread_cond_destroy(&s->Changed);
+   pthread_mutex_destroy(&s->Lock);
+#endif
+
+   fflush(s->File);
+   for (i = 0; i < s->NumStrips; i++)
+      free(s->Strip[i]);
+   free(s->Strip);
+   free(s->StripSeq);
+   free(s->StripHeight);
+   free(s);
+}
+
+
+/* Set up tr to render its share of the stream's rows.  Call once per
+ * context, in place of trSetup().
+ */
+void trStreamAttach(TRcontext *tr, TRstream *s, GLint tileWidth)
+{
+   int index;
+
+   if (!tr || !s)
+      return;
+
+   lockStream(s);
+   index = s->Attached < s->NumContexts ? s->Attached++ : -1;
+   unlockStream(s);
+   if (index < 0)
+      return;
+
+   tr->ImageWidth = s->ImageWidth;
+   tr->ImageHeight = s->ImageHeight;
+   tr->Image = NULL;
+   tr->TileWidth = tileWidth;
+   tr->TileHeight = s->TileHeight;
+
+   tr->Columns = (tr->ImageWidth + tr->TileWidth - 1) / tr->TileWidth;
+   tr->Rows = s->Rows;
+   tr->CurrentTile = 0;
+
+   tr->Stream = s;
+   tr->StreamIndex = index;
+
+   assert(tr->Columns >= 1);
+   assert(tr->Rows >= 1);
+}
+
+
+/* Bytes of strip memory held by the stream */
+long trStreamPeakBytes(const TRstream *s)
+{
+   if (!s)
+      return 0;
+   return s->NumStrips * s->StripBytes;
+}
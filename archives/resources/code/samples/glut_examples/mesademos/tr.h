@@ -40,6 +40,35 @@
  *       trDelete(t);
  *
  *
+ * Streaming usage:
+ *
+ * For images too large to hold in memory, a TRstream writes finished
+ * rows of tiles straight to a binary PPM file, top row first.  Only a
+ * few tile-high strips are resident at any time, and the strips are
+ * written by a worker thread while the next row is being rendered.
+ *
+ *       FILE *f = fopen("poster.ppm", "wb");
+ *       TRstream *s = trStreamNew(f, W, H, tileHeight, 1);
+ *       trStreamAttach(t, s, tileWidth);
+ *       trPerspective(t, ...);
+ *       do {
+ *           trBeginTile(t);
+ *           DrawMyScene();
+ *       } while (trEndTile(t));
+ *       trStreamDelete(s);
+ *
+ * Several contexts (e.g. one offscreen context per thread) may be
+ * attached to the same stream.  Context k of n renders tile rows
+ * k, k+n, k+2n, ... and the stream puts the rows back in order.  A
+ * context more than two rounds of rows ahead of the others waits in
+ * trEndTile() for them to catch up; contexts driven from one thread
+ * must take turns a row at a time.  For a context left with no rows,
+ * trBeginTile() does nothing and trEndTile() returns 0.  Built with
+ * TR_NO_THREADS, all contexts must be driven from one thread; rows are
+ * written as soon as they are read back, so with several contexts the
+ * file must be seekable.
+ *
+ *
  * Brian Paul
  * April 1997
  */
@@ -53,10 +82,13 @@
 #include <windows.h>
 #endif
 #include <GL/gl.h>
+#include <stdio.h>
 
 
 typedef struct _TRctx TRcontext;
 
+typedef struct _TRstream TRstream;
+
 
 extern TRcontext *trNew(void);
 
@@ -92,4 +124,18 @@ extern void trBeginTile(TRcontext *tr);
 extern int trEndTile(TRcontext *tr);
 
 
+extern TRstream *trStreamNew(FILE *file,
+			     GLint imageWidth, GLint imageHeight,
+			     GLint tileHeight, int numContexts);
+
+
+extern void trStreamDelete(TRstream *s);
+
+
+extern void trStreamAttach(TRcontext *tr, TRstream *s, GLint tileWidth);
+
+
+extern long trStreamPeakBytes(const TRstream *s);
+
+
 #endif
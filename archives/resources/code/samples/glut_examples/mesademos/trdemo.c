@@ -5,6 +5,13 @@
  * Test/demonstration of tile rendering utility library.
  * See tr.h for more info.
  *
+ * Usage: trdemo [-stream file.ppm width height [contexts]]
+ *
+ * With -stream the scene is rendered at the given size straight to a
+ * PPM file instead of into an in-memory image.  With more than one
+ * context the contexts take turns a row at a time, and the file is
+ * checked against the same scene rendered into memory.
+ *
  * Brian Paul
  * April 1997
  */
@@ -12,6 +19,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "GL/glut.h"
 #include "tr.h"
 
@@ -27,6 +35,10 @@ static GLboolean Perspective = GL_TRUE;
 
 static int WindowWidth, WindowHeight;
 
+static char *StreamFile = NULL;
+static int StreamWidth, StreamHeight;
+static int StreamContexts = 1;
+
 
 /* Return random float in [0,1] */
 static float Random(void)
@@ -54,6 +66,146 @@ static void DrawScene(void)
 }
 
 
+static void SetProjection(TRcontext *tr)
+{
+   if (Perspective)
+      trFrustum(tr, -1.0, 1.0, -1.0, 1.0, 5.0, 25.0);
+   else
+      trOrtho(tr, -3.0, 3.0, -3.0, 3.0, -3.0, 3.0);
+}
+
+
+static void Report(int tiles, int msec, long bytes)
+{
+   printf("%d tiles drawn in %d ms (%.1f tiles/sec), peak image memory %ld KB\n",
+          tiles, msec, msec > 0 ? tiles * 1000.0 / msec : 0.0, bytes / 1024);
+}
+
+
+/* Compare StreamFile with the scene rendered into memory; returns the
+ * number of pixels that differ, or -1 if it couldn't check.
+ */
+static long CheckStream(void)
+{
+   FILE *f;
+   TRcontext *tr;
+   GLubyte *image, *row;
+   int w, h, x, y;
+   long bad = 0;
+
+   f = fopen(StreamFile, "rb");
+   if (!f)
+      return -1;
+   image = malloc((long) StreamWidth * StreamHeight * 4);
+   row = malloc((long) StreamWidth * 3);
+   if (!image || !row || fscanf(f, "P6 %d %d 255", &w, &h) != 2
+       || w != StreamWidth || h != StreamHeight || fgetc(f) != '\n') {
+      free(image);
+      free(row);
+      fclose(f);
+      return -1;
+   }
+
+   tr = trNew();
+   trSetup(tr, StreamWidth, StreamHeight, image, TILESIZE, TILESIZE);
+   SetProjection(tr);
+   do {
+      trBeginTile(tr);
+      DrawScene();
+   } while (trEndTile(tr));
+   trDelete(tr);
+
+   /* the image is bottom row first, the file top row first */
+   for (y = h - 1; y >= 0; y--) {
+      if (fread(row, 3, w, f) != (size_t) w) {
+         bad += (long) (y + 1) * w;
+         break;
+      }
+      for (x = 0; x < w; x++) {
+         if (memcmp(row + x * 3, image + ((long) y * w + x) * 4, 3) != 0)
+            bad++;
+      }
+   }
+
+   free(image);
+   free(row);
+   fclose(f);
+   return bad;
+}
+
+
+/* Render the scene to StreamFile one row of tiles at a time */
+static void StreamScene(void)
+{
+   FILE *f;
+   TRstream *s;
+   TRcontext *tr[4];
+   GLint viewport[4];
+   int columns = (StreamWidth + TILESIZE - 1) / TILESIZE;
+   int rows = (StreamHeight + TILESIZE - 1) / TILESIZE;
+   int active, more = 1;
+   int start;
+   int i, c;
+   long bad;
+
+   f = fopen(StreamFile, "wb");
+   if (!f) {
+      printf("Couldn't open %s\n", StreamFile);
+      return;
+   }
+
+   glGetIntegerv(GL_VIEWPORT, viewport);
+   start = glutGet(GLUT_ELAPSED_TIME);
+   s = trStreamNew(f, StreamWidth, StreamHeight, TILESIZE, StreamContexts);
+   for (i = 0; i < StreamContexts; i++) {
+      tr[i] = trNew();
+      trStreamAttach(tr[i], s, TILESIZE);
+      SetProjection(tr[i]);
+   }
+
+   /* each context renders a row of tiles in turn */
+   active = StreamContexts;
+   while (active > 0) {
+      for (i = 0; i < StreamContexts; i++) {
+         if (!tr[i])
+            continue;
+         for (c = 0; c < columns; c++) {
+            trBeginTile(tr[i]);
+            DrawScene();
+            more = trEndTile(tr[i]);
+            if (!more)
+               break;
+         }
+         if (!more) {
+            trDelete(tr[i]);
+            tr[i] = NULL;
+            active--;
+         }
+      }
+   }
+
+   Report(rows * columns, glutGet(GLUT_ELAPSED_TIME) - start,
+          trStreamPeakBytes(s));
+   trStreamDelete(s);
+   fclose(f);
+   glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+   printf("wrote %dx%d image to %s with %d context%s\n", StreamWidth,
+          StreamHeight, StreamFile, StreamContexts,
+          StreamContexts > 1 ? "s" : "");
+
+   if (StreamContexts > 1) {
+      bad = CheckStream();
+      if (bad < 0)
+         printf("couldn't check %s\n", StreamFile);
+      else if (bad > 0)
+         printf("%ld pixels differ from the in-memory image\n", bad);
+      else
+         printf("matches the in-memory image\n");
+      glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+   }
+}
+
+
 /* Do a demonstration of tiled rendering */
 static void Display(void)
 {
@@ -61,6 +213,7 @@ static void Display(void)
    int tile = 0;
    TRcontext *tr;
    int i;
+   int start;
 
    /* Generate random balls */
    for (i=0;i<NUMBALLS;i++) {
@@ -74,7 +227,15 @@ static void Display(void)
       BallColor[i][3] = 1.0;
    }
 
+   if (StreamFile) {
+      StreamScene();
+      glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+      glFlush();
+      return;
+   }
+
    /* allocate final image buffer */
+   start = glutGet(GLUT_ELAPSED_TIME);
    image = malloc(WindowWidth * WindowHeight * 4 * sizeof(GLubyte));
    if (!image) {
       printf("Malloc failed!\n");
@@ -85,10 +246,7 @@ static void Display(void)
    tr = trNew();
    trSetup(tr, WindowWidth, WindowHeight, (GLubyte *) image,
 	   TILESIZE, TILESIZE);
-   if (Perspective)
-      trFrustum(tr, -1.0, 1.0, -1.0, 1.0, 5.0, 25.0);
-   else
-      trOrtho(tr, -3.0, 3.0, -3.0, 3.0, -3.0, 3.0);
+   SetProjection(tr);
 
    /* Draw tiles */
    do {
@@ -96,7 +254,8 @@ static void Display(void)
       DrawScene();
       tile++;
    } while (trEndTile(tr));
-   printf("%d tiles drawn\n", tile);
+   Report(tile, glutGet(GLUT_ELAPSED_TIME) - start,
+          (long) WindowWidth * WindowHeight * 4);
 
    trDelete(tr);
 
@@ -153,6 +312,17 @@ static void Init( void )
 int main( int argc, char *argv[] )
 {
    glutInit( &argc, argv );
+   if ((argc == 5 || argc == 6) && strcmp(argv[1], "-stream") == 0) {
+      StreamFile = argv[2];
+      StreamWidth = atoi(argv[3]);
+      StreamHeight = atoi(argv[4]);
+      if (argc == 6)
+         StreamContexts = atoi(argv[5]);
+      if (StreamContexts < 1 || StreamContexts > 4) {
+         printf("Contexts must be 1 to 4\n");
+         exit(1);
+      }
+   }
    glutInitWindowPosition(0, 0);
    glutInitWindowSize( 500, 500 );
    glutInitDisplayMode( GLUT_RGB | GLUT_DEPTH );
@@ -17,10 +17,13 @@
 #include <math.h>
 #include <stdio.h>
 #include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
 #include <GL/glut.h>
 
 #include "trackball.h"
 #include "glui.h"
+#include "physics.h"
 
 #define UDIV 12
 #define VDIV 12
@@ -30,6 +33,10 @@
 
 #define TOTALBALLS 3
 
+#define SUBSTEPS 4		/* physics steps per frame */
+#define SDIV 8			/* tesselation of the small balls */
+#define CHUNK 1024		/* small balls per glDrawElements */
+
 #define R 0
 #define G 1
 #define B 2
@@ -52,11 +59,12 @@ int window;				/* main window id */
 
 GLboolean performance = GL_FALSE;	/* performance indicator */
 
-struct {
-   float p[3];
-   float d[3];
-   unsigned char color[3];
-} balls[TOTALBALLS];
+PHworld *world;				/* the lights, then the small balls */
+int smallballs = 0;			/* set with -n */
+
+unsigned char ballcolor[TOTALBALLS][3] = {
+    { 255, 64, 64 }, { 64, 255, 64 }, { 64, 64, 255 }
+};
 
 float ballobj[UDIV+1][VDIV+1][4];
 float wallobj[WALLGRIDMAX+1][WALLGRIDMAX+1][4];
@@ -65,8 +73,8 @@ float wallnorm[3] = { 0.0, 0.0, -1.0 };
 
 int orx, ory;
 
-float ballscale;
 float ballsize;
+float smallsize;
 
 int DELTAX, DELTAY;
 
@@ -103,7 +111,13 @@ GLfloat wall_Ks[] = { 1.0, 1.0, 1.0, 1.0 };  /* specular */
 GLfloat wall_Ke[] = { 0.0, 0.0, 0.0, 1.0 };  /* emission */
 GLfloat wall_Se   = 20.0;                    /* shininess */
 
-GLuint wall_material, plane_material; /* material display lists */
+GLfloat ball_Ka[] = { 0.5, 0.5, 0.5, 1.0 };  /* ambient */
+GLfloat ball_Kd[] = { 0.6, 0.6, 0.6, 1.0 };  /* diffuse */
+GLfloat ball_Ks[] = { 0.5, 0.5, 0.5, 1.0 };  /* specular */
+GLfloat ball_Ke[] = { 0.0, 0.0, 0.0, 1.0 };  /* emission */
+GLfloat ball_Se   = 30.0;                    /* shininess */
+
+GLuint wall_material, plane_material, ball_material; /* material display lists */
 
 extern float frand();
 
@@ -209,24 +223,33 @@ text(GLuint x, GLuint y, GLfloat scale, char* format, ...)
 void
 resetballs()
 {
-    register short i;
+    register int i;
+    float p[3], d[3];
 
-    balls[0].color[R] = 255;
-    balls[0].color[G] = 64;
-    balls[0].color[B] = 64;
-    balls[1].color[R] = 64;
-    balls[1].color[G] = 255;
-    balls[1].color[B] = 64;
-    balls[2].color[R] = 64;
-    balls[2].color[G] = 64;
-    balls[2].color[B] = 255;
+    if (!world) {
+	world = phNew(TOTALBALLS + smallballs, 1.0);
+	if (!world) {
+	    fprintf(stderr, "bounce: can't allocate %d balls\n", smallballs);
+	    exit(1);
+	}
+    }
     for (i = 0; i < TOTALBALLS; i++) {
-	balls[i].p[0] = 0.0;
-	balls[i].p[1] = 0.0;
-	balls[i].p[2] = 0.0;
-	balls[i].d[0] = .1*frand();
-	balls[i].d[1] = .1*frand();
-	balls[i].d[2] = .1*frand();
+	p[0] = 0.0;
+	p[1] = 0.0;
+	p[2] = 0.0;
+	d[0] = .1*frand();
+	d[1] = .1*frand();
+	d[2] = .1*frand();
+	phSet(world, i, p, d, ballsize);
+    }
+    for (; i < world->n; i++) {
+	p[0] = (1.0 - smallsize)*frand();
+	p[1] = (1.0 - smallsize)*frand();
+	p[2] = (1.0 - smallsize)*frand();
+	d[0] = .02*frand();
+	d[1] = .02*frand();
+	d[2] = .02*frand();
+	phSet(world, i, p, d, smallsize);
     }
 }
 
@@ -352,6 +375,92 @@ drawball()
 
 
 
+/*
+ * The small balls all share one low-polygon sphere.  CHUNK copies of
+ * it are laid out in a vertex array, each ball's copy moved to where
+ * the ball is, and drawn with one glDrawElements per CHUNK balls.
+ */
+void
+drawballs()
+{
+    static float sphere[(SDIV+1)*(SDIV/2+1)][3];
+    static float *norms, *verts;
+    static GLushort *index;
+    register GLushort *e;
+    const int nv = (SDIV+1)*(SDIV/2+1), ni = SDIV*(SDIV/2)*6;
+    register float *v, x, y, z, r;
+    register int i, j, k, n;
+
+    if (!index) {
+	float u, w;
+
+	for (i=0; i <= SDIV; i++) {
+	    u = i*2.0*3.1416/SDIV;
+	    for (j=0; j <= SDIV/2; j++) {
+		w = j*3.1416/(SDIV/2);
+		k = i*(SDIV/2+1) + j;
+		sphere[k][X] = cos(u)*sin(w);
+		sphere[k][Y] = sin(u)*sin(w);
+		sphere[k][Z] = cos(w);
+	    }
+	}
+	norms = (float *)malloc(CHUNK*nv*3*sizeof(float));
+	verts = (float *)malloc(CHUNK*nv*3*sizeof(float));
+	index = (GLushort *)malloc(CHUNK*ni*sizeof(GLushort));
+	if (!norms || !verts || !index) {
+	    fprintf(stderr, "bounce: can't allocate the ball arrays\n");
+	    exit(1);
+	}
+	e = index;
+	for (n=0; n < CHUNK; n++) {
+	    memcpy(norms + n*nv*3, sphere, sizeof(sphere));
+	    for (i=0; i < SDIV; i++) {
+		for (j=0; j < SDIV/2; j++) {
+		    k = n*nv + i*(SDIV/2+1) + j;
+		    *e++ = k;
+		    *e++ = k + SDIV/2+1;
+		    *e++ = k + SDIV/2+2;
+		    *e++ = k;
+		    *e++ = k + SDIV/2+2;
+		    *e++ = k + 1;
+		}
+	    }
+	}
+    }
+
+    glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_NORMAL_ARRAY);
+    glVertexPointer(3, GL_FLOAT, 0, verts);
+    glNormalPointer(GL_FLOAT, 0, norms);
+
+    n = 0;
+    v = verts;
+    for (i=0; i < world->n; i++) {
+	if (world->id[i] < TOTALBALLS)
+	    continue;
+	x = world->x[i];
+	y = world->y[i];
+	z = world->z[i];
+	r = world->r[i];
+	for (k=0; k < nv; k++, v += 3) {
+	    v[X] = x + r*sphere[k][X];
+	    v[Y] = y + r*sphere[k][Y];
+	    v[Z] = z + r*sphere[k][Z];
+	}
+	if (++n == CHUNK) {
+	    glDrawElements(GL_TRIANGLES, n*ni, GL_UNSIGNED_SHORT, index);
+	    n = 0;
+	    v = verts;
+	}
+    }
+    if (n)
+	glDrawElements(GL_TRIANGLES, n*ni, GL_UNSIGNED_SHORT, index);
+
+    glPopClientAttrib();
+}
+
+
 void
 drawimage(void)
 {
@@ -369,9 +478,9 @@ drawimage(void)
     tbMatrix();
 
     for (i=0; i < TOTALBALLS; i++) {
-	newpos[0] = balls[i].p[0];
-	newpos[1] = balls[i].p[1];
-	newpos[2] = balls[i].p[2];
+	newpos[0] = world->x[world->slot[i]];
+	newpos[1] = world->y[world->slot[i]];
+	newpos[2] = world->z[world->slot[i]];
 	glLightfv(GL_LIGHT0 + i, GL_POSITION, newpos);
     }
 
@@ -398,14 +507,20 @@ drawimage(void)
 	glPopMatrix();
     }
 
+    if (smallballs) {
+	glCallList(ball_material);
+	drawballs();
+    }
+
     glDisable(GL_LIGHTING);
 
     for (i=0; i < TOTALBALLS; i++) {
 	if (lighton[i])
 	{
 	    glPushMatrix();
-	    glTranslatef(balls[i].p[0],balls[i].p[1],balls[i].p[2]);
-	    glColor3ubv(balls[i].color);
+	    glTranslatef(world->x[world->slot[i]], world->y[world->slot[i]],
+			 world->z[world->slot[i]]);
+	    glColor3ubv(ballcolor[i]);
 	    drawball();
 	    glPopMatrix();
 	}
@@ -511,6 +626,15 @@ char **argv;
     glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, wall_Se);
     glEndList();
 
+    ball_material = glGenLists(1);
+    glNewList(ball_material, GL_COMPILE);
+    glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, ball_Ka);
+    glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, ball_Kd);
+    glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, ball_Ks);
+    glMaterialfv(GL_FRONT_AND_BACK, GL_EMISSION, ball_Ke);
+    glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, ball_Se);
+    glEndList();
+
     glLightfv(GL_LIGHT0, GL_AMBIENT, light0_Ka);
     glLightfv(GL_LIGHT0, GL_DIFFUSE, light0_Kd);
     glLightf(GL_LIGHT0, GL_CONSTANT_ATTENUATION, attenuation[0]);
@@ -538,25 +662,14 @@ char **argv;
 void
 calcball()
 {
-    register short i,j;
-
-    for (j=0; j < TOTALBALLS; j++) {
-	for (i=0; i < 3; i++) {
-	    balls[j].p[i] += balls[j].d[i];
-	    if (fabs(balls[j].p[i]) > ballscale) {
-		balls[j].p[i] = (balls[j].p[i] > 0.0) ?
-		ballscale : -ballscale;
-		balls[j].d[i] = -balls[j].d[i];
-	    }
-	}
-    }
+    phStep(world, SUBSTEPS);
 }
 
 
 float
 frand()
 {
-    return 2.0*(rand()/32768.0 - .5);
+    return 2.0*(rand()/(RAND_MAX + 1.0) - .5);
 }
 
 
@@ -859,29 +972,45 @@ main(argc, argv)
     int argc;
     char **argv;
 {
+    int arg;
+
     glutInitWindowSize(512, 512);
     glutInitWindowPosition(64, 64);
     glutInit(&argc, argv);
 
-    if (argc > 1)
+    for (arg = 1; arg < argc; arg++)
     {
 	int i;
 
-	for (i=0; argv[1][i] != '/' && argv[1][i] != '\0'; i++);
-	if (argv[1][i] != '/')
+	if (strcmp(argv[arg], "-n") == 0 && arg+1 < argc)
+	{
+	    /* as many small balls as asked for, filling a tenth of the box */
+	    smallballs = atoi(argv[++arg]);
+	    continue;
+	}
+
+	for (i=0; argv[arg][i] != '/' && argv[arg][i] != '\0'; i++);
+	if (argv[arg][i] != '/')
 	{
 	    strcpy(ofile, "/usr/demos/data/models/");
-	    strcat(ofile, argv[1]);
+	    strcat(ofile, argv[arg]);
 	}
 	else
-	    strcpy(ofile, argv[1]);
+	    strcpy(ofile, argv[arg]);
 
 	if (obj = readfastobj(ofile))
 	    objecton = GL_TRUE;
     }
 
     ballsize = .04;
-    ballscale = 1.0 - ballsize;
+    if (smallballs < 0)
+	smallballs = 0;
+    if (smallballs)
+    {
+	smallsize = phRadius(smallballs, 1.0, 0.1);
+	if (smallsize > ballsize)
+	    smallsize = ballsize;
+    }
 
     initialize(argv);
 
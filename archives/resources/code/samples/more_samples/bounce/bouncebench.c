@@ -0,0 +1,129 @@
+/*
+  bouncebench.c
+
+  Time the ball physics of bounce without drawing anything.
+
+  For 1000 up to the given number of balls (100000 unless set), filling
+  a tenth of the box as bounce -n does, prints frames per second, each
+  frame being the same substeps bounce takes, and ball steps per second.
+  Up to 10000 balls it also checks every pair, and prints how far the
+  worst overlapping pair overlaps, as a fraction of their radius.
+
+  usage: bouncebench [max balls]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "physics.h"
+
+#ifdef _WIN32
+#include <windows.h>
+typedef int timer;
+#define getTime(a)	(a = GetTickCount())
+#define timeDiff(a, b)	((b - a) * 1000)
+#else
+#include <sys/time.h>
+typedef struct timeval timer;
+#define getTime(a)	gettimeofday(&a, NULL)
+#define timeDiff(a, b)	(((b.tv_sec - a.tv_sec) * 1000000) + b.tv_usec - a.tv_usec)
+#endif
+
+#define SUBSTEPS 4	/* as bounce.c */
+
+float
+frand()
+{
+    return 2.0*(rand()/(RAND_MAX + 1.0) - .5);
+}
+
+PHworld*
+newworld(int n)
+{
+    PHworld *w = phNew(n, 1.0);
+    float p[3], v[3], r = phRadius(n, 1.0, 0.1);
+    int i;
+
+    if (w == NULL) {
+	fprintf(stderr, "bouncebench: can't allocate %d balls\n", n);
+	exit(1);
+    }
+    if (r > .04)
+	r = .04;
+    srand(1);
+    for (i = 0; i < n; i++) {
+	p[0] = (1.0 - r)*frand();
+	p[1] = (1.0 - r)*frand();
+	p[2] = (1.0 - r)*frand();
+	v[0] = .02*frand();
+	v[1] = .02*frand();
+	v[2] = .02*frand();
+	phSet(w, i, p, v, r);
+    }
+    /* let the first pushes settle */
+    phStep(w, SUBSTEPS);
+    return w;
+}
+
+/* frames per second */
+double
+run(PHworld *w)
+{
+    timer t0, t1;
+    long usec;
+    int n = 0;
+
+    getTime(t0);
+    do {
+	phStep(w, SUBSTEPS);
+	getTime(t1);
+	usec = timeDiff(t0, t1);
+    } while (++n < 4 || usec < 250000);
+    return (double)n / (usec > 0 ? usec : 1) * 1e6;
+}
+
+/* the deepest overlap of any pair, over their radius */
+double
+overlap(PHworld *w)
+{
+    double dx, dy, dz, d, worst = 0;
+    int i, j;
+
+    for (i = 0; i < w->n; i++)
+	for (j = i + 1; j < w->n; j++) {
+	    dx = w->x[j] - w->x[i];
+	    dy = w->y[j] - w->y[i];
+	    dz = w->z[j] - w->z[i];
+	    d = (w->r[i] + w->r[j] - sqrt(dx*dx + dy*dy + dz*dz)) / w->r[i];
+	    if (d > worst)
+		worst = d;
+	}
+    return worst;
+}
+
+int
+main(int argc, char **argv)
+{
+    static int sizes[] = { 1000, 10000, 50000, 100000, 500000, 1000000 };
+    int max = 100000, n, k;
+    PHworld *w;
+    double fps;
+
+    if (argc > 1)
+	max = atoi(argv[1]);
+
+    printf("%10s %10s %10s %14s %10s\n",
+	   "balls", "frames/s", "ms/frame", "ball steps/s", "overlap");
+    for (k = 0; k < 6 && sizes[k] <= max; k++) {
+	n = sizes[k];
+	w = newworld(n);
+	fps = run(w);
+	printf("%10d %10.1f %10.3f %14.0f", n, fps, 1000. / fps,
+	       fps * n * SUBSTEPS);
+	if (n <= 10000)
+	    printf(" %10.3f", overlap(w));
+	printf("\n");
+	phFree(w);
+    }
+    return 0;
+}
@@ -0,0 +1,396 @@
+/*
+  physics.c
+
+  Rigid balls in a box, see physics.h.
+
+  Each substep moves the balls and bounces them off the walls, then
+  counting-sorts them into the cells of a grid about two balls wide,
+  carrying their state along so that the balls in a cell sit next to
+  each other.  Every ball then tests the balls in the cells around it
+  four at a time (with SSE when the compiler has it), and pushes
+  apart and bounces off any it overlaps.  A pair is handled only by
+  its bigger ball, or by the one in the lower slot when they are the
+  same size, so only big balls look further than the next cell.
+
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "physics.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define PH_SSE
+#include <xmmintrin.h>
+#endif
+
+#define PH_MAXDIM 128			/* most cells along a side */
+#define PH_FLOATS 8			/* float arrays per ball */
+
+
+typedef struct _PHgrid {
+    int dim;				/* cells along a side, 0 to recompute */
+    float cell;				/* side of a cell */
+    int *start;				/* dim^3 + 1 ranges of slots */
+    int *key;				/* cell of each slot */
+    int *order;				/* new slot of each slot */
+    float *tmp;				/* for moving the state along */
+    int *itmp;
+} PHgrid;
+
+
+static float **
+floats(PHworld *w, int k)
+{
+    switch (k) {
+    case 0: return &w->x;
+    case 1: return &w->y;
+    case 2: return &w->z;
+    case 3: return &w->vx;
+    case 4: return &w->vy;
+    case 5: return &w->vz;
+    case 6: return &w->r;
+    default: return &w->im;
+    }
+}
+
+
+PHworld*
+phNew(int n, float box)
+{
+    PHworld *w;
+    PHgrid *g;
+    int i, k, fail = 0;
+
+    if (n < 1)
+	return NULL;
+    w = (PHworld*)calloc(1, sizeof(PHworld));
+    g = (PHgrid*)calloc(1, sizeof(PHgrid));
+    if (!w || !g) {
+	free(w);
+	free(g);
+	return NULL;
+    }
+    w->n = n;
+    w->box = box;
+    w->grid = g;
+
+    /* the float arrays have room for reading four past the end */
+    for (k = 0; k < PH_FLOATS; k++)
+	if (!(*floats(w, k) = (float*)calloc(n + 4, sizeof(float))))
+	    fail = 1;
+    g->tmp = (float*)calloc(n + 4, sizeof(float));
+    w->id = (int*)malloc(n * sizeof(int));
+    w->slot = (int*)malloc(n * sizeof(int));
+    g->key = (int*)malloc(n * sizeof(int));
+    g->order = (int*)malloc(n * sizeof(int));
+    g->itmp = (int*)malloc(n * sizeof(int));
+    if (fail || !g->tmp || !w->id || !w->slot || !g->key || !g->order ||
+	!g->itmp) {
+	phFree(w);
+	return NULL;
+    }
+    for (i = 0; i < n; i++) {
+	w->id[i] = w->slot[i] = i;
+	w->im[i] = 1.0;
+    }
+    return w;
+}
+
+
+void
+phFree(PHworld *w)
+{
+    PHgrid *g;
+    int k;
+
+    if (!w)
+	return;
+    g = (PHgrid*)w->grid;
+    for (k = 0; k < PH_FLOATS; k++)
+	free(*floats(w, k));
+    free(w->id);
+    free(w->slot);
+    if (g) {
+	free(g->start);
+	free(g->key);
+	free(g->order);
+	free(g->tmp);
+	free(g->itmp);
+	free(g);
+    }
+    free(w);
+}
+
+
+void
+phSet(PHworld *w, int i, float p[3], float v[3], float radius)
+{
+    int s = w->slot[i];
+
+    w->x[s] = p[0];
+    w->y[s] = p[1];
+    w->z[s] = p[2];
+    w->vx[s] = v[0];
+    w->vy[s] = v[1];
+    w->vz[s] = v[2];
+    w->r[s] = radius;
+    /* mass goes with volume */
+    w->im[s] = radius > 0.0 ? 1.0 / (radius * radius * radius) : 1.0;
+    ((PHgrid*)w->grid)->dim = 0;
+}
+
+
+/* size the grid to the smallest ball */
+static int
+sizegrid(PHworld *w)
+{
+    PHgrid *g = (PHgrid*)w->grid;
+    float rmin = w->box;
+    int i;
+
+    for (i = 0; i < w->n; i++)
+	if (w->r[i] > 0.0 && w->r[i] < rmin)
+	    rmin = w->r[i];
+    g->cell = 2.0 * rmin;
+    if (g->cell < 2.0 * w->box / PH_MAXDIM)
+	g->cell = 2.0 * w->box / PH_MAXDIM;
+    g->dim = (int)ceil(2.0 * w->box / g->cell);
+    free(g->start);
+    g->start = (int*)malloc((g->dim * g->dim * g->dim + 1) * sizeof(int));
+    return g->start != NULL;
+}
+
+
+static int
+cellof(PHgrid *g, float p, float box)
+{
+    int c = (int)((p + box) / g->cell);
+
+    return c < 0 ? 0 : c >= g->dim ? g->dim - 1 : c;
+}
+
+
+static void
+move(PHworld *w, float h)
+{
+    float lim;
+    int i;
+
+#define PH_WALL(p, v) \
+    p += v * h; \
+    if (p > lim) { p = lim; v = -fabs(v); } \
+    else if (p < -lim) { p = -lim; v = fabs(v); }
+
+    for (i = 0; i < w->n; i++) {
+	lim = w->box - w->r[i];
+	PH_WALL(w->x[i], w->vx[i]);
+	PH_WALL(w->y[i], w->vy[i]);
+	PH_WALL(w->z[i], w->vz[i]);
+    }
+#undef PH_WALL
+}
+
+
+/* counting sort into cell order */
+static void
+sort(PHworld *w)
+{
+    PHgrid *g = (PHgrid*)w->grid;
+    int cells = g->dim * g->dim * g->dim;
+    float **a, *t;
+    int i, k, *s;
+
+    memset(g->start, 0, (cells + 1) * sizeof(int));
+    for (i = 0; i < w->n; i++) {
+	g->key[i] = (cellof(g, w->z[i], w->box) * g->dim +
+		     cellof(g, w->y[i], w->box)) * g->dim +
+		     cellof(g, w->x[i], w->box);
+	g->start[g->key[i] + 1]++;
+    }
+    for (k = 0; k < cells; k++)
+	g->start[k + 1] += g->start[k];
+    for (i = 0; i < w->n; i++)
+	g->order[i] = g->start[g->key[i]]++;
+    for (k = cells; k > 0; k--)
+	g->start[k] = g->start[k - 1];
+    g->start[0] = 0;
+
+    for (k = 0; k < PH_FLOATS; k++) {
+	a = floats(w, k);
+	for (i = 0; i < w->n; i++)
+	    g->tmp[g->order[i]] = (*a)[i];
+	t = *a;
+	*a = g->tmp;
+	g->tmp = t;
+    }
+    for (i = 0; i < w->n; i++)
+	g->itmp[g->order[i]] = w->id[i];
+    s = w->id;
+    w->id = g->itmp;
+    g->itmp = s;
+    for (i = 0; i < w->n; i++)
+	w->slot[w->id[i]] = i;
+}
+
+
+/* push overlapping balls i and j apart and bounce them */
+static void
+resolve(PHworld *w, int i, int j)
+{
+    float dx = w->x[j] - w->x[i];
+    float dy = w->y[j] - w->y[i];
+    float dz = w->z[j] - w->z[i];
+    float d = sqrt(dx * dx + dy * dy + dz * dz);
+    float im = w->im[i] + w->im[j], overlap, vn, k;
+
+    if (d >= w->r[i] + w->r[j])
+	return;
+    if (d > 0.0) {
+	dx /= d;
+	dy /= d;
+	dz /= d;
+    } else {
+	dx = 1.0;
+	dy = dz = 0.0;
+    }
+
+    overlap = (w->r[i] + w->r[j] - d) / im;
+    w->x[i] -= dx * overlap * w->im[i];
+    w->y[i] -= dy * overlap * w->im[i];
+    w->z[i] -= dz * overlap * w->im[i];
+    w->x[j] += dx * overlap * w->im[j];
+    w->y[j] += dy * overlap * w->im[j];
+    w->z[j] += dz * overlap * w->im[j];
+
+    /* elastic, if they're closing */
+    vn = (w->vx[j] - w->vx[i]) * dx + (w->vy[j] - w->vy[i]) * dy +
+	(w->vz[j] - w->vz[i]) * dz;
+    if (vn < 0.0) {
+	k = -2.0 * vn / im;
+	w->vx[i] -= k * w->im[i] * dx;
+	w->vy[i] -= k * w->im[i] * dy;
+	w->vz[i] -= k * w->im[i] * dz;
+	w->vx[j] += k * w->im[j] * dx;
+	w->vy[j] += k * w->im[j] * dy;
+	w->vz[j] += k * w->im[j] * dz;
+    }
+}
+
+
+/* ball i against the balls in slots [first, last) */
+static void
+collidespan(PHworld *w, int i, int first, int last)
+{
+    float ri = w->r[i];
+    int j = first;
+#ifdef PH_SSE
+    __m128 lane = _mm_setr_ps(0.0, 1.0, 2.0, 3.0);
+    __m128 px, py, pz, vri, vi, end, e, d2, rj, sum, hit;
+    int bits, k;
+
+    px = _mm_set1_ps(w->x[i]);
+    py = _mm_set1_ps(w->y[i]);
+    pz = _mm_set1_ps(w->z[i]);
+    vri = _mm_set1_ps(ri);
+    vi = _mm_set1_ps((float)i);
+    end = _mm_set1_ps((float)last);
+    for (; j < last; j += 4) {
+	e = _mm_sub_ps(_mm_loadu_ps(w->x + j), px);
+	d2 = _mm_mul_ps(e, e);
+	e = _mm_sub_ps(_mm_loadu_ps(w->y + j), py);
+	d2 = _mm_add_ps(d2, _mm_mul_ps(e, e));
+	e = _mm_sub_ps(_mm_loadu_ps(w->z + j), pz);
+	d2 = _mm_add_ps(d2, _mm_mul_ps(e, e));
+	rj = _mm_loadu_ps(w->r + j);
+	sum = _mm_add_ps(vri, rj);
+	hit = _mm_cmplt_ps(d2, _mm_mul_ps(sum, sum));
+
+	/* the pair is ours if j is smaller, or the same size and later */
+	e = _mm_add_ps(_mm_set1_ps((float)j), lane);
+	hit = _mm_and_ps(hit, _mm_or_ps(_mm_cmplt_ps(rj, vri),
+		_mm_and_ps(_mm_cmpeq_ps(rj, vri), _mm_cmpgt_ps(e, vi))));
+	hit = _mm_and_ps(hit, _mm_cmplt_ps(e, end));
+
+	bits = _mm_movemask_ps(hit);
+	if (bits) {
+	    for (k = 0; k < 4; k++)
+		if (bits & (1 << k))
+		    resolve(w, i, j + k);
+	    /* ball i has moved */
+	    px = _mm_set1_ps(w->x[i]);
+	    py = _mm_set1_ps(w->y[i]);
+	    pz = _mm_set1_ps(w->z[i]);
+	}
+    }
+#else
+    float dx, dy, dz, s;
+
+    for (; j < last; j++) {
+	if (w->r[j] > ri || (w->r[j] == ri && j <= i))
+	    continue;
+	dx = w->x[j] - w->x[i];
+	dy = w->y[j] - w->y[i];
+	dz = w->z[j] - w->z[i];
+	s = ri + w->r[j];
+	if (dx * dx + dy * dy + dz * dz < s * s)
+	    resolve(w, i, j);
+    }
+#endif
+}
+
+
+static void
+collide(PHworld *w)
+{
+    PHgrid *g = (PHgrid*)w->grid;
+    int i, reach, cx, cy, cz, x0, x1, y, z, row;
+
+    for (i = 0; i < w->n; i++) {
+	/* the cells that can hold a ball no bigger than i touching i */
+	reach = (int)ceil(2.0 * w->r[i] / g->cell);
+	if (reach < 1)
+	    reach = 1;
+	cx = cellof(g, w->x[i], w->box);
+	cy = cellof(g, w->y[i], w->box);
+	cz = cellof(g, w->z[i], w->box);
+	x0 = cx - reach < 0 ? 0 : cx - reach;
+	x1 = cx + reach >= g->dim ? g->dim - 1 : cx + reach;
+	for (z = cz - reach; z <= cz + reach; z++) {
+	    if (z < 0 || z >= g->dim)
+		continue;
+	    for (y = cy - reach; y <= cy + reach; y++) {
+		if (y < 0 || y >= g->dim)
+		    continue;
+		/* a row of cells is one run of slots */
+		row = (z * g->dim + y) * g->dim;
+		collidespan(w, i, g->start[row + x0], g->start[row + x1 + 1]);
+	    }
+	}
+    }
+}
+
+
+void
+phStep(PHworld *w, int substeps)
+{
+    PHgrid *g = (PHgrid*)w->grid;
+    int s;
+
+    if (substeps < 1)
+	substeps = 1;
+    if (g->dim == 0 && !sizegrid(w))
+	return;
+    for (s = 0; s < substeps; s++) {
+	move(w, 1.0 / substeps);
+	sort(w);
+	collide(w);
+    }
+}
+
+
+float
+phRadius(int n, float box, float fill)
+{
+    return pow(fill * 8.0 * box * box * box / (n * 4.18879), 1.0 / 3.0);
+}
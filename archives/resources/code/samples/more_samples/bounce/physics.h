@@ -0,0 +1,48 @@
+/*
+  physics.h
+
+  Rigid balls bouncing around the inside of a box.
+
+  The balls bounce off the walls as they always did in bounce, and
+  now off each other too, elastically, with a mass that goes with
+  their volume.  Each frame is split into a fixed number of substeps
+  so that fast balls don't pass through each other.  Close pairs are
+  found through a uniform grid over the box.
+
+ */
+
+typedef struct _PHworld {
+    int n;				/* number of balls */
+    float box;				/* half the side of the box */
+
+    /* the balls, in grid cell order (see slot and id) */
+    float *x, *y, *z;			/* position */
+    float *vx, *vy, *vz;		/* velocity, per frame */
+    float *r;				/* radius */
+    float *im;				/* 1 / mass */
+    int *id;				/* ball in each slot */
+    int *slot;				/* slot of each ball */
+
+    void *grid;				/* private */
+} PHworld;
+
+
+/* n balls of radius 0 at the centre of a box from -box to box;
+   returns NULL if out of memory. */
+PHworld*
+phNew(int n, float box);
+
+void
+phFree(PHworld *w);
+
+/* place ball i, moving at v per frame */
+void
+phSet(PHworld *w, int i, float p[3], float v[3], float radius);
+
+/* advance one frame in substeps */
+void
+phStep(PHworld *w, int substeps);
+
+/* the radius at which n balls fill the given fraction of the box */
+float
+phRadius(int n, float box, float fill);
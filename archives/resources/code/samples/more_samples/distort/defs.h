@@ -43,5 +43,6 @@ typedef struct {
 
 extern EFFECT ripple;
 extern EFFECT rubber;
+extern EFFECT water;
 
 #endif
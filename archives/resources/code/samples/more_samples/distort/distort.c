@@ -106,6 +106,10 @@ void menu(int item)
     effect->init();
     break;
   case 3 :
+    effect = &water;
+    effect->init();
+    break;
+  case 4 :
     exit(0);
     break;
   }
@@ -187,8 +191,9 @@ void display_init()
   glutAddMenuEntry("", 0);
   glutAddMenuEntry("Ripple", 1);
   glutAddMenuEntry("Rubber", 2);
+  glutAddMenuEntry("Water", 3);
   glutAddMenuEntry("", 0);
-  glutAddMenuEntry("Quit", 3);
+  glutAddMenuEntry("Quit", 4);
   glutAttachMenu(GLUT_RIGHT_BUTTON);
 }
 
@@ -17,33 +17,97 @@
 */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <math.h>
 #include <GL/glut.h>
 
 #include "defs.h"
 #include "ripple.h"
 
-extern RIPPLE_VECTOR ripple_vector[GRID_SIZE_X][GRID_SIZE_Y];
-extern RIPPLE_AMP ripple_amp[RIPPLE_LENGTH];
-
 extern int win_size_x, win_size_y;
 
 EFFECT ripple = { ripple_init, ripple_dynamics, ripple_redraw, ripple_click };
 
+static RIPPLE_VECTOR ripple_vector[GRID_SIZE_X][GRID_SIZE_Y];
+static RIPPLE_AMP ripple_amp[RIPPLE_LENGTH];
+static int ripple_tables = 0;
+
 static RIPPLE_VERTEX ripple_vertex[GRID_SIZE_X][GRID_SIZE_Y];
 
-static int cx[RIPPLE_COUNT];
-static int cy[RIPPLE_COUNT];
-static int t[RIPPLE_COUNT];
-static int max[RIPPLE_COUNT];
+typedef struct {
+  int cx, cy;		/* center, in grid cells */
+  int t;		/* age, in pixels traveled */
+  int max;		/* age at which it has left the window */
+} RIPPLE;
 
-static int ripple_max;
+static RIPPLE *ripples = NULL;
+static int ripple_count = 0;	/* ripples in use or spent */
+static int ripple_alloc = 0;	/* room in ripples */
 
 /*
-	Initialize ripple location and age information.
+	Precompute ripple displacement vectors.  This and
+	ripple_precalc_amp() used to be run at build time to
+	generate a C source file; they're cheap enough to run
+	once when the program starts.
+*/
+
+static void ripple_precalc_vector()
+{
+  int i, j;
+  float x, y, l;
+
+  for (i = 0; i < GRID_SIZE_X; i++)
+    for (j = 0; j < GRID_SIZE_Y; j++)
+    {
+      x = (float) i/(GRID_SIZE_X - 1);
+      y = (float) j/(GRID_SIZE_Y - 1);
+
+      l = (float) sqrt(x*x + y*y);
+      if (l == 0.0)
+      {
+	x = 0.0f;
+	y = 0.0f;
+      }
+      else
+      {
+	x /= l;
+	y /= l;
+      }
+
+      ripple_vector[i][j].dx[0] = x;
+      ripple_vector[i][j].dx[1] = y;
+      ripple_vector[i][j].r = (int) (l*WIN_SIZE_X*2);
+    }
+}
+
+/*
+	Precompute ripple amplitude decay.
+*/
+
+static void ripple_precalc_amp()
+{
+  int i;
+  double t;
+  double a;
+
+  for (i = 0; i < RIPPLE_LENGTH; i++)
+  {
+    t = 1.0 - i/(RIPPLE_LENGTH - 1.0);
+    a = (-cos(t*2.0*3.1428571*RIPPLE_CYCLES)*0.5 + 0.5)
+      *RIPPLE_AMPLITUDE*t*t*t*t*t*t*t*t;
+    if (i == 0)
+      a = 0.0;
+
+    ripple_amp[i].amplitude = a;
+  }
+}
+
+/*
+	Forget any ripples.
 
 	Also, precompute the vertex coordinates and the default texture
-	coordinates assigned to them.
+	coordinates assigned to them, and the ripple tables the first
+	time through.
 */
 
 void ripple_init()
@@ -52,16 +116,15 @@ void ripple_init()
 
   glDisable(GL_DEPTH_TEST);
 
-  ripple_max = (int)sqrt(win_size_y*win_size_y+win_size_x*win_size_x);
-
-  for (i = 0; i < RIPPLE_COUNT; i++)
+  if (!ripple_tables)
   {
-    t[i] = ripple_max + RIPPLE_LENGTH;
-    cx[i] = 0;
-    cy[i] = 0;
-    max[i] = 0;
+    ripple_precalc_vector();
+    ripple_precalc_amp();
+    ripple_tables = 1;
   }
 
+  ripple_count = 0;
+
   for (i = 0; i < GRID_SIZE_X; i++)
     for (j = 0; j < GRID_SIZE_Y; j++)
     {
@@ -85,9 +148,13 @@ void ripple_dynamics(int mousex, int mousey)
   int r;
   float sx, sy;
   float amp;
+  RIPPLE *p;
 
-  for (i = 0; i < RIPPLE_COUNT; i++)
-    t[i] += RIPPLE_STEP;
+  /* age the ripples, and drop spent ones off the end of the list */
+  for (k = 0; k < ripple_count; k++)
+    ripples[k].t += RIPPLE_STEP;
+  while (ripple_count > 0 && ripples[ripple_count - 1].t >= ripples[ripple_count - 1].max)
+    ripple_count--;
 
   for (i = 0; i < GRID_SIZE_X; i++)
     for (j = 0; j < GRID_SIZE_Y; j++)
@@ -95,10 +162,14 @@ void ripple_dynamics(int mousex, int mousey)
       ripple_vertex[i][j].t[0] = ripple_vertex[i][j].dt[0];
       ripple_vertex[i][j].t[1] = ripple_vertex[i][j].dt[1];
 
-      for (k = 0; k < RIPPLE_COUNT; k++)
+      for (k = 0; k < ripple_count; k++)
       {
-	x = i - cx[k];
-	y = j - cy[k];
+	p = &ripples[k];
+	if (p->t >= p->max)
+	  continue;
+
+	x = i - p->cx;
+	y = j - p->cy;
 	if (x < 0)
 	{
 	  x *= -1;
@@ -116,14 +187,14 @@ void ripple_dynamics(int mousex, int mousey)
 	mi = x;
 	mj = y;
 	
-	r = t[k] - ripple_vector[mi][mj].r;
+	r = p->t - ripple_vector[mi][mj].r;
 	
 	if (r < 0)
 	  r = 0;
 	if (r > RIPPLE_LENGTH - 1)
 	  r = RIPPLE_LENGTH - 1;
 
-	amp = 1.0 - 1.0*t[k]/RIPPLE_LENGTH;
+	amp = 1.0 - 1.0*p->t/RIPPLE_LENGTH;
 	amp *= amp;
 	if (amp < 0.0)
 	  amp = 0.0;
@@ -200,27 +271,42 @@ int ripple_max_distance(int gx, int gy)
 }
 
 /*
-	Generate a new ripple when the mouse is pressed.  There's
-	a limit on the number of ripples that can be simultaneously
-	generated.
+	Generate a new ripple when the mouse is pressed.  Spent
+	ripples are reused; otherwise the list grows, so there's
+	no limit on the number of ripples that can be
+	simultaneously generated.
 */
 
 void ripple_click(int mousex, int mousey, int state)
 {
   int index;
+  RIPPLE *p;
 
   if (state)
   {
     index = 0;
-    while (t[index] < max[index] && index < RIPPLE_COUNT)
+    while (index < ripple_count && ripples[index].t < ripples[index].max)
       index++;
-    
-    if (index < RIPPLE_COUNT)
+
+    if (index == ripple_count)
     {
-      cx[index] = 1.0*mousex/win_size_x*GRID_SIZE_X;
-      cy[index] = 1.0*mousey/win_size_y*GRID_SIZE_Y;
-      t[index] = 4*RIPPLE_STEP;
-      max[index] = ripple_max_distance(cx[index], cy[index]);
+      if (ripple_count == ripple_alloc)
+      {
+	ripple_alloc = ripple_alloc ? ripple_alloc*2 : 8;
+	ripples = (RIPPLE *) realloc(ripples, ripple_alloc*sizeof(RIPPLE));
+	if (ripples == NULL)
+	{
+	  fprintf(stderr, "ripple: Can't allocate memory.\n");
+	  exit(-1);
+	}
+      }
+      ripple_count++;
     }
+
+    p = &ripples[index];
+    p->cx = 1.0*mousex/win_size_x*GRID_SIZE_X;
+    p->cy = 1.0*mousey/win_size_y*GRID_SIZE_Y;
+    p->t = 4*RIPPLE_STEP;
+    p->max = ripple_max_distance(p->cx, p->cy);
   }
 }
@@ -12,7 +12,6 @@
 #define RIPPLE_CYCLES     18
 #define RIPPLE_AMPLITUDE  0.125
 #define RIPPLE_STEP	  7
-#define RIPPLE_COUNT	  7
 
 typedef struct {	/* precomputed displacement vector table */
   float dx[2];
@@ -1,3084 +0,0 @@
-/* THIS FILE WAS MACHINE-GENERATED */
-
-#include "defs.h"
-#include "ripple.h"
-
-RIPPLE_VECTOR ripple_vector[GRID_SIZE_X][GRID_SIZE_Y] =
-{
-  0, 0, 0,
-  0, 1, 25,
-  0, 1, 51,
-  0, 1, 77,
-  0, 1, 103,
-  0, 1, 129,
-  0, 1, 154,
-  0, 1, 180,
-  0, 1, 206,
-  0, 1, 232,
-  0, 1, 258,
-  0, 1, 283,
-  0, 1, 309,
-  0, 1, 335,
-  0, 1, 361,
-  0, 1, 387,
-  0, 1, 412,
-  0, 1, 438,
-  0, 1, 464,
-  0, 1, 490,
-  0, 1, 516,
-  0, 1, 541,
-  0, 1, 567,
-  0, 1, 593,
-  0, 1, 619,
-  0, 1, 645,
-  0, 1, 670,
-  0, 1, 696,
-  0, 1, 722,
-  0, 1, 748,
-  0, 1, 774,
-  0, 1, 800,
-  1, 0, 25,
-  0.707107, 0.707107, 36,
-  0.447214, 0.894427, 57,
-  0.316228, 0.948683, 81,
-  0.242536, 0.970143, 106,
-  0.196116, 0.980581, 131,
-  0.164399, 0.986394, 156,
-  0.141421, 0.989949, 182,
-  0.124035, 0.992278, 208,
-  0.110432, 0.993884, 233,
-  0.0995037, 0.995037, 259,
-  0.0905357, 0.995893, 285,
-  0.0830455, 0.996546, 310,
-  0.0766965, 0.997055, 336,
-  0.071247, 0.997459, 362,
-  0.066519, 0.997785, 387,
-  0.0623783, 0.998053, 413,
-  0.058722, 0.998274, 439,
-  0.05547, 0.99846, 465,
-  0.0525588, 0.998618, 491,
-  0.0499376, 0.998752, 516,
-  0.0475651, 0.998868, 542,
-  0.0454077, 0.998969, 568,
-  0.0434372, 0.999056, 594,
-  0.0416305, 0.999133, 619,
-  0.039968, 0.999201, 645,
-  0.0384331, 0.999261, 671,
-  0.0370117, 0.999315, 697,
-  0.0356915, 0.999363, 723,
-  0.0344623, 0.999406, 748,
-  0.0333148, 0.999445, 774,
-  0.0322413, 0.99948, 800,
-  1, 0, 51,
-  0.894427, 0.447214, 57,
-  0.707107, 0.707107, 72,
-  0.5547, 0.83205, 93,
-  0.447214, 0.894427, 115,
-  0.371391, 0.928477, 138,
-  0.316228, 0.948683, 163,
-  0.274721, 0.961524, 187,
-  0.242536, 0.970143, 212,
-  0.21693, 0.976187, 237,
-  0.196116, 0.980581, 263,
-  0.178885, 0.98387, 288,
-  0.164399, 0.986394, 313,
-  0.152057, 0.988372, 339,
-  0.141421, 0.989949, 364,
-  0.132164, 0.991228, 390,
-  0.124035, 0.992278, 416,
-  0.116841, 0.993151, 441,
-  0.110432, 0.993884, 467,
-  0.104685, 0.994505, 493,
-  0.0995037, 0.995037, 518,
-  0.0948091, 0.995495, 544,
-  0.0905357, 0.995893, 570,
-  0.0866296, 0.996241, 595,
-  0.0830455, 0.996546, 621,
-  0.0797452, 0.996815, 647,
-  0.0766965, 0.997055, 672,
-  0.0738717, 0.997268, 698,
-  0.071247, 0.997459, 724,
-  0.0688021, 0.99763, 750,
-  0.066519, 0.997785, 775,
-  0.0643823, 0.997925, 801,
-  1, 0, 77,
-  0.948683, 0.316228, 81,
-  0.83205, 0.5547, 93,
-  0.707107, 0.707107, 109,
-  0.6, 0.8, 129,
-  0.514496, 0.857493, 150,
-  0.447214, 0.894427, 173,
-  0.393919, 0.919145, 196,
-  0.351123, 0.936329, 220,
-  0.316228, 0.948683, 244,
-  0.287348, 0.957826, 269,
-  0.263117, 0.964764, 294,
-  0.242536, 0.970142, 319,
-  0.22486, 0.974391, 344,
-  0.209529, 0.977802, 369,
-  0.196116, 0.980581, 394,
-  0.184289, 0.982872, 420,
-  0.173785, 0.984784, 445,
-  0.164399, 0.986394, 470,
-  0.155963, 0.987763, 496,
-  0.14834, 0.988936, 521,
-  0.141421, 0.989949, 547,
-  0.135113, 0.99083, 572,
-  0.129339, 0.9916, 598,
-  0.124035, 0.992278, 624,
-  0.119145, 0.992877, 649,
-  0.114624, 0.993409, 675,
-  0.110432, 0.993884, 701,
-  0.106533, 0.994309, 726,
-  0.102899, 0.994692, 752,
-  0.0995037, 0.995037, 778,
-  0.0963242, 0.99535, 803,
-  1, 0, 103,
-  0.970143, 0.242536, 106,
-  0.894427, 0.447214, 115,
-  0.8, 0.6, 129,
-  0.707107, 0.707107, 145,
-  0.624695, 0.780869, 165,
-  0.5547, 0.83205, 186,
-  0.496139, 0.868243, 208,
-  0.447214, 0.894427, 230,
-  0.406138, 0.913812, 254,
-  0.371391, 0.928477, 277,
-  0.341743, 0.939793, 302,
-  0.316228, 0.948683, 326,
-  0.294086, 0.955779, 351,
-  0.274721, 0.961524, 375,
-  0.257663, 0.966235, 400,
-  0.242536, 0.970143, 425,
-  0.229039, 0.973417, 450,
-  0.21693, 0.976187, 475,
-  0.20601, 0.97855, 501,
-  0.196116, 0.980581, 526,
-  0.187112, 0.982339, 551,
-  0.178885, 0.98387, 577,
-  0.171341, 0.985212, 602,
-  0.164399, 0.986394, 627,
-  0.15799, 0.987441, 653,
-  0.152057, 0.988372, 678,
-  0.146549, 0.989204, 704,
-  0.141421, 0.989949, 729,
-  0.136637, 0.990621, 755,
-  0.132164, 0.991228, 781,
-  0.127971, 0.991778, 806,
-  1, 0, 129,
-  0.980581, 0.196116, 131,
-  0.928477, 0.371391, 138,
-  0.857493, 0.514496, 150,
-  0.780869, 0.624695, 165,
-  0.707107, 0.707107, 182,
-  0.640184, 0.768221, 201,
-  0.581238, 0.813733, 221,
-  0.529999, 0.847998, 243,
-  0.485643, 0.874157, 265,
-  0.447214, 0.894427, 288,
-  0.413803, 0.910366, 311,
-  0.384615, 0.923077, 335,
-  0.358979, 0.933346, 359,
-  0.336336, 0.941742, 383,
-  0.316228, 0.948683, 408,
-  0.298275, 0.95448, 432,
-  0.282166, 0.959365, 457,
-  0.267644, 0.963518, 482,
-  0.254493, 0.967075, 507,
-  0.242536, 0.970142, 532,
-  0.231621, 0.972806, 557,
-  0.221621, 0.975133, 582,
-  0.21243, 0.977176, 607,
-  0.203954, 0.97898, 632,
-  0.196116, 0.980581, 657,
-  0.188847, 0.982006, 683,
-  0.182089, 0.983282, 708,
-  0.175791, 0.984428, 734,
-  0.169907, 0.98546, 759,
-  0.164399, 0.986394, 784,
-  0.159232, 0.987241, 810,
-  1, 0, 154,
-  0.986394, 0.164399, 156,
-  0.948683, 0.316228, 163,
-  0.894427, 0.447214, 173,
-  0.83205, 0.5547, 186,
-  0.768221, 0.640184, 201,
-  0.707107, 0.707107, 218,
-  0.650791, 0.759257, 237,
-  0.6, 0.8, 258,
-  0.5547, 0.83205, 279,
-  0.514496, 0.857493, 300,
-  0.478852, 0.877896, 323,
-  0.447214, 0.894427, 346,
-  0.419058, 0.907959, 369,
-  0.393919, 0.919145, 393,
-  0.371391, 0.928477, 416,
-  0.351123, 0.936329, 440,
-  0.33282, 0.94299, 465,
-  0.316228, 0.948683, 489,
-  0.301131, 0.953583, 514,
-  0.287348, 0.957826, 538,
-  0.274721, 0.961524, 563,
-  0.263117, 0.964764, 588,
-  0.252422, 0.967617, 613,
-  0.242536, 0.970142, 638,
-  0.233373, 0.972387, 663,
-  0.22486, 0.974391, 688,
-  0.21693, 0.976187, 713,
-  0.209529, 0.977802, 738,
-  0.202606, 0.97926, 764,
-  0.196116, 0.980581, 789,
-  0.190022, 0.98178, 814,
-  1, 0, 180,
-  0.989949, 0.141421, 182,
-  0.961524, 0.274721, 187,
-  0.919145, 0.393919, 196,
-  0.868243, 0.496139, 208,
-  0.813733, 0.581238, 221,
-  0.759257, 0.650791, 237,
-  0.707107, 0.707107, 255,
-  0.658505, 0.752577, 274,
-  0.613941, 0.789352, 294,
-  0.573462, 0.819232, 315,
-  0.536875, 0.843661, 336,
-  0.503871, 0.863779, 358,
-  0.4741, 0.880471, 381,
-  0.447214, 0.894427, 403,
-  0.422885, 0.906183, 427,
-  0.400819, 0.916157, 450,
-  0.38075, 0.924678, 474,
-  0.362446, 0.932005, 498,
-  0.345705, 0.938343, 522,
-  0.33035, 0.943858, 546,
-  0.316228, 0.948683, 571,
-  0.303204, 0.952926, 595,
-  0.291162, 0.956674, 620,
-  0.28, 0.96, 645,
-  0.26963, 0.962964, 669,
-  0.259973, 0.965616, 694,
-  0.250962, 0.967997, 719,
-  0.242536, 0.970142, 744,
-  0.234641, 0.972082, 769,
-  0.22723, 0.973841, 794,
-  0.220261, 0.975441, 820,
-  1, 0, 206,
-  0.992278, 0.124035, 208,
-  0.970143, 0.242536, 212,
-  0.936329, 0.351123, 220,
-  0.894427, 0.447214, 230,
-  0.847998, 0.529999, 243,
-  0.8, 0.6, 258,
-  0.752577, 0.658505, 274,
-  0.707107, 0.707107, 291,
-  0.664364, 0.747409, 310,
-  0.624695, 0.780869, 330,
-  0.588172, 0.808736, 351,
-  0.5547, 0.83205, 372,
-  0.524097, 0.851658, 393,
-  0.496139, 0.868243, 416,
-  0.470588, 0.882353, 438,
-  0.447214, 0.894427, 461,
-  0.425797, 0.904819, 484,
-  0.406138, 0.913812, 508,
-  0.388057, 0.921635, 532,
-  0.371391, 0.928477, 555,
-  0.355995, 0.934488, 579,
-  0.341743, 0.939793, 604,
-  0.328521, 0.944497, 628,
-  0.316228, 0.948683, 652,
-  0.304776, 0.952424, 677,
-  0.294086, 0.955779, 702,
-  0.284088, 0.958798, 726,
-  0.274721, 0.961524, 751,
-  0.265929, 0.963993, 776,
-  0.257663, 0.966235, 801,
-  0.249878, 0.968277, 826,
-  1, 0, 232,
-  0.993884, 0.110432, 233,
-  0.976187, 0.21693, 237,
-  0.948683, 0.316228, 244,
-  0.913812, 0.406138, 254,
-  0.874157, 0.485643, 265,
-  0.83205, 0.5547, 279,
-  0.789352, 0.613941, 294,
-  0.747409, 0.664364, 310,
-  0.707107, 0.707107, 328,
-  0.668965, 0.743294, 347,
-  0.633238, 0.773957, 366,
-  0.6, 0.8, 387,
-  0.56921, 0.822192, 408,
-  0.540758, 0.841179, 429,
-  0.514496, 0.857493, 451,
-  0.490261, 0.871575, 473,
-  0.467888, 0.883788, 496,
-  0.447214, 0.894427, 519,
-  0.428086, 0.903738, 542,
-  0.410365, 0.911922, 565,
-  0.393919, 0.919145, 589,
-  0.378633, 0.925547, 613,
-  0.364399, 0.931243, 637,
-  0.351123, 0.936329, 661,
-  0.338719, 0.940887, 685,
-  0.327111, 0.944986, 710,
-  0.316228, 0.948683, 734,
-  0.306009, 0.952029, 758,
-  0.296399, 0.955064, 783,
-  0.287348, 0.957826, 808,
-  0.27881, 0.960346, 833,
-  1, 0, 258,
-  0.995037, 0.0995037, 259,
-  0.980581, 0.196116, 263,
-  0.957826, 0.287348, 269,
-  0.928477, 0.371391, 277,
-  0.894427, 0.447214, 288,
-  0.857493, 0.514496, 300,
-  0.819232, 0.573462, 315,
-  0.780869, 0.624695, 330,
-  0.743294, 0.668965, 347,
-  0.707107, 0.707107, 364,
-  0.672673, 0.73994, 383,
-  0.640184, 0.768221, 403,
-  0.609711, 0.792624, 423,
-  0.581238, 0.813733, 443,
-  0.5547, 0.83205, 465,
-  0.529999, 0.847998, 486,
-  0.50702, 0.861934, 508,
-  0.485643, 0.874157, 531,
-  0.465746, 0.884918, 554,
-  0.447214, 0.894427, 577,
-  0.429934, 0.902861, 600,
-  0.413803, 0.910366, 623,
-  0.398726, 0.91707, 647,
-  0.384615, 0.923077, 670,
-  0.371391, 0.928477, 694,
-  0.358979, 0.933346, 718,
-  0.347314, 0.937749, 743,
-  0.336336, 0.941742, 767,
-  0.325991, 0.945373, 791,
-  0.316228, 0.948683, 816,
-  0.307003, 0.951709, 840,
-  1, 0, 283,
-  0.995893, 0.0905357, 285,
-  0.98387, 0.178885, 288,
-  0.964764, 0.263117, 294,
-  0.939793, 0.341743, 302,
-  0.910366, 0.413803, 311,
-  0.877896, 0.478852, 323,
-  0.843661, 0.536875, 336,
-  0.808736, 0.588172, 351,
-  0.773957, 0.633238, 366,
-  0.73994, 0.672673, 383,
-  0.707107, 0.707107, 401,
-  0.675725, 0.737154, 420,
-  0.645942, 0.763386, 439,
-  0.617822, 0.786318, 459,
-  0.591364, 0.806405, 480,
-  0.566529, 0.824042, 501,
-  0.543251, 0.83957, 522,
-  0.52145, 0.853282, 544,
-  0.501036, 0.865426, 566,
-  0.481919, 0.876216, 589,
-  0.464007, 0.885832, 611,
-  0.447214, 0.894427, 634,
-  0.431455, 0.902134, 657,
-  0.416655, 0.909065, 681,
-  0.402739, 0.915315, 704,
-  0.38964, 0.920967, 728,
-  0.377297, 0.926092, 752,
-  0.365652, 0.930751, 776,
-  0.354654, 0.934998, 800,
-  0.344255, 0.938876, 824,
-  0.33441, 0.942428, 848,
-  1, 0, 309,
-  0.996546, 0.0830455, 310,
-  0.986394, 0.164399, 313,
-  0.970142, 0.242536, 319,
-  0.948683, 0.316228, 326,
-  0.923077, 0.384615, 335,
-  0.894427, 0.447214, 346,
-  0.863779, 0.503871, 358,
-  0.83205, 0.5547, 372,
-  0.8, 0.6, 387,
-  0.768221, 0.640184, 403,
-  0.737154, 0.675725, 420,
-  0.707107, 0.707107, 437,
-  0.67828, 0.734803, 456,
-  0.650791, 0.759257, 475,
-  0.624695, 0.780869, 495,
-  0.6, 0.8, 516,
-  0.576683, 0.816968, 536,
-  0.5547, 0.83205, 558,
-  0.533993, 0.845489, 579,
-  0.514496, 0.857493, 601,
-  0.496139, 0.868243, 624,
-  0.478852, 0.877896, 646,
-  0.462566, 0.886585, 669,
-  0.447214, 0.894427, 692,
-  0.432731, 0.901523, 715,
-  0.419058, 0.907959, 738,
-  0.406138, 0.913812, 762,
-  0.393919, 0.919145, 786,
-  0.382352, 0.924017, 809,
-  0.371391, 0.928477, 833,
-  0.360994, 0.932568, 857,
-  1, 0, 335,
-  0.997055, 0.0766965, 336,
-  0.988372, 0.152057, 339,
-  0.974391, 0.22486, 344,
-  0.955779, 0.294086, 351,
-  0.933346, 0.358979, 359,
-  0.907959, 0.419058, 369,
-  0.880471, 0.4741, 381,
-  0.851658, 0.524097, 393,
-  0.822192, 0.56921, 408,
-  0.792624, 0.609711, 423,
-  0.763386, 0.645942, 439,
-  0.734803, 0.67828, 456,
-  0.707107, 0.707107, 474,
-  0.680451, 0.732794, 493,
-  0.654931, 0.755689, 512,
-  0.630593, 0.776114, 532,
-  0.60745, 0.794358, 552,
-  0.585491, 0.810679, 572,
-  0.564684, 0.825307, 594,
-  0.544988, 0.838444, 615,
-  0.526355, 0.850265, 637,
-  0.508729, 0.860927, 659,
-  0.492057, 0.870563, 681,
-  0.476283, 0.879292, 704,
-  0.461353, 0.887217, 727,
-  0.447214, 0.894427, 750,
-  0.433816, 0.901002, 773,
-  0.421111, 0.907009, 796,
-  0.409056, 0.912509, 820,
-  0.397607, 0.917556, 843,
-  0.386727, 0.922194, 867,
-  1, 0, 361,
-  0.997459, 0.071247, 362,
-  0.989949, 0.141421, 364,
-  0.977802, 0.209529, 369,
-  0.961524, 0.274721, 375,
-  0.941742, 0.336336, 383,
-  0.919145, 0.393919, 393,
-  0.894427, 0.447214, 403,
-  0.868243, 0.496139, 416,
-  0.841179, 0.540758, 429,
-  0.813733, 0.581238, 443,
-  0.786318, 0.617822, 459,
-  0.759257, 0.650791, 475,
-  0.732794, 0.680451, 493,
-  0.707107, 0.707107, 510,
-  0.682318, 0.731055, 529,
-  0.658505, 0.752577, 548,
-  0.635707, 0.77193, 568,
-  0.613941, 0.789352, 588,
-  0.593199, 0.805056, 609,
-  0.573462, 0.819232, 630,
-  0.5547, 0.83205, 651,
-  0.536875, 0.843661, 672,
-  0.519947, 0.854199, 694,
-  0.503871, 0.863779, 717,
-  0.488603, 0.872506, 739,
-  0.4741, 0.880471, 762,
-  0.460317, 0.887755, 784,
-  0.447214, 0.894427, 807,
-  0.434749, 0.900552, 831,
-  0.422885, 0.906183, 854,
-  0.411587, 0.911371, 877,
-  1, 0, 387,
-  0.997785, 0.066519, 387,
-  0.991228, 0.132164, 390,
-  0.980581, 0.196116, 394,
-  0.966235, 0.257663, 400,
-  0.948683, 0.316228, 408,
-  0.928477, 0.371391, 416,
-  0.906183, 0.422885, 427,
-  0.882353, 0.470588, 438,
-  0.857493, 0.514496, 451,
-  0.83205, 0.5547, 465,
-  0.806405, 0.591364, 480,
-  0.780869, 0.624695, 495,
-  0.755689, 0.654931, 512,
-  0.731055, 0.682318, 529,
-  0.707107, 0.707107, 547,
-  0.683941, 0.729537, 565,
-  0.661622, 0.749838, 585,
-  0.640184, 0.768221, 604,
-  0.619644, 0.784883, 624,
-  0.6, 0.8, 645,
-  0.581238, 0.813733, 665,
-  0.563337, 0.826227, 687,
-  0.546268, 0.837611, 708,
-  0.529999, 0.847998, 730,
-  0.514496, 0.857493, 752,
-  0.499722, 0.866186, 774,
-  0.485643, 0.874157, 797,
-  0.472221, 0.88148, 819,
-  0.459423, 0.888218, 842,
-  0.447214, 0.894427, 865,
-  0.435561, 0.900159, 888,
-  1, 0, 412,
-  0.998053, 0.0623783, 413,
-  0.992278, 0.124035, 416,
-  0.982872, 0.184289, 420,
-  0.970143, 0.242536, 425,
-  0.95448, 0.298275, 432,
-  0.936329, 0.351123, 440,
-  0.916157, 0.400819, 450,
-  0.894427, 0.447214, 461,
-  0.871575, 0.490261, 473,
-  0.847998, 0.529999, 486,
-  0.824042, 0.566529, 501,
-  0.8, 0.6, 516,
-  0.776114, 0.630593, 532,
-  0.752577, 0.658505, 548,
-  0.729537, 0.683941, 565,
-  0.707107, 0.707107, 583,
-  0.685365, 0.7282, 602,
-  0.664364, 0.747409, 621,
-  0.644136, 0.764911, 641,
-  0.624695, 0.780869, 660,
-  0.606043, 0.795432, 681,
-  0.588172, 0.808736, 702,
-  0.571064, 0.820905, 723,
-  0.5547, 0.83205, 744,
-  0.539054, 0.842271, 765,
-  0.524097, 0.851658, 787,
-  0.509802, 0.860291, 809,
-  0.496139, 0.868243, 832,
-  0.483077, 0.875578, 854,
-  0.470588, 0.882353, 877,
-  0.458643, 0.888621, 900,
-  1, 0, 438,
-  0.998274, 0.058722, 439,
-  0.993151, 0.116841, 441,
-  0.984784, 0.173785, 445,
-  0.973417, 0.229039, 450,
-  0.959365, 0.282166, 457,
-  0.94299, 0.33282, 465,
-  0.924678, 0.38075, 474,
-  0.904819, 0.425797, 484,
-  0.883788, 0.467888, 496,
-  0.861934, 0.50702, 508,
-  0.83957, 0.543251, 522,
-  0.816968, 0.576683, 536,
-  0.794358, 0.60745, 552,
-  0.77193, 0.635707, 568,
-  0.749838, 0.661622, 585,
-  0.7282, 0.685365, 602,
-  0.707107, 0.707107, 620,
-  0.686624, 0.727013, 638,
-  0.666795, 0.745241, 657,
-  0.647648, 0.761939, 677,
-  0.629198, 0.777245, 697,
-  0.611448, 0.791285, 717,
-  0.594391, 0.804176, 738,
-  0.578017, 0.816024, 758,
-  0.56231, 0.826927, 780,
-  0.547249, 0.83697, 801,
-  0.532813, 0.846233, 823,
-  0.518978, 0.854788, 845,
-  0.505719, 0.862698, 867,
-  0.493013, 0.870022, 889,
-  0.480833, 0.876812, 912,
-  1, 0, 464,
-  0.99846, 0.05547, 465,
-  0.993884, 0.110432, 467,
-  0.986394, 0.164399, 470,
-  0.976187, 0.21693, 475,
-  0.963518, 0.267644, 482,
-  0.948683, 0.316228, 489,
-  0.932005, 0.362446, 498,
-  0.913812, 0.406138, 508,
-  0.894427, 0.447214, 519,
-  0.874157, 0.485643, 531,
-  0.853282, 0.52145, 544,
-  0.83205, 0.5547, 558,
-  0.810679, 0.585491, 572,
-  0.789352, 0.613941, 588,
-  0.768221, 0.640184, 604,
-  0.747409, 0.664364, 621,
-  0.727013, 0.686624, 638,
-  0.707107, 0.707107, 656,
-  0.687745, 0.725953, 675,
-  0.668965, 0.743294, 694,
-  0.650791, 0.759257, 713,
-  0.633238, 0.773957, 733,
-  0.616308, 0.787505, 753,
-  0.6, 0.8, 774,
-  0.584305, 0.811534, 794,
-  0.56921, 0.822192, 816,
-  0.5547, 0.83205, 837,
-  0.540758, 0.841179, 859,
-  0.527363, 0.84964, 880,
-  0.514496, 0.857493, 902,
-  0.502136, 0.864789, 925,
-  1, 0, 490,
-  0.998618, 0.0525588, 491,
-  0.994505, 0.104685, 493,
-  0.987763, 0.155963, 496,
-  0.97855, 0.20601, 501,
-  0.967075, 0.254493, 507,
-  0.953583, 0.301131, 514,
-  0.938343, 0.345705, 522,
-  0.921635, 0.388057, 532,
-  0.903738, 0.428086, 542,
-  0.884918, 0.465746, 554,
-  0.865426, 0.501036, 566,
-  0.845489, 0.533993, 579,
-  0.825307, 0.564684, 594,
-  0.805056, 0.593199, 609,
-  0.784883, 0.619644, 624,
-  0.764911, 0.644136, 641,
-  0.745241, 0.666795, 657,
-  0.725953, 0.687745, 675,
-  0.707107, 0.707107, 693,
-  0.688749, 0.724999, 711,
-  0.670913, 0.741536, 730,
-  0.65362, 0.756823, 750,
-  0.636881, 0.770962, 769,
-  0.620703, 0.784046, 789,
-  0.605083, 0.796162, 810,
-  0.590017, 0.807391, 831,
-  0.575493, 0.817806, 852,
-  0.561501, 0.827476, 873,
-  0.548026, 0.836461, 894,
-  0.535052, 0.844819, 916,
-  0.522562, 0.852601, 938,
-  1, 0, 516,
-  0.998752, 0.0499376, 516,
-  0.995037, 0.0995037, 518,
-  0.988936, 0.14834, 521,
-  0.980581, 0.196116, 526,
-  0.970142, 0.242536, 532,
-  0.957826, 0.287348, 538,
-  0.943858, 0.33035, 546,
-  0.928477, 0.371391, 555,
-  0.911922, 0.410365, 565,
-  0.894427, 0.447214, 577,
-  0.876216, 0.481919, 589,
-  0.857493, 0.514496, 601,
-  0.838444, 0.544988, 615,
-  0.819232, 0.573462, 630,
-  0.8, 0.6, 645,
-  0.780869, 0.624695, 660,
-  0.761939, 0.647648, 677,
-  0.743294, 0.668965, 694,
-  0.724999, 0.688749, 711,
-  0.707107, 0.707107, 729,
-  0.689655, 0.724138, 748,
-  0.672673, 0.73994, 767,
-  0.656179, 0.754606, 786,
-  0.640184, 0.768221, 806,
-  0.624695, 0.780869, 826,
-  0.609711, 0.792624, 846,
-  0.595228, 0.803557, 867,
-  0.581238, 0.813733, 887,
-  0.567733, 0.823213, 909,
-  0.5547, 0.83205, 930,
-  0.542127, 0.840297, 952,
-  1, 0, 541,
-  0.998868, 0.0475651, 542,
-  0.995495, 0.0948091, 544,
-  0.989949, 0.141421, 547,
-  0.982339, 0.187112, 551,
-  0.972806, 0.231621, 557,
-  0.961524, 0.274721, 563,
-  0.948683, 0.316228, 571,
-  0.934488, 0.355995, 579,
-  0.919145, 0.393919, 589,
-  0.902861, 0.429934, 600,
-  0.885832, 0.464007, 611,
-  0.868243, 0.496139, 624,
-  0.850265, 0.526355, 637,
-  0.83205, 0.5547, 651,
-  0.813733, 0.581238, 665,
-  0.795432, 0.606043, 681,
-  0.777245, 0.629198, 697,
-  0.759257, 0.650791, 713,
-  0.741536, 0.670913, 730,
-  0.724138, 0.689655, 748,
-  0.707107, 0.707107, 766,
-  0.690476, 0.723356, 784,
-  0.674269, 0.738486, 803,
-  0.658505, 0.752577, 822,
-  0.643192, 0.765705, 842,
-  0.628337, 0.777941, 862,
-  0.613941, 0.789352, 882,
-  0.6, 0.8, 903,
-  0.58651, 0.809942, 924,
-  0.573462, 0.819232, 945,
-  0.560848, 0.827919, 966,
-  1, 0, 567,
-  0.998969, 0.0454077, 568,
-  0.995893, 0.0905357, 570,
-  0.99083, 0.135113, 572,
-  0.98387, 0.178885, 577,
-  0.975133, 0.221621, 582,
-  0.964764, 0.263117, 588,
-  0.952926, 0.303204, 595,
-  0.939793, 0.341743, 604,
-  0.925547, 0.378633, 613,
-  0.910366, 0.413803, 623,
-  0.894427, 0.447214, 634,
-  0.877896, 0.478852, 646,
-  0.860927, 0.508729, 659,
-  0.843661, 0.536875, 672,
-  0.826227, 0.563337, 687,
-  0.808736, 0.588172, 702,
-  0.791285, 0.611448, 717,
-  0.773957, 0.633238, 733,
-  0.756823, 0.65362, 750,
-  0.73994, 0.672673, 767,
-  0.723356, 0.690476, 784,
-  0.707107, 0.707107, 802,
-  0.691223, 0.722642, 821,
-  0.675725, 0.737154, 840,
-  0.660628, 0.750713, 859,
-  0.645942, 0.763386, 878,
-  0.631673, 0.775235, 898,
-  0.617822, 0.786318, 918,
-  0.604386, 0.796691, 939,
-  0.591364, 0.806405, 960,
-  0.578747, 0.815507, 980,
-  1, 0, 593,
-  0.999056, 0.0434372, 594,
-  0.996241, 0.0866296, 595,
-  0.9916, 0.129339, 598,
-  0.985212, 0.171341, 602,
-  0.977176, 0.21243, 607,
-  0.967617, 0.252422, 613,
-  0.956674, 0.291162, 620,
-  0.944497, 0.328521, 628,
-  0.931243, 0.364399, 637,
-  0.91707, 0.398726, 647,
-  0.902134, 0.431455, 657,
-  0.886585, 0.462566, 669,
-  0.870563, 0.492057, 681,
-  0.854199, 0.519947, 694,
-  0.837611, 0.546268, 708,
-  0.820905, 0.571064, 723,
-  0.804176, 0.594391, 738,
-  0.787505, 0.616308, 753,
-  0.770962, 0.636881, 769,
-  0.754606, 0.656179, 786,
-  0.738486, 0.674269, 803,
-  0.722642, 0.691223, 821,
-  0.707107, 0.707107, 839,
-  0.691905, 0.721988, 857,
-  0.677056, 0.735931, 876,
-  0.662574, 0.748996, 895,
-  0.648466, 0.761243, 915,
-  0.634739, 0.772726, 935,
-  0.621395, 0.783498, 955,
-  0.608432, 0.793606, 975,
-  0.595847, 0.803098, 996,
-  1, 0, 619,
-  0.999133, 0.0416305, 619,
-  0.996546, 0.0830455, 621,
-  0.992278, 0.124035, 624,
-  0.986394, 0.164399, 627,
-  0.97898, 0.203954, 632,
-  0.970142, 0.242536, 638,
-  0.96, 0.28, 645,
-  0.948683, 0.316228, 652,
-  0.936329, 0.351123, 661,
-  0.923077, 0.384615, 670,
-  0.909065, 0.416655, 681,
-  0.894427, 0.447214, 692,
-  0.879292, 0.476283, 704,
-  0.863779, 0.503871, 717,
-  0.847998, 0.529999, 730,
-  0.83205, 0.5547, 744,
-  0.816024, 0.578017, 758,
-  0.8, 0.6, 774,
-  0.784046, 0.620703, 789,
-  0.768221, 0.640184, 806,
-  0.752577, 0.658505, 822,
-  0.737154, 0.675725, 840,
-  0.721988, 0.691905, 857,
-  0.707107, 0.707107, 875,
-  0.692532, 0.721387, 894,
-  0.67828, 0.734803, 913,
-  0.664364, 0.747409, 932,
-  0.650791, 0.759257, 951,
-  0.637568, 0.770394, 971,
-  0.624695, 0.780869, 991,
-  0.612173, 0.790724, 1011,
-  1, 0, 645,
-  0.999201, 0.039968, 645,
-  0.996815, 0.0797452, 647,
-  0.992877, 0.119145, 649,
-  0.987441, 0.15799, 653,
-  0.980581, 0.196116, 657,
-  0.972387, 0.233373, 663,
-  0.962964, 0.26963, 669,
-  0.952424, 0.304776, 677,
-  0.940887, 0.338719, 685,
-  0.928477, 0.371391, 694,
-  0.915315, 0.402739, 704,
-  0.901523, 0.432731, 715,
-  0.887217, 0.461353, 727,
-  0.872506, 0.488603, 739,
-  0.857493, 0.514496, 752,
-  0.842271, 0.539054, 765,
-  0.826927, 0.56231, 780,
-  0.811534, 0.584305, 794,
-  0.796162, 0.605083, 810,
-  0.780869, 0.624695, 826,
-  0.765705, 0.643192, 842,
-  0.750713, 0.660628, 859,
-  0.735931, 0.677056, 876,
-  0.721387, 0.692532, 894,
-  0.707107, 0.707107, 912,
-  0.693109, 0.720833, 930,
-  0.679408, 0.733761, 949,
-  0.666016, 0.745938, 968,
-  0.65294, 0.75741, 988,
-  0.640184, 0.768221, 1007,
-  0.627752, 0.778413, 1027,
-  1, 0, 670,
-  0.999261, 0.0384331, 671,
-  0.997055, 0.0766965, 672,
-  0.993409, 0.114624, 675,
-  0.988372, 0.152057, 678,
-  0.982006, 0.188847, 683,
-  0.974391, 0.22486, 688,
-  0.965616, 0.259973, 694,
-  0.955779, 0.294086, 702,
-  0.944986, 0.327111, 710,
-  0.933346, 0.358979, 718,
-  0.920967, 0.38964, 728,
-  0.907959, 0.419058, 738,
-  0.894427, 0.447214, 750,
-  0.880471, 0.4741, 762,
-  0.866186, 0.499722, 774,
-  0.851658, 0.524097, 787,
-  0.83697, 0.547249, 801,
-  0.822192, 0.56921, 816,
-  0.807391, 0.590017, 831,
-  0.792624, 0.609711, 846,
-  0.777941, 0.628337, 862,
-  0.763386, 0.645942, 878,
-  0.748996, 0.662574, 895,
-  0.734803, 0.67828, 913,
-  0.720833, 0.693109, 930,
-  0.707107, 0.707107, 948,
-  0.693642, 0.72032, 967,
-  0.680451, 0.732794, 986,
-  0.667545, 0.744569, 1005,
-  0.654931, 0.755689, 1024,
-  0.642612, 0.766192, 1044,
-  1, 0, 696,
-  0.999315, 0.0370117, 697,
-  0.997268, 0.0738717, 698,
-  0.993884, 0.110432, 701,
-  0.989204, 0.146549, 704,
-  0.983282, 0.182089, 708,
-  0.976187, 0.21693, 713,
-  0.967997, 0.250962, 719,
-  0.958798, 0.284088, 726,
-  0.948683, 0.316228, 734,
-  0.937749, 0.347314, 743,
-  0.926092, 0.377297, 752,
-  0.913812, 0.406138, 762,
-  0.901002, 0.433816, 773,
-  0.887755, 0.460317, 784,
-  0.874157, 0.485643, 797,
-  0.860291, 0.509802, 809,
-  0.846233, 0.532813, 823,
-  0.83205, 0.5547, 837,
-  0.817806, 0.575493, 852,
-  0.803557, 0.595228, 867,
-  0.789352, 0.613941, 882,
-  0.775235, 0.631673, 898,
-  0.761243, 0.648466, 915,
-  0.747409, 0.664364, 932,
-  0.733761, 0.679408, 949,
-  0.72032, 0.693642, 967,
-  0.707107, 0.707107, 985,
-  0.694136, 0.719844, 1003,
-  0.681419, 0.731894, 1022,
-  0.668965, 0.743294, 1041,
-  0.656781, 0.754082, 1060,
-  1, 0, 722,
-  0.999363, 0.0356915, 723,
-  0.997459, 0.071247, 724,
-  0.994309, 0.106533, 726,
-  0.989949, 0.141421, 729,
-  0.984428, 0.175791, 734,
-  0.977802, 0.209529, 738,
-  0.970142, 0.242536, 744,
-  0.961524, 0.274721, 751,
-  0.952029, 0.306009, 758,
-  0.941742, 0.336336, 767,
-  0.930751, 0.365652, 776,
-  0.919145, 0.393919, 786,
-  0.907009, 0.421111, 796,
-  0.894427, 0.447214, 807,
-  0.88148, 0.472221, 819,
-  0.868243, 0.496139, 832,
-  0.854788, 0.518978, 845,
-  0.841179, 0.540758, 859,
-  0.827476, 0.561501, 873,
-  0.813733, 0.581238, 887,
-  0.8, 0.6, 903,
-  0.786318, 0.617822, 918,
-  0.772726, 0.634739, 935,
-  0.759257, 0.650791, 951,
-  0.745938, 0.666016, 968,
-  0.732794, 0.680451, 986,
-  0.719844, 0.694136, 1003,
-  0.707107, 0.707107, 1021,
-  0.694595, 0.719401, 1040,
-  0.682318, 0.731055, 1059,
-  0.670286, 0.742103, 1078,
-  1, 0, 748,
-  0.999406, 0.0344623, 748,
-  0.99763, 0.0688021, 750,
-  0.994692, 0.102899, 752,
-  0.990621, 0.136637, 755,
-  0.98546, 0.169907, 759,
-  0.97926, 0.202606, 764,
-  0.972082, 0.234641, 769,
-  0.963993, 0.265929, 776,
-  0.955064, 0.296399, 783,
-  0.945373, 0.325991, 791,
-  0.934998, 0.354654, 800,
-  0.924017, 0.382352, 809,
-  0.912509, 0.409056, 820,
-  0.900552, 0.434749, 831,
-  0.888218, 0.459423, 842,
-  0.875578, 0.483077, 854,
-  0.862698, 0.505719, 867,
-  0.84964, 0.527363, 880,
-  0.836461, 0.548026, 894,
-  0.823213, 0.567733, 909,
-  0.809942, 0.58651, 924,
-  0.796691, 0.604386, 939,
-  0.783498, 0.621395, 955,
-  0.770394, 0.637568, 971,
-  0.75741, 0.65294, 988,
-  0.744569, 0.667545, 1005,
-  0.731894, 0.681419, 1022,
-  0.719401, 0.694595, 1040,
-  0.707107, 0.707107, 1058,
-  0.695022, 0.718988, 1076,
-  0.683157, 0.730271, 1095,
-  1, 0, 774,
-  0.999445, 0.0333148, 774,
-  0.997785, 0.066519, 775,
-  0.995037, 0.0995037, 778,
-  0.991228, 0.132164, 781,
-  0.986394, 0.164399, 784,
-  0.980581, 0.196116, 789,
-  0.973841, 0.22723, 794,
-  0.966235, 0.257663, 801,
-  0.957826, 0.287348, 808,
-  0.948683, 0.316228, 816,
-  0.938876, 0.344255, 824,
-  0.928477, 0.371391, 833,
-  0.917556, 0.397607, 843,
-  0.906183, 0.422885, 854,
-  0.894427, 0.447214, 865,
-  0.882353, 0.470588, 877,
-  0.870022, 0.493013, 889,
-  0.857493, 0.514496, 902,
-  0.844819, 0.535052, 916,
-  0.83205, 0.5547, 930,
-  0.819232, 0.573462, 945,
-  0.806405, 0.591364, 960,
-  0.793606, 0.608432, 975,
-  0.780869, 0.624695, 991,
-  0.768221, 0.640184, 1007,
-  0.755689, 0.654931, 1024,
-  0.743294, 0.668965, 1041,
-  0.731055, 0.682318, 1059,
-  0.718988, 0.695022, 1076,
-  0.707107, 0.707107, 1094,
-  0.695421, 0.718602, 1113,
-  1, 0, 800,
-  0.99948, 0.0322413, 800,
-  0.997925, 0.0643823, 801,
-  0.99535, 0.0963242, 803,
-  0.991778, 0.127971, 806,
-  0.987241, 0.159232, 810,
-  0.98178, 0.190022, 814,
-  0.975441, 0.220261, 820,
-  0.968277, 0.249878, 826,
-  0.960346, 0.27881, 833,
-  0.951709, 0.307003, 840,
-  0.942428, 0.33441, 848,
-  0.932568, 0.360994, 857,
-  0.922194, 0.386727, 867,
-  0.911371, 0.411587, 877,
-  0.900159, 0.435561, 888,
-  0.888621, 0.458643, 900,
-  0.876812, 0.480833, 912,
-  0.864789, 0.502136, 925,
-  0.852601, 0.522562, 938,
-  0.840297, 0.542127, 952,
-  0.827919, 0.560848, 966,
-  0.815507, 0.578747, 980,
-  0.803098, 0.595847, 996,
-  0.790724, 0.612173, 1011,
-  0.778413, 0.627752, 1027,
-  0.766192, 0.642612, 1044,
-  0.754082, 0.656781, 1060,
-  0.742103, 0.670286, 1078,
-  0.730271, 0.683157, 1095,
-  0.718602, 0.695421, 1113,
-  0.707107, 0.707107, 1131
-};
-
-RIPPLE_AMP ripple_amp[RIPPLE_LENGTH] =
-{
-  0,
-  2.96058e-06,
-  0.000131057,
-  0.00044642,
-  0.000945887,
-  0.00162576,
-  0.00248181,
-  0.00350931,
-  0.00470306,
-  0.00605736,
-  0.0075661,
-  0.00922273,
-  0.0110203,
-  0.0129515,
-  0.0150086,
-  0.0171836,
-  0.0194683,
-  0.0218541,
-  0.0243321,
-  0.0268934,
-  0.0295288,
-  0.0322288,
-  0.0349841,
-  0.0377851,
-  0.0406221,
-  0.0434855,
-  0.0463656,
-  0.0492527,
-  0.0521374,
-  0.0550101,
-  0.0578613,
-  0.060682,
-  0.063463,
-  0.0661954,
-  0.0688706,
-  0.0714802,
-  0.074016,
-  0.0764702,
-  0.0788353,
-  0.081104,
-  0.0832696,
-  0.0853256,
-  0.0872659,
-  0.0890848,
-  0.090777,
-  0.0923378,
-  0.0937628,
-  0.0950481,
-  0.0961901,
-  0.097186,
-  0.0980331,
-  0.0987295,
-  0.0992736,
-  0.0996644,
-  0.0999011,
-  0.0999838,
-  0.0999128,
-  0.0996889,
-  0.0993133,
-  0.098788,
-  0.098115,
-  0.097297,
-  0.0963371,
-  0.0952388,
-  0.0940059,
-  0.0926426,
-  0.0911537,
-  0.0895441,
-  0.0878191,
-  0.0859844,
-  0.0840458,
-  0.0820095,
-  0.079882,
-  0.07767,
-  0.0753804,
-  0.0730202,
-  0.0705966,
-  0.068117,
-  0.0655889,
-  0.0630199,
-  0.0604176,
-  0.0577896,
-  0.0551438,
-  0.0524877,
-  0.049829,
-  0.0471754,
-  0.0445344,
-  0.0419134,
-  0.0393198,
-  0.0367607,
-  0.0342431,
-  0.0317739,
-  0.0293597,
-  0.027007,
-  0.0247218,
-  0.0225101,
-  0.0203776,
-  0.0183295,
-  0.0163711,
-  0.0145069,
-  0.0127414,
-  0.0110788,
-  0.00952268,
-  0.00807647,
-  0.00674318,
-  0.00552545,
-  0.00442555,
-  0.00344538,
-  0.00258644,
-  0.00184986,
-  0.00123638,
-  0.000746374,
-  0.000379814,
-  0.00013631,
-  1.50917e-05,
-  1.50262e-05,
-  0.000134618,
-  0.000372018,
-  0.000725034,
-  0.00119114,
-  0.00176748,
-  0.00245089,
-  0.0032379,
-  0.00412476,
-  0.00510744,
-  0.00618166,
-  0.00734288,
-  0.00858635,
-  0.0099071,
-  0.0113,
-  0.0127596,
-  0.0142805,
-  0.015857,
-  0.0174835,
-  0.0191539,
-  0.0208623,
-  0.0226028,
-  0.0243693,
-  0.0261557,
-  0.0279558,
-  0.0297637,
-  0.0315731,
-  0.0333782,
-  0.035173,
-  0.0369516,
-  0.0387082,
-  0.0404372,
-  0.0421331,
-  0.0437906,
-  0.0454043,
-  0.0469694,
-  0.0484809,
-  0.0499343,
-  0.0513251,
-  0.0526492,
-  0.0539027,
-  0.0550818,
-  0.0561832,
-  0.0572037,
-  0.0581404,
-  0.0589908,
-  0.0597525,
-  0.0604235,
-  0.0610022,
-  0.0614871,
-  0.0618771,
-  0.0621714,
-  0.0623695,
-  0.0624712,
-  0.0624766,
-  0.062386,
-  0.0622002,
-  0.0619202,
-  0.0615471,
-  0.0610826,
-  0.0605284,
-  0.0598865,
-  0.0591594,
-  0.0583495,
-  0.0574597,
-  0.056493,
-  0.0554526,
-  0.0543418,
-  0.0531645,
-  0.0519243,
-  0.0506251,
-  0.0492712,
-  0.0478667,
-  0.046416,
-  0.0449235,
-  0.0433939,
-  0.0418317,
-  0.0402417,
-  0.0386285,
-  0.036997,
-  0.0353519,
-  0.033698,
-  0.0320402,
-  0.0303831,
-  0.0287315,
-  0.02709,
-  0.0254632,
-  0.0238557,
-  0.0222717,
-  0.0207157,
-  0.0191917,
-  0.0177039,
-  0.0162561,
-  0.014852,
-  0.0134953,
-  0.0121893,
-  0.0109372,
-  0.00974216,
-  0.00860689,
-  0.00753404,
-  0.006526,
-  0.00558498,
-  0.00471292,
-  0.00391157,
-  0.00318243,
-  0.00252676,
-  0.00194561,
-  0.00143976,
-  0.00100979,
-  0.000656015,
-  0.000378524,
-  0.000177173,
-  5.15851e-05,
-  1.15624e-06,
-  2.50573e-05,
-  0.000122239,
-  0.000291439,
-  0.000531184,
-  0.000839799,
-  0.00121541,
-  0.00165597,
-  0.00215923,
-  0.00272277,
-  0.00334404,
-  0.00402029,
-  0.00474867,
-  0.00552615,
-  0.00634963,
-  0.00721584,
-  0.00812147,
-  0.00906306,
-  0.0100371,
-  0.0110401,
-  0.0120682,
-  0.013118,
-  0.0141856,
-  0.0152673,
-  0.0163594,
-  0.0174581,
-  0.0185598,
-  0.0196607,
-  0.0207571,
-  0.0218454,
-  0.0229222,
-  0.0239838,
-  0.0250269,
-  0.0260481,
-  0.0270443,
-  0.0280122,
-  0.028949,
-  0.0298517,
-  0.0307175,
-  0.031544,
-  0.0323285,
-  0.0330688,
-  0.0337628,
-  0.0344084,
-  0.0350038,
-  0.0355474,
-  0.0360377,
-  0.0364734,
-  0.0368533,
-  0.0371766,
-  0.0374425,
-  0.0376504,
-  0.0378,
-  0.037891,
-  0.0379234,
-  0.0378973,
-  0.0378133,
-  0.0376716,
-  0.0374731,
-  0.0372187,
-  0.0369092,
-  0.036546,
-  0.0361303,
-  0.0356637,
-  0.0351478,
-  0.0345843,
-  0.0339753,
-  0.0333226,
-  0.0326286,
-  0.0318953,
-  0.0311252,
-  0.0303208,
-  0.0294845,
-  0.0286189,
-  0.0277268,
-  0.0268109,
-  0.025874,
-  0.0249189,
-  0.0239484,
-  0.0229654,
-  0.0219729,
-  0.0209737,
-  0.0199707,
-  0.0189668,
-  0.0179648,
-  0.0169676,
-  0.0159779,
-  0.0149986,
-  0.0140321,
-  0.0130813,
-  0.0121486,
-  0.0112364,
-  0.0103473,
-  0.00948342,
-  0.00864699,
-  0.00784011,
-  0.00706477,
-  0.00632281,
-  0.005616,
-  0.00494594,
-  0.00431415,
-  0.00372199,
-  0.00317068,
-  0.00266133,
-  0.00219489,
-  0.00177218,
-  0.00139387,
-  0.00106051,
-  0.000772479,
-  0.000530034,
-  0.000333281,
-  0.000182189,
-  7.65858e-05,
-  1.61636e-05,
-  4.78151e-07,
-  2.89528e-05,
-  0.000100882,
-  0.000215432,
-  0.00037165,
-  0.000568461,
-  0.000804679,
-  0.00107901,
-  0.00139004,
-  0.00173629,
-  0.00211616,
-  0.00252796,
-  0.00296993,
-  0.00344024,
-  0.00393698,
-  0.00445818,
-  0.00500181,
-  0.0055658,
-  0.00614804,
-  0.00674637,
-  0.0073586,
-  0.00798254,
-  0.00861598,
-  0.00925668,
-  0.00990242,
-  0.010551,
-  0.0112002,
-  0.0118478,
-  0.0124917,
-  0.0131297,
-  0.0137598,
-  0.01438,
-  0.0149881,
-  0.0155823,
-  0.0161608,
-  0.0167216,
-  0.0172632,
-  0.0177837,
-  0.0182817,
-  0.0187557,
-  0.0192042,
-  0.0196259,
-  0.0200197,
-  0.0203843,
-  0.0207189,
-  0.0210224,
-  0.0212941,
-  0.0215333,
-  0.0217394,
-  0.0219118,
-  0.0220503,
-  0.0221546,
-  0.0222244,
-  0.0222598,
-  0.0222607,
-  0.0222275,
-  0.0221602,
-  0.0220594,
-  0.0219254,
-  0.0217589,
-  0.0215605,
-  0.0213309,
-  0.021071,
-  0.0207818,
-  0.0204642,
-  0.0201194,
-  0.0197485,
-  0.0193527,
-  0.0189333,
-  0.0184918,
-  0.0180295,
-  0.0175478,
-  0.0170484,
-  0.0165327,
-  0.0160024,
-  0.0154591,
-  0.0149043,
-  0.0143398,
-  0.0137673,
-  0.0131884,
-  0.0126049,
-  0.0120184,
-  0.0114306,
-  0.0108431,
-  0.0102578,
-  0.00967603,
-  0.00909959,
-  0.00852999,
-  0.00796878,
-  0.00741746,
-  0.00687748,
-  0.00635024,
-  0.00583711,
-  0.00533938,
-  0.00485828,
-  0.00439499,
-  0.00395062,
-  0.00352621,
-  0.00312273,
-  0.00274107,
-  0.00238205,
-  0.00204643,
-  0.00173485,
-  0.00144791,
-  0.00118612,
-  0.000949877,
-  0.000739539,
-  0.000555357,
-  0.000397506,
-  0.000266077,
-  0.000161081,
-  8.24463e-05,
-  3.0023e-05,
-  3.58147e-06,
-  2.81518e-06,
-  2.73422e-05,
-  7.67071e-05,
-  0.000150383,
-  0.000247774,
-  0.000368218,
-  0.000510988,
-  0.000675297,
-  0.000860301,
-  0.0010651,
-  0.00128874,
-  0.00153023,
-  0.00178851,
-  0.00206252,
-  0.00235111,
-  0.00265315,
-  0.00296745,
-  0.00329279,
-  0.00362796,
-  0.00397169,
-  0.00432273,
-  0.00467982,
-  0.00504167,
-  0.005407,
-  0.00577455,
-  0.00614305,
-  0.00651124,
-  0.00687787,
-  0.00724173,
-  0.00760161,
-  0.00795633,
-  0.00830474,
-  0.00864572,
-  0.00897819,
-  0.00930111,
-  0.00961347,
-  0.0099143,
-  0.0102027,
-  0.0104778,
-  0.0107387,
-  0.0109848,
-  0.0112153,
-  0.0114295,
-  0.0116269,
-  0.0118068,
-  0.0119689,
-  0.0121127,
-  0.0122379,
-  0.0123441,
-  0.0124311,
-  0.0124988,
-  0.012547,
-  0.0125757,
-  0.0125849,
-  0.0125747,
-  0.0125452,
-  0.0124965,
-  0.012429,
-  0.012343,
-  0.0122387,
-  0.0121167,
-  0.0119774,
-  0.0118212,
-  0.0116488,
-  0.0114607,
-  0.0112577,
-  0.0110403,
-  0.0108093,
-  0.0105655,
-  0.0103096,
-  0.0100425,
-  0.00976502,
-  0.00947803,
-  0.00918241,
-  0.00887907,
-  0.00856894,
-  0.00825294,
-  0.00793204,
-  0.00760716,
-  0.00727926,
-  0.0069493,
-  0.00661821,
-  0.00628695,
-  0.00595645,
-  0.00562762,
-  0.00530138,
-  0.0049786,
-  0.00466017,
-  0.00434693,
-  0.0040397,
-  0.00373929,
-  0.00344644,
-  0.00316191,
-  0.0028864,
-  0.00262057,
-  0.00236505,
-  0.00212045,
-  0.00188731,
-  0.00166614,
-  0.00145742,
-  0.00126158,
-  0.001079,
-  0.000910015,
-  0.000754927,
-  0.000613982,
-  0.000487384,
-  0.000375289,
-  0.000277808,
-  0.000195006,
-  0.000126903,
-  7.34734e-05,
-  3.46461e-05,
-  1.03071e-05,
-  2.98978e-07,
-  4.4223e-06,
-  2.24364e-05,
-  5.40607e-05,
-  9.89762e-05,
-  0.000156826,
-  0.000227219,
-  0.000309728,
-  0.000403896,
-  0.000509231,
-  0.000625218,
-  0.000751309,
-  0.000886936,
-  0.00103151,
-  0.0011844,
-  0.001345,
-  0.00151264,
-  0.00168667,
-  0.0018664,
-  0.00205116,
-  0.00224025,
-  0.00243297,
-  0.00262862,
-  0.00282649,
-  0.00302589,
-  0.00322612,
-  0.00342648,
-  0.00362629,
-  0.00382486,
-  0.00402155,
-  0.00421568,
-  0.00440664,
-  0.0045938,
-  0.00477656,
-  0.00495433,
-  0.00512658,
-  0.00529275,
-  0.00545234,
-  0.00560487,
-  0.00574988,
-  0.00588694,
-  0.00601567,
-  0.00613568,
-  0.00624665,
-  0.00634827,
-  0.00644028,
-  0.00652242,
-  0.00659451,
-  0.00665636,
-  0.00670784,
-  0.00674884,
-  0.0067793,
-  0.00679918,
-  0.00680848,
-  0.00680722,
-  0.00679547,
-  0.00677333,
-  0.00674092,
-  0.0066984,
-  0.00664595,
-  0.00658379,
-  0.00651216,
-  0.00643133,
-  0.0063416,
-  0.00624329,
-  0.00613675,
-  0.00602232,
-  0.00590041,
-  0.00577142,
-  0.00563576,
-  0.00549389,
-  0.00534624,
-  0.00519329,
-  0.00503551,
-  0.00487339,
-  0.00470743,
-  0.00453813,
-  0.00436599,
-  0.00419153,
-  0.00401525,
-  0.00383768,
-  0.00365931,
-  0.00348065,
-  0.00330222,
-  0.0031245,
-  0.00294798,
-  0.00277315,
-  0.00260047,
-  0.00243041,
-  0.00226339,
-  0.00209986,
-  0.00194024,
-  0.00178491,
-  0.00163426,
-  0.00148866,
-  0.00134844,
-  0.00121392,
-  0.00108542,
-  0.000963203,
-  0.000847532,
-  0.00073864,
-  0.00063674,
-  0.000542016,
-  0.000454633,
-  0.000374729,
-  0.000302418,
-  0.000237789,
-  0.000180908,
-  0.000131815,
-  9.05269e-05,
-  5.7035e-05,
-  3.1308e-05,
-  1.32908e-05,
-  2.90539e-06,
-  5.13412e-08,
-  4.60627e-06,
-  1.64266e-05,
-  3.5348e-05,
-  6.11866e-05,
-  9.37392e-05,
-  0.000132785,
-  0.000178085,
-  0.000229384,
-  0.000286413,
-  0.000348887,
-  0.000416508,
-  0.000488966,
-  0.000565939,
-  0.000647098,
-  0.000732101,
-  0.000820601,
-  0.000912245,
-  0.00100667,
-  0.00110352,
-  0.00120242,
-  0.001303,
-  0.0014049,
-  0.00150775,
-  0.00161117,
-  0.00171481,
-  0.00181831,
-  0.0019213,
-  0.00202344,
-  0.00212439,
-  0.00222382,
-  0.00232139,
-  0.00241679,
-  0.00250971,
-  0.00259987,
-  0.00268698,
-  0.00277077,
-  0.00285098,
-  0.00292738,
-  0.00299974,
-  0.00306785,
-  0.00313151,
-  0.00319056,
-  0.00324481,
-  0.00329414,
-  0.00333841,
-  0.00337751,
-  0.00341135,
-  0.00343986,
-  0.00346298,
-  0.00348066,
-  0.00349289,
-  0.00349966,
-  0.00350098,
-  0.00349688,
-  0.0034874,
-  0.00347262,
-  0.0034526,
-  0.00342744,
-  0.00339724,
-  0.00336214,
-  0.00332226,
-  0.00327776,
-  0.00322879,
-  0.00317554,
-  0.00311819,
-  0.00305692,
-  0.00299196,
-  0.00292352,
-  0.00285181,
-  0.00277707,
-  0.00269954,
-  0.00261946,
-  0.00253708,
-  0.00245266,
-  0.00236644,
-  0.0022787,
-  0.00218968,
-  0.00209965,
-  0.00200888,
-  0.00191762,
-  0.00182613,
-  0.00173467,
-  0.0016435,
-  0.00155286,
-  0.00146299,
-  0.00137415,
-  0.00128656,
-  0.00120045,
-  0.00111604,
-  0.00103355,
-  0.000953173,
-  0.000875109,
-  0.000799543,
-  0.00072665,
-  0.000656597,
-  0.000589537,
-  0.000525615,
-  0.000464962,
-  0.0004077,
-  0.000353936,
-  0.000303768,
-  0.00025728,
-  0.000214544,
-  0.00017562,
-  0.000140555,
-  0.000109384,
-  8.21298e-05,
-  5.8802e-05,
-  3.9399e-05,
-  2.39069e-05,
-  1.22998e-05,
-  4.54041e-06,
-  5.8013e-07,
-  3.59233e-07,
-  3.80732e-06,
-  1.08437e-05,
-  2.13775e-05,
-  3.53086e-05,
-  5.25276e-05,
-  7.29164e-05,
-  9.63486e-05,
-  0.00012269,
-  0.0001518,
-  0.000183531,
-  0.000217728,
-  0.000254233,
-  0.000292879,
-  0.0003335,
-  0.000375922,
-  0.000419968,
-  0.000465461,
-  0.000512219,
-  0.000560061,
-  0.000608804,
-  0.000658263,
-  0.000708255,
-  0.0007586,
-  0.000809114,
-  0.00085962,
-  0.000909941,
-  0.000959903,
-  0.00100934,
-  0.00105807,
-  0.00110595,
-  0.00115282,
-  0.00119852,
-  0.00124292,
-  0.00128586,
-  0.00132721,
-  0.00136686,
-  0.00140467,
-  0.00144054,
-  0.00147437,
-  0.00150605,
-  0.00153549,
-  0.00156263,
-  0.00158738,
-  0.00160968,
-  0.00162947,
-  0.00164671,
-  0.00166137,
-  0.00167341,
-  0.00168281,
-  0.00168955,
-  0.00169365,
-  0.00169509,
-  0.0016939,
-  0.00169009,
-  0.00168369,
-  0.00167475,
-  0.0016633,
-  0.0016494,
-  0.0016331,
-  0.00161447,
-  0.00159359,
-  0.00157052,
-  0.00154536,
-  0.0015182,
-  0.00148912,
-  0.00145823,
-  0.00142564,
-  0.00139144,
-  0.00135575,
-  0.00131869,
-  0.00128037,
-  0.00124092,
-  0.00120045,
-  0.00115908,
-  0.00111695,
-  0.00107418,
-  0.00103089,
-  0.000987216,
-  0.000943273,
-  0.00089919,
-  0.000855091,
-  0.000811098,
-  0.000767331,
-  0.000723907,
-  0.000680942,
-  0.000638548,
-  0.000596835,
-  0.000555908,
-  0.00051587,
-  0.000476817,
-  0.000438844,
-  0.000402039,
-  0.000366486,
-  0.000332266,
-  0.000299451,
-  0.000268111,
-  0.000238309,
-  0.000210102,
-  0.000183544,
-  0.00015868,
-  0.00013555,
-  0.00011419,
-  9.46283e-05,
-  7.68873e-05,
-  6.09843e-05,
-  4.69302e-05,
-  3.47303e-05,
-  2.43841e-05,
-  1.58854e-05,
-  9.22229e-06,
-  4.37762e-06,
-  1.32876e-06,
-  4.78941e-08,
-  5.0218e-07,
-  2.65391e-06,
-  6.46068e-06,
-  1.18756e-05,
-  1.88476e-05,
-  2.73213e-05,
-  3.72378e-05,
-  4.85344e-05,
-  6.11451e-05,
-  7.50008e-05,
-  9.00297e-05,
-  0.000106157,
-  0.000123307,
-  0.000141399,
-  0.000160354,
-  0.000180089,
-  0.000200521,
-  0.000221567,
-  0.00024314,
-  0.000265156,
-  0.00028753,
-  0.000310176,
-  0.000333009,
-  0.000355947,
-  0.000378904,
-  0.0004018,
-  0.000424555,
-  0.000447088,
-  0.000469323,
-  0.000491186,
-  0.000512603,
-  0.000533505,
-  0.000553823,
-  0.000573494,
-  0.000592456,
-  0.000610651,
-  0.000628023,
-  0.00064452,
-  0.000660094,
-  0.000674702,
-  0.000688301,
-  0.000700855,
-  0.000712331,
-  0.000722699,
-  0.000731934,
-  0.000740014,
-  0.000746923,
-  0.000752646,
-  0.000757174,
-  0.000760502,
-  0.000762627,
-  0.000763552,
-  0.000763283,
-  0.000761829,
-  0.000759204,
-  0.000755423,
-  0.000750508,
-  0.000744482,
-  0.000737371,
-  0.000729204,
-  0.000720015,
-  0.000709839,
-  0.000698713,
-  0.000686678,
-  0.000673778,
-  0.000660055,
-  0.000645558,
-  0.000630335,
-  0.000614436,
-  0.000597912,
-  0.000580817,
-  0.000563204,
-  0.000545128,
-  0.000526645,
-  0.000507809,
-  0.000488679,
-  0.000469309,
-  0.000449756,
-  0.000430077,
-  0.000410327,
-  0.000390561,
-  0.000370834,
-  0.000351198,
-  0.000331708,
-  0.000312413,
-  0.000293365,
-  0.000274611,
-  0.000256198,
-  0.000238172,
-  0.000220576,
-  0.000203451,
-  0.000186836,
-  0.00017077,
-  0.000155286,
-  0.000140418,
-  0.000126195,
-  0.000112646,
-  9.97956e-05,
-  8.76672e-05,
-  7.6281e-05,
-  6.56545e-05,
-  5.58029e-05,
-  4.67387e-05,
-  3.84717e-05,
-  3.10094e-05,
-  2.43563e-05,
-  1.85146e-05,
-  1.3484e-05,
-  9.26145e-06,
-  5.84178e-06,
-  3.21724e-06,
-  1.37781e-06,
-  3.1118e-07,
-  2.89121e-09,
-  4.36352e-07,
-  1.59295e-06,
-  3.45215e-06,
-  5.99155e-06,
-  9.18704e-06,
-  1.30128e-05,
-  1.74417e-05,
-  2.24448e-05,
-  2.79921e-05,
-  3.40525e-05,
-  4.05935e-05,
-  4.7582e-05,
-  5.49838e-05,
-  6.2764e-05,
-  7.08872e-05,
-  7.93175e-05,
-  8.80185e-05,
-  9.69537e-05,
-  0.000106087,
-  0.00011538,
-  0.000124798,
-  0.000134304,
-  0.000143862,
-  0.000153437,
-  0.000162992,
-  0.000172495,
-  0.000181911,
-  0.000191208,
-  0.000200353,
-  0.000209317,
-  0.000218068,
-  0.000226579,
-  0.000234822,
-  0.000242771,
-  0.000250401,
-  0.00025769,
-  0.000264615,
-  0.000271156,
-  0.000277294,
-  0.000283013,
-  0.000288297,
-  0.000293131,
-  0.000297505,
-  0.000301407,
-  0.000304828,
-  0.000307762,
-  0.000310202,
-  0.000312145,
-  0.00031359,
-  0.000314535,
-  0.000314981,
-  0.000314931,
-  0.00031439,
-  0.000313362,
-  0.000311856,
-  0.000309879,
-  0.000307442,
-  0.000304556,
-  0.000301233,
-  0.000297488,
-  0.000293334,
-  0.000288788,
-  0.000283867,
-  0.000278589,
-  0.000272971,
-  0.000267034,
-  0.000260799,
-  0.000254284,
-  0.000247513,
-  0.000240507,
-  0.000233287,
-  0.000225878,
-  0.0002183,
-  0.000210579,
-  0.000202735,
-  0.000194794,
-  0.000186777,
-  0.000178708,
-  0.00017061,
-  0.000162504,
-  0.000154414,
-  0.00014636,
-  0.000138365,
-  0.000130448,
-  0.000122631,
-  0.000114933,
-  0.000107372,
-  9.99676e-05,
-  9.27363e-05,
-  8.56949e-05,
-  7.88593e-05,
-  7.22442e-05,
-  6.58636e-05,
-  5.97305e-05,
-  5.38569e-05,
-  4.82539e-05,
-  4.29313e-05,
-  3.78983e-05,
-  3.31626e-05,
-  2.87313e-05,
-  2.461e-05,
-  2.08037e-05,
-  1.73159e-05,
-  1.41495e-05,
-  1.13059e-05,
-  8.78593e-06,
-  6.58908e-06,
-  4.71401e-06,
-  3.15835e-06,
-  1.91881e-06,
-  9.91187e-07,
-  3.70365e-07,
-  5.03894e-08,
-  2.44732e-08,
-  2.85042e-07,
-  8.23771e-07,
-  1.63162e-06,
-  2.69888e-06,
-  4.01521e-06,
-  5.56969e-06,
-  7.35085e-06,
-  9.34673e-06,
-  1.15449e-05,
-  1.39326e-05,
-  1.64966e-05,
-  1.92235e-05,
-  2.20994e-05,
-  2.51106e-05,
-  2.82428e-05,
-  3.14818e-05,
-  3.48134e-05,
-  3.82233e-05,
-  4.1697e-05,
-  4.52205e-05,
-  4.87796e-05,
-  5.23604e-05,
-  5.5949e-05,
-  5.9532e-05,
-  6.30961e-05,
-  6.66284e-05,
-  7.01162e-05,
-  7.35475e-05,
-  7.69103e-05,
-  8.01933e-05,
-  8.33857e-05,
-  8.6477e-05,
-  8.94574e-05,
-  9.23176e-05,
-  9.50488e-05,
-  9.76428e-05,
-  0.000100092,
-  0.00010239,
-  0.000104529,
-  0.000106505,
-  0.000108312,
-  0.000109945,
-  0.000111401,
-  0.000112677,
-  0.000113771,
-  0.000114679,
-  0.000115402,
-  0.000115938,
-  0.000116287,
-  0.00011645,
-  0.000116429,
-  0.000116225,
-  0.00011584,
-  0.000115277,
-  0.000114539,
-  0.000113632,
-  0.000112558,
-  0.000111322,
-  0.000109931,
-  0.000108389,
-  0.000106703,
-  0.000104879,
-  0.000102924,
-  0.000100845,
-  9.86492e-05,
-  9.63442e-05,
-  9.39378e-05,
-  9.1438e-05,
-  8.88529e-05,
-  8.61909e-05,
-  8.34602e-05,
-  8.06694e-05,
-  7.7827e-05,
-  7.49413e-05,
-  7.2021e-05,
-  6.90745e-05,
-  6.61101e-05,
-  6.31363e-05,
-  6.01611e-05,
-  5.71926e-05,
-  5.42387e-05,
-  5.13072e-05,
-  4.84054e-05,
-  4.55407e-05,
-  4.27202e-05,
-  3.99504e-05,
-  3.72381e-05,
-  3.45893e-05,
-  3.20099e-05,
-  2.95054e-05,
-  2.70812e-05,
-  2.47421e-05,
-  2.24926e-05,
-  2.03368e-05,
-  1.82786e-05,
-  1.63215e-05,
-  1.44683e-05,
-  1.27219e-05,
-  1.10845e-05,
-  9.55801e-06,
-  8.14397e-06,
-  6.84351e-06,
-  5.65743e-06,
-  4.58613e-06,
-  3.62965e-06,
-  2.78769e-06,
-  2.05959e-06,
-  1.44434e-06,
-  9.4062e-07,
-  5.4678e-07,
-  2.60861e-07,
-  8.06124e-08,
-  3.49772e-09,
-  2.67124e-08,
-  1.47197e-07,
-  3.6165e-07,
-  6.66548e-07,
-  1.05815e-06,
-  1.53254e-06,
-  2.08561e-06,
-  2.71308e-06,
-  3.41055e-06,
-  4.17349e-06,
-  4.99724e-06,
-  5.87707e-06,
-  6.80817e-06,
-  7.78565e-06,
-  8.80461e-06,
-  9.8601e-06,
-  1.09472e-05,
-  1.20609e-05,
-  1.31963e-05,
-  1.43485e-05,
-  1.55128e-05,
-  1.66843e-05,
-  1.78583e-05,
-  1.90303e-05,
-  2.01958e-05,
-  2.13504e-05,
-  2.24898e-05,
-  2.36101e-05,
-  2.47072e-05,
-  2.57774e-05,
-  2.68171e-05,
-  2.78228e-05,
-  2.87913e-05,
-  2.97195e-05,
-  3.06046e-05,
-  3.1444e-05,
-  3.22352e-05,
-  3.29759e-05,
-  3.36642e-05,
-  3.42983e-05,
-  3.48765e-05,
-  3.53976e-05,
-  3.58603e-05,
-  3.62637e-05,
-  3.66071e-05,
-  3.689e-05,
-  3.71122e-05,
-  3.72734e-05,
-  3.7374e-05,
-  3.7414e-05,
-  3.73942e-05,
-  3.73151e-05,
-  3.71776e-05,
-  3.69829e-05,
-  3.67321e-05,
-  3.64265e-05,
-  3.60678e-05,
-  3.56575e-05,
-  3.51976e-05,
-  3.46899e-05,
-  3.41365e-05,
-  3.35395e-05,
-  3.29013e-05,
-  3.22241e-05,
-  3.15104e-05,
-  3.07627e-05,
-  2.99836e-05,
-  2.91756e-05,
-  2.83415e-05,
-  2.74839e-05,
-  2.66055e-05,
-  2.57091e-05,
-  2.47973e-05,
-  2.38729e-05,
-  2.29386e-05,
-  2.19972e-05,
-  2.10512e-05,
-  2.01032e-05,
-  1.91559e-05,
-  1.82118e-05,
-  1.72733e-05,
-  1.63428e-05,
-  1.54226e-05,
-  1.4515e-05,
-  1.36222e-05,
-  1.27461e-05,
-  1.18889e-05,
-  1.10522e-05,
-  1.0238e-05,
-  9.44777e-06,
-  8.6832e-06,
-  7.94568e-06,
-  7.23654e-06,
-  6.55698e-06,
-  5.9081e-06,
-  5.29086e-06,
-  4.70612e-06,
-  4.1546e-06,
-  3.63692e-06,
-  3.15357e-06,
-  2.70493e-06,
-  2.29125e-06,
-  1.91269e-06,
-  1.56927e-06,
-  1.26091e-06,
-  9.87428e-07,
-  7.48537e-07,
-  5.43843e-07,
-  3.72856e-07,
-  2.34993e-07,
-  1.2958e-07,
-  5.58589e-08,
-  1.29881e-08,
-  5.0138e-11,
-  1.60553e-08,
-  5.99464e-08,
-  1.30604e-07,
-  2.2685e-07,
-  3.47457e-07,
-  4.91148e-07,
-  6.56604e-07,
-  8.42471e-07,
-  1.04736e-06,
-  1.26987e-06,
-  1.50855e-06,
-  1.76196e-06,
-  2.02864e-06,
-  2.30712e-06,
-  2.59594e-06,
-  2.89363e-06,
-  3.19875e-06,
-  3.50984e-06,
-  3.82548e-06,
-  4.14428e-06,
-  4.46485e-06,
-  4.78584e-06,
-  5.10596e-06,
-  5.42391e-06,
-  5.73846e-06,
-  6.04842e-06,
-  6.35265e-06,
-  6.65003e-06,
-  6.93953e-06,
-  7.22015e-06,
-  7.49095e-06,
-  7.75105e-06,
-  7.99963e-06,
-  8.23592e-06,
-  8.45922e-06,
-  8.66889e-06,
-  8.86435e-06,
-  9.04509e-06,
-  9.21065e-06,
-  9.36065e-06,
-  9.49475e-06,
-  9.61269e-06,
-  9.71427e-06,
-  9.79934e-06,
-  9.86782e-06,
-  9.91969e-06,
-  9.95498e-06,
-  9.97378e-06,
-  9.97622e-06,
-  9.96251e-06,
-  9.93289e-06,
-  9.88764e-06,
-  9.82711e-06,
-  9.75168e-06,
-  9.66177e-06,
-  9.55785e-06,
-  9.44042e-06,
-  9.31e-06,
-  9.16716e-06,
-  9.0125e-06,
-  8.84663e-06,
-  8.6702e-06,
-  8.48386e-06,
-  8.2883e-06,
-  8.08421e-06,
-  7.8723e-06,
-  7.65329e-06,
-  7.4279e-06,
-  7.19686e-06,
-  6.9609e-06,
-  6.72075e-06,
-  6.47715e-06,
-  6.2308e-06,
-  5.98243e-06,
-  5.73273e-06,
-  5.48241e-06,
-  5.23214e-06,
-  4.98259e-06,
-  4.73439e-06,
-  4.48819e-06,
-  4.24457e-06,
-  4.00412e-06,
-  3.76741e-06,
-  3.53496e-06,
-  3.30729e-06,
-  3.08486e-06,
-  2.86815e-06,
-  2.65756e-06,
-  2.4535e-06,
-  2.25632e-06,
-  2.06635e-06,
-  1.88391e-06,
-  1.70926e-06,
-  1.54263e-06,
-  1.38424e-06,
-  1.23427e-06,
-  1.09285e-06,
-  9.60113e-07,
-  8.36131e-07,
-  7.20964e-07,
-  6.14635e-07,
-  5.17145e-07,
-  4.28461e-07,
-  3.48526e-07,
-  2.77258e-07,
-  2.14547e-07,
-  1.60262e-07,
-  1.14245e-07,
-  7.63215e-08,
-  4.62915e-08,
-  2.39377e-08,
-  9.02416e-09,
-  1.298e-09,
-  4.90465e-10,
-  6.31847e-09,
-  1.84858e-08,
-  3.66846e-08,
-  6.05965e-08,
-  8.9894e-08,
-  1.24242e-07,
-  1.63299e-07,
-  2.06718e-07,
-  2.54149e-07,
-  3.05238e-07,
-  3.59632e-07,
-  4.16976e-07,
-  4.76916e-07,
-  5.39102e-07,
-  6.03185e-07,
-  6.68823e-07,
-  7.35678e-07,
-  8.03417e-07,
-  8.71717e-07,
-  9.40263e-07,
-  1.00875e-06,
-  1.07687e-06,
-  1.14435e-06,
-  1.21091e-06,
-  1.27629e-06,
-  1.34023e-06,
-  1.40249e-06,
-  1.46286e-06,
-  1.52112e-06,
-  1.57708e-06,
-  1.63054e-06,
-  1.68134e-06,
-  1.72934e-06,
-  1.77438e-06,
-  1.81634e-06,
-  1.85512e-06,
-  1.89062e-06,
-  1.92275e-06,
-  1.95146e-06,
-  1.97669e-06,
-  1.99839e-06,
-  2.01656e-06,
-  2.03117e-06,
-  2.04223e-06,
-  2.04976e-06,
-  2.05377e-06,
-  2.05431e-06,
-  2.05144e-06,
-  2.0452e-06,
-  2.03567e-06,
-  2.02293e-06,
-  2.00707e-06,
-  1.98819e-06,
-  1.96639e-06,
-  1.94179e-06,
-  1.91451e-06,
-  1.88467e-06,
-  1.85241e-06,
-  1.81786e-06,
-  1.78116e-06,
-  1.74246e-06,
-  1.70191e-06,
-  1.65964e-06,
-  1.61583e-06,
-  1.57061e-06,
-  1.52414e-06,
-  1.47658e-06,
-  1.42808e-06,
-  1.37879e-06,
-  1.32886e-06,
-  1.27844e-06,
-  1.22767e-06,
-  1.17671e-06,
-  1.12569e-06,
-  1.07474e-06,
-  1.024e-06,
-  9.73608e-07,
-  9.23672e-07,
-  8.74318e-07,
-  8.25657e-07,
-  7.778e-07,
-  7.30847e-07,
-  6.84895e-07,
-  6.40036e-07,
-  5.96353e-07,
-  5.53925e-07,
-  5.12824e-07,
-  4.73115e-07,
-  4.34857e-07,
-  3.98103e-07,
-  3.629e-07,
-  3.29287e-07,
-  2.97298e-07,
-  2.6696e-07,
-  2.38295e-07,
-  2.11317e-07,
-  1.86037e-07,
-  1.62457e-07,
-  1.40577e-07,
-  1.20388e-07,
-  1.01878e-07,
-  8.50293e-08,
-  6.982e-08,
-  5.62231e-08,
-  4.42074e-08,
-  3.37378e-08,
-  2.47753e-08,
-  1.72773e-08,
-  1.11979e-08,
-  6.48828e-09,
-  3.09676e-09,
-  9.69195e-10,
-  4.92116e-11,
-  2.78468e-10,
-  1.59693e-09,
-  3.94312e-09,
-  7.25439e-09,
-  1.14672e-08,
-  1.65173e-08,
-  2.234e-08,
-  2.88705e-08,
-  3.6044e-08,
-  4.3796e-08,
-  5.20624e-08,
-  6.07799e-08,
-  6.98859e-08,
-  7.93191e-08,
-  8.90194e-08,
-  9.8928e-08,
-  1.08988e-07,
-  1.19143e-07,
-  1.29341e-07,
-  1.39529e-07,
-  1.49658e-07,
-  1.5968e-07,
-  1.69552e-07,
-  1.79229e-07,
-  1.88671e-07,
-  1.97842e-07,
-  2.06705e-07,
-  2.15227e-07,
-  2.2338e-07,
-  2.31134e-07,
-  2.38465e-07,
-  2.45351e-07,
-  2.51773e-07,
-  2.57712e-07,
-  2.63154e-07,
-  2.68087e-07,
-  2.72501e-07,
-  2.76388e-07,
-  2.79745e-07,
-  2.82567e-07,
-  2.84855e-07,
-  2.86609e-07,
-  2.87833e-07,
-  2.88533e-07,
-  2.88716e-07,
-  2.88391e-07,
-  2.87568e-07,
-  2.8626e-07,
-  2.8448e-07,
-  2.82243e-07,
-  2.79566e-07,
-  2.76465e-07,
-  2.7296e-07,
-  2.69069e-07,
-  2.64812e-07,
-  2.60211e-07,
-  2.55285e-07,
-  2.50058e-07,
-  2.44552e-07,
-  2.38789e-07,
-  2.32791e-07,
-  2.26582e-07,
-  2.20184e-07,
-  2.1362e-07,
-  2.06913e-07,
-  2.00086e-07,
-  1.93159e-07,
-  1.86156e-07,
-  1.79096e-07,
-  1.72002e-07,
-  1.64893e-07,
-  1.57789e-07,
-  1.50708e-07,
-  1.43669e-07,
-  1.36689e-07,
-  1.29786e-07,
-  1.22974e-07,
-  1.16268e-07,
-  1.09683e-07,
-  1.03232e-07,
-  9.69275e-08,
-  9.07801e-08,
-  8.48006e-08,
-  7.89983e-08,
-  7.3382e-08,
-  6.7959e-08,
-  6.27362e-08,
-  5.77192e-08,
-  5.2913e-08,
-  4.83215e-08,
-  4.39478e-08,
-  3.97942e-08,
-  3.58622e-08,
-  3.21523e-08,
-  2.86646e-08,
-  2.53981e-08,
-  2.23514e-08,
-  1.95221e-08,
-  1.69076e-08,
-  1.45042e-08,
-  1.23081e-08,
-  1.03146e-08,
-  8.51882e-09,
-  6.91521e-09,
-  5.4979e-09,
-  4.26064e-09,
-  3.19684e-09,
-  2.2996e-09,
-  1.56177e-09,
-  9.7599e-10,
-  5.34692e-10,
-  2.30167e-10,
-  5.45889e-11,
-  4.89629e-14,
-  5.85888e-11,
-  2.22232e-10,
-  4.83014e-10,
-  8.33012e-10,
-  1.26437e-09,
-  1.76934e-09,
-  2.34026e-09,
-  2.96966e-09,
-  3.65019e-09,
-  4.37472e-09,
-  5.13629e-09,
-  5.9282e-09,
-  6.74394e-09,
-  7.5773e-09,
-  8.42229e-09,
-  9.27322e-09,
-  1.01247e-08,
-  1.09715e-08,
-  1.18089e-08,
-  1.26323e-08,
-  1.34376e-08,
-  1.42207e-08,
-  1.49781e-08,
-  1.57065e-08,
-  1.64028e-08,
-  1.70644e-08,
-  1.76889e-08,
-  1.82741e-08,
-  1.88183e-08,
-  1.93198e-08,
-  1.97775e-08,
-  2.01904e-08,
-  2.05576e-08,
-  2.08787e-08,
-  2.11535e-08,
-  2.13818e-08,
-  2.15639e-08,
-  2.17002e-08,
-  2.17911e-08,
-  2.18376e-08,
-  2.18404e-08,
-  2.18006e-08,
-  2.17195e-08,
-  2.15984e-08,
-  2.14388e-08,
-  2.12422e-08,
-  2.10104e-08,
-  2.07449e-08,
-  2.04477e-08,
-  2.01206e-08,
-  1.97656e-08,
-  1.93846e-08,
-  1.89796e-08,
-  1.85525e-08,
-  1.81055e-08,
-  1.76404e-08,
-  1.71594e-08,
-  1.66643e-08,
-  1.61572e-08,
-  1.564e-08,
-  1.51144e-08,
-  1.45825e-08,
-  1.40459e-08,
-  1.35064e-08,
-  1.29656e-08,
-  1.24251e-08,
-  1.18866e-08,
-  1.13513e-08,
-  1.08208e-08,
-  1.02962e-08,
-  9.77892e-09,
-  9.26998e-09,
-  8.77047e-09,
-  8.28137e-09,
-  7.80358e-09,
-  7.33791e-09,
-  6.88508e-09,
-  6.44576e-09,
-  6.02051e-09,
-  5.60983e-09,
-  5.21414e-09,
-  4.83377e-09,
-  4.469e-09,
-  4.12003e-09,
-  3.78699e-09,
-  3.46996e-09,
-  3.16895e-09,
-  2.8839e-09,
-  2.61471e-09,
-  2.36123e-09,
-  2.12325e-09,
-  1.90053e-09,
-  1.69277e-09,
-  1.49965e-09,
-  1.3208e-09,
-  1.15582e-09,
-  1.00429e-09,
-  8.65767e-10,
-  7.39773e-10,
-  6.25821e-10,
-  5.23405e-10,
-  4.32007e-10,
-  3.511e-10,
-  2.80149e-10,
-  2.18613e-10,
-  1.65952e-10,
-  1.21625e-10,
-  8.50922e-11,
-  5.5821e-11,
-  3.32841e-11,
-  1.6963e-11,
-  6.34935e-12,
-  9.46782e-13,
-  2.71967e-13,
-  3.85609e-12,
-  1.12459e-11,
-  2.20048e-11,
-  3.57136e-11,
-  5.19713e-11,
-  7.03957e-11,
-  9.0624e-11,
-  1.12313e-10,
-  1.35139e-10,
-  1.58799e-10,
-  1.8301e-10,
-  2.07509e-10,
-  2.32052e-10,
-  2.56417e-10,
-  2.80399e-10,
-  3.03813e-10,
-  3.26492e-10,
-  3.4829e-10,
-  3.69074e-10,
-  3.88731e-10,
-  4.07163e-10,
-  4.24288e-10,
-  4.4004e-10,
-  4.54365e-10,
-  4.67223e-10,
-  4.78588e-10,
-  4.88444e-10,
-  4.96787e-10,
-  5.03623e-10,
-  5.08968e-10,
-  5.12845e-10,
-  5.15287e-10,
-  5.16331e-10,
-  5.16024e-10,
-  5.14415e-10,
-  5.11561e-10,
-  5.07522e-10,
-  5.02361e-10,
-  4.96143e-10,
-  4.88938e-10,
-  4.80815e-10,
-  4.71846e-10,
-  4.62103e-10,
-  4.51659e-10,
-  4.40584e-10,
-  4.2895e-10,
-  4.16827e-10,
-  4.04284e-10,
-  3.91389e-10,
-  3.78205e-10,
-  3.64796e-10,
-  3.51222e-10,
-  3.3754e-10,
-  3.23807e-10,
-  3.10072e-10,
-  2.96386e-10,
-  2.82794e-10,
-  2.69339e-10,
-  2.5606e-10,
-  2.42994e-10,
-  2.30173e-10,
-  2.17627e-10,
-  2.05383e-10,
-  1.93464e-10,
-  1.81892e-10,
-  1.70684e-10,
-  1.59855e-10,
-  1.49418e-10,
-  1.39381e-10,
-  1.29753e-10,
-  1.20538e-10,
-  1.11739e-10,
-  1.03357e-10,
-  9.53904e-11,
-  8.78362e-11,
-  8.069e-11,
-  7.39455e-11,
-  6.75954e-11,
-  6.16309e-11,
-  5.60424e-11,
-  5.08191e-11,
-  4.59496e-11,
-  4.14215e-11,
-  3.72222e-11,
-  3.33383e-11,
-  2.97563e-11,
-  2.64622e-11,
-  2.3442e-11,
-  2.06815e-11,
-  1.81667e-11,
-  1.58835e-11,
-  1.3818e-11,
-  1.19565e-11,
-  1.02855e-11,
-  8.79205e-12,
-  7.46329e-12,
-  6.28691e-12,
-  5.251e-12,
-  4.34412e-12,
-  3.55531e-12,
-  2.87411e-12,
-  2.29058e-12,
-  1.79531e-12,
-  1.37941e-12,
-  1.03454e-12,
-  7.52856e-13,
-  5.27071e-13,
-  3.50401e-13,
-  2.16567e-13,
-  1.19782e-13,
-  5.47381e-14,
-  1.65876e-14,
-  9.24666e-16,
-  3.76703e-15,
-  2.15353e-14,
-  5.10319e-14,
-  8.94199e-14,
-  1.34201e-13,
-  1.83192e-13,
-  2.34507e-13,
-  2.8653e-13,
-  3.37899e-13,
-  3.8748e-13,
-  4.34349e-13,
-  4.77775e-13,
-  5.17193e-13,
-  5.52196e-13,
-  5.82509e-13,
-  6.07977e-13,
-  6.28548e-13,
-  6.44259e-13,
-  6.55223e-13,
-  6.61616e-13,
-  6.63664e-13,
-  6.61634e-13,
-  6.55826e-13,
-  6.46562e-13,
-  6.34176e-13,
-  6.19013e-13,
-  6.01419e-13,
-  5.81737e-13,
-  5.60303e-13,
-  5.37438e-13,
-  5.13453e-13,
-  4.88639e-13,
-  4.63269e-13,
-  4.37595e-13,
-  4.11847e-13,
-  3.86236e-13,
-  3.60947e-13,
-  3.36146e-13,
-  3.11974e-13,
-  2.88555e-13,
-  2.6599e-13,
-  2.44363e-13,
-  2.23738e-13,
-  2.04163e-13,
-  1.85672e-13,
-  1.68283e-13,
-  1.52004e-13,
-  1.36828e-13,
-  1.22741e-13,
-  1.09719e-13,
-  9.7732e-14,
-  8.67427e-14,
-  7.67093e-14,
-  6.75861e-14,
-  5.93243e-14,
-  5.18732e-14,
-  4.51812e-14,
-  3.91957e-14,
-  3.38647e-14,
-  2.91368e-14,
-  2.49619e-14,
-  2.12915e-14,
-  1.8079e-14,
-  1.528e-14,
-  1.28527e-14,
-  1.07578e-14,
-  8.95862e-15,
-  7.42112e-15,
-  6.11404e-15,
-  5.00877e-15,
-  4.07929e-15,
-  3.30208e-15,
-  2.65602e-15,
-  2.12226e-15,
-  1.68408e-15,
-  1.32674e-15,
-  1.03734e-15,
-  8.04652e-16,
-  6.18969e-16,
-  4.71969e-16,
-  3.5656e-16,
-  2.66746e-16,
-  1.97497e-16,
-  1.44625e-16,
-  1.04675e-16,
-  7.4821e-17,
-  5.27728e-17,
-  3.66933e-17,
-  2.5124e-17,
-  1.69196e-17,
-  1.1192e-17,
-  7.26045e-18,
-  4.61105e-18,
-  2.86115e-18,
-  1.73051e-18,
-  1.01748e-18,
-  5.79726e-19,
-  3.18885e-19,
-  1.68584e-19,
-  8.51974e-20,
-  4.08877e-20,
-  1.84824e-20,
-  7.78812e-21,
-  3.01885e-21,
-  1.05773e-21,
-  3.27143e-22,
-  8.63936e-23,
-  1.85547e-23,
-  3.00511e-24,
-  3.23412e-25,
-  1.8245e-26,
-  3.16799e-28,
-  3.0961e-31,
-  0
-};
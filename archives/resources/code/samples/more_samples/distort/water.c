@@ -0,0 +1,152 @@
+/*
+	water.c
+
+	Like the ripple effect, but the water is a height field
+	stepped with the wave equation (see wave.c) instead of a sum
+	of precomputed ripple patterns.  Any number of drops can be
+	in the water at once, they bounce off the edges of the
+	window and run into each other, and the cost of a frame
+	depends only on the size of the grid.  Holding the mouse
+	button down and dragging leaves a wake.
+
+	The texture coordinates of each vertex are shifted by the
+	slope of the water there, as light would be bent by it.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <GL/glut.h>
+
+#include "defs.h"
+#include "ripple.h"
+#include "wave.h"
+#include "water.h"
+
+extern int win_size_x, win_size_y;
+
+EFFECT water = { water_init, water_dynamics, water_redraw, water_click };
+
+static WAVE *wave = NULL;
+static RIPPLE_VERTEX *water_vertex = NULL;	/* WATER_SIZE^2, row by row */
+
+static int down = 0;		/* mouse button held */
+static int lastx, lasty;	/* where the mouse was */
+
+/*
+	Make the height field and the mesh the first time through,
+	and calm the water.
+*/
+
+void water_init()
+{
+  int i, j;
+  RIPPLE_VERTEX *v;
+
+  glDisable(GL_DEPTH_TEST);
+
+  if (wave == NULL)
+  {
+    wave = wave_new(WATER_SIZE);
+    water_vertex = (RIPPLE_VERTEX *)
+      malloc(WATER_SIZE*WATER_SIZE*sizeof(RIPPLE_VERTEX));
+    if (wave == NULL || water_vertex == NULL)
+    {
+      fprintf(stderr, "water: Can't allocate memory.\n");
+      exit(-1);
+    }
+  }
+
+  for (j = 0; j < WATER_SIZE*WATER_SIZE; j++)
+    wave->h[j] = wave->old[j] = 0.0;
+
+  for (j = 0; j < WATER_SIZE; j++)
+    for (i = 0; i < WATER_SIZE; i++)
+    {
+      v = &water_vertex[j*WATER_SIZE + i];
+      v->x[0] = i/(WATER_SIZE - 1.0)*win_size_x;
+      v->x[1] = j/(WATER_SIZE - 1.0)*win_size_y;
+      v->dt[0] = v->t[0] = i/(WATER_SIZE - 1.0);
+      v->dt[1] = v->t[1] = j/(WATER_SIZE - 1.0);
+    }
+}
+
+/*
+	Step the water and shift the texture coordinates by its
+	slope.  The edges of the field don't move, so the edges of
+	the mesh keep their default coordinates.
+*/
+
+void water_dynamics(int mousex, int mousey)
+{
+  int i, j, k;
+  float *h;
+  RIPPLE_VERTEX *v;
+
+  if (down && (mousex != lastx || mousey != lasty))
+    wave_drop(wave, 1.0*mousex/win_size_x*(WATER_SIZE - 1),
+	      1.0*mousey/win_size_y*(WATER_SIZE - 1),
+	      WATER_RADIUS, 0.2*WATER_HEIGHT);
+  lastx = mousex;
+  lasty = mousey;
+
+  for (k = 0; k < WATER_STEPS; k++)
+    wave_step(wave);
+
+  h = wave->h;
+  for (j = 1; j < WATER_SIZE - 1; j++)
+  {
+    v = &water_vertex[j*WATER_SIZE + 1];
+    k = j*WATER_SIZE + 1;
+    for (i = 1; i < WATER_SIZE - 1; i++, v++, k++)
+    {
+      v->t[0] = v->dt[0] + (h[k + 1] - h[k - 1])*(0.5*WATER_REFRACT);
+      v->t[1] = v->dt[1] + (h[k + WATER_SIZE] - h[k - WATER_SIZE])
+	*(0.5*WATER_REFRACT);
+    }
+  }
+}
+
+/*
+	Draw the next frame of animation, a strip of quads for each
+	row of the mesh.
+*/
+
+void water_redraw()
+{
+  int i, j;
+  RIPPLE_VERTEX *a, *b;
+
+  glClear(GL_COLOR_BUFFER_BIT);
+
+  for (j = 0; j < WATER_SIZE - 1; j++)
+  {
+    a = &water_vertex[j*WATER_SIZE];
+    b = a + WATER_SIZE;
+    glBegin(GL_QUAD_STRIP);
+    for (i = 0; i < WATER_SIZE; i++)
+    {
+      glTexCoord2fv(a[i].t);
+      glVertex2fv(a[i].x);
+      glTexCoord2fv(b[i].t);
+      glVertex2fv(b[i].x);
+    }
+    glEnd();
+  }
+
+  glutSwapBuffers();
+}
+
+/*
+	Drop something in the water when the mouse is pressed.
+*/
+
+void water_click(int mousex, int mousey, int state)
+{
+  down = state;
+  lastx = mousex;
+  lasty = mousey;
+  if (state)
+    wave_drop(wave, 1.0*mousex/win_size_x*(WATER_SIZE - 1),
+	      1.0*mousey/win_size_y*(WATER_SIZE - 1),
+	      WATER_RADIUS, WATER_HEIGHT);
+}
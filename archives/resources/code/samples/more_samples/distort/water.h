@@ -0,0 +1,19 @@
+/*
+	water.h
+*/
+
+#ifndef _WATER
+#define _WATER
+
+#define WATER_SIZE     128	/* height field points along each side */
+#define WATER_STEPS    2	/* wave steps per frame */
+#define WATER_REFRACT  0.08	/* texture shift per unit of slope */
+#define WATER_RADIUS   3.0	/* drop radius, in grid points */
+#define WATER_HEIGHT   2.0	/* drop height */
+
+void water_init();
+void water_dynamics(int mousex, int mousey);
+void water_redraw();
+void water_click(int mousex, int mousey, int state);
+
+#endif
@@ -0,0 +1,217 @@
+/*
+	wave.c
+
+	A damped wave equation on a square grid of heights, stepped
+	with the usual explicit scheme:
+
+	  new = (1 - damping)*(2*cur - old
+	      + speed*(north + south + east + west - 4*cur))
+
+	The edges are held at zero, so waves bounce off the sides of
+	the window.  Each step only needs the heights now and one step
+	ago, and the new heights overwrite the old ones in place.  Four
+	grid points are done at a time with SSE when the compiler has
+	it, and large grids are split into bands of rows, one per
+	thread, on the worker pool in sig99/adv99/util.
+
+	Any number of drops can be added at any time; they just add
+	to the heights.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "wave.h"
+#include "pool.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define WAVE_SSE
+#include <xmmintrin.h>
+#endif
+
+#ifndef M_PI
+#define M_PI 3.14159265
+#endif
+
+#define WAVE_THREAD_MIN  65536	/* fewest grid points worth a thread */
+
+/* Calm water decays towards denormals, which are very slow.  Heights
+   smaller than this are set to zero instead, the same way with or
+   without SSE, so neither needs the flush-to-zero mode. */
+#define WAVE_TINY  1e-20f
+
+/*
+	Allocate a flat grid.
+*/
+
+WAVE *wave_new(int size)
+{
+  WAVE *w;
+
+  if (size < 3)
+    return NULL;
+  w = (WAVE *) calloc(1, sizeof(WAVE));
+  if (w == NULL)
+    return NULL;
+  w->size = size;
+  w->h = (float *) calloc((size_t) size*size, sizeof(float));
+  w->old = (float *) calloc((size_t) size*size, sizeof(float));
+  if (w->h == NULL || w->old == NULL)
+  {
+    free(w->h);
+    free(w->old);
+    free(w);
+    return NULL;
+  }
+  w->threads = pool_cpus();
+  return w;
+}
+
+/*
+	Step rows [begin, end) of the interior, writing the new
+	heights over the old ones.
+*/
+
+static void wave_rows(WAVE *w, int begin, int end)
+{
+  int n = w->size;
+  int x, y;
+  float *c, *o, v;
+  float keep = 1.0 - WAVE_DAMPING;
+  float speed = WAVE_SPEED;
+#ifdef WAVE_SSE
+  __m128 k = _mm_set1_ps(keep), s = _mm_set1_ps(speed);
+  __m128 four = _mm_set1_ps(4.0f), two = _mm_set1_ps(2.0f);
+  __m128 tiny = _mm_set1_ps(WAVE_TINY), sign = _mm_set1_ps(-0.0f);
+  __m128 h, sum;
+#endif
+
+  for (y = begin; y < end; y++)
+  {
+    c = w->h + (size_t) y*n;
+    o = w->old + (size_t) y*n;
+    x = 1;
+#ifdef WAVE_SSE
+    for (; x + 4 <= n - 1; x += 4)
+    {
+      h = _mm_loadu_ps(c + x);
+      sum = _mm_add_ps(_mm_add_ps(_mm_loadu_ps(c + x - 1),
+				  _mm_loadu_ps(c + x + 1)),
+		       _mm_add_ps(_mm_loadu_ps(c + x - n),
+				  _mm_loadu_ps(c + x + n)));
+      sum = _mm_sub_ps(sum, _mm_mul_ps(four, h));
+      sum = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(two, h), _mm_loadu_ps(o + x)),
+		       _mm_mul_ps(s, sum));
+      sum = _mm_mul_ps(k, sum);
+      sum = _mm_and_ps(sum, _mm_cmpge_ps(_mm_andnot_ps(sign, sum), tiny));
+      _mm_storeu_ps(o + x, sum);
+    }
+#endif
+    /* summed in the same order as the SSE loop, so both agree */
+    for (; x < n - 1; x++)
+    {
+      v = keep*(2.0f*c[x] - o[x]
+		+ speed*((c[x - 1] + c[x + 1]) + (c[x - n] + c[x + n])
+			 - 4.0f*c[x]));
+      o[x] = (v < WAVE_TINY && v > -WAVE_TINY) ? 0.0f : v;
+    }
+  }
+}
+
+/*
+	Step rows [begin, end) of the rows below the top edge, as a
+	pool job.
+*/
+
+static void wave_band(void *arg, int begin, int end)
+{
+  wave_rows((WAVE *) arg, 1 + begin, 1 + end);
+}
+
+/*
+	Advance the water one time step.
+*/
+
+void wave_step(WAVE *w)
+{
+  float *t;
+  int rows = w->size - 2;
+  int bands;
+
+  bands = w->size*w->size/WAVE_THREAD_MIN;
+  if (bands > w->threads)
+    bands = w->threads;
+  if (bands > 1 && w->pool == NULL)
+    w->pool = pool_new(w->threads);
+  if (bands > pool_threads((pool_t *) w->pool))
+    bands = pool_threads((pool_t *) w->pool);
+  if (bands < 1)
+    bands = 1;
+  pool_run((pool_t *) w->pool, wave_band, w, bands,
+	   (rows + bands - 1)/bands, rows);
+
+  /* the new heights are now in old */
+  t = w->h;
+  w->h = w->old;
+  w->old = t;
+}
+
+/*
+	Push the water at (x, y), in grid points, with a smooth bump
+	of the given radius.  The bump is added at both time steps so
+	that the water starts out still and then spreads.
+*/
+
+void wave_drop(WAVE *w, float x, float y, float radius, float height)
+{
+  int i, j, i0, i1, j0, j1;
+  float dx, dy, d, a;
+
+  i0 = (int) floor(x - radius);
+  i1 = (int) ceil(x + radius);
+  j0 = (int) floor(y - radius);
+  j1 = (int) ceil(y + radius);
+  if (i0 < 1)
+    i0 = 1;
+  if (j0 < 1)
+    j0 = 1;
+  if (i1 > w->size - 2)
+    i1 = w->size - 2;
+  if (j1 > w->size - 2)
+    j1 = w->size - 2;
+
+  for (j = j0; j <= j1; j++)
+    for (i = i0; i <= i1; i++)
+    {
+      dx = i - x;
+      dy = j - y;
+      d = sqrt(dx*dx + dy*dy);
+      if (d < radius)
+      {
+	a = height*0.5*(1.0 + cos(M_PI*d/radius));
+	w->h[j*w->size + i] += a;
+	w->old[j*w->size + i] += a;
+      }
+    }
+}
+
+/*
+	Set the most threads wave_step may use (the number of
+	processors unless set).
+*/
+
+void wave_threads(WAVE *w, int threads)
+{
+  w->threads = threads < 1 ? 1 : threads;
+  pool_delete((pool_t *) w->pool);
+  w->pool = NULL;
+}
+
+void wave_free(WAVE *w)
+{
+  pool_delete((pool_t *) w->pool);
+  free(w->h);
+  free(w->old);
+  free(w);
+}
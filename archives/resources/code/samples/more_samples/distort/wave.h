@@ -0,0 +1,27 @@
+/*
+	wave.h
+
+	Height field water for the ripple effect.
+*/
+
+#ifndef _WAVE
+#define _WAVE
+
+#define WAVE_SPEED    0.5	/* (cells per step)^2, at most 0.5 */
+#define WAVE_DAMPING  0.006	/* fraction of the height lost per step */
+
+typedef struct {
+  int size;		/* grid points along each side */
+  float *h;		/* heights now, size*size, row by row */
+  float *old;		/* heights one step ago */
+  int threads;		/* most threads to step with */
+  void *pool;		/* worker threads, made when first needed */
+} WAVE;
+
+WAVE *wave_new(int size);
+void wave_free(WAVE *w);
+void wave_step(WAVE *w);
+void wave_drop(WAVE *w, float x, float y, float radius, float height);
+void wave_threads(WAVE *w, int threads);
+
+#endif
@@ -0,0 +1,97 @@
+/*
+	wavebench.c
+
+	Time the height field of the water effect.  For grids from
+	64x64 up to the given size, drops are scattered over the
+	water and it is stepped on one thread and on as many as
+	there are processors, each for at least the given number of
+	steps and a quarter of a second.  The milliseconds per step
+	and per frame of the water effect (WATER_STEPS steps) are
+	printed.
+
+	usage: wavebench [max grid [steps]]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "wave.h"
+#include "water.h"
+
+#ifdef _WIN32
+#include <windows.h>
+typedef int timer;
+#define getTime(a)	(a = GetTickCount())
+#define timeDiff(a, b)	((b - a) * 1000)
+#else
+#include <sys/time.h>
+#include <unistd.h>
+typedef struct timeval timer;
+#define getTime(a)	gettimeofday(&a, NULL)
+#define timeDiff(a, b)	(((b.tv_sec - a.tv_sec) * 1000000) + b.tv_usec - a.tv_usec)
+#endif
+
+static int steps = 20;
+
+/*
+	Milliseconds per step of w.
+*/
+
+double run(WAVE *w)
+{
+  timer t0, t1;
+  long usec;
+  int n = 0;
+
+  wave_step(w);		/* one untimed step */
+  getTime(t0);
+  do
+  {
+    wave_step(w);
+    getTime(t1);
+    usec = timeDiff(t0, t1);
+  } while (++n < steps || usec < 250000);
+
+  return usec/1000.0/n;
+}
+
+int main(int argc, char **argv)
+{
+  int max = 2048, size, i, threads = 1;
+  double one, all;
+  WAVE *w;
+
+  if (argc > 1)
+    max = atoi(argv[1]);
+  if (argc > 2)
+    steps = atoi(argv[2]);
+#ifndef _WIN32
+  threads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+  if (threads < 1)
+    threads = 1;
+#endif
+
+  printf("ms per step, %d processors\n", threads);
+  printf("%10s %10s %10s %10s\n", "grid", "1 thread", "threaded", "frame");
+  for (size = 64; size <= max; size *= 2)
+  {
+    w = wave_new(size);
+    if (w == NULL)
+    {
+      fprintf(stderr, "wavebench: Can't allocate a %dx%d grid.\n", size, size);
+      exit(-1);
+    }
+    srand(1);
+    for (i = 0; i < 16; i++)
+      wave_drop(w, rand() % size, rand() % size, size/32.0 + 1.0, WATER_HEIGHT);
+
+    wave_threads(w, 1);
+    one = run(w);
+    wave_threads(w, threads);
+    all = run(w);
+    printf("%10d %10.3f %10.3f %10.3f\n", size, one, all, all*WATER_STEPS);
+    wave_free(w);
+  }
+
+  return 0;
+}
@@ -106,7 +106,7 @@ void readboards()
     }
   fscanf(fp, "%d", &numboards);
   boards = (int***)malloc(numboards*sizeof(int**));
-  for (i=0; i<BOARDSIZE; i++)
+  for (i=0; i<numboards; i++)
     {
       boards[i] = (int**)malloc(BOARDSIZE*sizeof(int*));
       for (j=0; j<BOARDSIZE; j++)
@@ -133,6 +133,7 @@ void readboards()
       curboard = 0;
       pegs = totalpegs;
       curstate = PLAY;
+      analyse();
     }
 }
 
@@ -211,7 +212,10 @@ void drawpegs()
 		glDepthMask(GL_FALSE);
 		glEnable(GL_BLEND);
 		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-		glColor4f(1.0, 1.0, 0.0, 0.0);  /* Invisible */
+		if (hintto == name)
+		  glColor4f(0.0, 1.0, 1.0, 0.5);  /* Faint cyan */
+		else
+		  glColor4f(1.0, 1.0, 0.0, 0.0);  /* Invisible */
 		drawpeg();
 		glDisable(GL_BLEND);
 		glDepthMask(GL_TRUE);
@@ -224,6 +228,8 @@ void drawpegs()
 		glColor3f(1.0, 1.0, 0.0);  /* Yellow */
 		if (picked == name)
 		  glColor3f(1.0, 0.5, 0.0); /* Orange */
+		else if (hintpeg == name)
+		  glColor3f(0.0, 1.0, 1.0); /* Cyan */
 		drawpeg();
 		break;
 	      case CANMOVE:
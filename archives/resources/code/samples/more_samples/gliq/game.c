@@ -6,17 +6,52 @@
  *  File : game.c
  *  Description : All the routines to actually play the game.
  *  
+ *  The moves are checked on bitboards (see solve.c), and after each
+ *  one the board is handed to the solver to find out how well it can
+ *  still end.
+ *
  */
 
 #include "gliq.h"
 
 int playdone=0;
+int hintpeg=0;          /* peg to show as the next move, 0 for none */
+int hintto=0;           /* and the hole it jumps into */
+
+static iqlayout layout;
+static iqresult analysis;
+static int      thinking = 0;      /* analysis is for an older board */
+static int      analyses = 0;      /* started, to tell old timers apart */
 
 void playgame();
 void drawquit(float x, float y, float r1, float r2);
 int legalmove();
 int canmove(int peg);
 int movesexist();
+void analyse();
+void showhint();
+void think(int value);
+
+/* The pegs in filled as a bitboard, making the layout first if the
+   holes have changed. */
+static void getboard(bitboard *b)
+{
+  bitboard holes;
+  int i, j;
+
+  holes.w[0] = holes.w[1] = 0;
+  b->w[0] = b->w[1] = 0;
+  for (i=0; i<BOARDSIZE; i++)
+    for (j=0; j<BOARDSIZE; j++)
+      {
+	if (filled[i][j] != UNUSED)
+	  iqset(&holes, i*BOARDSIZE+j);
+	if (filled[i][j] != UNUSED && filled[i][j] != EMPTY)
+	  iqset(b, i*BOARDSIZE+j);
+      }
+  if (holes.w[0] != layout.holes.w[0] || holes.w[1] != layout.holes.w[1])
+    iqmakelayout(&layout, &holes);
+}
 
 void playgame()
 {
@@ -46,6 +81,23 @@ void playgame()
 	 0.75*glutGet(GLUT_WINDOW_HEIGHT),
 	 0.08*glutGet(GLUT_WINDOW_HEIGHT),
 	 "No moves left.");
+  else if (thinking)
+    text(0.05*width, 0.05*height, 0.05*height, "Thinking...");
+  else if (analysis.exact && analysis.best == 1 && analysis.good >= 0)
+    text(0.05*width, 0.05*height, 0.05*height,
+	 "Can still win: %d of %d moves", analysis.good, analysis.jumps);
+  else if (analysis.exact && analysis.best == 1)
+    text(0.05*width, 0.05*height, 0.05*height, "Can still win");
+  else if (analysis.exact && analysis.good >= 0)
+    text(0.05*width, 0.05*height, 0.05*height,
+	 "Best left: %d (%d of %d moves)", analysis.best, analysis.good,
+	 analysis.jumps);
+  else if (analysis.exact)
+    text(0.05*width, 0.05*height, 0.05*height,
+	 "Best left: %d", analysis.best);
+  else
+    text(0.05*width, 0.05*height, 0.05*height,
+	 "Can leave %d, maybe fewer", analysis.best);
 
   /* do the trackball rotation. */
   glPushMatrix();
@@ -59,27 +111,17 @@ void playgame()
 
 int canmove(int peg)
 {
-  int i, j;
+  bitboard b;
+  int jump;
 
   if (peg == 0)
     return 0;
   
-  i = (peg-1)/BOARDSIZE;
-  j = (peg-1)%BOARDSIZE;
-  
-  if ((i-2>0) && (filled[i-1][j]==FULL) && (filled[i-2][j]==EMPTY))
-    return 1;
-  else if ((i+2<BOARDSIZE) &&
-	   (filled[i+1][j]==FULL) && (filled[i+2][j]==EMPTY))
-    return 1;
-  else if ((j-2>0) && (filled[i][j-1]==FULL) && (filled[i][j-2]==EMPTY))
-    return 1;
-  else if ((j+2<BOARDSIZE) &&
-	   (filled[i][j+1]==FULL) && (filled[i][j+2]==EMPTY))
-    return 1;
-  else
-    return 0;
-  
+  getboard(&b);
+  for (jump=0; jump<layout.jumps; jump++)
+    if (layout.from[jump] == peg-1 && iqcanjump(&layout, &b, jump))
+      return 1;
+  return 0;
 }
 
 /** returns 0 if not a legal move;
@@ -89,47 +131,81 @@ int canmove(int peg)
 
 int legalmove()
 {
-  int lasti, lastj;
-  int i, j;
+  bitboard b;
+  int jump;
 
-  if (lastpicked == 0)
+  if (lastpicked == 0 ||
+      filled[(lastpicked-1)/BOARDSIZE][(lastpicked-1)%BOARDSIZE] != CANMOVE)
     return 0;
-  
-  lasti = (lastpicked-1)/BOARDSIZE;
-  lastj = (lastpicked-1)%BOARDSIZE;
-  i = (picked-1)/BOARDSIZE;
-  j = (picked-1)%BOARDSIZE;
 #if 0
-  //  printf("Jumping from (%d,%d) to (%d,%d)\n", lasti, lastj, i, j);
+  //  printf("Jumping from %d to %d\n", lastpicked, picked);
 #endif
   
-  if (filled[lasti][lastj] == CANMOVE && filled[i][j] == EMPTY)
-    if (lasti==i+2)
-      return (i+1)*BOARDSIZE+(j)+1;  /* i+1, +1 to get the name right */
-    else if (lasti==i-2)
-      return (i-1)*BOARDSIZE+(j)+1;  /* i-1, +1 */
-    else if (lastj==j+2)
-      return (i)*BOARDSIZE+(j+1)+1;  /* j+1, +1 */
-    else if (lastj==j-2)
-      return (i)*BOARDSIZE+(j-1)+1;  /* j-1, +1 */
-    else
-      return 0;
+  getboard(&b);
+  for (jump=0; jump<layout.jumps; jump++)
+    if (layout.from[jump] == lastpicked-1 && layout.to[jump] == picked-1 &&
+	iqcanjump(&layout, &b, jump))
+      return layout.over[jump]+1;  /* +1 to get the name right */
   return 0;
 }
 
 /* Checks for any legal moves remaining */
 int movesexist()
 {
-  int i, j, peg;
+  bitboard b;
+  int jump;
   
-  for (peg=1; peg<=BOARDSIZE*BOARDSIZE; peg++)
+  getboard(&b);
+  for (jump=0; jump<layout.jumps; jump++)
+    if (iqcanjump(&layout, &b, jump))
+      return 1;
+  return 0;
+}
+
+/* Start working out how well the board in filled can still end, on
+   the solver's thread; think() picks up the answer. */
+void analyse()
+{
+  static bitboard last;
+  bitboard b;
+
+  /* if the move made was the first of the best way found, the rest of
+     it is still a way to do that well */
+  getboard(&b);
+  if (analysis.length > 0 && iqcanjump(&layout, &last, analysis.line[0]))
+    iqjump(&layout, &last, analysis.line[0]);
+  if (!thinking && analysis.length > 0 &&
+      b.w[0] == last.w[0] && b.w[1] == last.w[1])
+    iqstart(&layout, &b, analysis.line+1, analysis.length-1, IQLIMIT);
+  else
+    iqstart(&layout, &b, NULL, 0, IQLIMIT);
+  last = b;
+  hintpeg = hintto = 0;
+  thinking = 1;
+  glutTimerFunc(50, think, ++analyses);
+}
+
+/* Show the peg to move next, if the analysis has found one */
+void showhint()
+{
+  if (!thinking && analysis.hint >= 0)
     {
-      i = (peg-1)/BOARDSIZE;
-      j = (peg-1)%BOARDSIZE;
-      if (filled[i][j] == FULL && canmove(peg))
-	return 1;
+      hintpeg = layout.from[analysis.hint]+1;
+      hintto = layout.to[analysis.hint]+1;
     }
-  return 0;
+}
+
+void think(int value)
+{
+  if (value != analyses || !thinking)
+    return;
+  if (iqpoll(&analysis))
+    {
+      thinking = 0;
+      glutPostRedisplay();
+    }
+  else
+    glutTimerFunc(50, think, value);
 }
 
 void drawquit(float x, float y, float r1, float r2)
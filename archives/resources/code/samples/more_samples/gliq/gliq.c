@@ -172,6 +172,7 @@ void keyboard(char key, int x, int y)
     printf("f            -  Filled\n");
     printf("w            -  Wireframe\n");
     printf("s            -  See high scores\n");
+    printf("n            -  Show the next move to make\n");
     printf("escape or q  -  Quit\n\n");
     break;
 
@@ -183,6 +184,11 @@ void keyboard(char key, int x, int y)
     glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
     break;
 
+  case 'n':
+    if (curstate == PLAY)
+      showhint();
+    break;
+
   case 's':
     curstate = VIEWSCORES;
     glutIdleFunc(idlescore);
@@ -241,6 +247,7 @@ void mouse(int button, int state, int x, int y)
 	    playdone = 0;
 	    pegs = totalpegs;
 	    glutIdleFunc(NULL);
+	    analyse();
 	    break;
 	  case RIGHTARR:
 	    curboard++;
@@ -352,6 +359,7 @@ void mouse(int button, int state, int x, int y)
 	    filled[(mid-1)/BOARDSIZE][(mid-1)%BOARDSIZE] = EMPTY;
 	    filled[(picked-1)/BOARDSIZE][(picked-1)%BOARDSIZE] = FULL;
 	    pegs--;
+	    analyse();
 	    /* Check for any legal moves left */
 	    if (!movesexist())
 	      {
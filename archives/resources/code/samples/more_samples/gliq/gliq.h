@@ -15,9 +15,9 @@
 #include <math.h>
 #include <GL/glut.h>
 #include "trackball.h"
+#include "solve.h"
 
 /* defines */
-#define BOARDSIZE 9   /* on a side, total of 81 holes */
 #define SELECT_BUFFER 256
 
 /* enums */
@@ -46,10 +46,14 @@ extern  void   displaybuttons();
 
 /* from game.c */
 extern  int playdone;
+extern  int hintpeg;
+extern  int hintto;
 extern  void playgame();
 extern  int legalmove();
 extern  int canmove(int peg);
 extern  int movesexist();
+extern  void analyse();
+extern  void showhint();
 extern  void drawquit(float x, float y, float r1, float r2);
 
 /* from score.c */
@@ -0,0 +1,89 @@
+/*
+ *  File : iqbench.c
+ *  Description : Solve every board in boards.txt without a window.  For
+ *                each board prints the pegs, the fewest pegs that can
+ *                be left (with a ? if the search gave up and there may
+ *                be a way to leave fewer), the opening jumps and how
+ *                many of them still leave that few (? if it gave up
+ *                before it knew), the positions
+ *                searched, and how long it took.
+ *
+ *  usage: iqbench [limit]    boards to keep, 1000000 (IQLIMIT) if not given
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "solve.h"
+
+#ifdef _WIN32
+#include <windows.h>
+typedef int timer;
+#define getTime(a)	(a = GetTickCount())
+#define timeDiff(a, b)	((b - a) * 1000)
+#else
+#include <sys/time.h>
+typedef struct timeval timer;
+#define getTime(a)	gettimeofday(&a, NULL)
+#define timeDiff(a, b)	(((b.tv_sec - a.tv_sec) * 1000000) + b.tv_usec - a.tv_usec)
+#endif
+
+/* same as in gliq.h */
+enum {UNUSED, EMPTY, FULL};
+
+int main(int argc, char** argv)
+{
+  int numboards, i, hole, value;
+  long limit = IQLIMIT;
+  bitboard holes, pegs;
+  static iqlayout layout;
+  iqresult r;
+  timer t0, t1;
+  FILE* fp;
+
+  if (argc > 1)
+    limit = atol(argv[1]);
+  fp = fopen("boards.txt", "r");
+  if (!fp)
+    {
+      printf("Could not open boards.txt, exiting.\n");
+      exit(1);
+    }
+  if (fscanf(fp, "%d", &numboards) != 1)
+    numboards = 0;
+
+  printf("%5s %5s %5s %6s %5s %10s %10s\n",
+	 "board", "pegs", "best", "jumps", "good", "positions", "ms");
+  for (i = 0; i < numboards; i++)
+    {
+      holes.w[0] = holes.w[1] = 0;
+      pegs = holes;
+      for (hole = 0; hole < HOLES; hole++)
+	{
+	  if (fscanf(fp, "%d", &value) != 1)
+	    value = UNUSED;
+	  if (value != UNUSED)
+	    iqset(&holes, hole);
+	  if (value == FULL)
+	    iqset(&pegs, hole);
+	}
+      iqmakelayout(&layout, &holes);
+
+      getTime(t0);
+      if (!iqsolve(&layout, &pegs, NULL, 0, limit, &r))
+	{
+	  printf("iqbench: out of memory\n");
+	  exit(1);
+	}
+      getTime(t1);
+      printf("%5d %5d %4d%c %6d ", i, r.pegs, r.best,
+	     r.exact ? ' ' : '?', r.jumps);
+      if (r.good >= 0)
+	printf("%5d", r.good);
+      else
+	printf("%5s", "?");
+      printf(" %10ld %10.1f\n", r.positions, timeDiff(t0, t1) / 1000.0);
+    }
+  fclose(fp);
+  return 0;
+}
@@ -0,0 +1,714 @@
+/*
+ *  File : solve.c
+ *  Description : Bitboard move generation and the solvability search,
+ *                see solve.h.
+ *
+ *  A board is 81 bits, one per hole, set where there is a peg.  Every
+ *  jump a layout allows is worked out once, as the two holes that need
+ *  pegs and the one that needs to be empty, so trying a jump is a pair
+ *  of masks and making it is an exclusive or.
+ *
+ *  No board can come down to fewer pegs than its position class
+ *  allows: one if a single peg in some hole has the same class, else
+ *  two.  A quick beam search goes first, a level of jumps at a time
+ *  keeping only the boards whose pegs are least spread out, and mostly
+ *  gets down to that, which settles it.  Otherwise the search is depth
+ *  first, for a way to leave no more than some number of pegs, asking
+ *  for one peg fewer than the last way found each time until there is
+ *  no way.  Different orders of the same jumps, and turns and flips of
+ *  the layout, reach the same board over and over, so every board that
+ *  fails is kept, as the least of its turns and flips, in an open
+ *  addressing hash table with the most pegs it failed to get down to;
+ *  that goes in the top bits of the second word, which the board
+ *  doesn't use.  The table has a fixed size, and a search that would
+ *  need more than its limit of boards gives up with the best it found
+ *  so far.  So that following the hints never does worse than that,
+ *  the jumps of the best way found come back too, and can be handed to
+ *  the next search to start from.
+ *
+ *  iqstart hands the search to a thread of its own so the game doesn't
+ *  stop while it runs; starting another tells the running one to stop.
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "solve.h"
+
+/* Win32 builds search on the calling thread */
+#if defined(_WIN32) && !defined(SOLVE_NO_THREADS)
+#define SOLVE_NO_THREADS
+#endif
+
+#ifndef SOLVE_NO_THREADS
+#include <pthread.h>
+#endif
+
+#define VALUESHIFT 57   /* the target that failed, in the top bits of w[1] */
+#define BOARDMASK (((bitword) 1 << VALUESHIFT) - 1)
+#define POLL 16384      /* boards between checks for a new request */
+#define BYTES ((HOLES+7)/8)  /* of a board, for the symmetry tables */
+#define BEAM 1024       /* boards the first, quick, search keeps a level */
+
+typedef struct {
+  iqlayout *l;
+  bitboard *table;
+  bitboard *image;      /* [sym-1][byte][value], what each byte turns into */
+  unsigned long mask;
+  int bits;
+  long used, limit;
+  long nodes;
+  int (*stop)(void);    /* asked to stop if this returns 1 */
+  int stopped;
+  int top;              /* pegs at the start */
+  unsigned char line[HOLES];  /* the jumps of the last way found */
+} Search;
+
+typedef struct {
+  bitboard b;
+  bitboard key;         /* b's least turn or flip */
+  long score;           /* how spread out, less is likelier to go far */
+  int from;             /* the board it came from, a level up */
+  int jump;
+} Step;
+
+void iqset(bitboard *b, int hole)
+{
+  b->w[hole >> 6] |= (bitword) 1 << (hole & 63);
+}
+
+int iqget(bitboard *b, int hole)
+{
+  return (int) (b->w[hole >> 6] >> (hole & 63)) & 1;
+}
+
+int iqcount(bitboard *b)
+{
+  bitword w;
+  int i, n = 0;
+
+  for (i = 0; i < 2; i++)
+    for (w = b->w[i]; w; w &= w - 1)
+      n++;
+  return n;
+}
+
+/* Find the turns and flips of the holes' bounding box that take the
+   holes onto themselves. */
+static void symmetries(iqlayout *l)
+{
+  int i0 = BOARDSIZE, i1 = -1, j0 = BOARDSIZE, j1 = -1;
+  int t, i, j, si, sj, hole;
+
+  for (hole = 0; hole < HOLES; hole++)
+    if (iqget(&l->holes, hole))
+      {
+	i = hole / BOARDSIZE;
+	j = hole % BOARDSIZE;
+	if (i < i0) i0 = i;
+	if (i > i1) i1 = i;
+	if (j < j0) j0 = j;
+	if (j > j1) j1 = j;
+      }
+  l->syms = 0;
+  if (i1 < 0)
+    return;
+  for (t = 0; t < 8; t++)
+    {
+      /* bit 2 swaps rows and columns, which needs a square box */
+      if ((t & 4) && i1 - i0 != j1 - j0)
+	continue;
+      for (hole = 0; hole < HOLES; hole++)
+	{
+	  i = hole / BOARDSIZE - i0;
+	  j = hole % BOARDSIZE - j0;
+	  if (t & 4)
+	    {
+	      si = i;
+	      i = j;
+	      j = si;
+	    }
+	  si = (t & 1) ? (t & 4 ? j1 - j0 : i1 - i0) - i : i;
+	  sj = (t & 2) ? (t & 4 ? i1 - i0 : j1 - j0) - j : j;
+	  si += i0;
+	  sj += j0;
+	  if (si < 0 || si >= BOARDSIZE || sj < 0 || sj >= BOARDSIZE)
+	    break;
+	  if (iqget(&l->holes, hole) != iqget(&l->holes, si*BOARDSIZE + sj))
+	    break;
+	  l->sym[l->syms][hole] = si*BOARDSIZE + sj;
+	}
+      if (hole == HOLES)
+	l->syms++;
+    }
+}
+
+void iqmakelayout(iqlayout *l, bitboard *holes)
+{
+  static int di[4] = {-1, 1, 0, 0}, dj[4] = {0, 0, -1, 1};
+  int i, j, d, from, over, to;
+
+  memset(l, 0, sizeof(iqlayout));
+  l->holes = *holes;
+  symmetries(l);
+  for (i = 0; i < BOARDSIZE; i++)
+    for (j = 0; j < BOARDSIZE; j++)
+      for (d = 0; d < 4; d++)
+	{
+	  if (i+2*di[d] < 0 || i+2*di[d] >= BOARDSIZE ||
+	      j+2*dj[d] < 0 || j+2*dj[d] >= BOARDSIZE)
+	    continue;
+	  from = i*BOARDSIZE + j;
+	  over = from + di[d]*BOARDSIZE + dj[d];
+	  to = over + di[d]*BOARDSIZE + dj[d];
+	  if (!iqget(holes, from) || !iqget(holes, over) || !iqget(holes, to))
+	    continue;
+	  l->from[l->jumps] = from;
+	  l->over[l->jumps] = over;
+	  l->to[l->jumps] = to;
+	  iqset(&l->need[l->jumps], from);
+	  iqset(&l->need[l->jumps], over);
+	  iqset(&l->land[l->jumps], to);
+	  l->jumps++;
+	}
+}
+
+int iqcanjump(iqlayout *l, bitboard *b, int jump)
+{
+  bitboard *n = &l->need[jump], *t = &l->land[jump];
+
+  return (b->w[0] & n->w[0]) == n->w[0] && (b->w[1] & n->w[1]) == n->w[1] &&
+    !(b->w[0] & t->w[0]) && !(b->w[1] & t->w[1]);
+}
+
+void iqjump(iqlayout *l, bitboard *b, int jump)
+{
+  b->w[0] ^= l->need[jump].w[0] | l->land[jump].w[0];
+  b->w[1] ^= l->need[jump].w[1] | l->land[jump].w[1];
+}
+
+static unsigned long hash(bitboard *b, int bits)
+{
+  /* Fibonacci hashing: the top bits of the board times 2^64 / phi */
+  bitword k = ((bitword) 0x9e3779b9 << 32) | 0x7f4a7c15;
+
+  return (unsigned long) (((b->w[0] ^ (b->w[1] * k)) * k) >> (64 - bits));
+}
+
+/* Where each byte of a board goes under each symmetry but the first,
+   so turning a board is a lookup a byte. */
+static int images(Search *s)
+{
+  iqlayout *l = s->l;
+  bitboard *m;
+  int t, k, v, bit, hole;
+
+  if (l->syms < 2)
+    return 1;
+  s->image = (bitboard*)calloc((l->syms-1) * BYTES * 256, sizeof(bitboard));
+  if (s->image == NULL)
+    return 0;
+  for (t = 1; t < l->syms; t++)
+    for (k = 0; k < BYTES; k++)
+      for (v = 0; v < 256; v++)
+	{
+	  m = &s->image[((t-1)*BYTES + k)*256 + v];
+	  for (bit = 0; bit < 8; bit++)
+	    {
+	      hole = 8*k + bit;
+	      if ((v >> bit & 1) && hole < HOLES)
+		iqset(m, l->sym[t][hole]);
+	    }
+	}
+  return 1;
+}
+
+/* The least of b's turns and flips, so a board and its mirror images
+   share one entry in the table. */
+static void canonical(Search *s, bitboard *b, bitboard *c)
+{
+  bitboard d, *m;
+  int t, k, v;
+
+  *c = *b;
+  for (t = 1; t < s->l->syms; t++)
+    {
+      d.w[0] = d.w[1] = 0;
+      m = &s->image[(t-1)*BYTES*256];
+      for (k = 0; k < BYTES; k++, m += 256)
+	{
+	  v = (int) (b->w[k >> 3] >> 8*(k & 7)) & 255;
+	  d.w[0] |= m[v].w[0];
+	  d.w[1] |= m[v].w[1];
+	}
+      if (d.w[1] < c->w[1] || (d.w[1] == c->w[1] && d.w[0] < c->w[0]))
+	*c = d;
+    }
+}
+
+/* Jumps leave the parity of the pegs on the diagonals of each slope,
+   counted by (i+j) and (i-j) mod 3, the same up to all three flipping,
+   so that class is b's for good.  A single peg has a class of its own;
+   if no hole has b's, b can't come down to fewer than two. */
+static int posclass(bitboard *b)
+{
+  int a[3] = {0, 0, 0}, d[3] = {0, 0, 0};
+  int hole, i, j;
+
+  for (hole = 0; hole < HOLES; hole++)
+    if (iqget(b, hole))
+      {
+	i = hole / BOARDSIZE;
+	j = hole % BOARDSIZE;
+	a[(i+j) % 3] ^= 1;
+	d[(i-j+BOARDSIZE) % 3] ^= 1;
+      }
+  return (a[1]^a[0]) << 3 | (a[2]^a[0]) << 2 | (d[1]^d[0]) << 1 | (d[2]^d[0]);
+}
+
+static int fewest(iqlayout *l, bitboard *b, int pegs)
+{
+  bitboard one;
+  int hole, c = posclass(b);
+
+  if (pegs < 2)
+    return pegs;
+  for (hole = 0; hole < HOLES; hole++)
+    if (iqget(&l->holes, hole))
+      {
+	one.w[0] = one.w[1] = 0;
+	iqset(&one, hole);
+	if (posclass(&one) == c)
+	  return 1;
+      }
+  return 2;
+}
+
+/* How spread out the pegs of b are: the pegs times their moment about
+   their middle, and a lot more for each peg with none next to it. */
+static long spread(bitboard *b)
+{
+  long n = 0, si = 0, sj = 0, sq = 0, alone = 0;
+  int hole, i, j;
+
+  for (hole = 0; hole < HOLES; hole++)
+    if (iqget(b, hole))
+      {
+	i = hole / BOARDSIZE;
+	j = hole % BOARDSIZE;
+	n++;
+	si += i;
+	sj += j;
+	sq += i*i + j*j;
+	if (!(i > 0 && iqget(b, hole-BOARDSIZE)) &&
+	    !(i < BOARDSIZE-1 && iqget(b, hole+BOARDSIZE)) &&
+	    !(j > 0 && iqget(b, hole-1)) &&
+	    !(j < BOARDSIZE-1 && iqget(b, hole+1)))
+	  alone++;
+      }
+  return n*sq - si*si - sj*sj + 8*n*alone;
+}
+
+static int bystep(const void *a, const void *b)
+{
+  const Step *p = (const Step*)a, *q = (const Step*)b;
+
+  if (p->score != q->score)
+    return p->score < q->score ? -1 : 1;
+  if (p->key.w[1] != q->key.w[1])
+    return p->key.w[1] < q->key.w[1] ? -1 : 1;
+  if (p->key.w[0] != q->key.w[0])
+    return p->key.w[0] < q->key.w[0] ? -1 : 1;
+  return 0;
+}
+
+/* Go down from b a level of jumps at a time, keeping only the BEAM
+   least spread out boards of each, until a level has low pegs or none
+   can jump.  Returns the pegs of the last level, with the jumps to one
+   of its boards in line, or 0 if out of memory or asked to stop. */
+static int beam(Search *s, bitboard *b, int pegs, int low,
+		unsigned char *line)
+{
+  iqlayout *l = s->l;
+  Step *level, *kids, *k;
+  int depth, count, kidcount, most, i, j, n;
+
+  most = l->jumps < 4*pegs ? l->jumps : 4*pegs;
+  level = (Step*)malloc((pegs+1) * BEAM * sizeof(Step));
+  kids = (Step*)malloc((most+1) * BEAM * sizeof(Step));
+  if (level == NULL || kids == NULL)
+    {
+      free(level);
+      free(kids);
+      return 0;
+    }
+  level[0].b = *b;
+  level[0].from = -1;
+  count = 1;
+  for (depth = 0; pegs - depth > low; depth++)
+    {
+      if (s->stop && s->stop())
+	{
+	  s->stopped = 1;
+	  break;
+	}
+      kidcount = 0;
+      for (i = 0; i < count; i++)
+	for (j = 0; j < l->jumps; j++)
+	  if (iqcanjump(l, &level[depth*BEAM + i].b, j))
+	    {
+	      k = &kids[kidcount++];
+	      k->b = level[depth*BEAM + i].b;
+	      iqjump(l, &k->b, j);
+	      canonical(s, &k->b, &k->key);
+	      k->score = spread(&k->b);
+	      k->from = i;
+	      k->jump = j;
+	    }
+      s->nodes += kidcount;
+      if (kidcount == 0)
+	break;
+      qsort(kids, kidcount, sizeof(Step), bystep);
+      for (i = count = 0; i < kidcount && count < BEAM; i++)
+	if (count == 0 || bystep(&kids[i], &level[(depth+1)*BEAM + count-1]))
+	  level[(depth+1)*BEAM + count++] = kids[i];
+    }
+  n = 0;
+  if (!s->stopped)
+    {
+      /* back up the first board of the last level */
+      for (i = 0, j = depth; j > 0; i = level[j*BEAM + i].from, j--)
+	line[j-1] = level[j*BEAM + i].jump;
+      n = pegs - depth;
+    }
+  free(level);
+  free(kids);
+  return n;
+}
+
+/* Whether b, which has pegs pegs, can be brought down to target pegs
+   or fewer; returns the pegs it got down to, or 0 if it can't. */
+static int reach(Search *s, bitboard *b, int pegs, int target)
+{
+  bitboard c, k, *e;
+  unsigned long h;
+  int j, n;
+
+  if (pegs <= target)
+    return pegs;
+  if (s->stopped)
+    return 0;
+  if (++s->nodes % POLL == 0 && s->stop && s->stop())
+    {
+      s->stopped = 1;
+      return 0;
+    }
+
+  canonical(s, b, &k);
+  for (h = hash(&k, s->bits); ; h = (h + 1) & s->mask)
+    {
+      e = &s->table[h];
+      if (e->w[0] == 0 && e->w[1] == 0)
+	break;
+      if (e->w[0] == k.w[0] && (e->w[1] & BOARDMASK) == k.w[1])
+	{
+	  if ((int) (e->w[1] >> VALUESHIFT) >= target)
+	    return 0;
+	  break;
+	}
+    }
+
+  for (j = 0; j < s->l->jumps && !s->stopped; j++)
+    if (iqcanjump(s->l, b, j))
+      {
+	c = *b;
+	iqjump(s->l, &c, j);
+	if ((n = reach(s, &c, pegs-1, target)) != 0)
+	  {
+	    s->line[s->top - pegs] = j;
+	    return n;
+	  }
+      }
+  if (s->stopped)
+    return 0;
+
+  /* the slot may have been filled further down */
+  for (; e->w[0] || e->w[1]; h = (h + 1) & s->mask, e = &s->table[h])
+    if (e->w[0] == k.w[0] && (e->w[1] & BOARDMASK) == k.w[1])
+      break;
+  if (!e->w[0] && !e->w[1])
+    {
+      if (s->used >= s->limit)
+	{
+	  s->stopped = 1;
+	  return 0;
+	}
+      s->used++;
+    }
+  e->w[0] = k.w[0];
+  e->w[1] = k.w[1] | (bitword) target << VALUESHIFT;
+  return 0;
+}
+
+static int search(iqlayout *l, bitboard *b, unsigned char *line,
+		  int length, long limit, iqresult *r, int (*stop)(void))
+{
+  Search s;
+  bitboard c, tried[MAXJUMPS];
+  char good[MAXJUMPS];
+  int j, k, n, found, low, known, ntried = 0;
+
+  r->pegs = iqcount(b);
+  r->best = r->pegs;
+  r->exact = 0;
+  r->jumps = 0;
+  r->good = 0;
+  r->hint = -1;
+  r->length = 0;
+  r->positions = 0;
+
+  memset(&s, 0, sizeof(Search));
+  s.l = l;
+  s.limit = limit;
+  s.stop = stop;
+  s.top = r->pegs;
+  /* at most half full */
+  for (s.bits = 10; (1L << s.bits) < 2*limit && s.bits < 30; s.bits++)
+    ;
+  s.mask = (1UL << s.bits) - 1;
+  s.table = (bitboard*)calloc(s.mask + 1, sizeof(bitboard));
+  if (s.table == NULL)
+    return 0;
+  if (!images(&s))
+    {
+      free(s.table);
+      return 0;
+    }
+
+  /* start from the way down we were given, if it works */
+  c = *b;
+  for (n = 0; n < length && iqcanjump(l, &c, line[n]); n++)
+    iqjump(l, &c, line[n]);
+  if (n == length && length > 0)
+    {
+      r->best -= length;
+      r->hint = line[0];
+      r->length = length;
+      memcpy(r->line, line, length);
+    }
+
+  for (j = 0; j < l->jumps; j++)
+    if (iqcanjump(l, b, j))
+      r->jumps++;
+
+  /* the quick search, which mostly gets down to the class's fewest */
+  low = fewest(l, b, r->pegs);
+  if ((n = beam(&s, b, r->pegs, low, s.line)) != 0 && n < r->best)
+    {
+      r->best = n;
+      r->hint = s.line[0];
+      r->length = r->pegs - n;
+      memcpy(r->line, s.line, r->length);
+    }
+
+  /* Then look for a way to leave fewer pegs than the last one found,
+     until there isn't one.  Every board that fails is kept, so the
+     next, harder, try doesn't search it again. */
+  while (r->best > low && !s.stopped)
+    {
+      found = 0;
+      for (j = 0; j < l->jumps && !found && !s.stopped; j++)
+	if (iqcanjump(l, b, j))
+	  {
+	    c = *b;
+	    iqjump(l, &c, j);
+	    if ((n = reach(&s, &c, r->pegs-1, r->best-1)) != 0)
+	      {
+		r->best = n;
+		r->hint = j;
+		r->length = r->pegs - n;
+		s.line[0] = j;
+		memcpy(r->line, s.line, r->length);
+		found = 1;
+	      }
+	  }
+      if (!found)
+	break;
+    }
+  r->exact = r->best == low || !s.stopped;
+
+  /* Then how many jumps from here can still do that well, by the quick
+     search or, if that doesn't, the full one.  Jumps to turns of a
+     board already tried go the same way. */
+  known = r->exact && r->hint >= 0;
+  for (j = 0; j < l->jumps && known; j++)
+    if (iqcanjump(l, b, j))
+      {
+	c = *b;
+	iqjump(l, &c, j);
+	canonical(&s, &c, &tried[ntried]);
+	for (k = 0; k < ntried; k++)
+	  if (tried[k].w[0] == tried[ntried].w[0] &&
+	      tried[k].w[1] == tried[ntried].w[1])
+	    break;
+	if (k < ntried)
+	  good[ntried] = good[k];
+	else if (j == r->hint)
+	  good[ntried] = 1;
+	else if ((n = beam(&s, &c, r->pegs-1, r->best, s.line)) != 0 &&
+		 n <= r->best)
+	  good[ntried] = 1;
+	else
+	  good[ntried] = reach(&s, &c, r->pegs-1, r->best) != 0;
+	if (s.stopped)
+	  known = 0;
+	r->good += good[ntried++];
+      }
+  if (!known)
+    r->good = -1;
+  r->positions = s.nodes;
+  free(s.table);
+  free(s.image);
+  return 1;
+}
+
+int iqsolve(iqlayout *l, bitboard *b, unsigned char *line, int length,
+	    long limit, iqresult *r)
+{
+  return search(l, b, line, length, limit, r, NULL);
+}
+
+
+#ifndef SOLVE_NO_THREADS
+
+/* The one thread the game's searches run on. */
+
+static struct {
+  int running;          /* 1 once started, -1 if it couldn't be */
+  pthread_t thread;
+  pthread_mutex_t lock;
+  pthread_cond_t start;
+  int generation;       /* bumped for every iqstart */
+  int done;             /* the generation result is for */
+  iqlayout layout;
+  bitboard board;
+  unsigned char line[HOLES];
+  int length;
+  long limit;
+  iqresult result;
+} worker;
+
+static int searching;   /* generation being searched, worker thread only */
+
+static int newer(void)
+{
+  int n;
+
+  pthread_mutex_lock(&worker.lock);
+  n = worker.generation != searching;
+  pthread_mutex_unlock(&worker.lock);
+  return n;
+}
+
+static void *work(void *arg)
+{
+  static iqlayout l;
+  static unsigned char line[HOLES];
+  bitboard b;
+  int length;
+  long limit;
+  iqresult r;
+
+  pthread_mutex_lock(&worker.lock);
+  for (;;)
+    {
+      while (worker.generation == searching)
+	pthread_cond_wait(&worker.start, &worker.lock);
+      searching = worker.generation;
+      l = worker.layout;
+      b = worker.board;
+      length = worker.length;
+      memcpy(line, worker.line, length);
+      limit = worker.limit;
+      pthread_mutex_unlock(&worker.lock);
+
+      search(&l, &b, line, length, limit, &r, newer);
+
+      pthread_mutex_lock(&worker.lock);
+      if (worker.generation == searching)
+	{
+	  worker.result = r;
+	  worker.done = searching;
+	}
+    }
+  return arg;
+}
+
+void iqstart(iqlayout *l, bitboard *b, unsigned char *line, int length,
+	     long limit)
+{
+  if (worker.running == 0)
+    {
+      pthread_mutex_init(&worker.lock, NULL);
+      pthread_cond_init(&worker.start, NULL);
+      worker.running = -1;
+      if (pthread_create(&worker.thread, NULL, work, NULL) == 0)
+	{
+	  pthread_detach(worker.thread);
+	  worker.running = 1;
+	}
+    }
+  if (worker.running < 0)
+    {
+      /* search right here then */
+      iqsolve(l, b, line, length, limit, &worker.result);
+      return;
+    }
+  pthread_mutex_lock(&worker.lock);
+  worker.layout = *l;
+  worker.board = *b;
+  worker.length = length;
+  if (length > 0)
+    memcpy(worker.line, line, length);
+  worker.limit = limit;
+  worker.generation++;
+  pthread_cond_signal(&worker.start);
+  pthread_mutex_unlock(&worker.lock);
+}
+
+int iqpoll(iqresult *r)
+{
+  int done = 0;
+
+  if (worker.running < 0)
+    {
+      *r = worker.result;
+      return 1;
+    }
+  pthread_mutex_lock(&worker.lock);
+  if (worker.done == worker.generation)
+    {
+      *r = worker.result;
+      done = 1;
+    }
+  pthread_mutex_unlock(&worker.lock);
+  return done;
+}
+
+#else
+
+static iqresult result;
+
+void iqstart(iqlayout *l, bitboard *b, unsigned char *line, int length,
+	     long limit)
+{
+  iqsolve(l, b, line, length, limit, &result);
+}
+
+int iqpoll(iqresult *r)
+{
+  *r = result;
+  return 1;
+}
+
+#endif
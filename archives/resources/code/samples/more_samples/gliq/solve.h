@@ -0,0 +1,73 @@
+/*
+ *  File : solve.h
+ *  Description : Bitboards, jumps and the search that tells whether a
+ *                position can still be won.  Nothing here needs GL, so
+ *                iqbench can use it without a window.
+ *
+ */
+
+#ifndef SOLVE_H
+#define SOLVE_H
+
+#define BOARDSIZE 9   /* on a side, total of 81 holes */
+#define HOLES (BOARDSIZE*BOARDSIZE)
+#define MAXJUMPS (4*HOLES)
+#define IQLIMIT 1000000   /* boards a search keeps before giving up */
+
+/* One bit per hole, hole i*BOARDSIZE+j (peg number - 1) in bit
+   hole%64 of w[hole/64]. */
+#ifdef _WIN32
+typedef unsigned __int64 bitword;
+#else
+typedef unsigned long long bitword;
+#endif
+
+typedef struct {
+  bitword w[2];
+} bitboard;
+
+/* Every jump a board allows, from a hole over a hole into a hole, and
+   the turns and flips that take the holes onto themselves. */
+typedef struct {
+  bitboard holes;                  /* the holes in use */
+  int syms;                        /* symmetries, the identity first */
+  unsigned char sym[8][HOLES];     /* where each takes each hole */
+  int jumps;
+  unsigned char from[MAXJUMPS], over[MAXJUMPS], to[MAXJUMPS];
+  bitboard need[MAXJUMPS];         /* from and over, which need pegs */
+  bitboard land[MAXJUMPS];         /* to, which needs to be empty */
+} iqlayout;
+
+typedef struct {
+  int pegs;        /* on the board now */
+  int best;        /* fewest it found a way to leave */
+  int exact;       /* 0 if it gave up, and there may be a way to leave fewer */
+  int jumps;       /* jumps that can be made now */
+  int good;        /* how many of them can still leave best, if exact;
+		      -1 if it gave up before it knew */
+  int hint;        /* one of those, a jump in the layout, or -1 */
+  int length;      /* the jumps of the way found to leave best */
+  unsigned char line[HOLES];
+  long positions;  /* positions searched */
+} iqresult;
+
+extern void iqmakelayout(iqlayout *l, bitboard *holes);
+extern void iqset(bitboard *b, int hole);
+extern int  iqget(bitboard *b, int hole);
+extern int  iqcount(bitboard *b);
+extern int  iqcanjump(iqlayout *l, bitboard *b, int jump);
+extern void iqjump(iqlayout *l, bitboard *b, int jump);
+
+/* Search from b, starting from the length jumps in line if they can
+   be made (NULL and 0 for none), and giving up once limit positions
+   have been found to fail.  Returns 0 if out of memory. */
+extern int  iqsolve(iqlayout *l, bitboard *b, unsigned char *line,
+		    int length, long limit, iqresult *r);
+
+/* The same on a worker thread (Win32 builds search right away): start
+   a search, dropping the one running, then poll until it's done. */
+extern void iqstart(iqlayout *l, bitboard *b, unsigned char *line,
+		    int length, long limit);
+extern int  iqpoll(iqresult *r);
+
+#endif
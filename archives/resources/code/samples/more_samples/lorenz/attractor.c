@@ -0,0 +1,277 @@
+/*
+ * attractor.c
+ *
+ * Particles in the Lorenz attractor, see attractor.h.
+ *
+ * The equations are the ones lorenz.c always used (the usual ones with
+ * z upside down):
+ *
+ *   x' = sigma (y - x)
+ *   y' = r x - y + x z
+ *   z' = -(x y + b z)
+ *
+ * Positions are kept as separate x, y and z arrays so that four
+ * particles sit in one SSE register; each group of four is taken
+ * through all the steps asked for while it is in registers, writing
+ * its trails as it goes.  Without SSE the same arithmetic is done one
+ * particle at a time, in the same order, so both give the same result.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "attractor.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define ATTRACTOR_SSE
+#include <xmmintrin.h>
+#endif
+
+
+ATTRACTOR *attractor_new(int count, int length, int every)
+{
+    ATTRACTOR *a;
+    int padded = (count + 3) & ~3;
+
+    if (count < 1 || length < 0 || (length & (length - 1)) || every < 1)
+	return NULL;
+    a = (ATTRACTOR *) calloc(1, sizeof(ATTRACTOR));
+    if (a == NULL)
+	return NULL;
+    a->count = count;
+    a->sigma = 10.;
+    a->r = 28.;
+    a->b = 8./3.;
+    a->dt = 0.003;
+    a->x = (float *) calloc(3 * padded, sizeof(float));
+    a->length = length;
+    a->every = every;
+    a->head = length - 1;
+    if (length)
+	a->trail = (float *) calloc((size_t) count * (length + 1) * 3,
+				    sizeof(float));
+    if (a->x == NULL || (length && a->trail == NULL)) {
+	attractor_free(a);
+	return NULL;
+    }
+    a->y = a->x + padded;
+    a->z = a->y + padded;
+    return a;
+}
+
+void attractor_free(ATTRACTOR *a)
+{
+    if (a == NULL)
+	return;
+    free(a->x);
+    free(a->trail);
+    free(a);
+}
+
+/* keep a position of particle i in slot k of its trail */
+static void keep(ATTRACTOR *a, int i, int k, float x, float y, float z)
+{
+    float *t = a->trail + ((size_t) i * (a->length + 1) + k) * 3;
+
+    t[0] = x;
+    t[1] = y;
+    t[2] = z;
+    if (k == 0) {
+	t += a->length * 3;
+	t[0] = x;
+	t[1] = y;
+	t[2] = z;
+    }
+}
+
+/* lorenz equations */
+#define LORENZ(fx, fy, fz, x, y, z) \
+    fx = s * (y - x); \
+    fy = r * x - y + x * z; \
+    fz = -(x * y + b * z)
+
+#ifndef ATTRACTOR_SSE
+static void step_one(ATTRACTOR *a, int i, int steps)
+{
+    float s = a->sigma, r = a->r, b = a->b, h = a->dt;
+    float h2 = 0.5 * h, h6 = h / 6., two = 2.;
+    float x = a->x[i], y = a->y[i], z = a->z[i];
+    float k1x, k1y, k1z, k2x, k2y, k2z, k3x, k3y, k3z, k4x, k4y, k4z;
+    float tx, ty, tz;
+    int n;
+
+    for (n = 1; n <= steps; n++) {
+	LORENZ(k1x, k1y, k1z, x, y, z);
+	tx = x + h2 * k1x;
+	ty = y + h2 * k1y;
+	tz = z + h2 * k1z;
+	LORENZ(k2x, k2y, k2z, tx, ty, tz);
+	tx = x + h2 * k2x;
+	ty = y + h2 * k2y;
+	tz = z + h2 * k2z;
+	LORENZ(k3x, k3y, k3z, tx, ty, tz);
+	tx = x + h * k3x;
+	ty = y + h * k3y;
+	tz = z + h * k3z;
+	LORENZ(k4x, k4y, k4z, tx, ty, tz);
+	x += h6 * (((k1x + two * k2x) + two * k3x) + k4x);
+	y += h6 * (((k1y + two * k2y) + two * k3y) + k4y);
+	z += h6 * (((k1z + two * k2z) + two * k3z) + k4z);
+
+	if (a->length && (a->steps + n) % a->every == 0)
+	    keep(a, i, (a->head + (a->steps + n) / a->every) & (a->length - 1),
+		 x, y, z);
+    }
+    a->x[i] = x;
+    a->y[i] = y;
+    a->z[i] = z;
+}
+#else
+/* particles i to i + 3 */
+static void step_four(ATTRACTOR *a, int i, int steps)
+{
+    __m128 s = _mm_set1_ps(a->sigma), r = _mm_set1_ps(a->r),
+	b = _mm_set1_ps(a->b), h = _mm_set1_ps(a->dt),
+	h2 = _mm_set1_ps(0.5 * a->dt), h6 = _mm_set1_ps(a->dt / 6.),
+	two = _mm_set1_ps(2.), zero = _mm_setzero_ps();
+    __m128 x = _mm_loadu_ps(a->x + i), y = _mm_loadu_ps(a->y + i),
+	z = _mm_loadu_ps(a->z + i);
+    __m128 k1x, k1y, k1z, k2x, k2y, k2z, k3x, k3y, k3z, k4x, k4y, k4z;
+    __m128 tx, ty, tz;
+    float px[4], py[4], pz[4];
+    int n, j, k;
+
+#undef LORENZ
+#define LORENZ(fx, fy, fz, x, y, z) \
+    fx = _mm_mul_ps(s, _mm_sub_ps(y, x)); \
+    fy = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(r, x), y), _mm_mul_ps(x, z)); \
+    fz = _mm_sub_ps(zero, _mm_add_ps(_mm_mul_ps(x, y), _mm_mul_ps(b, z)))
+#define STEP(t, p, h, k) \
+    t = _mm_add_ps(p, _mm_mul_ps(h, k))
+#define SUM(p, k1, k2, k3, k4) \
+    p = _mm_add_ps(p, _mm_mul_ps(h6, _mm_add_ps(_mm_add_ps(_mm_add_ps(k1, \
+	_mm_mul_ps(two, k2)), _mm_mul_ps(two, k3)), k4)))
+
+    for (n = 1; n <= steps; n++) {
+	LORENZ(k1x, k1y, k1z, x, y, z);
+	STEP(tx, x, h2, k1x);
+	STEP(ty, y, h2, k1y);
+	STEP(tz, z, h2, k1z);
+	LORENZ(k2x, k2y, k2z, tx, ty, tz);
+	STEP(tx, x, h2, k2x);
+	STEP(ty, y, h2, k2y);
+	STEP(tz, z, h2, k2z);
+	LORENZ(k3x, k3y, k3z, tx, ty, tz);
+	STEP(tx, x, h, k3x);
+	STEP(ty, y, h, k3y);
+	STEP(tz, z, h, k3z);
+	LORENZ(k4x, k4y, k4z, tx, ty, tz);
+	SUM(x, k1x, k2x, k3x, k4x);
+	SUM(y, k1y, k2y, k3y, k4y);
+	SUM(z, k1z, k2z, k3z, k4z);
+
+	if (a->length && (a->steps + n) % a->every == 0) {
+	    _mm_storeu_ps(px, x);
+	    _mm_storeu_ps(py, y);
+	    _mm_storeu_ps(pz, z);
+	    k = (a->head + (a->steps + n) / a->every) & (a->length - 1);
+	    for (j = 0; j < 4 && i + j < a->count; j++)
+		keep(a, i + j, k, px[j], py[j], pz[j]);
+	}
+    }
+    _mm_storeu_ps(a->x + i, x);
+    _mm_storeu_ps(a->y + i, y);
+    _mm_storeu_ps(a->z + i, z);
+#undef STEP
+#undef SUM
+}
+#endif
+#undef LORENZ
+
+void attractor_step(ATTRACTOR *a, int steps)
+{
+    int i, n;
+
+    if (steps < 1)
+	return;
+#ifdef ATTRACTOR_SSE
+    for (i = 0; i < a->count; i += 4)
+	step_four(a, i, steps);
+#else
+    for (i = 0; i < a->count; i++)
+	step_one(a, i, steps);
+#endif
+
+    if (a->length) {
+	n = (a->steps + steps) / a->every;
+	a->head = (a->head + n) & (a->length - 1);
+	a->kept = a->kept + n < a->length ? a->kept + n : a->length;
+    }
+    a->steps = (a->steps + steps) % a->every;
+}
+
+int attractor_strips(const ATTRACTOR *a, int i, int first[2], int count[2])
+{
+    int base = i * (a->length + 1), oldest;
+
+    if (a->kept == 0)
+	return 0;
+    if (a->kept < a->length) {
+	first[0] = base + a->head - a->kept + 1;
+	count[0] = a->kept;
+	return 1;
+    }
+    oldest = (a->head + 1) & (a->length - 1);
+    if (oldest == 0) {
+	first[0] = base;
+	count[0] = a->length;
+	return 1;
+    }
+    /* oldest up to the copy of slot 0, then slot 0 up to the newest */
+    first[0] = base + oldest;
+    count[0] = a->length - oldest + 1;
+    first[1] = base;
+    count[1] = a->head + 1;
+    return 2;
+}
+
+void attractor_density(const ATTRACTOR *a, const float m[16],
+		       int width, int height, int planes, unsigned *count)
+{
+    const float *p;
+    unsigned *c;
+    float row[3][4], w = width, h = height, x, y, z, cx, cy, cw;
+    int length = a->length, head = a->head, mask = a->length - 1;
+    int i, j, k, n = a->length ? a->kept : 1;
+
+    /* fold the viewport into the matrix: pixel = row / row[2] */
+    for (k = 0; k < 4; k++) {
+	row[0][k] = 0.5 * width * (m[k * 4] + m[k * 4 + 3]);
+	row[1][k] = 0.5 * height * (m[k * 4 + 1] + m[k * 4 + 3]);
+	row[2][k] = m[k * 4 + 3];
+    }
+
+    for (i = 0; i < a->count; i++) {
+	c = count + (size_t) (i % planes) * width * height;
+	for (j = 0; j < n; j++) {
+	    if (length) {
+		p = a->trail + ((size_t) i * (length + 1) +
+				((head - j) & mask)) * 3;
+		x = p[0];
+		y = p[1];
+		z = p[2];
+	    } else {
+		x = a->x[i];	/* no trail: just where it is */
+		y = a->y[i];
+		z = a->z[i];
+	    }
+	    cw = row[2][0] * x + row[2][1] * y + row[2][2] * z + row[2][3];
+	    if (cw <= 0)
+		continue;
+	    cw = 1 / cw;
+	    cx = (row[0][0] * x + row[0][1] * y + row[0][2] * z + row[0][3]) * cw;
+	    cy = (row[1][0] * x + row[1][1] * y + row[1][2] * z + row[1][3]) * cw;
+	    if (cx >= 0 && cx < w && cy >= 0 && cy < h)
+		c[(int) cy * width + (int) cx]++;
+	}
+    }
+}
@@ -0,0 +1,50 @@
+/*
+ * attractor.h
+ *
+ * Many particles in the Lorenz attractor at once, each leaving a trail.
+ *
+ * The particles are stepped together with fixed step fourth order
+ * Runge-Kutta.  Every few steps the position of each particle is kept
+ * in its trail, a ring of the last few hundred positions laid out so
+ * that it can be drawn straight from a vertex array as at most two
+ * line strips.  For more particles than it makes sense to draw as
+ * lines, the trails can be counted into a density image instead.
+ */
+
+#ifndef ATTRACTOR_H
+#define ATTRACTOR_H
+
+typedef struct {
+    int count;			/* particles */
+    float sigma, r, b, dt;	/* Lorenz parameters and time step */
+    float *x, *y, *z;		/* now, count rounded up to 4 */
+
+    int length;			/* positions kept per trail, a power of 2 */
+    int every;			/* steps per kept position */
+    int steps;			/* steps since the last kept position */
+    int head;			/* newest kept position */
+    int kept;			/* positions kept so far, at most length */
+    float *trail;		/* count trails of length + 1 xyz; the last
+				   is a copy of the first, so that a strip
+				   can run over the wrap */
+} ATTRACTOR;
+
+/* count particles at the origin, with trails of the given length
+   (0 for none) keeping one position every so many steps */
+ATTRACTOR *attractor_new(int count, int length, int every);
+void attractor_free(ATTRACTOR *a);
+
+void attractor_step(ATTRACTOR *a, int steps);
+
+/* the trail of particle i as line strips of positions from
+   a->trail: first[0] for count[0], then first[1] for count[1];
+   returns the number of strips, 0 to 2 */
+int attractor_strips(const ATTRACTOR *a, int i, int first[2], int count[2]);
+
+/* Add the kept positions of every trail to count[planes][height][width]
+   (particle i into plane i % planes), projected by the column major
+   matrix m onto a width x height image. */
+void attractor_density(const ATTRACTOR *a, const float m[16],
+		       int width, int height, int planes, unsigned *count);
+
+#endif
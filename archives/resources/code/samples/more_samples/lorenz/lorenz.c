@@ -13,6 +13,10 @@
  * maintain the illusion of 3 dimensions, but it can slow things down.
  * Other options allow you to play with the redraw rate and the number of new
  * lines per redraw. So you can customize it to the speed of your machine.
+ *
+ * Any number of particles can be followed (see attractor.c); the first five
+ * keep their colors and the rest take turns with them.  With many thousands
+ * the trails can be shown as a density image instead of lines.
  * 
  * For general info on Lorenz attractors I recommend "An Introduction to
  * the Lorenz Equations", IEEE Transactions on Circuits and Systems, August '83.
@@ -35,8 +39,18 @@
 #include <time.h>
 #ifndef WIN32
 #include <getopt.h>
+#else
+#include <windows.h>	/* wglGetProcAddress */
 #endif
 #include <GL/glut.h>
+#ifndef WIN32
+#include <GL/glx.h>	/* glXGetProcAddressARB */
+#endif
+#include "attractor.h"
+
+#ifndef APIENTRY
+#define APIENTRY
+#endif
 
 #ifdef WIN32
 #define drand48() ((float)rand()/RAND_MAX)
@@ -46,7 +60,13 @@
 
 static GLuint asphere;
 
-#define POINTMASK (unsigned long)511
+/* glMultiDrawArrays, when the OpenGL running is 1.4 or later */
+static void (APIENTRY *MultiDrawArrays)(GLenum mode, const GLint *first,
+    const GLsizei *count, GLsizei primcount);
+
+#define TRAIL_LENGTH 128	/* positions kept per trail */
+#define TRAIL_EVERY 4		/* steps per kept position */
+#define COLORS 5
 #define G (0.002)	/* eyept to red sphere gravity */
 #define LG (0.3)
 #define CUBESIDE (120.)
@@ -59,13 +79,15 @@ static GLuint asphere;
 
 /* globals */
 float sigma = 10., r = 28., b = 8./3., dt = 0.003;
-unsigned long rp = 0, bp = 0, gp = 0, yp = 0, mp = 0;
 long xmax, ymax, zmax, zmin;
-float rv[POINTMASK+1][3],			/* red points */
-	bv[POINTMASK+1][3],		/* blue points */
-	gv[POINTMASK+1][3],		/* green points */
-	yv[POINTMASK+1][3],		/* yellow points */
-	mv[POINTMASK+1][3];		/* magenta points */
+ATTRACTOR *trails;			/* the particles; 0 is red */
+float colors[COLORS][3] = {
+    {1.0, 0.0, 0.0},			/* red */
+    {0.0, 0.0, 1.0},			/* blue */
+    {0.0, 1.0, 0.0},			/* green */
+    {1.0, 0.0, 1.0},			/* magenta */
+    {0.0, 1.0, 1.0},			/* cyan */
+};
 
 int lpf;				/* number of new lines per frame */
 
@@ -89,11 +111,14 @@ GLboolean hexflag,		/* hexagons? */
 	fflag,			
 	wflag,
 	gflag,
+	nflag,
+	dflag,			/* density image instead of lines? */
 	debug;
 
 /* option values */
 short hexbright;	/* brightness for hexagon color */
 int speed,		/* speed (number of new line segs per redraw) */
+    count,		/* number of particles */
     frame;		/* frame rate (actually noise value for TIMER0) */
 float a = 0,
     da;			/* hexagon rotational velocity (.1 degree/redraw) */
@@ -107,11 +132,12 @@ void draw_hexplane(void);
 void draw_hexagon(void);
 void move_eye(void);
 void redraw(void);
-void next_line(float v[][3], unsigned long *p);
+void draw_trails(void);
+void draw_density(void);
 void parse_args(int argc, char **argv);
 void print_usage(char*);
 void print_info(void);
-void sphdraw(float args[4]);
+void sphdraw(float x, float y, float z);
 void setPerspective(int angle, float aspect, float zNear, float zFar);
 
 
@@ -144,17 +170,8 @@ static void Key(unsigned char key, int x, int y)
 
 static void Draw(void)
 {
-    int i, j;
-
     if (animate) {
-	i = speed;
-	while (i--) {
-	    next_line(rv, &rp);
-	    next_line(bv, &bp);
-	    next_line(gv, &gp);
-	    next_line(yv, &yp);
-	    next_line(mv, &mp);
-	}
+	attractor_step(trails, speed);
 	glPushMatrix();
 	move_eye();
 	redraw();
@@ -177,19 +194,13 @@ void main(int argc, char **argv)
     init_3d();
     init_graphics();
 
-    /* draw the first POINTMASK points in each color */
-    while(rp < POINTMASK) {
-	next_line(rv, &rp);
-	next_line(bv, &bp);
-	next_line(gv, &gp);
-	next_line(yv, &yp);
-	next_line(mv, &mp);
-    }
+    /* fill the trails */
+    attractor_step(trails, TRAIL_LENGTH * TRAIL_EVERY);
 
     eyex[0] = eyex[1] = eyex[2] = 0.;
-    eyel[0] = rv[rp][0];
-    eyel[1] = rv[rp][1];
-    eyel[2] = rv[rp][2];
+    eyel[0] = trails->x[0];
+    eyel[1] = trails->y[0];
+    eyel[2] = trails->z[0];
 	
     glPushMatrix();
     move_eye();
@@ -203,72 +214,144 @@ void main(int argc, char **argv)
     glutMainLoop();
 }
 
-/* compute the next point on the path according to Lorenz' equations. */
-void next_line(float v[][3], unsigned long *p)
+/* draw the trails from their vertex arrays, one color at a time */
+void draw_trails(void)
 {
+    static GLint *first;
+    static GLsizei *number;
+    int c, i, n;
+
+    if (first == NULL) {
+	first = (GLint *) malloc(2 * count * sizeof(GLint));
+	number = (GLsizei *) malloc(2 * count * sizeof(GLsizei));
+	if (first == NULL || number == NULL) {
+	    fprintf(stderr, "lorenz: out of memory\n");
+	    exit(1);
+	}
+    }
 
-    dx = sigma * (v[*p][1] - v[*p][0]) * dt;
-    dy = (r*v[*p][0] - v[*p][1] + v[*p][0]*v[*p][2]) * dt;
-    dz = (v[*p][0] *v[*p][1] + b*v[*p][2]) * dt;	
-	
-    v[(*p + 1) & POINTMASK][0] = v[*p][0] + dx;
-    v[(*p + 1) & POINTMASK][1] = v[*p][1] + dy;
-    v[(*p + 1) & POINTMASK][2] = v[*p][2] - dz;
-    *p = (*p + 1) & POINTMASK;
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glVertexPointer(3, GL_FLOAT, 0, trails->trail);
+    for (c = 0; c < COLORS && c < count; c++) {
+	n = 0;
+	for (i = c; i < count; i += COLORS)
+	    n += attractor_strips(trails, i, &first[n], &number[n]);
+	glColor3fv(colors[c]);
+	if (MultiDrawArrays != NULL)
+	    MultiDrawArrays(GL_LINE_STRIP, first, number, n);
+	else
+	    for (i = 0; i < n; i++)
+		glDrawArrays(GL_LINE_STRIP, first[i], number[i]);
+    }
+    glDisableClientState(GL_VERTEX_ARRAY);
 }
 
-void drawLines(unsigned long index, float array[POINTMASK][3])
+/* count the trails into an image the size of the window and add it to
+   what's there, each color's count on a log scale */
+void draw_density(void)
 {
-    unsigned long p;
-    int i;
+    static unsigned *counts;
+    static GLubyte *image;
+    static float *level;
+    static long pixels;
+    static unsigned levels;
+    float projection[16], modelview[16], m[16], v[3];
+    unsigned most, *p;
+    long n = xmax * ymax, i;
+    int c, j, k;
+
+    if (pixels != n) {
+	free(counts);
+	free(image);
+	counts = (unsigned *) malloc(COLORS * n * sizeof(unsigned));
+	image = (GLubyte *) malloc(3 * n);
+	if (counts == NULL || image == NULL) {
+	    fprintf(stderr, "lorenz: out of memory\n");
+	    exit(1);
+	}
+	pixels = n;
+    }
 
-#define LINE_STEP 4
-
-    p = (index+1)&POINTMASK;
-    i = LINE_STEP-(p % LINE_STEP);
-    if (i == LINE_STEP) i=0;
-    glBegin(GL_LINE_STRIP);
-	/* draw points in order from oldest to newest */
-	while(p != index) {
-	    if (i == 0) {
-		glVertex3fv(array[p]);
-		i = LINE_STEP;
-	    } 
-	    i--;
-	    p = (p+1) & POINTMASK;
+    glGetFloatv(GL_PROJECTION_MATRIX, projection);
+    glGetFloatv(GL_MODELVIEW_MATRIX, modelview);
+    for (j = 0; j < 4; j++)
+	for (k = 0; k < 4; k++)
+	    m[j*4 + k] = projection[k] * modelview[j*4] +
+		projection[4 + k] * modelview[j*4 + 1] +
+		projection[8 + k] * modelview[j*4 + 2] +
+		projection[12 + k] * modelview[j*4 + 3];
+
+    memset(counts, 0, COLORS * n * sizeof(unsigned));
+    attractor_density(trails, m, xmax, ymax, COLORS, counts);
+
+    /* a table of the log scale, up to the busiest pixel */
+    most = 1;
+    for (i = 0; i < COLORS * n; i++)
+	if (counts[i] > most)
+	    most = counts[i];
+    if (most + 1 > levels) {
+	free(level);
+	levels = most + 1;
+	level = (float *) malloc(levels * sizeof(float));
+	if (level == NULL) {
+	    fprintf(stderr, "lorenz: out of memory\n");
+	    exit(1);
 	}
-	glVertex3fv(array[index]);
-    glEnd();
+    }
+    for (i = 0; i <= (long) most; i++)
+	level[i] = 255. * log(1. + i) / log(1. + most);
+
+    for (i = 0; i < n; i++) {
+	v[0] = v[1] = v[2] = 0.;
+	for (c = 0, p = counts + i; c < COLORS; c++, p += n)
+	    if (*p) {
+		v[0] += colors[c][0] * level[*p];
+		v[1] += colors[c][1] * level[*p];
+		v[2] += colors[c][2] * level[*p];
+	    }
+	image[i*3] = v[0] > 255. ? 255 : (GLubyte) v[0];
+	image[i*3 + 1] = v[1] > 255. ? 255 : (GLubyte) v[1];
+	image[i*3 + 2] = v[2] > 255. ? 255 : (GLubyte) v[2];
+    }
+
+    glPushAttrib(GL_ENABLE_BIT | GL_COLOR_BUFFER_BIT | GL_TRANSFORM_BIT);
+    glDisable(GL_DEPTH_TEST);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ONE);
+    glMatrixMode(GL_PROJECTION);
+    glPushMatrix();
+    glLoadIdentity();
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+    glLoadIdentity();
+    glRasterPos2f(-1., -1.);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glDrawPixels(xmax, ymax, GL_RGB, GL_UNSIGNED_BYTE, image);
+    glPopMatrix();
+    glMatrixMode(GL_PROJECTION);
+    glPopMatrix();
+    glPopAttrib();
 }
 
 void redraw(void)
 {
-    unsigned long p;
-	
+    int i;
+
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
     if(hexflag)
 	draw_hexcube();
 
-    glColor3f(1.0, 0.0, 0.0);
-    drawLines(rp, rv);
-    sphdraw(rv[rp]);
+    if (dflag)
+	draw_density();
+    else
+	draw_trails();
 
-    glColor3f(0.0, 0.0, 1.0);
-    drawLines(bp, bv);
-    sphdraw(bv[bp]);
-	
-    glColor3f(0.0, 1.0, 0.0);
-    drawLines(gp, gv);
-    sphdraw(gv[gp]);
-
-    glColor3f(1.0, 0.0, 1.0);
-    drawLines(yp, yv);
-    sphdraw(yv[yp]);
-
-    glColor3f(0.0, 1.0, 1.0);
-    drawLines(mp, mv);
-    sphdraw(mv[mp]);
+    /* only the first of each color gets a sphere */
+    for (i = 0; i < COLORS && i < count; i++) {
+	glColor3fv(colors[i]);
+	sphdraw(trails->x[i], trails->y[i], trails->z[i]);
+    }
 
     glutSwapBuffers();
 }
@@ -276,9 +359,9 @@ void redraw(void)
 void move_eye(void)
 {
     /* first move the eye */
-    eyev[0] += gravity * (rv[rp][0] - eyex[0]);
-    eyev[1] += gravity * (rv[rp][1] - eyex[1]);
-    eyev[2] += gravity * (rv[rp][2] - eyex[2]);
+    eyev[0] += gravity * (trails->x[0] - eyex[0]);
+    eyev[1] += gravity * (trails->y[0] - eyex[1]);
+    eyev[2] += gravity * (trails->z[0] - eyex[2]);
 
     /* adjust position using new velocity */
     eyex[0] += eyev[0] * dt;
@@ -287,9 +370,9 @@ void move_eye(void)
 
     /* move the lookat point */
     /* it catches up to the red point if it's moving slowly enough */
-    eyel[0] += LG * (rv[rp][0] - eyel[0]);
-    eyel[1] += LG * (rv[rp][1] - eyel[1]);
-    eyel[2] += LG * (rv[rp][2] - eyel[2]);
+    eyel[0] += LG * (trails->x[0] - eyel[0]);
+    eyel[1] += LG * (trails->y[0] - eyel[1]);
+    eyel[2] += LG * (trails->z[0] - eyel[2]);
 
     /* change view */
     gluLookAt(eyex[0], eyex[1], eyex[2], eyel[0], eyel[1], eyel[2],
@@ -441,10 +524,10 @@ void draw_hexplane(void)
 	glPopMatrix();
 }
 
-void sphdraw(float args[3])
+void sphdraw(float x, float y, float z)
 {
     glPushMatrix();
-    glTranslatef(args[0], args[1], args[2]);
+    glTranslatef(x, y, z);
     glCallList(asphere);
     glPopMatrix();
 }
@@ -460,28 +543,29 @@ void setPerspective(int angle, float aspect, float zNear, float zFar)
 /* initialize global 3-vectors */
 void init_3d(void)
 {
-    (void)srand48((long)time((time_t*)NULL));
-
-    /* initialize colored points */
-    rv[0][0] = (float)drand48() * 10.;
-    rv[0][1] = (float)drand48() * 10.;
-    rv[0][2] = (float)drand48() * 10. - 10.;
-
-    bv[0][0] = rv[0][0] + (float)drand48()*5.;
-    bv[0][1] = rv[0][1] + (float)drand48()*5.;
-    bv[0][0] = rv[0][2] + (float)drand48()*5.;
-
-    gv[0][0] = rv[0][0] + (float)drand48()*5.;
-    gv[0][1] = rv[0][1] + (float)drand48()*5.;
-    gv[0][0] = rv[0][2] + (float)drand48()*5.;
+    int i;
 
-    yv[0][0] = rv[0][0] + (float)drand48()*5.;
-    yv[0][1] = rv[0][1] + (float)drand48()*5.;
-    yv[0][0] = rv[0][2] + (float)drand48()*5.;
+    (void)srand48((long)time((time_t*)NULL));
 
-    mv[0][0] = rv[0][0] + (float)drand48()*5.;
-    mv[0][1] = rv[0][1] + (float)drand48()*5.;
-    mv[0][0] = rv[0][2] + (float)drand48()*5.;
+    trails = attractor_new(count, TRAIL_LENGTH, TRAIL_EVERY);
+    if (trails == NULL) {
+	fprintf(stderr, "lorenz: can't allocate %d particles\n", count);
+	exit(1);
+    }
+    trails->sigma = sigma;
+    trails->r = r;
+    trails->b = b;
+    trails->dt = dt;
+
+    /* initialize colored points, the rest near the red one */
+    trails->x[0] = (float)drand48() * 10.;
+    trails->y[0] = (float)drand48() * 10.;
+    trails->z[0] = (float)drand48() * 10. - 10.;
+    for (i = 1; i < count; i++) {
+	trails->x[i] = trails->x[0] + (float)drand48()*5.;
+	trails->y[i] = trails->y[0] + (float)drand48()*5.;
+	trails->z[i] = trails->z[0] + (float)drand48()*5.;
+    }
 
     /* initialize eye velocity */
     eyev[0] = eyev[1] = eyev[2] = 0.;
@@ -492,6 +576,7 @@ void init_graphics(void)
 {
     int width = 600;
     int height = 600;
+    int major, minor;
 
     xmax = width;
     ymax = height;
@@ -511,6 +596,20 @@ void init_graphics(void)
     glNewList(asphere, GL_COMPILE);
     gluSphere(quadObj, 0.3, 12, 8);
     glEndList();
+
+    /* the headers say nothing about the OpenGL the program runs on */
+    if (sscanf((const char *) glGetString(GL_VERSION), "%d.%d",
+	    &major, &minor) == 2 &&
+	    (major > 1 || (major == 1 && minor >= 4))) {
+#ifdef WIN32
+	MultiDrawArrays = (void (APIENTRY *)(GLenum, const GLint *,
+	    const GLsizei *, GLsizei)) wglGetProcAddress("glMultiDrawArrays");
+#elif defined(GLX_ARB_get_proc_address)
+	MultiDrawArrays = (void (APIENTRY *)(GLenum, const GLint *,
+	    const GLsizei *, GLsizei)) glXGetProcAddressARB(
+	    (const GLubyte *) "glMultiDrawArrays");
+#endif
+    }
 }
 
 #ifndef WIN32
@@ -523,7 +622,7 @@ void parse_args(int argc, char **argv)
 {
     int c;
 
-    hexflag = sflag = fflag = wflag = gflag = debug = FALSE;
+    hexflag = sflag = fflag = wflag = gflag = nflag = dflag = debug = FALSE;
 #ifndef WIN32
     opterr = 0;
 #endif
@@ -541,6 +640,16 @@ void parse_args(int argc, char **argv)
 	} else if (strcmp("-x", argv[argc]) == 0) {
 	    hexflag = TRUE;
 	    farplane = 300.;
+	} else if (strcmp("-d", argv[argc]) == 0) {
+	    dflag = TRUE;
+	} else if (strcmp("-n", argv[argc]) == 0) {
+	    nflag = TRUE;
+	    if (argv[argc+1])
+		count = atoi(argv[argc+1]);
+	    else {
+		printf("%s: -n option requires an argument.\n", argv[0]);
+		exit(1);
+	    }
 	} else if (strcmp("-s", argv[argc]) == 0) {
 	    sflag = TRUE;
 	    if (argv[argc+1])
@@ -594,7 +703,7 @@ void parse_args(int argc, char **argv)
 	}
     }
 #else
-    while( (c = getopt(argc, argv, "Xhixs:f:w:g:")) != -1)
+    while( (c = getopt(argc, argv, "Xhixds:f:w:g:n:")) != -1)
 	switch(c) {
 	  case 'X':
 	    debug = TRUE;
@@ -609,6 +718,13 @@ void parse_args(int argc, char **argv)
 	    hexflag = TRUE;
 	    farplane = 300.;
 	    break;
+	  case 'd':
+	    dflag = TRUE;
+	    break;
+	  case 'n':
+	    nflag = TRUE;
+	    count = atoi(optarg);
+	    break;
 	  case 's':
 	    sflag = TRUE;
 	    speed = atoi(optarg);
@@ -659,12 +775,14 @@ void parse_args(int argc, char **argv)
 	da = 0.;
     if(!gflag)
 	gravity = G;
+    if(!nflag || count < 1)
+	count = COLORS;
 }
 
 void print_usage(char *program)
 {
 printf("\nUsage: %s [-h] [-i] [-x] [-s speed]", program);
-printf(" [-w rot_v] [-g gravity]\n\n");
+printf(" [-w rot_v] [-g gravity] [-n count] [-d]\n\n");
 printf("-h              Print this message.\n");
 printf("-i              Print information about the demo.\n");
 printf("-x              Enclose the particles in a box made of hexagons.\n");
@@ -686,6 +804,9 @@ printf("-g gravity      Sets the strength of the attraction of the eye to\n");
 printf("                the red particle. Actually, it's not gravity since\n");
 printf("                the attraction is proportionate to distance.\n");
 printf("                Default value: 0.002. Try large values!\n");
+printf("-n count        Sets the number of particles. Default value: 5.\n");
+printf("-d              Shows the trails as a density image instead of\n");
+printf("                lines; better for tens of thousands of particles.\n");
 /* input added for GLX port */
 printf(" Executions control:  \n");
 printf("    <spacebar>	step through single frames\n");
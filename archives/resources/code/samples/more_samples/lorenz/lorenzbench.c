@@ -0,0 +1,133 @@
+/*
+ * lorenzbench.c
+ *
+ * Time the particle stepping of lorenz without drawing anything.
+ *
+ * For 1000 up to the given number of particles, prints particle steps
+ * per second with no trails and with the trails lorenz keeps.  Then,
+ * for the given number of trails (10000 unless set), the milliseconds
+ * per frame spent stepping at the default speed and counting the
+ * trails into a 600x600 density image.
+ *
+ * usage: lorenzbench [max particles [trails]]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "attractor.h"
+
+#ifdef _WIN32
+#include <windows.h>
+typedef int timer;
+#define getTime(a)	(a = GetTickCount())
+#define timeDiff(a, b)	((b - a) * 1000)
+#else
+#include <sys/time.h>
+typedef struct timeval timer;
+#define getTime(a)	gettimeofday(&a, NULL)
+#define timeDiff(a, b)	(((b.tv_sec - a.tv_sec) * 1000000) + b.tv_usec - a.tv_usec)
+#endif
+
+#define LENGTH	128	/* as lorenz.c */
+#define EVERY	4
+#define SPEED	3
+#define SIZE	600
+
+ATTRACTOR *new_attractor(int count, int length)
+{
+    ATTRACTOR *a = attractor_new(count, length, EVERY);
+    int i;
+
+    if (a == NULL) {
+	fprintf(stderr, "lorenzbench: Can't allocate %d particles.\n", count);
+	exit(1);
+    }
+    srand(1);
+    for (i = 0; i < count; i++) {
+	a->x[i] = (float)rand()/RAND_MAX * 10.;
+	a->y[i] = (float)rand()/RAND_MAX * 10.;
+	a->z[i] = (float)rand()/RAND_MAX * 10. - 10.;
+    }
+    /* fill the trails */
+    attractor_step(a, length * EVERY);
+    return a;
+}
+
+/* particle steps per second, steps at a time */
+double run(ATTRACTOR *a, int steps)
+{
+    timer t0, t1;
+    long usec;
+    int n = 0;
+
+    getTime(t0);
+    do {
+	attractor_step(a, steps);
+	getTime(t1);
+	usec = timeDiff(t0, t1);
+    } while (++n < 4 || usec < 250000);
+    return (double)a->count * steps * n / (usec > 0 ? usec : 1) * 1e6;
+}
+
+/* milliseconds per density image */
+double density(ATTRACTOR *a, unsigned *count)
+{
+    /* roughly what lorenz's view does: the attractor fills the image */
+    static float m[16] = {
+	0.03, 0., 0., 0.,
+	0., 0.03, 0., 0.,
+	0., 0., 0., 0.01,
+	0., 0., 0., 1.
+    };
+    timer t0, t1;
+    long usec;
+    int n = 0;
+
+    getTime(t0);
+    do {
+	memset(count, 0, 5 * SIZE * SIZE * sizeof(unsigned));
+	attractor_density(a, m, SIZE, SIZE, 5, count);
+	getTime(t1);
+	usec = timeDiff(t0, t1);
+    } while (++n < 4 || usec < 250000);
+    return usec / 1000. / n;
+}
+
+int main(int argc, char **argv)
+{
+    int max = 1000000, trails = 10000, n;
+    ATTRACTOR *a;
+    unsigned *count;
+    double bare, kept;
+
+    if (argc > 1)
+	max = atoi(argv[1]);
+    if (argc > 2)
+	trails = atoi(argv[2]);
+
+    printf("particle steps per second\n");
+    printf("%10s %14s %14s\n", "particles", "no trails", "trails");
+    for (n = 1000; n <= max; n *= 10) {
+	a = new_attractor(n, 0);
+	bare = run(a, 64);
+	attractor_free(a);
+	a = new_attractor(n, LENGTH);
+	kept = run(a, SPEED);
+	attractor_free(a);
+	printf("%10d %14.0f %14.0f\n", n, bare, kept);
+    }
+
+    count = (unsigned *) malloc(5 * SIZE * SIZE * sizeof(unsigned));
+    a = new_attractor(trails, LENGTH);
+    if (count == NULL) {
+	fprintf(stderr, "lorenzbench: Can't allocate the image.\n");
+	exit(1);
+    }
+    printf("\n%d trails, ms per frame\n", trails);
+    printf("%10s %10.3f\n", "step", a->count * SPEED / run(a, SPEED) * 1000.);
+    printf("%10s %10.3f\n", "density", density(a, count));
+    attractor_free(a);
+    free(count);
+    return 0;
+}
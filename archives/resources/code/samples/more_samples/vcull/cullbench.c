@@ -0,0 +1,175 @@
+/*
+ *  cullbench.c
+ *
+ *  Headless benchmark for frustcull: culls a field of random boxes
+ *  against a turning camera and compares against testing every box.
+ *
+ *  Usage: cullbench [instances] [frames]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "frustcull.h"
+
+#if !defined(M_PI)
+#define M_PI 3.14159265
+#endif
+
+#define FIELD 1000.0f			/* boxes lie in [-FIELD, FIELD]^3 */
+
+
+static float
+frand(void)
+{
+  return (float) rand() / (float) RAND_MAX;
+}
+
+
+/* column-major glFrustum-style perspective */
+static void
+perspective(float m[16], float fovy, float aspect, float n, float f)
+{
+  float y = n * (float) tan(fovy * M_PI / 360.0);
+  float x = y * aspect;
+  int i;
+
+  for (i = 0; i < 16; i++)
+    m[i] = 0.0f;
+  m[0] = n / x;
+  m[5] = n / y;
+  m[10] = -(f + n) / (f - n);
+  m[11] = -1.0f;
+  m[14] = -2.0f * f * n / (f - n);
+}
+
+
+/* camera at the origin looking along angle a in the xz plane */
+static void
+view(float m[16], float a)
+{
+  float c = (float) cos(a), s = (float) sin(a);
+  int i;
+
+  for (i = 0; i < 16; i++)
+    m[i] = 0.0f;
+  m[0] = c;  m[8] = -s;
+  m[5] = 1.0f;
+  m[2] = s;  m[10] = c;
+  m[15] = 1.0f;
+}
+
+
+/* reference: test every box against every plane */
+static int
+cullAll(int n, const float *boxes, const float planes[6][4], int *visible)
+{
+  const float *b;
+  float cx, cy, cz, ex, ey, ez, d, r;
+  int i, p, count = 0;
+
+  for (i = 0; i < n; i++) {
+    b = boxes + 6 * i;
+    cx = (b[0] + b[3]) * 0.5f;  ex = (b[3] - b[0]) * 0.5f;
+    cy = (b[1] + b[4]) * 0.5f;  ey = (b[4] - b[1]) * 0.5f;
+    cz = (b[2] + b[5]) * 0.5f;  ez = (b[5] - b[2]) * 0.5f;
+    for (p = 0; p < 6; p++) {
+      d = planes[p][0]*cx + planes[p][1]*cy + planes[p][2]*cz + planes[p][3];
+      r = (float) (fabs(planes[p][0])*ex + fabs(planes[p][1])*ey +
+		   fabs(planes[p][2])*ez);
+      if (d < -r)
+	break;
+    }
+    if (p == 6)
+      visible[count++] = i;
+  }
+  return count;
+}
+
+
+static double
+seconds(clock_t start)
+{
+  return (double) (clock() - start) / CLOCKS_PER_SEC;
+}
+
+
+int
+main(int argc, char **argv)
+{
+  int n = argc > 1 ? atoi(argv[1]) : 1000000;
+  int frames = argc > 2 ? atoi(argv[2]) : 100;
+  float *boxes, proj[16], mv[16], planes[6][4], size;
+  int *visible, i, j, nvis = 0, nref = 0, mismatch = 0;
+  long tested = 0;
+  double tBuild, tRefit, tTree, tAll;
+  clock_t start;
+  FCtree *t;
+
+  boxes = (float *) malloc(n * 6 * sizeof(float));
+  visible = (int *) malloc((n + 1) * sizeof(int));
+  if (!boxes || !visible) {
+    fprintf(stderr, "cullbench: out of memory\n");
+    return 1;
+  }
+
+  srand(1);
+  for (i = 0; i < n; i++) {
+    size = 0.5f + 2.0f * frand();
+    for (j = 0; j < 3; j++) {
+      boxes[6*i + j] = (2.0f * frand() - 1.0f) * FIELD;
+      boxes[6*i + j + 3] = boxes[6*i + j] + size;
+    }
+  }
+
+  t = fcNew();
+  start = clock();
+  if (!fcBuild(t, n, boxes)) {
+    fprintf(stderr, "cullbench: out of memory\n");
+    return 1;
+  }
+  tBuild = seconds(start);
+
+  start = clock();
+  fcRefit(t, boxes);
+  tRefit = seconds(start);
+
+  perspective(proj, 60.0f, 1.0f, 1.0f, 2.0f * FIELD);
+
+  start = clock();
+  for (i = 0; i < frames; i++) {
+    view(mv, (float) (2.0 * M_PI * i / frames));
+    fcExtractPlanes(planes, proj, mv);
+    nvis = fcCull(t, planes, visible);
+    tested += fcNodesTested(t);
+  }
+  tTree = seconds(start);
+
+  start = clock();
+  for (i = 0; i < frames; i++) {
+    view(mv, (float) (2.0 * M_PI * i / frames));
+    fcExtractPlanes(planes, proj, mv);
+    nref = cullAll(n, boxes, planes, visible);
+  }
+  tAll = seconds(start);
+
+  /* last frame must agree with the reference */
+  if (fcCull(t, planes, visible) != nref)
+    mismatch = 1;
+
+  printf("%d instances, %d frames\n", n, frames);
+  printf("  build           %8.2f ms\n", tBuild * 1000.0);
+  printf("  refit           %8.2f ms\n", tRefit * 1000.0);
+  printf("  hierarchical    %8.3f ms/frame  (%ld tests/frame, %d visible)\n",
+	 tTree * 1000.0 / frames, tested / frames, nvis);
+  printf("  brute force     %8.3f ms/frame  (%d visible)\n",
+	 tAll * 1000.0 / frames, nref);
+  if (mismatch)
+    printf("  MISMATCH between hierarchical and brute force results\n");
+
+  fcDelete(t);
+  free(boxes);
+  free(visible);
+  return mismatch;
+}
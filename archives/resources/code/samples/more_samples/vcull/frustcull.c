@@ -0,0 +1,521 @@
+/*
+ *  frustcull.c
+ *
+ *  Hierarchical view-frustum culling, see frustcull.h.
+ *
+ *  Each node is tested against all still-undecided planes at once: the
+ *  planes are kept as four-wide columns (six planes padded to eight) so
+ *  the sphere and box distances for four planes come out of one set of
+ *  multiply-adds.  With SSE available this is done with intrinsics,
+ *  otherwise with plain loops the compiler can vectorize.
+ *
+ *  Two more tricks keep the work down:
+ *
+ *   - plane masking: a node that is fully inside a plane passes that
+ *     plane to its children, which never test it again.
+ *   - plane coherency: a node remembers which plane rejected it last
+ *     frame and tries that plane first.
+ */
+
+#include <stdlib.h>
+#include <math.h>
+#include "frustcull.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define FC_SSE
+#include <xmmintrin.h>
+#endif
+
+
+#define FC_LEAF_SIZE   4		/* max instances per leaf */
+#define FC_STACK_SIZE  64		/* traversal stack, depth ~log2(n) */
+#define FC_ALL_PLANES  0x3f
+
+
+/* bounds of one instance or node */
+typedef struct {
+  float center[3];			/* box center */
+  float extent[3];			/* box half size */
+  float sphere[4];			/* bounding sphere center, radius */
+} FCbound;
+
+typedef struct {
+  FCbound bound;
+  int first, count;			/* instance range in order[] */
+  int child;				/* left child (right = child+1), -1 leaf */
+  int lastPlane;			/* plane that rejected it last, or -1 */
+} FCnode;
+
+struct _FCtree {
+  int numInstances;
+  int *order;				/* instance index for each slot */
+  FCbound *inst;			/* instance bounds, in slot order */
+  float *key;				/* split keys used while building */
+
+  int numNodes;
+  FCnode *nodes;
+
+  int nodesTested;
+
+  /* planes as columns, padded to 8 with planes nothing is outside of */
+  float px[8], py[8], pz[8], pw[8];
+  float ax[8], ay[8], az[8];		/* absolute normals for box extents */
+};
+
+
+FCtree *
+fcNew(void)
+{
+  return (FCtree *) calloc(1, sizeof(FCtree));
+}
+
+
+void
+fcDelete(FCtree *t)
+{
+  if (!t)
+    return;
+  free(t->order);
+  free(t->inst);
+  free(t->key);
+  free(t->nodes);
+  free(t);
+}
+
+
+/* smallest sphere enclosing spheres a and b, into a */
+static void
+mergeSphere(float a[4], const float b[4])
+{
+  float d[3], dist, r;
+
+  d[0] = b[0] - a[0];
+  d[1] = b[1] - a[1];
+  d[2] = b[2] - a[2];
+  dist = (float) sqrt(d[0]*d[0] + d[1]*d[1] + d[2]*d[2]);
+
+  if (dist + b[3] <= a[3])
+    return;
+  if (dist + a[3] <= b[3]) {
+    a[0] = b[0]; a[1] = b[1]; a[2] = b[2]; a[3] = b[3];
+    return;
+  }
+
+  r = (dist + a[3] + b[3]) * 0.5f;
+  dist = (r - a[3]) / dist;
+  a[0] += d[0] * dist;
+  a[1] += d[1] * dist;
+  a[2] += d[2] * dist;
+  a[3] = r;
+}
+
+
+static void
+boxToBound(FCbound *b, const float *box)
+{
+  int i;
+
+  for (i = 0; i < 3; i++) {
+    b->center[i] = (box[i] + box[i+3]) * 0.5f;
+    b->extent[i] = (box[i+3] - box[i]) * 0.5f;
+    b->sphere[i] = b->center[i];
+  }
+  b->sphere[3] = (float) sqrt(b->extent[0]*b->extent[0] +
+			      b->extent[1]*b->extent[1] +
+			      b->extent[2]*b->extent[2]);
+}
+
+
+/* grow dst to enclose src */
+static void
+mergeBound(FCbound *dst, const FCbound *src, int first)
+{
+  float lo, hi;
+  int i;
+
+  if (first) {
+    *dst = *src;
+    return;
+  }
+
+  for (i = 0; i < 3; i++) {
+    lo = dst->center[i] - dst->extent[i];
+    hi = dst->center[i] + dst->extent[i];
+    if (src->center[i] - src->extent[i] < lo)
+      lo = src->center[i] - src->extent[i];
+    if (src->center[i] + src->extent[i] > hi)
+      hi = src->center[i] + src->extent[i];
+    dst->center[i] = (lo + hi) * 0.5f;
+    dst->extent[i] = (hi - lo) * 0.5f;
+  }
+  mergeSphere(dst->sphere, src->sphere);
+}
+
+
+/* partially sort slots [lo,hi) so slot k holds the median key */
+static void
+selectSlots(FCtree *t, int lo, int hi, int k)
+{
+  FCbound b;
+  float pivot, f;
+  int i, j, o;
+
+  while (hi - lo > 1) {
+    pivot = t->key[(lo + hi) / 2];
+    i = lo;
+    j = hi - 1;
+    while (i <= j) {
+      while (t->key[i] < pivot) i++;
+      while (t->key[j] > pivot) j--;
+      if (i <= j) {
+	f = t->key[i]; t->key[i] = t->key[j]; t->key[j] = f;
+	o = t->order[i]; t->order[i] = t->order[j]; t->order[j] = o;
+	b = t->inst[i]; t->inst[i] = t->inst[j]; t->inst[j] = b;
+	i++;
+	j--;
+      }
+    }
+    if (k <= j)
+      hi = j + 1;
+    else if (k >= i)
+      lo = i;
+    else
+      return;
+  }
+}
+
+
+static void
+buildNode(FCtree *t, int n, int first, int count)
+{
+  FCnode *node = &t->nodes[n];
+  float lo[3], hi[3], c;
+  int i, k, axis;
+
+  node->first = first;
+  node->count = count;
+  node->child = -1;
+  node->lastPlane = -1;
+
+  for (i = 0; i < count; i++)
+    mergeBound(&node->bound, &t->inst[first + i], i == 0);
+
+  if (count <= FC_LEAF_SIZE)
+    return;
+
+  /* split at the median center along the longest axis of the centers */
+  for (k = 0; k < 3; k++) {
+    lo[k] = hi[k] = t->inst[first].center[k];
+    for (i = 1; i < count; i++) {
+      c = t->inst[first + i].center[k];
+      if (c < lo[k]) lo[k] = c;
+      if (c > hi[k]) hi[k] = c;
+    }
+  }
+  axis = 0;
+  if (hi[1] - lo[1] > hi[axis] - lo[axis]) axis = 1;
+  if (hi[2] - lo[2] > hi[axis] - lo[axis]) axis = 2;
+
+  for (i = 0; i < count; i++)
+    t->key[first + i] = t->inst[first + i].center[axis];
+  selectSlots(t, first, first + count, first + count / 2);
+
+  node->child = t->numNodes;
+  t->numNodes += 2;
+  buildNode(t, node->child, first, count / 2);
+  buildNode(t, node->child + 1, first + count / 2, count - count / 2);
+}
+
+
+int
+fcBuild(FCtree *t, int n, const float *boxes)
+{
+  int i;
+
+  free(t->order);
+  free(t->inst);
+  free(t->key);
+  free(t->nodes);
+
+  t->numInstances = n;
+  t->numNodes = 0;
+  t->order = (int *) malloc((n + 1) * sizeof(int));
+  t->inst = (FCbound *) malloc((n + 1) * sizeof(FCbound));
+  t->key = (float *) malloc((n + 1) * sizeof(float));
+  t->nodes = (FCnode *) calloc(2 * n + 1, sizeof(FCnode));
+  if (!t->order || !t->inst || !t->key || !t->nodes) {
+    t->numInstances = 0;
+    return 0;
+  }
+
+  for (i = 0; i < n; i++) {
+    t->order[i] = i;
+    boxToBound(&t->inst[i], boxes + 6 * i);
+  }
+
+  if (n > 0) {
+    t->numNodes = 1;
+    buildNode(t, 0, 0, n);
+  }
+
+  /* keys are only needed while building */
+  free(t->key);
+  t->key = NULL;
+  return 1;
+}
+
+
+void
+fcRefit(FCtree *t, const float *boxes)
+{
+  FCnode *node;
+  int i, n;
+
+  for (i = 0; i < t->numInstances; i++)
+    boxToBound(&t->inst[i], boxes + 6 * t->order[i]);
+
+  /* children always come after their parent */
+  for (n = t->numNodes - 1; n >= 0; n--) {
+    node = &t->nodes[n];
+    if (node->child < 0) {
+      for (i = 0; i < node->count; i++)
+	mergeBound(&node->bound, &t->inst[node->first + i], i == 0);
+    } else {
+      node->bound = t->nodes[node->child].bound;
+      mergeBound(&node->bound, &t->nodes[node->child + 1].bound, 0);
+    }
+  }
+}
+
+
+void
+fcExtractPlanes(float planes[6][4],
+		const float projection[16], const float modelview[16])
+{
+  static const float identity[16] = {
+    1, 0, 0, 0,  0, 1, 0, 0,  0, 0, 1, 0,  0, 0, 0, 1
+  };
+  float m[16], len;
+  int i, j, k;
+
+  if (!projection) projection = identity;
+  if (!modelview) modelview = identity;
+
+  /* m = projection * modelview, column-major */
+  for (i = 0; i < 4; i++) {
+    for (j = 0; j < 4; j++) {
+      m[j*4 + i] = 0.0f;
+      for (k = 0; k < 4; k++)
+	m[j*4 + i] += projection[k*4 + i] * modelview[j*4 + k];
+    }
+  }
+
+  /* row 3 +/- rows 0, 1, 2: left, right, bottom, top, near, far */
+  for (i = 0; i < 6; i++) {
+    float s = (i & 1) ? -1.0f : 1.0f;
+    int row = i / 2;
+    for (j = 0; j < 4; j++)
+      planes[i][j] = m[j*4 + 3] + s * m[j*4 + row];
+    len = (float) sqrt(planes[i][0]*planes[i][0] +
+		       planes[i][1]*planes[i][1] +
+		       planes[i][2]*planes[i][2]);
+    if (len > 0.0f) {
+      for (j = 0; j < 4; j++)
+	planes[i][j] /= len;
+    }
+  }
+}
+
+
+static void
+loadPlanes(FCtree *t, const float planes[6][4])
+{
+  int i;
+
+  for (i = 0; i < 8; i++) {
+    if (i < 6) {
+      t->px[i] = planes[i][0];
+      t->py[i] = planes[i][1];
+      t->pz[i] = planes[i][2];
+      t->pw[i] = planes[i][3];
+    } else {
+      t->px[i] = t->py[i] = t->pz[i] = 0.0f;
+      t->pw[i] = 1.0e30f;
+    }
+    t->ax[i] = (float) fabs(t->px[i]);
+    t->ay[i] = (float) fabs(t->py[i]);
+    t->az[i] = (float) fabs(t->pz[i]);
+  }
+}
+
+
+/* Test b against one plane: -1 outside, 1 inside, 0 straddling */
+static int
+testPlane(const FCtree *t, const FCbound *b, int p)
+{
+  float d, r;
+
+  d = t->px[p]*b->sphere[0] + t->py[p]*b->sphere[1] +
+      t->pz[p]*b->sphere[2] + t->pw[p];
+  if (d < -b->sphere[3])
+    return -1;
+  if (d >= b->sphere[3])
+    return 1;
+
+  d = t->px[p]*b->center[0] + t->py[p]*b->center[1] +
+      t->pz[p]*b->center[2] + t->pw[p];
+  r = t->ax[p]*b->extent[0] + t->ay[p]*b->extent[1] + t->az[p]*b->extent[2];
+  if (d < -r)
+    return -1;
+  if (d >= r)
+    return 1;
+  return 0;
+}
+
+
+/* Test b against planes 4*g .. 4*g+3, setting bit i of *out / *in for
+ * each plane the bound is outside of / inside of.
+ */
+static void
+testPlanes4(const FCtree *t, const FCbound *b, int g, int *out, int *in)
+{
+#ifdef FC_SSE
+  __m128 d, r, e;
+  int o = 4 * g;
+
+  /* sphere */
+  d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(t->px + o),
+				       _mm_set1_ps(b->sphere[0])),
+			    _mm_mul_ps(_mm_loadu_ps(t->py + o),
+				       _mm_set1_ps(b->sphere[1]))),
+		 _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(t->pz + o),
+				       _mm_set1_ps(b->sphere[2])),
+			    _mm_loadu_ps(t->pw + o)));
+  r = _mm_set1_ps(b->sphere[3]);
+  *out = _mm_movemask_ps(_mm_cmplt_ps(d, _mm_sub_ps(_mm_setzero_ps(), r)));
+  *in = _mm_movemask_ps(_mm_cmpge_ps(d, r));
+
+  /* box */
+  d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(t->px + o),
+				       _mm_set1_ps(b->center[0])),
+			    _mm_mul_ps(_mm_loadu_ps(t->py + o),
+				       _mm_set1_ps(b->center[1]))),
+		 _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(t->pz + o),
+				       _mm_set1_ps(b->center[2])),
+			    _mm_loadu_ps(t->pw + o)));
+  e = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(t->ax + o),
+				       _mm_set1_ps(b->extent[0])),
+			    _mm_mul_ps(_mm_loadu_ps(t->ay + o),
+				       _mm_set1_ps(b->extent[1]))),
+		 _mm_mul_ps(_mm_loadu_ps(t->az + o),
+			    _mm_set1_ps(b->extent[2])));
+  *out |= _mm_movemask_ps(_mm_cmplt_ps(d, _mm_sub_ps(_mm_setzero_ps(), e)));
+  *in |= _mm_movemask_ps(_mm_cmpge_ps(d, e));
+#else
+  float ds[4], db[4], e[4];
+  int i, o = 4 * g;
+
+  for (i = 0; i < 4; i++) {
+    ds[i] = t->px[o+i]*b->sphere[0] + t->py[o+i]*b->sphere[1] +
+	    t->pz[o+i]*b->sphere[2] + t->pw[o+i];
+    db[i] = t->px[o+i]*b->center[0] + t->py[o+i]*b->center[1] +
+	    t->pz[o+i]*b->center[2] + t->pw[o+i];
+    e[i] = t->ax[o+i]*b->extent[0] + t->ay[o+i]*b->extent[1] +
+	   t->az[o+i]*b->extent[2];
+  }
+  *out = *in = 0;
+  for (i = 0; i < 4; i++) {
+    *out |= (ds[i] < -b->sphere[3] || db[i] < -e[i]) << i;
+    *in |= (ds[i] >= b->sphere[3] || db[i] >= e[i]) << i;
+  }
+#endif
+}
+
+
+/* Returns the planes b still straddles out of mask, or -1 if b is
+ * outside.  *rejected gets the plane that culled it.
+ */
+static int
+testBound(FCtree *t, const FCbound *b, int mask, int hint, int *rejected)
+{
+  int out0, in0, out1, in1, out;
+
+  t->nodesTested++;
+
+  if (hint >= 0 && (mask & (1 << hint)) && testPlane(t, b, hint) < 0) {
+    *rejected = hint;
+    return -1;
+  }
+
+  testPlanes4(t, b, 0, &out0, &in0);
+  testPlanes4(t, b, 1, &out1, &in1);
+  out = (out0 | (out1 << 4)) & mask;
+  if (out) {
+    for (*rejected = 0; !(out & (1 << *rejected)); (*rejected)++)
+      ;
+    return -1;
+  }
+  return mask & ~(in0 | (in1 << 4));
+}
+
+
+int
+fcCull(FCtree *t, const float planes[6][4], int *visible)
+{
+  int stack[FC_STACK_SIZE][2];
+  int sp, n, mask, m, i, rejected, count = 0;
+  FCnode *node;
+
+  t->nodesTested = 0;
+  if (t->numNodes == 0)
+    return 0;
+
+  loadPlanes(t, planes);
+
+  sp = 0;
+  stack[sp][0] = 0;
+  stack[sp][1] = FC_ALL_PLANES;
+  sp++;
+
+  while (sp > 0) {
+    sp--;
+    n = stack[sp][0];
+    mask = stack[sp][1];
+    node = &t->nodes[n];
+
+    mask = testBound(t, &node->bound, mask, node->lastPlane, &rejected);
+    if (mask < 0) {
+      node->lastPlane = rejected;
+      continue;
+    }
+    node->lastPlane = -1;
+
+    if (mask == 0) {
+      /* whole subtree inside */
+      for (i = 0; i < node->count; i++)
+	visible[count++] = t->order[node->first + i];
+    } else if (node->child < 0) {
+      for (i = 0; i < node->count; i++) {
+	m = testBound(t, &t->inst[node->first + i], mask, -1, &rejected);
+	if (m >= 0)
+	  visible[count++] = t->order[node->first + i];
+      }
+    } else {
+      stack[sp][0] = node->child + 1;
+      stack[sp][1] = mask;
+      sp++;
+      stack[sp][0] = node->child;
+      stack[sp][1] = mask;
+      sp++;
+    }
+  }
+
+  return count;
+}
+
+
+int
+fcNodesTested(const FCtree *t)
+{
+  return t->nodesTested;
+}
@@ -0,0 +1,70 @@
+/*
+ *  frustcull.h
+ *
+ *  Hierarchical view-frustum culling of many instances.
+ *
+ *  Instances are given as axis-aligned boxes.  fcBuild() sorts them into
+ *  a bounding volume hierarchy whose nodes carry both a box and a
+ *  sphere; fcCull() walks it against the six frustum planes and returns
+ *  the indices of the instances that may be visible.
+ *
+ *  Basic usage:
+ *
+ *     FCtree *t = fcNew();
+ *     fcBuild(t, n, boxes);                  6 floats per instance
+ *     ...
+ *     fcExtractPlanes(planes, projection, modelview);
+ *     nvis = fcCull(t, planes, visible);     visible holds >= n ints
+ *
+ *  Moving instances can be updated with fcRefit(), which keeps the
+ *  tree shape and only recomputes the bounds.
+ */
+
+#ifndef FRUSTCULL_H
+#define FRUSTCULL_H
+
+
+typedef struct _FCtree FCtree;
+
+
+/* Box layout used by fcBuild() and fcRefit() */
+#define FC_MINX 0
+#define FC_MINY 1
+#define FC_MINZ 2
+#define FC_MAXX 3
+#define FC_MAXY 4
+#define FC_MAXZ 5
+
+
+extern FCtree *fcNew(void);
+
+extern void fcDelete(FCtree *t);
+
+/* Build the hierarchy over n boxes (6 floats each).  Returns 0 if out of
+ * memory.
+ */
+extern int fcBuild(FCtree *t, int n, const float *boxes);
+
+/* Recompute bounds after instances moved; n and order must match the
+ * last fcBuild().
+ */
+extern void fcRefit(FCtree *t, const float *boxes);
+
+/* Planes of the frustum (ax + by + cz + d >= 0 inside) of the combined
+ * column-major OpenGL matrices, in the space the boxes are given in.
+ * Either matrix may be NULL for identity.
+ */
+extern void fcExtractPlanes(float planes[6][4],
+			    const float projection[16],
+			    const float modelview[16]);
+
+/* Write the indices of the potentially visible instances into visible
+ * (in tree order) and return their count.
+ */
+extern int fcCull(FCtree *t, const float planes[6][4], int *visible);
+
+/* Number of node tests done by the last fcCull() */
+extern int fcNodesTested(const FCtree *t);
+
+
+#endif /* FRUSTCULL_H */
@@ -3,7 +3,23 @@
 /* Generated Using Randomly Selected Vertices */
 /* And Bisection                              */
 
+/* The points are made once, by gasketgen.c, and drawn from one vertex
+   array; how many is the first argument, 5000 if there isn't one */
+
+#include <stdio.h>
+#include <stdlib.h>
 #include <GL/glut.h>
+#include "gasketgen.h"
+
+/* define a point data type */
+
+typedef GLfloat point2[2];
+
+point2 vertices[3]={{0.0,0.0},{250.0,500.0},{500.0,0.0}}; /* A triangle */
+point2 start={75.0,50.0};  /* An arbitrary initial point inside traingle */
+
+long npoints = 5000;
+GLfloat *points;  /* npoints x, y pairs */
 
 void myinit(void)
 {
@@ -24,45 +40,41 @@ void myinit(void)
 
 void display( void )
 {
-
-/* define a point data type */
-
-    typedef GLfloat point2[2];     
-
-    point2 vertices[3]={{0.0,0.0},{250.0,500.0},{500.0,0.0}}; /* A triangle */
-
-    int i, j, k;
-    int rand();       /* standard random number generator */
-    point2 p ={75.0,50.0};  /* An arbitrary initial point inside traingle */
-
     glClear(GL_COLOR_BUFFER_BIT);  /*clear the window */
 
+/* plot all the points at once */
 
-/* compute and plots 5000 new points */
-
-    for( k=0; k<5000; k++)
-    {
-         j=rand()%3; /* pick a vertex at random */
-
-
-     /* Compute point halfway between selected vertex and old point */
+    glVertexPointer(2, GL_FLOAT, 0, points);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glDrawArrays(GL_POINTS, 0, npoints);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glFlush(); /* clear buffers */
+ }
 
-         p[0] = (p[0]+vertices[j][0])/2.0; 
-         p[1] = (p[1]+vertices[j][1])/2.0;
-   
-     /* plot new point */
+/* compute the points: each halfway between a vertex picked at random
+   and the point before */
 
-          glBegin(GL_POINTS);
-               glVertex2fv(p); 
-          glEnd();
-   
-     }
-     glFlush(); /* clear buffers */
- }
+void makepoints(void)
+{
+    Gasket *g;
+
+    g = gasketNew();
+    points = (GLfloat *) malloc(npoints * sizeof(point2));
+    if (!g || !points) {
+        fprintf(stderr, "gasket: out of memory\n");
+        exit(1);
+    }
+    gasketChaos(g, &vertices[0][0], 3, 2, start, npoints, 1, points);
+    gasketDelete(g);
+}
 
 void main(int argc, char** argv)
 {
 
+    if (argc > 1 && atol(argv[1]) > 0)
+        npoints = atol(argv[1]);
+    makepoints();
+
 /* Standard GLUT initialization */
 
     glutInit(&argc,argv);
@@ -1,7 +1,17 @@
 
 /* Recursive subdivision of triangle to form Sierpinski gasket */
 
+/* The triangles are made by gasketgen.c, in the order the recursion
+   used to draw them, straight into one vertex array, and only made
+   again when the depth changes: + and - change it, from the first
+   argument or 4, up to MAXDEPTH */
+
+#include <stdio.h>
+#include <stdlib.h>
 #include <GL/glut.h>
+#include "gasketgen.h"
+
+#define MAXDEPTH 16     /* 3^16 triangles is a gigabyte */
 
 typedef float point2[2];
 
@@ -9,36 +19,28 @@ typedef float point2[2];
 
 point2 v[]={{-1.0, -0.58}, {1.0, -0.58}, {0.0, 1.15}};
 
-int n;
+int n = 4;
 
-void triangle( point2 a, point2 b, point2 c)
+Gasket *gasket;
+GLfloat *triangles;   /* 3^n triangles of 3 x, y pairs */
+long ntriangles;
 
-/* display one triangle  */
-{
-    glBegin(GL_TRIANGLES);
-       glVertex2fv(a);
-       glVertex2fv(b);
-       glVertex2fv(c);
-    glEnd();
-}
+/* make the gasket m deep into triangles; 0 if there isn't room */
 
-void divide_triangle(point2 a, point2 b, point2 c, int m)
+int make_triangles(int m)
 {
-
-/* triangle subdivision using vertex numbers */
-
-    point2 v0, v1, v2;
-    int j;
-    if(m>0) 
-    {
-        for(j=0; j<2; j++) v0[j]=(a[j]+b[j])/2;
-        for(j=0; j<2; j++) v1[j]=(a[j]+c[j])/2;
-        for(j=0; j<2; j++) v2[j]=(b[j]+c[j])/2;
-        divide_triangle(a, v0, v1, m-1);
-        divide_triangle(c, v1, v2, m-1);
-        divide_triangle(b, v2, v0, m-1);
-    }
-    else(triangle(a,b,c)); /* draw triangle at end of recursion */
+    GLfloat *t;
+
+    if (m < 0 || m > MAXDEPTH)
+        return 0;
+    t = (GLfloat *) realloc(triangles, gasketTriangles(m) * 6 * sizeof(GLfloat));
+    if (!t)
+        return 0;
+    triangles = t;
+    ntriangles = gasketTriangles(m);
+    gasketDivide(gasket, v[0], v[1], v[2], m, triangles);
+    n = m;
+    return 1;
 }
 
 
@@ -47,10 +49,35 @@ void display(void)
 
 
     glClear(GL_COLOR_BUFFER_BIT);
-	divide_triangle(v[0], v[1], v[2], n);
+    glVertexPointer(2, GL_FLOAT, 0, triangles);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glDrawArrays(GL_TRIANGLES, 0, 3 * ntriangles);
+    glDisableClientState(GL_VERTEX_ARRAY);
     glFlush();
 }
 
+void keyboard(unsigned char key, int x, int y)
+{
+    (void) x;
+    (void) y;
+    switch (key) {
+    case '+':
+    case '=':
+        if (n >= MAXDEPTH)
+            fprintf(stderr, "gasket2: %d is as deep as it goes\n", n);
+        else if (!make_triangles(n + 1))
+            fprintf(stderr, "gasket2: no room for depth %d\n", n + 1);
+        break;
+    case '-':
+        make_triangles(n - 1);
+        break;
+    case 'q':
+    case 27:
+        exit(0);
+    }
+    glutPostRedisplay();
+}
+
 void myinit()
 {
 
@@ -65,12 +92,20 @@ void myinit()
 void
 main(int argc, char **argv)
 {
-    n=atoi(argv[1]);
+    if (argc > 1) n=atoi(argv[1]);
+    if (n < 0) n = 0;
+    if (n > MAXDEPTH) n = MAXDEPTH;
+    gasket = gasketNew();
+    if (!gasket || !make_triangles(n)) {
+        fprintf(stderr, "gasket2: out of memory\n");
+        exit(1);
+    }
     glutInit(&argc, argv);
     glutInitDisplayMode(GLUT_SINGLE | GLUT_RGB );
     glutInitWindowSize(500, 500);
     glutCreateWindow("3D Gasket");
     glutDisplayFunc(display);
+    glutKeyboardFunc(keyboard);
 	myinit();
     glutMainLoop();
 }
@@ -11,10 +11,17 @@ Continue with this point as the new starting point. */
 /* This program illustrates simple use of mouse with OpenGL
 to start and stop program execution */
 
+/* Each idle call makes BATCH points with gasketgen.c, carrying on from
+the last one, and draws them from vertex and color arrays */
+
+#include <stdlib.h>
 #include <GL/gl.h>
 #include <GL/glu.h>
 #include <GL/glx.h>
 #include <GL/glut.h>
+#include "gasketgen.h"
+
+#define BATCH 1000
 
 /* define a point data type */
 
@@ -22,8 +29,12 @@ typedef struct { float x,y,z;} point;
 
 point vertices[4]={{0,0,0},{250,500,100},{500,250,250},{250,100,250}}; /* A tetrahedron */
 
-int j;
-point new, old={250,100,250}; 
+point old={250,100,250}; 
+
+Gasket *gasket;
+unsigned long batches;
+point new[BATCH];
+float color[BATCH][3];
 
 void clear(void)
 {
@@ -32,34 +43,34 @@ void clear(void)
 
 void display(void)
 
-/* computes and plots a single new point */
+/* computes and plots BATCH new points */
 
 {
-	long random();
 	int i;
-	j=random()%4; /* pick a vertex at random */
 
+/* each point halfway between a vertex picked at random and the one before */
 
-/* Compute point halfway between vertex and old point */
+	gasketChaos(gasket, &vertices[0].x, 4, 3, &old.x, BATCH, batches++,
+		&new[0].x);
+	for (i = 0; i < BATCH; i++) {
+		color[i][0] = 1.0-new[i].z/250.;
+		color[i][1] = new[i].z/250.;
+		color[i][2] = 0.;
+	}
 
-	new.x = (old.x+vertices[j].x)/2; 
-	new.y = (old.y+vertices[j].y)/2;
-	new.z = (old.z+vertices[j].z)/2;
-	
-/* plot point */
+/* plot points */
 
-	glBegin(GL_POINTS);
-		glColor3f(1.0-new.z/250.,new.z/250.,0.);
-		glVertex3f(new.x, new.y,new.z);
-	glEnd();
+	glVertexPointer(3, GL_FLOAT, 0, new);
+	glColorPointer(3, GL_FLOAT, 0, color);
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_COLOR_ARRAY);
+	glDrawArrays(GL_POINTS, 0, BATCH);
+	glDisableClientState(GL_VERTEX_ARRAY);
+	glDisableClientState(GL_COLOR_ARRAY);
 
+/* replace old point by the last new one */
 
-/* replace old point by new */
-
-	old.x=new.x;
-	old.y=new.y;
-	old.z=new.z;
-	
+	old=new[BATCH-1];
 
 	glFlush();
 }
@@ -69,12 +80,13 @@ void mouse(int btn, int state, int x, int y)
 {
 if(btn==GLUT_LEFT_BUTTON&state==GLUT_DOWN)  glutIdleFunc(display);
 if(btn==GLUT_MIDDLE_BUTTON&state==GLUT_DOWN)   glutIdleFunc(NULL);
-if(btn==GLUT_RIGHT_BUTTON&state==GLUT_DOWN)   exit();
+if(btn==GLUT_RIGHT_BUTTON&state==GLUT_DOWN)   exit(0);
 }
 
 int main(int argc, char** argv)
 {
-
+	gasket = gasketNew();
+	if (!gasket) exit(1);
 
 	glutInit(&argc,argv);
 	glutInitDisplayMode (GLUT_SINGLE | GLUT_RGB);
@@ -0,0 +1,407 @@
+
+/* Times gasketgen.c without a window against the loops gasket.c and
+   gasket2.c had */
+
+/* For each depth: ms to make the gasket the recursive way, into an
+   array, then with gasketDivide() on one thread and on all of them,
+   counting the floats that differ from the recursive ones.  Then ms a
+   million points of the chaos game with rand() one at a time and with
+   gasketChaos(), and whether one thread and all of them agree.
+
+   Built with -DGK_EGL (and -lEGL -lGL) it also times drawing, in a
+   500 x 500 pbuffer with no display: the recursion calling glVertex
+   for every vertex as gasket2.c did, against the array in one
+   glDrawArrays, from memory and from a buffer object; then points,
+   glBegin and glEnd around each as gasket.c had them, against one
+   glDrawArrays.  Each time is over at least a quarter of a second,
+   generating after one untimed run.
+
+   usage: gasketbench [threads [depth]] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gasketgen.h"
+
+#ifdef GK_EGL
+#define GL_GLEXT_PROTOTYPES
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <GL/gl.h>
+#include <GL/glext.h>
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+typedef int timer;
+#define getTime(a)      (a = GetTickCount())
+#define timeDiff(a, b)  ((b - a) * 1000)
+#else
+#include <sys/time.h>
+typedef struct timeval timer;
+#define getTime(a)      gettimeofday(&a, NULL)
+#define timeDiff(a, b)  (((b.tv_sec - a.tv_sec) * 1000000) + b.tv_usec - a.tv_usec)
+#endif
+
+typedef float point2[2];
+
+point2 v[] = {{-1.0, -0.58}, {1.0, -0.58}, {0.0, 1.15}};
+point2 vertices[3] = {{0.0, 0.0}, {250.0, 500.0}, {500.0, 0.0}};
+point2 start = {75.0, 50.0};
+
+int depths[] = { 6, 10, 13, 16 };
+
+#define POINTS 1000000
+
+/* The old way: gasket2.c's recursion, putting triangles in out */
+
+float *out;
+
+void triangle(point2 a, point2 b, point2 c)
+{
+    out[0] = a[0];
+    out[1] = a[1];
+    out[2] = b[0];
+    out[3] = b[1];
+    out[4] = c[0];
+    out[5] = c[1];
+    out += 6;
+}
+
+void divide_triangle(point2 a, point2 b, point2 c, int m)
+{
+    point2 v0, v1, v2;
+    int j;
+    if(m>0)
+    {
+        for(j=0; j<2; j++) v0[j]=(a[j]+b[j])/2;
+        for(j=0; j<2; j++) v1[j]=(a[j]+c[j])/2;
+        for(j=0; j<2; j++) v2[j]=(b[j]+c[j])/2;
+        divide_triangle(a, v0, v1, m-1);
+        divide_triangle(c, v1, v2, m-1);
+        divide_triangle(b, v2, v0, m-1);
+    }
+    else(triangle(a,b,c));
+}
+
+/* and gasket.c's loop */
+
+void chaos(long n, float *xy)
+{
+    point2 p;
+    long k;
+    int j;
+
+    p[0] = start[0];
+    p[1] = start[1];
+    for (k = 0; k < n; k++) {
+        j = rand() % 3;
+        p[0] = (p[0] + vertices[j][0]) / 2.0;
+        p[1] = (p[1] + vertices[j][1]) / 2.0;
+        *xy++ = p[0];
+        *xy++ = p[1];
+    }
+}
+
+#ifdef GK_EGL
+
+/* A GL context with no display; 0 if there isn't one to be had */
+
+int glStart(void)
+{
+    EGLint config[] = { EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+                        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+                        EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8,
+                        EGL_BLUE_SIZE, 8, EGL_NONE };
+    EGLint size[] = { EGL_WIDTH, 500, EGL_HEIGHT, 500, EGL_NONE };
+    PFNEGLGETPLATFORMDISPLAYEXTPROC platform;
+    EGLDisplay dpy;
+    EGLConfig cfg;
+    EGLSurface surface;
+    EGLContext ctx;
+    EGLint major, minor, n;
+
+    platform = (PFNEGLGETPLATFORMDISPLAYEXTPROC)
+        eglGetProcAddress("eglGetPlatformDisplayEXT");
+#ifdef EGL_PLATFORM_SURFACELESS_MESA
+    if (platform)
+        dpy = platform(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY,
+                       NULL);
+    else
+#endif
+        dpy = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    if (dpy == EGL_NO_DISPLAY || !eglInitialize(dpy, &major, &minor))
+        return 0;
+    if (!eglBindAPI(EGL_OPENGL_API) ||
+        !eglChooseConfig(dpy, config, &cfg, 1, &n) || n < 1)
+        return 0;
+    surface = eglCreatePbufferSurface(dpy, cfg, size);
+    ctx = eglCreateContext(dpy, cfg, EGL_NO_CONTEXT, NULL);
+    if (surface == EGL_NO_SURFACE || ctx == EGL_NO_CONTEXT ||
+        !eglMakeCurrent(dpy, surface, surface, ctx))
+        return 0;
+
+    glViewport(0, 0, 500, 500);
+    glClearColor(1.0, 1.0, 1.0, 1.0);
+    glColor3f(0.0, 0.0, 0.0);
+    return 1;
+}
+
+/* ms a frame of the gasket depth deep, drawn how says, from xy */
+
+#define RECURSE 0
+#define ARRAY   1
+#define BUFFER  2
+
+void recurse(point2 a, point2 b, point2 c, int m)
+{
+    point2 v0, v1, v2;
+    int j;
+    if(m>0)
+    {
+        for(j=0; j<2; j++) v0[j]=(a[j]+b[j])/2;
+        for(j=0; j<2; j++) v1[j]=(a[j]+c[j])/2;
+        for(j=0; j<2; j++) v2[j]=(b[j]+c[j])/2;
+        recurse(a, v0, v1, m-1);
+        recurse(c, v1, v2, m-1);
+        recurse(b, v2, v0, m-1);
+    }
+    else
+    {
+        glBegin(GL_TRIANGLES);
+           glVertex2fv(a);
+           glVertex2fv(b);
+           glVertex2fv(c);
+        glEnd();
+    }
+}
+
+double drawTriangles(int depth, float *xy, int how)
+{
+    long triangles = gasketTriangles(depth), n = 0, usec;
+    GLuint buffer = 0;
+    timer t0, t1;
+
+    glMatrixMode(GL_PROJECTION);
+    glLoadIdentity();
+    glOrtho(-2.0, 2.0, -2.0, 2.0, -1.0, 1.0);
+    glMatrixMode(GL_MODELVIEW);
+    if (how == BUFFER) {
+        glGenBuffers(1, &buffer);
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        glBufferData(GL_ARRAY_BUFFER, triangles * 6 * sizeof(float), xy,
+                     GL_STATIC_DRAW);
+        glVertexPointer(2, GL_FLOAT, 0, NULL);
+    } else
+        glVertexPointer(2, GL_FLOAT, 0, xy);
+
+    getTime(t0);
+    do {
+        glClear(GL_COLOR_BUFFER_BIT);
+        if (how == RECURSE)
+            recurse(v[0], v[1], v[2], depth);
+        else {
+            glEnableClientState(GL_VERTEX_ARRAY);
+            glDrawArrays(GL_TRIANGLES, 0, 3 * triangles);
+            glDisableClientState(GL_VERTEX_ARRAY);
+        }
+        glFinish();
+        n++;
+        getTime(t1);
+        usec = timeDiff(t0, t1);
+    } while (usec < 250000);
+
+    if (how == BUFFER) {
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glDeleteBuffers(1, &buffer);
+    }
+    return usec / 1000.0 / n;
+}
+
+/* ms a frame of npoints points, one glBegin each or all at once */
+
+double drawPoints(long npoints, float *xy, int how)
+{
+    long n = 0, usec, k;
+    timer t0, t1;
+
+    glMatrixMode(GL_PROJECTION);
+    glLoadIdentity();
+    glOrtho(0.0, 500.0, 0.0, 500.0, -1.0, 1.0);
+    glMatrixMode(GL_MODELVIEW);
+    glVertexPointer(2, GL_FLOAT, 0, xy);
+
+    getTime(t0);
+    do {
+        glClear(GL_COLOR_BUFFER_BIT);
+        if (how == RECURSE)
+            for (k = 0; k < npoints; k++) {
+                glBegin(GL_POINTS);
+                    glVertex2fv(xy + 2 * k);
+                glEnd();
+            }
+        else {
+            glEnableClientState(GL_VERTEX_ARRAY);
+            glDrawArrays(GL_POINTS, 0, npoints);
+            glDisableClientState(GL_VERTEX_ARRAY);
+        }
+        glFinish();
+        n++;
+        getTime(t1);
+        usec = timeDiff(t0, t1);
+    } while (usec < 250000);
+    return usec / 1000.0 / n;
+}
+
+#endif
+
+/* ms to make the gasket depth deep into xy with g (NULL: recursing) */
+
+double divide(Gasket *g, int depth, float *xy)
+{
+    long n = 0, usec;
+    timer t0, t1;
+
+    do {
+        if (g)
+            gasketDivide(g, v[0], v[1], v[2], depth, xy);
+        else {
+            out = xy;
+            divide_triangle(v[0], v[1], v[2], depth);
+        }
+        if (n++ == 0)
+            getTime(t0);    /* the first one, page faults and all, untimed */
+        getTime(t1);
+        usec = timeDiff(t0, t1);
+    } while (n < 2 || usec < 250000);
+    n--;
+    return usec / 1000.0 / n;
+}
+
+/* ms for POINTS points into xy with g (NULL: rand()) */
+
+double points(Gasket *g, float *xy)
+{
+    long n = 0, usec;
+    timer t0, t1;
+
+    do {
+        if (g)
+            gasketChaos(g, &vertices[0][0], 3, 2, start, POINTS, 1, xy);
+        else
+            chaos(POINTS, xy);
+        if (n++ == 0)
+            getTime(t0);
+        getTime(t1);
+        usec = timeDiff(t0, t1);
+    } while (n < 2 || usec < 250000);
+    n--;
+    return usec / 1000.0 / n;
+}
+
+int main(int argc, char *argv[])
+{
+    int threads = argc > 1 ? atoi(argv[1]) : 0;
+    int most = argc > 2 ? atoi(argv[2]) : GASKET_MAXDEPTH, d, depth, gl = 0;
+    long triangles, k, wrong;
+    double told, t1, tall;
+    float *old, *xy;
+    Gasket *g1, *g;
+
+    g1 = gasketNew();
+    g = gasketNew();
+    if (!g1 || !g) {
+        fprintf(stderr, "gasketbench: out of memory\n");
+        return 1;
+    }
+    gasketThreads(g1, 1);
+    if (threads > 0)
+        gasketThreads(g, threads);
+
+    printf("%-6s %10s %9s %9s %9s %6s\n", "depth", "triangles", "old ms",
+           "1 thr ms", "all ms", "wrong");
+    for (d = 0; d < (int) (sizeof(depths) / sizeof(depths[0])); d++) {
+        depth = depths[d];
+        if (depth > most)
+            break;
+        triangles = gasketTriangles(depth);
+        old = (float *) malloc(triangles * 6 * sizeof(float));
+        xy = (float *) malloc(triangles * 6 * sizeof(float));
+        if (!old || !xy) {
+            fprintf(stderr, "gasketbench: out of memory\n");
+            return 1;
+        }
+        told = divide(NULL, depth, old);
+        t1 = divide(g1, depth, xy);
+        tall = divide(g, depth, xy);
+        wrong = 0;
+        for (k = 0; k < triangles * 6; k++)
+            wrong += memcmp(&old[k], &xy[k], sizeof(float)) != 0;
+        printf("%-6d %10ld %9.2f %9.2f %9.2f %6ld\n", depth, triangles,
+               told, t1, tall, wrong);
+        free(old);
+        free(xy);
+    }
+
+    old = (float *) malloc(POINTS * 2 * sizeof(float));
+    xy = (float *) malloc(POINTS * 2 * sizeof(float));
+    if (!old || !xy) {
+        fprintf(stderr, "gasketbench: out of memory\n");
+        return 1;
+    }
+    told = points(NULL, old);
+    t1 = points(g1, old);
+    tall = points(g, xy);
+    wrong = memcmp(old, xy, POINTS * 2 * sizeof(float)) != 0;
+    printf("\n%-16s %9s %9s %9s %6s\n", "", "old ms", "1 thr ms", "all ms",
+           "differ");
+    printf("%-16s %9.2f %9.2f %9.2f %6s\n", "1000000 points", told, t1,
+           tall, wrong ? "yes" : "no");
+    free(old);
+    free(xy);
+
+#ifdef GK_EGL
+    gl = glStart();
+    if (!gl)
+        printf("\nno GL context, drawing not timed\n");
+    else {
+        printf("\n%s\n%-6s %10s %9s %9s %9s\n", glGetString(GL_RENDERER),
+               "depth", "triangles", "old ms", "array ms", "buffer ms");
+        for (d = 0; d < (int) (sizeof(depths) / sizeof(depths[0])); d++) {
+            depth = depths[d];
+            if (depth > most)
+                break;
+            triangles = gasketTriangles(depth);
+            xy = (float *) malloc(triangles * 6 * sizeof(float));
+            if (!xy) {
+                fprintf(stderr, "gasketbench: out of memory\n");
+                return 1;
+            }
+            gasketDivide(g, v[0], v[1], v[2], depth, xy);
+            told = drawTriangles(depth, xy, RECURSE);
+            t1 = drawTriangles(depth, xy, ARRAY);
+            tall = drawTriangles(depth, xy, BUFFER);
+            printf("%-6d %10ld %9.2f %9.2f %9.2f\n", depth, triangles,
+                   told, t1, tall);
+            free(xy);
+        }
+
+        xy = (float *) malloc(POINTS * 2 * sizeof(float));
+        if (!xy) {
+            fprintf(stderr, "gasketbench: out of memory\n");
+            return 1;
+        }
+        gasketChaos(g, &vertices[0][0], 3, 2, start, POINTS, 1, xy);
+        printf("\n%-16s %9s %9s\n", "", "old ms", "array ms");
+        for (k = 5000; k <= POINTS; k *= 200)
+            printf("%7ld points   %9.2f %9.2f\n", k,
+                   drawPoints(k, xy, RECURSE), drawPoints(k, xy, ARRAY));
+        free(xy);
+    }
+#endif
+    (void) gl;
+
+    gasketDelete(g1);
+    gasketDelete(g);
+    return 0;
+}
@@ -0,0 +1,284 @@
+
+/* Sierpinski gasket generator, see gasketgen.h */
+
+/* divide_triangle(a, b, c, m) drew, for m > 0, the gaskets on
+   (a, ab, ac), (c, ac, bc) and (b, bc, ab), the two letter points being
+   midpoints, so triangle t of a gasket depth deep is found by taking
+   child 0, 1 or 2 at each level as t's base 3 digits say, the top digit
+   first.  Midpoints are (p + q) / 2 in floats as divide_triangle() did
+   them, so the triangles are the same to the bit.
+
+   The work is handed out in tiles, runs of GK_TILE triangles or
+   GK_GAMES games, by sig99's worker pool as in mandel.c. */
+
+#include <stdlib.h>
+#include <string.h>
+#include "gasketgen.h"
+#include "../../../sig99/adv99/util/pool.h"
+
+#define GK_TILE  19683      /* triangles handed out at once, 3^9 */
+#define GK_GAMES 4          /* chaos games handed out at once */
+
+#define GK_DIVIDE 0
+#define GK_CHAOS  1
+
+struct _Gasket {
+    int kind;               /* of the job in hand */
+    int units;              /* tiles in the job */
+
+    float abc[3][2];        /* gasketDivide()'s */
+    int depth;
+    float *xy;
+
+    float *vertices, *start, *out;  /* gasketChaos()'s */
+    int nv, dims;
+    long n;
+    unsigned long seed;
+
+    int threads;
+    pool_t *pool;
+};
+
+/* Child k of triangle p */
+
+static void child(float p[3][2], int k, float c[3][2])
+{
+    int j;
+
+    for (j = 0; j < 2; j++)
+        switch (k) {
+        case 0:
+            c[0][j] = p[0][j];
+            c[1][j] = (p[0][j] + p[1][j]) / 2;
+            c[2][j] = (p[0][j] + p[2][j]) / 2;
+            break;
+        case 1:
+            c[0][j] = p[2][j];
+            c[1][j] = (p[0][j] + p[2][j]) / 2;
+            c[2][j] = (p[1][j] + p[2][j]) / 2;
+            break;
+        default:
+            c[0][j] = p[1][j];
+            c[1][j] = (p[1][j] + p[2][j]) / 2;
+            c[2][j] = (p[0][j] + p[1][j]) / 2;
+            break;
+        }
+}
+
+/* The 3 children of p into xy, midpoints worked out once for all */
+
+static void family(float p[3][2], float *xy)
+{
+    float ab[2], ac[2], bc[2];
+    int j;
+
+    for (j = 0; j < 2; j++) {
+        ab[j] = (p[0][j] + p[1][j]) / 2;
+        ac[j] = (p[0][j] + p[2][j]) / 2;
+        bc[j] = (p[1][j] + p[2][j]) / 2;
+    }
+    xy[0] = p[0][0];    xy[1] = p[0][1];
+    xy[2] = ab[0];      xy[3] = ab[1];
+    xy[4] = ac[0];      xy[5] = ac[1];
+    xy[6] = p[2][0];    xy[7] = p[2][1];
+    xy[8] = ac[0];      xy[9] = ac[1];
+    xy[10] = bc[0];     xy[11] = bc[1];
+    xy[12] = p[1][0];   xy[13] = p[1][1];
+    xy[14] = bc[0];     xy[15] = bc[1];
+    xy[16] = ab[0];     xy[17] = ab[1];
+}
+
+/* Triangles begin to end, both multiples of 3 (the tiles are) unless
+   end is the last, keeping the path down to the parent of the ones in
+   hand: tri[l] is the triangle at level l and digit[l] which child of
+   tri[l - 1] it is */
+
+static void divideRange(Gasket *g, long begin, long end)
+{
+    float tri[GASKET_MAXDEPTH + 1][3][2], *xy;
+    int digit[GASKET_MAXDEPTH + 1], d = g->depth - 1, l, i;
+    long t, rest;
+
+    for (i = 0; i < 3; i++) {
+        tri[0][i][0] = g->abc[i][0];
+        tri[0][i][1] = g->abc[i][1];
+    }
+    xy = g->xy + (size_t) begin * 6;
+    if (d < 0) {
+        memcpy(xy, tri[0], sizeof(tri[0]));
+        return;
+    }
+
+    rest = begin / 3;
+    for (l = d; l > 0; l--) {
+        digit[l] = (int) (rest % 3);
+        rest /= 3;
+    }
+    for (l = 1; l <= d; l++)
+        child(tri[l - 1], digit[l], tri[l]);
+
+    for (t = begin / 3; t < end / 3; t++) {
+        family(tri[d], xy);
+        xy += 18;
+
+        /* on to the next: carry past the 2s, then redo the levels below */
+        for (l = d; l > 0 && digit[l] == 2; l--)
+            digit[l] = 0;
+        if (l == 0)
+            break;
+        digit[l]++;
+        for (; l <= d; l++)
+            child(tri[l - 1], digit[l], tri[l]);
+    }
+}
+
+/* Game k's own random numbers: a hash of the seed and k to start them,
+   then the 32 bit linear congruential generator from Numerical Recipes */
+
+static unsigned long gameSeed(unsigned long seed, long k)
+{
+    unsigned long h = (seed * 0x9e3779b9UL + (unsigned long) k) & 0xffffffffUL;
+
+    h ^= h >> 16;
+    h = (h * 0x85ebca6bUL) & 0xffffffffUL;
+    h ^= h >> 13;
+    h = (h * 0xc2b2ae35UL) & 0xffffffffUL;
+    h ^= h >> 16;
+    return h;
+}
+
+#define NEXT(r) ((r) = ((r) * 1664525UL + 1013904223UL) & 0xffffffffUL)
+
+/* Games begin to end, GASKET_CHUNK points each but maybe the last */
+
+static void chaosRange(Gasket *g, long begin, long end)
+{
+    float p[3], *v, *out;
+    unsigned long r;
+    long k, i, first, last;
+    int dims = g->dims, j, w;
+
+    for (k = begin; k < end; k++) {
+        r = gameSeed(g->seed, k);
+        for (j = 0; j < dims; j++)
+            p[j] = g->start[j];
+        if (k > 0)
+            for (i = 0; i < GASKET_WARMUP; i++) {
+                v = g->vertices + dims * (int) ((NEXT(r) >> 16) % g->nv);
+                for (j = 0; j < dims; j++)
+                    p[j] = (p[j] + v[j]) / 2;
+            }
+
+        first = k * GASKET_CHUNK;
+        last = first + GASKET_CHUNK < g->n ? first + GASKET_CHUNK : g->n;
+        out = g->out + (size_t) first * dims;
+        for (i = first; i < last; i++) {
+            v = g->vertices + dims * (int) ((NEXT(r) >> 16) % g->nv);
+            for (w = 0; w < dims; w++) {
+                p[w] = (p[w] + v[w]) / 2;
+                *out++ = p[w];
+            }
+        }
+    }
+}
+
+/* Tiles begin to end of the job in hand */
+
+static void doTiles(void *arg, int first, int last)
+{
+    Gasket *g = (Gasket *) arg;
+    long begin = first, end = last;
+    long total = g->kind == GK_DIVIDE ? gasketTriangles(g->depth)
+                                      : (g->n + GASKET_CHUNK - 1) / GASKET_CHUNK;
+    long size = g->kind == GK_DIVIDE ? GK_TILE : GK_GAMES;
+
+    begin *= size;
+    end = end * size < total ? end * size : total;
+    if (g->kind == GK_DIVIDE)
+        divideRange(g, begin, end);
+    else
+        chaosRange(g, begin, end);
+}
+
+/* Run the job set up in g, on the pool if it's worth it */
+
+static void run(Gasket *g)
+{
+    if (g->threads > 1 && g->units > 1 && !g->pool)
+        g->pool = pool_new(g->threads);
+    pool_run(g->threads > 1 ? g->pool : NULL, doTiles, g,
+             g->units, 1, g->units);
+}
+
+Gasket *gasketNew(void)
+{
+    Gasket *g;
+
+    g = (Gasket *) calloc(1, sizeof(Gasket));
+    if (!g)
+        return NULL;
+    g->threads = pool_cpus();
+    return g;
+}
+
+void gasketDelete(Gasket *g)
+{
+    pool_delete(g->pool);
+    free(g);
+}
+
+long gasketTriangles(int depth)
+{
+    long n = 1;
+
+    while (depth-- > 0)
+        n *= 3;
+    return n;
+}
+
+void gasketDivide(Gasket *g, float a[2], float b[2], float c[2],
+                  int depth, float *xy)
+{
+    int j;
+
+    if (depth < 0)
+        depth = 0;
+    if (depth > GASKET_MAXDEPTH)
+        depth = GASKET_MAXDEPTH;
+    for (j = 0; j < 2; j++) {
+        g->abc[0][j] = a[j];
+        g->abc[1][j] = b[j];
+        g->abc[2][j] = c[j];
+    }
+    g->depth = depth;
+    g->xy = xy;
+    g->kind = GK_DIVIDE;
+    g->units = (int) ((gasketTriangles(depth) + GK_TILE - 1) / GK_TILE);
+    run(g);
+}
+
+void gasketChaos(Gasket *g, float *vertices, int nv, int dims,
+                 float *start, long n, unsigned long seed, float *out)
+{
+    long games = (n + GASKET_CHUNK - 1) / GASKET_CHUNK;
+
+    g->vertices = vertices;
+    g->nv = nv;
+    g->dims = dims;
+    g->start = start;
+    g->n = n;
+    g->seed = seed;
+    g->out = out;
+    g->kind = GK_CHAOS;
+    g->units = (int) ((games + GK_GAMES - 1) / GK_GAMES);
+    run(g);
+}
+
+void gasketThreads(Gasket *g, int threads)
+{
+    g->threads = threads < 1 ? 1 : threads;
+    if (g->pool && pool_threads(g->pool) != g->threads) {
+        pool_delete(g->pool);
+        g->pool = NULL;
+    }
+}
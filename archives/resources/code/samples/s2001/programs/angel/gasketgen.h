@@ -0,0 +1,57 @@
+
+/* Sierpinski gasket generator for gasket.c, gasket2.c, gasket3d.c and
+   gasketbench.c: whole gaskets written straight into vertex arrays for
+   glDrawArrays, instead of a glVertex call a point */
+
+/* gasketDivide() makes the triangles gasket2.c's divide_triangle()
+   drew, in the same order and with the same floats, without recursing:
+   triangle t's path down the subdivision is t in base 3, so any range
+   of triangles can be started on its own, and a thread each takes one.
+   Going from one triangle to the next only redoes the levels whose
+   digit changed.
+
+   gasketChaos() plays the chaos game gasket.c and gasket3d.c played,
+   each new point halfway from the last one to a vertex picked at
+   random, in chunks that are each their own game, so threads can play
+   them at once.  The random vertices come from a seed rather than
+   rand(), so they aren't the ones the old programs picked, but the
+   same seed gives the same points on any number of threads.
+
+   The threads are sig99's worker pool: link with
+   ../../../sig99/adv99/util/pool.c and -lpthread, or build with
+   -DPOOL_NO_THREADS for one thread. */
+
+#ifndef GASKETGEN_H
+#define GASKETGEN_H
+
+#define GASKET_MAXDEPTH 18      /* 3^18 triangles is 9 gigabytes */
+#define GASKET_CHUNK    4096    /* points in each game */
+#define GASKET_WARMUP   32      /* steps each game but the first takes
+                                   before its first point, to be on the
+                                   gasket as far as floats can tell */
+
+typedef struct _Gasket Gasket;
+
+/* NULL if out of memory */
+extern Gasket *gasketNew(void);
+
+extern void gasketDelete(Gasket *g);
+
+/* triangles in a gasket depth levels deep: 3^depth */
+extern long gasketTriangles(int depth);
+
+/* the gasket depth levels deep on a, b, c, as gasketTriangles(depth)
+   triangles of 3 x, y pairs into xy */
+extern void gasketDivide(Gasket *g, float a[2], float b[2], float c[2],
+                         int depth, float *xy);
+
+/* n points of the chaos game on the nv vertices (dims floats each, 2
+   or 3), from start, into out (dims floats a point) */
+extern void gasketChaos(Gasket *g, float *vertices, int nv, int dims,
+                        float *start, long n, unsigned long seed,
+                        float *out);
+
+/* most threads to use (the number of processors unless set) */
+extern void gasketThreads(Gasket *g, int threads);
+
+#endif
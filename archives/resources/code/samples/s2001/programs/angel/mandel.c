@@ -0,0 +1,301 @@
+
+/* Mandelbrot set engine, see mandel.h */
+
+/* Each pass of step s computes the pixels whose coordinates are both
+   multiples of s, less those the pass before (step 2s) did, and fills
+   the s x s block above and to the right of each.  Rows of the pass
+   are handed out a tile at a time by sig99's worker pool, so threads
+   that get easy tiles (quick escapes) just take more of them.
+
+   The iteration is the one mandelbrot.c had, z = z * z + c until
+   |z|^2 > 4 or max times, done in the same order of float operations
+   so the float path gives the same bytes.  A lane that has escaped
+   keeps its z and |z|^2 while the others go on. */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include "mandel.h"
+#include "../../../sig99/adv99/util/pool.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define MB_SSE
+#include <xmmintrin.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MB_SSE2
+#include <emmintrin.h>
+#endif
+
+#define MB_COARSE 16    /* step of the first pass */
+#define MB_LANES  16    /* pixels iterated together */
+#define MB_TILE   8     /* rows of a pass handed out at once */
+
+struct _Mandel {
+    int n, m;
+    unsigned char *image;
+    double cx, cy, width, height;
+    int max;
+    int precision, dbl;     /* asked for, and used for this view */
+    int step;               /* of the next pass, 0 when done */
+    int rows;               /* in the pass */
+    int threads;
+    pool_t *pool;
+};
+
+/* Iterating MB_LANES points, leaving |z|^2 where each stopped in v */
+
+static void iterateFloat(const float *x, float y, int max, float *v)
+{
+#ifdef MB_SSE
+    __m128 cr[4], ci, zr[4], zi[4], mag[4], live[4];
+    __m128 nr, ni, nv, four = _mm_set1_ps(4.0);
+    int k, l;
+
+    ci = _mm_set1_ps(y);
+    for (l = 0; l < 4; l++) {
+        cr[l] = _mm_loadu_ps(x + 4 * l);
+        zr[l] = zi[l] = mag[l] = _mm_setzero_ps();
+        live[l] = _mm_cmpeq_ps(zr[l], zr[l]);
+    }
+    for (k = 0; k < max; k++) {
+        for (l = 0; l < 4; l++) {
+            nr = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(zr[l], zr[l]),
+                                       _mm_mul_ps(zi[l], zi[l])), cr[l]);
+            ni = _mm_add_ps(_mm_add_ps(_mm_mul_ps(zr[l], zi[l]),
+                                       _mm_mul_ps(zi[l], zr[l])), ci);
+            nv = _mm_add_ps(_mm_mul_ps(nr, nr), _mm_mul_ps(ni, ni));
+            zr[l] = nr;
+            zi[l] = ni;
+            mag[l] = _mm_or_ps(_mm_and_ps(live[l], nv),
+                               _mm_andnot_ps(live[l], mag[l]));
+            live[l] = _mm_andnot_ps(_mm_cmpgt_ps(nv, four), live[l]);
+        }
+        if (!_mm_movemask_ps(_mm_or_ps(_mm_or_ps(live[0], live[1]),
+                                       _mm_or_ps(live[2], live[3]))))
+            break;
+    }
+    for (l = 0; l < 4; l++)
+        _mm_storeu_ps(v + 4 * l, mag[l]);
+#else
+    float zr, zi, t;
+    int k, l;
+
+    for (l = 0; l < MB_LANES; l++) {
+        zr = zi = v[l] = 0.0;
+        for (k = 0; k < max; k++) {
+            t = zr * zr - zi * zi + x[l];
+            zi = zr * zi + zi * zr + y;
+            zr = t;
+            v[l] = zr * zr + zi * zi;
+            if (v[l] > 4.0) break;
+        }
+    }
+#endif
+}
+
+static void iterateDouble(const double *x, double y, int max, double *v)
+{
+#ifdef MB_SSE2
+    __m128d cr[8], ci, zr[8], zi[8], mag[8], live[8];
+    __m128d nr, ni, nv, any, four = _mm_set1_pd(4.0);
+    int k, l;
+
+    ci = _mm_set1_pd(y);
+    for (l = 0; l < 8; l++) {
+        cr[l] = _mm_loadu_pd(x + 2 * l);
+        zr[l] = zi[l] = mag[l] = _mm_setzero_pd();
+        live[l] = _mm_cmpeq_pd(zr[l], zr[l]);
+    }
+    for (k = 0; k < max; k++) {
+        for (l = 0; l < 8; l++) {
+            nr = _mm_add_pd(_mm_sub_pd(_mm_mul_pd(zr[l], zr[l]),
+                                       _mm_mul_pd(zi[l], zi[l])), cr[l]);
+            ni = _mm_add_pd(_mm_add_pd(_mm_mul_pd(zr[l], zi[l]),
+                                       _mm_mul_pd(zi[l], zr[l])), ci);
+            nv = _mm_add_pd(_mm_mul_pd(nr, nr), _mm_mul_pd(ni, ni));
+            zr[l] = nr;
+            zi[l] = ni;
+            mag[l] = _mm_or_pd(_mm_and_pd(live[l], nv),
+                               _mm_andnot_pd(live[l], mag[l]));
+            live[l] = _mm_andnot_pd(_mm_cmpgt_pd(nv, four), live[l]);
+        }
+        any = _mm_or_pd(_mm_or_pd(_mm_or_pd(live[0], live[1]),
+                                  _mm_or_pd(live[2], live[3])),
+                        _mm_or_pd(_mm_or_pd(live[4], live[5]),
+                                  _mm_or_pd(live[6], live[7])));
+        if (!_mm_movemask_pd(any))
+            break;
+    }
+    for (l = 0; l < 8; l++)
+        _mm_storeu_pd(v + 2 * l, mag[l]);
+#else
+    double zr, zi, t;
+    int k, l;
+
+    for (l = 0; l < MB_LANES; l++) {
+        zr = zi = v[l] = 0.0;
+        for (k = 0; k < max; k++) {
+            t = zr * zr - zi * zi + x[l];
+            zi = zr * zi + zi * zr + y;
+            zr = t;
+            v[l] = zr * zr + zi * zi;
+            if (v[l] > 4.0) break;
+        }
+    }
+#endif
+}
+
+/* One row of a pass: count pixels from i0, stride apart, on row j,
+   each filling a step x step block */
+
+static void doRow(Mandel *mb, int j, int i0, int stride, int count, int step)
+{
+    float fx[MB_LANES], fv[MB_LANES], fy, fdx, fcx, fw;
+    double dx[MB_LANES], dv[MB_LANES], dy, ddx;
+    unsigned char value[MB_LANES], *row;
+    int b, l, lanes, i, r, c, rows, cols;
+
+    /* as mandelbrot.c had them, in floats or doubles */
+    fw = mb->width;
+    fcx = mb->cx;
+    fdx = fw / (mb->n - 1);
+    fy = j * ((float) mb->height / (mb->m - 1)) + (float) mb->cy
+         - (float) mb->height / 2;
+    ddx = mb->width / (mb->n - 1);
+    dy = j * (mb->height / (mb->m - 1)) + mb->cy - mb->height / 2;
+
+    rows = mb->m - j < step ? mb->m - j : step;
+    for (b = 0; b < count; b += MB_LANES) {
+        lanes = count - b < MB_LANES ? count - b : MB_LANES;
+        for (l = 0; l < MB_LANES; l++) {
+            i = i0 + (b + (l < lanes ? l : 0)) * stride;
+            fx[l] = i * fdx + fcx - fw / 2;
+            dx[l] = i * ddx + mb->cx - mb->width / 2;
+        }
+        if (mb->dbl) {
+            iterateDouble(dx, dy, mb->max, dv);
+            for (l = 0; l < lanes; l++)
+                value[l] = 255 * (dv[l] > 1.0 ? 1.0 : dv[l]);
+        } else {
+            iterateFloat(fx, fy, mb->max, fv);
+            for (l = 0; l < lanes; l++)
+                value[l] = 255 * (fv[l] > 1.0 ? 1.0f : fv[l]);
+        }
+        for (l = 0; l < lanes; l++) {
+            i = i0 + (b + l) * stride;
+            cols = mb->n - i < step ? mb->n - i : step;
+            for (r = 0; r < rows; r++) {
+                row = mb->image + (size_t) (j + r) * mb->n + i;
+                for (c = 0; c < cols; c++)
+                    row[c] = value[l];
+            }
+        }
+    }
+}
+
+/* Rows of the current pass from begin to end */
+
+static void doRows(Mandel *mb, int begin, int end)
+{
+    int s = mb->step, across = (mb->n + s - 1) / s, p, j;
+
+    for (p = begin; p < end; p++) {
+        j = p * s;
+        if (s == MB_COARSE)
+            doRow(mb, j, 0, s, across, s);
+        else if (j % (2 * s) == 0)  /* every other pixel done already */
+            doRow(mb, j, s, 2 * s, across / 2, s);
+        else
+            doRow(mb, j, 0, s, across, s);
+    }
+}
+
+static void passRows(void *arg, int begin, int end)
+{
+    doRows((Mandel *) arg, begin, end);
+}
+
+Mandel *mandelNew(int n, int m)
+{
+    Mandel *mb;
+
+    mb = (Mandel *) calloc(1, sizeof(Mandel));
+    if (!mb)
+        return NULL;
+    mb->image = (unsigned char *) calloc((size_t) n * m, 1);
+    if (!mb->image) {
+        free(mb);
+        return NULL;
+    }
+    mb->n = n;
+    mb->m = m;
+    mb->threads = pool_cpus();
+    return mb;
+}
+
+void mandelDelete(Mandel *mb)
+{
+    pool_delete(mb->pool);
+    free(mb->image);
+    free(mb);
+}
+
+void mandelView(Mandel *mb, double cx, double cy, double width,
+                double height, int max)
+{
+    double dx = width / (mb->n - 1), dy = height / (mb->m - 1);
+    double big = fabs(cx) + fabs(cy) + width + height;
+
+    mb->cx = cx;
+    mb->cy = cy;
+    mb->width = width;
+    mb->height = height;
+    mb->max = max;
+    mb->step = MB_COARSE;
+
+    /* floats can't tell neighbors apart once they're a few ulps apart */
+    if (mb->precision == MANDEL_AUTO)
+        mb->dbl = dx < 16 * FLT_EPSILON * big || dy < 16 * FLT_EPSILON * big;
+    else
+        mb->dbl = mb->precision == MANDEL_DOUBLE;
+}
+
+int mandelRefine(Mandel *mb)
+{
+    int tiles;
+
+    if (!mb->step)
+        return 1;
+    mb->rows = (mb->m + mb->step - 1) / mb->step;
+    tiles = (mb->rows + MB_TILE - 1) / MB_TILE;
+
+    if (mb->threads > 1 && tiles > 1 && !mb->pool)
+        mb->pool = pool_new(mb->threads);
+    pool_run(mb->threads > 1 ? mb->pool : NULL, passRows, mb,
+             tiles, MB_TILE, mb->rows);
+
+    mb->step /= 2;
+    return !mb->step;
+}
+
+unsigned char *mandelImage(Mandel *mb)
+{
+    return mb->image;
+}
+
+void mandelPrecision(Mandel *mb, int precision)
+{
+    mb->precision = precision;
+}
+
+void mandelThreads(Mandel *mb, int threads)
+{
+    mb->threads = threads < 1 ? 1 : threads;
+    if (mb->pool && pool_threads(mb->pool) != mb->threads) {
+        pool_delete(mb->pool);
+        mb->pool = NULL;
+    }
+}
@@ -0,0 +1,55 @@
+
+/* Mandelbrot set engine for mandelbrot.c and mandelbench.c */
+
+/* Renders an n x m image of a rectangle of the complex plane, n pixels
+   across (the real axis) and m up, one byte per pixel: 255 times the
+   squared magnitude the iteration ended at, clamped to 1, as
+   mandelbrot.c always did.
+
+   The image is made coarse to fine, each call to mandelRefine() doing
+   one pass: first every 16th pixel each way, filling 16 x 16 blocks,
+   then the pixels in between at 8, 4, 2 and 1, so a new view shows up
+   fast and sharpens as the passes go.  No pixel is computed twice.
+
+   A pass is split into tiles of rows handed out to threads as they
+   finish the last one, and the pixels of a row are iterated 16 at a
+   time, in 4 SSE registers of floats or 8 SSE2 registers of doubles
+   when there are any, until all 16 have escaped.  Zoomed in past what
+   floats can tell apart, the same is done in doubles.
+
+   The threads are sig99's worker pool: link with
+   ../../../sig99/adv99/util/pool.c and -lpthread, or build with
+   -DPOOL_NO_THREADS for one thread. */
+
+#ifndef MANDEL_H
+#define MANDEL_H
+
+#define MANDEL_AUTO   0     /* doubles only when floats run out */
+#define MANDEL_FLOAT  1
+#define MANDEL_DOUBLE 2
+
+typedef struct _Mandel Mandel;
+
+/* an n x m image, all 0 until a view is set; NULL if out of memory */
+extern Mandel *mandelNew(int n, int m);
+
+extern void mandelDelete(Mandel *mb);
+
+/* the rectangle width x height about cx, cy, max iterations a point;
+   starts again at the coarsest pass */
+extern void mandelView(Mandel *mb, double cx, double cy, double width,
+                       double height, int max);
+
+/* do the next pass; 1 once the image is finished, 0 if there's more */
+extern int mandelRefine(Mandel *mb);
+
+/* the image, a row of n bytes for each of the m from the bottom up */
+extern unsigned char *mandelImage(Mandel *mb);
+
+/* MANDEL_AUTO unless set; takes effect at the next mandelView() */
+extern void mandelPrecision(Mandel *mb, int precision);
+
+/* most threads a pass may use (the number of processors unless set) */
+extern void mandelThreads(Mandel *mb, int threads);
+
+#endif
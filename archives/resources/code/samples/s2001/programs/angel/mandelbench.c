@@ -0,0 +1,198 @@
+
+/* Times mandel.c without a window against the loop mandelbrot.c had */
+
+/* For each view: pixels a second the old way, checking the new image
+   against it; then the new way on one thread and on all of them, the
+   time to the first coarse frame and pixels a second for the finished
+   image.  Each time is over at least a quarter of a second.  The deep
+   view is past what floats can do, so it's only timed in doubles.
+
+   usage: mandelbench [threads] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "mandel.h"
+
+#ifdef _WIN32
+#include <windows.h>
+typedef int timer;
+#define getTime(a)      (a = GetTickCount())
+#define timeDiff(a, b)  ((b - a) * 1000)
+#else
+#include <sys/time.h>
+typedef struct timeval timer;
+#define getTime(a)      gettimeofday(&a, NULL)
+#define timeDiff(a, b)  (((b.tv_sec - a.tv_sec) * 1000000) + b.tv_usec - a.tv_usec)
+#endif
+
+typedef struct {
+    char *name;
+    int n, m;
+    double cx, cy, width, height;
+    int max;
+    int deep;
+} view;
+
+view views[] = {
+    { "default 500",  500,  500, -0.5, 0.5, 0.5, 0.5, 100, 0 },
+    { "whole 4k",    3840, 2160, -0.5, 0.0, 3.2, 1.8, 256, 0 },
+    { "seahorse 4k", 3840, 2160, -0.7435, 0.1314, 0.032, 0.018, 1000, 0 },
+    { "deep 4k",     3840, 2160, -0.743643887037151, 0.131825904205330,
+                     3.2e-11, 1.8e-11, 1000, 1 },
+};
+
+/* The old way, complex functions and all */
+
+typedef float complex[2];
+
+void add(complex a, complex b, complex p)
+{
+    p[0]=a[0]+b[0];
+    p[1]=a[1]+b[1];
+}
+
+void mult(complex a, complex b, complex p)
+{
+    p[0]=a[0]*b[0]-a[1]*b[1];
+    p[1]=a[0]*b[1]+a[1]*b[0];
+}
+
+float mag2(complex a)
+{
+    return(a[0]*a[0]+a[1]*a[1]);
+}
+
+void form(float a, float b, complex p)
+{
+    p[0]=a;
+    p[1]=b;
+}
+
+/* image[i][j] as mandelbrot.c had it, i across */
+
+void old(view *vw, unsigned char *image)
+{
+    int i, j, k, n = vw->n, m = vw->m, max = vw->max;
+    float x, y, v = 0, width = vw->width, height = vw->height;
+    float cx = vw->cx, cy = vw->cy;
+    complex c0, c, d;
+
+    for (i=0; i<n; i++) for(j=0; j<m; j++)
+    {
+    x= i *(width/(n-1)) + cx -width/2;
+    y= j *(height/(m-1)) + cy -height/2;
+
+    form(0,0,c);
+    form(x,y,c0);
+
+    for(k=0; k<max; k++)
+        {
+        mult(c,c,d);
+        add(d,c0,c);
+        v=mag2(c);
+        if(v>4.0) break;
+        }
+
+        if(v>1.0) v=1.0;
+        image[i*m+j]=255*v;
+    }
+}
+
+/* the new way: ms to the first pass, and for the whole image */
+
+void render(Mandel *mb, view *vw, double *first, double *all)
+{
+    timer t0, t1, s0;
+    long n = 0, usec, ufirst = 0;
+
+    getTime(t0);
+    do {
+        getTime(s0);
+        mandelView(mb, vw->cx, vw->cy, vw->width, vw->height, vw->max);
+        mandelRefine(mb);
+        getTime(t1);
+        ufirst += timeDiff(s0, t1);
+        while (!mandelRefine(mb))
+            ;
+        n++;
+        getTime(t1);
+        usec = timeDiff(t0, t1);
+    } while (usec < 250000);
+    *first = ufirst / 1000.0 / n;
+    *all = usec / 1000.0 / n;
+}
+
+int main(int argc, char *argv[])
+{
+    int threads = argc > 1 ? atoi(argv[1]) : 0, v, i, j, wrong;
+    unsigned char *image, *img;
+    double first1, all1, first, all, told = 0, pixels;
+    long n, usec;
+    timer t0, t1;
+    Mandel *mb;
+    view *vw;
+
+    printf("%-12s %9s %9s %9s %9s %9s %9s %9s %6s\n", "", "old Mp/s",
+           "1 thr 1st", "ms", "Mp/s", "all 1st", "ms", "Mp/s", "wrong");
+    for (v = 0; v < (int) (sizeof(views) / sizeof(views[0])); v++) {
+        vw = &views[v];
+        pixels = (double) vw->n * vw->m;
+        image = (unsigned char *) malloc((size_t) vw->n * vw->m);
+        mb = mandelNew(vw->n, vw->m);
+        if (!image || !mb) {
+            fprintf(stderr, "mandelbench: out of memory\n");
+            return 1;
+        }
+
+        wrong = -1;
+        if (!vw->deep) {
+            n = 0;
+            getTime(t0);
+            do {
+                old(vw, image);
+                n++;
+                getTime(t1);
+                usec = timeDiff(t0, t1);
+            } while (usec < 250000);
+            told = usec / 1000.0 / n;
+
+            mandelPrecision(mb, MANDEL_FLOAT);
+            mandelView(mb, vw->cx, vw->cy, vw->width, vw->height, vw->max);
+            while (!mandelRefine(mb))
+                ;
+            img = mandelImage(mb);
+            wrong = 0;
+            for (i = 0; i < vw->n; i++)
+                for (j = 0; j < vw->m; j++)
+                    wrong += img[j * vw->n + i] != image[i * vw->m + j];
+        }
+
+        mandelPrecision(mb, MANDEL_AUTO);
+        mandelThreads(mb, 1);
+        render(mb, vw, &first1, &all1);
+        mandelDelete(mb);
+        mb = mandelNew(vw->n, vw->m);
+        if (!mb) {
+            fprintf(stderr, "mandelbench: out of memory\n");
+            return 1;
+        }
+        if (threads > 0)
+            mandelThreads(mb, threads);
+        render(mb, vw, &first, &all);
+
+        if (vw->deep)
+            printf("%-12s %9s", vw->name, "");
+        else
+            printf("%-12s %9.1f", vw->name, pixels / told / 1000);
+        printf(" %9.2f %9.1f %9.1f %9.2f %9.1f %9.1f",
+               first1, all1, pixels / all1 / 1000, first, all,
+               pixels / all / 1000);
+        if (wrong < 0)
+            printf(" %6s\n", "-");
+        else
+            printf(" %6d\n", wrong);
+        mandelDelete(mb);
+        free(image);
+    }
+    return 0;
+}
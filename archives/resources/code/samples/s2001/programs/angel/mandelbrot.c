@@ -1,6 +1,7 @@
 
 #include <stdlib.h>
 #include <GL/glut.h>
+#include "mandel.h"
 
 /* Defaut data via command line */
 /* Can enter other values via command line arguments */
@@ -11,70 +12,120 @@
 #define WIDTH 0.5
 #define MAX_ITER 100
 
-/* N x M array to be generated */
+/* N x M image to start with, then the window's size */
 
 #define N 500
 #define M 500
 
-float height = HEIGHT; /* size of window in complex plane */
-float width = WIDTH;
-float cx = CENTERX; /* center of window in complex plane */
-float cy = CENTERY; 
+double height = HEIGHT; /* size of window in complex plane */
+double width = WIDTH;
+double cx = CENTERX; /* center of window in complex plane */
+double cy = CENTERY; /* (doubles, for zooming in deep) */
 int max = MAX_ITER; /* number of interations per point */
 
 int n=N;
 int m=M;
 
-/* Use unsigned bytes for image */
+/* mandel.c makes the image, coarse to fine, on as many threads as
+   there are; one byte per pixel, n across and m up */
 
-GLubyte image[N][M];
+Mandel *mb;
+int done = 1; /* image finished */
 
-/* Complex data type and complex add, mult, and magnitude functions */
-/* Probably not worth overhead */
+int dragx, dragy; /* where the left button was, while it's down */
 
-typedef float complex[2];
+/* start the image again for the current view */
 
-void add(complex a, complex b, complex p)
+void newView()
 {
-    p[0]=a[0]+b[0];
-    p[1]=a[1]+b[1];
+    if(!mb) return;
+    mandelView(mb, cx, cy, width, height, max);
+    done = mandelRefine(mb);
+    glutPostRedisplay();
 }
 
-void mult(complex a, complex b, complex p)
+void display()
 {
-    p[0]=a[0]*b[0]-a[1]*b[1];
-    p[1]=a[0]*b[1]+a[1]*b[0];
+    glClear(GL_COLOR_BUFFER_BIT);
+    if(mb)
+    {
+        glRasterPos2i(0, 0);
+        glDrawPixels(n,m,GL_COLOR_INDEX, GL_UNSIGNED_BYTE, mandelImage(mb));
+    }
+    glFlush();
 }
 
-float mag2(complex a)
+/* finer passes while nothing else is happening */
+
+void idle()
 {
-    return(a[0]*a[0]+a[1]*a[1]);
+    if(!done)
+    {
+        done = mandelRefine(mb);
+        glutPostRedisplay();
+    }
 }
 
-void form(float a, float b, complex p)
+void myReshape(int w, int h)
 {
-    p[0]=a;
-    p[1]=b;
+    glViewport(0, 0, w, h);
+    glMatrixMode(GL_PROJECTION);
+    glLoadIdentity();
+    gluOrtho2D(0.0, (GLfloat) w, 0.0, (GLfloat) h);
+    glMatrixMode(GL_MODELVIEW);
+
+/* same width of the plane across, square pixels; no image until the
+   window is 2 x 2 at least */
+
+    if(w < 2 || h < 2) return;
+    if(mb) mandelDelete(mb);
+    mb = mandelNew(w, h);
+    if(!mb) exit(1);
+    n = w;
+    m = h;
+    height = width*(m-1)/(n-1);
+    newView();
 }
 
-void display()
+/* drag with the left button to pan, + and - to zoom */
+
+void mouse(int btn, int state, int x, int y)
 {
-    glClear(GL_COLOR_BUFFER_BIT);
-    glDrawPixels(n,m,GL_COLOR_INDEX, GL_UNSIGNED_BYTE, image);
+    if(btn==GLUT_LEFT_BUTTON && state==GLUT_DOWN)
+    {
+        dragx = x;
+        dragy = y;
+    }
 }
 
+void motion(int x, int y)
+{
+    cx -= (x-dragx)*width/(n-1);
+    cy += (y-dragy)*height/(m-1);
+    dragx = x;
+    dragy = y;
+    newView();
+}
 
-void myReshape(int w, int h)
+void key(unsigned char k, int x, int y)
 {
-    glViewport(0, 0, w, h);
-    glMatrixMode(GL_PROJECTION);
-    glLoadIdentity();
-    if (w <= h)
-    gluOrtho2D(0.0, 0.0, (GLfloat) n, (GLfloat) m* (GLfloat) h / (GLfloat) w);
-    else
-    gluOrtho2D(0.0, 0.0, (GLfloat) n * (GLfloat) w / (GLfloat) h,(GLfloat) m);
-    glMatrixMode(GL_MODELVIEW);
-    display();
+    (void) x;
+    (void) y;
+    switch(k)
+    {
+    case '+': case '=':
+        width /= 2;
+        height /= 2;
+        newView();
+        break;
+    case '-':
+        width *= 2;
+        height *= 2;
+        newView();
+        break;
+    case 'q': case 'Q': case 27:
+        exit(0);
+    }
 }
 
 void myinit()
@@ -83,7 +134,7 @@ void myinit()
     int i;
 
     glClearColor (1.0, 1.0, 1.0, 1.0);
-    gluOrtho2D(0.0, 0.0, (GLfloat) n, (GLfloat) m);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
 /* Define pseudocolor maps, ramps for red and blue,
    random for green */
@@ -102,44 +153,13 @@ void myinit()
 }
 
 
-main(int argc, char *argv[])
+int main(int argc, char *argv[])
 {
-    int i, j, k;
-    float x, y, v;
-    complex c0, c, d;
-
     if(argc>1) cx = atof(argv[1]); /* center x */
     if(argc>2) cy = atof(argv[2]);  /* center y */
     if(argc>3) height=width=atof(argv[3]); /* rectangle height and width */
     if(argc>4) max=atoi(argv[4]); /* maximum iterations */
 
-    for (i=0; i<n; i++) for(j=0; j<m; j++) 
-    {
-
-/* starting point */
-
-    x= i *(width/(n-1)) + cx -width/2;
-    y= j *(height/(m-1)) + cy -height/2;
-
-    form(0,0,c);
-    form(x,y,c0);
-
-/* complex iteration */
-
-    for(k=0; k<max; k++)
-        {
-        mult(c,c,d);
-        add(d,c0,c);
-        v=mag2(c);
-        if(v>4.0) break; /* assume not in set if mag > 4 */
-        }
-
-/* assign gray level to point based on its magnitude */
-        if(v>1.0) v=1.0; /* clamp if > 1 */
-        image[i][j]=255*v;
-    }
-
-
     glutInit(&argc, argv);
     glutInitDisplayMode(GLUT_SINGLE | GLUT_RGB );
     glutInitWindowSize(N, M);
@@ -147,8 +167,12 @@ main(int argc, char *argv[])
     myinit();
     glutReshapeFunc(myReshape);
     glutDisplayFunc(display);
+    glutIdleFunc(idle);
+    glutMouseFunc(mouse);
+    glutMotionFunc(motion);
+    glutKeyboardFunc(key);
 
     glutMainLoop();
 
-
+    return 0;
 }
@@ -15,6 +15,7 @@
 #include <GL/glut.h>
 #include "materials.h"
 #include "glm.h"
+#include "shapecache.h"
 
 
 typedef struct _cell {
@@ -534,7 +535,7 @@ world_display(void)
 	if (pmodel)
 	  drawmodel();
 	else 
-	  glutSolidTorus(0.25, 0.75, 28, 28);
+	  scSolidTorus(0.25, 0.75, 28, 28);
 	glDisable(GL_LIGHTING);
     }
 
@@ -769,7 +770,7 @@ screen_display(void)
     if (pmodel)
 	drawmodel();
     else 
-	glutSolidTorus(0.25, 0.75, 28, 28);
+	scSolidTorus(0.25, 0.75, 28, 28);
     glPopMatrix();
 
 #if 0    
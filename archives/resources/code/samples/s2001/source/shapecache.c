@@ -0,0 +1,416 @@
+/*
+      shapecache.c
+
+      Cached spheres and tori, see shapecache.h.
+
+ */
+
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "shapecache.h"
+
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define SC_SPHERE 0
+#define SC_TORUS  1
+
+
+/* _SCtable: cos and sin of 2 pi i / n for i = 0 to n, the last
+ * the same as the first so a seam closes exactly
+ */
+typedef struct _SCtable {
+  GLint            n;
+  GLfloat*         cos;
+  GLfloat*         sin;
+  struct _SCtable* next;
+} SCtable;
+
+/* _SCshape: a shape ready to draw
+ */
+typedef struct _SCshape {
+  GLint            type;		/* SC_SPHERE or SC_TORUS */
+  GLdouble         a;			/* 0, or inner over outer */
+  GLint            n, m;		/* slices and stacks, or sides and rings */
+  GLfloat*         vertices;		/* normal then vertex, 6 floats each */
+  GLuint*          indices;		/* 3 to a triangle */
+  GLuint           numindices;
+  struct _SCshape* next;
+} SCshape;
+
+static SCtable* tables = NULL;
+static SCshape* shapes = NULL;		/* most recently drawn first */
+static GLint    numshapes = 0;
+
+
+/* scTable: the table for n, made the first time it's wanted; NULL
+ * if out of memory
+ */
+static SCtable*
+scTable(GLint n)
+{
+  SCtable* table;
+  GLint i;
+
+  for (table = tables; table; table = table->next)
+    if (table->n == n)
+      return table;
+
+  table = (SCtable*)malloc(sizeof(SCtable));
+  if (!table)
+    return NULL;
+  table->cos = (GLfloat*)malloc((n + 1) * sizeof(GLfloat));
+  table->sin = (GLfloat*)malloc((n + 1) * sizeof(GLfloat));
+  if (!table->cos || !table->sin) {
+    free(table->cos);
+    free(table->sin);
+    free(table);
+    return NULL;
+  }
+  table->n = n;
+  for (i = 0; i < n; i++) {
+    table->cos[i] = (GLfloat)cos(2 * M_PI * i / n);
+    table->sin[i] = (GLfloat)sin(2 * M_PI * i / n);
+  }
+  table->cos[n] = table->cos[0];
+  table->sin[n] = table->sin[0];
+  table->next = tables;
+  tables = table;
+  return table;
+}
+
+/* scNew: an empty shape with room for nv vertices and nt triangles;
+ * NULL if out of memory
+ */
+static SCshape*
+scNew(GLint type, GLdouble a, GLint n, GLint m, GLuint nv, GLuint nt)
+{
+  SCshape* shape;
+
+  shape = (SCshape*)malloc(sizeof(SCshape));
+  if (!shape)
+    return NULL;
+  shape->vertices = (GLfloat*)malloc(nv * 6 * sizeof(GLfloat));
+  shape->indices = (GLuint*)malloc(nt * 3 * sizeof(GLuint));
+  if (!shape->vertices || !shape->indices) {
+    free(shape->vertices);
+    free(shape->indices);
+    free(shape);
+    return NULL;
+  }
+  shape->type = type;
+  shape->a = a;
+  shape->n = n;
+  shape->m = m;
+  shape->numindices = 0;
+  return shape;
+}
+
+/* scSphere: builds a sphere of radius 1 the way gluSphere() lays one
+ * out: stack j at pi j / stacks down from +z, slice i at 2 pi i /
+ * slices from +y toward +x.  The triangles touching the poles are left
+ * out where they'd have no area.
+ */
+static SCshape*
+scSphere(GLint slices, GLint stacks)
+{
+  SCshape* shape;
+  SCtable* around;
+  SCtable* down;
+  GLfloat* v;
+  GLuint* t;
+  GLint i, j;
+  GLuint k;
+
+  around = scTable(slices);
+  down = scTable(2 * stacks);		/* only the first half is used */
+  if (!around || !down)
+    return NULL;
+  shape = scNew(SC_SPHERE, 0, slices, stacks,
+		(slices + 1) * (stacks + 1), 2 * slices * stacks);
+  if (!shape)
+    return NULL;
+
+  v = shape->vertices;
+  for (j = 0; j <= stacks; j++) {
+    for (i = 0; i <= slices; i++) {
+      v[0] = around->sin[i] * down->sin[j];
+      v[1] = around->cos[i] * down->sin[j];
+      v[2] = down->cos[j];
+      v[3] = v[0];
+      v[4] = v[1];
+      v[5] = v[2];
+      v += 6;
+    }
+  }
+  /* the sin of pi isn't quite 0 in floats: make the south pole a point */
+  v = shape->vertices + stacks * (slices + 1) * 6;
+  for (i = 0; i <= slices; i++, v += 6) {
+    v[0] = v[1] = v[3] = v[4] = 0;
+    v[2] = v[5] = -1;
+  }
+
+  t = shape->indices;
+  for (j = 0; j < stacks; j++) {
+    for (i = 0; i < slices; i++) {
+      k = j * (slices + 1) + i;
+      if (j > 0) {
+	*t++ = k;
+	*t++ = k + 1;
+	*t++ = k + slices + 1;
+      }
+      if (j < stacks - 1) {
+	*t++ = k + 1;
+	*t++ = k + slices + 2;
+	*t++ = k + slices + 1;
+      }
+    }
+  }
+  shape->numindices = t - shape->indices;
+  return shape;
+}
+
+/* scTorus: builds a torus with an outer radius of 1 and a tube of
+ * radius inner the way glutSolidTorus() lays one out: ring i at 2 pi
+ * i / rings about the z axis, from +x toward -y, side j at 2 pi j /
+ * sides about the tube, from outside toward +z.
+ */
+static SCshape*
+scTorus(GLdouble inner, GLint sides, GLint rings)
+{
+  SCshape* shape;
+  SCtable* around;
+  SCtable* tube;
+  GLfloat* v;
+  GLuint* t;
+  GLint i, j;
+  GLuint k;
+  GLdouble dist;
+
+  around = scTable(rings);
+  tube = scTable(sides);
+  if (!around || !tube)
+    return NULL;
+  shape = scNew(SC_TORUS, inner, sides, rings,
+		(sides + 1) * (rings + 1), 2 * sides * rings);
+  if (!shape)
+    return NULL;
+
+  v = shape->vertices;
+  for (i = 0; i <= rings; i++) {
+    for (j = 0; j <= sides; j++) {
+      dist = 1 + inner * tube->cos[j];
+      v[0] = around->cos[i] * tube->cos[j];
+      v[1] = -around->sin[i] * tube->cos[j];
+      v[2] = tube->sin[j];
+      v[3] = (GLfloat)(around->cos[i] * dist);
+      v[4] = (GLfloat)(-around->sin[i] * dist);
+      v[5] = (GLfloat)(inner * tube->sin[j]);
+      v += 6;
+    }
+  }
+
+  /* wound as glutSolidTorus()'s quad strips are */
+  t = shape->indices;
+  for (i = 0; i < rings; i++) {
+    for (j = 0; j < sides; j++) {
+      k = i * (sides + 1) + j;
+      *t++ = k + sides + 1;
+      *t++ = k;
+      *t++ = k + sides + 2;
+      *t++ = k + sides + 2;
+      *t++ = k;
+      *t++ = k + 1;
+    }
+  }
+  shape->numindices = t - shape->indices;
+  return shape;
+}
+
+/* scFree: frees a shape
+ */
+static GLvoid
+scFree(SCshape* shape)
+{
+  free(shape->vertices);
+  free(shape->indices);
+  free(shape);
+}
+
+/* scFind: the shape asked for, built if it isn't in the cache yet;
+ * NULL if out of memory.  A shape found is moved to the front, so the
+ * ones drawn most are found first, and once there are SC_SHAPES the
+ * one at the back, drawn least recently, makes way for a new one.
+ */
+static SCshape*
+scFind(GLint type, GLdouble a, GLint n, GLint m)
+{
+  SCshape* shape;
+  SCshape* prev = NULL;
+
+  for (shape = shapes; shape; prev = shape, shape = shape->next) {
+    if (shape->type == type && shape->a == a &&
+	shape->n == n && shape->m == m) {
+      if (prev) {
+	prev->next = shape->next;
+	shape->next = shapes;
+	shapes = shape;
+      }
+      return shape;
+    }
+  }
+
+  if (numshapes >= SC_SHAPES) {
+    for (prev = shapes; prev->next->next; prev = prev->next)
+      ;
+    scFree(prev->next);
+    prev->next = NULL;
+    numshapes--;
+  }
+  if (type == SC_SPHERE)
+    shape = scSphere(n, m);
+  else
+    shape = scTorus(a, n, m);
+  if (!shape)
+    return NULL;
+  shape->next = shapes;
+  shapes = shape;
+  numshapes++;
+  return shape;
+}
+
+/* scRescale: what to enable to keep normals unit length under a
+ * uniform scale: GL_RESCALE_NORMAL from OpenGL 1.2 on, GL_NORMALIZE
+ * before that
+ */
+static GLenum
+scRescale(GLvoid)
+{
+#ifdef GL_RESCALE_NORMAL
+  const char* version;
+  int major, minor;
+
+  version = (const char*)glGetString(GL_VERSION);
+  if (version && sscanf(version, "%d.%d", &major, &minor) == 2 &&
+      (major > 1 || minor >= 2))
+    return GL_RESCALE_NORMAL;
+#endif
+  return GL_NORMALIZE;
+}
+
+/* scDraw: draws a shape from its arrays, scale times the size it was
+ * built at
+ */
+static GLvoid
+scDraw(SCshape* shape, GLdouble scale)
+{
+  static GLenum rescale = 0;
+
+  if (!shape)
+    return;
+  if (scale != 1) {
+    if (!rescale)
+      rescale = scRescale();
+    glPushAttrib(GL_ENABLE_BIT);
+    glEnable(rescale);
+    glPushMatrix();
+    glScaled(scale, scale, scale);
+  }
+  glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+  glInterleavedArrays(GL_N3F_V3F, 0, shape->vertices);
+  glDrawElements(GL_TRIANGLES, shape->numindices, GL_UNSIGNED_INT,
+		 shape->indices);
+  glPopClientAttrib();
+  if (scale != 1) {
+    glPopMatrix();
+    glPopAttrib();
+  }
+}
+
+GLvoid
+scSolidSphere(GLdouble radius, GLint slices, GLint stacks)
+{
+  if (slices < 1 || stacks < 1)
+    return;
+  scDraw(scFind(SC_SPHERE, 0, slices, stacks), radius);
+}
+
+GLvoid
+scSolidTorus(GLdouble inner, GLdouble outer, GLint sides, GLint rings)
+{
+  if (sides < 1 || rings < 1 || outer == 0)
+    return;
+  scDraw(scFind(SC_TORUS, inner / outer, sides, rings), outer);
+}
+
+GLvoid
+scAutoSphere(GLdouble radius, GLint slices, GLint stacks)
+{
+  scDetail(radius, &slices, &stacks);
+  scSolidSphere(radius, slices, stacks);
+}
+
+GLvoid
+scAutoTorus(GLdouble inner, GLdouble outer, GLint sides, GLint rings)
+{
+  scDetail(inner + outer, &sides, &rings);
+  scSolidTorus(inner, outer, sides, rings);
+}
+
+GLvoid
+scDetail(GLdouble radius, GLint* slices, GLint* stacks)
+{
+  GLdouble modelview[16], projection[16];
+  GLint viewport[4];
+  GLdouble r, scale, outline;
+
+  glGetDoublev(GL_MODELVIEW_MATRIX, modelview);
+  glGetDoublev(GL_PROJECTION_MATRIX, projection);
+  glGetIntegerv(GL_VIEWPORT, viewport);
+
+  /* radius in eye coordinates, then in pixels, at the center's depth */
+  r = radius * sqrt(modelview[0] * modelview[0] +
+		    modelview[1] * modelview[1] +
+		    modelview[2] * modelview[2]);
+  scale = projection[0] * viewport[2];
+  if (projection[5] * viewport[3] > scale)
+    scale = projection[5] * viewport[3];
+  scale /= 2;
+  if (projection[11] != 0) {		/* perspective */
+    if (-modelview[14] <= r)		/* the eye is in it */
+      return;
+    scale /= -modelview[14];
+  }
+  outline = 2 * M_PI * r * fabs(scale);
+
+  while (*slices / 2 >= 6 && *stacks / 2 >= 3 &&
+	 *slices / 2 * SC_PIXELS >= outline) {
+    *slices /= 2;
+    *stacks /= 2;
+  }
+}
+
+GLvoid
+scFlush(GLvoid)
+{
+  SCshape* shape;
+  SCtable* table;
+
+  while (shapes) {
+    shape = shapes;
+    shapes = shape->next;
+    scFree(shape);
+  }
+  numshapes = 0;
+  while (tables) {
+    table = tables;
+    tables = table->next;
+    free(table->cos);
+    free(table->sin);
+    free(table);
+  }
+}
@@ -0,0 +1,83 @@
+/*
+      shapecache.h
+
+      Cached spheres and tori, for drawing the same few shapes over and
+      over without doing the trig and the glVertex calls every time.
+
+      Each (shape, slices, stacks) is built the first time it's asked
+      for, as an indexed vertex array of normals and vertices, from sin
+      and cos tables that are themselves built once for each number of
+      divisions and shared by every shape that uses them.  After that,
+      drawing it is one glDrawElements().  Shapes are built at radius
+      1 (tori keyed by inner over outer) and scaled to size on the
+      modelview matrix, with GL_RESCALE_NORMAL on (GL_NORMALIZE before
+      OpenGL 1.2), so spheres of every size share one.  At most
+      SC_SHAPES are kept; the one drawn least recently goes first.
+
+      The shapes are the ones glutSolidSphere() (which is gluSphere())
+      and glutSolidTorus() make, drawn as triangles where they used
+      quad strips.  scAutoSphere() and scAutoTorus() also look at how
+      big the shape will come out on the screen and halve the slices
+      and stacks while that leaves no more than a few pixels of outline
+      to a slice, so small, far away shapes are a handful of triangles.
+
+ */
+
+
+#include <GL/glut.h>
+
+
+/* scSolidSphere: Draws a sphere as glutSolidSphere() does, centered
+ * at the origin, from the cache.
+ *
+ * radius - radius of the sphere
+ * slices - divisions around the z axis (like lines of longitude)
+ * stacks - divisions along the z axis (like lines of latitude)
+ */
+GLvoid
+scSolidSphere(GLdouble radius, GLint slices, GLint stacks);
+
+/* scSolidTorus: Draws a torus as glutSolidTorus() does, about the z
+ * axis, from the cache.
+ *
+ * inner - radius of the tube
+ * outer - radius from the center to the middle of the tube
+ * sides - divisions around the tube
+ * rings - divisions around the z axis
+ */
+GLvoid
+scSolidTorus(GLdouble inner, GLdouble outer, GLint sides, GLint rings);
+
+/* scAutoSphere: Draws a sphere with at most slices x stacks, fewer
+ * the smaller it is on the screen, under the current modelview and
+ * projection matrices and viewport.
+ */
+GLvoid
+scAutoSphere(GLdouble radius, GLint slices, GLint stacks);
+
+/* scAutoTorus: Draws a torus with at most sides x rings, fewer the
+ * smaller it is on the screen.
+ */
+GLvoid
+scAutoTorus(GLdouble inner, GLdouble outer, GLint sides, GLint rings);
+
+/* scDetail: Halves *slices and *stacks for as long as a shape of the
+ * given radius about the origin, under the current matrices and
+ * viewport, would still have no more than SC_PIXELS pixels of outline
+ * to a slice; what scAutoSphere() and scAutoTorus() draw with.  Never
+ * goes below 6 slices or 3 stacks, or below where it started.
+ *
+ * radius - radius of a sphere around the shape
+ * slices - divisions around, halved in place
+ * stacks - divisions the other way, halved with slices
+ */
+GLvoid
+scDetail(GLdouble radius, GLint* slices, GLint* stacks);
+
+#define SC_PIXELS 6			/* most pixels to a slice */
+#define SC_SHAPES 64			/* most shapes cached, at least 2 */
+
+/* scFlush: Frees every cached shape and table.
+ */
+GLvoid
+scFlush(GLvoid);
@@ -0,0 +1,257 @@
+/*
+    spherebench.c
+
+    Times a scene of thousands of spheres drawn with gluSphere(), which
+    is what glutSolidSphere() calls, against shapecache.c: the same
+    spheres from the cache, and scAutoSphere() picking fewer slices
+    for the far ones.  Prints ms a frame (each over at least a quarter
+    of a second), triangles a frame, and how many pixels come out
+    different from the gluSphere() frame, at all and by more than 16
+    in some color.
+
+    Runs in a window that closes when it's done, or built with
+    -DSC_EGL (and -lEGL) with no window or display at all.
+
+    usage: spherebench [spheres [slices]]
+
+ */
+
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef SC_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+#include "shapecache.h"
+
+#ifdef _WIN32
+#include <windows.h>
+typedef int timer;
+#define getTime(a)      (a = GetTickCount())
+#define timeDiff(a, b)  ((b - a) * 1000)
+#else
+#include <sys/time.h>
+typedef struct timeval timer;
+#define getTime(a)      gettimeofday(&a, NULL)
+#define timeDiff(a, b)  (((b.tv_sec - a.tv_sec) * 1000000) + b.tv_usec - a.tv_usec)
+#endif
+
+#define SIZE   500
+#define RADIUS 0.4
+
+#define GLU    0
+#define CACHED 1
+#define AUTO   2
+
+char* names[] = { "gluSphere", "scSolidSphere", "scAutoSphere" };
+
+int spheres = 4096, slices = 24, across;
+GLUquadricObj* quadric;
+
+
+/* a field of spheres on a plane below the eye, going off into the
+   distance, drawn how says */
+void
+scene(int how)
+{
+  int i;
+
+  glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+  for (i = 0; i < spheres; i++) {
+    glPushMatrix();
+    glTranslatef((GLfloat)(i % across - across / 2), -1.5f,
+		 (GLfloat)(-3 - i / across));
+    if (how == GLU)
+      gluSphere(quadric, RADIUS, slices, slices);
+    else if (how == CACHED)
+      scSolidSphere(RADIUS, slices, slices);
+    else
+      scAutoSphere(RADIUS, slices, slices);
+    glPopMatrix();
+  }
+  glFinish();
+}
+
+/* triangles in a frame, counting the ones at the poles as none */
+long
+triangles(int how)
+{
+  int i, n, m;
+  long count = 0;
+
+  for (i = 0; i < spheres; i++) {
+    n = m = slices;
+    if (how == AUTO) {
+      glPushMatrix();
+      glTranslatef((GLfloat)(i % across - across / 2), -1.5f,
+		   (GLfloat)(-3 - i / across));
+      scDetail(RADIUS, &n, &m);
+      glPopMatrix();
+    }
+    count += 2 * n * (m - 1);
+  }
+  return count;
+}
+
+/* ms a frame */
+double
+frame(int how)
+{
+  timer t0, t1;
+  long n = 0, usec;
+
+  scene(how);			/* untimed, to build the cache */
+  getTime(t0);
+  do {
+    scene(how);
+    n++;
+    getTime(t1);
+    usec = timeDiff(t0, t1);
+  } while (usec < 250000);
+  return usec / 1000.0 / n;
+}
+
+void
+bench(void)
+{
+  GLfloat position[] = { 1.0, 2.0, 1.0, 0.0 };
+  GLubyte* first;
+  GLubyte* image;
+  int how, i, j, d, off, far;
+
+  glViewport(0, 0, SIZE, SIZE);
+  glMatrixMode(GL_PROJECTION);
+  glLoadIdentity();
+  gluPerspective(60.0, 1.0, 0.5, 200.0);
+  glMatrixMode(GL_MODELVIEW);
+  glLoadIdentity();
+  glLightfv(GL_LIGHT0, GL_POSITION, position);
+  glEnable(GL_LIGHTING);
+  glEnable(GL_LIGHT0);
+  glEnable(GL_DEPTH_TEST);
+  glEnable(GL_CULL_FACE);
+  glClearColor(0.0, 0.0, 0.0, 1.0);
+  glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+  quadric = gluNewQuadric();
+  first = (GLubyte*)malloc(SIZE * SIZE * 3);
+  image = (GLubyte*)malloc(SIZE * SIZE * 3);
+  if (!quadric || !first || !image) {
+    fprintf(stderr, "spherebench: out of memory\n");
+    exit(1);
+  }
+
+  printf("%d spheres of %d slices, %s\n", spheres, slices,
+	 glGetString(GL_RENDERER));
+  printf("%-14s %9s %10s %9s %9s\n", "", "ms", "triangles", "pixels",
+	 "> 16");
+  for (how = GLU; how <= AUTO; how++) {
+    printf("%-14s %9.2f %10ld", names[how], frame(how), triangles(how));
+    scene(how);
+    glReadPixels(0, 0, SIZE, SIZE, GL_RGB, GL_UNSIGNED_BYTE,
+		 how == GLU ? first : image);
+    if (how == GLU) {
+      printf(" %9s %9s\n", "-", "-");
+      continue;
+    }
+    off = far = 0;
+    for (i = 0; i < SIZE * SIZE; i++) {
+      d = 0;
+      for (j = 0; j < 3; j++)
+	if (abs(first[3 * i + j] - image[3 * i + j]) > d)
+	  d = abs(first[3 * i + j] - image[3 * i + j]);
+      off += d > 0;
+      far += d > 16;
+    }
+    printf(" %9d %9d\n", off, far);
+  }
+
+  gluDeleteQuadric(quadric);
+  scFlush();
+  free(first);
+  free(image);
+}
+
+#ifdef SC_EGL
+
+/* a context with no display; exits if there isn't one */
+void
+context(void)
+{
+  EGLint config[] = { EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+		      EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+		      EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8,
+		      EGL_DEPTH_SIZE, 16, EGL_NONE };
+  EGLint size[] = { EGL_WIDTH, SIZE, EGL_HEIGHT, SIZE, EGL_NONE };
+  PFNEGLGETPLATFORMDISPLAYEXTPROC platform;
+  EGLDisplay dpy;
+  EGLConfig cfg;
+  EGLSurface surface;
+  EGLContext ctx;
+  EGLint major, minor, n;
+
+  platform = (PFNEGLGETPLATFORMDISPLAYEXTPROC)
+    eglGetProcAddress("eglGetPlatformDisplayEXT");
+#ifdef EGL_PLATFORM_SURFACELESS_MESA
+  if (platform)
+    dpy = platform(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+  else
+#endif
+    dpy = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+  if (dpy == EGL_NO_DISPLAY || !eglInitialize(dpy, &major, &minor) ||
+      !eglBindAPI(EGL_OPENGL_API) ||
+      !eglChooseConfig(dpy, config, &cfg, 1, &n) || n < 1) {
+    fprintf(stderr, "spherebench: no EGL display\n");
+    exit(1);
+  }
+  surface = eglCreatePbufferSurface(dpy, cfg, size);
+  ctx = eglCreateContext(dpy, cfg, EGL_NO_CONTEXT, NULL);
+  if (surface == EGL_NO_SURFACE || ctx == EGL_NO_CONTEXT ||
+      !eglMakeCurrent(dpy, surface, surface, ctx)) {
+    fprintf(stderr, "spherebench: no EGL context\n");
+    exit(1);
+  }
+}
+
+#else
+
+void
+display(void)
+{
+  bench();
+  exit(0);
+}
+
+#endif
+
+int
+main(int argc, char** argv)
+{
+#ifndef SC_EGL
+  glutInit(&argc, argv);
+#endif
+  if (argc > 1)
+    spheres = atoi(argv[1]);
+  if (argc > 2)
+    slices = atoi(argv[2]);
+  if (spheres < 1)
+    spheres = 1;
+  if (slices < 6)
+    slices = 6;
+  across = (int)ceil(sqrt((double)spheres));
+
+#ifdef SC_EGL
+  context();
+  bench();
+#else
+  glutInitDisplayMode(GLUT_RGB | GLUT_DEPTH | GLUT_SINGLE);
+  glutInitWindowSize(SIZE, SIZE);
+  glutCreateWindow("spherebench");
+  glutDisplayFunc(display);
+  glutMainLoop();
+#endif
+  return 0;
+}
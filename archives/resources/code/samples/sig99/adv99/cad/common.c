@@ -180,6 +180,37 @@ static GLfloat specular[3] = {1.0f, 1.0f, 1.0f};
 
 
 
+/*
+ * reserveVertices
+ *
+ *	Make sure a growable vertex list has room for count vertices and
+ *	the end marker after them.
+ */
+
+void
+reserveVertices(Vertex **list, int *max, int count)
+{
+    Vertex *grown;
+    int n;
+
+    if (count < *max)
+	return;
+
+    n = (*max > 0) ? *max : 1024;
+    while (n <= count)
+	n *= 2;
+    grown = (Vertex *)realloc(*list, n * sizeof(Vertex));
+    if (grown == NULL) {
+	/* Out of memory, bail out gracefully */
+	fprintf(stderr, "Error, not enough memory for %d vertices\n", count);
+	exit(-1);
+    }
+    *list = grown;
+    *max = n;
+} /* End of reserveVertices */
+
+
+
 /*
  * buildCube
  *
@@ -232,6 +263,7 @@ static ColorStruct cubeColors[6] = {
 
     glFrontFace(GL_CCW);
     model->haveNormals = 1;
+    reserveVertices(&model->vertexList, &model->vertexMax, 6 * 4);
     for (i = 0; i < 6 * 4; i++) {
 	model->vertexList[i].draw = cubeData[i].draw;
 	model->vertexList[i].x = cubeData[i].x;
@@ -526,6 +558,9 @@ buildSphere(int tess)
     model->haveNormals = 1;
     model->vertexCount = 0;
 
+    /* Each of the eight strips has fewer than tess * tess vertices */
+    reserveVertices(&model->vertexList, &model->vertexMax, 8 * tess * tess);
+
     drawStrip(tess, 1, 1, 1);
 #if 1
     drawStrip(tess, 0, 1, 1);
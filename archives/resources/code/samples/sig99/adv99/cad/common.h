@@ -24,6 +24,7 @@ void setView(void);
 void setColor(const GLfloat *ambient, const GLfloat *diffuse,
     const GLfloat *specular, GLfloat shininess, GLboolean stereo);
 void setLights(int lights);
+void reserveVertices(Vertex **list, int *max, int count);
 FILE *fileOpen(const char *filename, const char *mode);
 void buildCube(void);
 GLuint buildSphere(int tess);
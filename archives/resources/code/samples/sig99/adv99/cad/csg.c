@@ -1,8 +1,11 @@
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <GL/glut.h>
 
+#include "csgtree.h"
+
 
 /*
  * Win32 math.h doesn't define M_PI. 
@@ -224,6 +227,15 @@ int curPrim = 0;
 int magicTranspHack = 0;
 
 
+void 
+transformPrim(struct transformation *xform)
+{
+    glTranslatef(xform->translation[0], xform->translation[1], xform->translation[2]);
+    glRotatef(xform->rotation[3] / M_PI * 180, xform->rotation[0], xform->rotation[1], xform->rotation[2]);
+    glScalef(xform->scale[0], xform->scale[1], xform->scale[2]);
+}
+
+
 void 
 drawPrim(int i)
 {
@@ -285,9 +297,7 @@ drawPrim(int i)
     /*
      * Do the local transformations 
      */
-    glTranslatef(xform->translation[0], xform->translation[1], xform->translation[2]);
-    glRotatef(xform->rotation[3] / M_PI * 180, xform->rotation[0], xform->rotation[1], xform->rotation[2]);
-    glScalef(xform->scale[0], xform->scale[1], xform->scale[2]);
+    transformPrim(xform);
 
     /*
      * Draw the motion cues for local-space transforms 
@@ -369,150 +379,44 @@ drawPrim(int i)
 }
 
 
-struct product {
-    int targetPrim;
-    int frontFace;
-    int whichSurface;
-    int numTrimPrims;
-    int *trimmingPrims;
-    int *isComplemented;
-};
+/*
+ * The CSG expressions, normalized once into products when the program
+ * starts; see csgtree.c.
+ */
+#define NUM_TREES 5
 
+CSGProduct *products[NUM_TREES];
+int numProducts[NUM_TREES];
 
-int prodAtrimmingPrims1[] =
-{1};
-int prodAisComplemented1[] =
-{1};
-int prodBtrimmingPrims1[] =
-{0};
-int prodBisComplemented1[] =
-{0};
-
-
-int prodAtrimmingPrims2[] =
-{1};
-int prodAisComplemented2[] =
-{0};
-int prodBtrimmingPrims2[] =
-{0};
-int prodBisComplemented2[] =
-{1};
-
-
-int prodAtrimmingPrims3[] =
-{1};
-int prodAisComplemented3[] =
-{0};
-int prodBtrimmingPrims3[] =
-{0};
-int prodBisComplemented3[] =
-{0};
-
-
-int prodAtrimmingPrims4[] =
-{1, 2, 3};
-int prodAisComplemented4[] =
-{0, 1, 1};
-int prodBtrimmingPrims4[] =
-{1, 0, 2};
-int prodBisComplemented4[] =
-{0, 0, 1};
-int prodCtrimmingPrims4[] =
-{1, 0, 3};
-int prodCisComplemented4[] =
-{0, 0, 1};
-int prodDtrimmingPrims4[] =
-{0, 2, 3};
-int prodDisComplemented4[] =
-{0, 1, 1};
-
-
-struct product products[][4] =
+
+void 
+buildTrees(void)
 {
-    {				/*
-				 * A - B 
-				 */
-	{
-	    0, 1, 0,
-	    1,
-	    prodAtrimmingPrims1,
-	    prodAisComplemented1,
-	},
-	{
-	    1, 0, 0,
-	    1,
-	    prodBtrimmingPrims1,
-	    prodBisComplemented1,
-	},
-    },
+    CSGNode *trees[NUM_TREES];
+    int i;
 
-    {				/*
-				 * B - A 
-				 */
-	{
-	    0, 0, 0,
-	    1,
-	    prodAtrimmingPrims2,
-	    prodAisComplemented2,
-	},
-	{
-	    1, 1, 0,
-	    1,
-	    prodBtrimmingPrims2,
-	    prodBisComplemented2,
-	},
-    },
+    /* A - B */
+    trees[0] = csgDifference(csgPrimitive(0), csgPrimitive(1));
 
-    {				/*
-				 * A and B 
-				 */
-	{
-	    0, 1, 0,
-	    1,
-	    prodAtrimmingPrims3,
-	    prodAisComplemented3,
-	},
-	{
-	    1, 1, 0,
-	    1,
-	    prodBtrimmingPrims3,
-	    prodBisComplemented3,
-	},
-    },
+    /* B - A */
+    trees[1] = csgDifference(csgPrimitive(1), csgPrimitive(0));
 
-    {				/*
-				 * A and B - D - C 
-				 */
-	{
-	    0, 1, 0,
-	    3,
-	    prodAtrimmingPrims4,
-	    prodAisComplemented4,
-	},
-	{
-	    3, 0, 0,
-	    3,
-	    prodBtrimmingPrims4,
-	    prodBisComplemented4,
-	},
-	{
-	    2, 0, 0,
-	    3,
-	    prodCtrimmingPrims4,
-	    prodCisComplemented4,
-	},
-	{
-	    1, 1, 0,
-	    3,
-	    prodDtrimmingPrims4,
-	    prodDisComplemented4,
-	},
-    },
-};
+    /* A and B */
+    trees[2] = csgIntersection(csgPrimitive(0), csgPrimitive(1));
 
+    /* A and B - D - C */
+    trees[3] = csgDifference(csgIntersection(csgPrimitive(0), csgPrimitive(1)),
+			     csgUnion(csgPrimitive(2), csgPrimitive(3)));
 
-int numProducts[4] =
-{2, 2, 2, 4};
+    /* (A or C) - (B or D) */
+    trees[4] = csgDifference(csgUnion(csgPrimitive(0), csgPrimitive(2)),
+			     csgUnion(csgPrimitive(1), csgPrimitive(3)));
+
+    for (i = 0; i < NUM_TREES; i++) {
+	products[i] = csgNormalize(trees[i], &numProducts[i]);
+	csgFreeTree(trees[i]);
+    }
+}
 
 
 int winWidth,
@@ -851,6 +755,8 @@ init(void)
     glLightModeli(GL_LIGHT_MODEL_TWO_SIDE, GL_TRUE);
 
     curXform = &prims[0].xform;
+
+    buildTrees();
 }
 
 
@@ -902,34 +808,205 @@ redrawNoCSG(void)
 int whereSoFar;
 
 
-GLfloat *depthResults = NULL;
+/*
+ * The depth buffer is saved between groups of products only over the
+ * window rectangle the earlier groups can have touched, and the copy is
+ * kept from frame to frame.  While nothing in the scene changes, as
+ * when stepping through the passes or switching the buffer of
+ * interest, the copy is still good and is not read back again.  There
+ * is a layer for each group the current tree needs, grown as trees with
+ * more products come along.
+ */
+struct depthLayer {
+    int valid;
+    GLint rect[4];		/* x, y, width, height */
+    GLfloat *depth;
+} *depthLayers;
+int numDepthLayers;
+
+
+struct sceneKey {
+    struct transformation global;
+    struct transformation xform[20];
+    void (*draw[20]) (void);
+    int tree;
+    int width, height;
+} lastScene;
+
+
+int passCount;
+int depthBytesRead;
+int reportStats = 0;
+
+
+int 
+sceneChanged(void)
+{
+    struct sceneKey key;
+    int i;
+
+    memset(&key, 0, sizeof(key));
+    key.global = globalXform;
+    for (i = 0; i < numPrims; i++) {
+	key.xform[i] = prims[i].xform;
+	key.draw[i] = prims[i].draw;
+    }
+    key.tree = whichTree;
+    key.width = winWidth;
+    key.height = winHeight;
+
+    if (memcmp(&key, &lastScene, sizeof(key)) == 0)
+	return FALSE;
+
+    lastScene = key;
+    for (i = 0; i < numDepthLayers; i++)
+	depthLayers[i].valid = FALSE;
+    return TRUE;
+}
+
+
+/*
+ * growDepthLayers
+ *
+ *	Make room for a depth layer for each of groups groups of products.
+ *	If there isn't the memory, the layers there are stay and only that
+ *	many groups get drawn.
+ */
+void 
+growDepthLayers(int groups)
+{
+    struct depthLayer *layers;
+
+    if (groups <= numDepthLayers)
+	return;
+    layers = realloc(depthLayers, groups * sizeof(struct depthLayer));
+    if (layers == NULL) {
+	printf("not enough memory for %d groups of products, "
+	       "drawing the first %d\n", groups, numDepthLayers);
+	return;
+    }
+    memset(layers + numDepthLayers, 0,
+	   (groups - numDepthLayers) * sizeof(struct depthLayer));
+    depthLayers = layers;
+    numDepthLayers = groups;
+}
 
 
+/*
+ * primScreenRect
+ *
+ *	Grow rect (x0, y0, x1, y1) by the window bounds of a primitive.
+ *	All primitives fit in the cube from -1 to 1 before their local
+ *	transformation.
+ */
 void 
-saveDepth(void)
+primScreenRect(int i, int rect[4])
 {
-    depthResults = realloc(depthResults, winWidth * winHeight *
+    GLfloat mv[16], proj[16], e[4], c[4];
+    int j, k, x, y;
+
+    glPushMatrix();
+    transformPrim(&prims[i].xform);
+    glGetFloatv(GL_MODELVIEW_MATRIX, mv);
+    glPopMatrix();
+    glGetFloatv(GL_PROJECTION_MATRIX, proj);
+
+    for (j = 0; j < 8; j++) {
+	float v[3];
+
+	v[0] = (j & 1) ? 1.0f : -1.0f;
+	v[1] = (j & 2) ? 1.0f : -1.0f;
+	v[2] = (j & 4) ? 1.0f : -1.0f;
+	for (k = 0; k < 4; k++)
+	    e[k] = mv[k] * v[0] + mv[4 + k] * v[1] + mv[8 + k] * v[2] + mv[12 + k];
+	for (k = 0; k < 4; k++)
+	    c[k] = proj[k] * e[0] + proj[4 + k] * e[1] + proj[8 + k] * e[2] +
+		proj[12 + k] * e[3];
+
+	if (c[3] <= 0.0f) {	/* behind the eye, take the whole window */
+	    rect[0] = rect[1] = 0;
+	    rect[2] = winWidth;
+	    rect[3] = winHeight;
+	    return;
+	}
+	x = (int) ((c[0] / c[3] * .5f + .5f) * winWidth);
+	y = (int) ((c[1] / c[3] * .5f + .5f) * winHeight);
+	if (x < rect[0])
+	    rect[0] = x;
+	if (y < rect[1])
+	    rect[1] = y;
+	if (x + 1 > rect[2])
+	    rect[2] = x + 1;
+	if (y + 1 > rect[3])
+	    rect[3] = y + 1;
+    }
+}
+
+
+void 
+saveDepth(int group, int firstProduct)
+{
+    struct depthLayer *layer = &depthLayers[group];
+    int rect[4];
+    int i;
+
+    if (layer->valid)
+	return;
+
+    /*
+     * Only products already drawn have written depth 
+     */
+    rect[0] = winWidth;
+    rect[1] = winHeight;
+    rect[2] = rect[3] = 0;
+    for (i = 0; i < firstProduct; i++)
+	primScreenRect(products[whichTree][i].targetPrim, rect);
+    if (rect[0] < 0)
+	rect[0] = 0;
+    if (rect[1] < 0)
+	rect[1] = 0;
+    if (rect[2] > winWidth)
+	rect[2] = winWidth;
+    if (rect[3] > winHeight)
+	rect[3] = winHeight;
+
+    layer->rect[0] = rect[0];
+    layer->rect[1] = rect[1];
+    layer->rect[2] = rect[2] > rect[0] ? rect[2] - rect[0] : 0;
+    layer->rect[3] = rect[3] > rect[1] ? rect[3] - rect[1] : 0;
+    layer->depth = realloc(layer->depth, (layer->rect[2] * layer->rect[3] + 1) *
 			   sizeof(GLfloat));
-    glReadPixels(0, 0, winWidth, winHeight, GL_DEPTH_COMPONENT, GL_FLOAT,
-		 depthResults);
+
+    if (layer->rect[2] > 0 && layer->rect[3] > 0)
+	glReadPixels(layer->rect[0], layer->rect[1], layer->rect[2],
+		     layer->rect[3], GL_DEPTH_COMPONENT, GL_FLOAT, layer->depth);
+    depthBytesRead += layer->rect[2] * layer->rect[3] * sizeof(GLfloat);
+    layer->valid = TRUE;
 }
 
 
 void 
-restoreDepth(void)
+restoreDepth(int group)
 {
+    struct depthLayer *layer = &depthLayers[group];
+
     glStencilMask(0);
     glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
     glDepthMask(GL_TRUE);
+    glClear(GL_DEPTH_BUFFER_BIT);
+    if (layer->rect[2] == 0 || layer->rect[3] == 0)
+	return;
+
     glEnable(GL_DEPTH_TEST);
     glDepthFunc(GL_ALWAYS);
     glDisable(GL_STENCIL_TEST);
 
     pushOrthoView(0, 1, 0, 1, 0, 1);
-    glRasterPos3f(0, 0, -.5);
+    glRasterPos3f((float) layer->rect[0] / winWidth,
+		  (float) layer->rect[1] / winHeight, -.5);
 
-    glDrawPixels(winWidth, winHeight, GL_DEPTH_COMPONENT, GL_FLOAT,
-		 depthResults);
+    glDrawPixels(layer->rect[2], layer->rect[3], GL_DEPTH_COMPONENT, GL_FLOAT,
+		 layer->depth);
 
     popView();
 }
@@ -1024,6 +1101,7 @@ renderPrimDepths(int targetPrim, int frontFace, int whichSurface)
     glStencilOp(GL_INCR, GL_INCR, GL_INCR);
 
     drawPrim(targetPrim);
+    passCount++;
 
     return (CONTINUE);
 }
@@ -1060,6 +1138,7 @@ trimWithPrimitive(int trimPrim, int isComplemented)
     glStencilFunc(GL_ALWAYS, 0, 0);
     glStencilOp(GL_KEEP, GL_KEEP, GL_INVERT);
     drawPrim(trimPrim);
+    passCount++;
 
     COPY_AND_RETURN_IF_DONE("After setting stencil to mark depths "
 			    "inside trimming primitive");
@@ -1078,6 +1157,7 @@ trimWithPrimitive(int trimPrim, int isComplemented)
     glDisable(GL_LIGHTING);
     drawFarRect();
     glEnable(GL_LIGHTING);
+    passCount++;
 
     COPY_AND_RETURN_IF_DONE("After clearing depths where target outside "
 			    "trimming primitive");
@@ -1091,7 +1171,7 @@ markProductPixels(int product, int accumBit)
 {
     int i;
 
-    struct product *p;
+    CSGProduct *p;
 
     p = &products[whichTree][product];
 
@@ -1119,6 +1199,7 @@ markProductPixels(int product, int accumBit)
     glDisable(GL_LIGHTING);
     drawFarRect();
     glEnable(GL_LIGHTING);
+    passCount++;
 
     COPY_AND_RETURN_IF_DONE("After setting accumulator where depths != far");
 
@@ -1129,7 +1210,7 @@ markProductPixels(int product, int accumBit)
 progressEnum 
 drawProduct(int product, int accumBit)
 {
-    struct product *p;
+    CSGProduct *p;
     p = &products[whichTree][product];
 
     glEnable(GL_CULL_FACE);
@@ -1146,6 +1227,7 @@ drawProduct(int product, int accumBit)
     glStencilFunc(GL_EQUAL, 1 << accumBit, 1 << accumBit);
     glStencilOp(GL_KEEP, GL_KEEP, GL_KEEP);
     drawPrim(p->targetPrim);
+    passCount++;
 
     COPY_AND_RETURN_IF_DONE("After drawing target color and depth");
 
@@ -1160,8 +1242,16 @@ redrawCSG(void)
     int accumBit;
     int firstProduct;
     int lastProduct;
+    int group;
+    int changed;
+    int startTime;
 
     whereSoFar = 0;
+    passCount = 0;
+    depthBytesRead = 0;
+    changed = sceneChanged();
+    startTime = glutGet(GLUT_ELAPSED_TIME);
+
     glDepthMask(GL_TRUE);
     glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
     glClear(GL_COLOR_BUFFER_BIT);
@@ -1181,9 +1271,16 @@ redrawCSG(void)
     glTranslatef(globalXform.translation[0], globalXform.translation[1], globalXform.translation[2]);
     glRotatef(globalXform.rotation[3] / M_PI * 180, globalXform.rotation[0], globalXform.rotation[1], globalXform.rotation[2]);
 
+    /*
+     * Each group takes as many products as fit in the stencil buffer
+     * after the surface counting bit
+     */
+    growDepthLayers((numProducts[whichTree] + stenSize - 2) / (stenSize - 1));
+
     firstProduct = 0;
+    group = 0;
 
-    while (firstProduct != numProducts[whichTree]) {
+    while (firstProduct != numProducts[whichTree] && group < numDepthLayers) {
 
 	/*
 	 * set lastProduct so that accum bits for first to last fit in
@@ -1196,7 +1293,7 @@ redrawCSG(void)
 	if (firstProduct > 0)	/*
 				 * know depth is clear before 1st group 
 				 */
-	    saveDepth();
+	    saveDepth(group, firstProduct);
 
 	accumBit = 1;		/*
 				 * first available after counting bits 
@@ -1211,7 +1308,7 @@ redrawCSG(void)
 	if (firstProduct > 0)	/*
 				 * know depth was clear before first group 
 				 */
-	    restoreDepth();
+	    restoreDepth(group);
 	else {
 	    glDepthMask(GL_TRUE);
 	    glClear(GL_DEPTH_BUFFER_BIT);
@@ -1228,6 +1325,7 @@ redrawCSG(void)
 	COPY_AND_GOTO_IF_DONE("After drawing all target colors and depths");
 
 	firstProduct = lastProduct + 1;
+	group++;
     }
 
     if (showSurfaces) {
@@ -1238,7 +1336,7 @@ redrawCSG(void)
 	glEnable(GL_BLEND);
 	magicTranspHack = 1;
 	for (i = 0; i < numProducts[whichTree]; i++) {
-	    struct product *p;
+	    CSGProduct *p;
 	    p = &products[whichTree][i];
 
 	    if (i == curPrim || !showOnlyCurrent)
@@ -1251,6 +1349,14 @@ redrawCSG(void)
 
     glPopMatrix();
 
+    if (reportStats) {
+	glFinish();
+	printf("%d products, %d passes, %d bytes of depth read%s, %d ms\n",
+	       numProducts[whichTree], passCount, depthBytesRead,
+	       changed ? "" : " (cached)",
+	       glutGet(GLUT_ELAPSED_TIME) - startTime);
+    }
+
     copyInterest();
     glutSwapBuffers();
 }
@@ -1304,6 +1410,7 @@ keyboard(unsigned char key, int x, int y)
     case '2':
     case '3':
     case '4':
+    case '5':
 	whichTree = key - '1';
 	glutPostRedisplay();
 	break;
@@ -1395,6 +1502,10 @@ keyboard(unsigned char key, int x, int y)
     case ' ':
 	showOnlyCurrent = !showOnlyCurrent;
 	break;
+
+    case 'p':
+	reportStats = !reportStats;
+	break;
     }
     glutPostRedisplay();
 
@@ -1630,6 +1741,7 @@ main(int argc, char **argv)
     printf("%d bits of stencil available in this visual\n", (int)stenSize);
 
     printf("Hit 'S' to turn stencil on/off\n");
+    printf("Hit 'p' to print passes and time per CSG frame\n");
 
     bufferMenu = glutCreateMenu(interestBufferFunc);
     glutAddMenuEntry("Color data", COLOR);
@@ -1642,6 +1754,7 @@ main(int argc, char **argv)
     glutAddMenuEntry("obj 2 MINUS obj 1 ('2')", 1);
     glutAddMenuEntry("obj 1 AND obj 2 ('3')", 2);
     glutAddMenuEntry("(obj 1 AND obj 2) MINUS (obj 3 or obj 4) ('4')", 3);
+    glutAddMenuEntry("(obj 1 OR obj 3) MINUS (obj 2 or obj 4) ('5')", 4);
 
     whichObjectMenu = glutCreateMenu(whichObjectFunc);
     glutAddMenuEntry("Global ('g')", 4);
@@ -0,0 +1,275 @@
+/*
+ * csgbench.c
+ *
+ *	Headless benchmark of the CSG expression module.  A row of sphere
+ *	pairs is combined into two kinds of part: a union of differences,
+ *	where each term has two primitives, and a plate drilled by every
+ *	other sphere, where the single term grows with the primitive count.
+ *	The spheres are scan converted into nearest and farthest depth
+ *	layers on the CPU, and the expression is resolved from the layers:
+ *
+ *	    rebuilt   every layer is scan converted again each frame, as
+ *	              the stencil algorithm draws every primitive again
+ *	    cached    the view is unchanged, only the layers are resolved
+ *	    edited    one primitive moves each frame and only its layers
+ *	              are scan converted again
+ *
+ *	The passes column is what the stencil algorithm in csg.c needs
+ *	for the same expression.
+ *
+ *	Usage: csgbench [frames]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "csgtree.h"
+
+/* For platform-independent timing */
+#ifdef _WIN32
+    #include <windows.h>
+    typedef int timer;
+    #define getTime(a)      (a = GetTickCount())
+    #define timeDiff(a, b)  ((b - a) * 1000)
+#else
+    #include <sys/time.h>
+    typedef struct timeval timer;
+    #define getTime(a)      gettimeofday(&a, NULL)
+    #define timeDiff(a, b)  (((b.tv_sec - a.tv_sec) * 1000000) + b.tv_usec - a.tv_usec)
+#endif
+
+#define WIDTH 256
+#define HEIGHT 256
+#define DEPTH_RANGE 256.0f		/* eye space z mapped to [0,1] */
+#define MAX_PRIMS 128
+
+static float center[MAX_PRIMS][3];
+static float radius[MAX_PRIMS];
+static float *front[MAX_PRIMS];
+static float *back[MAX_PRIMS];
+static float depth[WIDTH * HEIGHT];
+
+
+
+/*
+ * scanSphere
+ *
+ *	Fill in the two depth layers of a sphere under an orthographic
+ *	view down the z axis.  Only the square around the sphere is
+ *	written beyond clearing the layers.
+ */
+
+static void
+scanSphere(int i)
+{
+    float *f = front[i], *b = back[i];
+    float r = radius[i], dx, dy, h, d2;
+    int x, y, x0, x1, y0, y1;
+
+    for (x = 0; x < WIDTH * HEIGHT; x++)
+	f[x] = b[x] = 1.0f;
+
+    x0 = (int)floor(center[i][0] - r);
+    x1 = (int)ceil(center[i][0] + r);
+    y0 = (int)floor(center[i][1] - r);
+    y1 = (int)ceil(center[i][1] + r);
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > WIDTH - 1) x1 = WIDTH - 1;
+    if (y1 > HEIGHT - 1) y1 = HEIGHT - 1;
+
+    for (y = y0; y <= y1; y++) {
+	dy = y + 0.5f - center[i][1];
+	for (x = x0; x <= x1; x++) {
+	    dx = x + 0.5f - center[i][0];
+	    d2 = r * r - dx * dx - dy * dy;
+	    if (d2 <= 0.0f)
+		continue;
+	    h = (float)sqrt(d2);
+	    f[y * WIDTH + x] = 0.5f - (center[i][2] + h) / (2.0f * DEPTH_RANGE);
+	    b[y * WIDTH + x] = 0.5f - (center[i][2] - h) / (2.0f * DEPTH_RANGE);
+	}
+    }
+}
+
+
+
+/*
+ * placeSpheres
+ *
+ *	Pairs of overlapping spheres spread over the image; the second of
+ *	each pair is smaller and sits in front, so it bites into the first.
+ */
+
+static void
+placeSpheres(int n)
+{
+    int i, pairs = (n + 1) / 2, columns;
+    float cell;
+
+    columns = (int)ceil(sqrt((double)pairs));
+    cell = (float)WIDTH / columns;
+    for (i = 0; i < n; i++) {
+	int pair = i / 2;
+
+	center[i][0] = (pair % columns + 0.5f) * cell;
+	center[i][1] = (pair / columns + 0.5f) * cell;
+	center[i][2] = 0.0f;
+	radius[i] = cell * 0.4f;
+	if (i & 1) {
+	    center[i][0] += cell * 0.2f;
+	    center[i][1] += cell * 0.1f;
+	    center[i][2] = cell * 0.3f;
+	    radius[i] = cell * 0.25f;
+	}
+    }
+}
+
+
+
+/* (S0 - S1) + (S2 - S3) + ... */
+static CSGNode *
+unionOfDifferences(int n)
+{
+    CSGNode *tree = NULL, *term;
+    int i;
+
+    for (i = 0; i + 1 < n; i += 2) {
+	term = csgDifference(csgPrimitive(i), csgPrimitive(i + 1));
+	tree = tree ? csgUnion(tree, term) : term;
+    }
+    return tree;
+}
+
+
+/* One large plate (S0 and a box-like S1) minus all the other spheres */
+static CSGNode *
+drilledPlate(int n)
+{
+    CSGNode *tree, *holes = NULL;
+    int i;
+
+    tree = csgIntersection(csgPrimitive(0), csgPrimitive(1));
+    for (i = 2; i < n; i++)
+	holes = holes ? csgUnion(holes, csgPrimitive(i)) : csgPrimitive(i);
+    return holes ? csgDifference(tree, holes) : tree;
+}
+
+
+static void
+placePlate(int n)
+{
+    int i;
+
+    /* Two big spheres whose lens is the plate, drilled by small ones */
+    center[0][0] = WIDTH * 0.5f;
+    center[0][1] = HEIGHT * 0.5f;
+    center[0][2] = -WIDTH * 0.9f;
+    radius[0] = WIDTH;
+    center[1][0] = WIDTH * 0.5f;
+    center[1][1] = HEIGHT * 0.5f;
+    center[1][2] = WIDTH * 0.9f;
+    radius[1] = WIDTH;
+    for (i = 2; i < n; i++) {
+	center[i][0] = (float)(rand() % WIDTH);
+	center[i][1] = (float)(rand() % HEIGHT);
+	center[i][2] = 0.0f;
+	radius[i] = WIDTH * (0.02f + 0.04f * rand() / RAND_MAX);
+    }
+}
+
+
+
+static void
+run(const char *name, CSGNode *tree, int n, int frames)
+{
+    CSGProduct *products;
+    int count, i, frame;
+    long tRebuild = 0, tCached = 0, tEdited = 0;
+    timer start, stop;
+
+    products = csgNormalize(tree, &count);
+
+    getTime(start);
+    for (frame = 0; frame < frames; frame++) {
+	for (i = 0; i < n; i++)
+	    scanSphere(i);
+	csgEvaluateLayers(products, count, front, back, WIDTH * HEIGHT,
+	    depth, NULL);
+    }
+    getTime(stop);
+    tRebuild = timeDiff(start, stop);
+
+    getTime(start);
+    for (frame = 0; frame < frames; frame++)
+	csgEvaluateLayers(products, count, front, back, WIDTH * HEIGHT,
+	    depth, NULL);
+    getTime(stop);
+    tCached = timeDiff(start, stop);
+
+    getTime(start);
+    for (frame = 0; frame < frames; frame++) {
+	i = frame % n;
+	center[i][2] += (frame & 1) ? -1.0f : 1.0f;
+	scanSphere(i);
+	csgEvaluateLayers(products, count, front, back, WIDTH * HEIGHT,
+	    depth, NULL);
+    }
+    getTime(stop);
+    tEdited = timeDiff(start, stop);
+
+    printf("%-12s %5d %8d %8d %10.3f %10.3f %10.3f\n", name, n, count,
+	csgPasses(products, count), tRebuild / 1000.0 / frames,
+	tCached / 1000.0 / frames, tEdited / 1000.0 / frames);
+
+    csgFreeProducts(products, count);
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+    int frames = 20, n, i;
+    CSGNode *tree;
+
+    if (argc > 1)
+	frames = atoi(argv[1]);
+
+    for (i = 0; i < MAX_PRIMS; i++) {
+	front[i] = (float *)malloc(WIDTH * HEIGHT * sizeof(float));
+	back[i] = (float *)malloc(WIDTH * HEIGHT * sizeof(float));
+	if (front[i] == NULL || back[i] == NULL) {
+	    printf("Not enough memory for the depth layers\n");
+	    exit(1);
+	}
+    }
+
+    printf("%dx%d, %d frames, ms/frame\n", WIDTH, HEIGHT, frames);
+    printf("%-12s %5s %8s %8s %10s %10s %10s\n", "expression", "prims",
+	"products", "passes", "rebuilt", "cached", "edited");
+
+    for (n = 4; n <= MAX_PRIMS; n *= 2) {
+	placeSpheres(n);
+	tree = unionOfDifferences(n);
+	run("differences", tree, n, frames);
+	csgFreeTree(tree);
+    }
+
+    srand(1);
+    for (n = 4; n <= MAX_PRIMS; n *= 2) {
+	placePlate(n);
+	tree = drilledPlate(n);
+	run("plate", tree, n, frames);
+	csgFreeTree(tree);
+    }
+
+    for (i = 0; i < MAX_PRIMS; i++) {
+	free(front[i]);
+	free(back[i]);
+    }
+    return 0;
+}
+
+/* End of csgbench.c */
@@ -0,0 +1,407 @@
+/*
+ * csgtree.c
+ *
+ *	CSG expressions, their sum-of-products normal form and the
+ *	evaluation of cached depth layers.  See csgtree.h.
+ *
+ *	Normalization pushes complements down to the primitives with De
+ *	Morgan's laws and distributes intersection over union.  A term is
+ *	kept as a small set of literals, the primitive number times two
+ *	plus one if it is complemented.  The normal form of a large tree
+ *	can be exponential in its size; CAD parts built by the demos stay
+ *	far below CSG_MAX_LITERALS literals per term.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "csgtree.h"
+
+#define CSG_MAX_LITERALS 128
+
+enum { CSG_PRIMITIVE, CSG_UNION, CSG_INTERSECTION, CSG_DIFFERENCE };
+
+struct CSGNode {
+    int op;
+    int prim;
+    CSGNode *a, *b;
+};
+
+typedef struct Term {
+    int count;
+    int literal[CSG_MAX_LITERALS];
+} Term;
+
+typedef struct TermList {
+    int count, max;
+    Term *term;
+} TermList;
+
+
+
+static CSGNode *
+newNode(int op, int prim, CSGNode *a, CSGNode *b)
+{
+    CSGNode *node;
+
+    node = (CSGNode *)malloc(sizeof(CSGNode));
+    if (node == NULL)
+	return NULL;
+    node->op = op;
+    node->prim = prim;
+    node->a = a;
+    node->b = b;
+    return node;
+}
+
+
+CSGNode *
+csgPrimitive(int prim)
+{
+    return newNode(CSG_PRIMITIVE, prim, NULL, NULL);
+}
+
+
+CSGNode *
+csgUnion(CSGNode *a, CSGNode *b)
+{
+    return newNode(CSG_UNION, -1, a, b);
+}
+
+
+CSGNode *
+csgIntersection(CSGNode *a, CSGNode *b)
+{
+    return newNode(CSG_INTERSECTION, -1, a, b);
+}
+
+
+CSGNode *
+csgDifference(CSGNode *a, CSGNode *b)
+{
+    return newNode(CSG_DIFFERENCE, -1, a, b);
+}
+
+
+void
+csgFreeTree(CSGNode *node)
+{
+    if (node == NULL)
+	return;
+    csgFreeTree(node->a);
+    csgFreeTree(node->b);
+    free(node);
+}
+
+
+
+/*
+ * addTerm
+ *
+ *	Append a term to a list, unless it is empty (contains a primitive
+ *	and its complement) or already present.
+ */
+
+static int
+addTerm(TermList *list, const Term *t)
+{
+    int i, j;
+
+    for (i = 0; i < t->count; i++)
+	for (j = 0; j < t->count; j++)
+	    if (t->literal[i] == (t->literal[j] ^ 1))
+		return 1;
+
+    for (i = 0; i < list->count; i++) {
+	if (list->term[i].count == t->count &&
+	    memcmp(list->term[i].literal, t->literal,
+		t->count * sizeof(int)) == 0)
+	    return 1;
+    }
+
+    if (list->count == list->max) {
+	Term *grown;
+	int max = list->max ? list->max * 2 : 8;
+
+	grown = (Term *)realloc(list->term, max * sizeof(Term));
+	if (grown == NULL)
+	    return 0;
+	list->term = grown;
+	list->max = max;
+    }
+    list->term[list->count++] = *t;
+    return 1;
+}
+
+
+
+/*
+ * mergeTerms
+ *
+ *	Intersection of two terms: the sorted union of their literals.
+ */
+
+static int
+mergeTerms(Term *r, const Term *a, const Term *b)
+{
+    int i = 0, j = 0;
+
+    r->count = 0;
+    while (i < a->count || j < b->count) {
+	int l;
+
+	if (j == b->count || (i < a->count && a->literal[i] < b->literal[j]))
+	    l = a->literal[i++];
+	else if (i == a->count || b->literal[j] < a->literal[i])
+	    l = b->literal[j++];
+	else {
+	    l = a->literal[i++];
+	    j++;
+	}
+	if (r->count == CSG_MAX_LITERALS)
+	    return 0;
+	r->literal[r->count++] = l;
+    }
+    return 1;
+}
+
+
+
+static int
+concatLists(TermList *r, const TermList *a, const TermList *b)
+{
+    int i;
+
+    for (i = 0; i < a->count; i++)
+	if (!addTerm(r, &a->term[i]))
+	    return 0;
+    for (i = 0; i < b->count; i++)
+	if (!addTerm(r, &b->term[i]))
+	    return 0;
+    return 1;
+}
+
+
+static int
+crossLists(TermList *r, const TermList *a, const TermList *b)
+{
+    Term t;
+    int i, j;
+
+    for (i = 0; i < a->count; i++) {
+	for (j = 0; j < b->count; j++) {
+	    if (!mergeTerms(&t, &a->term[i], &b->term[j]))
+		return 0;
+	    if (!addTerm(r, &t))
+		return 0;
+	}
+    }
+    return 1;
+}
+
+
+
+/*
+ * collectTerms
+ *
+ *	Sum of products of a subtree, or of its complement when negate is
+ *	set.  Returns 0 when out of memory or a term grows too long.
+ */
+
+static int
+collectTerms(const CSGNode *node, int negate, TermList *r)
+{
+    TermList a, b;
+    int ok, join;
+    Term t;
+
+    if (node->op == CSG_PRIMITIVE) {
+	t.count = 1;
+	t.literal[0] = node->prim * 2 + negate;
+	return addTerm(r, &t);
+    }
+
+    memset(&a, 0, sizeof(a));
+    memset(&b, 0, sizeof(b));
+
+    /* A - B is A and not B; complements swap union and intersection */
+    switch (node->op) {
+    case CSG_UNION:
+	ok = collectTerms(node->a, negate, &a) &&
+	    collectTerms(node->b, negate, &b);
+	join = negate;
+	break;
+    case CSG_INTERSECTION:
+	ok = collectTerms(node->a, negate, &a) &&
+	    collectTerms(node->b, negate, &b);
+	join = !negate;
+	break;
+    default:
+	ok = collectTerms(node->a, negate, &a) &&
+	    collectTerms(node->b, !negate, &b);
+	join = !negate;
+	break;
+    }
+
+    if (ok)
+	ok = join ? crossLists(r, &a, &b) : concatLists(r, &a, &b);
+
+    free(a.term);
+    free(b.term);
+    return ok;
+}
+
+
+
+/*
+ * csgNormalize
+ *
+ *	Build the product list of a tree.  A term of n literals yields n
+ *	products, one per primitive whose surface may bound the term.
+ */
+
+CSGProduct *
+csgNormalize(const CSGNode *tree, int *count)
+{
+    TermList terms;
+    CSGProduct *products, *p;
+    int i, j, k, n, total, positive;
+
+    *count = 0;
+    if (tree == NULL)
+	return NULL;
+
+    memset(&terms, 0, sizeof(terms));
+    if (!collectTerms(tree, 0, &terms)) {
+	free(terms.term);
+	return NULL;
+    }
+
+    total = 0;
+    for (i = 0; i < terms.count; i++)
+	total += terms.term[i].count;
+    products = (CSGProduct *)calloc(total ? total : 1, sizeof(CSGProduct));
+    if (products == NULL) {
+	free(terms.term);
+	return NULL;
+    }
+
+    n = 0;
+    for (i = 0; i < terms.count; i++) {
+	Term *t = &terms.term[i];
+
+	/* Only a term with an uncomplemented primitive is bounded */
+	positive = 0;
+	for (j = 0; j < t->count; j++)
+	    if ((t->literal[j] & 1) == 0)
+		positive = 1;
+	if (!positive)
+	    continue;
+
+	for (j = 0; j < t->count; j++) {
+	    p = &products[n++];
+	    p->targetPrim = t->literal[j] >> 1;
+	    p->frontFace = !(t->literal[j] & 1);
+	    p->whichSurface = 0;
+	    p->numTrimPrims = 0;
+	    p->trimmingPrims = (int *)malloc((t->count + 1) * sizeof(int));
+	    p->isComplemented = (int *)malloc((t->count + 1) * sizeof(int));
+	    if (p->trimmingPrims == NULL || p->isComplemented == NULL) {
+		csgFreeProducts(products, n);
+		free(terms.term);
+		return NULL;
+	    }
+	    for (k = 0; k < t->count; k++) {
+		if (k == j)
+		    continue;
+		p->trimmingPrims[p->numTrimPrims] = t->literal[k] >> 1;
+		p->isComplemented[p->numTrimPrims] = t->literal[k] & 1;
+		p->numTrimPrims++;
+	    }
+	}
+    }
+
+    free(terms.term);
+    if (n == 0) {
+	free(products);
+	return NULL;
+    }
+    *count = n;
+    return products;
+}
+
+
+void
+csgFreeProducts(CSGProduct *products, int count)
+{
+    int i;
+
+    if (products == NULL)
+	return;
+    for (i = 0; i < count; i++) {
+	free(products[i].trimmingPrims);
+	free(products[i].isComplemented);
+    }
+    free(products);
+}
+
+
+int
+csgPasses(const CSGProduct *products, int count)
+{
+    int i, passes = 0;
+
+    for (i = 0; i < count; i++)
+	passes += 1 + 2 * products[i].numTrimPrims + 2;
+    return passes;
+}
+
+
+
+/*
+ * csgEvaluateLayers
+ *
+ *	For each product in turn, keep the pixels where the target surface
+ *	is nearer than anything found so far and lies inside (or outside,
+ *	if complemented) every trimming primitive.  A product at a time
+ *	walks the layers in order, which is what the cache wants.
+ */
+
+void
+csgEvaluateLayers(const CSGProduct *products, int count,
+    float *const *front, float *const *back, int pixels,
+    float *depth, int *prim)
+{
+    const CSGProduct *p;
+    const float *surface;
+    float z;
+    int i, j, q, inside;
+
+    for (i = 0; i < pixels; i++)
+	depth[i] = 1.0f;
+    if (prim != NULL)
+	for (i = 0; i < pixels; i++)
+	    prim[i] = -1;
+
+    for (p = products; p < products + count; p++) {
+	surface = p->frontFace ? front[p->targetPrim] : back[p->targetPrim];
+	for (i = 0; i < pixels; i++) {
+	    z = surface[i];
+	    if (z >= depth[i])
+		continue;
+	    for (j = 0; j < p->numTrimPrims; j++) {
+		q = p->trimmingPrims[j];
+		inside = front[q][i] < z && z < back[q][i];
+		if (inside == p->isComplemented[j])
+		    break;
+	    }
+	    if (j < p->numTrimPrims)
+		continue;
+	    depth[i] = z;
+	    if (prim != NULL)
+		prim[i] = p->targetPrim;
+	}
+    }
+}
+
+/* End of csgtree.c */
@@ -0,0 +1,68 @@
+/*
+ * csgtree.h
+ *
+ *	Header of the CSG expression module.
+ *
+ *	A CSG tree of union, intersection and difference nodes is
+ *	normalized once into a sum of products: a union of terms, each
+ *	the intersection of primitives and complemented primitives.  Every
+ *	primitive of a term becomes one product in the list handed to the
+ *	renderer.  Its front faces (or back faces, when the primitive is
+ *	complemented in the term) are the candidate surface, trimmed
+ *	against the other primitives of the term.
+ *
+ *	csgEvaluateLayers is the CPU counterpart of the stencil algorithm
+ *	for convex primitives.  Given each primitive's nearest and farthest
+ *	depth per pixel, cached while the view does not change, it finds
+ *	the visible surface of the whole expression without rendering
+ *	anything again.
+ */
+
+#ifndef CSGTREE_MODULE_HEADER
+#define CSGTREE_MODULE_HEADER
+
+typedef struct CSGNode CSGNode;
+
+/* Leaves and operators.  Operators take ownership of their operands. */
+CSGNode *csgPrimitive(int prim);
+CSGNode *csgUnion(CSGNode *a, CSGNode *b);
+CSGNode *csgIntersection(CSGNode *a, CSGNode *b);
+CSGNode *csgDifference(CSGNode *a, CSGNode *b);
+void csgFreeTree(CSGNode *node);
+
+typedef struct CSGProduct {
+    int targetPrim;			/* primitive whose surface is drawn */
+    int frontFace;			/* 1 front faces, 0 back faces */
+    int whichSurface;			/* surface counter, 0 for convex */
+    int numTrimPrims;
+    int *trimmingPrims;			/* other primitives of the term */
+    int *isComplemented;		/* keep pixels outside, not inside */
+} CSGProduct;
+
+/* Normalize a tree into a list of products.  Terms that can never
+ * contain anything (A and not A) or that are not bounded by any
+ * primitive (not A and not B) are dropped.  Returns NULL with *count 0
+ * for an empty expression or when out of memory.
+ */
+CSGProduct *csgNormalize(const CSGNode *tree, int *count);
+void csgFreeProducts(CSGProduct *products, int count);
+
+/* Number of rendering passes the stencil algorithm needs for the
+ * products: one for the target, two per trimming primitive and two to
+ * mark and draw the result.
+ */
+int csgPasses(const CSGProduct *products, int count);
+
+/* Resolve the expression from cached depth layers.  front[p] and
+ * back[p] hold the nearest and farthest depth of convex primitive p for
+ * every pixel, 1.0 where it does not cover the pixel.  depth receives
+ * the nearest surface of the expression (1.0 where empty) and prim,
+ * when not NULL, the primitive that surface belongs to (-1 if none).
+ */
+void csgEvaluateLayers(const CSGProduct *products, int count,
+    float *const *front, float *const *back, int pixels,
+    float *depth, int *prim);
+
+#endif /* CSGTREE_MODULE_HEADER */
+
+/* End of csgtree.h */
@@ -0,0 +1,192 @@
+/*
+ * edgebench.c
+ *
+ *	Headless benchmark of the edge adjacency module.  Each model is
+ *	read with readObjData, which now links the facets through their
+ *	shared edges, and the eye then circles the model a degree per
+ *	frame.  The silhouette edges are found two ways:
+ *
+ *	    full         test both facets of every edge, every frame
+ *	    incremental  emSetEye, only edges of facets that changed facing
+ *
+ *	and the outline (border, feature, crease and silhouette edges) is
+ *	collected as a line vertex array with emLines.  The two silhouette
+ *	counts must agree.
+ *
+ *	Usage: edgebench [frames] [model.obj ...]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <GL/gl.h>
+
+#include "modelcontext.h"
+#include "fileread.h"
+#include "edgemesh.h"
+
+/* For platform-independent timing */
+#ifdef _WIN32
+    #include <windows.h>
+    typedef int timer;
+    #define getTime(a)      (a = GetTickCount())
+    #define timeDiff(a, b)  ((b - a) * 1000)
+#else
+    #include <sys/time.h>
+    typedef struct timeval timer;
+    #define getTime(a)      gettimeofday(&a, NULL)
+    #define timeDiff(a, b)  (((b.tv_sec - a.tv_sec) * 1000000) + b.tv_usec - a.tv_usec)
+#endif
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/* The data-set for the model */
+ModelContext *model;
+
+#define OUTLINE (EM_BORDER | EM_FEATURE | EM_CREASE | EM_SILHOUETTE)
+
+static char *defaultModels[] = {
+    "shuttle.obj", "cessna.obj", "airboat.obj", "flamingo.obj",
+    "porsche.obj", "croc.obj", NULL
+};
+
+
+
+/*
+ * fullSilhouette
+ *
+ *	Silhouette edges without any state carried between frames.
+ */
+
+static int
+fullSilhouette(EdgeMesh *mesh, const GLfloat eye[3], char *facing)
+{
+    GLfloat p[4];
+    int i, f[2], count = 0;
+
+    for (i = 0; i < emFacetCount(mesh); i++) {
+	emFacetPlane(mesh, i, p);
+	facing[i] = p[0] * eye[0] + p[1] * eye[1] + p[2] * eye[2] + p[3] > 0.0f;
+    }
+    for (i = 0; i < emEdgeCount(mesh); i++) {
+	emEdgeFacets(mesh, i, f);
+	if (f[1] != -1 && facing[f[0]] != facing[f[1]])
+	    count++;
+    }
+    return count;
+}
+
+
+
+static void
+run(char *fileName, int frames)
+{
+    EdgeMesh *mesh;
+    const GLfloat *lines;
+    GLfloat eye[3], center[3], radius, a;
+    int i, frame, counts[3], full = 0, incremental = 0;
+    int differ = 0, flipped = 0;
+    long tRead, tFull = 0, tIncremental = 0, tLines = 0;
+    char *facing;
+    timer start, stop;
+
+    getTime(start);
+    readObjData(fileName);
+    getTime(stop);
+    tRead = timeDiff(start, stop);
+    mesh = model->edgeMesh;
+
+    for (i = 0; i < 3; i++)
+	counts[i] = 0;
+    for (i = 0; i < emEdgeCount(mesh); i++) {
+	int c = emEdgeClass(mesh, i);
+	if (c & EM_BORDER) counts[0]++;
+	if (c & EM_FEATURE) counts[1]++;
+	if (c & EM_CREASE) counts[2]++;
+    }
+
+    /* Circle the model at twice its size, a little above it */
+    for (i = 0; i < 3; i++)
+	center[i] = 0.0f;
+    for (i = 0; i < model->ovCount; i++) {
+	center[0] += model->objVertexList[i].x / model->ovCount;
+	center[1] += model->objVertexList[i].y / model->ovCount;
+	center[2] += model->objVertexList[i].z / model->ovCount;
+    }
+    radius = 0.0f;
+    for (i = 0; i < model->ovCount; i++) {
+	a = (GLfloat)fabs(model->objVertexList[i].x - center[0]);
+	if (a > radius)
+	    radius = a;
+    }
+    radius *= 2.0f;
+
+    facing = (char *)malloc(emFacetCount(mesh) + 1);
+    for (frame = 0; frame < frames; frame++) {
+	a = (GLfloat)(frame * M_PI / 180.0);
+	eye[0] = center[0] + radius * (GLfloat)cos(a);
+	eye[1] = center[1] + radius * 0.3f;
+	eye[2] = center[2] + radius * (GLfloat)sin(a);
+
+	getTime(start);
+	full = fullSilhouette(mesh, eye, facing);
+	getTime(stop);
+	tFull += timeDiff(start, stop);
+
+	getTime(start);
+	flipped += emSetEye(mesh, eye);
+	getTime(stop);
+	tIncremental += timeDiff(start, stop);
+
+	getTime(start);
+	emLines(mesh, OUTLINE, &lines);
+	getTime(stop);
+	tLines += timeDiff(start, stop);
+
+	incremental = emLines(mesh, EM_SILHOUETTE, &lines) / 2;
+	if (incremental != full)
+	    differ++;
+	emLines(mesh, OUTLINE, &lines);	/* back to the outline */
+    }
+    free(facing);
+
+    printf("%-14s %6d %6d %6d %7.2f %5d %5d %5d %6d %8.3f %8.3f %8.3f %6.1f %s\n",
+	fileName, emVertexCount(mesh) - 1, emFacetCount(mesh),
+	emEdgeCount(mesh), tRead / 1000.0, counts[0], counts[1], counts[2],
+	full, tFull / 1000.0 / frames, tIncremental / 1000.0 / frames,
+	tLines / 1000.0 / frames, (double)flipped / frames,
+	differ ? "DIFFER" : "ok");
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+    char **models = defaultModels;
+    int frames = 360;
+
+    if (argc > 1)
+	frames = atoi(argv[1]);
+    if (argc > 2)
+	models = &argv[2];
+
+    model = (ModelContext *)calloc(1, sizeof(ModelContext));
+    if (model == NULL) {
+	printf ("Not enough memory count be allocated for model data\n");
+	exit(1);
+    }
+
+    printf("sizeof(ModelContext) %d bytes, %d frames, times in ms\n",
+	(int)sizeof(ModelContext), frames);
+    printf("%-14s %6s %6s %6s %7s %5s %5s %5s %6s %8s %8s %8s %6s\n",
+	"model", "verts", "facets", "edges", "read", "bord", "feat", "crease",
+	"silh", "full", "incr", "lines", "flips");
+    for (; *models != NULL; models++)
+	run(*models, frames);
+    return 0;
+}
+
+/* End of edgebench.c */
@@ -0,0 +1,625 @@
+/*
+ * edgemesh.c
+ *
+ *	Edge adjacency for polygonal models: shared edges found with a
+ *	hash on their two vertices, static edge classes, and silhouette
+ *	edges updated incrementally as the eye moves.  See edgemesh.h.
+ *
+ *	Facet planes are kept as four separate arrays (nx, ny, nz, d),
+ *	padded to a multiple of four facets, so that the facing test for
+ *	a new eye point is four facets per step.  With SSE this is done
+ *	with intrinsics, otherwise with plain four-wide loops.  A facet's
+ *	facing is one bit; the bits that changed since the last eye point
+ *	name the only facets whose edges need to be looked at again.
+ *
+ *	All arrays grow as needed, there are no fixed model limits.
+ */
+
+#include <stdlib.h>
+#include <math.h>
+
+#include "edgemesh.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define EM_SSE
+#include <xmmintrin.h>
+#endif
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+struct EdgeMesh {
+    int vertexCount, vertexMax;
+    GLfloat *vertex;			/* x, y, z per vertex */
+
+    int facetCount, facetMax;
+    int *facetStart;			/* first corner of each facet */
+    int *facetMaterial;
+    int materialMax;
+
+    int cornerCount, cornerMax;
+    int *corner;			/* vertex at each half-edge start */
+    int *cornerEdge;			/* edge of each half-edge */
+
+    int edgeCount;
+    int *edgeVertex;			/* two per edge, lowest first */
+    int *edgeFacet;			/* two per edge, -1 if none */
+    unsigned char *edgeClass;
+
+    int *vertexEdgeStart;		/* edges around each vertex */
+    int *vertexEdge;
+
+    int paddedCount;			/* facets rounded up to 4 */
+    GLfloat *plane[4];			/* nx, ny, nz, d */
+    unsigned char *facing;		/* 4 bits per byte, per 4 facets */
+    int haveEye;
+
+    int *silhouette;			/* current silhouette edges */
+    int silhouetteCount;
+    int *silhouetteSlot;		/* position in silhouette, or -1 */
+    int silhouetteChanged;
+
+    GLfloat *lines;			/* line vertices handed out */
+    int linesMax;
+    int linesClasses;			/* classes the lines were made for */
+    int staticLines;			/* vertices before the silhouettes */
+    int lineCount;
+};
+
+
+
+/*
+ * grow
+ *
+ *	Make room for count elements of size bytes in an array.
+ */
+
+static int
+grow(void **array, int *max, int count, int size)
+{
+    void *p;
+    int n;
+
+    if (count <= *max)
+	return 1;
+    n = *max ? *max : 256;
+    while (n < count)
+	n *= 2;
+    p = realloc(*array, (size_t)n * size);
+    if (p == NULL)
+	return 0;
+    *array = p;
+    *max = n;
+    return 1;
+}
+
+
+
+EdgeMesh *
+emNew(void)
+{
+    EdgeMesh *mesh;
+
+    mesh = (EdgeMesh *)calloc(1, sizeof(EdgeMesh));
+    if (mesh == NULL)
+	return NULL;
+    if (!grow((void **)&mesh->facetStart, &mesh->facetMax, 1, sizeof(int))) {
+	free(mesh);
+	return NULL;
+    }
+    mesh->facetStart[0] = 0;
+    return mesh;
+}
+
+
+static void
+freeAdjacency(EdgeMesh *mesh)
+{
+    int i;
+
+    free(mesh->cornerEdge);
+    free(mesh->edgeVertex);
+    free(mesh->edgeFacet);
+    free(mesh->edgeClass);
+    free(mesh->vertexEdgeStart);
+    free(mesh->vertexEdge);
+    for (i = 0; i < 4; i++) {
+	free(mesh->plane[i]);
+	mesh->plane[i] = NULL;
+    }
+    free(mesh->facing);
+    free(mesh->silhouette);
+    free(mesh->silhouetteSlot);
+
+    mesh->cornerEdge = NULL;
+    mesh->edgeVertex = mesh->edgeFacet = NULL;
+    mesh->edgeClass = NULL;
+    mesh->vertexEdgeStart = mesh->vertexEdge = NULL;
+    mesh->facing = NULL;
+    mesh->silhouette = mesh->silhouetteSlot = NULL;
+    mesh->edgeCount = 0;
+    mesh->silhouetteCount = 0;
+    mesh->haveEye = 0;
+    mesh->linesClasses = -1;
+}
+
+
+void
+emDelete(EdgeMesh *mesh)
+{
+    if (mesh == NULL)
+	return;
+    freeAdjacency(mesh);
+    free(mesh->vertex);
+    free(mesh->facetStart);
+    free(mesh->facetMaterial);
+    free(mesh->corner);
+    free(mesh->lines);
+    free(mesh);
+}
+
+
+
+int
+emAddVertex(EdgeMesh *mesh, GLfloat x, GLfloat y, GLfloat z)
+{
+    int max = mesh->vertexMax * 3;
+
+    if (!grow((void **)&mesh->vertex, &max, (mesh->vertexCount + 1) * 3,
+	    sizeof(GLfloat)))
+	return -1;
+    mesh->vertexMax = max / 3;
+    mesh->vertex[mesh->vertexCount * 3 + 0] = x;
+    mesh->vertex[mesh->vertexCount * 3 + 1] = y;
+    mesh->vertex[mesh->vertexCount * 3 + 2] = z;
+    return mesh->vertexCount++;
+}
+
+
+int
+emAddFacet(EdgeMesh *mesh, const int *vertices, int count, int material)
+{
+    int i;
+
+    if (!grow((void **)&mesh->facetStart, &mesh->facetMax,
+	    mesh->facetCount + 2, sizeof(int)))
+	return -1;
+    if (!grow((void **)&mesh->facetMaterial, &mesh->materialMax,
+	    mesh->facetCount + 1, sizeof(int)))
+	return -1;
+    if (!grow((void **)&mesh->corner, &mesh->cornerMax,
+	    mesh->cornerCount + count, sizeof(int)))
+	return -1;
+
+    for (i = 0; i < count; i++)
+	mesh->corner[mesh->cornerCount++] = vertices[i];
+    mesh->facetMaterial[mesh->facetCount] = material;
+    mesh->facetStart[++mesh->facetCount] = mesh->cornerCount;
+    return mesh->facetCount - 1;
+}
+
+
+
+/*
+ * facetPlanes
+ *
+ *	Plane of each facet from Newell's method, which copes with
+ *	polygons that are not quite flat.
+ */
+
+static void
+facetPlanes(EdgeMesh *mesh)
+{
+    const GLfloat *v = mesh->vertex;
+    GLfloat nx, ny, nz, cx, cy, cz, len;
+    int f, h, first, last, a, b, n;
+
+    for (f = 0; f < mesh->facetCount; f++) {
+	first = mesh->facetStart[f];
+	last = mesh->facetStart[f + 1];
+	nx = ny = nz = cx = cy = cz = 0.0f;
+	for (h = first; h < last; h++) {
+	    a = mesh->corner[h] * 3;
+	    b = mesh->corner[h + 1 < last ? h + 1 : first] * 3;
+	    nx += (v[a + 1] - v[b + 1]) * (v[a + 2] + v[b + 2]);
+	    ny += (v[a + 2] - v[b + 2]) * (v[a + 0] + v[b + 0]);
+	    nz += (v[a + 0] - v[b + 0]) * (v[a + 1] + v[b + 1]);
+	    cx += v[a + 0];
+	    cy += v[a + 1];
+	    cz += v[a + 2];
+	}
+	n = last - first;
+	len = (GLfloat)sqrt(nx * nx + ny * ny + nz * nz);
+	if (len > 0.0f) {
+	    nx /= len;
+	    ny /= len;
+	    nz /= len;
+	}
+	mesh->plane[0][f] = nx;
+	mesh->plane[1][f] = ny;
+	mesh->plane[2][f] = nz;
+	mesh->plane[3][f] = -(nx * cx + ny * cy + nz * cz) / n;
+    }
+    for (; f < mesh->paddedCount; f++)
+	mesh->plane[0][f] = mesh->plane[1][f] = mesh->plane[2][f] =
+	    mesh->plane[3][f] = 0.0f;
+}
+
+
+
+/*
+ * emFinish
+ *
+ *	Find the shared edges, build the vertex to edge lists and set the
+ *	static edge classes.  Returns 0 when out of memory.
+ */
+
+int
+emFinish(EdgeMesh *mesh, GLfloat creaseAngle)
+{
+    int *table, size, mask, f, h, first, last, a, b, e, slot, i;
+    GLfloat creaseCos, dot;
+    int f0, f1;
+
+    freeAdjacency(mesh);
+
+    mesh->paddedCount = (mesh->facetCount + 3) & ~3;
+    mesh->cornerEdge = (int *)malloc((mesh->cornerCount + 1) * sizeof(int));
+    mesh->edgeVertex = (int *)malloc((mesh->cornerCount + 1) * 2 * sizeof(int));
+    mesh->edgeFacet = (int *)malloc((mesh->cornerCount + 1) * 2 * sizeof(int));
+    mesh->edgeClass = (unsigned char *)malloc(mesh->cornerCount + 1);
+    for (i = 0; i < 4; i++)
+	mesh->plane[i] = (GLfloat *)malloc((mesh->paddedCount + 4) *
+	    sizeof(GLfloat));
+    mesh->facing = (unsigned char *)calloc(mesh->paddedCount / 4 + 1, 1);
+
+    for (size = 16; size < mesh->cornerCount * 2; size *= 2)
+	;
+    mask = size - 1;
+    table = (int *)malloc(size * sizeof(int));
+
+    if (mesh->cornerEdge == NULL || mesh->edgeVertex == NULL ||
+	    mesh->edgeFacet == NULL || mesh->edgeClass == NULL ||
+	    mesh->plane[0] == NULL || mesh->plane[1] == NULL ||
+	    mesh->plane[2] == NULL || mesh->plane[3] == NULL ||
+	    mesh->facing == NULL || table == NULL) {
+	free(table);
+	return 0;
+    }
+    for (i = 0; i < size; i++)
+	table[i] = -1;
+
+    facetPlanes(mesh);
+
+    /* Link each half-edge to the edge it shares with its neighbor */
+    mesh->edgeCount = 0;
+    for (f = 0; f < mesh->facetCount; f++) {
+	first = mesh->facetStart[f];
+	last = mesh->facetStart[f + 1];
+	for (h = first; h < last; h++) {
+	    a = mesh->corner[h];
+	    b = mesh->corner[h + 1 < last ? h + 1 : first];
+	    if (a > b) {
+		e = a;
+		a = b;
+		b = e;
+	    }
+	    slot = (int)(((unsigned)a * 73856093u ^ (unsigned)b * 19349663u) &
+		mask);
+	    while ((e = table[slot]) != -1 &&
+		    (mesh->edgeVertex[e * 2] != a ||
+		     mesh->edgeVertex[e * 2 + 1] != b))
+		slot = (slot + 1) & mask;
+
+	    if (e == -1) {
+		e = mesh->edgeCount++;
+		table[slot] = e;
+		mesh->edgeVertex[e * 2] = a;
+		mesh->edgeVertex[e * 2 + 1] = b;
+		mesh->edgeFacet[e * 2] = f;
+		mesh->edgeFacet[e * 2 + 1] = -1;
+		mesh->edgeClass[e] = 0;
+	    }
+	    else if (mesh->edgeFacet[e * 2 + 1] == -1 &&
+		    mesh->edgeFacet[e * 2] != f)
+		mesh->edgeFacet[e * 2 + 1] = f;
+	    else
+		mesh->edgeClass[e] |= EM_FEATURE;	/* non-manifold */
+	    mesh->cornerEdge[h] = e;
+	}
+    }
+    free(table);
+
+    /* Static classes */
+    creaseCos = (GLfloat)cos(creaseAngle * M_PI / 180.0);
+    for (e = 0; e < mesh->edgeCount; e++) {
+	f0 = mesh->edgeFacet[e * 2];
+	f1 = mesh->edgeFacet[e * 2 + 1];
+	if (f1 == -1) {
+	    mesh->edgeClass[e] |= EM_BORDER;
+	    continue;
+	}
+	if (mesh->facetMaterial[f0] != mesh->facetMaterial[f1])
+	    mesh->edgeClass[e] |= EM_FEATURE;
+	dot = mesh->plane[0][f0] * mesh->plane[0][f1] +
+	    mesh->plane[1][f0] * mesh->plane[1][f1] +
+	    mesh->plane[2][f0] * mesh->plane[2][f1];
+	if (dot < creaseCos)
+	    mesh->edgeClass[e] |= EM_CREASE;
+    }
+
+    /* Edges around each vertex */
+    mesh->vertexEdgeStart = (int *)calloc(mesh->vertexCount + 1, sizeof(int));
+    mesh->vertexEdge = (int *)malloc((mesh->edgeCount * 2 + 1) * sizeof(int));
+    mesh->silhouette = (int *)malloc((mesh->edgeCount + 1) * sizeof(int));
+    mesh->silhouetteSlot = (int *)malloc((mesh->edgeCount + 1) * sizeof(int));
+    if (mesh->vertexEdgeStart == NULL || mesh->vertexEdge == NULL ||
+	    mesh->silhouette == NULL || mesh->silhouetteSlot == NULL)
+	return 0;
+    for (e = 0; e < mesh->edgeCount * 2; e++)
+	mesh->vertexEdgeStart[mesh->edgeVertex[e] + 1]++;
+    for (i = 0; i < mesh->vertexCount; i++)
+	mesh->vertexEdgeStart[i + 1] += mesh->vertexEdgeStart[i];
+    for (e = 0; e < mesh->edgeCount; e++) {
+	mesh->vertexEdge[mesh->vertexEdgeStart[mesh->edgeVertex[e * 2]]++] = e;
+	mesh->vertexEdge[mesh->vertexEdgeStart[mesh->edgeVertex[e * 2 + 1]]++] =
+	    e;
+    }
+    for (i = mesh->vertexCount; i > 0; i--)
+	mesh->vertexEdgeStart[i] = mesh->vertexEdgeStart[i - 1];
+    mesh->vertexEdgeStart[0] = 0;
+
+    for (e = 0; e < mesh->edgeCount; e++)
+	mesh->silhouetteSlot[e] = -1;
+    return 1;
+}
+
+
+
+int
+emVertexCount(const EdgeMesh *mesh)
+{
+    return mesh->vertexCount;
+}
+
+
+int
+emFacetCount(const EdgeMesh *mesh)
+{
+    return mesh->facetCount;
+}
+
+
+int
+emEdgeCount(const EdgeMesh *mesh)
+{
+    return mesh->edgeCount;
+}
+
+
+void
+emEdgeVertices(const EdgeMesh *mesh, int edge, int v[2])
+{
+    v[0] = mesh->edgeVertex[edge * 2];
+    v[1] = mesh->edgeVertex[edge * 2 + 1];
+}
+
+
+int
+emEdgeClass(const EdgeMesh *mesh, int edge)
+{
+    return mesh->edgeClass[edge] | EM_EDGE;
+}
+
+
+void
+emEdgeFacets(const EdgeMesh *mesh, int edge, int f[2])
+{
+    f[0] = mesh->edgeFacet[edge * 2];
+    f[1] = mesh->edgeFacet[edge * 2 + 1];
+}
+
+
+void
+emFacetPlane(const EdgeMesh *mesh, int facet, GLfloat plane[4])
+{
+    int i;
+
+    for (i = 0; i < 4; i++)
+	plane[i] = mesh->plane[i][facet];
+}
+
+
+int
+emVertexEdges(const EdgeMesh *mesh, int vertex, const int **edges)
+{
+    *edges = &mesh->vertexEdge[mesh->vertexEdgeStart[vertex]];
+    return mesh->vertexEdgeStart[vertex + 1] - mesh->vertexEdgeStart[vertex];
+}
+
+
+
+#define FACING(mesh, f) (((mesh)->facing[(f) >> 2] >> ((f) & 3)) & 1)
+
+/*
+ * updateEdge
+ *
+ *	Add an edge to or remove it from the silhouette list to match the
+ *	facing of its two facets.
+ */
+
+static void
+updateEdge(EdgeMesh *mesh, int e)
+{
+    int f0 = mesh->edgeFacet[e * 2], f1 = mesh->edgeFacet[e * 2 + 1];
+    int isSilhouette, slot, last;
+
+    isSilhouette = f1 != -1 && FACING(mesh, f0) != FACING(mesh, f1);
+    slot = mesh->silhouetteSlot[e];
+    if (isSilhouette && slot == -1) {
+	mesh->silhouetteSlot[e] = mesh->silhouetteCount;
+	mesh->silhouette[mesh->silhouetteCount++] = e;
+	mesh->edgeClass[e] |= EM_SILHOUETTE;
+	mesh->silhouetteChanged = 1;
+    }
+    else if (!isSilhouette && slot != -1) {
+	last = mesh->silhouette[--mesh->silhouetteCount];
+	mesh->silhouette[slot] = last;
+	mesh->silhouetteSlot[last] = slot;
+	mesh->silhouetteSlot[e] = -1;
+	mesh->edgeClass[e] &= ~EM_SILHOUETTE;
+	mesh->silhouetteChanged = 1;
+    }
+}
+
+
+
+/*
+ * emSetEye
+ *
+ *	Facing of every facet, four at a time, then the edges of the
+ *	facets whose facing changed.
+ */
+
+int
+emSetEye(EdgeMesh *mesh, const GLfloat eye[3])
+{
+    const GLfloat *nx = mesh->plane[0], *ny = mesh->plane[1];
+    const GLfloat *nz = mesh->plane[2], *d = mesh->plane[3];
+    int i, k, f, h, bits, changed, flipped = 0;
+#ifdef EM_SSE
+    __m128 ex = _mm_set1_ps(eye[0]);
+    __m128 ey = _mm_set1_ps(eye[1]);
+    __m128 ez = _mm_set1_ps(eye[2]);
+    __m128 zero = _mm_setzero_ps();
+    __m128 s;
+#endif
+
+    for (i = 0; i < mesh->paddedCount; i += 4) {
+#ifdef EM_SSE
+	s = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(nx + i), ex),
+				  _mm_mul_ps(_mm_loadu_ps(ny + i), ey)),
+		       _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(nz + i), ez),
+				  _mm_loadu_ps(d + i)));
+	bits = _mm_movemask_ps(_mm_cmpgt_ps(s, zero));
+#else
+	bits = 0;
+	for (k = 0; k < 4; k++)
+	    if (nx[i + k] * eye[0] + ny[i + k] * eye[1] +
+		    nz[i + k] * eye[2] + d[i + k] > 0.0f)
+		bits |= 1 << k;
+#endif
+	changed = (bits ^ mesh->facing[i >> 2]) & 0xf;
+	if (mesh->haveEye && changed == 0)
+	    continue;
+	mesh->facing[i >> 2] = (unsigned char)bits;
+	if (!mesh->haveEye)
+	    changed = 0xf;
+
+	for (k = 0; k < 4; k++) {
+	    if (!(changed & (1 << k)))
+		continue;
+	    f = i + k;
+	    if (f >= mesh->facetCount)
+		break;
+	    flipped++;
+	    for (h = mesh->facetStart[f]; h < mesh->facetStart[f + 1]; h++)
+		updateEdge(mesh, mesh->cornerEdge[h]);
+	}
+    }
+    mesh->haveEye = 1;
+    return flipped;
+}
+
+
+
+static void
+addLine(EdgeMesh *mesh, GLfloat *p, int e)
+{
+    const GLfloat *a = &mesh->vertex[mesh->edgeVertex[e * 2] * 3];
+    const GLfloat *b = &mesh->vertex[mesh->edgeVertex[e * 2 + 1] * 3];
+
+    p[0] = a[0];
+    p[1] = a[1];
+    p[2] = a[2];
+    p[3] = b[0];
+    p[4] = b[1];
+    p[5] = b[2];
+}
+
+
+/*
+ * emLines
+ *
+ *	The static classes are put into the array once; the silhouettes
+ *	after them only when they changed.
+ */
+
+int
+emLines(EdgeMesh *mesh, int classes, const GLfloat **vertices)
+{
+    int staticClasses = classes & ~EM_SILHOUETTE;
+    int e, i, n;
+
+    if (mesh->linesClasses != classes) {
+	if (!grow((void **)&mesh->lines, &mesh->linesMax,
+		mesh->edgeCount * 6 + 6, sizeof(GLfloat))) {
+	    *vertices = NULL;
+	    return 0;
+	}
+	n = 0;
+	if (staticClasses) {
+	    for (e = 0; e < mesh->edgeCount; e++) {
+		if (((mesh->edgeClass[e] & ~EM_SILHOUETTE) | EM_EDGE) &
+			staticClasses) {
+		    addLine(mesh, &mesh->lines[n * 6], e);
+		    n++;
+		}
+	    }
+	}
+	mesh->staticLines = n;
+	mesh->linesClasses = classes;
+	mesh->silhouetteChanged = 1;
+    }
+
+    if ((classes & EM_SILHOUETTE) && mesh->silhouetteChanged) {
+	n = mesh->staticLines;
+	for (i = 0; i < mesh->silhouetteCount; i++) {
+	    e = mesh->silhouette[i];
+	    if (((mesh->edgeClass[e] & ~EM_SILHOUETTE) | EM_EDGE) &
+		    staticClasses)
+		continue;		/* already drawn */
+	    addLine(mesh, &mesh->lines[n * 6], e);
+	    n++;
+	}
+	mesh->lineCount = n;
+    }
+    else if (!(classes & EM_SILHOUETTE))
+	mesh->lineCount = mesh->staticLines;
+    mesh->silhouetteChanged = 0;
+
+    *vertices = mesh->lines;
+    return mesh->lineCount * 2;
+}
+
+
+void
+emDrawLines(EdgeMesh *mesh, int classes)
+{
+    const GLfloat *vertices;
+    int count;
+
+    count = emLines(mesh, classes, &vertices);
+    if (count == 0)
+	return;
+    glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+    glDisableClientState(GL_NORMAL_ARRAY);
+    glDisableClientState(GL_COLOR_ARRAY);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glVertexPointer(3, GL_FLOAT, 0, vertices);
+    glDrawArrays(GL_LINES, 0, count);
+    glPopClientAttrib();
+}
+
+/* End of edgemesh.c */
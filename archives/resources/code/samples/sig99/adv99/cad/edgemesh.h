@@ -0,0 +1,84 @@
+/*
+ * edgemesh.h
+ *
+ *	Header of the edge adjacency module.
+ *
+ *	The facets of a model are linked through their shared edges once,
+ *	when the model is read.  Each facet corner is a half-edge running
+ *	to the next corner, and each edge knows the (up to) two facets on
+ *	either side.  Edges are classified as they are built:
+ *
+ *	    EM_BORDER      only one facet uses the edge
+ *	    EM_FEATURE     material boundary, or more than two facets
+ *	    EM_CREASE      the facets meet at more than the crease angle
+ *
+ *	and per view, from the eye position in object coordinates:
+ *
+ *	    EM_SILHOUETTE  one facet faces the eye, the other does not
+ *
+ *	Silhouettes are kept up to date incrementally: only edges of the
+ *	facets that changed facing since the last view are looked at.
+ *	Lines of any set of classes come out as one vertex array ready for
+ *	glDrawArrays(GL_LINES, ...).
+ */
+
+#ifndef EDGE_MESH_MODULE_HEADER
+#define EDGE_MESH_MODULE_HEADER
+
+#include <GL/gl.h>
+
+typedef struct EdgeMesh EdgeMesh;
+
+/* Edge classes, combined with | when asking for lines */
+#define EM_BORDER	0x01
+#define EM_FEATURE	0x02
+#define EM_CREASE	0x04
+#define EM_SILHOUETTE	0x08
+#define EM_EDGE		0x10		/* every edge */
+
+EdgeMesh *emNew(void);
+void emDelete(EdgeMesh *mesh);
+
+/* Build the mesh: vertices first, then facets by vertex index.  Returns
+ * the index of the vertex or facet, -1 when out of memory.
+ */
+int emAddVertex(EdgeMesh *mesh, GLfloat x, GLfloat y, GLfloat z);
+int emAddFacet(EdgeMesh *mesh, const int *vertices, int count, int material);
+
+/* Link the facets and classify the edges; creaseAngle in degrees */
+int emFinish(EdgeMesh *mesh, GLfloat creaseAngle);
+
+int emVertexCount(const EdgeMesh *mesh);
+int emFacetCount(const EdgeMesh *mesh);
+int emEdgeCount(const EdgeMesh *mesh);
+
+/* The two vertices of an edge, lowest index first, and its classes */
+void emEdgeVertices(const EdgeMesh *mesh, int edge, int v[2]);
+int emEdgeClass(const EdgeMesh *mesh, int edge);
+
+/* The facets on either side of an edge, -1 for a border edge */
+void emEdgeFacets(const EdgeMesh *mesh, int edge, int f[2]);
+
+/* Plane of a facet, unit normal and distance: nx, ny, nz, d */
+void emFacetPlane(const EdgeMesh *mesh, int facet, GLfloat plane[4]);
+
+/* Edges meeting at a vertex */
+int emVertexEdges(const EdgeMesh *mesh, int vertex, const int **edges);
+
+/* Update the silhouette edges for an eye point in object coordinates.
+ * Returns the number of facets that changed facing.
+ */
+int emSetEye(EdgeMesh *mesh, const GLfloat eye[3]);
+
+/* Line vertices (x, y, z pairs) of the edges in any of the classes.
+ * Returns the number of vertices; the array stays valid until the next
+ * call.
+ */
+int emLines(EdgeMesh *mesh, int classes, const GLfloat **vertices);
+
+/* Draw the lines with a vertex array */
+void emDrawLines(EdgeMesh *mesh, int classes);
+
+#endif /* EDGE_MESH_MODULE_HEADER */
+
+/* End of edgemesh.h */
@@ -22,7 +22,12 @@
 #include <string.h>
 
 #include "modelcontext.h"
+#include "common.h"
 #include "fileread.h"
+#include "edgemesh.h"
+
+/* Facets meeting at more than this many degrees are creased */
+#define CREASE_ANGLE 40.0f
 
 extern ModelContext *model;
 
@@ -54,6 +59,9 @@ readLineData(char *FileName)
     /* Read in lines until end of file */
     while ((fgets(inputLine, 250, dataFile) != NULL) && (inputLine[0] != 'e')) {
 
+	reserveVertices(&model->vertexList, &model->vertexMax,
+	    model->vertexCount + 1);
+
 	if (inputLine[0] == 'm') {
 	    count = sscanf(inputLine, "m %f %f %f", &x, &y, &z);
 	    model->vertexList[model->vertexCount].draw = 0;
@@ -90,20 +98,11 @@ readLineData(char *FileName)
 	model->vertexList[model->vertexCount].x = x;
 	model->vertexList[model->vertexCount].y = y;
 	model->vertexList[model->vertexCount].z = z;
-
-	/* Check array bounds */
-	if (model->vertexCount + 1 < VERTEX_MAX) {
-	    model->vertexCount++;
-	}
-	else {
-	    /* Too many vertices, bail out gracefully */
-	    fprintf (stderr, "Error, number of vertices exceeds limit (%d)\n",
-		VERTEX_MAX);
-	    exit (-1);
-	}
+	model->vertexCount++;
     }
 
     /* Mark last one as a move */
+    reserveVertices(&model->vertexList, &model->vertexMax, model->vertexCount);
     model->vertexList[model->vertexCount].draw = 0;
 
     fclose(dataFile);
@@ -135,8 +134,12 @@ readObjData(char *FileName)
     char materialName[128];		/* Name of material in .mtl file */
     MaterialColor *materials;		/* Pointer to material description */
     MaterialColor *matPtr;		/* Moving ptr to material description */
-    int foundMatch;			/* Flag = 1 when a matched is found */
     int v0,v1;				/* Vertex number of last vertex */
+    EdgeMesh *mesh;			/* Facets linked by their edges */
+    int edge[2];			/* Vertices of one edge */
+    const int *vertexEdges;		/* Edges around a vertex */
+    int vertexEdgeCount;
+    char *edgeUsed;			/* Edges already in a line strip */
 
    
     glFrontFace(GL_CCW);
@@ -164,6 +167,14 @@ readObjData(char *FileName)
     model->boundBoxNear = 0.0;
     model->boundBoxFar = 0.0;
 
+    /* Vertex numbers in the file start at 1, so does the edge mesh */
+    emDelete(model->edgeMesh);
+    mesh = model->edgeMesh = emNew();
+    if ((mesh == NULL) || (emAddVertex(mesh, 0.0f, 0.0f, 0.0f) < 0)) {
+	fprintf(stderr, "Error, not enough memory for the edge mesh\n");
+	exit(1);
+    }
+
     for(;;) {
 	if (fgets(inputLine, 500, dataFile) == NULL)
 	    break;			/* End of file */
@@ -182,8 +193,9 @@ readObjData(char *FileName)
 		count = sscanf(inputLine, "v %f %f %f", &x, &y, &z);
 		if (count != 3)
 		    continue;
-		model->objVertexList[model->ovCount].facetsNum = 0;
-		model->objVertexList[model->ovCount].edgesNum = 0;
+		reserveVertices(&model->objVertexList, &model->ovMax,
+		    model->ovCount);
+		emAddVertex(mesh, x, y, z);
 		model->objVertexList[model->ovCount].x = x;
 		model->objVertexList[model->ovCount].y = y;
 		model->objVertexList[model->ovCount++].z = z;
@@ -208,6 +220,8 @@ readObjData(char *FileName)
 		count = sscanf(inputLine, "vn %f %f %f", &x, &y, &z);
 		if (count != 3)
 		    continue;
+		reserveVertices(&model->objVertexList, &model->ovMax,
+		    model->onCount);
 		model->objVertexList[model->onCount].nx = x;
 		model->objVertexList[model->onCount].ny = y;
 		model->objVertexList[model->onCount++].nz = z;
@@ -219,7 +233,7 @@ readObjData(char *FileName)
 	    /* Read one facet, get its vertex coordinates and add to list */
 	    fvCount = 0;
 	    linePos = 2;
-	    while (linePos < ilLen) {
+	    while ((linePos < ilLen) && (fvCount < 99)) {
 		/* Get the next number */
 		sscanf(&inputLine[linePos], "%d%n", &facetVertex[fvCount], &lp);
 		if (inputLine[linePos + lp] == '/') {
@@ -233,59 +247,19 @@ readObjData(char *FileName)
 	    }
 	    if (fvCount < 3)
 		continue;		/* Two vertex polygon?  Not! */
-	    facetVertex[fvCount] = facetVertex[0];	/* Wrap at end */
+	    for (i = 0; i < fvCount; i++)
+		if ((facetVertex[i] < 1) || (facetVertex[i] >= model->ovCount))
+		    break;
+	    if (i < fvCount)
+		continue;		/* Not a vertex we know about */
+
+	    /* Shared edges are found once the whole file is read */
+	    emAddFacet(mesh, facetVertex, fvCount, model->colorCount - 1);
+	    reserveVertices(&model->vertexList, &model->vertexMax,
+		model->vertexCount + fvCount);
 
 	    /* Convert vertex numbers to XYZ, store in vertex data array */
 	    for (i = 0; i < fvCount; i++) {
-		/* Check edge i -- i+1 if either has duplicate facets in list */
-		if (facetVertex[i] < facetVertex[i+1]) {
-		    v0 = facetVertex[i];
-		    v1 = facetVertex[i+1];
-		}
-		else {
-		    v0 = facetVertex[i+1];
-		    v1 = facetVertex[i];
-		}
-		foundMatch = 0;
-		for (j = 0; j < model->objVertexList[v0].facetsNum; j++) {
-		    for (k = 0; k < model->objVertexList[v1].facetsNum; k++) {
-			if (model->objVertexList[v0].facets[j] ==
-			    model->objVertexList[v1].facets[k]) {
-			    /* Make sure shared facet isn't this one */
-			    if (model->objVertexList[v0].facets[j] != 
-				    model->facetCount) {
-			    	/* A match, these vertices already share a */
-  			    	/* facet and therefore an edge. */
-			    	foundMatch = 1;
-			    	break;
-			    }
-			}
-		    }
-		    if (foundMatch)
-			break;
-		}
-
-		/* If no match found, its a new edge, add it to the edgelist */
-		if (foundMatch == 0) {
-
-		    /* Update vertices to show the edge for future checks */
-		    model->objVertexList[v0].edges[ 
-			model->objVertexList[v0].edgesNum++] = model->edgeCount;
-		    model->objVertexList[v1].edges[
-			model->objVertexList[v1].edgesNum++] = model->edgeCount;
-
-		    model->edgeList[model->edgeCount][0] = v0;
-		    model->edgeList[model->edgeCount][1] = v1;
-		    model->edgeCount++;
-		}
-
-		/* Add this facet to the vertices' records */
-		model->objVertexList[v0].facets[
-		    model->objVertexList[v0].facetsNum++] = model->facetCount;
-
-		model->objVertexList[v1].facets[
-		    model->objVertexList[v1].facetsNum++] = model->facetCount;
-
 		/* Create 'proper' vertex structure, sans edge and facet data */
 		/* 0 is move, non-zero is draw */
 		j = i;
@@ -364,6 +338,7 @@ readObjData(char *FileName)
     }
 
     /* Mark last one as a move */
+    reserveVertices(&model->vertexList, &model->vertexMax, model->vertexCount);
     model->vertexList[model->vertexCount].draw = 0;
 
     /* Set the 1st index after the end of the list (0..colorCount-1 is */
@@ -371,13 +346,23 @@ readObjData(char *FileName)
     /* color picking algorithms will  work correctly */
     model->colorList[model->colorCount].index = model->vertexCount + 1;
 
+    /* Link the facets through their shared edges */
+    if (!emFinish(mesh, CREASE_ANGLE)) {
+	fprintf(stderr, "Error, not enough memory for the edge mesh\n");
+	exit(1);
+    }
+    model->edgeCount = emEdgeCount(mesh);
+
     /* Store the independent line data too */
+    reserveVertices(&model->lineList, &model->lineMax, model->edgeCount * 2);
     model->lineCount = 0;
     for (i = 0; i < model->edgeCount; i++) {
+	emEdgeVertices(mesh, i, edge);
+
 	/* Look up the color for this edge */
 	model->lineList[model->lineCount].colorIndex = 0;
 	for (j = 0; j <= model->colorCount; j++) {
-	    if (model->objVertexList[model->edgeList[i][0]].vertexIndex <
+	    if (model->objVertexList[edge[0]].vertexIndex <
 		    model->colorList[j].index) {
 		model->lineList[model->lineCount].colorIndex = j-1;
 		break;
@@ -385,160 +370,82 @@ readObjData(char *FileName)
 	}
 
 	model->lineList[model->lineCount].draw = 0;
-	model->lineList[model->lineCount].x = 
-	    model->objVertexList[model->edgeList[i][0]].x;
-	model->lineList[model->lineCount].y = 
-	    model->objVertexList[model->edgeList[i][0]].y;
-	model->lineList[model->lineCount].z = 
-	    model->objVertexList[model->edgeList[i][0]].z;
+	model->lineList[model->lineCount].x = model->objVertexList[edge[0]].x;
+	model->lineList[model->lineCount].y = model->objVertexList[edge[0]].y;
+	model->lineList[model->lineCount].z = model->objVertexList[edge[0]].z;
 	model->lineCount++;
 
 	model->lineList[model->lineCount].draw = 1;
-	model->lineList[model->lineCount].x = 
-	    model->objVertexList[model->edgeList[i][1]].x;
-	model->lineList[model->lineCount].y = 
-	    model->objVertexList[model->edgeList[i][1]].y;
-	model->lineList[model->lineCount].z = 
-	    model->objVertexList[model->edgeList[i][1]].z;
+	model->lineList[model->lineCount].x = model->objVertexList[edge[1]].x;
+	model->lineList[model->lineCount].y = model->objVertexList[edge[1]].y;
+	model->lineList[model->lineCount].z = model->objVertexList[edge[1]].z;
 	model->lineCount++;
     }
     model->lineList[model->lineCount].draw = 0;
 
-/* Create the line strip data (very intelligent algorithm) */
-{
-    int edgeBase;			/* Lowest edge that might be valid */
-
+    /* Create the line strip data: start at the first unused edge and */
+    /* keep following unused edges from the vertex at the end */
+    reserveVertices(&model->lineStripList, &model->lineStripMax,
+	model->edgeCount * 2);
+    edgeUsed = (char *)calloc(model->edgeCount + 1, 1);
+    if (edgeUsed == NULL) {
+	fprintf(stderr, "Error, not enough memory for the line strips\n");
+	exit(1);
+    }
     model->lineStripCount = 0;
-    edgeBase = 0;
-    do {
-	/* Skip to the next edge to start from */
-	while (model->edgeList[edgeBase][0] == -1)
-	    edgeBase++;
-	if (edgeBase >= model->edgeCount)
-	    break;			/* Exit here */
-
-	/* Start off with this line */
-	i = edgeBase;
-
-	v0 = model->edgeList[i][0];
-	v1 = model->edgeList[i][1];
-
-	/* Look up the color for this edge */
-	model->lineStripList[model->lineStripCount].colorIndex = 0;
-	for (j = 0; j <= model->colorCount; j++) {
-	    if (model->objVertexList[v0].vertexIndex <=
-		    model->colorList[j].index) {
-		model->lineStripList[model->lineStripCount].colorIndex= j-1;
-		break;
+    for (i = 0; i < model->edgeCount; i++) {
+	if (edgeUsed[i])
+	    continue;
+	edgeUsed[i] = 1;
+	emEdgeVertices(mesh, i, edge);
+	v0 = edge[0];
+	v1 = edge[1];
+
+	/* Move to the first vertex, then draw to each following one */
+	k = v0;
+	m = 0;
+	do {
+	    /* Look up the color for this vertex */
+	    model->lineStripList[model->lineStripCount].colorIndex = 0;
+	    for (j = 0; j <= model->colorCount; j++) {
+		if (model->objVertexList[k].vertexIndex <=
+			model->colorList[j].index) {
+		    model->lineStripList[model->lineStripCount].colorIndex =
+			j-1;
+		    break;
+		}
 	    }
-	}
 
-	model->lineStripList[model->lineStripCount].draw = 0;
-	model->lineStripList[model->lineStripCount].x = 
-	    model->objVertexList[v0].x;
-	model->lineStripList[model->lineStripCount].y = 
-	    model->objVertexList[v0].y;
-	model->lineStripList[model->lineStripCount].z = 
-	    model->objVertexList[v0].z;
-        model->lineStripCount++;
-
-	model->lineStripList[model->lineStripCount].draw = 1;
-	model->lineStripList[model->lineStripCount].x =
-            model->objVertexList[v1].x;
-	model->lineStripList[model->lineStripCount].y = 
-	    model->objVertexList[v1].y;
-	model->lineStripList[model->lineStripCount].z = 
-	    model->objVertexList[v1].z;
-	model->lineStripCount++;
-
-	/* Clear first two vertices' reference to this edge */
-	for (j=0; j<model->objVertexList[v0].edgesNum; j++) {
-	    if (model->objVertexList[v0].edges[j] == edgeBase) {
-	    	model->objVertexList[v0].edges[j] = -1;
-		break;
-	    }
-	}
-	for (j=0; j<model->objVertexList[v1].edgesNum; j++) {
-	    if (model->objVertexList[v1].edges[j] == edgeBase) {
-	    	model->objVertexList[v1].edges[j] = -1;
-		break;
+	    model->lineStripList[model->lineStripCount].draw = m;
+	    model->lineStripList[model->lineStripCount].x =
+		model->objVertexList[k].x;
+	    model->lineStripList[model->lineStripCount].y =
+		model->objVertexList[k].y;
+	    model->lineStripList[model->lineStripCount].z =
+		model->objVertexList[k].z;
+	    model->lineStripCount++;
+	    if (m == 0) {
+		m = 1;
+		k = v1;
+		continue;
 	    }
-	}
-
-	model->edgeList[i][0] = -1;		/* No longer valid data */	
 
-	/* Look in v1's neighbors for a free line */
-	do {
-
-	    foundMatch = 0;
-
-	    for (j=0; j<model->objVertexList[v1].edgesNum; j++) {
-		/* Look for an unused edge */
-		if (model->objVertexList[v1].edges[j] != -1) { 
-		    if (model->edgeList[model->objVertexList[v1].edges[j]][0] 
-			    != -1) {
-		        foundMatch = 1;
-		        k = model->objVertexList[v1].edges[j];
-		        model->objVertexList[v1].edges[j] = -1;
-		        if (model->edgeList[k][0] == v1) {
-			    /* Look up the color for this edge */
-			    model->lineStripList[
-			        model->lineStripCount].colorIndex = 0;
-			    for (m = 0; m <= model->colorCount; m++) {
-			        if (model->objVertexList[
-				        model->edgeList[k][1]].vertexIndex <=
-				        model->colorList[m].index) {
-				    model->lineStripList[
-				        model->lineStripCount].colorIndex= m-1;
-				    break;
-			        }
-			    }
-
-  		 	    model->lineStripList[model->lineStripCount].draw 
-				= 1;
-			    model->lineStripList[model->lineStripCount].x = 
-			        model->objVertexList[model->edgeList[k][1]].x;
-			    model->lineStripList[model->lineStripCount].y = 
-			        model->objVertexList[model->edgeList[k][1]].y;
-			    model->lineStripList[model->lineStripCount].z = 
-			        model->objVertexList[model->edgeList[k][1]].z;
-			    model->lineStripCount++;
-			    v1 = model->edgeList[k][1];
-		        }
-		        else {
-			    /* Look up the color for this edge */
-			    model->lineStripList[
-			        model->lineStripCount].colorIndex = 0;
-			    for (m = 0; m <= model->colorCount; m++) {
-			        if (model->objVertexList[
-				        model->edgeList[k][0]].vertexIndex <=
-				        model->colorList[m].index) {
-				    model->lineStripList[
-				        model->lineStripCount].colorIndex= m-1;
-				    break;
-			        }
-			    }
-
-		  	    model->lineStripList[model->lineStripCount].draw 
-				= 1;
-			    model->lineStripList[model->lineStripCount].x = 
-			        model->objVertexList[model->edgeList[k][0]].x;
-			    model->lineStripList[model->lineStripCount].y = 
-			        model->objVertexList[model->edgeList[k][0]].y;
-			    model->lineStripList[model->lineStripCount].z = 
-			        model->objVertexList[model->edgeList[k][0]].z;
-			    model->lineStripCount++;
-		  	    v1 = model->edgeList[k][0];
-		        }
-		        model->edgeList[k][0] = -1; /* No longer valid data */
-		        break;
-		    }
-	        } 
-            }  
-	} while (foundMatch != 0);
-    } while (edgeBase < model->edgeCount);
+	    /* Look in v1's neighbors for a free line */
+	    k = -1;
+	    vertexEdgeCount = emVertexEdges(mesh, v1, &vertexEdges);
+	    for (j = 0; j < vertexEdgeCount; j++) {
+		if (!edgeUsed[vertexEdges[j]]) {
+		    edgeUsed[vertexEdges[j]] = 1;
+		    emEdgeVertices(mesh, vertexEdges[j], edge);
+		    v1 = (edge[0] == v1) ? edge[1] : edge[0];
+		    k = v1;
+		    break;
+		}
+	    }
+	} while (k != -1);
+    }
     model->lineStripList[model->lineStripCount].draw = 0;
-}
+    free(edgeUsed);
 
     fclose(dataFile);
     free(materials);
@@ -28,6 +28,7 @@
 #include "callbacks.h"
 #include "common.h"
 #include "fileread.h"
+#include "edgemesh.h"
 
 /* For platform-independent timing */
 #ifdef _WIN32
@@ -128,6 +129,7 @@ static int doubleBufferSetting = DOUBLE_BUFFER_ON;
 static int depthSetting = Z_OFF;
 static int lineSetting = LINE_STRIPS;
 static int edgeSetting = EDGE_NONE;
+static int edgeClasses = EM_EDGE;	/* Which edges of the mesh to draw */
 
 /* Function prototypes */
 void display(void);
@@ -222,7 +224,7 @@ main(int argc, char *argv[])
     glutAddMenuEntry("Cube", DRAW_CUBE);
     glutAddMenuEntry("Air Boat", DRAW_AIRBOAT);
     glutAddMenuEntry("Cessna", DRAW_CESSNA);
-/*  glutAddMenuEntry("Crocodile", DRAW_CROC);	*/
+    glutAddMenuEntry("Crocodile", DRAW_CROC);
     glutAddMenuEntry("Flamingo", DRAW_FLAMINGO);
     glutAddMenuEntry("Space Shuttle", DRAW_SHUTTLE);
     glutAddMenuEntry("Porsche", DRAW_PORSCHE);
@@ -402,7 +404,10 @@ static char perf[128];			/* String to display */
 	setMode(LIGHTS_OFF);		/* Set needed settings */
 	setMode(Z_OFF);
 	setMode(aaSetting);
-	lineSetting = LINE_STRIPS;
+	if (model->edgeMesh != NULL)
+	    lineSetting = LINE_STRIPS;
+	else
+	    lineSetting = LINE_LOOP;	/* No edge data, outline facets */
 
 	switch (edgeSetting) {
 
@@ -460,6 +465,9 @@ drawImage(void)
 {
     register int i, j;
     register int nextIndex;		/* Next index that has a color */
+    GLfloat m[16];			/* Modelview matrix */
+    GLfloat eye[3];			/* Eye point in object coordinates */
+    GLfloat s2;				/* Square of the scale */
 
     glMatrixMode(GL_MODELVIEW);
     glPushMatrix();
@@ -574,7 +582,20 @@ drawImage(void)
 	    glEnd();
 	}
 
-	if (lineSetting == LINE_STRIPS) do {
+	if ((lineSetting == LINE_STRIPS) && (model->edgeMesh != NULL)) {
+	    if (edgeClasses & EM_SILHOUETTE) {
+		/* Find the eye in object coordinates, the modelview matrix */
+		/* is a rotation and uniform scale followed by a translation */
+		glGetFloatv(GL_MODELVIEW_MATRIX, m);
+		s2 = m[0] * m[0] + m[1] * m[1] + m[2] * m[2];
+		for (j = 0; j < 3; j++)
+		    eye[j] = -(m[4*j] * m[12] + m[4*j+1] * m[13] +
+			m[4*j+2] * m[14]) / s2;
+		emSetEye(model->edgeMesh, eye);
+	    }
+	    emDrawLines(model->edgeMesh, edgeClasses);
+	}
+	else if (lineSetting == LINE_STRIPS) do {
 	    glBegin(GL_LINE_STRIP);
 		glVertex3fv(&model->lineStripList[i++].x);
 		while (model->lineStripList[i].draw)
@@ -665,6 +686,15 @@ keys(unsigned char key, int x, int y)
 	model->rotY *= 1.05;
 	break;
 
+      case 'e':
+      case 'E':
+	/* Switch between all edges and the outline of the model */
+	if (edgeClasses == EM_EDGE)
+	    edgeClasses = EM_BORDER | EM_FEATURE | EM_CREASE | EM_SILHOUETTE;
+	else
+	    edgeClasses = EM_EDGE;
+	break;
+
       case 'l':
       case 'L':
 	if (lightSetting == LIGHTS_ON)
@@ -813,11 +843,15 @@ setMode(int value)
 /* Objects */
 
       case DRAW_SPHERE:
+	emDelete(model->edgeMesh);	/* Only models read from files have one */
+	model->edgeMesh = NULL;
 	buildSphere(50);
 	objectSetting = value;
 	break;
 
       case DRAW_CUBE:
+	emDelete(model->edgeMesh);
+	model->edgeMesh = NULL;
 	buildCube();
 	objectSetting = value;
 	break;
@@ -1047,6 +1081,7 @@ displayHelp(void)
     printf("      o, O    = next, previous object\n");
     printf("      a, A    = switch line antialiasing mode\n");
     printf("      d, D    = toggle double buffering\n");
+    printf("      e, E    = all edges, or outline and crease edges\n");
     printf("      z, Z    = toggle depth-buffering\n");
     printf("      s, S    = decrease, increase rotation speed\n");
     printf("      h, H, ? = print this message\n");
@@ -25,14 +25,9 @@
 
 #include <GL/glut.h>
 
-/* Sizes of the mammoth arrays, must be big enough for the desired model, 
- * since bounds checking is lax
+/* The vertex lists grow as a model is read (see reserveVertices), only
+ * the number of colors is fixed.
  */
-#define VERTEX_MAX 66000
-#define LINE_MAX 29000
-#define LINE_STRIP_MAX 18000
-#define EDGE_MAX 15000
-#define OBJ_VERTEX_MAX 8500
 #define COLOR_MAX 100
 
 /* Constants defining the parameters of scaling behaviour */
@@ -57,11 +52,6 @@ struct Vertex {
 	int colorIndex;	
 	int vertexIndex;		/* in 'objVertexList' to point */
 					/* back to the official vertex */
-	int facets[90];
-	int facetsNum;
-
-	int edges[60];
-	int edgesNum;
 };
 
 typedef struct ColorStruct ColorStruct;
@@ -89,21 +79,25 @@ struct ModelContext
 
     int triangleFlag;			/* Flag to read in vertices as */
 					/* triangle strips, not polygons */
-    Vertex vertexList[VERTEX_MAX];	/* Vertex list for the model */
+    Vertex *vertexList;			/* Vertex list for the model */
     int vertexCount;
+    int vertexMax;			/* Allocated size of each list */
 
-    Vertex lineList[LINE_MAX];		/* Array of vertices for lines */
+    Vertex *lineList;			/* Array of vertices for lines */
     int lineCount;			/* How many vertices */
+    int lineMax;
 
-    Vertex lineStripList[LINE_STRIP_MAX]; /* Vertices for line strips */
+    Vertex *lineStripList;		/* Vertices for line strips */
     int lineStripCount;			/* How many vertices */
+    int lineStripMax;
 
-    int edgeList[EDGE_MAX][2];
+    struct EdgeMesh *edgeMesh;		/* Facets linked by shared edges */
     int edgeCount;
 
-    Vertex objVertexList[OBJ_VERTEX_MAX]; /* Vertices from .obj file */
+    Vertex *objVertexList;		/* Vertices from .obj file */
     int ovCount;
     int onCount;
+    int ovMax;
 
     ColorStruct colorList[COLOR_MAX];	/* Color list for the model */
     int colorCount;
@@ -0,0 +1,314 @@
+/*
+ * occbench.c
+ *
+ *	Headless benchmark of the occlusion culling module.  A dense grid
+ *	of copies of a CAD model is viewed end-on, so the front rows hide
+ *	most of the rest.  Each frame is "rendered" into a full size CPU
+ *	depth buffer with the same rasterizer, once with every copy and
+ *	once with only the copies that survive occlusion culling, and the
+ *	two depth images are compared.
+ *
+ *	Usage: occbench [model.obj] [columns rows depth] [frames]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <GL/gl.h>
+
+#include "modelcontext.h"
+#include "fileread.h"
+#include "occlude.h"
+
+/* For platform-independent timing */
+#ifdef _WIN32
+    #include <windows.h>
+    typedef int timer;
+    #define getTime(a)      (a = GetTickCount())
+    #define timeDiff(a, b)  ((b - a) * 1000)
+#else
+    #include <sys/time.h>
+    typedef struct timeval timer;
+    #define getTime(a)      gettimeofday(&a, NULL)
+    #define timeDiff(a, b)  (((b.tv_sec - a.tv_sec) * 1000000) + b.tv_usec - a.tv_usec)
+#endif
+
+/* The data-set for the model */
+ModelContext *model;
+
+#define FRAME_WIDTH 640
+#define FRAME_HEIGHT 480
+#define OCC_WIDTH 160			/* occlusion buffer, 1/16 the pixels */
+#define OCC_HEIGHT 120
+#define MAX_OCCLUDERS 64
+#define MIN_OCCLUDER_AREA 0.01		/* of the occlusion buffer */
+
+static GLfloat *triangles;		/* model as independent triangles */
+static int triangleCount;
+static GLfloat boxMin[3], boxMax[3];	/* model bounds */
+
+static int instanceCount;
+static GLfloat (*offset)[3];		/* translation of each copy */
+static GLfloat (*mvp)[16];
+static float *area;
+
+
+
+/*
+ * buildTriangles
+ *
+ *	Fan-triangulate the facets read by readObjData.
+ */
+
+static void
+buildTriangles(void)
+{
+    Vertex *v = model->vertexList;
+    int i, first, n;
+
+    triangles = (GLfloat *)malloc(model->vertexCount * 9 * sizeof(GLfloat));
+    triangleCount = 0;
+    first = 0;
+    for (i = 1; i <= model->vertexCount; i++) {
+	if (v[i].draw != 0 && i < model->vertexCount) {
+	    if (i - first >= 2) {
+		n = triangleCount * 9;
+		triangles[n + 0] = v[first].x;
+		triangles[n + 1] = v[first].y;
+		triangles[n + 2] = v[first].z;
+		triangles[n + 3] = v[i - 1].x;
+		triangles[n + 4] = v[i - 1].y;
+		triangles[n + 5] = v[i - 1].z;
+		triangles[n + 6] = v[i].x;
+		triangles[n + 7] = v[i].y;
+		triangles[n + 8] = v[i].z;
+		triangleCount++;
+	    }
+	}
+	else {
+	    first = i;
+	}
+    }
+
+    boxMin[0] = model->boundBoxLeft;
+    boxMin[1] = model->boundBoxBottom;
+    boxMin[2] = model->boundBoxNear;
+    boxMax[0] = model->boundBoxRight;
+    boxMax[1] = model->boundBoxTop;
+    boxMax[2] = model->boundBoxFar;
+}
+
+
+
+/* c = a * b, column-major */
+static void
+multMatrix(GLfloat c[16], const GLfloat a[16], const GLfloat b[16])
+{
+    int i, j, k;
+
+    for (i = 0; i < 4; i++) {
+	for (j = 0; j < 4; j++) {
+	    c[j * 4 + i] = 0.0f;
+	    for (k = 0; k < 4; k++)
+		c[j * 4 + i] += a[k * 4 + i] * b[j * 4 + k];
+	}
+    }
+}
+
+
+
+/*
+ * setupFrame
+ *
+ *	Camera in front of the grid, drifting sideways with the frame
+ *	number; fills in the matrix of every copy.
+ */
+
+static void
+setupFrame(int frame, GLfloat size, GLfloat depth)
+{
+    GLfloat proj[16], view[16], pv[16], model[16];
+    GLfloat n = size * 0.1f, f = depth + 4.0f * size;
+    GLfloat t = n * (GLfloat)tan(30.0 * 3.14159265 / 180.0);
+    int i;
+
+    memset(proj, 0, sizeof(proj));
+    proj[0] = n / (t * FRAME_WIDTH / FRAME_HEIGHT);
+    proj[5] = n / t;
+    proj[10] = -(f + n) / (f - n);
+    proj[11] = -1.0f;
+    proj[14] = -2.0f * f * n / (f - n);
+
+    memset(view, 0, sizeof(view));
+    view[0] = view[5] = view[10] = view[15] = 1.0f;
+    view[12] = -(GLfloat)sin(frame * 0.1) * size;
+    view[14] = -2.0f * size;
+    multMatrix(pv, proj, view);
+
+    memset(model, 0, sizeof(model));
+    model[0] = model[5] = model[10] = model[15] = 1.0f;
+    for (i = 0; i < instanceCount; i++) {
+	model[12] = offset[i][0];
+	model[13] = offset[i][1];
+	model[14] = offset[i][2];
+	multMatrix(mvp[i], pv, model);
+    }
+}
+
+
+
+static int
+compareArea(const void *a, const void *b)
+{
+    float d = area[*(const int *)b] - area[*(const int *)a];
+    return d > 0.0f ? 1 : (d < 0.0f ? -1 : 0);
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+    char *fileName = "shuttle.obj";
+    int columns = 12, rows = 4, depth = 24, frames = 10;
+    OccBuffer *occ, *full, *reference;
+    const GLfloat *d0, *d1;
+    int *order, *isOccluder, *draw, occluders, issued, differ;
+    int i, j, k, frame, w, h;
+    long tAll = 0, tCull = 0, tTest = 0, culled = 0, candidates = 0;
+    GLfloat size, s[3];
+    timer start, stop, mid;
+
+    if (argc > 1)
+	fileName = argv[1];
+    if (argc > 4) {
+	columns = atoi(argv[2]);
+	rows = atoi(argv[3]);
+	depth = atoi(argv[4]);
+    }
+    if (argc > 5)
+	frames = atoi(argv[5]);
+
+    model = (ModelContext *)calloc(1, sizeof(ModelContext));
+    if (model == NULL) {
+	printf ("Not enough memory count be allocated for model data\n");
+	exit(1);
+    }
+    readObjData(fileName);
+    buildTriangles();
+
+    /* Grid of copies, spaced a little wider than the model */
+    size = 0.0f;
+    for (i = 0; i < 3; i++) {
+	s[i] = boxMax[i] - boxMin[i];
+	if (s[i] > size)
+	    size = s[i];
+    }
+    instanceCount = columns * rows * depth;
+    offset = (GLfloat (*)[3])malloc(instanceCount * sizeof(*offset));
+    mvp = (GLfloat (*)[16])malloc(instanceCount * sizeof(*mvp));
+    area = (float *)malloc(instanceCount * sizeof(float));
+    order = (int *)malloc(instanceCount * sizeof(int));
+    isOccluder = (int *)malloc(instanceCount * sizeof(int));
+    draw = (int *)malloc(instanceCount * sizeof(int));
+    for (i = 0, k = 0; i < columns; i++) {
+	for (j = 0; j < rows; j++) {
+	    int z;
+	    for (z = 0; z < depth; z++, k++) {
+		offset[k][0] = (i - (columns - 1) * 0.5f) * s[0] * 1.1f;
+		offset[k][1] = (j - (rows - 1) * 0.5f) * s[1] * 1.1f;
+		offset[k][2] = -z * s[2] * 1.1f;
+	    }
+	}
+    }
+
+    occ = occNew(OCC_WIDTH, OCC_HEIGHT);
+    full = occNew(FRAME_WIDTH, FRAME_HEIGHT);
+    reference = occNew(FRAME_WIDTH, FRAME_HEIGHT);
+    differ = 0;
+    issued = 0;
+
+    for (frame = 0; frame < frames; frame++) {
+	setupFrame(frame, size, depth * s[2] * 1.1f);
+
+	/* Everything */
+	getTime(start);
+	occClear(reference);
+	for (i = 0; i < instanceCount; i++)
+	    occRasterTriangles(reference, mvp[i], triangles, triangleCount);
+	getTime(stop);
+	tAll += timeDiff(start, stop);
+
+	/* Occlusion culled */
+	getTime(start);
+	for (i = 0; i < instanceCount; i++) {
+	    area[i] = occScreenArea(occ, mvp[i], boxMin, boxMax);
+	    order[i] = i;
+	    isOccluder[i] = 0;
+	}
+	qsort(order, instanceCount, sizeof(int), compareArea);
+
+	occClear(occ);
+	occluders = 0;
+	for (i = 0; i < instanceCount && occluders < MAX_OCCLUDERS; i++) {
+	    if (area[order[i]] < MIN_OCCLUDER_AREA * OCC_WIDTH * OCC_HEIGHT)
+		break;
+	    occRasterTriangles(occ, mvp[order[i]], triangles, triangleCount);
+	    isOccluder[order[i]] = 1;
+	    occluders++;
+	}
+	occBuildPyramid(occ);
+
+	issued = 0;
+	for (i = 0; i < instanceCount; i++) {
+	    draw[i] = 1;
+	    if (!isOccluder[i]) {
+		candidates++;
+		if (!occTestBox(occ, mvp[i], boxMin, boxMax)) {
+		    draw[i] = 0;
+		    culled++;
+		    continue;
+		}
+	    }
+	    issued++;
+	}
+	getTime(mid);
+	tTest += timeDiff(start, mid);
+
+	occClear(full);
+	for (i = 0; i < instanceCount; i++) {
+	    if (draw[i])
+		occRasterTriangles(full, mvp[i], triangles, triangleCount);
+	}
+	getTime(stop);
+	tCull += timeDiff(start, stop);
+
+	/* Culling must not change the picture */
+	d0 = occDepth(reference, &w, &h);
+	d1 = occDepth(full, &w, &h);
+	for (i = 0; i < w * h; i++) {
+	    if (d0[i] != d1[i])
+		differ++;
+	}
+    }
+
+    printf("%s: %d triangles x %d copies, %d frames at %dx%d\n",
+	fileName, triangleCount, instanceCount, frames,
+	FRAME_WIDTH, FRAME_HEIGHT);
+    printf("  culled           %5.1f%% of tested copies (%d issued last frame)\n",
+	candidates ? 100.0 * culled / candidates : 0.0, issued);
+    printf("  cull stage       %8.2f ms/frame\n", tTest / 1000.0 / frames);
+    printf("  frame, all       %8.2f ms\n", tAll / 1000.0 / frames);
+    printf("  frame, culled    %8.2f ms (including cull stage)\n",
+	tCull / 1000.0 / frames);
+    printf("  speedup          %8.2fx\n", tCull ? (double)tAll / tCull : 0.0);
+    printf("  pixels changed   %d\n", differ);
+
+    occDelete(occ);
+    occDelete(full);
+    occDelete(reference);
+    return 0;
+}
+
+/* End of occbench.c */
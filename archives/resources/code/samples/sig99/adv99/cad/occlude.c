@@ -0,0 +1,446 @@
+/*
+ * occlude.c
+ *
+ *	Software occlusion culling: a small CPU depth buffer for the
+ *	occluders and a hierarchical-Z pyramid to test bounding boxes
+ *	against.  See occlude.h.
+ *
+ *	The rasterizer walks each triangle's bounding box four pixels at
+ *	a time, evaluating the three edge functions and the depth plane
+ *	for the four pixel centers at once.  With SSE this is done with
+ *	intrinsics, otherwise with plain four-wide loops.
+ *
+ *	Occluders are sampled at pixel centers like OpenGL does, so an
+ *	occluder edge may claim a whole pixel it only partly covers.  At
+ *	the low resolutions used here this is the usual trade-off; make
+ *	the buffer larger if objects pop at occluder silhouettes.
+ */
+
+#include <stdlib.h>
+#include <math.h>
+
+#include "occlude.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define OCC_SSE
+#include <xmmintrin.h>
+#endif
+
+#define OCC_MAX_LEVELS 16		/* enough for 65536 pixels across */
+#define OCC_TEST_SPAN 8			/* max texels across a box test */
+
+struct OccBuffer {
+    int width, height;			/* level 0, width a multiple of 4 */
+    int levels;				/* number of pyramid levels */
+    int levelWidth[OCC_MAX_LEVELS];
+    int levelHeight[OCC_MAX_LEVELS];
+    GLfloat *level[OCC_MAX_LEVELS];	/* level 0 is the depth buffer */
+    GLfloat *storage;
+};
+
+
+
+/*
+ * occNew
+ *
+ *	Allocate a depth buffer and its pyramid.
+ */
+
+OccBuffer *
+occNew(int width, int height)
+{
+    OccBuffer *ob;
+    long total;
+    int w, h, i;
+
+    ob = (OccBuffer *)calloc(1, sizeof(OccBuffer));
+    if (ob == NULL)
+	return NULL;
+
+    /* Rows are rasterized in groups of four pixels */
+    ob->width = (width + 3) & ~3;
+    ob->height = height;
+
+    w = ob->width;
+    h = ob->height;
+    total = 0;
+    for (i = 0; i < OCC_MAX_LEVELS; i++) {
+	ob->levelWidth[i] = w;
+	ob->levelHeight[i] = h;
+	total += (long)w * h;
+	ob->levels = i + 1;
+	if (w == 1 && h == 1)
+	    break;
+	w = (w + 1) / 2;
+	h = (h + 1) / 2;
+    }
+
+    ob->storage = (GLfloat *)malloc(total * sizeof(GLfloat));
+    if (ob->storage == NULL) {
+	free(ob);
+	return NULL;
+    }
+
+    total = 0;
+    for (i = 0; i < ob->levels; i++) {
+	ob->level[i] = ob->storage + total;
+	total += (long)ob->levelWidth[i] * ob->levelHeight[i];
+    }
+
+    occClear(ob);
+    return ob;
+} /* End of occNew */
+
+
+
+void
+occDelete(OccBuffer *ob)
+{
+    if (ob == NULL)
+	return;
+    free(ob->storage);
+    free(ob);
+}
+
+
+
+void
+occClear(OccBuffer *ob)
+{
+    long i, n;
+
+    n = (long)ob->width * ob->height;
+    for (i = 0; i < n; i++)
+	ob->level[0][i] = 1.0f;
+}
+
+
+
+/*
+ * transformPoint
+ *
+ *	Object to clip coordinates.
+ */
+
+static void
+transformPoint(const GLfloat m[16], const GLfloat p[3], GLfloat c[4])
+{
+    c[0] = m[0] * p[0] + m[4] * p[1] + m[8] * p[2] + m[12];
+    c[1] = m[1] * p[0] + m[5] * p[1] + m[9] * p[2] + m[13];
+    c[2] = m[2] * p[0] + m[6] * p[1] + m[10] * p[2] + m[14];
+    c[3] = m[3] * p[0] + m[7] * p[1] + m[11] * p[2] + m[15];
+}
+
+
+
+/*
+ * rasterTriangle
+ *
+ *	Depth-only rasterization of one triangle in window coordinates,
+ *	keeping the nearest depth.
+ */
+
+static void
+rasterTriangle(OccBuffer *ob, GLfloat v[3][3])
+{
+    GLfloat area, t;
+    GLfloat a0, b0, c0, a1, b1, c1, a2, b2, c2;	/* edge functions */
+    GLfloat za, zb, zc;				/* depth plane */
+    GLfloat minX, maxX, minY, maxY;
+    int x0, x1, y0, y1, x, y, i;
+    GLfloat *row;
+
+    area = (v[1][0] - v[0][0]) * (v[2][1] - v[0][1]) -
+	   (v[2][0] - v[0][0]) * (v[1][1] - v[0][1]);
+    if (fabs(area) < 1.0e-8)
+	return;
+    if (area < 0.0f) {
+	/* Draw both windings: swap to counterclockwise */
+	for (i = 0; i < 3; i++) {
+	    t = v[1][i]; v[1][i] = v[2][i]; v[2][i] = t;
+	}
+	area = -area;
+    }
+
+    minX = maxX = v[0][0];
+    minY = maxY = v[0][1];
+    for (i = 1; i < 3; i++) {
+	if (v[i][0] < minX) minX = v[i][0];
+	if (v[i][0] > maxX) maxX = v[i][0];
+	if (v[i][1] < minY) minY = v[i][1];
+	if (v[i][1] > maxY) maxY = v[i][1];
+    }
+    x0 = (int)floor(minX);
+    x1 = (int)ceil(maxX);
+    y0 = (int)floor(minY);
+    y1 = (int)ceil(maxY);
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > ob->width - 1) x1 = ob->width - 1;
+    if (y1 > ob->height - 1) y1 = ob->height - 1;
+    if (x0 > x1 || y0 > y1)
+	return;
+
+    /* Start on a group of four; pixels left of the triangle fail anyway */
+    x0 &= ~3;
+
+    /* e(x, y) = a * x + b * y + c, >= 0 inside, weights vertex i */
+    a0 = v[1][1] - v[2][1];  b0 = v[2][0] - v[1][0];
+    c0 = -(a0 * v[1][0] + b0 * v[1][1]);
+    a1 = v[2][1] - v[0][1];  b1 = v[0][0] - v[2][0];
+    c1 = -(a1 * v[2][0] + b1 * v[2][1]);
+    a2 = v[0][1] - v[1][1];  b2 = v[1][0] - v[0][0];
+    c2 = -(a2 * v[0][0] + b2 * v[0][1]);
+
+    za = (a0 * v[0][2] + a1 * v[1][2] + a2 * v[2][2]) / area;
+    zb = (b0 * v[0][2] + b1 * v[1][2] + b2 * v[2][2]) / area;
+    zc = (c0 * v[0][2] + c1 * v[1][2] + c2 * v[2][2]) / area;
+
+    for (y = y0; y <= y1; y++) {
+	GLfloat py = y + 0.5f;
+	row = ob->level[0] + (long)y * ob->width;
+
+#ifdef OCC_SSE
+	{
+	    __m128 px, e0, e1, e2, z, d, in, zero, step;
+	    __m128 ea0, ea1, ea2, zA;
+
+	    zero = _mm_setzero_ps();
+	    px = _mm_set_ps(x0 + 3.5f, x0 + 2.5f, x0 + 1.5f, x0 + 0.5f);
+	    ea0 = _mm_set1_ps(a0);
+	    ea1 = _mm_set1_ps(a1);
+	    ea2 = _mm_set1_ps(a2);
+	    zA = _mm_set1_ps(za);
+	    e0 = _mm_add_ps(_mm_mul_ps(ea0, px), _mm_set1_ps(b0 * py + c0));
+	    e1 = _mm_add_ps(_mm_mul_ps(ea1, px), _mm_set1_ps(b1 * py + c1));
+	    e2 = _mm_add_ps(_mm_mul_ps(ea2, px), _mm_set1_ps(b2 * py + c2));
+	    z = _mm_add_ps(_mm_mul_ps(zA, px), _mm_set1_ps(zb * py + zc));
+	    step = _mm_set1_ps(4.0f);
+
+	    for (x = x0; x <= x1; x += 4) {
+		in = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(e0, zero),
+					   _mm_cmpge_ps(e1, zero)),
+				_mm_cmpge_ps(e2, zero));
+		if (_mm_movemask_ps(in)) {
+		    d = _mm_loadu_ps(row + x);
+		    d = _mm_or_ps(_mm_and_ps(in, _mm_min_ps(d, z)),
+				  _mm_andnot_ps(in, d));
+		    _mm_storeu_ps(row + x, d);
+		}
+		e0 = _mm_add_ps(e0, _mm_mul_ps(ea0, step));
+		e1 = _mm_add_ps(e1, _mm_mul_ps(ea1, step));
+		e2 = _mm_add_ps(e2, _mm_mul_ps(ea2, step));
+		z = _mm_add_ps(z, _mm_mul_ps(zA, step));
+	    }
+	}
+#else
+	for (x = x0; x <= x1; x += 4) {
+	    GLfloat e0[4], e1[4], e2[4], z[4];
+	    for (i = 0; i < 4; i++) {
+		GLfloat px = x + i + 0.5f;
+		e0[i] = a0 * px + b0 * py + c0;
+		e1[i] = a1 * px + b1 * py + c1;
+		e2[i] = a2 * px + b2 * py + c2;
+		z[i] = za * px + zb * py + zc;
+	    }
+	    for (i = 0; i < 4; i++) {
+		if (e0[i] >= 0.0f && e1[i] >= 0.0f && e2[i] >= 0.0f &&
+			z[i] < row[x + i])
+		    row[x + i] = z[i];
+	    }
+	}
+#endif
+    }
+} /* End of rasterTriangle */
+
+
+
+/*
+ * occRasterTriangles
+ *
+ *	Draw occluder triangles.  Triangles reaching in front of the near
+ *	plane are dropped, which only makes the occluder smaller.
+ */
+
+void
+occRasterTriangles(OccBuffer *ob, const GLfloat mvp[16],
+    const GLfloat *triangles, int triangleCount)
+{
+    GLfloat c[4], v[3][3];
+    int t, i, clipped;
+
+    for (t = 0; t < triangleCount; t++) {
+	clipped = 0;
+	for (i = 0; i < 3; i++) {
+	    transformPoint(mvp, triangles + 9 * t + 3 * i, c);
+	    if (c[2] < -c[3] || c[3] <= 0.0f) {
+		clipped = 1;
+		break;
+	    }
+	    v[i][0] = (c[0] / c[3] * 0.5f + 0.5f) * ob->width;
+	    v[i][1] = (c[1] / c[3] * 0.5f + 0.5f) * ob->height;
+	    v[i][2] = c[2] / c[3] * 0.5f + 0.5f;
+	}
+	if (!clipped)
+	    rasterTriangle(ob, v);
+    }
+}
+
+
+
+/*
+ * occBuildPyramid
+ *
+ *	Each texel of a level holds the farthest depth of the 2x2 texels
+ *	below it.
+ */
+
+void
+occBuildPyramid(OccBuffer *ob)
+{
+    GLfloat *src, *dst, d;
+    int l, x, y, sw, sh, dw, dh, sx, sy;
+
+    for (l = 1; l < ob->levels; l++) {
+	src = ob->level[l - 1];
+	dst = ob->level[l];
+	sw = ob->levelWidth[l - 1];
+	sh = ob->levelHeight[l - 1];
+	dw = ob->levelWidth[l];
+	dh = ob->levelHeight[l];
+
+	for (y = 0; y < dh; y++) {
+	    for (x = 0; x < dw; x++) {
+		sx = 2 * x;
+		sy = 2 * y;
+		d = src[sy * sw + sx];
+		if (sx + 1 < sw && src[sy * sw + sx + 1] > d)
+		    d = src[sy * sw + sx + 1];
+		if (sy + 1 < sh) {
+		    if (src[(sy + 1) * sw + sx] > d)
+			d = src[(sy + 1) * sw + sx];
+		    if (sx + 1 < sw && src[(sy + 1) * sw + sx + 1] > d)
+			d = src[(sy + 1) * sw + sx + 1];
+		}
+		dst[y * dw + x] = d;
+	    }
+	}
+    }
+}
+
+
+
+/*
+ * projectBox
+ *
+ *	Window rectangle and nearest depth of a box.  Returns 0 if the box
+ *	reaches in front of the near plane.
+ */
+
+static int
+projectBox(OccBuffer *ob, const GLfloat mvp[16],
+    const GLfloat boxMin[3], const GLfloat boxMax[3], GLfloat rect[5])
+{
+    GLfloat p[3], c[4], x, y, z;
+    int i;
+
+    for (i = 0; i < 8; i++) {
+	p[0] = (i & 1) ? boxMax[0] : boxMin[0];
+	p[1] = (i & 2) ? boxMax[1] : boxMin[1];
+	p[2] = (i & 4) ? boxMax[2] : boxMin[2];
+	transformPoint(mvp, p, c);
+	if (c[2] < -c[3] || c[3] <= 0.0f)
+	    return 0;
+
+	x = (c[0] / c[3] * 0.5f + 0.5f) * ob->width;
+	y = (c[1] / c[3] * 0.5f + 0.5f) * ob->height;
+	z = c[2] / c[3] * 0.5f + 0.5f;
+	if (i == 0 || x < rect[0]) rect[0] = x;
+	if (i == 0 || y < rect[1]) rect[1] = y;
+	if (i == 0 || x > rect[2]) rect[2] = x;
+	if (i == 0 || y > rect[3]) rect[3] = y;
+	if (i == 0 || z < rect[4]) rect[4] = z;
+    }
+    return 1;
+}
+
+
+
+float
+occScreenArea(OccBuffer *ob, const GLfloat mvp[16],
+    const GLfloat boxMin[3], const GLfloat boxMax[3])
+{
+    GLfloat r[5];
+
+    if (!projectBox(ob, mvp, boxMin, boxMax, r))
+	return (float)ob->width * ob->height;
+
+    if (r[0] < 0.0f) r[0] = 0.0f;
+    if (r[1] < 0.0f) r[1] = 0.0f;
+    if (r[2] > ob->width) r[2] = (GLfloat)ob->width;
+    if (r[3] > ob->height) r[3] = (GLfloat)ob->height;
+    if (r[2] <= r[0] || r[3] <= r[1])
+	return 0.0f;
+    return (r[2] - r[0]) * (r[3] - r[1]);
+}
+
+
+
+/*
+ * occTestBox
+ *
+ *	Find the pyramid level where the box covers at most
+ *	OCC_TEST_SPAN texels each way; the box is hidden if all of those
+ *	texels are nearer than the nearest point of the box.
+ */
+
+int
+occTestBox(OccBuffer *ob, const GLfloat mvp[16],
+    const GLfloat boxMin[3], const GLfloat boxMax[3])
+{
+    GLfloat r[5], *hiz;
+    int x0, y0, x1, y1, x, y, l, w;
+
+    if (!projectBox(ob, mvp, boxMin, boxMax, r))
+	return 1;
+
+    /* Outside the view */
+    if (r[2] < 0.0f || r[3] < 0.0f || r[0] >= ob->width ||
+	    r[1] >= ob->height || r[4] > 1.0f)
+	return 0;
+
+    x0 = r[0] < 0.0f ? 0 : (int)r[0];
+    y0 = r[1] < 0.0f ? 0 : (int)r[1];
+    x1 = r[2] >= ob->width ? ob->width - 1 : (int)r[2];
+    y1 = r[3] >= ob->height ? ob->height - 1 : (int)r[3];
+
+    for (l = 0; l < ob->levels - 1; l++) {
+	if ((x1 >> l) - (x0 >> l) < OCC_TEST_SPAN &&
+		(y1 >> l) - (y0 >> l) < OCC_TEST_SPAN)
+	    break;
+    }
+
+    hiz = ob->level[l];
+    w = ob->levelWidth[l];
+    for (y = y0 >> l; y <= (y1 >> l); y++) {
+	for (x = x0 >> l; x <= (x1 >> l); x++) {
+	    if (hiz[y * w + x] >= r[4])
+		return 1;
+	}
+    }
+    return 0;
+} /* End of occTestBox */
+
+
+
+const GLfloat *
+occDepth(OccBuffer *ob, int *width, int *height)
+{
+    *width = ob->width;
+    *height = ob->height;
+    return ob->level[0];
+}
+
+
+
+/* End of occlude.c */
@@ -0,0 +1,54 @@
+/*
+ * occlude.h
+ *
+ *	Header of the software occlusion culling module.
+ *
+ *	Large occluders are rasterized into a small CPU depth buffer.  A
+ *	hierarchical-Z pyramid (farthest depth of each 2x2 block, level
+ *	by level) is built from it, and the screen bounding rectangle of
+ *	each remaining object is tested against the coarsest level that
+ *	covers it in a few texels.  Objects found behind the occluders
+ *	need not be sent to OpenGL at all.
+ *
+ *	All matrices are column-major, as OpenGL keeps them, and map
+ *	object coordinates to clip coordinates (projection * modelview).
+ */
+
+#ifndef OCCLUDE_MODULE_HEADER
+#define OCCLUDE_MODULE_HEADER
+
+#include <GL/gl.h>
+
+typedef struct OccBuffer OccBuffer;
+
+OccBuffer *occNew(int width, int height);
+void occDelete(OccBuffer *ob);
+
+/* Clear the depth buffer to the far plane */
+void occClear(OccBuffer *ob);
+
+/* Rasterize triangles (9 floats each) into the depth buffer */
+void occRasterTriangles(OccBuffer *ob, const GLfloat mvp[16],
+    const GLfloat *triangles, int triangleCount);
+
+/* Build the hierarchical-Z pyramid, after all occluders are drawn */
+void occBuildPyramid(OccBuffer *ob);
+
+/* Projected area of a box in depth buffer pixels, for choosing
+ * occluders.  Boxes crossing the near plane count as full screen.
+ */
+float occScreenArea(OccBuffer *ob, const GLfloat mvp[16],
+    const GLfloat boxMin[3], const GLfloat boxMax[3]);
+
+/* Returns 0 if the box is hidden behind the occluders or off screen,
+ * 1 if it may be visible.
+ */
+int occTestBox(OccBuffer *ob, const GLfloat mvp[16],
+    const GLfloat boxMin[3], const GLfloat boxMax[3]);
+
+/* Access to the finished depth buffer, width * height floats in [0,1] */
+const GLfloat *occDepth(OccBuffer *ob, int *width, int *height);
+
+#endif /* OCCLUDE_MODULE_HEADER */
+
+/* End of occlude.h */
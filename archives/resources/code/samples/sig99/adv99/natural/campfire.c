@@ -5,6 +5,7 @@
 #include "texture.h"
 
 #include "sm.h"
+#include "sprite.h"
 
 #if !defined(GL_VERSION_1_1) && !defined(GL_VERSION_1_2)
 #define glBindTexture	glBindTextureEXT
@@ -22,6 +23,7 @@
 #endif
 
 static void *smoke;
+static sbatch_t *flame;
 static int marshmallow;
 static int the_texture;
 static int texture_count;
@@ -193,6 +195,11 @@ void init(void) {
     glTexImage2D(GL_TEXTURE_2D, 0, components, width,
 	     height, 0, GL_RGBA, GL_UNSIGNED_BYTE, image);
     smoke = new_smoke(0.f, 0.f, 0.f, .0f, 2.5f, 0.f, 25, .4f, 1+texture_count);
+    flame = sb_new(1);
+    if (smoke == NULL || flame == NULL) {
+	fprintf(stderr, "Error: out of memory\n");
+	exit(EXIT_FAILURE);
+    }
 
     glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
     glEnable(GL_TEXTURE_2D);
@@ -339,6 +346,8 @@ logs(void) {
 static void calcMatrix(void);
 
 void display(void) {
+    static float right[3] = {1.f, 0.f, 0.f}, up[3] = {0.f, 1.f, 0.f};
+
     glClear(GL_COLOR_BUFFER_BIT|GL_DEPTH_BUFFER_BIT);
 
     glLoadIdentity();
@@ -376,20 +385,15 @@ void display(void) {
     glPushMatrix();
     glTranslatef(/*(delta/2.f*/-1.f, /*delta*/-.25f, -1.5f);
     calcMatrix();
-    glScalef(1.f,1.f,1.);
     if (texture) {
 	glBindTexture(GL_TEXTURE_2D, the_texture+1);
 	glEnable(GL_TEXTURE_2D);
     }
-    glColor4f(intensity, intensity, intensity, opacity);
-    glRotatef(rot, 0., 0., 1.);
     glDepthMask(0);
-    glBegin(GL_POLYGON);
-	glTexCoord2f(0.0, 0.0); glVertex2f(-1.0, -1.0);
-	glTexCoord2f(1.0, 0.0); glVertex2f(1.0, -1.0);
-	glTexCoord2f(1.0, 1.0); glVertex2f(1.0, 1.0);
-	glTexCoord2f(0.0, 1.0); glVertex2f(-1.0, 1.0);
-    glEnd();
+    sb_begin(flame, right, up);
+    sb_add_rot(flame, 0.f, 0.f, 0.f, 1.f, rot,
+	       intensity, intensity, intensity, opacity);
+    sb_draw(flame, 0);
     glDepthMask(1);
     glPopMatrix();
     glDisable(GL_TEXTURE_2D);
@@ -11,6 +11,7 @@
 #include <stdlib.h>
 #include <GL/glut.h>
 #include "texture.h"
+#include "sprite.h"
 
 #ifdef _WIN32
 #define sinf(x) ((float)sin((x)))
@@ -22,6 +23,7 @@
 #endif
 
 GLuint texnames[2];
+sbatch_t *explosions;	/* billboards of the exploder() calls */
 static int texture = 1;
 static float rot = 0.f;
 static float opacity = 1.0f;
@@ -332,6 +334,11 @@ init(void)
     glEnable(GL_COLOR_MATERIAL);
     glEnable(GL_NORMALIZE);
 
+    explosions = sb_new(5);
+    if (explosions == NULL) {
+	fprintf(stderr, "Error: out of memory\n");
+	exit(EXIT_FAILURE);
+    }
 }
 
 #define sgn(a) ((a) >= 0 ? 1.0 : -1.0)
@@ -418,34 +425,37 @@ explode(void)
 
 static void calcMatrix(void);
 
+/*
+ * add an explosion billboard to the batch; draw them with
+ * drawexplosions() 
+ */
 void 
 exploder(float x, float y, float z, float size, float intensity, float opacity, float delay, float scale)
 {
     if (size - delay <= 0.f)
 	return;
 
-    /*
-     * explosion 
-     */
+    sb_add(explosions, x, y, z, (size - delay) * scale,
+	   intensity, intensity, intensity, opacity);
+}
+
+/*
+ * the explosions in the billboarded space of calcMatrix(), farthest first 
+ */
+void 
+drawexplosions(void)
+{
+    static float right[3] = {1.f, 0.f, 0.f}, up[3] = {0.f, 1.f, 0.f};
+
     glPushMatrix();
     calcMatrix();
-    glTranslatef(x, y, z);
-    glScalef((size - delay) * scale, (size - delay) * scale, 1.);
     if (texture)
 	glEnable(GL_TEXTURE_2D);
     glBindTexture(GL_TEXTURE_2D, texnames[0]);
-    glColor4f(intensity, intensity, intensity, opacity);
-    glBegin(GL_POLYGON);
-    glTexCoord2f(0.0, 0.0);
-    glVertex2f(-1.0, -1.0);
-    glTexCoord2f(1.0, 0.0);
-    glVertex2f(1.0, -1.0);
-    glTexCoord2f(1.0, 1.0);
-    glVertex2f(1.0, 1.0);
-    glTexCoord2f(0.0, 1.0);
-    glVertex2f(-1.0, 1.0);
-    glEnd();
+    sb_draw(explosions, 1);
     glPopMatrix();
+    /* calcMatrix() already faces the eye, so the quads span x and y */
+    sb_begin(explosions, right, up);
 }
 
 
@@ -561,6 +571,7 @@ display(void)
     exploder(0.f, 1.2f, 0.f, size - .4f, intensity, opacity, .4f, 2.f);
 
     exploder(1.6f, .3f, 0.f, size - 1.f, intensity, opacity, .5f, 3.f);
+    drawexplosions();
     glEnable(GL_DEPTH_TEST);
 
 
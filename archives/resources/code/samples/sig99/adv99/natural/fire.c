@@ -18,6 +18,7 @@
 #include <math.h>
 #include "texture.h"
 #include <GL/glut.h>
+#include "sprite.h"
 
 #ifdef _WIN32
 /* Win32 math.h doesn't define float versions of the trig functions. */
@@ -41,6 +42,7 @@ static int billboard = 1;
 
 int flames = 0; /* current flame image */
 int flameCount = 32; /* total number of flame images */
+sbatch_t *flame; /* the flame billboard */
 
 static float transx = 1.0, transy, rotx, roty;
 static int ox = -1, oy = -1;
@@ -173,6 +175,13 @@ void init(void)
     glEnable(GL_ALPHA_TEST);
     glEnable(GL_DEPTH_TEST);
 
+    flame = sb_new(1);
+    if(flame == NULL)
+    {
+	fprintf(stderr, "out of memory\n");
+	exit(EXIT_FAILURE);
+    }
+
     /* turn on lighting, enable light 0, and turn on colormaterial */
     glEnable(GL_LIGHTING);
     glEnable(GL_LIGHT0);
@@ -286,6 +295,7 @@ display(void)
      */
 
     float mat[16];
+    static float right[3] = {1.f, 0.f, 0.f}, up[3] = {0.f, 1.f, 0.f};
     glClear(GL_COLOR_BUFFER_BIT|GL_DEPTH_BUFFER_BIT);
 
     glLoadIdentity();
@@ -328,17 +338,9 @@ display(void)
     glDisable(GL_LIGHTING);
     glEnable(GL_TEXTURE_2D);
     glBindTexture(GL_TEXTURE_2D, flames);
-    glColor4f(1.f, 1.f, 1.f, 1.f);
-    glBegin(GL_POLYGON);
-	glTexCoord2f(0.0, 0.0);
-	glVertex2f(-1.0, -1.0);
-	glTexCoord2f(1.0, 0.0);
-	glVertex2f(1.0, -1.0);
-	glTexCoord2f(1.0, 1.0);
-	glVertex2f(1.0, 1.0);
-	glTexCoord2f(0.0, 1.0);
-	glVertex2f(-1.0, 1.0);
-    glEnd();
+    sb_begin(flame, right, up);
+    sb_add(flame, 0.f, 0.f, 0.f, 1.f, 1.f, 1.f, 1.f, 1.f);
+    sb_draw(flame, 0);
     glPopMatrix();
 
     /* turn lighting back on */
@@ -18,6 +18,7 @@
 #include <math.h>
 #include "../util/texture.h"
 #include <GL/glut.h>
+#include "ps.h"
 
 #ifdef _WIN32
 /* Win32 math.h doesn't define float versions of the trig functions. */
@@ -48,17 +49,8 @@ GLboolean dblbuf = GL_TRUE;
 enum {NO_DLIST, FLAME_BASE, GROUND};
 enum {X, Y, Z};
 
-typedef struct {
-    GLfloat pos[3];
-    GLfloat color[4]; /* RGBA */
-    GLfloat Dr, Dg, Db, Da; /* Change in Color */
-    GLfloat Vx, Vy, Vz;
-    GLfloat Ax, Ay, Az;
-} Particle;
-
-
 #define PART_COUNT 20000
-Particle parts[PART_COUNT]; /* array of particles */
+psys_t *parts; /* the particles, see ps.h */
 
 
 
@@ -133,42 +125,46 @@ enum {R, G, B, A};
 
 /* initialize the particle data */
 void
-initpart(Particle parts[], int cnt)
+initpart(psys_t *parts, int cnt)
 {
-    int i;
+    int i, j;
     GLfloat r, theta, phi;
-    for(i = 0; i < cnt; i++) {
+
+    parts->count = 0;
+    parts->floor = -1.f;
+    for(j = 0; j < cnt; j++) {
+	i = ps_spawn(parts);
 	r = drand48()/10.f * sinf(phi);
 	phi = (.5 - drand48()) * M_PI;
 	theta = (.5 - drand48()) * 2 * M_PI;
 
 #if 0
-	parts[i].Vx = (drand48() - .5f)/60.f;
-	parts[i].Vz = (drand48() - .5f)/60.f;
-	parts[i].Vy = drand48()/15.f;
+	parts->vx[i] = (drand48() - .5f)/60.f;
+	parts->vz[i] = (drand48() - .5f)/60.f;
+	parts->vy[i] = drand48()/15.f;
 #else
-	parts[i].Vy = r * cosf(phi);
-	parts[i].Vx = r * cosf(theta) * sinf(phi);
-	parts[i].Vz = r * sinf(theta) * sinf(phi);
+	parts->vy[i] = r * cosf(phi);
+	parts->vx[i] = r * cosf(theta) * sinf(phi);
+	parts->vz[i] = r * sinf(theta) * sinf(phi);
 #endif
 
-	parts[i].pos[X] = 0.f;
-	parts[i].pos[Y] = -1.f;
-	parts[i].pos[Z] = 0.f;
+	parts->x[i] = 0.f;
+	parts->y[i] = -1.f;
+	parts->z[i] = 0.f;
 
-	parts[i].Ax = 0.f;
-	parts[i].Ay = -.001f;
-	parts[i].Az = 0.f;
+	parts->ax[i] = 0.f;
+	parts->ay[i] = -.001f;
+	parts->az[i] = 0.f;
 
-	parts[i].color[R] = 1.f;
-	parts[i].color[G] = 1.f;
-	parts[i].color[B] = 1.f;
-	parts[i].color[A] = 1.f;
+	parts->r[i] = 1.f;
+	parts->g[i] = 1.f;
+	parts->b[i] = 1.f;
+	parts->a[i] = 1.f;
 
-	parts[i].Dr = (.5 - drand48())/50.f;
-	parts[i].Dg = (.5 - drand48())/50.f;
-	parts[i].Db = (.5- drand48())/50.f;
-	parts[i].Da = (.5 - drand48())/50.f;
+	parts->dr[i] = (.5 - drand48())/50.f;
+	parts->dg[i] = (.5 - drand48())/50.f;
+	parts->db[i] = (.5- drand48())/50.f;
+	parts->da[i] = (.5 - drand48())/50.f;
 
     }
 }
@@ -219,56 +215,21 @@ void init(void)
     glEnd();
     glEndList();
 
+    parts = ps_new(PART_COUNT, PS_ACCEL|PS_COLOR|PS_FLOOR|PS_COLOR_CLAMP);
+    if (parts == NULL) {
+	fprintf(stderr, "not enough memory for %d particles\n", PART_COUNT);
+	exit(EXIT_FAILURE);
+    }
     initpart(parts, PART_COUNT);
 }
 
 
-/* update the particle data */
+/* update the particle data: move on by velocity and velocity by
+   acceleration, fade the colors and stop at the ground (y = -1) */
 void
-updatepart(Particle parts[], int cnt)
+updatepart(psys_t *parts)
 {
-    int i;
-    for(i = 0; i < cnt; i++) {
-	parts[i].pos[X] += parts[i].Vx;
-	parts[i].pos[Y] += parts[i].Vy;
-	parts[i].pos[Z] += parts[i].Vz;
-
-	parts[i].Vx += parts[i].Ax;
-	parts[i].Vy += parts[i].Ay;
-	parts[i].Vz += parts[i].Az;
-
-	parts[i].color[R] += parts[i].Dr;
-	parts[i].color[G] += parts[i].Dg;
-	parts[i].color[B] += parts[i].Db;
-	parts[i].color[A] += parts[i].Da;
-
-	if(parts[i].color[R] < 0.f) {
-	    parts[i].color[R] = 0.f;
-	    parts[i].Dr = 0.f;
-	}
-
-	if(parts[i].color[G] < 0.f) {
-	    parts[i].color[G] = 0.f;
-	    parts[i].Dg = 0.f;
-	}
-
-	if(parts[i].color[B] < 0.f) {
-	    parts[i].color[B] = 0.f;
-	    parts[i].Db = 0.f;
-	}
-	if(parts[i].color[A] < 0.f) {
-	    parts[i].color[A] = 0.f;
-	    parts[i].Da = 0.f;
-	}
-
-	if(parts[i].pos[Y] < -1.f) {
-	    parts[i].pos[Y] = -1.f;
-	    parts[i].Vx = 0.f;
-	    parts[i].Vy = 0.f;
-	    parts[i].Vz = 0.f;
-	}
-
-    }
+    ps_update(parts, 1.f);
 }
 
 
@@ -310,12 +271,12 @@ display(void)
     glCallList(FLAME_BASE);
 
     glBegin(GL_POINTS);
-    for(i = 0; i < PART_COUNT; i++) {
-	glColor3fv(parts[i].color);
-	glVertex3fv(parts[i].pos);
+    for(i = 0; i < parts->count; i++) {
+	glColor3f(parts->r[i], parts->g[i], parts->b[i]);
+	glVertex3f(parts->x[i], parts->y[i], parts->z[i]);
     }
 
-    updatepart(parts, PART_COUNT);
+    updatepart(parts);
 
     glEnd();
 
@@ -0,0 +1,319 @@
+#include <stdlib.h>
+#include <string.h>
+#include "ps.h"
+#include "precip.h"
+
+/* Win32 builds step on the render thread */
+#if defined(_WIN32) && !defined(PRECIP_NO_THREADS)
+#define PRECIP_NO_THREADS
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+#define drand48() ((float)rand()/RAND_MAX)
+#else
+#include <sys/time.h>
+#include <time.h>
+#endif
+
+#ifndef PRECIP_NO_THREADS
+#include <pthread.h>
+#endif
+
+/* most steps to catch up on at once, after a pause or a slow frame */
+#define MAX_BEHIND 10
+
+struct precip {
+    psys_t *parts;
+    int flags;
+    int total;			/* number of particles */
+    int update;			/* number reset per step */
+    float Ry;			/* reset distance */
+    float Vy;			/* falling speed */
+    int moving;			/* all particles have been started */
+    int offset;			/* next particles to start or reset */
+    long steps;
+    int stride;			/* floats per particle in buf */
+    float *buf[2];		/* vertices, drawn from buf[front] */
+    int front;
+    int running;
+    double next;		/* time of the next step, in seconds */
+#ifndef PRECIP_NO_THREADS
+    pthread_t thread;
+    pthread_mutex_t lock;	/* front, steps, running, reading, quit */
+    pthread_mutex_t sim;	/* the particles, back buffer and swaps */
+    pthread_cond_t wake;	/* running or quit changed */
+    pthread_cond_t done;	/* reading went to 0 */
+    int reading;
+    int quit;
+    int started;
+#endif
+};
+
+static double
+now(void) {
+#ifdef _WIN32
+    return GetTickCount() / 1000.;
+#else
+    struct timeval t;
+
+    gettimeofday(&t, NULL);
+    return t.tv_sec + t.tv_usec / 1e6;
+#endif
+}
+
+/* the particles as vertices */
+static void
+fill(precip_t *p, float *b) {
+    psys_t *ps = p->parts;
+    int i;
+
+    if (p->flags & PRECIP_STREAKS) {
+	for(i = 0; i < p->total; i++, b += 6) {
+	    b[0] = b[3] = ps->x[i];
+	    b[1] = ps->y[i];
+	    b[4] = ps->y[i] + ps->size[i];
+	    b[2] = b[5] = ps->z[i];
+	}
+    } else {
+	for(i = 0; i < p->total; i++, b += 3) {
+	    b[0] = ps->x[i];
+	    b[1] = ps->y[i];
+	    b[2] = ps->z[i];
+	}
+    }
+}
+
+/* move every particle on a step, then start or reset the next few; the
+   caller owns the particles and the back buffer */
+static void
+simulate(precip_t *p) {
+    psys_t *ps = p->parts;
+    int i, k;
+
+    ps_update(ps, 1.f);
+    if (!p->moving) {
+	for(i = 0, k = p->offset; i < p->update && k < p->total; i++, k++)
+	    ps->vy[k] = p->Vy;
+	p->offset += p->update;
+	if (p->offset >= p->total) {
+	    p->moving = 1;
+	    p->offset = 0;
+	}
+    } else {
+	/* put them back at the top */
+	for(i = 0, k = p->offset; i < p->update; i++) {
+	    ps->y[k] += p->Ry;
+	    if (++k == p->total) k = 0;
+	}
+	p->offset = k;
+    }
+    fill(p, p->buf[!p->front]);
+}
+
+#ifndef PRECIP_NO_THREADS
+static void
+swap(precip_t *p) {
+    pthread_mutex_lock(&p->lock);
+    while(p->reading)
+	pthread_cond_wait(&p->done, &p->lock);
+    p->front = !p->front;
+    p->steps++;
+    pthread_mutex_unlock(&p->lock);
+}
+
+static void *
+worker(void *arg) {
+    precip_t *p = arg;
+    struct timespec ts;
+    double t;
+
+    pthread_mutex_lock(&p->lock);
+    for(;;) {
+	if (!p->running && !p->quit) {
+	    while(!p->running && !p->quit)
+		pthread_cond_wait(&p->wake, &p->lock);
+	    p->next = now();
+	}
+	if (p->quit)
+	    break;
+	pthread_mutex_unlock(&p->lock);
+
+	t = p->next - now();
+	if (t > 0.) {
+	    ts.tv_sec = (time_t)t;
+	    ts.tv_nsec = (long)((t - ts.tv_sec) * 1e9);
+	    nanosleep(&ts, NULL);
+	}
+	pthread_mutex_lock(&p->sim);
+	simulate(p);
+	swap(p);
+	pthread_mutex_unlock(&p->sim);
+
+	p->next += 1. / PRECIP_HZ;
+	if (now() - p->next > MAX_BEHIND / (double)PRECIP_HZ)
+	    p->next = now();
+	pthread_mutex_lock(&p->lock);
+    }
+    pthread_mutex_unlock(&p->lock);
+    return NULL;
+}
+#endif
+
+precip_t *
+precip_new(const float start[3], const float end[3], int nframes,
+	int nparts, int flags) {
+    precip_t *p = calloc(1, sizeof(precip_t));
+    psys_t *ps;
+    int i, j;
+
+    if (p == NULL)
+	return NULL;
+    p->flags = flags;
+    p->total = nparts;
+    p->Ry = start[1] - end[1];
+    p->Vy = -p->Ry / nframes;
+    p->update = nparts / nframes;	/* this should have no remainder */
+    if (p->update < 1) p->update = 1;
+    p->stride = flags & PRECIP_STREAKS ? 6 : 3;
+    p->parts = ps = ps_new(nparts, flags & PRECIP_STREAKS ? PS_SIZE : 0);
+    p->buf[0] = malloc(p->stride * nparts * sizeof(float));
+    p->buf[1] = malloc(p->stride * nparts * sizeof(float));
+    if (ps == NULL || p->buf[0] == NULL || p->buf[1] == NULL) {
+	if (ps) ps_delete(ps);
+	free(p->buf[0]);
+	free(p->buf[1]);
+	free(p);
+	return NULL;
+    }
+
+    for(i = 0; i < nparts; i++) {
+	j = ps_spawn(ps);
+	/* XXX this part should be more general */
+	ps->x[j] = -50 + drand48() * 100.f;
+	ps->z[j] = drand48() * 90.f;
+	ps->y[j] = start[1];	/* starting height */
+	/* jitter the starting points in y by fall distance per frame (Vy) */
+	if (flags & PRECIP_JITTER)
+	    ps->y[j] += -p->Vy + 2 * p->Vy * drand48();
+	if (flags & PRECIP_STREAKS)
+	    ps->size[j] = -drand48() * 1.5f * p->Vy;
+	/* the velocities stay 0 until simulate() starts them */
+    }
+    fill(p, p->buf[0]);
+    fill(p, p->buf[1]);
+
+#ifndef PRECIP_NO_THREADS
+    pthread_mutex_init(&p->lock, NULL);
+    pthread_mutex_init(&p->sim, NULL);
+    pthread_cond_init(&p->wake, NULL);
+    pthread_cond_init(&p->done, NULL);
+    if (pthread_create(&p->thread, NULL, worker, p) != 0) {
+	precip_delete(p);
+	return NULL;
+    }
+    p->started = 1;
+#endif
+    return p;
+}
+
+void
+precip_delete(precip_t *p) {
+#ifndef PRECIP_NO_THREADS
+    pthread_mutex_lock(&p->lock);
+    p->quit = 1;
+    pthread_cond_signal(&p->wake);
+    pthread_mutex_unlock(&p->lock);
+    if (p->started)
+	pthread_join(p->thread, NULL);
+    pthread_mutex_destroy(&p->lock);
+    pthread_mutex_destroy(&p->sim);
+    pthread_cond_destroy(&p->wake);
+    pthread_cond_destroy(&p->done);
+#endif
+    ps_delete(p->parts);
+    free(p->buf[0]);
+    free(p->buf[1]);
+    free(p);
+}
+
+void
+precip_run(precip_t *p, int run) {
+#ifndef PRECIP_NO_THREADS
+    pthread_mutex_lock(&p->lock);
+    p->running = run;
+    pthread_cond_signal(&p->wake);
+    pthread_mutex_unlock(&p->lock);
+#else
+    if (run && !p->running)
+	p->next = now();
+    p->running = run;
+#endif
+}
+
+void
+precip_step(precip_t *p) {
+#ifndef PRECIP_NO_THREADS
+    pthread_mutex_lock(&p->sim);
+    simulate(p);
+    swap(p);
+    pthread_mutex_unlock(&p->sim);
+#else
+    simulate(p);
+    p->front = !p->front;
+    p->steps++;
+#endif
+}
+
+const float *
+precip_lock(precip_t *p, int *count, int *stride) {
+    const float *b;
+
+#ifndef PRECIP_NO_THREADS
+    pthread_mutex_lock(&p->lock);
+    p->reading = 1;
+    b = p->buf[p->front];
+    pthread_mutex_unlock(&p->lock);
+#else
+    int n;
+
+    /* the steps that are due, a few at most */
+    if (p->running) {
+	double t = now();
+	for(n = 0; p->next <= t && n < MAX_BEHIND; n++) {
+	    precip_step(p);
+	    p->next += 1. / PRECIP_HZ;
+	}
+	if (p->next <= t)
+	    p->next = t;
+    }
+    b = p->buf[p->front];
+#endif
+    *count = p->total;
+    *stride = p->stride;
+    return b;
+}
+
+void
+precip_unlock(precip_t *p) {
+#ifndef PRECIP_NO_THREADS
+    pthread_mutex_lock(&p->lock);
+    p->reading = 0;
+    pthread_cond_signal(&p->done);
+    pthread_mutex_unlock(&p->lock);
+#endif
+}
+
+long
+precip_steps(precip_t *p) {
+    long steps;
+
+#ifndef PRECIP_NO_THREADS
+    pthread_mutex_lock(&p->lock);
+    steps = p->steps;
+    pthread_mutex_unlock(&p->lock);
+#else
+    steps = p->steps;
+#endif
+    return steps;
+}
@@ -0,0 +1,42 @@
+/*
+ * falling rain and snow for rain.c and snow.c
+ *
+ * The particles fall from a start plane to an end plane in nframes
+ * steps and are put back at the top a few at a time, so that the sky
+ * stays evenly filled.  The simulation runs at a fixed PRECIP_HZ steps
+ * per second on its own thread, whatever the frame rate.  After each
+ * step it writes the particle vertices into the back of two buffers and
+ * swaps them; the render thread only draws the front buffer, between
+ * precip_lock and precip_unlock.  Without threads (Win32, or
+ * PRECIP_NO_THREADS) precip_lock runs the steps that are due instead.
+ */
+
+#define PRECIP_HZ	60
+
+/* precip_new flags */
+#define PRECIP_JITTER	0x01	/* start at heights a step apart */
+#define PRECIP_STREAKS	0x02	/* two vertices per particle, for lines */
+
+typedef struct precip precip_t;
+
+/* particles from start to end (the planes' heights matter, x and z are
+   spread over the sky), falling for nframes steps */
+precip_t *precip_new(const float start[3], const float end[3], int nframes,
+	int nparts, int flags);
+void precip_delete(precip_t *p);
+
+/* start or pause the simulation */
+void precip_run(precip_t *p, int run);
+
+/* one step on the calling thread, for a paused system */
+void precip_step(precip_t *p);
+
+/* the newest vertices: xyz for each particle, with PRECIP_STREAKS
+   followed by the top of its streak; count is the number of particles
+   and stride the floats from one particle to the next.  The buffer
+   stays valid until precip_unlock. */
+const float *precip_lock(precip_t *p, int *count, int *stride);
+void precip_unlock(precip_t *p);
+
+/* steps simulated so far */
+long precip_steps(precip_t *p);
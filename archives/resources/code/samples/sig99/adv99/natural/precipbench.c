@@ -0,0 +1,201 @@
+/*
+ * Benchmark of the threaded rain simulation (precip.c).
+ *
+ * The rain of rain.c is drawn as lines the way displaypart() used to,
+ * moving every particle inside the glBegin/glEnd loop and resetting the
+ * next few after it, and then from precip's front buffer with the
+ * simulation running on its own thread.  For each number of particles
+ * the time per frame is printed, wall clock and the render thread's own
+ * CPU time where the system keeps it, with the simulation steps per
+ * second: one a frame before, up to PRECIP_HZ now.  Each is run for at
+ * least a second.  With fewer processors than threads the simulation
+ * takes its time out of the render thread's wall clock time.
+ *
+ * usage: precipbench [max particles [frames]]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <GL/glut.h>
+#include "ps.h"
+#include "precip.h"
+
+#ifdef _WIN32
+#include <windows.h>
+typedef int timer;
+#define getTime(a)	(a = GetTickCount())
+#define timeDiff(a, b)	((b - a) * 1000)
+#define drand48() ((float)rand()/RAND_MAX)
+#else
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+typedef struct timeval timer;
+#define getTime(a)	gettimeofday(&a, NULL)
+#define timeDiff(a, b)	(((b.tv_sec - a.tv_sec) * 1000000) + b.tv_usec - a.tv_usec)
+#endif
+
+/* CPU time of the calling thread in microseconds, or 0 */
+static double
+threadTime(void) {
+#if defined(_POSIX_THREAD_CPUTIME) && _POSIX_THREAD_CPUTIME >= 0
+    struct timespec t;
+
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t) == 0)
+	return t.tv_sec * 1e6 + t.tv_nsec / 1e3;
+#endif
+    return 0.;
+}
+
+#define SIZE 256		/* window size */
+#define NFRAMES 50		/* steps to fall, as in rain.c */
+
+static int max = 1000000, frames = 10;
+static float begin[] = {0.f, 200.f, 0.f}, end[] = {0.f, -100.f, 0.f};
+
+/* rain.c's particle system before precip.c */
+static psys_t *parts;
+static int offset, update;
+
+static void
+initpart(int nparts) {
+    float Vy = -(begin[1] - end[1]) / NFRAMES;
+    int i, j;
+
+    parts = ps_new(nparts, PS_SIZE);
+    if (parts == NULL) {
+	fprintf(stderr, "not enough memory for %d particles\n", nparts);
+	exit(1);
+    }
+    for(i = 0; i < nparts; i++) {
+	j = ps_spawn(parts);
+	parts->x[j] = -50 + drand48() * 100.f;
+	parts->z[j] = drand48() * 90.f;
+	parts->y[j] = begin[1] - Vy + 2 * Vy * drand48();
+	parts->size[j] = -drand48() * 1.5f * Vy;
+	parts->vy[j] = Vy;
+    }
+    update = nparts / NFRAMES;
+    offset = 0;
+}
+
+static void
+displaypart(void) {
+    int i;
+
+    glBegin(GL_LINES);
+    for(i = 0; i < parts->count; i++) {
+	glVertex3f(parts->x[i], parts->y[i], parts->z[i]);
+	glVertex3f(parts->x[i], parts->y[i] + parts->size[i], parts->z[i]);
+    }
+    glEnd();
+    ps_update(parts, 1.f);
+    for(i = 0; i < update; i++)
+	parts->y[(offset + i) % parts->count] += begin[1] - end[1];
+    offset = (offset + update) % parts->count;
+}
+
+static void
+drawprecip(precip_t *p) {
+    const float *v;
+    int count, stride;
+
+    v = precip_lock(p, &count, &stride);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glVertexPointer(3, GL_FLOAT, 0, v);
+    glDrawArrays(GL_LINES, 0, 2 * count);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    precip_unlock(p);
+}
+
+static void
+init(void) {
+    glColor3f(.5f, .5f, .5f);
+    glMatrixMode(GL_PROJECTION);
+    gluPerspective(60., 1., .1, 1000.);
+    glMatrixMode(GL_MODELVIEW);
+    gluLookAt(0., 0., 200., 0., 0., 45., 0., 1., 0.);
+}
+
+/* frames of draw (at least frames, and a second) */
+static void
+run(void (*draw)(void), int *nframes, double *wall, double *cpu) {
+    timer t0, t1;
+    double c;
+    long usec;
+    int f = 0;
+
+    draw();			/* one untimed frame */
+    glFinish();
+    c = threadTime();
+    getTime(t0);
+    do {
+	glClear(GL_COLOR_BUFFER_BIT);
+	draw();
+	glFinish();
+	getTime(t1);
+	usec = timeDiff(t0, t1);
+    } while(++f < frames || usec < 1000000);
+    *cpu = (threadTime() - c) / 1000. / f;
+    *wall = usec / 1000. / f;
+    *nframes = f;
+}
+
+static precip_t *p;
+
+static void
+drawthreaded(void) {
+    drawprecip(p);
+}
+
+static void
+bench(void) {
+    double wall[2], cpu[2];
+    long steps;
+    int n, f[2];
+
+    printf("%s\n", (char *)glGetString(GL_RENDERER));
+    printf("ms per frame: wall clock and render thread CPU\n");
+    printf("%10s %8s %8s %8s %8s %8s %8s\n", "particles",
+	   "before", "cpu", "steps/s", "threaded", "cpu", "steps/s");
+    for(n = 10000; n <= max; n *= 10) {
+	initpart(n);
+	run(displaypart, &f[0], &wall[0], &cpu[0]);
+	ps_delete(parts);
+
+	p = precip_new(begin, end, NFRAMES, n, PRECIP_JITTER|PRECIP_STREAKS);
+	if (p == NULL) {
+	    fprintf(stderr, "not enough memory for %d particles\n", n);
+	    exit(1);
+	}
+	precip_run(p, 1);
+	steps = precip_steps(p);
+	run(drawthreaded, &f[1], &wall[1], &cpu[1]);
+	steps = precip_steps(p) - steps;
+	precip_delete(p);
+
+	printf("%10d %8.2f %8.2f %8.1f %8.2f %8.2f %8.1f\n", n,
+	       wall[0], cpu[0], 1000. / wall[0],
+	       wall[1], cpu[1], steps * 1000. / (wall[1] * f[1]));
+    }
+}
+
+static void
+display(void) {
+    bench();
+    exit(0);
+}
+
+int
+main(int argc, char *argv[]) {
+    glutInit(&argc, argv);
+    if (argc > 1) max = atoi(argv[1]);
+    if (argc > 2) frames = atoi(argv[2]);
+    glutInitWindowSize(SIZE, SIZE);
+    glutInitDisplayMode(GLUT_RGBA|GLUT_SINGLE);
+    (void)glutCreateWindow("precipbench");
+    init();
+    glutDisplayFunc(display);
+    glutMainLoop();
+    return 0;
+}
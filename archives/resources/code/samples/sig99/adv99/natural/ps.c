@@ -0,0 +1,252 @@
+#include <stdlib.h>
+#include "ps.h"
+#include "pool.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define PS_SSE
+#include <xmmintrin.h>
+#endif
+
+/* fewest particles worth handing to another thread */
+#define PS_THREAD_MIN 65536
+
+#define MAX_ARRAYS 21
+
+/* the allocated arrays of a system, in a fixed order */
+static int
+arrays(psys_t *ps, float ***list) {
+    int n = 0;
+
+    list[n++] = &ps->x; list[n++] = &ps->y; list[n++] = &ps->z;
+    list[n++] = &ps->vx; list[n++] = &ps->vy; list[n++] = &ps->vz;
+    if (ps->flags & PS_ACCEL) {
+	list[n++] = &ps->ax; list[n++] = &ps->ay; list[n++] = &ps->az;
+    }
+    if (ps->flags & PS_COLOR) {
+	list[n++] = &ps->r; list[n++] = &ps->g;
+	list[n++] = &ps->b; list[n++] = &ps->a;
+	list[n++] = &ps->dr; list[n++] = &ps->dg;
+	list[n++] = &ps->db; list[n++] = &ps->da;
+    }
+    if (ps->flags & PS_SIZE) {
+	list[n++] = &ps->size; list[n++] = &ps->dsize;
+    }
+    if (ps->flags & PS_AGE) {
+	list[n++] = &ps->age; list[n++] = &ps->life;
+    }
+    return n;
+}
+
+psys_t *
+ps_new(int max, int flags) {
+    psys_t *ps = calloc(1, sizeof(psys_t));
+    float **list[MAX_ARRAYS];
+    int i, n, stride;
+
+    if (ps == NULL)
+	return NULL;
+    ps->max = max;
+    ps->flags = flags;
+    ps->threads = pool_cpus();
+
+    /* one block, room for whole groups of four in each array; the
+       arrays start a cache line apart modulo the page size, or all of
+       them would fight over the same cache sets */
+    n = arrays(ps, list);
+    stride = (max + 3) & ~3;
+    stride += (1024 + 16 - stride % 1024) % 1024;
+    ps->block = calloc((size_t)stride * n, sizeof(float));
+    if (ps->block == NULL) {
+	free(ps);
+	return NULL;
+    }
+    for(i = 0; i < n; i++)
+	*list[i] = ps->block + (size_t)stride * i;
+    return ps;
+}
+
+int
+ps_spawn(psys_t *ps) {
+    float **list[MAX_ARRAYS];
+    int i, n;
+
+    if (ps->count == ps->max)
+	return -1;
+    n = arrays(ps, list);
+    for(i = 0; i < n; i++)
+	(*list[i])[ps->count] = 0.f;
+    if (ps->flags & PS_AGE)
+	ps->life[ps->count] = 1.f;
+    return ps->count++;
+}
+
+void
+ps_kill(psys_t *ps, int i) {
+    float **list[MAX_ARRAYS];
+    int j, n, last = --ps->count;
+
+    if (i == last)
+	return;
+    n = arrays(ps, list);
+    for(j = 0; j < n; j++)
+	(*list[j])[i] = (*list[j])[last];
+}
+
+/* update particles [begin, end), both multiples of four */
+static void
+integrate(psys_t *ps, float dt, int begin, int end) {
+    float *x = ps->x, *y = ps->y, *z = ps->z;
+    float *vx = ps->vx, *vy = ps->vy, *vz = ps->vz;
+    float *ax = ps->ax, *ay = ps->ay, *az = ps->az;
+    float *col[4], *dcol[4];
+    float *size = ps->size, *dsize = ps->dsize, *age = ps->age;
+    int i, k, flags = ps->flags;
+#ifdef PS_SSE
+    __m128 t = _mm_set1_ps(dt), zero = _mm_setzero_ps();
+    __m128 fl = _mm_set1_ps(ps->floor);
+    __m128 px, py, pz, qx, qy, qz, c, d, m;
+#else
+    float floor = ps->floor, v, *p, *dp;
+#endif
+
+    col[0] = ps->r; col[1] = ps->g; col[2] = ps->b; col[3] = ps->a;
+    dcol[0] = ps->dr; dcol[1] = ps->dg; dcol[2] = ps->db; dcol[3] = ps->da;
+#ifdef PS_SSE
+    for(i = begin; i < end; i += 4) {
+	qx = _mm_loadu_ps(vx+i);
+	qy = _mm_loadu_ps(vy+i);
+	qz = _mm_loadu_ps(vz+i);
+	px = _mm_add_ps(_mm_loadu_ps(x+i), _mm_mul_ps(qx, t));
+	py = _mm_add_ps(_mm_loadu_ps(y+i), _mm_mul_ps(qy, t));
+	pz = _mm_add_ps(_mm_loadu_ps(z+i), _mm_mul_ps(qz, t));
+	if (flags & PS_ACCEL) {
+	    qx = _mm_add_ps(qx, _mm_mul_ps(_mm_loadu_ps(ax+i), t));
+	    qy = _mm_add_ps(qy, _mm_mul_ps(_mm_loadu_ps(ay+i), t));
+	    qz = _mm_add_ps(qz, _mm_mul_ps(_mm_loadu_ps(az+i), t));
+	}
+	if (flags & PS_FLOOR) {
+	    /* below the floor: put back on it and stop */
+	    m = _mm_cmplt_ps(py, fl);
+	    py = _mm_max_ps(py, fl);
+	    qx = _mm_andnot_ps(m, qx);
+	    qy = _mm_andnot_ps(m, qy);
+	    qz = _mm_andnot_ps(m, qz);
+	}
+	_mm_storeu_ps(x+i, px);
+	_mm_storeu_ps(y+i, py);
+	_mm_storeu_ps(z+i, pz);
+	_mm_storeu_ps(vx+i, qx);
+	_mm_storeu_ps(vy+i, qy);
+	_mm_storeu_ps(vz+i, qz);
+
+	if (flags & PS_COLOR) for(k = 0; k < 4; k++) {
+	    d = _mm_loadu_ps(dcol[k]+i);
+	    c = _mm_add_ps(_mm_loadu_ps(col[k]+i), _mm_mul_ps(d, t));
+	    if (flags & PS_COLOR_CLAMP) {
+		/* faded out: stay at 0 */
+		m = _mm_cmplt_ps(c, zero);
+		c = _mm_max_ps(c, zero);
+		_mm_storeu_ps(dcol[k]+i, _mm_andnot_ps(m, d));
+	    }
+	    _mm_storeu_ps(col[k]+i, c);
+	}
+	if (flags & PS_SIZE)
+	    _mm_storeu_ps(size+i, _mm_add_ps(_mm_loadu_ps(size+i),
+		_mm_mul_ps(_mm_loadu_ps(dsize+i), t)));
+	if (flags & PS_AGE)
+	    _mm_storeu_ps(age+i, _mm_add_ps(_mm_loadu_ps(age+i), t));
+    }
+#else
+    /* one array at a time, in the order of the SIMD path; the selects
+       compile without branches */
+    for(k = begin; k < end; k++) {
+	x[k] += vx[k]*dt;
+	y[k] += vy[k]*dt;
+	z[k] += vz[k]*dt;
+    }
+    if (flags & PS_ACCEL) for(k = begin; k < end; k++) {
+	vx[k] += ax[k]*dt;
+	vy[k] += ay[k]*dt;
+	vz[k] += az[k]*dt;
+    }
+    if (flags & PS_FLOOR) for(k = begin; k < end; k++) {
+	v = y[k] < floor ? 0.f : 1.f;
+	y[k] = y[k] < floor ? floor : y[k];
+	vx[k] *= v;
+	vy[k] *= v;
+	vz[k] *= v;
+    }
+    if (flags & PS_COLOR) for(i = 0; i < 4; i++) {
+	p = col[i];
+	dp = dcol[i];
+	for(k = begin; k < end; k++) {
+	    v = p[k] + dp[k]*dt;
+	    if (flags & PS_COLOR_CLAMP) {
+		dp[k] = v < 0.f ? 0.f : dp[k];
+		v = v < 0.f ? 0.f : v;
+	    }
+	    p[k] = v;
+	}
+    }
+    if (flags & PS_SIZE) for(k = begin; k < end; k++)
+	size[k] += dsize[k]*dt;
+    if (flags & PS_AGE) for(k = begin; k < end; k++)
+	age[k] += dt;
+#endif
+}
+
+/* one slice of an update, for the pool */
+typedef struct job {
+    psys_t *ps;
+    float dt;
+} job_t;
+
+static void
+integrate_job(void *arg, int begin, int end) {
+    job_t *job = arg;
+
+    integrate(job->ps, job->dt, begin, end);
+}
+
+void
+ps_update(psys_t *ps, float dt) {
+    int i, end = (ps->count + 3) & ~3;
+    int slices = ps->count / PS_THREAD_MIN;
+    job_t job;
+
+    if (slices > ps->threads) slices = ps->threads;
+    if (slices > 1 && ps->pool == NULL)
+	ps->pool = pool_new(ps->threads);
+    if (slices > pool_threads(ps->pool)) slices = pool_threads(ps->pool);
+    if (slices > 1) {
+	/* slices stay whole groups of four */
+	job.ps = ps;
+	job.dt = dt;
+	pool_run(ps->pool, integrate_job, &job, slices,
+	    (end / slices + 3) & ~3, end);
+    } else
+	integrate(ps, dt, 0, end);
+
+    if (ps->flags & PS_AGE) {
+	for(i = 0; i < ps->count; ) {
+	    if (ps->age[i] >= ps->life[i])
+		ps_kill(ps, i);		/* the last one moves here */
+	    else
+		i++;
+	}
+    }
+}
+
+void
+ps_threads(psys_t *ps, int threads) {
+    ps->threads = threads < 1 ? 1 : threads;
+    pool_delete(ps->pool);
+    ps->pool = NULL;
+}
+
+void
+ps_delete(psys_t *ps) {
+    pool_delete(ps->pool);
+    free(ps->block);
+    free(ps);
+}
@@ -0,0 +1,55 @@
+/*
+ * particle system shared by the natural phenomena demos
+ *
+ * Particles are kept as structure of arrays, live particles packed at the
+ * front: killing one moves the last live particle into its slot.  Only
+ * the arrays asked for by the flags are allocated.  ps_update integrates
+ * four particles at a time (SSE when available) without branches, and
+ * splits very large systems across threads.
+ */
+
+#ifndef PS_H
+#define PS_H
+
+/* which arrays to keep and how to update them */
+#define PS_ACCEL	0x01	/* ax, ay, az */
+#define PS_COLOR	0x02	/* r, g, b, a and their change dr, dg, db, da */
+#define PS_SIZE		0x04	/* size and its change dsize */
+#define PS_AGE		0x08	/* age and life, killed when age >= life */
+#define PS_FLOOR	0x10	/* stop particles that fall below floor */
+#define PS_COLOR_CLAMP	0x20	/* colors stop changing when they reach 0 */
+
+typedef struct psys {
+    int count;			/* live particles */
+    int max;			/* room in the arrays */
+    int flags;
+    float floor;		/* lowest y for PS_FLOOR */
+    float *x, *y, *z;		/* position */
+    float *vx, *vy, *vz;	/* velocity */
+    float *ax, *ay, *az;	/* acceleration */
+    float *r, *g, *b, *a;	/* color */
+    float *dr, *dg, *db, *da;	/* change in color */
+    float *size, *dsize;	/* billboard size or streak length */
+    float *age, *life;
+    int threads;		/* most threads to update with */
+    void *pool;			/* worker threads, made when first needed */
+    float *block;		/* all of the arrays */
+} psys_t;
+
+psys_t *ps_new(int max, int flags);
+void ps_delete(psys_t *ps);
+
+/* add a particle with every attribute 0 (life 1); returns its index, or
+   -1 when the system is full */
+int ps_spawn(psys_t *ps);
+void ps_kill(psys_t *ps, int i);
+
+/* move every particle on by dt: position by velocity, velocity by
+   acceleration, color, size and age by their rates, then apply the
+   floor and color clamps and kill particles past their life */
+void ps_update(psys_t *ps, float dt);
+
+/* number of threads for large systems, 1 to update inline */
+void ps_threads(psys_t *ps, int threads);
+
+#endif
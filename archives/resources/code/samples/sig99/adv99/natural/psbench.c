@@ -0,0 +1,207 @@
+/*
+ * Headless benchmark of the particle system library (ps.c).
+ *
+ * The particles of particle.c (fountain velocities, gravity, fading
+ * colors, a floor at y = -1) are updated with the demo's original
+ * array-of-structs loop and with ps_update, on one thread and on all of
+ * them.  Both must end up with the same particles.
+ *
+ * usage: psbench [max particles]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "ps.h"
+
+#ifdef _WIN32
+#include <windows.h>
+typedef int timer;
+#define getTime(a)	(a = GetTickCount())
+#define timeDiff(a, b)	((b - a) * 1000)
+#else
+#include <sys/time.h>
+#include <unistd.h>
+typedef struct timeval timer;
+#define getTime(a)	gettimeofday(&a, NULL)
+#define timeDiff(a, b)	(((b.tv_sec - a.tv_sec) * 1000000) + b.tv_usec - a.tv_usec)
+#endif
+
+#ifndef M_PI
+#define M_PI 3.14159265
+#endif
+
+#define frand() ((float)rand()/RAND_MAX)
+
+/* the particle of particle.c */
+typedef struct {
+    float pos[3];
+    float color[4];
+    float Dr, Dg, Db, Da;
+    float Vx, Vy, Vz;
+    float Ax, Ay, Az;
+} Particle;
+
+/* updatepart() from particle.c */
+static void
+updatepart(Particle parts[], int cnt) {
+    int i;
+    for(i = 0; i < cnt; i++) {
+	parts[i].pos[0] += parts[i].Vx;
+	parts[i].pos[1] += parts[i].Vy;
+	parts[i].pos[2] += parts[i].Vz;
+
+	parts[i].Vx += parts[i].Ax;
+	parts[i].Vy += parts[i].Ay;
+	parts[i].Vz += parts[i].Az;
+
+	parts[i].color[0] += parts[i].Dr;
+	parts[i].color[1] += parts[i].Dg;
+	parts[i].color[2] += parts[i].Db;
+	parts[i].color[3] += parts[i].Da;
+
+	if(parts[i].color[0] < 0.f) {
+	    parts[i].color[0] = 0.f;
+	    parts[i].Dr = 0.f;
+	}
+	if(parts[i].color[1] < 0.f) {
+	    parts[i].color[1] = 0.f;
+	    parts[i].Dg = 0.f;
+	}
+	if(parts[i].color[2] < 0.f) {
+	    parts[i].color[2] = 0.f;
+	    parts[i].Db = 0.f;
+	}
+	if(parts[i].color[3] < 0.f) {
+	    parts[i].color[3] = 0.f;
+	    parts[i].Da = 0.f;
+	}
+	if(parts[i].pos[1] < -1.f) {
+	    parts[i].pos[1] = -1.f;
+	    parts[i].Vx = 0.f;
+	    parts[i].Vy = 0.f;
+	    parts[i].Vz = 0.f;
+	}
+    }
+}
+
+/* the same starting particles for both */
+static void
+init(Particle *parts, psys_t *ps, int cnt) {
+    int i, j;
+    float r, theta, phi;
+
+    srand(1);
+    ps->count = 0;
+    for(i = 0; i < cnt; i++) {
+	phi = (.5f - frand()) * (float)M_PI;
+	theta = (.5f - frand()) * 2 * (float)M_PI;
+	r = frand()/10.f * (float)sin(phi);
+	parts[i].Vy = r * (float)cos(phi);
+	parts[i].Vx = r * (float)cos(theta) * (float)sin(phi);
+	parts[i].Vz = r * (float)sin(theta) * (float)sin(phi);
+	parts[i].pos[0] = 0.f;
+	parts[i].pos[1] = -1.f;
+	parts[i].pos[2] = 0.f;
+	parts[i].Ax = 0.f;
+	parts[i].Ay = -.001f;
+	parts[i].Az = 0.f;
+	for(j = 0; j < 4; j++)
+	    parts[i].color[j] = 1.f;
+	parts[i].Dr = (.5f - frand())/50.f;
+	parts[i].Dg = (.5f - frand())/50.f;
+	parts[i].Db = (.5f - frand())/50.f;
+	parts[i].Da = (.5f - frand())/50.f;
+
+	j = ps_spawn(ps);
+	ps->x[j] = parts[i].pos[0];
+	ps->y[j] = parts[i].pos[1];
+	ps->z[j] = parts[i].pos[2];
+	ps->vx[j] = parts[i].Vx;
+	ps->vy[j] = parts[i].Vy;
+	ps->vz[j] = parts[i].Vz;
+	ps->ay[j] = parts[i].Ay;
+	ps->r[j] = ps->g[j] = ps->b[j] = ps->a[j] = 1.f;
+	ps->dr[j] = parts[i].Dr;
+	ps->dg[j] = parts[i].Dg;
+	ps->db[j] = parts[i].Db;
+	ps->da[j] = parts[i].Da;
+    }
+}
+
+static int
+differ(Particle *parts, psys_t *ps) {
+    int i, n = 0;
+
+    for(i = 0; i < ps->count; i++)
+	if (parts[i].pos[0] != ps->x[i] || parts[i].pos[1] != ps->y[i] ||
+	    parts[i].pos[2] != ps->z[i] || parts[i].Vy != ps->vy[i] ||
+	    parts[i].color[0] != ps->r[i] || parts[i].color[3] != ps->a[i])
+	    n++;
+    return n;
+}
+
+static double
+rate(long usec, int cnt, int steps) {
+    return usec > 0 ? (double)cnt * steps / usec : 0.;
+}
+
+int
+main(int argc, char *argv[]) {
+    int max = 10000000, cnt, steps, s, threads = 1, bad;
+    Particle *parts;
+    psys_t *ps;
+    timer t0, t1;
+    long aos, soa, mt;
+
+    if (argc > 1) max = atoi(argv[1]);
+#ifndef _WIN32
+    threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+    printf("%d threads, millions of particle updates per second\n", threads);
+    printf("%10s %6s %10s %10s %10s %s\n",
+	   "particles", "steps", "AoS", "SoA", "threaded", "");
+    for(cnt = 10000; cnt <= max; cnt *= 10) {
+	parts = malloc(cnt * sizeof(Particle));
+	ps = ps_new(cnt, PS_ACCEL|PS_COLOR|PS_FLOOR|PS_COLOR_CLAMP);
+	if (parts == NULL || ps == NULL) {
+	    printf("out of memory at %d particles\n", cnt);
+	    break;
+	}
+	ps->floor = -1.f;
+	steps = 100000000 / cnt;
+	if (steps < 10) steps = 10;
+
+	init(parts, ps, cnt);
+	getTime(t0);
+	for(s = 0; s < steps; s++)
+	    updatepart(parts, cnt);
+	getTime(t1);
+	aos = timeDiff(t0, t1);
+
+	ps_threads(ps, 1);
+	getTime(t0);
+	for(s = 0; s < steps; s++)
+	    ps_update(ps, 1.f);
+	getTime(t1);
+	soa = timeDiff(t0, t1);
+	bad = differ(parts, ps);
+
+	init(parts, ps, cnt);
+	ps_threads(ps, threads);
+	getTime(t0);
+	for(s = 0; s < steps; s++)
+	    ps_update(ps, 1.f);
+	getTime(t1);
+	mt = timeDiff(t0, t1);
+
+	printf("%10d %6d %10.1f %10.1f %10.1f %s\n", cnt, steps,
+	       rate(aos, cnt, steps), rate(soa, cnt, steps),
+	       rate(mt, cnt, steps), bad ? "DIFFER" : "same");
+	free(parts);
+	ps_delete(ps);
+    }
+    return 0;
+}
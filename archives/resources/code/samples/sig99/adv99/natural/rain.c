@@ -10,6 +10,7 @@
 #include <stdio.h>
 #include <GL/glut.h>
 #include "../util/texture.h"
+#include "precip.h"
 
 #ifdef _WIN32
 /*
@@ -39,182 +40,38 @@ GLboolean blend = GL_FALSE;	/* rain blending */
 GLfloat snowsize = 1.f;
 
 /*
- * Particle System Code 
+ * Particle System Code; the rain falls on its own thread (see precip.h) 
  */
 
-typedef struct {
-    GLfloat start[3];
-    GLfloat end[3];
-    GLfloat Vx, Vy, Vz;
-} Particle;
-
-/*
- * particle system state 
- */
-typedef struct {
-    Particle *array;		/* array of particles */
-    int total;			/* total number of array elements */
-    int update;			/* number of updates per frame */
-    GLfloat Rx, Ry, Rz;		/* reset vector */
-    GLfloat Vx, Vy, Vz;		/* global velocity of particles */
-} PSystem;
-
-
-
-void (*updateptr) (PSystem * sys);
-
 #define PART_COUNT 1024
-PSystem psys;			/* particle system */
+precip_t *psys;			/* particle system */
 
 enum { R, G, B, A };
 enum { X, Y, Z, W };
 
 /*
- * initialize the particle data 
- */
-
-
-/*
- * begin, end xyz arrays; start and end points nframes number of frames to 
- * go from start to end total number of  particles 
- */
-void
-initpart(PSystem * sys, GLfloat * start, GLfloat * end, int nframes, int nparts)
-{
-    int i;
-    Particle *part;
-
-    sys->Rx = start[X] - end[X];
-    sys->Ry = start[Y] - end[Y];
-    sys->Rz = start[Z] - end[Z];
-
-    sys->Vx = -sys->Rx / nframes;
-    sys->Vy = -sys->Ry / nframes;
-    sys->Vz = -sys->Rz / nframes;
-
-    if (nparts < nframes)
-	printf("should have more particles than frames\n");
-
-    sys->update = nparts / nframes;	/* this should have no remainder */
-
-    sys->total = nparts;
-    sys->array = (Particle *) malloc(nparts * sizeof(Particle));
-
-    for (part = sys->array, i = 0; i < nparts; i++) {
-	/*
-	 * XXX this part should be more general 
-	 */
-	part->start[X] = part->end[X] = -50 + drand48() * 100.f;
-	part->start[Z] = part->end[Z] = drand48() * 90.f;
-
-	/*
-	 * jitter the starting points in y by fall distance per frame (Vy) 
-	 */
-	/* starting height */
-	part->start[Y] = part->end[Y] =
-	    start[Y] - sys->Vy + 2 * sys->Vy * drand48();
-	part->end[Y] -= drand48() * 1.5 * sys->Vy;	/* lines */
-
-	part->Vx = 0.f;
-	part->Vy = 0.f;		/* updatepart0 starts them moving */
-	part->Vz = 0.f;
-	part++;
-    }
-}
-
-
-
-/*
- * update the particle data 
- */
-void
-updatepart(PSystem * sys)
-{
-    int i;
-    static int offset = 0;
-    GLfloat displace;
-    int count;
-    Particle *part;
-
-    /*
-     * reset positions of a subset of particles 
-     */
-    count = sys->update;
-    displace = sys->Ry;
-    part = &sys->array[offset];
-    for (i = 0; i < count; i++) {
-	part->start[Y] += displace;
-	part->end[Y] += displace;
-	part++;
-    }
-
-    /*
-     * fast if sys->total a power of 2 
-     */
-    offset = (offset + count) % sys->total;
-}
-
-/*
- * update the particle data first time 
+ * display the particles from the newest simulation step 
  */
 void
-updatepart0(PSystem * sys)
+displaypart(precip_t * sys)
 {
-    int i;
-    Particle *part;
-    static int offset = 0;
-
-
-    /*
-     * reset positions of a subset of particles 
-     */
-    part = &sys->array[offset];
-    for (i = 0; i < sys->update; i++) {
-	part->Vy = sys->Vy;
-	part++;
-    }
-    offset += sys->update;
-
-    if (offset >= sys->total) {
-	updateptr = updatepart;
-	offset = 0;
-    }
-}
-
-
-/*
- * display particles and fast update 
- */
-void
-displaypart(PSystem * sys)
-{
-    int i,
-        total;
-    Particle *part;
+    const float *v;
+    int count,
+        stride;
 
     glDisable(GL_LIGHTING);
     glColor3f(.5f, .5f, .5f);
-    if (lines)
-	glBegin(GL_LINES);
-    else
-	glBegin(GL_POINTS);
-
-    part = sys->array;
-    total = sys->total;
-    for (i = 0; i < total; i++) {
-	glVertex3fv(part->start);
-	if (lines)
-	    glVertex3fv(part->end);
-
-	part->start[X] += part->Vx;
-	part->start[Y] += part->Vy;
-	part->start[Z] += part->Vz;
-	part->end[X] += part->Vx;
-	part->end[Y] += part->Vy;
-	part->end[Z] += part->Vz;
-	part++;
+    v = precip_lock(sys, &count, &stride);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    if (lines) {
+	glVertexPointer(3, GL_FLOAT, 0, v);
+	glDrawArrays(GL_LINES, 0, 2 * count);
+    } else {
+	glVertexPointer(3, GL_FLOAT, stride * sizeof(float), v);
+	glDrawArrays(GL_POINTS, 0, count);
     }
-    glEnd();
+    glDisableClientState(GL_VERTEX_ARRAY);
+    precip_unlock(sys);
     glEnable(GL_LIGHTING);
 }
 
@@ -402,10 +259,9 @@ draw(void)
     if (rain) {
 	if (blend)
 	    glEnable(GL_BLEND);
-	displaypart(&psys);
+	displaypart(psys);
 	if (blend)
 	    glDisable(GL_BLEND);
-	(*updateptr) (&psys);
     }
     CHECK_ERROR("draw()");
 }
@@ -438,6 +294,7 @@ key(unsigned char key, int x, int y)
     case 'p':
     case 'P':			/* toggle snow machine */
 	rain = !rain;
+	precip_run(psys, rain);
 	glutPostRedisplay();
 	break;
     case 'f':
@@ -762,8 +619,11 @@ main(int argc, char *argv[])
     glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_BLEND);
 
     free(cloud);
-    initpart(&psys, begin, end, 50, 6000);
-    updateptr = updatepart0;
+    psys = precip_new(begin, end, 50, 6000, PRECIP_JITTER | PRECIP_STREAKS);
+    if (psys == NULL) {
+	fprintf(stderr, "not enough memory for the rain\n");
+	exit(1);
+    }
 
     CHECK_ERROR("main()");
     glutMainLoop();
@@ -2,6 +2,8 @@
 #include <math.h>
 #include <GL/glut.h>
 #include "sm.h"
+#include "ps.h"
+#include "sprite.h"
 
 #if !defined(GL_VERSION_1_1) && !defined(GL_VERSION_1_2)
 #define glBindTexture	glBindTextureEXT
@@ -11,14 +13,6 @@
 #define drand48() ((float)rand()/RAND_MAX)
 #endif
 
-typedef struct elem {
-    float x, y, z;	/* current position */
-    float dx, dy, dz;	/* displacement */
-    float size;		/* scale factor */
-    float ts;		/* time stamp */
-    float opacity;	/* alpha value */
-} elem_t;
-
 typedef struct smoke {
     float ox, oy, oz;	/* origin */
     float dx, dy, dz;	/* drift */
@@ -27,9 +21,38 @@ typedef struct smoke {
     float min_size;
     float max_size;
     unsigned texture;
-    elem_t *elem;
+    psys_t *elem;	/* a is the opacity, 1 less the time stamp */
+    sbatch_t *batch;	/* the elements' billboards */
 } smoke_t;
 
+/* put element i at the origin ts into its life, on its own drift */
+static void
+place_elem(smoke_t *s, int i, float ts) {
+    psys_t *ps = s->elem;
+
+    ps->x[i] = s->ox + ps->vx[i]*ts;
+    ps->y[i] = s->oy + ps->vy[i]*ts;
+    ps->z[i] = s->oz + ps->vz[i]*ts;
+    ps->size[i] = s->min_size + ts*s->max_size;
+    ps->dsize[i] = s->max_size;
+    ps->r[i] = ps->g[i] = ps->b[i] = s->intensity;
+    ps->a[i] = 1.f - ts;
+    ps->da[i] = -1.f;
+}
+
+/* a new element with a random drift, ts into its life */
+static void
+spawn_elem(smoke_t *s, float ts) {
+    psys_t *ps = s->elem;
+    int i = ps_spawn(ps);
+
+    if (i < 0) return;
+    ps->vx[i] = s->dx - drand48()*1.5f;
+    ps->vy[i] = s->dy + drand48()*1.5f;
+    ps->vz[i] = s->dz + drand48()*1.5f;
+    place_elem(s, i, ts);
+}
+
 void *
 new_smoke(float x, float y, float z, float dx, float dy, float dz,
 	int elems, float intensity, unsigned texture) {
@@ -41,28 +64,34 @@ new_smoke(float x, float y, float z, float dx, float dy, float dz,
     s->min_size = .1f;
     s->max_size = 1.0;
     s->elems = elems;
-    s->elem = malloc(sizeof(elem_t)*elems);
-    for(i = 0; i < elems; i++) {
-	s->elem[i].ts = (float)i/elems;;
-	s->elem[i].dx = -drand48()*1.5f;
-	s->elem[i].dy = drand48()*1.5f;
-	s->elem[i].dz = drand48()*1.5f;
-    }
     s->intensity = intensity;
     s->texture = texture;
+    s->elem = ps_new(elems, PS_COLOR|PS_SIZE);
+    s->batch = sb_new(elems);
+    if (s->elem == NULL || s->batch == NULL) {
+	if (s->elem) ps_delete(s->elem);
+	if (s->batch) sb_delete(s->batch);
+	free(s);
+	return NULL;
+    }
+    for(i = 0; i < elems; i++)
+	spawn_elem(s, (float)i/elems);
     return s;
 }
 
 void
 delete_smoke(void *smoke) {
     smoke_t *s = smoke;
-    free(s->elem);
+    ps_delete(s->elem);
+    sb_delete(s->batch);
     free(s);
 }
 
 void
 draw_smoke(void *smoke) {
     smoke_t *s = smoke;
+    psys_t *e = s->elem;
+    float right[3], up[3];
     int i;
 
     glEnable(GL_BLEND);
@@ -73,20 +102,13 @@ draw_smoke(void *smoke) {
     glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 #endif
     glBindTexture(GL_TEXTURE_2D, s->texture);
-    for(i = 0; i < s->elems; i++) {
-	elem_t *e = s->elem+i;
-	glPushMatrix();
-	glTranslatef(e->x, e->y, e->z);
-	glScalef(e->size, e->size, 1.);
-	glColor4f(s->intensity,s->intensity,s->intensity,e->opacity);
-	glBegin(GL_QUADS);
-	glTexCoord2f(0, 0); glVertex3f(-1., -1., -0.);
-	glTexCoord2f(0, 1); glVertex3f(-1., 1.,  0.);
-	glTexCoord2f(1, 1); glVertex3f( 1., 1.,  0.);
-	glTexCoord2f(1, 0); glVertex3f( 1., -1., -0.);
-	glEnd();
-	glPopMatrix();
-    }
+    /* one blended batch, farthest puffs first */
+    sb_axes(right, up, SB_CYLINDER);
+    sb_begin(s->batch, right, up);
+    for(i = 0; i < e->count; i++)
+	sb_add(s->batch, e->x[i], e->y[i], e->z[i], e->size[i],
+	       e->r[i], e->g[i], e->b[i], e->a[i]);
+    sb_draw(s->batch, 1);
     glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
     glDisable(GL_TEXTURE_2D);
     glDepthMask(1);
@@ -98,14 +120,10 @@ update_smoke(void *smoke, float tick) {
     smoke_t *s = smoke;
     int i;
 
-    for(i = 0; i < s->elems; i++) {
-	elem_t *e = s->elem+i;
-	e->ts += tick;
-	if (e->ts > 1.0) e->ts = 0;
-	e->x = s->ox + s->dx*e->ts + e->dx*e->ts;
-	e->y = s->oy + s->dy*e->ts + e->dy*e->ts;
-	e->z = s->oz + s->dz*e->ts + e->dz*e->ts;
-	e->size = s->min_size + e->ts*s->max_size;
-	e->opacity = (1.0-e->ts);
-    }
+    /* elements that burn out start again at the origin, keeping their
+       drift */
+    ps_update(s->elem, tick);
+    for(i = 0; i < s->elem->count; i++)
+	if (s->elem->a[i] < 0.f)
+	    place_elem(s, i, 0.f);
 }
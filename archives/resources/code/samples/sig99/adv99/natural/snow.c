@@ -10,6 +10,7 @@
 #include <stdio.h>
 #include <GL/glut.h>
 #include "../util/texture.h"
+#include "precip.h"
 
 #ifdef _WIN32
 /* Win32 math.h doesn't define float versions of the trig functions. */
@@ -33,150 +34,29 @@ GLboolean snowaa = GL_FALSE; /* snow antialiasing */
 GLboolean blend = GL_FALSE; /* snow blending */
 GLfloat snowsize = 1.f;
 
-/* Particle System Code */
-
-typedef struct {
-    GLfloat pos[3];
-    GLfloat Vx, Vy, Vz;
-} Particle;
-
-/* particle system state */
-typedef struct {
-    Particle *array; /* array of particles */
-    int total; /* total number of array elements */
-    int update; /* number of updates per frame */
-    GLfloat Rx, Ry, Rz; /* reset vector */
-    GLfloat Vx, Vy, Vz; /* global velocity of particles */
-} PSystem;
-
-
-
-void (*updateptr)(PSystem *sys);
+/* Particle System Code; the snow falls on its own thread (see precip.h) */
 
 #define PART_COUNT 1024
-PSystem psys; /* particle system */
+precip_t *psys; /* particle system */
 
 enum {R, G, B, A};
 enum {X, Y, Z, W};
 
-/* initialize the particle data */
-
-
-/* begin, end xyz arrays; start and end points
-   nframes number of frames to go from start to end
-   total number of  particles
-*/
+/* display the particles from the newest simulation step */
 void
-initpart(PSystem *sys, GLfloat *start, GLfloat *end, int nframes, int nparts)
+displaypart(precip_t *sys)
 {
-    int i;
-    Particle *part;
-
-    sys->Rx = start[X] - end[X];
-    sys->Ry = start[Y] - end[Y];
-    sys->Rz = start[Z] - end[Z];
-
-    sys->Vx = -sys->Rx/nframes;
-    sys->Vy = -sys->Ry/nframes;
-    sys->Vz = -sys->Rz/nframes;
-
-    if(nparts < nframes)
-	printf("should have more particles than frames\n");
-
-    sys->update = nparts/nframes; /* this should have no remainder*/
-
-    sys->total = nparts;
-    sys->array = (Particle *)malloc(nparts * sizeof(Particle));
-
-    for(part = sys->array, i = 0; i < nparts; i++)
-    {
-	/* XXX this part should be more general */
-	part->pos[X] = -50 + drand48() * 100.f;
-	part->pos[Z] = drand48() * 90.f;
-
-	/* jitter the starting points in y by fall distance per frame (Vy) */
-	part->pos[Y] = start[Y]; /* starting height */
-
-	part->Vx = 0.f;
-	part->Vy = 0.f; /* updatepart0 starts them moving */
-	part->Vz = 0.f;
-	part++;
-    }
-}
-
-
-
-/* update the particle data */
-void
-updatepart(PSystem *sys)
-{
-    int i;
-    static int offset = 0;
-    GLfloat displace;
-    int count;
-    Particle *part;
-
-    /* reset positions of a subset of particles */
-    count = sys->update;
-    displace = sys->Ry;
-    part = &sys->array[offset];
-    for(i = 0; i < count; i++)
-    {
-	part->pos[Y] += displace;
-	part++;
-    }
-
-    /* fast if sys->total a power of 2 */
-    offset = (offset + count) % sys->total;
-}
-
-/* update the particle data first time */
-void
-updatepart0(PSystem *sys)
-{
-    int i;
-    Particle *part;
-    static int offset = 0;
-
-
-    /* reset positions of a subset of particles */
-    part = &sys->array[offset];
-    for(i = 0; i < sys->update; i++)
-    {
-	part->Vy = sys->Vy;
-	part++;
-    }
-    offset += sys->update;
-
-    if(offset >= sys->total)
-    {
-	updateptr = updatepart;
-	offset = 0;
-    }
-}
-
-
-/* display particles and fast update */
-void
-displaypart(PSystem *sys)
-{
-    int i, total;
-    Particle *part;
+    const float *v;
+    int count, stride;
 
     glDisable(GL_LIGHTING);
     glColor3f(1.f, 1.f, 1.f);
-    glBegin(GL_POINTS);
-    part = sys->array;
-    total = sys->total;
-    for(i = 0; i < total; i++)
-    {
-	glVertex3fv(part->pos);
-	part->pos[X] += part->Vx;
-	part->pos[Y] += part->Vy;
-	part->pos[Z] += part->Vz;
-	part++;
-    }
-    glEnd();
+    v = precip_lock(sys, &count, &stride);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glVertexPointer(3, GL_FLOAT, stride * sizeof(float), v);
+    glDrawArrays(GL_POINTS, 0, count);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    precip_unlock(sys);
     glEnable(GL_LIGHTING);
 }
 
@@ -352,10 +232,9 @@ draw(void)
     {
 	if(blend)
 	    glEnable(GL_BLEND);
-	displaypart(&psys);
+	displaypart(psys);
 	if(blend)
 	    glDisable(GL_BLEND);
-	(*updateptr)(&psys);
     }
     CHECK_ERROR("draw()");
 }
@@ -387,6 +266,7 @@ key(unsigned char key, int x, int y)
     case 's':
     case 'S': /* toggle snow machine */
 	snow = !snow;
+	precip_run(psys, snow);
 	glutPostRedisplay();
 	break;
     case 'f':
@@ -671,8 +551,12 @@ main(int argc, char *argv[])
     glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_BLEND);
 
     free(cloud);
-    initpart(&psys, begin, end, 200, 6000);
-    updateptr = updatepart0;
+    psys = precip_new(begin, end, 200, 6000, 0);
+    if(psys == NULL)
+    {
+	fprintf(stderr, "not enough memory for the snow\n");
+	exit(1);
+    }
 
     CHECK_ERROR("main()");
     glutMainLoop();
@@ -0,0 +1,274 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <GL/gl.h>
+#include "sprite.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265
+#endif
+
+/* a sprite as added: center, quad half axes as multiples of right and up */
+typedef struct {
+    float x, y, z;
+    float c, s;		/* size * cos(angle), size * sin(angle) */
+    unsigned char color[4];
+} sprite_t;
+
+/* laid out for GL_T2F_C4UB_V3F */
+typedef struct {
+    float s, t;
+    unsigned char color[4];
+    float x, y, z;
+} vert_t;
+
+struct sbatch {
+    int count, max;
+    float right[3], up[3];
+    sprite_t *sprite;
+    unsigned *key, *tkey;	/* sort keys and scratch */
+    int *order, *torder;	/* sprite indices and scratch */
+    vert_t *vert;		/* four per sprite */
+};
+
+#define RADIX_BITS 11
+#define RADIX (1 << RADIX_BITS)
+
+static void
+free_arrays(sbatch_t *sb) {
+    free(sb->sprite);
+    free(sb->key);
+    free(sb->tkey);
+    free(sb->order);
+    free(sb->torder);
+    free(sb->vert);
+}
+
+/* make room for max sprites, keeping the ones added so far */
+static int
+grow(sbatch_t *sb, int max) {
+    sbatch_t n = *sb;
+
+    n.sprite = malloc(max*sizeof(sprite_t));
+    n.key = malloc(max*sizeof(unsigned));
+    n.tkey = malloc(max*sizeof(unsigned));
+    n.order = malloc(max*sizeof(int));
+    n.torder = malloc(max*sizeof(int));
+    n.vert = malloc(4*max*sizeof(vert_t));
+    if (!n.sprite || !n.key || !n.tkey || !n.order || !n.torder || !n.vert) {
+	free_arrays(&n);
+	return 0;
+    }
+    if (sb->count)
+	memcpy(n.sprite, sb->sprite, sb->count*sizeof(sprite_t));
+    free_arrays(sb);
+    n.max = max;
+    *sb = n;
+    return 1;
+}
+
+sbatch_t *
+sb_new(int max) {
+    sbatch_t *sb = calloc(1, sizeof(sbatch_t));
+
+    if (sb == NULL)
+	return NULL;
+    if (max < 1) max = 1;
+    if (!grow(sb, max)) {
+	free(sb);
+	return NULL;
+    }
+    sb->right[0] = 1.f;
+    sb->up[1] = 1.f;
+    return sb;
+}
+
+void
+sb_delete(sbatch_t *sb) {
+    free_arrays(sb);
+    free(sb);
+}
+
+int
+sb_count(sbatch_t *sb) {
+    return sb->count;
+}
+
+static void
+normalize(float v[3]) {
+    float d = (float)sqrt(v[0]*v[0] + v[1]*v[1] + v[2]*v[2]);
+
+    if (d > 0.f) {
+	v[0] /= d; v[1] /= d; v[2] /= d;
+    }
+}
+
+void
+sb_axes(float right[3], float up[3], int mode) {
+    float m[16];
+
+    /* the eye's x and y axes are the first two rows of the modelview */
+    glGetFloatv(GL_MODELVIEW_MATRIX, m);
+    right[0] = m[0]; right[1] = m[4]; right[2] = m[8];
+    up[0] = m[1]; up[1] = m[5]; up[2] = m[9];
+    if (mode == SB_CYLINDER) {
+	right[1] = 0.f;
+	up[0] = up[2] = 0.f;
+	up[1] = 1.f;
+    }
+    normalize(right);
+    normalize(up);
+}
+
+void
+sb_begin(sbatch_t *sb, const float right[3], const float up[3]) {
+    int i;
+
+    for(i = 0; i < 3; i++) {
+	sb->right[i] = right[i];
+	sb->up[i] = up[i];
+    }
+    sb->count = 0;
+}
+
+static unsigned char
+ubyte(float c) {
+    return c <= 0.f ? 0 : c >= 1.f ? 255 : (unsigned char)(c*255.f + .5f);
+}
+
+static sprite_t *
+add(sbatch_t *sb, float x, float y, float z, float r, float g, float b, float a) {
+    sprite_t *s;
+
+    if (sb->count == sb->max && !grow(sb, 2*sb->max))
+	return NULL;
+    s = sb->sprite + sb->count++;
+    s->x = x; s->y = y; s->z = z;
+    s->color[0] = ubyte(r);
+    s->color[1] = ubyte(g);
+    s->color[2] = ubyte(b);
+    s->color[3] = ubyte(a);
+    return s;
+}
+
+void
+sb_add(sbatch_t *sb, float x, float y, float z, float size,
+	float r, float g, float b, float a) {
+    sprite_t *s = add(sb, x, y, z, r, g, b, a);
+
+    if (s != NULL) {
+	s->c = size;
+	s->s = 0.f;
+    }
+}
+
+void
+sb_add_rot(sbatch_t *sb, float x, float y, float z, float size,
+	float angle, float r, float g, float b, float a) {
+    sprite_t *s = add(sb, x, y, z, r, g, b, a);
+
+    if (s != NULL) {
+	angle *= (float)(M_PI/180.);
+	s->c = size*(float)cos(angle);
+	s->s = size*(float)sin(angle);
+    }
+}
+
+/* float bits that sort as unsigned in the order of the floats */
+static unsigned
+float_key(float f) {
+    unsigned u;
+
+    memcpy(&u, &f, sizeof u);
+    return u & 0x80000000u ? ~u : u | 0x80000000u;
+}
+
+/* sort sb->order by sb->key, least significant digit first; returns the
+   sorted indices, which may be in either order array */
+static int *
+radix_sort(sbatch_t *sb) {
+    static unsigned count[3][RADIX];
+    unsigned *key = sb->key, *tkey = sb->tkey, *t;
+    int *order = sb->order, *torder = sb->torder, *o;
+    int i, p, n = sb->count, shift;
+    unsigned sum, c;
+
+    memset(count, 0, sizeof count);
+    for(i = 0; i < n; i++) {
+	count[0][key[i] & (RADIX-1)]++;
+	count[1][(key[i] >> RADIX_BITS) & (RADIX-1)]++;
+	count[2][key[i] >> 2*RADIX_BITS]++;
+    }
+    for(p = 0; p < 3; p++) {
+	shift = p*RADIX_BITS;
+	/* nothing to do when every key has the same digit */
+	if (count[p][(key[0] >> shift) & (RADIX-1)] == (unsigned)n)
+	    continue;
+	for(sum = 0, i = 0; i < RADIX; i++) {
+	    c = count[p][i];
+	    count[p][i] = sum;
+	    sum += c;
+	}
+	for(i = 0; i < n; i++) {
+	    c = count[p][(key[i] >> shift) & (RADIX-1)]++;
+	    tkey[c] = key[i];
+	    torder[c] = order[i];
+	}
+	t = key; key = tkey; tkey = t;
+	o = order; order = torder; torder = o;
+    }
+    return order;
+}
+
+void
+sb_draw(sbatch_t *sb, int sort) {
+    float m[16], rx, ry, rz, ux, uy, uz;
+    const float *R = sb->right, *U = sb->up;
+    int i, n = sb->count, *order = sb->order;
+    sprite_t *s;
+    vert_t *v;
+
+    if (n == 0)
+	return;
+    for(i = 0; i < n; i++)
+	sb->order[i] = i;
+    if (sort) {
+	/* eye space z grows toward the eye, so ascending is back to front */
+	glGetFloatv(GL_MODELVIEW_MATRIX, m);
+	for(i = 0; i < n; i++) {
+	    s = sb->sprite + i;
+	    sb->key[i] = float_key(m[2]*s->x + m[6]*s->y + m[10]*s->z);
+	}
+	order = radix_sort(sb);
+    }
+
+    for(v = sb->vert, i = 0; i < n; i++, v += 4) {
+	s = sb->sprite + order[i];
+	/* the quad's half axes, turned in the right/up plane */
+	rx = s->c*R[0] + s->s*U[0];
+	ry = s->c*R[1] + s->s*U[1];
+	rz = s->c*R[2] + s->s*U[2];
+	ux = s->c*U[0] - s->s*R[0];
+	uy = s->c*U[1] - s->s*R[1];
+	uz = s->c*U[2] - s->s*R[2];
+
+	v[0].s = 0.f; v[0].t = 0.f;
+	v[0].x = s->x - rx - ux; v[0].y = s->y - ry - uy; v[0].z = s->z - rz - uz;
+	v[1].s = 1.f; v[1].t = 0.f;
+	v[1].x = s->x + rx - ux; v[1].y = s->y + ry - uy; v[1].z = s->z + rz - uz;
+	v[2].s = 1.f; v[2].t = 1.f;
+	v[2].x = s->x + rx + ux; v[2].y = s->y + ry + uy; v[2].z = s->z + rz + uz;
+	v[3].s = 0.f; v[3].t = 1.f;
+	v[3].x = s->x - rx + ux; v[3].y = s->y - ry + uy; v[3].z = s->z - rz + uz;
+	memcpy(v[0].color, s->color, 4);
+	memcpy(v[1].color, s->color, 4);
+	memcpy(v[2].color, s->color, 4);
+	memcpy(v[3].color, s->color, 4);
+    }
+
+    glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+    glInterleavedArrays(GL_T2F_C4UB_V3F, 0, sb->vert);
+    glDrawArrays(GL_QUADS, 0, 4*n);
+    glPopClientAttrib();
+    sb->count = 0;
+}
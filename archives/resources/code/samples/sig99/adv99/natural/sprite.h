@@ -0,0 +1,43 @@
+/*
+ * batched billboard sprites
+ *
+ * Sprites are collected between sb_begin and sb_draw, then expanded into
+ * camera facing quads on the CPU and drawn from one interleaved vertex
+ * array (GL_T2F_C4UB_V3F) with a single glDrawArrays.  When the sprites
+ * are blended they can be sorted back to front first; a radix sort on
+ * the eye space depth keeps that linear in the number of sprites.
+ *
+ * A batch does not change any GL state besides the client arrays, so
+ * keep one batch per texture and blend state and set those up before
+ * drawing it.  Positions are in the coordinates of the current modelview
+ * matrix.
+ */
+
+/* sb_axes modes */
+#define SB_SPHERE	0	/* face the eye */
+#define SB_CYLINDER	1	/* turn about y only, like calcMatrix() */
+
+typedef struct sbatch sbatch_t;
+
+sbatch_t *sb_new(int max);
+void sb_delete(sbatch_t *sb);
+
+/* billboard axes for the current modelview matrix */
+void sb_axes(float right[3], float up[3], int mode);
+
+/* start collecting sprites whose quads span right and up */
+void sb_begin(sbatch_t *sb, const float right[3], const float up[3]);
+
+/* a quad from center - size * (right + up) to center + size * (right +
+   up), textured (0,0) to (1,1); sb_add_rot turns it angle degrees
+   counterclockwise first, like glRotatef(angle, 0, 0, 1) */
+void sb_add(sbatch_t *sb, float x, float y, float z, float size,
+	float r, float g, float b, float a);
+void sb_add_rot(sbatch_t *sb, float x, float y, float z, float size,
+	float angle, float r, float g, float b, float a);
+
+/* draw the sprites added since sb_begin, farthest first when sort is
+   set, and empty the batch; the current color is undefined afterwards */
+void sb_draw(sbatch_t *sb, int sort);
+
+int sb_count(sbatch_t *sb);
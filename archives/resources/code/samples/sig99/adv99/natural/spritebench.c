@@ -0,0 +1,192 @@
+/*
+ * Benchmark of the sprite batcher (sprite.c).
+ *
+ * A cloud of blended, textured billboards is drawn the way draw_smoke()
+ * used to (push, translate, scale and a GL_QUADS begin/end per sprite)
+ * and through one sprite batch, unsorted and sorted back to front.
+ * Each is drawn for a number of frames, finished with glFinish, and the
+ * sprites per second printed.  Run it with a software renderer (e.g.
+ * LIBGL_ALWAYS_SOFTWARE=1 with Mesa) to measure the CPU side.
+ *
+ * usage: spritebench [max sprites [frames]]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <GL/glut.h>
+#include "sprite.h"
+
+#ifdef _WIN32
+#include <windows.h>
+typedef int timer;
+#define getTime(a)	(a = GetTickCount())
+#define timeDiff(a, b)	((b - a) * 1000)
+#else
+#include <sys/time.h>
+typedef struct timeval timer;
+#define getTime(a)	gettimeofday(&a, NULL)
+#define timeDiff(a, b)	(((b.tv_sec - a.tv_sec) * 1000000) + b.tv_usec - a.tv_usec)
+#endif
+
+#define frand() ((float)rand()/RAND_MAX)
+
+#define SIZE 256		/* window size */
+
+static int max = 100000, frames = 10;
+static float *pos, *size, *alpha;
+
+/* a round puff to draw with */
+static void
+texture(void) {
+    static unsigned char image[64][64][2];
+    int i, j;
+    float dx, dy, d;
+
+    for(i = 0; i < 64; i++)
+	for(j = 0; j < 64; j++) {
+	    dx = (j - 31.5f)/32.f;
+	    dy = (i - 31.5f)/32.f;
+	    d = 1.f - (dx*dx + dy*dy);
+	    image[i][j][0] = 255;
+	    image[i][j][1] = d > 0.f ? (unsigned char)(d*255.f) : 0;
+	}
+    glBindTexture(GL_TEXTURE_2D, 1);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE_ALPHA, 64, 64, 0,
+		 GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, image);
+    glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+}
+
+static void
+init(void) {
+    int i;
+
+    pos = malloc(3*max*sizeof(float));
+    size = malloc(max*sizeof(float));
+    alpha = malloc(max*sizeof(float));
+    if (pos == NULL || size == NULL || alpha == NULL) {
+	fprintf(stderr, "not enough memory for %d sprites\n", max);
+	exit(1);
+    }
+    srand(1);
+    for(i = 0; i < max; i++) {
+	pos[3*i+0] = 4.f*frand() - 2.f;
+	pos[3*i+1] = 4.f*frand() - 2.f;
+	pos[3*i+2] = 4.f*frand() - 2.f;
+	/* small, so the fill rate doesn't hide the per sprite cost */
+	size[i] = .005f + .01f*frand();
+	alpha[i] = frand();
+    }
+
+    texture();
+    glEnable(GL_TEXTURE_2D);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glEnable(GL_DEPTH_TEST);
+    glDepthMask(0);
+
+    glMatrixMode(GL_PROJECTION);
+    gluPerspective(50., 1., .1, 20.);
+    glMatrixMode(GL_MODELVIEW);
+    gluLookAt(0., 1., 5.5, 0., 0., 0., 0., 1., 0.);
+}
+
+/* draw_smoke() before the sprite batcher */
+static void
+immediate(int n) {
+    int i;
+
+    for(i = 0; i < n; i++) {
+	glPushMatrix();
+	glTranslatef(pos[3*i], pos[3*i+1], pos[3*i+2]);
+	glScalef(size[i], size[i], 1.);
+	glColor4f(.4f, .4f, .4f, alpha[i]);
+	glBegin(GL_QUADS);
+	glTexCoord2f(0, 0); glVertex3f(-1., -1., -0.);
+	glTexCoord2f(0, 1); glVertex3f(-1., 1.,  0.);
+	glTexCoord2f(1, 1); glVertex3f( 1., 1.,  0.);
+	glTexCoord2f(1, 0); glVertex3f( 1., -1., -0.);
+	glEnd();
+	glPopMatrix();
+    }
+}
+
+static void
+batched(sbatch_t *sb, int n, int sort) {
+    float right[3], up[3];
+    int i;
+
+    sb_axes(right, up, SB_SPHERE);
+    sb_begin(sb, right, up);
+    for(i = 0; i < n; i++)
+	sb_add(sb, pos[3*i], pos[3*i+1], pos[3*i+2], size[i],
+	       .4f, .4f, .4f, alpha[i]);
+    sb_draw(sb, sort);
+}
+
+/* sprites per second drawing n sprites with method m */
+static double
+run(sbatch_t *sb, int n, int m) {
+    timer t0, t1;
+    long usec;
+    int f;
+
+    /* one untimed frame, for the renderer to set up its state */
+    glClear(GL_COLOR_BUFFER_BIT|GL_DEPTH_BUFFER_BIT);
+    if (m == 0)
+	immediate(n);
+    else
+	batched(sb, n, m == 2);
+    glFinish();
+    getTime(t0);
+    for(f = 0; f < frames; f++) {
+	glClear(GL_COLOR_BUFFER_BIT|GL_DEPTH_BUFFER_BIT);
+	if (m == 0)
+	    immediate(n);
+	else
+	    batched(sb, n, m == 2);
+    }
+    glFinish();
+    getTime(t1);
+    usec = timeDiff(t0, t1);
+    return usec > 0 ? (double)n*frames/usec : 0.;
+}
+
+static void
+bench(void) {
+    sbatch_t *sb = sb_new(max);
+    int n;
+
+    if (sb == NULL) {
+	fprintf(stderr, "not enough memory for %d sprites\n", max);
+	exit(1);
+    }
+    printf("%s\n", (char *)glGetString(GL_RENDERER));
+    printf("%d frames, millions of sprites per second\n", frames);
+    printf("%10s %10s %10s %10s\n", "sprites", "immediate", "batched", "sorted");
+    for(n = 1000; n <= max; n *= 10)
+	printf("%10d %10.2f %10.2f %10.2f\n", n, run(sb, n, 0),
+	       run(sb, n, 1), run(sb, n, 2));
+    sb_delete(sb);
+}
+
+static void
+display(void) {
+    bench();
+    exit(0);
+}
+
+int
+main(int argc, char *argv[]) {
+    glutInit(&argc, argv);
+    if (argc > 1) max = atoi(argv[1]);
+    if (argc > 2) frames = atoi(argv[2]);
+    glutInitWindowSize(SIZE, SIZE);
+    glutInitDisplayMode(GLUT_RGBA|GLUT_DEPTH|GLUT_SINGLE);
+    (void)glutCreateWindow("spritebench");
+    init();
+    glutDisplayFunc(display);
+    glutMainLoop();
+    return 0;
+}
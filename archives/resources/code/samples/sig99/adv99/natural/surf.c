@@ -0,0 +1,253 @@
+#include <stdlib.h>
+#include <math.h>
+#include <GL/glut.h>
+#include "surf.h"
+#include "pool.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265
+#endif
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define SURF_SSE
+#include <xmmintrin.h>
+#endif
+
+/* fewest vertices worth handing to another thread */
+#define SURF_THREAD_MIN 65536
+
+#define STRIDE 8		/* floats per vertex: s t nx ny nz x y z */
+
+typedef struct wave {
+    float amplitude, ks, kt, phase;
+} wave_t;
+
+struct surf {
+    int n;
+    int waves;
+    wave_t wave[SURF_MAX_WAVES];
+    float *v;			/* n*n vertices, GL_T2F_N3F_V3F */
+    GLuint *index;		/* one row's strip, 2*n */
+    int threads;
+    pool_t *pool;
+};
+
+surf_t *
+surf_new(int n) {
+    surf_t *s;
+    float *v;
+    int i, j;
+
+    if (n < 2)
+	return NULL;
+    s = calloc(1, sizeof(surf_t));
+    if (s == NULL)
+	return NULL;
+    s->n = n;
+    s->v = malloc((size_t)n*n*STRIDE*sizeof(float));
+    s->index = malloc(2*n*sizeof(GLuint));
+    if (s->v == NULL || s->index == NULL) {
+	free(s->v);
+	free(s->index);
+	free(s);
+	return NULL;
+    }
+    s->threads = pool_cpus();
+
+    /* everything but the heights and normals stays put */
+    for(i = 0, v = s->v; i < n; i++)
+	for(j = 0; j < n; j++, v += STRIDE) {
+	    v[0] = (float)j/(n-1);
+	    v[1] = (float)i/(n-1);
+	    v[2] = v[4] = 0.f;
+	    v[3] = 1.f;
+	    v[5] = -1.f + 2.f*v[0];
+	    v[6] = 0.f;
+	    v[7] = -1.f + 2.f*v[1];
+	}
+    /* rows i and i+1, drawn with the arrays starting at row i */
+    for(j = 0; j < n; j++) {
+	s->index[2*j] = j;
+	s->index[2*j+1] = n + j;
+    }
+    return s;
+}
+
+int
+surf_wave(surf_t *s, float amplitude, float ks, float kt, float phase) {
+    if (s->waves == SURF_MAX_WAVES)
+	return -1;
+    surf_set_wave(s, s->waves, amplitude, ks, kt, phase);
+    return s->waves++;
+}
+
+void
+surf_set_wave(surf_t *s, int i, float amplitude, float ks, float kt,
+	float phase) {
+    s->wave[i].amplitude = amplitude;
+    s->wave[i].ks = ks;
+    s->wave[i].kt = kt;
+    s->wave[i].phase = phase;
+}
+
+/* heights and normals of rows [begin, end).  Along a row a wave's phase
+   goes up by the same step at every vertex, so its sine and cosine are
+   carried from one vertex to the next by rotating through that step;
+   each row starts from sinf and cosf again, so the error of the
+   rotations never builds up over more than a row. */
+static void
+evaluate(surf_t *s, int begin, int end) {
+    int n = s->n, nw = s->waves, i, j, w;
+    float d = 1.f/(n-1), *v;
+    float gs[SURF_MAX_WAVES], gt[SURF_MAX_WAVES], step[SURF_MAX_WAVES];
+#ifdef SURF_SSE
+    __m128 sn[SURF_MAX_WAVES], cs[SURF_MAX_WAVES];
+    __m128 c4[SURF_MAX_WAVES], s4[SURF_MAX_WAVES];
+    __m128 h, gx, gz, r, m, one = _mm_set1_ps(1.f);
+    __m128 half = _mm_set1_ps(.5f), three = _mm_set1_ps(3.f);
+    float hh[4], nx[4], ny[4], nz[4];
+    int k, l;
+#else
+    float cd[SURF_MAX_WAVES], sd[SURF_MAX_WAVES];
+    float sn[SURF_MAX_WAVES], cs[SURF_MAX_WAVES], t0;
+    float h, gx, gz, r;
+#endif
+
+    for(w = 0; w < nw; w++) {
+	wave_t *p = &s->wave[w];
+
+	/* slopes in x and z, which go from -1 to 1 as s and t go 0 to 1 */
+	gs[w] = p->amplitude * (float)M_PI * p->ks;
+	gt[w] = p->amplitude * (float)M_PI * p->kt;
+	step[w] = 2.f*(float)M_PI*p->ks*d;
+#ifdef SURF_SSE
+	c4[w] = _mm_set1_ps(cosf(4.f*step[w]));
+	s4[w] = _mm_set1_ps(sinf(4.f*step[w]));
+#else
+	cd[w] = cosf(step[w]);
+	sd[w] = sinf(step[w]);
+#endif
+    }
+
+    for(i = begin; i < end; i++) {
+	v = s->v + (size_t)i*n*STRIDE;
+	for(w = 0; w < nw; w++) {
+	    float t = 2.f*(float)M_PI*s->wave[w].kt*i*d + s->wave[w].phase;
+#ifdef SURF_SSE
+	    float a = step[w];
+
+	    sn[w] = _mm_setr_ps(sinf(t), sinf(t+a), sinf(t+2*a), sinf(t+3*a));
+	    cs[w] = _mm_setr_ps(cosf(t), cosf(t+a), cosf(t+2*a), cosf(t+3*a));
+#else
+	    sn[w] = sinf(t);
+	    cs[w] = cosf(t);
+#endif
+	}
+#ifdef SURF_SSE
+	for(j = 0; j < n; j += 4) {
+	    h = gx = gz = _mm_setzero_ps();
+	    for(w = 0; w < nw; w++) {
+		h = _mm_add_ps(h, _mm_mul_ps(sn[w],
+		    _mm_set1_ps(s->wave[w].amplitude)));
+		gx = _mm_add_ps(gx, _mm_mul_ps(cs[w], _mm_set1_ps(gs[w])));
+		gz = _mm_add_ps(gz, _mm_mul_ps(cs[w], _mm_set1_ps(gt[w])));
+		m = sn[w];
+		sn[w] = _mm_add_ps(_mm_mul_ps(m, c4[w]),
+		    _mm_mul_ps(cs[w], s4[w]));
+		cs[w] = _mm_sub_ps(_mm_mul_ps(cs[w], c4[w]),
+		    _mm_mul_ps(m, s4[w]));
+	    }
+	    /* normal (-gx, 1, -gz) over its length, the reciprocal square
+	       root estimate refined by a Newton step */
+	    m = _mm_add_ps(one, _mm_add_ps(_mm_mul_ps(gx, gx),
+		_mm_mul_ps(gz, gz)));
+	    r = _mm_rsqrt_ps(m);
+	    r = _mm_mul_ps(_mm_mul_ps(half, r),
+		_mm_sub_ps(three, _mm_mul_ps(m, _mm_mul_ps(r, r))));
+	    _mm_storeu_ps(hh, h);
+	    _mm_storeu_ps(nx, _mm_sub_ps(_mm_setzero_ps(), _mm_mul_ps(gx, r)));
+	    _mm_storeu_ps(ny, r);
+	    _mm_storeu_ps(nz, _mm_sub_ps(_mm_setzero_ps(), _mm_mul_ps(gz, r)));
+	    l = n - j < 4 ? n - j : 4;
+	    for(k = 0; k < l; k++, v += STRIDE) {
+		v[2] = nx[k];
+		v[3] = ny[k];
+		v[4] = nz[k];
+		v[6] = hh[k];
+	    }
+	}
+#else
+	for(j = 0; j < n; j++, v += STRIDE) {
+	    h = gx = gz = 0.f;
+	    for(w = 0; w < nw; w++) {
+		h += s->wave[w].amplitude * sn[w];
+		gx += gs[w] * cs[w];
+		gz += gt[w] * cs[w];
+		t0 = sn[w];
+		sn[w] = t0*cd[w] + cs[w]*sd[w];
+		cs[w] = cs[w]*cd[w] - t0*sd[w];
+	    }
+	    r = 1.f/(float)sqrt(1.f + gx*gx + gz*gz);
+	    v[2] = -gx*r;
+	    v[3] = r;
+	    v[4] = -gz*r;
+	    v[6] = h;
+	}
+#endif
+    }
+}
+
+/* one slice of rows of an update, for the pool */
+static void
+evaluate_job(void *arg, int begin, int end) {
+    evaluate(arg, begin, end);
+}
+
+void
+surf_update(surf_t *s) {
+    int slices = s->n * s->n / SURF_THREAD_MIN;
+
+    if (slices > s->threads) slices = s->threads;
+    if (slices > 1 && s->pool == NULL)
+	s->pool = pool_new(s->threads);
+    if (slices > pool_threads(s->pool)) slices = pool_threads(s->pool);
+    if (slices > 1)
+	pool_run(s->pool, evaluate_job, s, slices,
+	    (s->n + slices - 1) / slices, s->n);
+    else
+	evaluate(s, 0, s->n);
+}
+
+void
+surf_draw(surf_t *s) {
+    int i, n = s->n;
+
+    /* one strip per row: the same indices each time, with the arrays
+       moved down a row, keep the index array 2*n long */
+    glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+    for(i = 0; i < n-1; i++) {
+	glInterleavedArrays(GL_T2F_N3F_V3F, 0, s->v + (size_t)i*n*STRIDE);
+	glDrawElements(GL_TRIANGLE_STRIP, 2*n, GL_UNSIGNED_INT, s->index);
+    }
+    glPopClientAttrib();
+}
+
+void
+surf_threads(surf_t *s, int threads) {
+    s->threads = threads < 1 ? 1 : threads;
+    pool_delete(s->pool);
+    s->pool = NULL;
+}
+
+int
+surf_size(surf_t *s) {
+    return s->n;
+}
+
+void
+surf_delete(surf_t *s) {
+    pool_delete(s->pool);
+    free(s->v);
+    free(s->index);
+    free(s);
+}
@@ -0,0 +1,41 @@
+/*
+ * rippling water surface for water.c
+ *
+ * An n x n grid of vertices over [-1,1] in x and z, textured [0,1],
+ * whose heights are a sum of a few sine waves.  surf_update evaluates
+ * the heights and the normals in one pass over the grid: each wave's
+ * sine and cosine are stepped along a row by rotation rather than
+ * calling sinf and cosf, four vertices at a time (SSE when available),
+ * and large grids are split by rows across threads.  The vertices stay
+ * in one interleaved array (GL_T2F_N3F_V3F) that surf_draw draws as a
+ * triangle strip per row.
+ */
+
+#define SURF_MAX_WAVES	8
+
+typedef struct surf surf_t;
+
+/* an n x n grid (n at least 2) with no waves, flat at y = 0 */
+surf_t *surf_new(int n);
+void surf_delete(surf_t *s);
+
+/* add a wave, amplitude * sin(2 pi (ks * s + kt * t) + phase) at texture
+   coordinates (s, t); returns its index, or -1 when there are
+   SURF_MAX_WAVES already */
+int surf_wave(surf_t *s, float amplitude, float ks, float kt, float phase);
+
+/* change wave i */
+void surf_set_wave(surf_t *s, int i, float amplitude, float ks, float kt,
+	float phase);
+
+/* evaluate the heights and normals for the waves as they are now */
+void surf_update(surf_t *s);
+
+/* draw the grid from its vertex array; no other GL state is changed */
+void surf_draw(surf_t *s);
+
+/* most threads surf_update may use (the number of processors unless
+   set) */
+void surf_threads(surf_t *s, int threads);
+
+int surf_size(surf_t *s);
@@ -0,0 +1,167 @@
+/*
+ * Benchmark of the water surface (surf.c).
+ *
+ * For grids from 32x32 to the largest asked for, the waves of water.c
+ * are drawn the way draw_mesh() used to, with sinf for every vertex and
+ * a glBegin/glEnd strip per row, and with surf.c: the heights and
+ * normals updated on one thread and on as many as there are
+ * processors, and the vertex array drawn.  The milliseconds per frame
+ * of each are printed, each run for at least the given number of
+ * frames and a quarter of a second.  Run it with a software renderer
+ * (e.g. LIBGL_ALWAYS_SOFTWARE=1 with Mesa) to measure the CPU side.
+ *
+ * usage: surfbench [max grid [frames]]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <GL/glut.h>
+#include "surf.h"
+
+#ifdef _WIN32
+#include <windows.h>
+typedef int timer;
+#define getTime(a)	(a = GetTickCount())
+#define timeDiff(a, b)	((b - a) * 1000)
+#define sinf sin
+#define M_PI 3.14159265
+#else
+#include <sys/time.h>
+#include <unistd.h>
+typedef struct timeval timer;
+#define getTime(a)	gettimeofday(&a, NULL)
+#define timeDiff(a, b)	(((b.tv_sec - a.tv_sec) * 1000000) + b.tv_usec - a.tv_usec)
+#endif
+
+#define SIZE 256		/* window size */
+
+static int max = 2048, frames = 5;
+static float amplitude = 0.03f, freq = 5.0f, phase = .00003f;
+static int mesh;
+static float off;
+static surf_t *surf;
+
+/* draw_mesh() before surf.c, for any grid */
+static void
+immediate(void) {
+    int i, j;
+    float d = 1.f/mesh;
+
+    for(i = 0; i < mesh-1; i++) {
+	glBegin(GL_TRIANGLE_STRIP);
+	for(j = 0; j < mesh; j++) {
+	    float s = (float)j*d;
+	    float t = (float)i*d;
+	    float x = -1.0 + 2.f*s;
+	    float z = -1.0 + 2.f*t;
+	    float y = amplitude*sinf(freq*2.f*M_PI*t+off);
+	    glTexCoord2f(s, t); glVertex3f(x, y, z);
+	    t = (float)(i+1)*d;
+	    x = -1.0 + 2.f*s;
+	    z = -1.0 + 2.f*t;
+	    y = amplitude*sinf(freq*2.f*M_PI*t+off);
+	    glTexCoord2f(s, t); glVertex3f(x, y, z);
+	    off += phase;
+	}
+	glEnd();
+    }
+}
+
+static void
+update(void) {
+    off = fmod(off + phase*32*31, 2.*M_PI);
+    surf_set_wave(surf, 0, amplitude, 0.f, freq, off);
+    surf_update(surf);
+}
+
+static void
+draw(void) {
+    surf_draw(surf);
+}
+
+static void
+init(void) {
+    glEnable(GL_LIGHTING);
+    glEnable(GL_LIGHT0);
+    glEnable(GL_NORMALIZE);
+    glMatrixMode(GL_PROJECTION);
+    gluPerspective(50., 1., .1, 10.);
+    glMatrixMode(GL_MODELVIEW);
+    glTranslatef(0., 0., -3.);
+    glRotatef(30., 1., 0., 0.);
+}
+
+/* milliseconds per frame of f; gl is set when f draws */
+static double
+run(void (*f)(void), int gl) {
+    timer t0, t1;
+    long usec;
+    int n = 0;
+
+    if (gl) glClear(GL_COLOR_BUFFER_BIT);
+    f();			/* one untimed frame */
+    if (gl) glFinish();
+    getTime(t0);
+    do {
+	if (gl) glClear(GL_COLOR_BUFFER_BIT);
+	f();
+	if (gl) glFinish();
+	getTime(t1);
+	usec = timeDiff(t0, t1);
+    } while(++n < frames || usec < 250000);
+    return usec / 1000. / n;
+}
+
+static void
+bench(void) {
+    int threads = 1;
+
+#ifndef _WIN32
+    threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (threads < 1) threads = 1;
+#endif
+    printf("%s\n", (char *)glGetString(GL_RENDERER));
+    printf("ms per frame, %d processors\n", threads);
+    printf("%10s %10s %10s %10s %10s %10s\n", "grid", "immediate",
+	   "update", "threaded", "draw", "total");
+    for(mesh = 32; mesh <= max; mesh *= 2) {
+	double im, up1, upn, dr;
+
+	surf = surf_new(mesh);
+	if (surf == NULL) {
+	    fprintf(stderr, "not enough memory for a %dx%d grid\n", mesh, mesh);
+	    exit(1);
+	}
+	surf_wave(surf, amplitude, 0.f, freq, 0.f);
+	im = run(immediate, 1);
+	surf_threads(surf, 1);
+	up1 = run(update, 0);
+	surf_threads(surf, threads);
+	upn = run(update, 0);
+	dr = run(draw, 1);
+	printf("%10d %10.3f %10.3f %10.3f %10.3f %10.3f\n", mesh,
+	       im, up1, upn, dr, upn + dr);
+	surf_delete(surf);
+    }
+}
+
+static void
+display(void) {
+    bench();
+    exit(0);
+}
+
+int
+main(int argc, char *argv[]) {
+    glutInit(&argc, argv);
+    if (argc > 1) max = atoi(argv[1]);
+    if (argc > 2) frames = atoi(argv[2]);
+    glutInitWindowSize(SIZE, SIZE);
+    glutInitDisplayMode(GLUT_RGBA|GLUT_SINGLE);
+    (void)glutCreateWindow("surfbench");
+    init();
+    glutDisplayFunc(display);
+    glutMainLoop();
+    return 0;
+}
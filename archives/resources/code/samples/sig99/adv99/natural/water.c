@@ -3,6 +3,7 @@
 #include "math.h"
 #include "texture.h"
 #include "GL/glut.h"
+#include "surf.h"
 
 #ifdef WIN32
 /* Win32 math.h doesn't define float versions of the trig functions. */
@@ -10,6 +11,7 @@
 #define cosf cos
 #define atan2f atan2
 #define expf exp
+#define fmodf fmod
 
 /* nor does it define M_PI. */
 #define M_PI 3.14159265
@@ -27,6 +29,9 @@ static float phase = .00003f;
 static int ox = -1, oy = -1;
 static int show_t = 1;
 static int mot;
+static surf_t *surf;
+static int grid = 32;
+#define MAX_GRID 2048
 #define PAN	1
 #define ROT	2
 
@@ -89,6 +94,26 @@ void ffunc(void) { freq *= 2.f; }
 void Ffunc(void) { freq /= 2.f; }
 void mfunc(void) { mesh ^= 1; }
 
+void
+resize_grid(int n) {
+    surf_t *s;
+
+    if (n < 2 || n > MAX_GRID) return;
+    s = surf_new(n);
+    if (s == NULL) {
+	printf("not enough memory for a %dx%d grid\n", n, n);
+	return;
+    }
+    surf_wave(s, amplitude, 0.f, freq, 0.f);
+    if (surf) surf_delete(surf);
+    surf = s;
+    grid = n;
+    printf("%dx%d grid\n", n, n);
+}
+
+void gfunc(void) { resize_grid(grid*2); }
+void Gfunc(void) { resize_grid(grid/2); }
+
 void wire(void) {
     static int w;
     if (w ^= 1) {
@@ -134,6 +159,8 @@ void help(void) {
     printf("'f'            - increase frequency\n");
     printf("'F'            - decrease frequency\n");
     printf("'m'            - toggle mesh\n");
+    printf("'g'            - double the mesh grid\n");
+    printf("'G'            - halve the mesh grid\n");
     printf("'w'            - toggle wireframe\n");
     printf("'x'            - toggle water motion\n");
     printf("'UP'           - increase amplitude\n");
@@ -224,6 +251,12 @@ void init(char *filename) {
     glLineWidth(2.0f);
     glEnable(GL_LINE_SMOOTH);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    /* the mesh has normals for lighting, scaled by display() */
+    glEnable(GL_LIGHT0);
+    glEnable(GL_NORMALIZE);
+    resize_grid(grid);
+    if (surf == NULL) exit(EXIT_FAILURE);
 }
 
 void draw_mesh(void) {
@@ -235,29 +268,14 @@ void draw_mesh(void) {
 	glTexCoord2f(1, 0); glVertex3f( 1.f, 0.f, -1.f);
 	glEnd();
     } else {
-#define MESH 32
-	int i, j;
 	static float off;
-	float d = 1.f/MESH;
-	for(i = 0; i < MESH-1; i++) {
-	    glBegin(GL_TRIANGLE_STRIP);
-	    for(j = 0; j < MESH; j++) {
-		float s = (float)j*d;
-		float t = (float)i*d;
-		float x = -1.0 + 2.f*s;
-		float z = -1.0 + 2.f*t;
-		float y = amplitude*sinf(freq*2.f*M_PI*t+off);
-		glTexCoord2f(s, t); glVertex3f(x, y, z);
-		/*s += d; t += d; */
-		t = (float)(i+1)*d;
-		x = -1.0 + 2.f*s;
-		z = -1.0 + 2.f*t;
-		y = amplitude*sinf(freq*2.f*M_PI*t+off);
-		glTexCoord2f(s, t); glVertex3f(x, y, z);
-		off += phase;
-	    }
-	    glEnd();
-	}
+
+	/* the wave runs along t; the old 32x32 mesh moved it on by phase
+	   at every vertex it drew, whatever the grid is now */
+	off = fmodf(off + phase*32*31, 2.f*M_PI);
+	surf_set_wave(surf, 0, amplitude, 0.f, freq, off);
+	surf_update(surf);
+	surf_draw(surf);
     }
 }
 
@@ -298,6 +316,8 @@ key(unsigned char key, int x, int y) {
     case 'F': Ffunc(); break;
     case 't': toggle_t(); break;
     case 'm': mfunc(); break;
+    case 'g': gfunc(); break;
+    case 'G': Gfunc(); break;
     case 'w': wire(); break;
     case 'x': xfunc(); break;
     case 'h': help(); break;
@@ -10,6 +10,7 @@
 #define gettimeofday(a) gettimeofday(a, NULL)
 #endif
 #include "../util/texture.h"
+#include "sm_bake.h"
 
 #ifdef WIN32
 /* Win32 math.h doesn't define float versions of the trig functions. */
@@ -27,7 +28,7 @@ static char defaultFile[] = "../../data/mandrill.rgb";
 GLUquadricObj *cone, *base, *sphere;
 GLuint floorList;
 
-GLboolean animate = 1, useSphereMaps = 1;
+GLboolean animate = 1, useSphereMaps = 1, cpuBake = 1;
 
 GLsizei w = 512, h = 512;
 
@@ -44,6 +45,8 @@ int faceW = 128;
 GLuint *sphereMap[2];
 int sphereW = 256;
 
+SMbaker *baker;
+
 GLfloat angle1[6] = {90, 180, 270, 0, 90, -90};
 GLfloat axis1[6][3] =
 {
@@ -122,6 +125,32 @@ eliminate_alpha(GLsizei w, GLsizei h, GLuint * map)
     }
 }
 
+/* makes the baker, telling it how make_projection() turns each face */
+void 
+init_baker(void)
+{
+    GLfloat m[16];
+    int i;
+
+    baker = smBakerNew(sphereW, faceW);
+    if (!baker) {
+	fprintf(stderr, "Could not make the sphere map baker\n");
+	exit(1);
+    }
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+    for (i = 0; i < 6; i++) {
+	glLoadIdentity();
+	if (angle2[i]) {
+	    glRotatef(angle2[i], axis2[i][0], axis2[i][1], axis2[i][2]);
+	}
+	glRotatef(angle1[i], axis1[i][0], axis1[i][1], axis1[i][2]);
+	glGetFloatv(GL_MODELVIEW_MATRIX, m);
+	smBakerFace(baker, i, m);
+    }
+    glPopMatrix();
+}
+
 void 
 init(const char *fname)
 {
@@ -160,6 +189,7 @@ init(const char *fname)
     glClearColor(.25, .25, .5, 1.0);
 
     realloc_textures();
+    init_baker();
 }
 
 /*ARGSUSED1*/
@@ -579,6 +609,20 @@ render_spheremap(void)
     glDisable(GL_TEXTURE_2D);
 }
 
+/* the sphere map from faceMap into map: on the CPU with the baker, or
+   with render_spheremap() in the window at (x, y) and read back */
+void 
+make_spheremap(int x, int y, GLuint * map)
+{
+    if (cpuBake) {
+	smBake(baker, faceMap, map);
+	return;
+    }
+    glViewport(x, y, sphereW, sphereW);
+    render_spheremap();
+    glReadPixels(x, y, sphereW, sphereW, GL_RGBA, GL_UNSIGNED_BYTE, map);
+}
+
 void 
 make_projection(int face, GLfloat xpos, GLfloat ypos, GLfloat zpos)
 {
@@ -660,10 +704,7 @@ draw(void)
 	eliminate_alpha(faceW, faceW, faceMap[BACK]);
 
 	/* create the sphere map for the cube... */
-	glViewport(w, 2 * faceW, sphereW, sphereW);
-	render_spheremap();
-	glReadPixels(w, 2 * faceW, sphereW, sphereW, GL_RGBA, GL_UNSIGNED_BYTE,
-		     sphereMap[0]);
+	make_spheremap(w, 2 * faceW, sphereMap[0]);
     } else {
 	sphereX =
 	    sphereY = cos((degrees / 360.) * 2. * M_PI);
@@ -712,10 +753,7 @@ draw(void)
 	eliminate_alpha(faceW, faceW, faceMap[BACK]);
 
 	/* create the sphere map for the cube... */
-	glViewport(w + sphereW, 2 * faceW, sphereW, sphereW);
-	render_spheremap();
-	glReadPixels(w + sphereW, 2 * faceW, sphereW, sphereW,
-		     GL_RGBA, GL_UNSIGNED_BYTE, sphereMap[1]);
+	make_spheremap(w + sphereW, 2 * faceW, sphereMap[1]);
     }
     frame = (frame == 0);
 
@@ -762,6 +800,11 @@ key(unsigned char key, int x, int y)
 	animate = (animate == 0);
 	printf("%sanimating\n", animate ? "" : "not ");
 	break;
+    case 'c':
+    case 'C':
+	cpuBake = (cpuBake == 0);
+	printf("baking sphere maps %s\n", cpuBake ? "on the CPU" : "with OpenGL");
+	break;
     case 'd':
     case 'D':
 	printf("drawing\n");
@@ -807,6 +850,7 @@ main(int argc, char *argv[])
     init(defaultFile);
 
     printf("a - toggle animation\n");
+    printf("c - bake sphere maps on the CPU or with OpenGL\n");
     printf("r - reset sphere maps\n");
     printf("t - use textures\n");
     glutMainLoop();
@@ -0,0 +1,488 @@
+/* Copyright (c) Mark J. Kilgard, 1998.  */
+
+/* This program is freely distributable without licensing fees
+   and is provided without guarantee or warrantee expressed or
+   implied. This program is -not- in the public domain. */
+
+/* sm_bake.c - sphere map construction from six cube views, see
+   sm_bake.h */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <GL/glut.h>
+
+#include "sm_smapmesh.h"
+#include "sm_bake.h"
+#include "pool.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SM_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(GL_EXT_texture_object) && !defined(GL_VERSION_1_1)
+#define glBindTexture(A,B)     glBindTextureEXT(A,B)
+#endif
+
+#define SM_ROWS 16	/* sphere map rows handed out at once */
+
+#define SM_TABLE 0	/* jobs: working out the taps */
+#define SM_WARP  1	/* and using them */
+
+struct _SMmesh {
+	int steps, rings;	/* rings counts the extra edge ring, if any */
+	STXY *vertices;	/* 5 faces of steps x steps, then the back */
+					/* face's 4 edges of rings x steps */
+	GLuint *indices;	/* 5 faces then the back, triangles */
+	int faceIndices, backIndices;
+};
+
+/* where a sphere map texel comes from: the view (top 8 bits) and the
+   first of its 4 texels, and how far across and up the 4 it is, out
+   of 256 */
+typedef struct {
+	GLuint at;
+	GLushort wx, wy;
+} SMtap;
+
+struct _SMbaker {
+	int size, faceSize;
+	GLfloat m[6][9];	/* each face's rotation, row by row */
+	int stale;		/* taps not worked out for m yet */
+	SMtap *taps;
+
+	int kind;		/* of the job in hand */
+	GLuint **faces, *spheremap;
+
+	int threads;
+	pool_t *pool;
+};
+
+/* the faces as makeSphereMapMesh() lays them out, see sm_makemesh.c */
+static struct {
+	int xl;
+	int yl;
+	int zl;
+	int swap;
+	int flip;
+	float dir;
+} faceInfo[5] = {
+	{ 0, 1, 2, 0,  1.0,  1.0 },  /* front */
+	{ 0, 2, 1, 0, -1.0,  1.0 },  /* top */
+	{ 0, 2, 1, 0,  1.0, -1.0 },  /* bottom */
+	{ 1, 2, 0, 1, -1.0,  1.0 },  /* left */
+	{ 1, 2, 0, 1,  1.0, -1.0 },  /* right */
+};
+
+static struct {
+	int xl;
+	int yl;
+	float dir;
+} edgeInfo[4] = {
+	{ 0, 1, -1.0 },
+	{ 0, 1,  1.0 },
+	{ 1, 0, -1.0 },
+	{ 1, 0,  1.0 }
+};
+
+/* The quad strips between the rows of a grid of vertices, rows x
+   steps from first, as the 2 triangles a strip draws for each quad */
+static GLuint *
+stripTriangles(GLuint *t, GLuint first, int rows, int steps)
+{
+	int i, j;
+	GLuint k;
+
+	for (i=0; i<rows-1; i++) {
+		for (j=0; j<steps-1; j++) {
+			k = first + i*steps + j;
+			*t++ = k;
+			*t++ = k + steps;
+			*t++ = k + steps + 1;
+			*t++ = k;
+			*t++ = k + steps + 1;
+			*t++ = k + 1;
+		}
+	}
+	return t;
+}
+
+SMmesh *
+smMeshNew(int steps, int rings)
+{
+	SMmesh *mesh;
+	STXY *p;
+	GLuint *t;
+	float st[2], v[3], rv[3], len, sc, tc;
+	float s, ds, t0, dt, x, y, z;
+	int side, edge, i, j, nv, nt;
+
+	if (steps < 2)
+		steps = 2;
+	if (rings < 2)
+		rings = 2;
+
+	mesh = (SMmesh *) malloc(sizeof(SMmesh));
+	if (!mesh)
+		return NULL;
+	mesh->steps = steps;
+	mesh->rings = rings + EDGE_EXTEND;
+	nv = (5*steps + 4*mesh->rings) * steps;
+	nt = (5*(steps-1) + 4*(mesh->rings-1)) * (steps-1) * 2;
+	mesh->vertices = (STXY *) malloc(nv * sizeof(STXY));
+	mesh->indices = (GLuint *) malloc(nt * 3 * sizeof(GLuint));
+	if (!mesh->vertices || !mesh->indices) {
+		smMeshDelete(mesh);
+		return NULL;
+	}
+
+	/* the front and four side faces, as makeSphereMapMesh() */
+	p = mesh->vertices;
+	for (side=0; side<5; side++) {
+		v[faceInfo[side].zl] = faceInfo[side].dir;
+		for (i=0; i<steps; i++) {
+			v[faceInfo[side].yl] = 2.0/(steps-1) * i - 1.0;
+			for (j=0; j<steps; j++, p++) {
+				v[faceInfo[side].xl] = 2.0/(steps-1) * j - 1.0;
+				len = sqrt(v[0]*v[0] + v[1]*v[1] + v[2]*v[2]);
+				rv[0] = v[0]/len;
+				rv[1] = v[1]/len;
+				rv[2] = v[2]/len;
+				rvec2st(rv, st);
+				p->x = st[0];
+				p->y = st[1];
+				if (!faceInfo[side].swap) {
+					p->s = (-v[faceInfo[side].xl] + 1.0)/2.0;
+					p->t = (faceInfo[side].flip*v[faceInfo[side].yl] + 1.0)/2.0;
+				} else {
+					p->s = (faceInfo[side].flip*-v[faceInfo[side].yl] + 1.0)/2.0;
+					p->t = (v[faceInfo[side].xl] + 1.0)/2.0;
+				}
+			}
+		}
+	}
+
+	/* and the back face, from each edge in to its center on the
+	   sphere map's rim, ring i of edge e at p[(e*rings + i)*steps] */
+	v[2] = -1;
+	for (edge=0; edge<4; edge++) {
+		v[edgeInfo[edge].xl] = edgeInfo[edge].dir;
+		for (j=0; j<steps; j++) {
+			v[edgeInfo[edge].yl] = 2.0/(steps-1) * j - 1.0;
+			len = sqrt(v[0]*v[0] + v[1]*v[1] + v[2]*v[2]);
+			rv[0] = v[0]/len;
+			rv[1] = v[1]/len;
+			rv[2] = v[2]/len;
+			rvec2st(rv, st);
+			len = sqrt((st[0]-0.5)*(st[0]-0.5) + (st[1]-0.5)*(st[1]-0.5));
+			sc = (st[0]-0.5)/len * 0.5 + 0.5;
+			tc = (st[1]-0.5)/len * 0.5 + 0.5;
+
+			p = mesh->vertices + 5*steps*steps + edge*mesh->rings*steps + j;
+			p->s = (-v[0] + 1.0)/2.0;
+			p->t = (-v[1] + 1.0)/2.0;
+			p->x = st[0];
+			p->y = st[1];
+
+			s = st[0];
+			t0 = st[1];
+			ds = (sc - s) / (rings-1);
+			dt = (tc - t0) / (rings-1);
+			for (i=1; i<rings-1; i++) {
+				s = s + ds;
+				t0 = t0 + dt;
+				st2rvec(s, t0, &x, &y, &z);
+				x = x / -z;
+				y = y / -z;
+				p += steps;
+				p->s = (-x + 1.0)/2.0;
+				p->t = (-y + 1.0)/2.0;
+				p->x = s;
+				p->y = t0;
+			}
+
+			p += steps;
+			p->s = 0.5;
+			p->t = 0.5;
+			p->x = sc;
+			p->y = tc;
+#ifdef SPHERE_MAP_EDGE_EXTEND
+			p += steps;
+			p->s = 0.5;
+			p->t = 0.5;
+			p->x = sc + 0.33*(sc - st[0]);
+			p->y = tc + 0.33*(tc - st[1]);
+#endif
+		}
+	}
+
+	t = mesh->indices;
+	for (side=0; side<5; side++)
+		t = stripTriangles(t, side*steps*steps, steps, steps);
+	mesh->faceIndices = (steps-1) * (steps-1) * 6;
+	for (edge=0; edge<4; edge++)
+		t = stripTriangles(t, (5*steps + edge*mesh->rings)*steps,
+			mesh->rings, steps);
+	mesh->backIndices = 4 * (mesh->rings-1) * (steps-1) * 6;
+	return mesh;
+}
+
+void
+smMeshDelete(SMmesh *mesh)
+{
+	if (!mesh)
+		return;
+	free(mesh->vertices);
+	free(mesh->indices);
+	free(mesh);
+}
+
+void
+smMeshDraw(SMmesh *mesh, GLuint texobj[6])
+{
+	int side;
+
+	glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+	glTexCoordPointer(2, GL_FLOAT, sizeof(STXY), &mesh->vertices->s);
+	glVertexPointer(2, GL_FLOAT, sizeof(STXY), &mesh->vertices->x);
+	glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+	glEnableClientState(GL_VERTEX_ARRAY);
+	for (side=0; side<5; side++) {
+		glBindTexture(GL_TEXTURE_2D, texobj[side]);
+		glDrawElements(GL_TRIANGLES, mesh->faceIndices, GL_UNSIGNED_INT,
+			mesh->indices + side*mesh->faceIndices);
+	}
+	glBindTexture(GL_TEXTURE_2D, texobj[SM_BACK]);
+	glDrawElements(GL_TRIANGLES, mesh->backIndices, GL_UNSIGNED_INT,
+		mesh->indices + 5*mesh->faceIndices);
+	glPopClientAttrib();
+}
+
+/* The taps for sphere map rows begin to end.  The reflection vector
+   for each texel's center goes to the face it's most squarely in
+   front of, then to a point in that face's view as the camera's
+   frustum projects it.  Off the sphere, (s,t) is on the rim. */
+static void
+tableRows(SMbaker *b, int begin, int end)
+{
+	int i, j, k, face, x0, y0, n = b->faceSize;
+	float s, t, r[3], e[3], q, d, best, fx, fy, u = 0, v = 0;
+	double tmp1, tmp2;
+	SMtap *tap;
+
+	for (j=begin; j<end; j++) {
+		tap = b->taps + j*b->size;
+		t = (j + 0.5) / b->size;
+		for (i=0; i<b->size; i++, tap++) {
+			s = (i + 0.5) / b->size;
+
+			/* st2rvec(), kept real past the rim */
+			tmp1 = s*(1-s) + t*(1-t);
+			tmp2 = 4*tmp1 - 1;
+			tmp2 = tmp2 > 0 ? 2 * sqrt(tmp2) : 0;
+			r[0] = tmp2 * (2*s-1);
+			r[1] = tmp2 * (2*t-1);
+			r[2] = tmp2 > 0 ? 8 * tmp1 - 3 : -1;
+
+			face = 0;
+			best = -1;
+			for (k=0; k<6; k++) {
+				e[0] = b->m[k][0]*r[0] + b->m[k][1]*r[1] + b->m[k][2]*r[2];
+				e[1] = b->m[k][3]*r[0] + b->m[k][4]*r[1] + b->m[k][5]*r[2];
+				e[2] = b->m[k][6]*r[0] + b->m[k][7]*r[1] + b->m[k][8]*r[2];
+				q = -e[2];
+				if (q <= 0)
+					continue;
+				d = fabs(e[0]) > fabs(e[1]) ? fabs(e[0]) : fabs(e[1]);
+				if (d < q * 1e-6)
+					d = q * 1e-6;
+				if (q / d > best) {
+					best = q / d;
+					face = k;
+					u = e[0] / q;
+					v = e[1] / q;
+				}
+			}
+
+			/* clamped to the edge, with the 4 texels always inside */
+			fx = (u + 1) / 2 * n - 0.5;
+			fy = (v + 1) / 2 * n - 0.5;
+			fx = fx < 0 ? 0 : fx > n - 1 ? n - 1 : fx;
+			fy = fy < 0 ? 0 : fy > n - 1 ? n - 1 : fy;
+			x0 = (int) fx < n - 2 ? (int) fx : n - 2;
+			y0 = (int) fy < n - 2 ? (int) fy : n - 2;
+			tap->at = (GLuint) face << 24 | (GLuint) (y0*n + x0);
+			tap->wx = (GLushort) floor((fx - x0) * 256 + 0.5);
+			tap->wy = (GLushort) floor((fy - y0) * 256 + 0.5);
+		}
+	}
+}
+
+/* Sphere map rows begin to end from the taps: across, then up, each
+   rounded to 8 bits, the same with SSE2 or without. */
+static void
+warpRows(SMbaker *b, int begin, int end)
+{
+	const SMtap *tap = b->taps + begin*b->size;
+	const SMtap *last = b->taps + end*b->size;
+	GLuint *out = b->spheremap + begin*b->size;
+	const GLuint *p;
+	int n = b->faceSize;
+#ifdef SM_SSE2
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i half = _mm_set1_epi16(128);
+	__m128i a, c, w;
+	GLuint x;
+#else
+	const GLubyte *p0, *p1;
+	unsigned h0, h1, wx, wy;
+	GLubyte c[4];
+	int k;
+#endif
+
+	for (; tap<last; tap++, out++) {
+		p = b->faces[tap->at >> 24] + (tap->at & 0xffffff);
+#ifdef SM_SSE2
+		a = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) p), zero);
+		c = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) (p + n)), zero);
+		w = _mm_set_epi16(tap->wx, tap->wx, tap->wx, tap->wx,
+			256 - tap->wx, 256 - tap->wx, 256 - tap->wx, 256 - tap->wx);
+		a = _mm_mullo_epi16(a, w);
+		c = _mm_mullo_epi16(c, w);
+		a = _mm_add_epi16(_mm_unpacklo_epi64(a, c), _mm_unpackhi_epi64(a, c));
+		a = _mm_srli_epi16(_mm_add_epi16(a, half), 8);
+		w = _mm_set_epi16(tap->wy, tap->wy, tap->wy, tap->wy,
+			256 - tap->wy, 256 - tap->wy, 256 - tap->wy, 256 - tap->wy);
+		a = _mm_mullo_epi16(a, w);
+		a = _mm_add_epi16(a, _mm_srli_si128(a, 8));
+		a = _mm_srli_epi16(_mm_add_epi16(a, half), 8);
+		x = (GLuint) _mm_cvtsi128_si32(_mm_packus_epi16(a, a));
+		memcpy(out, &x, 4);
+#else
+		p0 = (const GLubyte *) p;
+		p1 = (const GLubyte *) (p + n);
+		wx = tap->wx;
+		wy = tap->wy;
+		for (k=0; k<4; k++) {
+			h0 = (p0[k]*(256 - wx) + p0[k + 4]*wx + 128) >> 8;
+			h1 = (p1[k]*(256 - wx) + p1[k + 4]*wx + 128) >> 8;
+			c[k] = (GLubyte) ((h0*(256 - wy) + h1*wy + 128) >> 8);
+		}
+		memcpy(out, c, 4);
+#endif
+	}
+}
+
+/* Tiles begin to end of the job in hand in b, for the pool */
+static void
+doTiles(void *arg, int begin, int end)
+{
+	SMbaker *b = (SMbaker *) arg;
+
+	begin *= SM_ROWS;
+	end = end * SM_ROWS < b->size ? end * SM_ROWS : b->size;
+	if (b->kind == SM_TABLE)
+		tableRows(b, begin, end);
+	else
+		warpRows(b, begin, end);
+}
+
+/* Run the job set up in b, a tile at a time on the worker pool in
+   sig99/adv99/util if it's worth it */
+static void
+run(SMbaker *b)
+{
+	int tiles = (b->size + SM_ROWS - 1) / SM_ROWS;
+
+	if (b->threads > 1 && tiles > 1 && !b->pool)
+		b->pool = pool_new(b->threads);
+	pool_run(b->pool, doTiles, b, tiles, 1, tiles);
+}
+
+SMbaker *
+smBakerNew(int size, int faceSize)
+{
+	SMbaker *b;
+	int side, k;
+
+	if (size < 1 || faceSize < 2 || faceSize > 4096)
+		return NULL;
+	b = (SMbaker *) calloc(1, sizeof(SMbaker));
+	if (!b)
+		return NULL;
+	b->taps = (SMtap *) malloc((size_t) size * size * sizeof(SMtap));
+	if (!b->taps) {
+		free(b);
+		return NULL;
+	}
+	b->size = size;
+	b->faceSize = faceSize;
+	b->stale = 1;
+	b->threads = pool_cpus();
+
+	/* each face's (s,t) in makeSphereMapMesh() as a camera would see
+	   it: across is -x (or -flip y when swapped), up flip y (or x),
+	   and the camera looks down dir z */
+	for (side=0; side<5; side++) {
+		k = faceInfo[side].swap ? faceInfo[side].yl : faceInfo[side].xl;
+		b->m[side][k] = faceInfo[side].swap ? -faceInfo[side].flip : -1;
+		k = faceInfo[side].swap ? faceInfo[side].xl : faceInfo[side].yl;
+		b->m[side][3 + k] = faceInfo[side].swap ? 1 : faceInfo[side].flip;
+		b->m[side][6 + faceInfo[side].zl] = -faceInfo[side].dir;
+	}
+	b->m[SM_BACK][0] = -1;
+	b->m[SM_BACK][4] = -1;
+	b->m[SM_BACK][8] = 1;
+	return b;
+}
+
+void
+smBakerDelete(SMbaker *b)
+{
+	if (!b)
+		return;
+	pool_delete(b->pool);
+	free(b->taps);
+	free(b);
+}
+
+void
+smBakerFace(SMbaker *b, int face, const GLfloat m[16])
+{
+	GLfloat r[9];
+	int i, j;
+
+	for (i=0; i<3; i++)
+		for (j=0; j<3; j++)
+			r[3*i + j] = m[4*j + i];
+	if (memcmp(r, b->m[face], sizeof(r)) != 0) {
+		memcpy(b->m[face], r, sizeof(r));
+		b->stale = 1;
+	}
+}
+
+void
+smBake(SMbaker *b, GLuint *faces[6], GLuint *spheremap)
+{
+	if (b->stale) {
+		b->kind = SM_TABLE;
+		run(b);
+		b->stale = 0;
+	}
+	b->faces = faces;
+	b->spheremap = spheremap;
+	b->kind = SM_WARP;
+	run(b);
+}
+
+void
+smBakerThreads(SMbaker *b, int threads)
+{
+	b->threads = threads < 1 ? 1 : threads;
+	/* a pool of the wrong size is made again when next wanted */
+	if (b->pool && pool_threads(b->pool) != b->threads) {
+		pool_delete(b->pool);
+		b->pool = NULL;
+	}
+}
@@ -0,0 +1,60 @@
+/* sm_bake.h - sphere map construction from six cube views, as a
+   warp mesh for OpenGL to draw or resampled on the CPU */
+
+/* smMeshNew() builds the mesh makeSphereMapMesh() builds, at any
+   number of steps across a face and rings in to the back face's
+   singularity, once, as vertex arrays; smMeshDraw() draws it with one
+   glDrawElements() a face.
+
+   smBake() does the same warp without OpenGL: each sphere map texel
+   is a bilinear fetch from one of the six views, and where to fetch
+   from (which view, which 4 texels and how much of each) is worked
+   out once, the first time, with st2rvec().  The fetches are done 2
+   channels of 4 texels at a time with SSE2 where there is any, and
+   rows are shared out between threads. */
+
+#ifndef SM_BAKE_H
+#define SM_BAKE_H
+
+#include <GL/glut.h>
+
+#define SM_FRONT  0	/* the faces, in the order sm_cview2smap.c */
+#define SM_TOP    1	/* renders them and smMeshDraw() takes their */
+#define SM_BOTTOM 2	/* texture objects */
+#define SM_LEFT   3
+#define SM_RIGHT  4
+#define SM_BACK   5
+
+typedef struct _SMmesh SMmesh;
+typedef struct _SMbaker SMbaker;
+
+/* steps across each face, rings from the edge of the back face to
+   its center (makeSphereMapMesh() has 8 and 3); NULL if out of memory */
+extern SMmesh *smMeshNew(int steps, int rings);
+extern void smMeshDelete(SMmesh *mesh);
+
+/* draws the mesh in (0..1, 0..1), binding texobj[face] for each face */
+extern void smMeshDraw(SMmesh *mesh, GLuint texobj[6]);
+
+/* a sphere map size x size from views faceSize x faceSize, at most
+   4096; NULL if out of memory */
+extern SMbaker *smBakerNew(int size, int faceSize);
+extern void smBakerDelete(SMbaker *baker);
+
+/* How view face was rendered: m (column major, as from glGetFloatv)
+   takes a reflection vector in the sphere map's eye space to the eye
+   space of a camera with a 90 degree square frustum, whose image is
+   the view.  Only the rotation in m is used.  Until set, each face is
+   where smMeshDraw() would put it. */
+extern void smBakerFace(SMbaker *baker, int face, const GLfloat m[16]);
+
+/* faces[face] is the view for face, faceSize x faceSize texels of 4
+   bytes (RGBA, but any 4 will do) from the bottom row up, as
+   glReadPixels() leaves them; spheremap gets size x size texels.  Off
+   the sphere, texels are what the rim of it is. */
+extern void smBake(SMbaker *baker, GLuint *faces[6], GLuint *spheremap);
+
+/* most threads smBake() may use (the number of processors unless set) */
+extern void smBakerThreads(SMbaker *baker, int threads);
+
+#endif
@@ -0,0 +1,325 @@
+/* Copyright (c) Mark J. Kilgard, 1998.  */
+
+/* This program is freely distributable without licensing fees
+   and is provided without guarantee or warrantee expressed or
+   implied. This program is -not- in the public domain. */
+
+/* sm_bakebench.c - sphere maps a second from six views with sm_bake.c */
+
+/* For sphere maps 256 to 2048 across, from views half that, prints
+   how long smBake() takes to work out its taps the first time, then
+   sphere maps a second on one thread and on all of them (each over at
+   least a quarter of a second).
+
+   Built with -DSM_EGL (and -lEGL) it also times OpenGL doing the
+   same warp with no window or display: the six views loaded with
+   glTexImage2D(), as spheremap.c loads them, the mesh drawn, and the
+   sphere map read back, with drawSphereMapMesh() and with smMeshDraw()
+   at 8 and 64 steps.  It prints how far each comes out from smBake(),
+   on average and at worst, over the texels inside the sphere.
+
+   usage: sm_bakebench [threads] */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#ifdef SM_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+#include <GL/glut.h>
+
+#include "sm_smapmesh.h"
+#include "sm_bake.h"
+
+#ifdef _WIN32
+#include <windows.h>
+typedef int timer;
+#define getTime(a)      (a = GetTickCount())
+#define timeDiff(a, b)  ((b - a) * 1000)
+#else
+#include <sys/time.h>
+typedef struct timeval timer;
+#define getTime(a)      gettimeofday(&a, NULL)
+#define timeDiff(a, b)  (((b.tv_sec - a.tv_sec) * 1000000) + b.tv_usec - a.tv_usec)
+#endif
+
+#define MAXSIZE 2048
+
+int threads = 0;	/* all of them */
+
+GLuint *faces[6];
+GLuint *cpu, *image;
+
+/* which way across, up and out each face looks, where smMeshDraw()
+   and smBake() put them */
+float look[6][3][3] = {
+	{ { -1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } },	/* front */
+	{ { -1, 0, 0 }, { 0, 0, -1 }, { 0, 1, 0 } },	/* top */
+	{ { -1, 0, 0 }, { 0, 0, 1 }, { 0, -1, 0 } },	/* bottom */
+	{ { 0, 0, 1 }, { 0, 1, 0 }, { 1, 0, 0 } },	/* left */
+	{ { 0, 0, -1 }, { 0, 1, 0 }, { -1, 0, 0 } },	/* right */
+	{ { -1, 0, 0 }, { 0, -1, 0 }, { 0, 0, -1 } }	/* back */
+};
+
+/* Six views of a world colored by direction, x red, y green and z
+   blue, so it's smooth across the seams */
+void
+makeFaces(int n)
+{
+	GLubyte *p;
+	float u, v, d[3], len;
+	int face, x, y, k;
+
+	for (face=0; face<6; face++) {
+		p = (GLubyte *) faces[face];
+		for (y=0; y<n; y++) {
+			v = (y + 0.5) / n * 2 - 1;
+			for (x=0; x<n; x++, p+=4) {
+				u = (x + 0.5) / n * 2 - 1;
+				for (k=0; k<3; k++)
+					d[k] = u*look[face][0][k] + v*look[face][1][k] +
+						look[face][2][k];
+				len = sqrt(d[0]*d[0] + d[1]*d[1] + d[2]*d[2]);
+				for (k=0; k<3; k++)
+					p[k] = (GLubyte) ((d[k]/len + 1) * 127.5);
+				p[3] = 255;
+			}
+		}
+	}
+}
+
+/* sphere maps a second from baker */
+double
+bakeRate(SMbaker *baker)
+{
+	timer t0, t1;
+	long n = 0, usec;
+
+	getTime(t0);
+	do {
+		smBake(baker, faces, cpu);
+		n++;
+		getTime(t1);
+		usec = timeDiff(t0, t1);
+	} while (usec < 250000);
+	return n * 1e6 / usec;
+}
+
+#ifdef SM_EGL
+
+SMmesh *mesh8, *mesh64;
+GLuint texobjs[6] = { 1, 2, 3, 4, 5, 6 };
+
+/* a context with no display; exits if there isn't one */
+void
+context(void)
+{
+	EGLint config[] = { EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+		EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+		EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8,
+		EGL_ALPHA_SIZE, 8, EGL_NONE };
+	EGLint size[] = { EGL_WIDTH, MAXSIZE, EGL_HEIGHT, MAXSIZE, EGL_NONE };
+	PFNEGLGETPLATFORMDISPLAYEXTPROC platform;
+	EGLDisplay dpy;
+	EGLConfig cfg;
+	EGLSurface surface;
+	EGLContext ctx;
+	EGLint major, minor, n;
+
+	platform = (PFNEGLGETPLATFORMDISPLAYEXTPROC)
+		eglGetProcAddress("eglGetPlatformDisplayEXT");
+#ifdef EGL_PLATFORM_SURFACELESS_MESA
+	if (platform)
+		dpy = platform(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+	else
+#endif
+		dpy = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+	if (dpy == EGL_NO_DISPLAY || !eglInitialize(dpy, &major, &minor) ||
+		!eglBindAPI(EGL_OPENGL_API) ||
+		!eglChooseConfig(dpy, config, &cfg, 1, &n) || n < 1) {
+		fprintf(stderr, "sm_bakebench: no EGL display\n");
+		exit(1);
+	}
+	surface = eglCreatePbufferSurface(dpy, cfg, size);
+	ctx = eglCreateContext(dpy, cfg, EGL_NO_CONTEXT, NULL);
+	if (surface == EGL_NO_SURFACE || ctx == EGL_NO_CONTEXT ||
+		!eglMakeCurrent(dpy, surface, surface, ctx)) {
+		fprintf(stderr, "sm_bakebench: no EGL context\n");
+		exit(1);
+	}
+}
+
+void
+initGL(void)
+{
+	int i;
+
+	context();
+	makeSphereMapMesh();
+	mesh8 = smMeshNew(8, 3);
+	mesh64 = smMeshNew(64, 24);
+	if (!mesh8 || !mesh64) {
+		fprintf(stderr, "sm_bakebench: out of memory\n");
+		exit(1);
+	}
+	for (i=0; i<6; i++) {
+		glBindTexture(GL_TEXTURE_2D, texobjs[i]);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	}
+	glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_REPLACE);
+	glEnable(GL_TEXTURE_2D);
+	glPixelStorei(GL_PACK_ALIGNMENT, 1);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glMatrixMode(GL_PROJECTION);
+	glLoadIdentity();
+	gluOrtho2D(0, 1, 0, 1);
+	glMatrixMode(GL_MODELVIEW);
+	glLoadIdentity();
+}
+
+/* one sphere map size across with OpenGL, how says: 0 for
+   drawSphereMapMesh(), else the mesh */
+void
+glWarp(int size, int faceSize, SMmesh *how)
+{
+	int i;
+
+	for (i=0; i<6; i++) {
+		glBindTexture(GL_TEXTURE_2D, texobjs[i]);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, faceSize, faceSize, 0,
+			GL_RGBA, GL_UNSIGNED_BYTE, faces[i]);
+	}
+	glViewport(0, 0, size, size);
+	glClear(GL_COLOR_BUFFER_BIT);
+	if (how)
+		smMeshDraw(how, texobjs);
+	else
+		drawSphereMapMesh(texobjs);
+	glReadPixels(0, 0, size, size, GL_RGBA, GL_UNSIGNED_BYTE, image);
+}
+
+/* sphere maps a second with OpenGL */
+double
+glRate(int size, int faceSize, SMmesh *how)
+{
+	timer t0, t1;
+	long n = 0, usec;
+
+	glWarp(size, faceSize, how);	/* untimed, to settle in */
+	getTime(t0);
+	do {
+		glWarp(size, faceSize, how);
+		n++;
+		getTime(t1);
+		usec = timeDiff(t0, t1);
+	} while (usec < 250000);
+	return n * 1e6 / usec;
+}
+
+/* how far image is from cpu in the sphere, less a texel's rim */
+void
+compare(int size, double *mean, int *worst)
+{
+	GLubyte *a = (GLubyte *) cpu, *b = (GLubyte *) image;
+	double s, t, r = 0.5 - 1.5 / size, sum = 0;
+	int i, j, k, d, n = 0;
+
+	*worst = 0;
+	for (j=0; j<size; j++) {
+		t = (j + 0.5) / size - 0.5;
+		for (i=0; i<size; i++) {
+			s = (i + 0.5) / size - 0.5;
+			if (s*s + t*t > r*r)
+				continue;
+			for (k=0; k<3; k++) {
+				d = abs(a[4*(j*size + i) + k] - b[4*(j*size + i) + k]);
+				sum += d;
+				if (d > *worst)
+					*worst = d;
+			}
+			n += 3;
+		}
+	}
+	*mean = n ? sum / n : 0;
+}
+
+#endif
+
+void
+bench(int size)
+{
+	SMbaker *baker;
+	timer t0, t1;
+	int faceSize = size / 2;
+	double setup, one, all;
+#ifdef SM_EGL
+	static char *names[] = { "drawSphereMapMesh", "smMeshDraw 8", "smMeshDraw 64" };
+	SMmesh *meshes[3];
+	double mean;
+	int how, worst;
+
+	meshes[0] = NULL;
+	meshes[1] = mesh8;
+	meshes[2] = mesh64;
+#endif
+
+	makeFaces(faceSize);
+	baker = smBakerNew(size, faceSize);
+	if (!baker) {
+		fprintf(stderr, "sm_bakebench: out of memory\n");
+		exit(1);
+	}
+	if (threads)
+		smBakerThreads(baker, threads);
+	getTime(t0);
+	smBake(baker, faces, cpu);
+	getTime(t1);
+	setup = timeDiff(t0, t1) / 1000.0;
+	all = bakeRate(baker);
+	smBakerThreads(baker, 1);
+	one = bakeRate(baker);
+	printf("%4d from %4d  %9.1f ms  %9.1f %9.1f\n", size, faceSize,
+		setup, one, all);
+	smBake(baker, faces, cpu);
+	smBakerDelete(baker);
+
+#ifdef SM_EGL
+	for (how=0; how<3; how++) {
+		printf("  %-20s %20.1f", names[how], glRate(size, faceSize, meshes[how]));
+		compare(size, &mean, &worst);
+		printf("  off by %.2f, at worst %d\n", mean, worst);
+	}
+#endif
+}
+
+int
+main(int argc, char **argv)
+{
+	int size, i;
+
+	if (argc > 1)
+		threads = atoi(argv[1]);
+	cpu = (GLuint *) malloc(MAXSIZE * MAXSIZE * sizeof(GLuint));
+	image = (GLuint *) malloc(MAXSIZE * MAXSIZE * sizeof(GLuint));
+	for (i=0; i<6; i++) {
+		faces[i] = (GLuint *) malloc(MAXSIZE/2 * MAXSIZE/2 * sizeof(GLuint));
+		if (!faces[i] || !cpu || !image) {
+			fprintf(stderr, "sm_bakebench: out of memory\n");
+			exit(1);
+		}
+	}
+
+#ifdef SM_EGL
+	initGL();
+	printf("%s\n", glGetString(GL_RENDERER));
+#endif
+	printf("%-17s %12s %9s %9s\n", "sphere map", "first bake",
+		"1 thread", "threads");
+	for (size=256; size<=MAXSIZE; size*=2)
+		bench(size);
+	return 0;
+}
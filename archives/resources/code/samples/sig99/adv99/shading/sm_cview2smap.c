@@ -13,6 +13,7 @@
 #include <GL/glut.h>
 
 #include "sm_smapmesh.h"
+#include "sm_bake.h"
 
 #if defined(GL_EXT_texture_object) && !defined(GL_VERSION_1_1)
 #define glBindTexture(A,B)     glBindTextureEXT(A,B)
@@ -27,6 +28,14 @@ GLfloat obj[3] = { 0, 0, 0 };
 int outline = 0;
 int bufswap = 1;
 int texdim = 128;
+int cpuWarp = 0;
+
+#define SMAPDIM 256	/* of the sphere map the CPU warps to */
+
+SMmesh *mesh;
+SMbaker *baker;
+GLuint *faceImage[6];
+GLuint *sphereImage;
 
 static int W, H;
 
@@ -165,6 +174,54 @@ configFace(int i)
 	positionLights();
 }
 
+/* The six views, read back, warped into a sphere map by smBake()
+   and drawn as a texture over the whole window. */
+void
+drawCPUWarp(void)
+{
+	smBake(baker, faceImage, sphereImage);
+	glBindTexture(GL_TEXTURE_2D, 7);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_REPLACE);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, SMAPDIM, SMAPDIM, 0,
+		GL_RGBA, GL_UNSIGNED_BYTE, sphereImage);
+	glBegin(GL_QUADS);
+	glTexCoord2f(0, 0);
+	glVertex2f(0, 0);
+	glTexCoord2f(1, 0);
+	glVertex2f(1, 0);
+	glTexCoord2f(1, 1);
+	glVertex2f(1, 1);
+	glTexCoord2f(0, 1);
+	glVertex2f(0, 1);
+	glEnd();
+}
+
+/* A baker for views texdim across; exits if out of memory. */
+void
+newBaker(void)
+{
+	smBakerDelete(baker);
+	baker = smBakerNew(SMAPDIM, texdim);
+	if (!baker) {
+		fprintf(stderr, "cview2smap: out of memory\n");
+		exit(1);
+	}
+}
+
+/* The warp mesh with steps across each face; exits if out of memory. */
+void
+newMesh(int steps)
+{
+	smMeshDelete(mesh);
+	mesh = smMeshNew(steps, steps * RINGS / XSTEPS);
+	if (!mesh) {
+		fprintf(stderr, "cview2smap: out of memory\n");
+		exit(1);
+	}
+}
+
 void
 display(void)
 {
@@ -183,7 +240,11 @@ display(void)
 	for (i=0; i<6; i++) {
 		configFace(i);
 		drawView(0);
-		snagImageAsTexture(1+i);
+		if (cpuWarp)
+			glReadPixels(0, 0, texdim, texdim,
+				GL_RGBA, GL_UNSIGNED_BYTE, faceImage[i]);
+		else
+			snagImageAsTexture(1+i);
 	}
 
 	glDisable(GL_SCISSOR_TEST);
@@ -196,13 +257,16 @@ display(void)
 	glLoadIdentity();
 	glDisable(GL_DEPTH_TEST);
 	glEnable(GL_TEXTURE_2D);
-	drawSphereMapMesh(texobjs);
+	if (cpuWarp)
+		drawCPUWarp();
+	else
+		smMeshDraw(mesh, texobjs);
 	glDisable(GL_TEXTURE_2D);
 	if (outline) {
 		glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 		glDisable(GL_LIGHTING);
 		glColor3f(1.0, 1.0, 1.0);
-		drawSphereMapMesh(texobjs);
+		smMeshDraw(mesh, texobjs);
 		glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
 		glEnable(GL_LIGHTING);
 	}
@@ -247,12 +311,27 @@ menu(int value)
 		break;
 	case 7:
 		texdim = 64;
+		newBaker();
 		break;
 	case 8:
 		texdim = 128;
+		newBaker();
 		break;
 	case 9:
 		texdim = 256;
+		newBaker();
+		break;
+	case 10:
+		cpuWarp = 0;
+		break;
+	case 11:
+		cpuWarp = 1;
+		break;
+	case 12:
+		newMesh(XSTEPS);
+		break;
+	case 13:
+		newMesh(4 * XSTEPS);
 		break;
 	}
 	glutPostRedisplay();
@@ -315,7 +394,22 @@ initGraphicsState(void)
 int
 main(int argc, char **argv)
 {
-	makeSphereMapMesh();
+	int i;
+
+	newMesh(XSTEPS);
+	newBaker();
+	for (i=0; i<6; i++) {
+		faceImage[i] = (GLuint *) malloc(256 * 256 * sizeof(GLuint));
+		if (!faceImage[i]) {
+			fprintf(stderr, "cview2smap: out of memory\n");
+			exit(1);
+		}
+	}
+	sphereImage = (GLuint *) malloc(SMAPDIM * SMAPDIM * sizeof(GLuint));
+	if (!sphereImage) {
+		fprintf(stderr, "cview2smap: out of memory\n");
+		exit(1);
+	}
 
 	glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGB | GLUT_DEPTH);
 	glutCreateWindow("cview2smap");
@@ -335,6 +429,10 @@ main(int argc, char **argv)
 	glutAddMenuEntry("face tex dim = 64", 7);
 	glutAddMenuEntry("face tex dim = 128", 8);
 	glutAddMenuEntry("face tex dim = 256", 9);
+	glutAddMenuEntry("warp with OpenGL", 10);
+	glutAddMenuEntry("warp on CPU", 11);
+	glutAddMenuEntry("mesh steps = 8", 12);
+	glutAddMenuEntry("mesh steps = 32", 13);
 	glutAttachMenu(GLUT_RIGHT_BUTTON);
 
 	glutMouseFunc(mouse);
@@ -28,6 +28,8 @@ typedef struct _STXY {
 extern STXY face[5][YSTEPS][XSTEPS];
 extern STXY back[4][RINGS+EDGE_EXTEND][SPOKES];
 
+extern void rvec2st(float v[3], float st[2]);
+extern void st2rvec(float s, float t, float *xp, float *yp, float *zp);
 extern void makeSphereMapMesh(void);
 extern void drawSphereMapMesh(GLuint texobj[6]);
 
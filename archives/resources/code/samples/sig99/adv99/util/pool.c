@@ -0,0 +1,187 @@
+#include <stdlib.h>
+#include "pool.h"
+
+/* Win32 builds run jobs on the calling thread */
+#if defined(_WIN32) && !defined(POOL_NO_THREADS)
+#define POOL_NO_THREADS
+#endif
+
+#ifndef POOL_NO_THREADS
+#include <pthread.h>
+#include <unistd.h>
+
+struct pool {
+    int workers;
+    pthread_t *thread;
+    pthread_mutex_t lock;
+    pthread_cond_t start, done;
+    int generation;		/* bumped for every job */
+    int busy;			/* workers still running */
+    int quit;
+    pool_func_t func;
+    void *arg;
+    int slices, slice, end;
+    int next;			/* next slice to hand out */
+};
+
+/* the next slice of the job, under the lock; 0 when they're all taken */
+static int
+take(pool_t *p, int *begin, int *end) {
+    if (p->next >= p->slices)
+	return 0;
+    *begin = p->next++ * p->slice;
+    *end = *begin + p->slice;
+    if (*end > p->end || p->next == p->slices) *end = p->end;
+    return 1;
+}
+
+/* does slices, under the lock, until there are none left */
+static void
+work(pool_t *p) {
+    int begin, end;
+
+    while (take(p, &begin, &end)) {
+	pthread_mutex_unlock(&p->lock);
+	if (begin < end)
+	    p->func(p->arg, begin, end);
+	pthread_mutex_lock(&p->lock);
+    }
+}
+
+static void *
+worker(void *arg) {
+    pool_t *p = arg;
+    int seen = 0;
+
+    pthread_mutex_lock(&p->lock);
+    for(;;) {
+	while (p->generation == seen && !p->quit)
+	    pthread_cond_wait(&p->start, &p->lock);
+	if (p->quit)
+	    break;
+	seen = p->generation;
+	work(p);
+	if (--p->busy == 0)
+	    pthread_cond_signal(&p->done);
+    }
+    pthread_mutex_unlock(&p->lock);
+    return NULL;
+}
+
+pool_t *
+pool_new(int threads) {
+    pool_t *p;
+    int i, workers = threads - 1;
+
+    if (workers < 1)
+	return NULL;
+    p = calloc(1, sizeof(pool_t));
+    if (p == NULL)
+	return NULL;
+    p->thread = malloc(workers * sizeof(pthread_t));
+    if (p->thread == NULL) {
+	free(p);
+	return NULL;
+    }
+    pthread_mutex_init(&p->lock, NULL);
+    pthread_cond_init(&p->start, NULL);
+    pthread_cond_init(&p->done, NULL);
+    for(i = 0; i < workers; i++)
+	if (pthread_create(&p->thread[i], NULL, worker, p) != 0)
+	    break;
+    p->workers = i;
+    if (p->workers == 0) {
+	pool_delete(p);
+	return NULL;
+    }
+    return p;
+}
+
+void
+pool_delete(pool_t *p) {
+    int i;
+
+    if (p == NULL)
+	return;
+    pthread_mutex_lock(&p->lock);
+    p->quit = 1;
+    pthread_cond_broadcast(&p->start);
+    pthread_mutex_unlock(&p->lock);
+    for(i = 0; i < p->workers; i++)
+	pthread_join(p->thread[i], NULL);
+    pthread_mutex_destroy(&p->lock);
+    pthread_cond_destroy(&p->start);
+    pthread_cond_destroy(&p->done);
+    free(p->thread);
+    free(p);
+}
+
+int
+pool_threads(pool_t *p) {
+    return p == NULL ? 1 : p->workers + 1;
+}
+
+void
+pool_run(pool_t *p, pool_func_t func, void *arg,
+	int slices, int slice, int end) {
+    if (p == NULL || slices < 2) {
+	func(arg, 0, end);
+	return;
+    }
+
+    pthread_mutex_lock(&p->lock);
+    p->func = func;
+    p->arg = arg;
+    p->slices = slices;
+    p->slice = slice;
+    p->end = end;
+    p->next = 0;
+    p->busy = p->workers;
+    p->generation++;
+    pthread_cond_broadcast(&p->start);
+
+    /* the calling thread takes slices too */
+    work(p);
+    while (p->busy > 0)
+	pthread_cond_wait(&p->done, &p->lock);
+    pthread_mutex_unlock(&p->lock);
+}
+
+int
+pool_cpus(void) {
+    int n = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    return n < 1 ? 1 : n;
+}
+
+#else
+
+pool_t *
+pool_new(int threads) {
+    (void)threads;
+    return NULL;
+}
+
+void
+pool_delete(pool_t *p) {
+    (void)p;
+}
+
+int
+pool_threads(pool_t *p) {
+    (void)p;
+    return 1;
+}
+
+void
+pool_run(pool_t *p, pool_func_t func, void *arg,
+	int slices, int slice, int end) {
+    (void)p; (void)slices; (void)slice;
+    func(arg, 0, end);
+}
+
+int
+pool_cpus(void) {
+    return 1;
+}
+
+#endif
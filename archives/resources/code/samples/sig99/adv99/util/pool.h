@@ -0,0 +1,38 @@
+/*
+ * worker threads shared by the demos that split their work up
+ *
+ * A pool splits a job over [0, end) into slices and hands them out
+ * one at a time to the workers and to the calling thread, so a thread
+ * that finishes early just takes another, and returns when they are
+ * all done.  A few slices one to a thread split a job evenly; many
+ * small ones even out jobs whose parts take uneven time.  Win32 builds
+ * (or -DPOOL_NO_THREADS) have no pool and run every job on the calling
+ * thread.
+ */
+
+#ifndef POOL_H
+#define POOL_H
+
+typedef struct pool pool_t;
+
+/* does the part [begin, end) of a job */
+typedef void (*pool_func_t)(void *arg, int begin, int end);
+
+/* a pool with threads-1 workers; NULL when there are no threads or no
+   memory, which pool_run takes as a pool of none */
+pool_t *pool_new(int threads);
+void pool_delete(pool_t *p);
+
+/* threads in the pool, counting the calling thread */
+int pool_threads(pool_t *p);
+
+/* call func over [0, end) in slices slices of slice each, the last one
+   taking whatever is left; in one call over all of it when there's no
+   pool or only one slice */
+void pool_run(pool_t *p, pool_func_t func, void *arg,
+	int slices, int slice, int end);
+
+/* the number of processors, 1 when there are no threads */
+int pool_cpus(void);
+
+#endif